@@ -0,0 +1,132 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AMBIENT_LIGHT_H
+#define AMBIENT_LIGHT_H
+
+// Ambient light auto-brightness: sample source, filter and response curve.
+// Deliberately free of Arduino/ESP dependencies so it can be built on the host;
+// the device plugs in an ADC source, the host replays recorded light traces.
+//
+// Curve text format (ascending light levels, linear in between, clamped at the ends):
+//   level=brightness level=brightness ...
+//   level:      raw light level 0-4095 (12-bit ADC counts)
+//   brightness: 0-255
+// Example: "0=10 300=60 1500=160 3500=255"
+
+#include <stdint.h>
+
+#define AMBIENT_MAX_LEVEL         4095  // 12-bit ADC full scale
+#define AMBIENT_MEDIAN_WINDOW     5     // Samples in the median (spike rejection)
+#define AMBIENT_CURVE_MAX_POINTS  8
+#define AMBIENT_SETTLE_SAMPLES    8     // Unchanged smoothed samples before the output snaps to it
+
+/**
+ * Provides raw light levels, one per call
+ */
+class AmbientSampleSource {
+public:
+  virtual ~AmbientSampleSource() {}
+
+  /**
+   * Read one sample
+   * @param level Raw light level 0-AMBIENT_MAX_LEVEL
+   * @return false if no sample is available
+   */
+  virtual bool read(uint16_t& level) = 0;
+};
+
+/**
+ * Replays a recorded trace (e.g. logged from /api/stats), wrapping around
+ */
+class ReplaySampleSource : public AmbientSampleSource {
+public:
+  ReplaySampleSource(const uint16_t* samples, uint16_t count);
+  bool read(uint16_t& level) override;
+
+private:
+  const uint16_t* samples;
+  uint16_t count;
+  uint16_t next;
+};
+
+/**
+ * Median of the last AMBIENT_MEDIAN_WINDOW samples, smoothed by an
+ * exponential moving average and held within a hysteresis band so the
+ * display does not flicker around a threshold. The band does not apply
+ * once the smoothed level reaches either end of the range or stays
+ * unchanged for AMBIENT_SETTLE_SAMPLES, so a step always settles exactly.
+ */
+class AmbientLightFilter {
+public:
+  /**
+   * @param emaAlpha Smoothing factor in 1/256 (higher = faster response)
+   * @param hysteresis Minimum change in light level before the output moves,
+   *                   widened by 1/16 of the current level
+   */
+  AmbientLightFilter(uint8_t emaAlpha, uint16_t hysteresis);
+
+  void reset();
+
+  /**
+   * Feed one raw sample
+   * @return true if the output level changed
+   */
+  bool add(uint16_t raw);
+
+  // Output level (after hysteresis)
+  uint16_t level() const { return output; }
+
+  // Smoothed level before hysteresis
+  uint16_t smoothed() const { return (uint16_t)((emaQ8 + 128) >> 8); }
+
+  // True once the first sample was added
+  bool isReady() const { return count > 0; }
+
+private:
+  uint8_t emaAlpha;
+  uint16_t hysteresis;
+  uint16_t window[AMBIENT_MEDIAN_WINDOW];
+  uint8_t next;
+  uint8_t count;
+  uint32_t emaQ8;
+  uint16_t output;
+  uint16_t lastSmoothed;
+  uint8_t steadySamples;
+};
+
+struct AmbientCurve {
+  uint8_t count;
+  uint16_t level[AMBIENT_CURVE_MAX_POINTS];
+  uint8_t brightness[AMBIENT_CURVE_MAX_POINTS];
+};
+
+/**
+ * Compile a curve from text (format above)
+ * @return false on syntax errors, unsorted levels or too many points
+ */
+bool compileAmbientCurve(const char* text, AmbientCurve& curve);
+
+/**
+ * Brightness for a light level (linear between points, clamped at the ends)
+ */
+uint8_t evaluateAmbientCurve(const AmbientCurve& curve, uint16_t level);
+
+#endif // AMBIENT_LIGHT_H
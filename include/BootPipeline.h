@@ -0,0 +1,54 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BOOT_PIPELINE_H
+#define BOOT_PIPELINE_H
+
+#include <Arduino.h>
+
+/**
+ * Boot stages in the order they usually complete.
+ * Config and Display finish in setup(), the rest come up in the background from loop().
+ */
+enum class BootStage : uint8_t {
+  Config = 0,   // Configuration loaded from LittleFS
+  Display,      // LEDs initialized, rendering started
+  Web,          // Config web server listening
+  WiFi,         // Connected to WiFi
+  Time,         // First NTP sync completed
+  MDNS,         // mDNS responder started
+  Weather,      // First weather fetch done (or skipped)
+  Count
+};
+
+// Record completion time of a stage (first call wins)
+void bootStageDone(BootStage stage);
+
+bool isBootStageDone(BootStage stage);
+
+// True once all stages are done
+bool isBootComplete();
+
+// Milliseconds since boot when the stage finished (0 = pending)
+uint32_t getBootStageMillis(BootStage stage);
+
+const char* getBootStageName(BootStage stage);
+
+#endif // BOOT_PIPELINE_H
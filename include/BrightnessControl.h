@@ -21,14 +21,30 @@
 #ifndef BRIGHTNESS_CONTROL_H
 #define BRIGHTNESS_CONTROL_H
 
-#include <ESP32Time.h>
+#include <stdint.h>
+
+class AmbientSampleSource;
+
+struct AmbientLightStats {
+  bool enabled;         // Ambient light mode configured
+  uint16_t raw;         // Last raw sample
+  uint16_t level;       // Filtered level (median, EMA, hysteresis)
+  uint8_t brightness;   // Brightness from the curve
+  uint32_t samples;     // Samples taken
+  uint32_t changes;     // Brightness adjustments (level left the hysteresis band)
+};
 
 // Public API
 bool parseTime(const char* timeStr, int& hours, int& minutes);
 void initBrightnessControl();
-void updateBrightness(ESP32Time& rtc);
+bool updateBrightness();  // Call once per frame, true if the brightness changed (needs FastLED.show())
 uint8_t getCurrentMainBrightness();
 uint8_t getCurrentColonBrightness();
+void restoreBrightnessState(uint8_t mainBrightness, uint8_t colonBrightness);  // Seed from warm restart
 void invalidateBrightnessCache();  // Call this when config changes
+void notifyBrightnessClockStep();  // Call this when the clock was stepped
+void sampleAmbientLight();  // Take one light sample (own task, every AMBIENT_SAMPLE_INTERVAL_MS)
+void setAmbientSampleSource(AmbientSampleSource* source);  // Replace the ADC (e.g. replay a trace), nullptr = ADC
+AmbientLightStats getAmbientLightStats();
 
 #endif // BRIGHTNESS_CONTROL_H
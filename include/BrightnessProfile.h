@@ -0,0 +1,110 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BRIGHTNESS_PROFILE_H
+#define BRIGHTNESS_PROFILE_H
+
+// Weekly brightness profile: keyframes (time, level, easing) per weekday,
+// compiled into one sorted array and evaluated as a pure function of the
+// local time of week. Deliberately free of Arduino/ESP dependencies so it
+// can be built on the host.
+//
+// Text format (groups separated by ';', later groups override earlier days):
+//   <days>: HH:MM=level[easing] HH:MM=level[easing] ...
+//   days:   * | mo,tu,we,th,fr,sa,su | ranges like mo-fr
+//   easing: l linear (default), i ease-in, o ease-out, e ease-in-out, s step
+// The easing of a keyframe shapes the transition arriving at it, 's' holds
+// the previous level and switches at the keyframe time.
+// Example: "*: 06:30=20 07:30=255e 22:00=255 23:00=40; sa,su: 09:00=20 10:00=255e 23:00=255 23:30=40"
+
+#include <stdint.h>
+
+#define SECONDS_PER_DAY   86400UL
+#define SECONDS_PER_WEEK  (7UL * SECONDS_PER_DAY)
+
+#ifndef BRIGHTNESS_KEYFRAMES_PER_DAY
+#define BRIGHTNESS_KEYFRAMES_PER_DAY 8
+#endif
+#define BRIGHTNESS_MAX_KEYFRAMES (7 * BRIGHTNESS_KEYFRAMES_PER_DAY)
+
+enum class BrightnessEasing : uint8_t {
+  Linear,
+  EaseIn,
+  EaseOut,
+  EaseInOut,
+  Step
+};
+
+// Space in which levels are interpolated between keyframes
+enum class BrightnessCurve : uint8_t {
+  Linear,      // PWM level
+  Quadratic,   // Square root of the PWM level (gamma 2)
+  Perceptual   // CIE L* lightness, even perceived steps down to the dim end
+};
+
+struct BrightnessKeyframe {
+  uint32_t secondOfWeek;     // Sunday 00:00 = 0
+  uint8_t level;             // Brightness 0-255
+  BrightnessEasing easing;   // Transition from the previous keyframe
+};
+
+struct BrightnessProfile {
+  uint8_t count;
+  BrightnessCurve curve;   // Set by the caller, left untouched by the compilers
+  BrightnessKeyframe keyframes[BRIGHTNESS_MAX_KEYFRAMES];  // Sorted by secondOfWeek
+};
+
+/**
+ * Compile a profile from its text form
+ * @return false on a syntax error, a time repeated within a group or too many
+ *         keyframes for a day (profile left empty)
+ */
+bool compileBrightnessProfile(const char* text, BrightnessProfile& profile);
+
+/**
+ * Compile the same linear keyframes for every day of the week
+ * @param secondsOfDay Keyframe times (any order, at most BRIGHTNESS_KEYFRAMES_PER_DAY)
+ * @param levels Brightness at each keyframe
+ */
+void compileDailyProfile(BrightnessProfile& profile, const uint32_t* secondsOfDay, const uint8_t* levels, uint8_t count);
+
+/**
+ * Compile the classic single dim window (same every day) into keyframes
+ * Fade down ends at dimStart, fade up starts at dimEnd.
+ */
+void compileDimWindow(BrightnessProfile& profile, uint8_t normalBrightness, uint8_t dimBrightness,
+                      uint32_t dimStartSeconds, uint32_t dimEndSeconds, uint16_t fadeSeconds);
+
+/**
+ * Brightness at a time of week (binary search, fixed-point easing, no state)
+ * @param profile Compiled profile (an empty profile returns 255)
+ * @param secondOfWeek Local time in seconds since Sunday 00:00
+ * @param keyframe Receives the index of the keyframe last passed, may be nullptr
+ * @return Brightness 0-255
+ */
+uint8_t evaluateBrightness(const BrightnessProfile& profile, uint32_t secondOfWeek, uint8_t* keyframe = nullptr);
+
+/**
+ * Brightness at a time of week with millisecond resolution, for frame rate fades
+ * @param msOfWeek Local time in milliseconds since Sunday 00:00
+ */
+uint8_t evaluateBrightnessMs(const BrightnessProfile& profile, uint32_t msOfWeek, uint8_t* keyframe = nullptr);
+
+#endif // BRIGHTNESS_PROFILE_H
@@ -0,0 +1,76 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CITY_INDEX_H
+#define CITY_INDEX_H
+
+// Offline city search over the table generated by scripts/gen_city_table.py.
+// Reads the table in place (flash), nothing is copied to RAM. Free of
+// Arduino dependencies so it can be built on the host.
+
+#include <stdint.h>
+
+struct City {
+  const char* name;
+  char country[3];          // ISO 3166 code
+  const char* countryName;
+  const char* timezone;     // tz database name, e.g. "Europe/Zurich"
+  float latitude;           // Degrees, 0.01 resolution
+  float longitude;
+  uint8_t rank;             // Size on a log scale (255 = largest, 0 = unknown)
+};
+
+class CityIndex {
+public:
+  explicit CityIndex(const uint8_t* table);
+
+  // Table has the expected format
+  bool isValid() const { return cityCount > 0; }
+
+  uint16_t size() const { return cityCount; }
+
+  /**
+   * Cities whose name starts with prefix (case-insensitive, '_' matches ' ')
+   * @param results Receives up to maxResults cities, largest first, then by name
+   * @return Number of results (0 for an empty prefix)
+   */
+  uint8_t search(const char* prefix, City* results, uint8_t maxResults) const;
+
+  // City by position in name order
+  bool getCity(uint16_t index, City& city) const;
+
+private:
+  int compareName(uint16_t index, const char* prefix, uint8_t prefixLength) const;
+  uint8_t rankOf(uint16_t index) const;
+
+  const uint8_t* table;
+  uint16_t cityCount;
+  uint16_t countryCount;
+  uint16_t zoneCount;
+  const uint8_t* cities;
+  const uint8_t* countries;
+  const uint8_t* zones;
+  const char* pool;
+};
+
+// Index over the built-in table
+const CityIndex& getCityIndex();
+
+#endif // CITY_INDEX_H
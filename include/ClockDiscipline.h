@@ -0,0 +1,109 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CLOCK_DISCIPLINE_H
+#define CLOCK_DISCIPLINE_H
+
+#include <stdint.h>
+
+/**
+ * Keeps the system clock (which backs ESP32Time) in line with NTP
+ * without hard steps. Learns the crystal error in ppm across syncs,
+ * compensates it continuously and slews small offsets via adjtime().
+ * Offsets above CLOCK_SLEW_THRESHOLD_US are stepped and announced to
+ * consumers through the step callback.
+ */
+class ClockDiscipline {
+public:
+  enum class Action : uint8_t {
+    None,   // Offset negligible, nothing to do
+    Slew,   // Offset corrected gradually
+    Step    // Offset too large, clock set directly
+  };
+
+  struct Stats {
+    float driftPpm;           // Learned frequency error (positive = local clock slow)
+    int64_t lastOffsetUs;     // Offset measured at last sync (reference - local)
+    uint32_t samples;         // Number of NTP samples processed
+    uint32_t slews;           // Number of slewed corrections
+    uint32_t steps;           // Number of stepped corrections
+    uint32_t syncIntervalMs;  // Currently recommended NTP poll interval
+  };
+
+  typedef void (*StepCallback)(int64_t stepUs);
+
+  ClockDiscipline();
+
+  /**
+   * Feed one reference sample into the estimator (no side effects on the clock)
+   * @param referenceUs Reference time in microseconds since epoch (NTP)
+   * @param localUs Local clock in microseconds since epoch, including any pending slew
+   * @return Action the caller should apply for the measured offset
+   */
+  Action addSample(int64_t referenceUs, int64_t localUs);
+
+  /**
+   * Frequency correction to apply for the given elapsed local time
+   * @param elapsedUs Elapsed local time in microseconds
+   * @return Correction in microseconds (positive = advance clock)
+   */
+  int64_t driftCorrectionUs(int64_t elapsedUs) const;
+
+  // Install SNTP hook (call before configuring NTP)
+  void begin();
+
+  // Apply periodic drift compensation and dispatch step events (call from loop)
+  void loop();
+
+  // Register consumer for step events (called from loop context)
+  void onStep(StepCallback callback);
+
+  // Ask SNTP to poll immediately (e.g. after WiFi recovery)
+  void requestSync();
+
+  // Called from the SNTP task with a fresh reference time
+  void handleReference(int64_t referenceUs);
+
+  Stats getStats() const;
+
+  // True once at least one NTP sample was received
+  bool hasSynced() const { return samples > 0; }
+
+private:
+  float driftPpm;
+  int64_t lastOffsetUs;
+  int64_t lastSampleLocalUs;
+  uint32_t samples;
+  uint32_t driftSamples;
+  uint32_t slews;
+  uint32_t steps;
+  uint32_t syncIntervalMs;
+  uint32_t appliedSyncIntervalMs;
+  int64_t lastCompensationUs;
+  double compensationRemainderUs;
+  volatile int64_t pendingStepUs;
+  volatile bool stepPending;
+  StepCallback stepCallback;
+};
+
+// Global instance
+extern ClockDiscipline clockDiscipline;
+
+#endif // CLOCK_DISCIPLINE_H
@@ -40,13 +40,16 @@ struct Config {
   // Weather
   String locationLatitude;
   String locationLongitude;
+  uint8_t locationAutoTimezone;  // Time zone follows the location (TimezoneGrid)
   String locationUnits;
   uint8_t weatherTempEnabled;
   uint8_t weatherTempDisplayTime;
   int8_t weatherTempMin;
   int8_t weatherTempMax;
   String weatherTempSchedule;
+  String weatherLocations;  // Extra labelled locations, "label=lat,lon; ..."
   String weatherUpdateSchedule;
+  uint16_t weatherUpdateSkew;  // Random delay (0-n s) for scheduled updates, 0 = off
 
   // FastLED
   uint8_t ledBrightness;
@@ -55,6 +58,11 @@ struct Config {
   uint8_t ledDimFadeDuration;
   String ledDimStartTime;
   String ledDimEndTime;
+  String ledDimProfile;  // Weekly keyframes, empty = use the dim window
+  uint8_t ledFadeCurve;       // 0 = linear, 1 = quadratic, 2 = perceptual (CIE L*)
+  uint8_t ledAmbientEnabled;  // Brightness follows the light sensor
+  String ledAmbientCurve;     // Light level to brightness points
+  uint8_t ledDimSolar;   // Dim from civil dusk to civil dawn at the configured location
 
   // Clock Update
   String clockUpdateSchedule;
@@ -80,8 +88,8 @@ public:
   // Get current configuration
   Config& getConfig();
 
-  // Get schema JSON from LittleFS
-  String getSchema();
+  // Schema JSON, points into flash (no copy; served gzipped from web_assets.h)
+  const char* getSchema();
 
   // Validate configuration values are within acceptable ranges
   bool validateConfig();
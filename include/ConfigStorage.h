@@ -22,10 +22,17 @@
 #define CONFIG_STORAGE_H
 
 #include <Arduino.h>
+#include "config.h"
+#include "ForecastCache.h"
 
 #define TZNAME_MAX_LEN 50
 #define TIMEZONE_MAX_LEN 50
 #define CONFIG_FILE "/wifi_cred.dat"
+#define WIFI_FAST_CONNECT_FILE "/wifi_fast.dat"
+#define WIFI_NETWORKS_FILE "/wifi_networks.dat"
+#define FORECAST_CACHE_FILE "/forecast.dat"
+#define WIFI_SSID_MAX_LEN 33
+#define WIFI_PASS_MAX_LEN 65
 
 struct ClockConfig {
   char TZ_Name[TZNAME_MAX_LEN];
@@ -33,7 +40,44 @@ struct ClockConfig {
   uint16_t checksum;
 };
 
+// Last good connection, used for a directed (no scan, optionally no DHCP) reconnect
+struct WiFiFastConnect {
+  char ssid[WIFI_SSID_MAX_LEN];
+  uint8_t bssid[6];
+  uint8_t channel;
+  uint32_t ip;
+  uint32_t gateway;
+  uint32_t subnet;
+  uint32_t dns;
+  uint16_t checksum;
+};
+
+struct WiFiCredential {
+  char ssid[WIFI_SSID_MAX_LEN];
+  char pass[WIFI_PASS_MAX_LEN];
+};
+
+// Known networks, entry 0 is the one configured through the portal
+struct WiFiCredentialList {
+  uint8_t count;
+  WiFiCredential entries[NUM_WIFI_CREDENTIALS];
+  uint16_t checksum;
+};
+
+// Hourly forecasts per location, survive reboots so the temperature shows before the first fetch
+struct StoredForecast {
+  uint8_t count;
+  ForecastCache caches[WEATHER_MAX_LOCATIONS];
+  uint16_t checksum;
+};
+
 bool loadClockConfig(ClockConfig& config);
 bool saveClockConfig(const ClockConfig& config);
+bool loadWiFiFastConnect(WiFiFastConnect& fastConnect);
+bool saveWiFiFastConnect(const WiFiFastConnect& fastConnect);
+bool loadWiFiCredentials(WiFiCredentialList& list);
+bool saveWiFiCredentials(const WiFiCredentialList& list);
+bool loadForecastCache(ForecastCache* caches, uint8_t maxCount);
+bool saveForecastCache(const ForecastCache* caches, uint8_t count);
 
 #endif
@@ -0,0 +1,113 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DNS_CACHE_H
+#define DNS_CACHE_H
+
+// Host name to IPv4 address cache with positive, negative and stale entries.
+// Deliberately free of Arduino/ESP dependencies so it can be built on the host;
+// the resolver glue (DnsResolver) does the lookups and the locking.
+
+#include <stdint.h>
+#include "Metrics.h"
+
+#define DNS_CACHE_SIZE      6   // Names cached at once (least recently used is replaced)
+#define DNS_CACHE_NAME_LEN  48  // Longest name cached (longer names are not cached)
+
+class DnsCache {
+public:
+  enum class Result : uint8_t {
+    Hit,          // Fresh address
+    NegativeHit,  // Lookup failed recently, don't retry yet
+    Miss          // Unknown or expired, look it up
+  };
+
+  struct Timing {
+    uint32_t ttlMs;          // How long an address is served without a new lookup
+    uint32_t negativeTtlMs;  // How long a failed lookup is remembered
+    uint32_t staleMs;        // How long after expiry an address may stand in for a failed lookup
+  };
+
+  struct Stats {
+    uint32_t hits;
+    uint32_t negativeHits;
+    uint32_t misses;
+    uint32_t staleHits;   // Failed lookups answered with an expired address
+    uint32_t failures;    // Lookups that failed
+    uint32_t prefetches;  // Lookups started ahead of expiry
+  };
+
+  struct Entry {
+    char name[DNS_CACHE_NAME_LEN];
+    uint32_t address;      // Last known IPv4 in network order as stored by lwIP (0 = none)
+    uint32_t resolvedMs;   // When address was resolved
+    uint32_t storedMs;     // When the last result (address or failure) was stored
+    uint32_t lastUsedMs;
+    bool negative;         // Last lookup failed
+  };
+
+  explicit DnsCache(const Timing& timing);
+
+  // Look up name, counts hits and misses
+  Result lookup(const char* name, uint32_t nowMs, uint32_t& address);
+
+  /**
+   * Expired address still within the stale window, for a failed lookup
+   * @return true if address was set (counted as stale hit)
+   */
+  bool lookupStale(const char* name, uint32_t nowMs, uint32_t& address);
+
+  // Fresh or stale address without counting, for periodic checks
+  bool peek(const char* name, uint32_t nowMs, uint32_t& address) const;
+
+  // Store a lookup result, lookupMs goes into the latency histogram
+  void store(const char* name, uint32_t address, uint32_t nowMs, uint32_t lookupMs);
+  void storeFailure(const char* name, uint32_t nowMs, uint32_t lookupMs);
+
+  /**
+   * Whether name should be looked up ahead of use: unknown, or its address
+   * expires within aheadMs. Negative entries wait for their TTL.
+   */
+  bool needsRefresh(const char* name, uint32_t nowMs, uint32_t aheadMs) const;
+
+  void countPrefetch() { stats.prefetches++; }
+
+  // Time until the entry expires (0 = expired)
+  uint32_t remainingMs(const Entry& entry, uint32_t nowMs) const;
+
+  Stats getStats() const { return stats; }
+  const LatencyHistogram& getLatencyHistogram() const { return latency; }
+
+  uint8_t getEntryCount() const { return entryCount; }
+  const Entry& getEntry(uint8_t index) const { return entries[index]; }
+
+private:
+  Entry* find(const char* name);
+  const Entry* find(const char* name) const;
+  Entry* findOrAdd(const char* name, uint32_t nowMs);
+
+  Timing timing;
+  Entry entries[DNS_CACHE_SIZE];
+  uint8_t entryCount;
+  Stats stats;
+  LatencyHistogram latency;
+};
+
+#endif // DNS_CACHE_H
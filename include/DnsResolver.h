@@ -0,0 +1,47 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DNS_RESOLVER_H
+#define DNS_RESOLVER_H
+
+#include <Arduino.h>
+#include "DnsCache.h"
+
+// Host name lookups through the shared DnsCache (HTTPS requests and NTP).
+// Safe to call from the loop task and the async web server task.
+
+/**
+ * Resolve host, blocking on a cache miss. A failed lookup is answered with
+ * the last known address while it is within DNS_STALE_MAX_S.
+ * @param lookupMs Time spent resolving (0 when answered from the cache)
+ * @return true if address was set
+ */
+bool dnsResolve(const char* host, IPAddress& address, uint32_t* lookupMs = nullptr);
+
+// Fresh or stale cached address, never touches the network
+bool dnsCachedAddress(const char* host, IPAddress& address);
+
+// Start a background lookup if host is unknown or expires within DNS_PREFETCH_AHEAD_S
+void dnsPrefetch(const char* host);
+
+// Copy of the cache for statistics
+DnsCache getDnsCache();
+
+#endif // DNS_RESOLVER_H
@@ -0,0 +1,52 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FLASH_STREAM_H
+#define FLASH_STREAM_H
+
+// Reads a constant body (a PROGMEM asset) in chunks of the caller's size,
+// straight from flash into the caller's buffer. Holds no copy of the body
+// and allocates nothing. Free of Arduino dependencies so it can be built on
+// the host.
+
+#include <stddef.h>
+#include <stdint.h>
+
+class FlashStream {
+public:
+  FlashStream(const uint8_t* content, size_t length);
+
+  /**
+   * Copy the next chunk of the body
+   * @param buffer Receives up to maxLength bytes
+   * @return Bytes copied, 0 at the end of the body
+   */
+  size_t read(uint8_t* buffer, size_t maxLength);
+
+  size_t length() const { return contentLength; }
+  size_t remaining() const { return contentLength - offset; }
+
+private:
+  const uint8_t* content;
+  size_t contentLength;
+  size_t offset;
+};
+
+#endif // FLASH_STREAM_H
@@ -0,0 +1,73 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FORECAST_CACHE_H
+#define FORECAST_CACHE_H
+
+// Hourly temperature forecast kept as a ring of (epoch, temperature) points.
+// The current temperature is interpolated locally, so the clock keeps showing
+// it through network outages and only needs to refetch every few hours.
+// Deliberately free of Arduino/ESP dependencies so it can be built on the host.
+
+#include <stdint.h>
+
+#ifndef FORECAST_MAX_POINTS
+#define FORECAST_MAX_POINTS 48
+#endif
+
+struct ForecastPoint {
+  uint32_t epoch;      // Start of the hour (Unix UTC)
+  int16_t tempDeci;    // Temperature in 0.1 degrees
+};
+
+// Plain struct so it can be persisted as is
+struct ForecastCache {
+  uint32_t fetchedEpoch;   // When the forecast was fetched (0 = empty)
+  float latitude;          // Location the forecast is for
+  float longitude;
+  uint8_t fahrenheit;      // Unit of the temperatures (0 = Celsius)
+  uint8_t head;            // Index of the oldest point
+  uint8_t count;
+  ForecastPoint points[FORECAST_MAX_POINTS];
+};
+
+/**
+ * Drop all points and start a new forecast
+ */
+void resetForecast(ForecastCache& cache, uint32_t fetchedEpoch, float latitude, float longitude, bool fahrenheit);
+
+/**
+ * Append a point, overwriting the oldest one when full
+ * @return false if the point is not newer than the last one
+ */
+bool addForecastPoint(ForecastCache& cache, uint32_t epoch, float temperature);
+
+/**
+ * True if the forecast is for this location and covers the given time
+ */
+bool forecastCovers(const ForecastCache& cache, uint32_t epoch, float latitude, float longitude);
+
+/**
+ * Temperature at a time, linear between the hourly points
+ * @return false if the time is outside the cached range
+ */
+bool forecastTemperatureAt(const ForecastCache& cache, uint32_t epoch, float& temperature);
+
+#endif // FORECAST_CACHE_H
@@ -0,0 +1,69 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GEOLOCATION_H
+#define GEOLOCATION_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// IP based location lookup (ipapi.co) for the web UI. The web server only
+// starts a job; the HTTPS request runs on a small worker task, created with
+// the first job and woken by a task notification for each new one, so
+// neither the async web server task nor the display loop blocks on the
+// network. Results are cached by public IP.
+
+enum class GeolocationJobState : uint8_t {
+  None,     // Unknown job id
+  Pending,  // Waiting for the worker task to pick it up
+  Running,  // Request in progress
+  Done      // Result in httpStatus and body
+};
+
+struct GeolocationJob {
+  uint32_t id;
+  GeolocationJobState state;
+  int httpStatus;                      // Done: 200, 500 or 503
+  uint32_t retryAfterS;                // 503 while ipapi.co is backing off (0 = none)
+  char body[GEOLOCATION_BODY_SIZE];    // Done: JSON response
+};
+
+struct GeolocationStats {
+  uint32_t requests;   // Lookups requested through the API
+  uint32_t cacheHits;  // Answered from the cache without a job
+  uint32_t jobs;       // Jobs started (requests during a running job join it)
+  uint32_t failures;   // Jobs that ended without a location
+};
+
+/**
+ * Answer from the cache or start (or join) a lookup job
+ * @param job Receives the cached result (state Done) or the job to poll
+ */
+void requestGeolocation(GeolocationJob& job);
+
+/**
+ * Current state of a job
+ * @return false if id is unknown or its result expired (job.state None)
+ */
+bool getGeolocationJob(uint32_t id, GeolocationJob& job);
+
+GeolocationStats getGeolocationStats();
+
+#endif // GEOLOCATION_H
@@ -0,0 +1,117 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HOST_BACKOFF_H
+#define HOST_BACKOFF_H
+
+// Per-host request gate: exponential backoff with jitter after failures and a
+// circuit breaker that stops attempts during sustained outages.
+// Deliberately free of Arduino/ESP dependencies so it can be built on the host;
+// the caller supplies the clock and the random numbers used for jitter.
+
+#include <stdint.h>
+
+#define HOST_BACKOFF_SLOTS     4   // Hosts tracked at once (least recently used is replaced)
+#define HOST_BACKOFF_NAME_LEN  48  // Longest host name tracked (longer names are truncated)
+
+class HostBackoff {
+public:
+  enum class State : uint8_t {
+    Closed,    // Healthy, requests pass
+    Backoff,   // Last request failed, next one allowed after a jittered delay
+    Open,      // Too many consecutive failures, requests are rejected
+    HalfOpen   // Open period over, a single probe request is in flight
+  };
+
+  enum class Decision : uint8_t {
+    Allow,     // Send the request, report the result afterwards
+    Deferred,  // Host is backing off
+    Rejected   // Circuit is open
+  };
+
+  struct Policy {
+    uint32_t initialBackoffMs;  // Delay after the first failure, doubled after each further one
+    uint32_t maxBackoffMs;      // Upper bound for the delay
+    uint8_t openAfterFailures;  // Consecutive failures that open the circuit
+    uint32_t openMs;            // How long the circuit stays open before a probe
+  };
+
+  // Counters per state, summed over all hosts
+  struct Stats {
+    uint32_t allowed;   // Requests let through while closed or after a backoff
+    uint32_t deferred;  // Requests refused while backing off
+    uint32_t rejected;  // Requests refused while open
+    uint32_t probes;    // Half-open probe requests
+    uint32_t successes;
+    uint32_t failures;
+    uint32_t opens;     // Transitions to open
+  };
+
+  struct Host {
+    char name[HOST_BACKOFF_NAME_LEN];
+    State state;
+    uint8_t failures;      // Consecutive failures
+    uint32_t untilMs;      // End of the backoff or open period
+    uint32_t lastUsedMs;
+  };
+
+  explicit HostBackoff(const Policy& policy);
+
+  /**
+   * Ask whether a request to host may be sent now
+   * @return Allow, or why the request must not be sent
+   */
+  Decision acquire(const char* host, uint32_t nowMs);
+
+  // Report the outcome of an allowed request
+  void recordSuccess(const char* host, uint32_t nowMs);
+
+  /**
+   * Report a failed request (connection, TLS, timeout, 5xx, 429)
+   * @param random Any 32 bit random value, spreads the delay over [delay/2, delay]
+   */
+  void recordFailure(const char* host, uint32_t nowMs, uint32_t random);
+
+  // Current state of host (Closed if unknown)
+  State getState(const char* host) const;
+
+  // Time until host accepts requests again (0 = now)
+  uint32_t retryInMs(const char* host, uint32_t nowMs) const;
+
+  static const char* getStateName(State state);
+
+  Stats getStats() const { return stats; }
+
+  uint8_t getHostCount() const { return hostCount; }
+  const Host& getHost(uint8_t index) const { return hosts[index]; }
+
+private:
+  Host* find(const char* host);
+  const Host* find(const char* host) const;
+  Host* findOrAdd(const char* host, uint32_t nowMs);
+  uint32_t jitter(uint32_t delayMs, uint32_t random) const;
+
+  Policy policy;
+  Host hosts[HOST_BACKOFF_SLOTS];
+  uint8_t hostCount;
+  Stats stats;
+};
+
+#endif // HOST_BACKOFF_H
@@ -0,0 +1,135 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdint.h>
+
+// Header-only and free of Arduino dependencies so it can be built on the host
+
+/**
+ * Fixed-size ring of latency samples with percentile lookup
+ * Keeps the last N samples, no heap allocation
+ */
+template <uint8_t N>
+class LatencySamples {
+public:
+  LatencySamples() : next(0), count(0), total(0) {}
+
+  void add(uint32_t value) {
+    samples[next] = value;
+    next = (next + 1) % N;
+    if (count < N) {
+      count++;
+    }
+    total++;
+  }
+
+  // Number of samples currently held
+  uint8_t size() const { return count; }
+
+  // Number of samples ever added
+  uint32_t totalCount() const { return total; }
+
+  /**
+   * Percentile over the held samples (nearest rank)
+   * @param pct Percentile 0-100
+   * @return Sample value, 0 if no samples
+   */
+  uint32_t percentile(uint8_t pct) const {
+    if (count == 0) {
+      return 0;
+    }
+    uint32_t sorted[N];
+    for (uint8_t i = 0; i < count; i++) {
+      uint32_t value = samples[i];
+      int16_t j = i - 1;
+      while (j >= 0 && sorted[j] > value) {
+        sorted[j + 1] = sorted[j];
+        j--;
+      }
+      sorted[j + 1] = value;
+    }
+    uint8_t index = (uint8_t)(((uint16_t)pct * (count - 1) + 50) / 100);
+    return sorted[index];
+  }
+
+private:
+  uint32_t samples[N];
+  uint8_t next;
+  uint8_t count;
+  uint32_t total;
+};
+
+// Bucket upper bounds in ms, the last bucket is open ended (0)
+inline constexpr uint32_t DURATION_BOUNDS_MS[] = {1000, 2000, 5000, 10000, 30000, 60000, 120000, 600000, 0};
+inline constexpr uint32_t LATENCY_BOUNDS_MS[] = {10, 25, 50, 100, 250, 500, 1000, 5000, 0};
+
+/**
+ * Counts values in fixed buckets given by their upper bounds
+ * @tparam N Number of buckets
+ * @tparam BoundsMs Upper bound of each bucket in ms, the last one 0 (open ended)
+ */
+template <uint8_t N, const uint32_t (&BoundsMs)[N]>
+class BucketHistogram {
+public:
+  static const uint8_t BUCKETS = N;
+
+  BucketHistogram() : total(0), maxMs(0) {
+    for (uint8_t i = 0; i < BUCKETS; i++) {
+      counts[i] = 0;
+    }
+  }
+
+  // Upper bound of a bucket in ms (0 = open ended)
+  static uint32_t upperBoundMs(uint8_t bucket) {
+    return bucket < BUCKETS ? BoundsMs[bucket] : 0;
+  }
+
+  void add(uint32_t ms) {
+    uint8_t bucket = 0;
+    while (bucket < BUCKETS - 1 && ms > upperBoundMs(bucket)) {
+      bucket++;
+    }
+    counts[bucket]++;
+    total++;
+    if (ms > maxMs) {
+      maxMs = ms;
+    }
+  }
+
+  uint32_t count(uint8_t bucket) const { return bucket < BUCKETS ? counts[bucket] : 0; }
+  uint32_t totalCount() const { return total; }
+  uint32_t maxValue() const { return maxMs; }
+
+private:
+  uint32_t counts[BUCKETS];
+  uint32_t total;
+  uint32_t maxMs;
+};
+
+// Durations from 1 s to 10 min
+typedef BucketHistogram<9, DURATION_BOUNDS_MS> DurationHistogram;
+
+// Short latencies from 10 ms to 5 s
+typedef BucketHistogram<9, LATENCY_BOUNDS_MS> LatencyHistogram;
+
+#endif // METRICS_H
@@ -22,28 +22,145 @@
 #define SECURE_HTTP_CLIENT_H
 
 #include <Arduino.h>
+#include "HostBackoff.h"
 
 /**
  * Utility class for making secure HTTPS requests
- * Centralizes TLS configuration and error handling
+ * Centralizes TLS configuration and error handling. Servers are validated
+ * against per-host trust anchors (TrustStore) where the host has any. Failed requests put their
+ * host into a jittered exponential backoff, sustained failures open a circuit
+ * breaker; requests refused by either return at once without network traffic.
+ * Connections are kept alive per host (HTTP_POOL_SIZE hosts) so requests made
+ * within HTTP_POOL_IDLE_MS of each other skip the TLS handshake. Identical
+ * requests (same URL) made while one is in flight, or within
+ * HTTP_COALESCE_TTL_MS after it, share its result.
  */
 class SecureHTTPClient {
 public:
+  /**
+   * Limits of one request. Each phase has its own timeout, the total bounds
+   * them all (later phases only get what is left of it).
+   */
+  struct Options {
+    uint32_t connectTimeoutMs;    // DNS lookup and TCP connect
+    uint32_t tlsTimeoutMs;        // TLS handshake (rounded up to seconds)
+    uint32_t firstByteTimeoutMs;  // Request sent until the response headers arrived
+    uint32_t totalTimeoutMs;      // Whole request including the body
+    size_t maxBodySize;           // Larger bodies are refused (Content-Length) or cut off
+    bool followRedirects;
+
+    // HTTP_*_TIMEOUT_MS and HTTP_MAX_BODY_SIZE from config.h, no redirects
+    Options();
+  };
+
+  // Phase durations of the last attempt in milliseconds
+  struct Timings {
+    uint32_t dnsMs;        // Host name lookup (0 from the DNS cache or on a kept-alive connection)
+    uint32_t connectMs;    // TCP connect plus TLS handshake (one call in WiFiClientSecure)
+    uint32_t firstByteMs;  // Request sent until headers parsed
+    uint32_t bodyMs;       // Body delivered to the sink/handler
+    uint32_t totalMs;
+    bool reused;           // Sent on a kept-alive connection
+  };
+
   struct Response {
     bool success;
     int httpCode;
-    String payload;
     String error;
+    bool deferred;       // Not sent: host is backing off or its circuit is open
+    uint32_t retryInMs;  // Failed or deferred: time until the host accepts requests again
+    size_t bodyLength;   // Body bytes delivered
+    bool shared;         // Result of an identical request made at the same time (coalesced)
+    Timings timings;
   };
 
   /**
-   * Perform a GET request to the specified URL
-   * @param url The HTTPS URL to request
-   * @param timeout Request timeout in milliseconds (default: 5000ms)
-   * @param followRedirects Whether to follow HTTP redirects (default: false)
-   * @return Response structure with success status, HTTP code, payload, and error message
+   * Receives the response body chunk by chunk (at most HTTP_CHUNK_SIZE bytes)
+   * @return false to abort the request
+   */
+  typedef bool (*ChunkSink)(const uint8_t* data, size_t length, void* context);
+
+  /**
+   * Consumes the response body straight from the connection
+   * @param body Body stream (HTTP/1.0, never chunked), ends at maxBodySize and the total timeout
+   * @param context Caller data passed through getStream()
+   * @return false if the body could not be processed
+   */
+  typedef bool (*BodyHandler)(Stream& body, void* context);
+
+  /**
+   * GET into a caller-provided buffer
+   * @param buffer Receives the body, NUL terminated
+   * @param bufferSize Size of buffer; a longer body fails the request
+   * @return Response, success on HTTP 200 with the whole body in buffer
+   */
+  static Response get(const char* url, char* buffer, size_t bufferSize, const Options& options = Options());
+
+  /**
+   * GET and hand the body to a sink in chunks, nothing is buffered beyond one chunk
+   * @return Response, success only if all chunks were accepted
+   */
+  static Response getChunked(const char* url, ChunkSink onChunk, void* context, const Options& options = Options());
+
+  /**
+   * GET and hand the body stream to a handler (e.g. a streaming JSON parser)
+   * @return Response, success only if onBody succeeded
    */
-  static Response get(const char* url, unsigned long timeout = 5000, bool followRedirects = false);
+  static Response getStream(const char* url, BodyHandler onBody, void* context, const Options& options = Options());
+
+  // Timings of the last request that reached a server (for statistics)
+  static Timings getLastTimings();
+
+  /**
+   * Backoff/circuit state of the host a URL points to
+   * @param url Any URL on the host
+   */
+  static HostBackoff::State getHostState(const char* url);
+
+  // Copy of the per-host table and counters (for statistics)
+  static HostBackoff getHostBackoff();
+
+  struct PoolStats {
+    uint32_t requests;         // Requests sent
+    uint32_t reuses;           // Sent on a kept-alive connection (no handshake)
+    uint32_t handshakes;       // New TLS connections
+    uint32_t staleRetries;     // Kept-alive connection was closed by the server, resent on a new one
+    uint32_t closedIdle;       // Closed after HTTP_POOL_IDLE_MS without use
+    uint32_t closedLowHeap;    // Closed because free heap fell below HTTP_POOL_MIN_FREE_HEAP
+    uint32_t lastHandshakeMs;  // TCP connect plus TLS handshake of the last new connection
+    uint32_t handshakeP50Ms;
+    uint32_t handshakeP90Ms;
+    uint8_t open;              // Connections currently kept alive
+  };
+
+  static PoolStats getPoolStats();
+
+  struct CoalesceStats {
+    uint32_t leaders;     // Requests sent on behalf of their URL
+    uint32_t waited;      // Requests that waited for an identical one in flight
+    uint32_t shared;      // Requests answered with another request's result
+    uint32_t uncaptured;  // Results not shared (body over HTTP_COALESCE_MAX_BODY)
+  };
+
+  static CoalesceStats getCoalesceStats();
+
+  // New TLS connections by validation, durations are TCP connect plus handshake
+  struct TrustStats {
+    uint32_t verified;         // Chain validated against the host's trust anchors
+    uint32_t unverified;       // Host has no anchors (or HTTP_TLS_VERIFY is off)
+    uint32_t rejected;         // Server certificate failed validation against the host's anchors
+    uint32_t failures;         // Other failed connections to hosts with anchors (network, TLS)
+    uint32_t verifiedP50Ms;
+    uint32_t verifiedP90Ms;
+    uint32_t unverifiedP50Ms;
+    uint32_t unverifiedP90Ms;
+  };
+
+  static TrustStats getTrustStats();
+
+  // Close idle kept-alive connections (idle timeout, low heap) and release
+  // expired shared results. Call regularly.
+  static void maintain();
 };
 
 #endif // SECURE_HTTP_CLIENT_H
@@ -0,0 +1,58 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SOLAR_CALCULATOR_H
+#define SOLAR_CALCULATOR_H
+
+// Sunrise, sunset and civil twilight from latitude/longitude (sunrise equation
+// with equation of center, perihelion precession and the declination at each
+// event, within a minute of the NOAA calculator).
+// Deliberately free of Arduino/ESP dependencies so it can be built on the host.
+
+#include <stdint.h>
+
+enum class SolarEvent : uint8_t {
+  Normal,       // Crosses the altitude: rise and set times are valid
+  AlwaysAbove,  // Stays above the altitude all day (midnight sun / white night)
+  AlwaysBelow   // Stays below the altitude all day (polar night)
+};
+
+struct SolarTimes {
+  int64_t noon;         // Solar transit (Unix time, UTC)
+  SolarEvent sun;       // Sun at -0.833 degrees (refraction and disk)
+  int64_t sunrise;      // Valid if sun == Normal
+  int64_t sunset;
+  SolarEvent civil;     // Sun at -6 degrees
+  int64_t dawn;         // Civil dawn, valid if civil == Normal
+  int64_t dusk;         // Civil dusk
+};
+
+/**
+ * Solar events of a calendar date
+ * @param year Full year (e.g. 2025)
+ * @param month Month 1-12
+ * @param day Day of month 1-31
+ * @param latitude Decimal degrees, north positive
+ * @param longitude Decimal degrees, east positive
+ * @param times Receives the events (Unix time, UTC)
+ */
+void computeSolarTimes(int year, int month, int day, double latitude, double longitude, SolarTimes& times);
+
+#endif // SOLAR_CALCULATOR_H
@@ -0,0 +1,61 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TIMEZONE_GRID_H
+#define TIMEZONE_GRID_H
+
+// Time zone for a coordinate, from the run length encoded raster generated by
+// scripts/gen_tz_grid.py. Reads the raster in place (flash). Free of Arduino
+// dependencies so it can be built on the host.
+
+#include <stdint.h>
+
+class TimezoneGrid {
+public:
+  explicit TimezoneGrid(const uint8_t* table);
+
+  // Table has the expected format
+  bool isValid() const { return rows > 0; }
+
+  /**
+   * tz database name of the zone at a coordinate, e.g. "Europe/Zurich"
+   * @return nullptr for coordinates out of range or an invalid table
+   */
+  const char* lookup(float latitude, float longitude) const;
+
+  // Degrees per cell, the resolution of zone borders
+  float cellSizeDegrees() const { return cellsPerDegree > 0 ? 1.0f / cellsPerDegree : 0.0f; }
+
+private:
+  const uint8_t* table;
+  uint16_t columns;
+  uint16_t rows;
+  uint16_t zoneCount;
+  uint8_t cellsPerDegree;
+  const uint8_t* rowStarts;
+  const uint8_t* runs;
+  const uint8_t* zones;
+  const char* pool;
+};
+
+// Grid over the built-in raster
+const TimezoneGrid& getTimezoneGrid();
+
+#endif // TIMEZONE_GRID_H
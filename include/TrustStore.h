@@ -0,0 +1,40 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRUST_STORE_H
+#define TRUST_STORE_H
+
+// Trust anchors per HTTPS host. Anchors are pre-parsed certificate bundles
+// (DER subject names and public keys) generated into trust_anchors.h by
+// scripts/gen_trust_anchors.py, so validation never parses PEM at run time.
+// Free of Arduino dependencies so it can be built on the host.
+
+#include <stdint.h>
+
+/**
+ * Certificate bundle to validate host against
+ * @return Bundle in esp_crt_bundle format, nullptr if host has no anchors
+ */
+const uint8_t* findTrustBundle(const char* host);
+
+// Number of anchors in a bundle
+uint16_t getTrustBundleSize(const uint8_t* bundle);
+
+#endif // TRUST_STORE_H
@@ -0,0 +1,37 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef WARM_RESTART_H
+#define WARM_RESTART_H
+
+#include <ESP32Time.h>
+
+// Restore state from RTC slow memory after a soft reset (OTA, /api/restart, panic).
+// Renders the last frame and an estimated time right away.
+// Returns true on a warm boot with a valid saved state.
+bool restoreWarmState(ESP32Time& rtc);
+
+// Snapshot current time, brightness, weather and LED frame into RTC slow memory
+void saveWarmState();
+
+// True if this boot was restored from a warm state
+bool isWarmBoot();
+
+#endif // WARM_RESTART_H
@@ -0,0 +1,65 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef WARM_STATE_H
+#define WARM_STATE_H
+
+// Serializer for the state kept across warm restarts.
+// Deliberately free of Arduino/ESP dependencies so it can be built on the host.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define WARM_STATE_MAGIC        0x534D574CUL  // "LWMS"
+#define WARM_STATE_VERSION      1
+#define WARM_STATE_FRAME_BYTES  174           // NUM_LEDS * 3 (RGB)
+
+// Serialized layout: magic(4) version(1) payload(...) crc32(4), little endian
+#define WARM_STATE_PAYLOAD_BYTES (8 + 8 + 1 + 1 + 1 + 4 + WARM_STATE_FRAME_BYTES)
+#define WARM_STATE_MAX_BYTES     (4 + 1 + WARM_STATE_PAYLOAD_BYTES + 4)
+
+struct WarmStateData {
+  int64_t epochUs;              // Wall clock at save time (microseconds since epoch)
+  uint64_t monotonicUs;         // RTC slow clock at save time (keeps counting across soft resets)
+  uint8_t mainBrightness;       // Brightness of digits at save time
+  uint8_t colonBrightness;      // Brightness of second indicator at save time
+  int8_t temperature;           // Last temperature (or WeatherStatus code)
+  uint32_t temperatureEpoch;    // When the temperature was fetched (0 = never)
+  uint8_t frame[WARM_STATE_FRAME_BYTES];  // Last rendered LED frame
+};
+
+/**
+ * CRC-32 (IEEE 802.3, reflected) over a buffer
+ */
+uint32_t warmStateCrc32(const uint8_t* data, size_t length);
+
+/**
+ * Serialize state into buffer
+ * @return Number of bytes written, 0 if buffer is too small
+ */
+size_t serializeWarmState(const WarmStateData& state, uint8_t* buffer, size_t bufferSize);
+
+/**
+ * Deserialize state from buffer, validating magic, version and CRC
+ * @return true if buffer held a valid state
+ */
+bool deserializeWarmState(const uint8_t* buffer, size_t bufferSize, WarmStateData& state);
+
+#endif // WARM_STATE_H
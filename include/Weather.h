@@ -23,6 +23,7 @@
 
 #include <Arduino.h>
 #include "config.h"
+#include "WeatherLocations.h"
 
 /**
  * Weather status codes
@@ -36,8 +37,23 @@ enum class WeatherStatus : int8_t {
   WiFiDisconnected = -125 // WiFi not connected (Er05)
 };
 
+struct WeatherFetchStats {
+  uint32_t fetches;       // Requests made
+  uint32_t failures;      // Requests or parses that failed
+  uint32_t deferred;      // Requests not sent (API host backing off or its circuit open)
+  uint32_t heapBefore;    // Free heap before the last request
+  uint32_t heapAtBody;    // Free heap when the last body started streaming (TLS up), 0 if none
+  uint32_t heapAfter;     // Free heap after the last request (connection closed)
+  uint32_t minFreeHeap;   // Heap low watermark since boot
+  uint32_t durationMs;    // Duration of the last request
+  uint32_t cacheHits;     // Scheduled updates served from the cached forecast
+  uint8_t forecastPoints; // Hourly points in the cache
+  uint32_t forecastEpoch; // When the cached forecast was fetched (0 = none)
+};
+
 // External variable for temperature
 extern int8_t owmTemperature;
+extern uint32_t owmTemperatureEpoch;  // When owmTemperature was fetched (0 = never)
 
 // Helper functions for weather status
 inline bool isWeatherError(int8_t temp) {
@@ -59,4 +75,24 @@ inline const char* getWeatherErrorCode(int8_t temp) {
 // Function declarations
 void fetchWeather();
 
+/**
+ * Run fetchWeather() after a delay, replacing any pending run
+ * @param delayMs Delay in milliseconds (0 = next serviceWeatherFetch())
+ */
+void scheduleWeatherFetch(uint32_t delayMs);
+
+// Run a scheduled fetch once it is due (call regularly)
+void serviceWeatherFetch();
+
+// Scheduled fetches that have run (fetched, served from the cache, failed or skipped)
+uint32_t getWeatherFetchRuns();
+
+void restoreWeatherState(int8_t temperature, uint32_t fetchedEpoch);
+
+// Locations shown in rotation (primary first), their temperatures and labels
+uint8_t getWeatherLocationCount();
+int8_t getWeatherTemperature(uint8_t index);
+char getWeatherLocationLabel(uint8_t index);
+WeatherFetchStats getWeatherFetchStats();
+
 #endif // WEATHER_H
@@ -0,0 +1,51 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef WEATHER_LOCATIONS_H
+#define WEATHER_LOCATIONS_H
+
+// Extra weather locations ("label=lat,lon; ..."), shared by the runtime and
+// POST /api/config. Deliberately free of Arduino/ESP dependencies so it can
+// be built on the host.
+
+#include <stdint.h>
+
+#ifndef WEATHER_LOCATIONS_MAX_LEN
+#define WEATHER_LOCATIONS_MAX_LEN 128  // Maximum length of the weatherLocations text
+#endif
+
+// Characters the display can show as a location label. I, i, l, O and S are
+// left out: next to a temperature they read as 1, 0 and 5.
+#define WEATHER_LABEL_GLYPHS "AaBbCcDdEeFfHhLNnoPpRrUu"
+
+struct WeatherLocation {
+  char label;        // Label glyph shown with the temperature ('\0' = primary location, no label)
+  float latitude;
+  float longitude;
+};
+
+/**
+ * Parse extra locations ("label=lat,lon; ..."), label must be one of WEATHER_LABEL_GLYPHS
+ * @return false on a syntax error, an unknown label, out of range coordinates, too many
+ *         entries or text longer than WEATHER_LOCATIONS_MAX_LEN
+ */
+bool parseWeatherLocations(const char* text, WeatherLocation* out, uint8_t maxCount, uint8_t& count);
+
+#endif // WEATHER_LOCATIONS_H
@@ -0,0 +1,102 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef WIFI_NETWORKS_H
+#define WIFI_NETWORKS_H
+
+#include <Arduino.h>
+#include "ConfigStorage.h"
+
+/**
+ * Known WiFi networks, scan-result cache and per-AP statistics.
+ * Candidates from the last scan are ranked by RSSI, minus a penalty
+ * for APs that failed recent connection attempts.
+ *
+ * The known networks and the scan cache belong to the loop. The web server
+ * only requests changes, the loop applies them (applyWiFiNetworkChanges()),
+ * so credentials and scan cache indexes never shift under a connect.
+ */
+
+// AP from the scan cache matching a known network
+struct WiFiCandidate {
+  uint8_t credential;   // Index into the known networks
+  uint8_t bssid[6];
+  uint8_t channel;
+  int8_t rssi;
+  int16_t score;        // RSSI minus reliability penalty (dB)
+};
+
+// Connection history of one AP
+struct WiFiApStats {
+  uint8_t bssid[6];
+  uint8_t channel;
+  uint16_t attempts;
+  uint16_t successes;
+  uint32_t avgConnectMs;  // Moving average over successful connects
+  uint32_t lastUsed;      // millis() of the last attempt (eviction order)
+};
+
+// Load known networks and make sure the portal network is entry 0
+void initWiFiNetworks(const String& ssid, const String& pass);
+
+// Known networks (loop only)
+uint8_t getWiFiNetworkCount();
+const WiFiCredential* getWiFiNetwork(uint8_t index);
+int8_t findWiFiNetwork(const char* ssid);
+
+/**
+ * SSIDs of the known networks including requested changes (any task)
+ * @return Number of SSIDs copied
+ */
+uint8_t getRequestedWiFiNetworks(char ssids[][WIFI_SSID_MAX_LEN], uint8_t maxCount);
+
+// Request adding or updating a network (any task), false if the list is full
+bool requestAddWiFiNetwork(const char* ssid, const char* pass);
+
+// Request removing a network (any task), false if unknown or the portal network
+bool requestRemoveWiFiNetwork(const char* ssid);
+
+// Apply and persist requested changes (call from loop)
+void applyWiFiNetworkChanges();
+
+// Start an asynchronous scan, false if one could not be started
+bool startWiFiScan();
+
+// Collect scan results, true once when a started scan finished
+bool pollWiFiScan();
+
+// True if the scan cache is recent enough to pick an AP from
+bool isWiFiScanFresh();
+
+/**
+ * Best known AP from the scan cache
+ * @param candidate Receives the selected AP
+ * @param excludeBssid AP to skip (e.g. the current one when roaming), may be nullptr
+ * @return true if a candidate was found
+ */
+bool selectWiFiCandidate(WiFiCandidate& candidate, const uint8_t* excludeBssid = nullptr);
+
+// Record the outcome of a connection attempt to an AP
+void recordWiFiApResult(const uint8_t* bssid, uint8_t channel, bool success, uint32_t connectMs);
+
+// Copy tracked AP statistics, returns number of entries
+uint8_t getWiFiApStats(WiFiApStats* stats, uint8_t maxStats);
+
+#endif // WIFI_NETWORKS_H
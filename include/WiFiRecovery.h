@@ -0,0 +1,121 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef WIFI_RECOVERY_H
+#define WIFI_RECOVERY_H
+
+// WiFi recovery state machine, driven by WiFi events and timers only.
+// Deliberately free of Arduino/ESP dependencies so it can be built on the host;
+// the caller feeds events from the loop and executes the returned actions.
+
+#include <stdint.h>
+#include "Metrics.h"
+
+class WiFiRecovery {
+public:
+  enum class State : uint8_t {
+    Idle,          // Initial connection not done yet (handled by the boot path)
+    Connected,     // Got an IP
+    Reconnecting,  // Reconnect issued, waiting for the result
+    Backoff,       // Last attempt failed, waiting before the next one
+    FullRestart,   // WiFi restarted (scan), waiting for the result
+    Switching      // Planned switch to another AP, waiting for the result
+  };
+
+  enum class Event : uint8_t {
+    Connected,     // Station got an IP
+    Disconnected   // Station disconnected or lost its IP
+  };
+
+  enum class Action : uint8_t {
+    None,
+    Lost,          // Connection just lost: notify and reconnect
+    Reconnect,     // Retry the current AP
+    FullRestart,   // Restart WiFi and scan for an AP
+    Recovered,     // Connection restored
+    Switched       // Planned switch to another AP finished
+  };
+
+  struct Timing {
+    uint32_t reconnectTimeoutMs;    // Attempt without result counts as failed
+    uint32_t initialBackoffMs;      // First wait between attempts, doubled after each
+    uint32_t maxBackoffMs;          // Upper bound for the wait
+    uint8_t maxAttempts;            // Reconnect attempts before a full restart
+    uint32_t fullRestartAfterMs;    // Outage (or time since last full restart) before a full restart
+    uint32_t fullRestartTimeoutMs;  // Full restart without result counts as failed
+  };
+
+  struct Stats {
+    uint32_t disconnects;        // Connection losses
+    uint32_t reconnectAttempts;  // Reconnects issued
+    uint32_t fullRestarts;       // Full restarts issued
+    uint32_t recoveries;         // Outages that ended with a connection
+    uint32_t lastOutageMs;       // Duration of the last outage
+    uint32_t switches;           // Planned AP switches that connected in time
+  };
+
+  explicit WiFiRecovery(const Timing& timing);
+
+  // Initial connection established, start monitoring
+  void start(uint32_t nowMs);
+
+  // Planned switch to another AP (roaming) is about to disconnect. Its events
+  // stay out of the outage metrics unless it fails to connect within
+  // reconnectTimeoutMs, which is then handled as an outage from nowMs.
+  // @return false if not connected (nothing to switch away from)
+  bool beginSwitch(uint32_t nowMs);
+
+  Action handleEvent(Event event, uint32_t nowMs);
+
+  // Advance timers (call regularly)
+  Action tick(uint32_t nowMs);
+
+  State getState() const { return state; }
+  static const char* getStateName(State state);
+
+  // Attempts in the current reconnect phase
+  uint8_t getAttempt() const { return attempts; }
+
+  Stats getStats() const { return stats; }
+
+  // Disconnect until connected again
+  const DurationHistogram& getOutageHistogram() const { return outageHistogram; }
+
+  // Start of the successful attempt until connected
+  const DurationHistogram& getRecoverHistogram() const { return recoverHistogram; }
+
+private:
+  Action nextAttempt(uint32_t nowMs);
+  void enterBackoff(uint32_t nowMs);
+
+  Timing timing;
+  State state;
+  uint8_t attempts;
+  uint32_t backoffMs;
+  uint32_t outageStartMs;
+  uint32_t phaseStartMs;
+  uint32_t attemptStartMs;
+  uint32_t backoffStartMs;
+  Stats stats;
+  DurationHistogram outageHistogram;
+  DurationHistogram recoverHistogram;
+};
+
+#endif // WIFI_RECOVERY_H
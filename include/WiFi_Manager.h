@@ -24,13 +24,45 @@
 #include <Arduino.h>
 #include <ESP32Time.h>
 #include "config.h"
+#include "Metrics.h"
+
+// WiFi connect time statistics
+struct WiFiConnectStats {
+  uint32_t connects;           // Successful connects (boot and reconnects)
+  uint32_t directedConnects;   // Connected via cached BSSID/channel
+  uint32_t scanConnects;       // Connected after a full scan
+  uint32_t directedFallbacks;  // Directed attempts that fell back to a scan
+  uint32_t roams;              // Switches to a stronger AP while connected
+  uint32_t p50Ms;              // Connect time percentiles over recent connects
+  uint32_t p90Ms;
+  uint32_t p99Ms;
+};
+
+// WiFi recovery state and outage statistics
+struct WiFiRecoveryStats {
+  const char* state;           // Recovery state machine state
+  uint32_t disconnects;        // Connection losses
+  uint32_t reconnectAttempts;  // Reconnects issued
+  uint32_t fullRestarts;       // Full WiFi restarts issued
+  uint32_t recoveries;         // Outages that ended with a connection
+  uint32_t lastOutageMs;       // Duration of the last outage
+  const DurationHistogram* outage;   // Disconnect until connected again
+  const DurationHistogram* recover;  // Successful attempt until connected
+};
 
 // Function declarations
-bool initWiFiManager();
+bool initWiFiManager();      // Starts the connection, does not wait for it
+bool pollWiFiConnection();   // True once connected (completes the boot connection)
 bool checkWiFiStatus();
 bool isWiFiConnected();
 void configureNTP();
+void maintainNtpServers();   // Points SNTP at cached server addresses (call from loop)
+void applySavedTimezone();
+void requestTimezone(const char* name);  // Switch to a tz database zone, from any task
+void applyRequestedTimezone();           // Converts, applies and saves a requested zone (call from loop)
 void syncRTCWithNTP(ESP32Time& rtc);
+WiFiConnectStats getWiFiConnectStats();
+WiFiRecoveryStats getWiFiRecoveryStats();
 
 // External variables
 extern bool initialConfig;
@@ -0,0 +1,1339 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Generated by scripts/gen_city_table.py, do not edit.
+// 418 cities in 247 countries and 418 time zones from tz database zone.tab (20838 bytes).
+
+#ifndef CITY_TABLE_H
+#define CITY_TABLE_H
+
+#include <stdint.h>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+static const uint8_t CITY_TABLE[] PROGMEM = {
+  0x43, 0x54, 0x59, 0x31, 0xa2, 0x01, 0xf7, 0x00, 0xa2, 0x01, 0x00, 0x00, 0xfa, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x02, 0x6d, 0xfe, 0x2a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x2b, 0x02, 0xea, 0xff, 0x50, 0x00, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x44, 0x14, 0xfe, 0xba,
+  0xe6, 0x00, 0x34, 0x00, 0x13, 0x00, 0x00, 0x00, 0x87, 0x03, 0x1e, 0x0f, 0x43, 0x00, 0x02, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x5c, 0xf2, 0x22, 0x36, 0x0c, 0x00, 0x2c, 0x01, 0x28, 0x00, 0x00, 0x00,
+  0xfb, 0x04, 0xa8, 0x11, 0xf2, 0x00, 0xd0, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x5e, 0x0e, 0x31, 0x01,
+  0x3c, 0x00, 0x03, 0x00, 0x35, 0x00, 0x00, 0x00, 0xe5, 0x10, 0x0f, 0x1e, 0x7a, 0x00, 0xd1, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x7b, 0x0c, 0x09, 0x0e, 0x6e, 0x00, 0xd2, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x75, 0x14, 0xea, 0x01, 0xa3, 0x00, 0x37, 0x01, 0x4c, 0x00, 0x00, 0x00, 0x4b, 0x19, 0x54, 0x45,
+  0xbc, 0x00, 0xd3, 0x00, 0x53, 0x00, 0x00, 0x00, 0xea, 0x17, 0x72, 0xc5, 0xe6, 0x00, 0x35, 0x00,
+  0x5d, 0x00, 0x00, 0x00, 0x9a, 0x10, 0x98, 0x00, 0x00, 0x00, 0x38, 0x01, 0x65, 0x00, 0x00, 0x00,
+  0x1c, 0x07, 0x5d, 0xe7, 0x04, 0x00, 0x36, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x9c, 0xf8, 0x90, 0x12,
+  0x8b, 0x00, 0x71, 0x01, 0x7b, 0x00, 0x00, 0x00, 0xa9, 0x06, 0xdc, 0xe7, 0x03, 0x00, 0x37, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x99, 0xfa, 0xeb, 0xbc, 0xf1, 0x00, 0x7c, 0x01, 0x88, 0x00, 0x00, 0x00,
+  0x64, 0x11, 0xa3, 0x13, 0x7a, 0x00, 0xd4, 0x00, 0x8e, 0x00, 0x00, 0x00, 0xa4, 0x13, 0x55, 0x16,
+  0x7a, 0x00, 0xd5, 0x00, 0x95, 0x00, 0x00, 0x00, 0x30, 0xfd, 0x2c, 0xed, 0x1e, 0x00, 0x38, 0x00,
+  0x9f, 0x00, 0x00, 0x00, 0xe2, 0x04, 0xab, 0xe4, 0x0d, 0x00, 0x45, 0x00, 0xa5, 0x00, 0x00, 0x00,
+  0xd3, 0x0e, 0xce, 0x16, 0xdb, 0x00, 0xd6, 0x00, 0xae, 0x00, 0x00, 0x00, 0xfd, 0x05, 0x30, 0x0f,
+  0x41, 0x00, 0x04, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x1b, 0x12, 0xc5, 0x12, 0xbc, 0x00, 0x39, 0x01,
+  0xbf, 0x00, 0x00, 0x00, 0x21, 0xf6, 0x79, 0xe9, 0xb7, 0x00, 0x46, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0xd5, 0x0e, 0x44, 0x09, 0x57, 0x00, 0x3a, 0x01, 0xcf, 0x00, 0x00, 0x00, 0x0c, 0x13, 0x36, 0xdc,
+  0x24, 0x00, 0x47, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x68, 0x12, 0x49, 0x14, 0x7a, 0x00, 0xd7, 0x00,
+  0xdf, 0x00, 0x00, 0x00, 0x99, 0xf1, 0x45, 0x44, 0xa8, 0x00, 0x7d, 0x01, 0xe8, 0x00, 0x00, 0x00,
+  0xbd, 0x0e, 0xf9, 0xf5, 0xb5, 0x00, 0x22, 0x01, 0xef, 0x00, 0x00, 0x00, 0x07, 0x0d, 0x5a, 0x11,
+  0x68, 0x00, 0xd8, 0x00, 0xf7, 0x00, 0x00, 0x00, 0xee, 0xfa, 0xf4, 0xf0, 0x1e, 0x00, 0x48, 0x00,
+  0xfd, 0x00, 0x00, 0x00, 0x20, 0x08, 0xe3, 0xd6, 0x9a, 0x00, 0x49, 0x00, 0x0c, 0x01, 0x00, 0x00,
+  0x4e, 0x0a, 0xc2, 0x13, 0x16, 0x00, 0xd9, 0x00, 0x14, 0x01, 0x00, 0x00, 0xc6, 0x0f, 0x79, 0x13,
+  0x0f, 0x00, 0xda, 0x00, 0x19, 0x01, 0x00, 0x00, 0xf1, 0x04, 0xe0, 0xfc, 0x8e, 0x00, 0x05, 0x00,
+  0x20, 0x01, 0x00, 0x00, 0x5f, 0x05, 0x44, 0x27, 0xd7, 0x00, 0xdb, 0x00, 0x28, 0x01, 0x00, 0x00,
+  0xb5, 0x01, 0x42, 0x07, 0x27, 0x00, 0x06, 0x00, 0x2f, 0x01, 0x00, 0x00, 0x43, 0x05, 0x7f, 0xf9,
+  0x53, 0x00, 0x07, 0x00, 0x36, 0x01, 0x00, 0x00, 0x1e, 0x05, 0xb6, 0xe8, 0x11, 0x00, 0x4a, 0x00,
+  0x3f, 0x01, 0x00, 0x00, 0xd9, 0x14, 0xb7, 0x20, 0xbc, 0x00, 0xdc, 0x00, 0x47, 0x01, 0x00, 0x00,
+  0x3c, 0x0d, 0xde, 0x0d, 0x7c, 0x00, 0xdd, 0x00, 0x4e, 0x01, 0x00, 0x00, 0x6f, 0xff, 0x10, 0xed,
+  0x1e, 0x00, 0x4b, 0x00, 0x54, 0x01, 0x00, 0x00, 0x83, 0x11, 0x02, 0x08, 0xbb, 0x00, 0x3b, 0x01,
+  0x5d, 0x01, 0x00, 0x00, 0xd6, 0x06, 0x8c, 0xdd, 0x23, 0x00, 0x4c, 0x00, 0x64, 0x01, 0x00, 0x00,
+  0x82, 0x14, 0x39, 0x05, 0x37, 0x00, 0x3c, 0x01, 0x6b, 0x01, 0x00, 0x00, 0x9c, 0x0c, 0xb3, 0xe6,
+  0x1a, 0x00, 0x23, 0x01, 0x73, 0x01, 0x00, 0x00, 0x76, 0x12, 0x3e, 0xd8, 0xe6, 0x00, 0x9c, 0x00,
+  0x7a, 0x01, 0x00, 0x00, 0xc2, 0x10, 0x24, 0x1d, 0x71, 0x00, 0xde, 0x00, 0x82, 0x01, 0x00, 0x00,
+  0xa1, 0x04, 0xea, 0xf9, 0x5b, 0x00, 0x08, 0x00, 0x89, 0x01, 0x00, 0x00, 0x16, 0x14, 0xb0, 0xe9,
+  0x24, 0x00, 0x4d, 0x00, 0x96, 0x01, 0x00, 0x00, 0xd6, 0xf9, 0xac, 0x0d, 0x99, 0x00, 0x09, 0x00,
+  0x9f, 0x01, 0x00, 0x00, 0x1a, 0x01, 0x4d, 0xe8, 0x1e, 0x00, 0x4e, 0x00, 0xa9, 0x01, 0x00, 0x00,
+  0xcc, 0x01, 0x10, 0xe3, 0x2f, 0x00, 0x4f, 0x00, 0xb0, 0x01, 0x00, 0x00, 0x09, 0x11, 0x9c, 0xd2,
+  0xe6, 0x00, 0x50, 0x00, 0xb6, 0x01, 0x00, 0x00, 0x92, 0xfd, 0xc5, 0x3c, 0xad, 0x00, 0x7e, 0x01,
+  0xc3, 0x01, 0x00, 0x00, 0xcf, 0x12, 0xb0, 0x06, 0xc7, 0x00, 0x3d, 0x01, 0xce, 0x01, 0x00, 0x00,
+  0x55, 0xfe, 0xf8, 0x05, 0x28, 0x00, 0x0a, 0x00, 0xda, 0x01, 0x00, 0x00, 0x45, 0xf5, 0xc7, 0x3b,
+  0x0c, 0x00, 0x2d, 0x01, 0xe3, 0x01, 0x00, 0x00, 0x85, 0xf3, 0x41, 0x37, 0x0c, 0x00, 0x2e, 0x01,
+  0xef, 0x01, 0x00, 0x00, 0xed, 0x01, 0xe4, 0x2c, 0x1b, 0x00, 0xdf, 0x00, 0xf6, 0x01, 0x00, 0x00,
+  0xdb, 0x13, 0xb1, 0x01, 0x13, 0x00, 0x3e, 0x01, 0xff, 0x01, 0x00, 0x00, 0x5b, 0x11, 0x32, 0x0a,
+  0xba, 0x00, 0x3f, 0x01, 0x09, 0x02, 0x00, 0x00, 0x8e, 0x12, 0x74, 0x07, 0x61, 0x00, 0x40, 0x01,
+  0x12, 0x02, 0x00, 0x00, 0x7c, 0xf2, 0x2b, 0xe9, 0x09, 0x00, 0x39, 0x00, 0x1f, 0x02, 0x00, 0x00,
+  0xae, 0xfe, 0x79, 0x0b, 0x17, 0x00, 0x0b, 0x00, 0x29, 0x02, 0x00, 0x00, 0xa2, 0x12, 0x64, 0x03,
+  0x37, 0x00, 0x41, 0x01, 0x32, 0x02, 0x00, 0x00, 0xbd, 0x0b, 0x35, 0x0c, 0x3f, 0x00, 0x0c, 0x00,
+  0x38, 0x02, 0x00, 0x00, 0xff, 0x1a, 0xf7, 0xd6, 0x24, 0x00, 0x51, 0x00, 0x46, 0x02, 0x00, 0x00,
+  0x03, 0xf8, 0xaa, 0xea, 0x1e, 0x00, 0x52, 0x00, 0x53, 0x02, 0x00, 0x00, 0xfa, 0x0a, 0xfc, 0xf9,
+  0x42, 0x00, 0x24, 0x01, 0x5a, 0x02, 0x00, 0x00, 0x3c, 0x08, 0x1b, 0xde, 0x9a, 0x00, 0x53, 0x00,
+  0x61, 0x02, 0x00, 0x00, 0xd4, 0x05, 0xd0, 0xf6, 0x32, 0x00, 0x25, 0x01, 0x6c, 0x02, 0x00, 0x00,
+  0x1a, 0x04, 0xdb, 0xe5, 0xeb, 0x00, 0x54, 0x00, 0x74, 0x02, 0x00, 0x00, 0x25, 0x0d, 0x0a, 0xfd,
+  0x86, 0x00, 0x0d, 0x00, 0x7f, 0x02, 0x00, 0x00, 0x1c, 0xe6, 0x2c, 0x2b, 0x08, 0x00, 0xc4, 0x00,
+  0x85, 0x02, 0x00, 0x00, 0xe1, 0xf4, 0x4e, 0xe6, 0x09, 0x00, 0x3a, 0x00, 0x8f, 0x02, 0x00, 0x00,
+  0xed, 0x01, 0x8f, 0xeb, 0x4e, 0x00, 0x55, 0x00, 0x97, 0x02, 0x00, 0x00, 0x8a, 0x07, 0x36, 0xe0,
+  0x79, 0x00, 0x56, 0x00, 0x9e, 0x02, 0x00, 0x00, 0x68, 0x12, 0x6e, 0xd8, 0xe6, 0x00, 0x9d, 0x00,
+  0xa5, 0x02, 0x00, 0x00, 0x04, 0x0e, 0xec, 0xfd, 0x42, 0x00, 0x0e, 0x00, 0xab, 0x02, 0x00, 0x00,
+  0x23, 0xfd, 0x4a, 0x1c, 0x67, 0x00, 0x72, 0x01, 0xb2, 0x02, 0x00, 0x00, 0xd5, 0xee, 0x09, 0xbb,
+  0xa8, 0x00, 0x7f, 0x01, 0xba, 0x02, 0x00, 0x00, 0x59, 0x10, 0xc3, 0xdd, 0xe6, 0x00, 0x57, 0x00,
+  0xc2, 0x02, 0x00, 0x00, 0x2f, 0x0b, 0x90, 0xd6, 0x9a, 0x00, 0x58, 0x00, 0xcc, 0x02, 0x00, 0x00,
+  0x5c, 0x12, 0x43, 0x0b, 0x88, 0x00, 0x42, 0x01, 0xd5, 0x02, 0x00, 0x00, 0x55, 0x14, 0x53, 0x2c,
+  0xbc, 0x00, 0xe0, 0x00, 0xdb, 0x02, 0x00, 0x00, 0xee, 0xfb, 0x4c, 0x29, 0x34, 0x00, 0x73, 0x01,
+  0xe5, 0x02, 0x00, 0x00, 0xe6, 0x02, 0x4a, 0x3b, 0x47, 0x00, 0x80, 0x01, 0xeb, 0x02, 0x00, 0x00,
+  0x65, 0x0c, 0x68, 0xd6, 0x9a, 0x00, 0x59, 0x00, 0xf9, 0x02, 0x00, 0x00, 0x3f, 0xfb, 0xdc, 0x25,
+  0x25, 0x00, 0x74, 0x01, 0xff, 0x02, 0x00, 0x00, 0xb5, 0x02, 0x31, 0x1f, 0x7f, 0x00, 0xe1, 0x00,
+  0x07, 0x03, 0x00, 0x00, 0x70, 0xfb, 0xe7, 0x10, 0x74, 0x00, 0x75, 0x01, 0x0e, 0x03, 0x00, 0x00,
+  0xb8, 0x03, 0xa4, 0xfa, 0x54, 0x00, 0x0f, 0x00, 0x16, 0x03, 0x00, 0x00, 0xbf, 0x15, 0xea, 0x04,
+  0x39, 0x00, 0x43, 0x01, 0x21, 0x03, 0x00, 0x00, 0xbc, 0xf3, 0xee, 0xe6, 0x09, 0x00, 0x3b, 0x00,
+  0x29, 0x03, 0x00, 0x00, 0xe1, 0x03, 0x28, 0xdf, 0x30, 0x00, 0x5a, 0x00, 0x34, 0x03, 0x00, 0x00,
+  0x33, 0xee, 0xd9, 0xe3, 0x2c, 0x00, 0x5b, 0x00, 0x3e, 0x03, 0x00, 0x00, 0x2e, 0x13, 0x7c, 0xd2,
+  0x24, 0x00, 0x5c, 0x00, 0x46, 0x03, 0x00, 0x00, 0xea, 0xf9, 0x18, 0xea, 0x1e, 0x00, 0x5d, 0x00,
+  0x4d, 0x03, 0x00, 0x00, 0xc2, 0x04, 0x0c, 0xe5, 0x33, 0x00, 0x5e, 0x00, 0x55, 0x03, 0x00, 0x00,
+  0xbb, 0x05, 0x31, 0xf9, 0xca, 0x00, 0x10, 0x00, 0x5b, 0x03, 0x00, 0x00, 0x16, 0x0d, 0x2e, 0x0e,
+  0xd1, 0x00, 0xe2, 0x00, 0x64, 0x03, 0x00, 0x00, 0xfd, 0x1d, 0xb5, 0xf8, 0x52, 0x00, 0x5f, 0x00,
+  0x71, 0x03, 0x00, 0x00, 0x58, 0xfd, 0x58, 0x0f, 0xe2, 0x00, 0x11, 0x00, 0x7f, 0x03, 0x00, 0x00,
+  0x21, 0xfb, 0x1b, 0x33, 0x0c, 0x00, 0x2f, 0x01, 0x86, 0x03, 0x00, 0x00, 0x36, 0xe5, 0x75, 0x1e,
+  0x08, 0x00, 0xc5, 0x00, 0x8c, 0x03, 0x00, 0x00, 0x07, 0x19, 0x8a, 0xc9, 0x24, 0x00, 0x60, 0x00,
+  0x93, 0x03, 0x00, 0x00, 0xc9, 0x15, 0x09, 0xd1, 0x24, 0x00, 0x61, 0x00, 0xa0, 0x03, 0x00, 0x00,
+  0x86, 0x0f, 0xfe, 0xd6, 0xe6, 0x00, 0x62, 0x00, 0xa7, 0x03, 0x00, 0x00, 0x89, 0x10, 0x8f, 0xdf,
+  0xe6, 0x00, 0x63, 0x00, 0xaf, 0x03, 0x00, 0x00, 0x44, 0x09, 0x52, 0x23, 0x12, 0x00, 0xe3, 0x00,
+  0xb5, 0x03, 0x00, 0x00, 0xa9, 0xfc, 0x0e, 0x31, 0xda, 0x00, 0xe4, 0x00, 0xba, 0x03, 0x00, 0x00,
+  0x88, 0x04, 0xdb, 0x10, 0x38, 0x00, 0x12, 0x00, 0xc3, 0x03, 0x00, 0x00, 0xfa, 0x05, 0x04, 0xe8,
+  0x3a, 0x00, 0x64, 0x00, 0xcc, 0x03, 0x00, 0x00, 0x95, 0x01, 0xca, 0x03, 0x2d, 0x00, 0x13, 0x00,
+  0xd3, 0x03, 0x00, 0x00, 0xe2, 0x09, 0x9a, 0x15, 0x01, 0x00, 0xe5, 0x00, 0xd9, 0x03, 0x00, 0x00,
+  0xd5, 0x14, 0x8f, 0xfd, 0x63, 0x00, 0x44, 0x01, 0xe0, 0x03, 0x00, 0x00, 0xf5, 0xe5, 0xb2, 0x36,
+  0x08, 0x00, 0xc6, 0x00, 0xef, 0x03, 0x00, 0x00, 0x12, 0x0f, 0xe0, 0x1a, 0xd8, 0x00, 0xe6, 0x00,
+  0xf8, 0x03, 0x00, 0x00, 0x65, 0xf5, 0x41, 0xd5, 0x2c, 0x00, 0x81, 0x01, 0xff, 0x03, 0x00, 0x00,
+  0xeb, 0x14, 0xad, 0xd3, 0x24, 0x00, 0x65, 0x00, 0x08, 0x04, 0x00, 0x00, 0x19, 0xf9, 0xca, 0x41,
+  0xef, 0x00, 0x82, 0x01, 0x0e, 0x04, 0x00, 0x00, 0x65, 0xfd, 0xb5, 0xe4, 0x1e, 0x00, 0x66, 0x00,
+  0x17, 0x04, 0x00, 0x00, 0x9b, 0x0a, 0xd8, 0xfa, 0x40, 0x00, 0x14, 0x00, 0x20, 0x04, 0x00, 0x00,
+  0x5a, 0x05, 0x28, 0xdd, 0xcf, 0x00, 0x67, 0x00, 0x2c, 0x04, 0x00, 0x00, 0x9c, 0xf3, 0x57, 0x32,
+  0x0c, 0x00, 0x30, 0x01, 0x32, 0x04, 0x00, 0x00, 0x57, 0xfc, 0x1d, 0xbd, 0xd9, 0x00, 0x83, 0x01,
+  0x3a, 0x04, 0x00, 0x00, 0xb8, 0x0d, 0x43, 0x0d, 0x35, 0x00, 0xe7, 0x00, 0x44, 0x04, 0x00, 0x00,
+  0x3a, 0x18, 0x5b, 0xfd, 0x48, 0x00, 0x26, 0x01, 0x4a, 0x04, 0x00, 0x00, 0xeb, 0xf8, 0xb2, 0x45,
+  0x45, 0x00, 0x84, 0x01, 0x4f, 0x04, 0x00, 0x00, 0xf8, 0x16, 0x12, 0xd0, 0x24, 0x00, 0x68, 0x00,
+  0x5b, 0x04, 0x00, 0x00, 0x8c, 0xfe, 0xf6, 0xf0, 0x1e, 0x00, 0x69, 0x00, 0x65, 0x04, 0x00, 0x00,
+  0x52, 0x03, 0xd3, 0xfa, 0xc8, 0x00, 0x15, 0x00, 0x6e, 0x04, 0x00, 0x00, 0xac, 0xfc, 0x02, 0x46,
+  0xe0, 0x00, 0x85, 0x01, 0x77, 0x04, 0x00, 0x00, 0x5f, 0xf6, 0x20, 0x0a, 0x21, 0x00, 0x16, 0x00,
+  0x80, 0x04, 0x00, 0x00, 0xa6, 0xff, 0x00, 0xdd, 0x3d, 0x00, 0x86, 0x01, 0x8a, 0x04, 0x00, 0x00,
+  0xf7, 0xf6, 0x49, 0xcb, 0xac, 0x00, 0x87, 0x01, 0x92, 0x04, 0x00, 0x00, 0x4e, 0x0c, 0x77, 0x0d,
+  0xb4, 0x00, 0xe8, 0x00, 0x97, 0x04, 0x00, 0x00, 0x1d, 0x0e, 0xe9, 0xfd, 0x51, 0x00, 0x45, 0x01,
+  0xa1, 0x04, 0x00, 0x00, 0x0c, 0x12, 0x95, 0xe8, 0x24, 0x00, 0x6a, 0x00, 0xab, 0x04, 0x00, 0x00,
+  0xd5, 0x14, 0x66, 0xe8, 0x24, 0x00, 0x6b, 0x00, 0xb5, 0x04, 0x00, 0x00, 0x63, 0x08, 0x37, 0xe4,
+  0xd3, 0x00, 0x6c, 0x00, 0xc0, 0x04, 0x00, 0x00, 0xb5, 0x04, 0xe1, 0xe7, 0x4c, 0x00, 0x6d, 0x00,
+  0xc8, 0x04, 0x00, 0x00, 0x47, 0xfc, 0x94, 0x3e, 0xbf, 0x00, 0x88, 0x01, 0xd4, 0x04, 0x00, 0x00,
+  0x57, 0x06, 0xf7, 0xe7, 0x55, 0x00, 0x6e, 0x00, 0xdf, 0x04, 0x00, 0x00, 0x43, 0x05, 0x8b, 0x38,
+  0x5a, 0x00, 0x89, 0x01, 0xe4, 0x04, 0x00, 0x00, 0xb7, 0x05, 0xa4, 0xdc, 0x59, 0x00, 0x6f, 0x00,
+  0xee, 0x04, 0x00, 0x00, 0x27, 0xff, 0xd1, 0xe0, 0x3d, 0x00, 0x70, 0x00, 0xf8, 0x04, 0x00, 0x00,
+  0x51, 0x13, 0x02, 0xff, 0x4f, 0x00, 0x46, 0x01, 0x01, 0x05, 0x00, 0x00, 0xa8, 0x02, 0x47, 0xe9,
+  0x5c, 0x00, 0x71, 0x00, 0x08, 0x05, 0x00, 0x00, 0x71, 0x11, 0x28, 0xe7, 0x24, 0x00, 0x72, 0x00,
+  0x10, 0x05, 0x00, 0x00, 0x09, 0xf9, 0x21, 0x0c, 0xf6, 0x00, 0x17, 0x00, 0x17, 0x05, 0x00, 0x00,
+  0x09, 0x09, 0xd3, 0xdf, 0x31, 0x00, 0x73, 0x00, 0x1e, 0x05, 0x00, 0x00, 0x51, 0x0c, 0xb6, 0x0d,
+  0xb4, 0x00, 0xe9, 0x00, 0x25, 0x05, 0x00, 0x00, 0x81, 0x17, 0xc1, 0x09, 0x44, 0x00, 0x47, 0x01,
+  0x2e, 0x05, 0x00, 0x00, 0x5b, 0x0b, 0xa7, 0xd4, 0x9a, 0x00, 0x74, 0x00, 0x39, 0x05, 0x00, 0x00,
+  0x33, 0x04, 0xab, 0x29, 0xee, 0x00, 0xea, 0x00, 0x45, 0x05, 0x00, 0x00, 0x40, 0xef, 0x8c, 0x39,
+  0x0c, 0x00, 0x31, 0x01, 0x4c, 0x05, 0x00, 0x00, 0xb4, 0x08, 0x97, 0x2c, 0x5d, 0x00, 0xeb, 0x00,
+  0x56, 0x05, 0x00, 0x00, 0x53, 0x08, 0x56, 0xc2, 0xe6, 0x00, 0x8a, 0x01, 0x5f, 0x05, 0x00, 0x00,
+  0xc2, 0x12, 0xcd, 0x23, 0x90, 0x00, 0xec, 0x00, 0x64, 0x05, 0x00, 0x00, 0x89, 0x0f, 0x58, 0xde,
+  0xe6, 0x00, 0x75, 0x00, 0x71, 0x05, 0x00, 0x00, 0xb3, 0x1a, 0xc4, 0xcb, 0x24, 0x00, 0x7d, 0x00,
+  0x78, 0x05, 0x00, 0x00, 0xe5, 0x18, 0x41, 0xe5, 0x24, 0x00, 0x7e, 0x00, 0x80, 0x05, 0x00, 0x00,
+  0x6b, 0x14, 0xc1, 0x28, 0xbc, 0x00, 0xed, 0x00, 0x88, 0x05, 0x00, 0x00, 0x27, 0x15, 0x41, 0xfe,
+  0x65, 0x00, 0x48, 0x01, 0x94, 0x05, 0x00, 0x00, 0x06, 0x10, 0x51, 0x0b, 0xde, 0x00, 0x49, 0x01,
+  0x9d, 0x05, 0x00, 0x00, 0x97, 0xfd, 0xb8, 0x29, 0x62, 0x00, 0xee, 0x00, 0xa5, 0x05, 0x00, 0x00,
+  0x05, 0x07, 0x01, 0xe2, 0x6d, 0x00, 0x7f, 0x00, 0xad, 0x05, 0x00, 0x00, 0x03, 0xff, 0xf6, 0x36,
+  0x62, 0x00, 0xef, 0x00, 0xb6, 0x05, 0x00, 0x00, 0x36, 0x13, 0x2d, 0xff, 0x6c, 0x00, 0x4a, 0x01,
+  0xbd, 0x05, 0x00, 0x00, 0x6a, 0x0c, 0xc2, 0x0d, 0x64, 0x00, 0xf0, 0x00, 0xc7, 0x05, 0x00, 0x00,
+  0xbf, 0xf5, 0xf0, 0x0a, 0xf4, 0x00, 0x18, 0x00, 0xd4, 0x05, 0x00, 0x00, 0xe5, 0x01, 0x5a, 0x0c,
+  0xcd, 0x00, 0x19, 0x00, 0xd9, 0x05, 0x00, 0x00, 0x8e, 0xf6, 0x7e, 0xe6, 0x09, 0x00, 0x3c, 0x00,
+  0xdf, 0x05, 0x00, 0x00, 0xc6, 0x16, 0x7e, 0xcb, 0xe6, 0x00, 0x80, 0x00, 0xe6, 0x05, 0x00, 0x00,
+  0x7c, 0x0d, 0x08, 0x1b, 0x02, 0x00, 0xf1, 0x00, 0xec, 0x05, 0x00, 0x00, 0x60, 0x15, 0x02, 0x08,
+  0xbc, 0x00, 0x4b, 0x01, 0xf8, 0x05, 0x00, 0x00, 0xb6, 0x14, 0xf9, 0x3d, 0xbc, 0x00, 0xf2, 0x00,
+  0x02, 0x06, 0x00, 0x00, 0x20, 0x00, 0xaa, 0x0c, 0xe4, 0x00, 0x1a, 0x00, 0x0a, 0x06, 0x00, 0x00,
+  0xea, 0xfe, 0xec, 0xbc, 0x73, 0x00, 0x8b, 0x01, 0x11, 0x06, 0x00, 0x00, 0xb7, 0x09, 0x31, 0x1a,
+  0xaf, 0x00, 0xf3, 0x00, 0x19, 0x06, 0x00, 0x00, 0xd4, 0x0a, 0x54, 0x21, 0xa5, 0x00, 0xf4, 0x00,
+  0x23, 0x06, 0x00, 0x00, 0xb9, 0xec, 0x6e, 0x1b, 0xd5, 0x00, 0x76, 0x01, 0x2d, 0x06, 0x00, 0x00,
+  0x7a, 0x18, 0xf3, 0x34, 0xbc, 0x00, 0xf5, 0x00, 0x36, 0x06, 0x00, 0x00, 0x18, 0x06, 0xb5, 0x0c,
+  0xc1, 0x00, 0x1b, 0x00, 0x3f, 0x06, 0x00, 0x00, 0x3d, 0xff, 0xbf, 0x0b, 0xbd, 0x00, 0x1c, 0x00,
+  0x46, 0x06, 0x00, 0x00, 0x52, 0xfe, 0xfa, 0x05, 0x26, 0x00, 0x1d, 0x00, 0x4f, 0x06, 0x00, 0x00,
+  0xbb, 0x00, 0x8b, 0xc2, 0x73, 0x00, 0x8c, 0x01, 0x5a, 0x06, 0x00, 0x00, 0xe4, 0x16, 0x65, 0x13,
+  0xbc, 0x00, 0x4c, 0x01, 0x60, 0x06, 0x00, 0x00, 0x22, 0x10, 0x2a, 0xde, 0xe6, 0x00, 0x76, 0x00,
+  0x65, 0x06, 0x00, 0x00, 0xcd, 0x08, 0x85, 0x22, 0x66, 0x00, 0xf6, 0x00, 0x6d, 0x06, 0x00, 0x00,
+  0x14, 0x02, 0xaa, 0x3f, 0x47, 0x00, 0x8d, 0x01, 0x74, 0x06, 0x00, 0x00, 0xbf, 0x04, 0x54, 0xe5,
+  0x1d, 0x00, 0x83, 0x00, 0x7f, 0x06, 0x00, 0x00, 0xe2, 0x15, 0x43, 0x24, 0xbc, 0x00, 0xf7, 0x00,
+  0x8b, 0x06, 0x00, 0x00, 0x3d, 0x01, 0xba, 0x27, 0x9b, 0x00, 0xf8, 0x00, 0x98, 0x06, 0x00, 0x00,
+  0x9b, 0x00, 0x19, 0x2b, 0x9b, 0x00, 0xf9, 0x00, 0xa0, 0x06, 0x00, 0x00, 0x75, 0x0b, 0xbe, 0x12,
+  0x78, 0x00, 0xfa, 0x00, 0xa7, 0x06, 0x00, 0x00, 0x8c, 0x03, 0x5d, 0x41, 0x8c, 0x00, 0x8e, 0x01,
+  0xb1, 0x06, 0x00, 0x00, 0xb3, 0x13, 0xec, 0x0b, 0xe3, 0x00, 0x4d, 0x01, 0xb6, 0x06, 0x00, 0x00,
+  0x8e, 0xf9, 0x61, 0xe5, 0x1c, 0x00, 0x84, 0x00, 0xbd, 0x06, 0x00, 0x00, 0x81, 0xf4, 0xe3, 0xe5,
+  0x09, 0x00, 0x3d, 0x00, 0xc6, 0x06, 0x00, 0x00, 0x85, 0x02, 0x54, 0x01, 0xa1, 0x00, 0x1e, 0x00,
+  0xcc, 0x06, 0x00, 0x00, 0x26, 0x00, 0xb1, 0x03, 0x4a, 0x00, 0x1f, 0x00, 0xd7, 0x06, 0x00, 0x00,
+  0x4b, 0xfb, 0xe7, 0xe1, 0xab, 0x00, 0x85, 0x00, 0xdc, 0x06, 0x00, 0x00, 0x15, 0xf8, 0x34, 0x3a,
+  0x0c, 0x00, 0x32, 0x01, 0xe5, 0x06, 0x00, 0x00, 0x20, 0x0f, 0x6f, 0xfc, 0xb5, 0x00, 0x4e, 0x01,
+  0xec, 0x06, 0x00, 0x00, 0xfd, 0x11, 0xac, 0x05, 0xc5, 0x00, 0x4f, 0x01, 0xf6, 0x06, 0x00, 0x00,
+  0x65, 0x02, 0x7a, 0x00, 0xd6, 0x00, 0x20, 0x00, 0xfb, 0x06, 0x00, 0x00, 0x1f, 0x14, 0xf3, 0xff,
+  0x4b, 0x00, 0x50, 0x01, 0x02, 0x07, 0x00, 0x00, 0x78, 0x1e, 0x40, 0x06, 0xc6, 0x00, 0xcf, 0x00,
+  0x0f, 0x07, 0x00, 0x00, 0xad, 0xf3, 0x24, 0x3e, 0x0c, 0x00, 0x33, 0x01, 0x19, 0x07, 0x00, 0x00,
+  0x4d, 0x0d, 0xd0, 0xd1, 0xe6, 0x00, 0x86, 0x00, 0x25, 0x07, 0x00, 0x00, 0xf1, 0x0e, 0x80, 0xde,
+  0xe6, 0x00, 0x81, 0x00, 0x30, 0x07, 0x00, 0x00, 0x0d, 0x07, 0x5f, 0xe7, 0xd0, 0x00, 0x87, 0x00,
+  0x3e, 0x07, 0x00, 0x00, 0x90, 0xfc, 0x2b, 0x05, 0x07, 0x00, 0x21, 0x00, 0x45, 0x07, 0x00, 0x00,
+  0x71, 0xfb, 0xbb, 0x0a, 0x26, 0x00, 0x22, 0x00, 0x50, 0x07, 0x00, 0x00, 0xfa, 0xf9, 0x0c, 0x0b,
+  0xf5, 0x00, 0x23, 0x00, 0x57, 0x07, 0x00, 0x00, 0x60, 0x13, 0x67, 0x02, 0x83, 0x00, 0x51, 0x01,
+  0x62, 0x07, 0x00, 0x00, 0xac, 0x08, 0x5a, 0x2c, 0x91, 0x00, 0xfb, 0x00, 0x68, 0x07, 0x00, 0x00,
+  0x39, 0xfc, 0x0c, 0xf2, 0x1e, 0x00, 0x88, 0x00, 0x6f, 0x07, 0x00, 0x00, 0xb6, 0xea, 0x17, 0x3e,
+  0x0c, 0x00, 0xc7, 0x00, 0x79, 0x07, 0x00, 0x00, 0xbf, 0x0c, 0x66, 0xf9, 0xb5, 0x00, 0x27, 0x01,
+  0x81, 0x07, 0x00, 0x00, 0xc8, 0x0f, 0x90, 0xfe, 0x42, 0x00, 0x52, 0x01, 0x88, 0x07, 0x00, 0x00,
+  0x45, 0x17, 0xe8, 0x3a, 0xbc, 0x00, 0xfc, 0x00, 0x90, 0x07, 0x00, 0x00, 0x2d, 0xfe, 0xab, 0x15,
+  0xc0, 0x00, 0x77, 0x01, 0x95, 0x07, 0x00, 0x00, 0xcb, 0x02, 0xe0, 0x42, 0x8c, 0x00, 0x8f, 0x01,
+  0x9c, 0x07, 0x00, 0x00, 0x00, 0xfe, 0xa4, 0x2e, 0x62, 0x00, 0xfd, 0x00, 0xa5, 0x07, 0x00, 0x00,
+  0x77, 0x01, 0x6e, 0x03, 0x56, 0x00, 0x24, 0x00, 0xac, 0x07, 0x00, 0x00, 0xa1, 0x01, 0xb6, 0x1c,
+  0x98, 0x00, 0x78, 0x01, 0xb5, 0x07, 0x00, 0x00, 0x06, 0x0e, 0xac, 0x05, 0x96, 0x00, 0x53, 0x01,
+  0xbb, 0x07, 0x00, 0x00, 0xbf, 0x04, 0x4c, 0xde, 0xa2, 0x00, 0x89, 0x00, 0xc3, 0x07, 0x00, 0x00,
+  0xc7, 0xfe, 0x8e, 0xe8, 0x1e, 0x00, 0x8a, 0x00, 0xca, 0x07, 0x00, 0x00, 0xb3, 0x05, 0x41, 0x2f,
+  0xae, 0x00, 0xfe, 0x00, 0xd1, 0x07, 0x00, 0x00, 0xdb, 0xf5, 0xba, 0x0c, 0x9c, 0x00, 0x25, 0x00,
+  0xd8, 0x07, 0x00, 0x00, 0xfe, 0x0e, 0x46, 0xde, 0xe6, 0x00, 0x77, 0x00, 0xe0, 0x07, 0x00, 0x00,
+  0x7a, 0x17, 0xcb, 0x07, 0x0e, 0x00, 0x54, 0x01, 0xea, 0x07, 0x00, 0x00, 0x0f, 0x07, 0x5c, 0xe7,
+  0x8a, 0x00, 0x8b, 0x00, 0xf2, 0x07, 0x00, 0x00, 0x7c, 0xfc, 0x82, 0xc9, 0xac, 0x00, 0x90, 0x01,
+  0xfc, 0x07, 0x00, 0x00, 0xb4, 0x05, 0x24, 0xe8, 0x93, 0x00, 0x8c, 0x00, 0x07, 0x08, 0x00, 0x00,
+  0x7d, 0xf4, 0xbe, 0x0a, 0x81, 0x00, 0x26, 0x00, 0x0e, 0x08, 0x00, 0x00, 0x17, 0x0a, 0xea, 0xd9,
+  0x9a, 0x00, 0x8d, 0x00, 0x18, 0x08, 0x00, 0x00, 0x1f, 0xf8, 0x76, 0x16, 0x97, 0x00, 0x79, 0x01,
+  0x22, 0x08, 0x00, 0x00, 0x98, 0xe5, 0x90, 0x18, 0x08, 0x00, 0xc8, 0x00, 0x29, 0x08, 0x00, 0x00,
+  0x02, 0xfb, 0xab, 0x11, 0xf3, 0x00, 0x7a, 0x01, 0x31, 0x08, 0x00, 0x00, 0x12, 0x09, 0x6e, 0xd6,
+  0x9a, 0x00, 0x8e, 0x00, 0x3a, 0x08, 0x00, 0x00, 0xba, 0xf5, 0x26, 0x0c, 0xd2, 0x00, 0x27, 0x00,
+  0x42, 0x08, 0x00, 0x00, 0x99, 0xe1, 0x14, 0x41, 0x08, 0x00, 0xc9, 0x00, 0x4a, 0x08, 0x00, 0x00,
+  0x3a, 0xf1, 0xa1, 0x38, 0x0c, 0x00, 0x34, 0x01, 0x54, 0x08, 0x00, 0x00, 0x28, 0xf3, 0x1e, 0xe5,
+  0x09, 0x00, 0x3e, 0x00, 0x5c, 0x08, 0x00, 0x00, 0x9f, 0x11, 0xc7, 0xdd, 0xe6, 0x00, 0x8f, 0x00,
+  0x66, 0x08, 0x00, 0x00, 0x31, 0x08, 0xfe, 0xdc, 0x9a, 0x00, 0x90, 0x00, 0x6d, 0x08, 0x00, 0x00,
+  0x89, 0x15, 0x9a, 0xcc, 0xe6, 0x00, 0x91, 0x00, 0x78, 0x08, 0x00, 0x00, 0x94, 0x07, 0x45, 0xd9,
+  0x9a, 0x00, 0x92, 0x00, 0x84, 0x08, 0x00, 0x00, 0x06, 0x0b, 0xb7, 0xba, 0xe5, 0x00, 0x91, 0x01,
+  0x8b, 0x08, 0x00, 0x00, 0x0e, 0x15, 0xc5, 0x0a, 0x22, 0x00, 0x55, 0x01, 0x91, 0x08, 0x00, 0x00,
+  0x61, 0x12, 0xff, 0xe9, 0xb1, 0x00, 0x93, 0x00, 0x9a, 0x08, 0x00, 0x00, 0xcf, 0x00, 0xb9, 0x11,
+  0xcb, 0x00, 0x28, 0x00, 0xa4, 0x08, 0x00, 0x00, 0x12, 0x11, 0xe2, 0x02, 0x87, 0x00, 0x56, 0x01,
+  0xab, 0x08, 0x00, 0x00, 0x02, 0x12, 0xb2, 0xe6, 0x24, 0x00, 0x94, 0x00, 0xb3, 0x08, 0x00, 0x00,
+  0x76, 0x02, 0xca, 0xfb, 0x80, 0x00, 0x29, 0x00, 0xbc, 0x08, 0x00, 0x00, 0x07, 0x0a, 0xd0, 0xd8,
+  0x9a, 0x00, 0x95, 0x00, 0xc6, 0x08, 0x00, 0x00, 0x5d, 0xf2, 0x0b, 0xea, 0xe7, 0x00, 0x96, 0x00,
+  0xd1, 0x08, 0x00, 0x00, 0x63, 0x0e, 0xdb, 0xde, 0xe6, 0x00, 0x82, 0x00, 0xdc, 0x08, 0x00, 0x00,
+  0x88, 0x06, 0xb2, 0xe7, 0x95, 0x00, 0x97, 0x00, 0xe7, 0x08, 0x00, 0x00, 0xc8, 0x15, 0xb2, 0x0e,
+  0xbc, 0x00, 0x57, 0x01, 0xee, 0x08, 0x00, 0x00, 0x38, 0x09, 0xe2, 0x16, 0xa9, 0x00, 0xff, 0x00,
+  0xf5, 0x08, 0x00, 0x00, 0x80, 0xff, 0x62, 0x0e, 0x70, 0x00, 0x2a, 0x00, 0xfd, 0x08, 0x00, 0x00,
+  0xcc, 0x09, 0xc9, 0xe1, 0x1f, 0x00, 0x98, 0x00, 0x04, 0x09, 0x00, 0x00, 0xcc, 0xff, 0x34, 0x41,
+  0xa6, 0x00, 0x92, 0x01, 0x0a, 0x09, 0x00, 0x00, 0xbc, 0x04, 0xe1, 0x05, 0xd4, 0x00, 0x2b, 0x00,
+  0x13, 0x09, 0x00, 0x00, 0x4c, 0x12, 0x63, 0xd8, 0xe6, 0x00, 0x9e, 0x00, 0x1d, 0x09, 0x00, 0x00,
+  0xe7, 0x0f, 0x17, 0xe3, 0xe6, 0x00, 0x99, 0x00, 0x26, 0x09, 0x00, 0x00, 0x48, 0x05, 0xd4, 0x00,
+  0x9f, 0x00, 0x2c, 0x00, 0x2d, 0x09, 0x00, 0x00, 0xbd, 0x0d, 0x09, 0x0d, 0x35, 0x00, 0x00, 0x01,
+  0x35, 0x09, 0x00, 0x00, 0x92, 0xf8, 0xa0, 0xbd, 0xa7, 0x00, 0x93, 0x01, 0x3a, 0x09, 0x00, 0x00,
+  0x32, 0x19, 0x63, 0xbf, 0xe6, 0x00, 0x9a, 0x00, 0x3f, 0x09, 0x00, 0x00, 0xa7, 0xf4, 0x9d, 0x41,
+  0xa0, 0x00, 0x94, 0x01, 0x47, 0x09, 0x00, 0x00, 0x7f, 0xfe, 0x56, 0xf3, 0x1e, 0x00, 0x9b, 0x00,
+  0x4f, 0x09, 0x00, 0x00, 0x12, 0x07, 0xc5, 0xf9, 0x94, 0x00, 0x2d, 0x00, 0x5a, 0x09, 0x00, 0x00,
+  0x4d, 0xf7, 0x05, 0x41, 0x9e, 0x00, 0x95, 0x01, 0x61, 0x09, 0x00, 0x00, 0xff, 0x14, 0x08, 0x22,
+  0xbc, 0x00, 0x01, 0x01, 0x6e, 0x09, 0x00, 0x00, 0x7f, 0x15, 0x64, 0x20, 0xbc, 0x00, 0x02, 0x01,
+  0x7a, 0x09, 0x00, 0x00, 0x12, 0x19, 0xcb, 0xeb, 0x52, 0x00, 0x9f, 0x00, 0x7f, 0x09, 0x00, 0x00,
+  0x8d, 0x0b, 0x36, 0xd7, 0x9a, 0x00, 0xa0, 0x00, 0x87, 0x09, 0x00, 0x00, 0x7c, 0x15, 0xac, 0x1c,
+  0xbc, 0x00, 0x03, 0x01, 0x8c, 0x09, 0x00, 0x00, 0x02, 0x14, 0x0f, 0x14, 0x7a, 0x00, 0x04, 0x01,
+  0x91, 0x09, 0x00, 0x00, 0x68, 0x17, 0x33, 0x04, 0xa4, 0x00, 0x58, 0x01, 0x96, 0x09, 0x00, 0x00,
+  0xd5, 0x04, 0x68, 0xff, 0x14, 0x00, 0x2e, 0x00, 0xa2, 0x09, 0x00, 0x00, 0x6d, 0xfa, 0x52, 0xbd,
+  0x0a, 0x00, 0x96, 0x01, 0xac, 0x09, 0x00, 0x00, 0xdd, 0x02, 0x88, 0x34, 0xb6, 0x00, 0x97, 0x01,
+  0xb2, 0x09, 0x00, 0x00, 0xb0, 0xe6, 0xf6, 0xe6, 0x08, 0x00, 0xca, 0x00, 0xb9, 0x09, 0x00, 0x00,
+  0x81, 0x03, 0xef, 0xe0, 0xaa, 0x00, 0xa1, 0x00, 0xc0, 0x09, 0x00, 0x00, 0x47, 0x02, 0x73, 0xea,
+  0xcc, 0x00, 0xa2, 0x00, 0xcb, 0x09, 0x00, 0x00, 0x17, 0x13, 0xe9, 0x00, 0x49, 0x00, 0x59, 0x01,
+  0xd1, 0x09, 0x00, 0x00, 0x85, 0xf3, 0x41, 0x2d, 0x0c, 0x00, 0x35, 0x01, 0xd7, 0x09, 0x00, 0x00,
+  0x09, 0x0f, 0xe8, 0xdd, 0xe6, 0x00, 0x78, 0x00, 0xe2, 0x09, 0x00, 0x00, 0x83, 0x04, 0xfc, 0x28,
+  0x72, 0x00, 0x05, 0x01, 0xed, 0x09, 0x00, 0x00, 0x11, 0x0d, 0x39, 0xd4, 0xe6, 0x00, 0xa3, 0x00,
+  0xf5, 0x09, 0x00, 0x00, 0x35, 0xf6, 0x30, 0xcd, 0xb2, 0x00, 0x98, 0x01, 0xfe, 0x09, 0x00, 0x00,
+  0x93, 0x10, 0x87, 0x07, 0x89, 0x00, 0x5a, 0x01, 0x08, 0x0a, 0x00, 0x00, 0xb9, 0x02, 0xce, 0x3d,
+  0x47, 0x00, 0x99, 0x01, 0x10, 0x0a, 0x00, 0x00, 0xfd, 0xff, 0xb5, 0x2a, 0x62, 0x00, 0x06, 0x01,
+  0x1a, 0x0a, 0x00, 0x00, 0x4a, 0xfc, 0x7d, 0x39, 0xad, 0x00, 0x9a, 0x01, 0x27, 0x0a, 0x00, 0x00,
+  0x29, 0x04, 0xf8, 0xe7, 0xdf, 0x00, 0xa5, 0x00, 0x35, 0x0a, 0x00, 0x00, 0x3d, 0x07, 0xbf, 0xe3,
+  0x60, 0x00, 0xa4, 0x00, 0x44, 0x0a, 0x00, 0x00, 0x93, 0xfc, 0x0a, 0xe7, 0x1e, 0x00, 0xa6, 0x00,
+  0x50, 0x0a, 0x00, 0x00, 0x88, 0x02, 0x06, 0x01, 0x18, 0x00, 0x2f, 0x00, 0x5b, 0x0a, 0x00, 0x00,
+  0x90, 0x13, 0xa3, 0x05, 0x36, 0x00, 0x5b, 0x01, 0x62, 0x0a, 0x00, 0x00, 0x37, 0x07, 0x2d, 0xe6,
+  0xb3, 0x00, 0xa7, 0x00, 0x6e, 0x0a, 0x00, 0x00, 0x3d, 0xeb, 0x4c, 0xe4, 0x2c, 0x00, 0xa8, 0x00,
+  0x7b, 0x0a, 0x00, 0x00, 0x3e, 0x0f, 0x1f, 0x31, 0x76, 0x00, 0x07, 0x01, 0x85, 0x0a, 0x00, 0x00,
+  0xe0, 0x09, 0x21, 0x14, 0xb8, 0x00, 0x08, 0x01, 0x8b, 0x0a, 0x00, 0x00, 0xc8, 0x14, 0xda, 0x18,
+  0x7a, 0x00, 0x09, 0x01, 0x94, 0x0a, 0x00, 0x00, 0x80, 0x11, 0x93, 0x19, 0x7a, 0x00, 0x0a, 0x01,
+  0x9e, 0x0a, 0x00, 0x00, 0x8a, 0x18, 0x08, 0xdc, 0x24, 0x00, 0xa9, 0x00, 0xab, 0x0a, 0x00, 0x00,
+  0xb5, 0xf7, 0x97, 0xc1, 0x2b, 0x00, 0x9b, 0x01, 0xb5, 0x0a, 0x00, 0x00, 0xdb, 0xfc, 0x5e, 0xf2,
+  0x1e, 0x00, 0xaa, 0x00, 0xbc, 0x0a, 0x00, 0x00, 0xb0, 0x13, 0x1f, 0xd7, 0x24, 0x00, 0xab, 0x00,
+  0xc3, 0x0a, 0x00, 0x00, 0x2e, 0x1d, 0xf5, 0xda, 0x24, 0x00, 0xac, 0x00, 0xcc, 0x0a, 0x00, 0x00,
+  0xd9, 0xf7, 0xab, 0x15, 0xb9, 0x00, 0x7b, 0x01, 0xd4, 0x0a, 0x00, 0x00, 0x0f, 0x19, 0x77, 0xf7,
+  0x6a, 0x00, 0x28, 0x01, 0xde, 0x0a, 0x00, 0x00, 0x3f, 0x16, 0x6a, 0x09, 0x84, 0x00, 0x5c, 0x01,
+  0xe3, 0x0a, 0x00, 0x00, 0x1b, 0xfc, 0x84, 0xe5, 0x1e, 0x00, 0xad, 0x00, 0xee, 0x0a, 0x00, 0x00,
+  0xd5, 0xeb, 0xf6, 0xe4, 0x09, 0x00, 0x3f, 0x00, 0xfb, 0x0a, 0x00, 0x00, 0x9f, 0x09, 0x40, 0x12,
+  0xbe, 0x00, 0x0b, 0x01, 0x02, 0x0b, 0x00, 0x00, 0x5e, 0x10, 0xe0, 0x04, 0x6b, 0x00, 0x5d, 0x01,
+  0x07, 0x0b, 0x00, 0x00, 0x9b, 0xe5, 0x63, 0xe5, 0x08, 0x00, 0xcb, 0x00, 0x0f, 0x0b, 0x00, 0x00,
+  0xf0, 0x05, 0xef, 0x38, 0x92, 0x00, 0x9c, 0x01, 0x16, 0x0b, 0x00, 0x00, 0x59, 0x12, 0xbe, 0x37,
+  0xbc, 0x00, 0x0c, 0x01, 0x1f, 0x0b, 0x00, 0x00, 0x52, 0xf6, 0x72, 0xe6, 0x09, 0x00, 0x40, 0x00,
+  0x25, 0x0b, 0x00, 0x00, 0xc8, 0x14, 0x97, 0x13, 0xbc, 0x00, 0x5e, 0x01, 0x2c, 0x0b, 0x00, 0x00,
+  0x7f, 0x0f, 0x18, 0x1a, 0xe8, 0x00, 0x0d, 0x01, 0x36, 0x0b, 0x00, 0x00, 0xaf, 0xf3, 0x3c, 0xe5,
+  0x09, 0x00, 0x41, 0x00, 0x3f, 0x0b, 0x00, 0x00, 0xfc, 0xf2, 0x15, 0xe6, 0x09, 0x00, 0x42, 0x00,
+  0x48, 0x0b, 0x00, 0x00, 0x28, 0x11, 0xdf, 0x04, 0xc9, 0x00, 0x5f, 0x01, 0x53, 0x0b, 0x00, 0x00,
+  0x0d, 0xff, 0x91, 0xea, 0x1e, 0x00, 0xae, 0x00, 0x5c, 0x0b, 0x00, 0x00, 0xef, 0xf2, 0x65, 0xe4,
+  0x2c, 0x00, 0xaf, 0x00, 0x65, 0x0b, 0x00, 0x00, 0x37, 0x07, 0xb2, 0xe4, 0x3b, 0x00, 0xb0, 0x00,
+  0x73, 0x0b, 0x00, 0x00, 0xcf, 0xf6, 0xca, 0xed, 0x1e, 0x00, 0xb1, 0x00, 0x7d, 0x0b, 0x00, 0x00,
+  0x21, 0x00, 0xa1, 0x02, 0xce, 0x00, 0x30, 0x00, 0x86, 0x0b, 0x00, 0x00, 0x23, 0x11, 0x32, 0x07,
+  0x10, 0x00, 0x60, 0x01, 0x8f, 0x0b, 0x00, 0x00, 0x25, 0x14, 0xfb, 0x11, 0xbc, 0x00, 0x61, 0x01,
+  0x97, 0x0b, 0x00, 0x00, 0x88, 0x1b, 0x6b, 0xf7, 0x52, 0x00, 0xb2, 0x00, 0xa4, 0x0b, 0x00, 0x00,
+  0xab, 0x0e, 0x99, 0x31, 0x77, 0x00, 0x0e, 0x01, 0xaa, 0x0b, 0x00, 0x00, 0x33, 0x0c, 0x73, 0x2f,
+  0x2e, 0x00, 0x0f, 0x01, 0xb3, 0x0b, 0x00, 0x00, 0x8f, 0x11, 0x52, 0x0d, 0xe3, 0x00, 0x62, 0x01,
+  0xbe, 0x0b, 0x00, 0x00, 0x80, 0x00, 0x91, 0x28, 0xc3, 0x00, 0x10, 0x01, 0xc8, 0x0b, 0x00, 0x00,
+  0x56, 0x16, 0x26, 0xcb, 0xe6, 0x00, 0xb3, 0x00, 0xce, 0x0b, 0x00, 0x00, 0x66, 0x10, 0x5f, 0x08,
+  0x8d, 0x00, 0x63, 0x01, 0xd5, 0x0b, 0x00, 0x00, 0xac, 0x10, 0x1c, 0x09, 0x15, 0x00, 0x64, 0x01,
+  0xdb, 0x0b, 0x00, 0x00, 0xcd, 0xea, 0xbb, 0xf1, 0x58, 0x00, 0x29, 0x01, 0xe9, 0x0b, 0x00, 0x00,
+  0x5b, 0x1a, 0x0c, 0x3c, 0xbc, 0x00, 0x11, 0x01, 0xf7, 0x0b, 0x00, 0x00, 0xfc, 0x06, 0x73, 0xe7,
+  0x19, 0x00, 0xb4, 0x00, 0x05, 0x0c, 0x00, 0x00, 0xc8, 0xf9, 0xc6, 0xfd, 0xc4, 0x00, 0x2a, 0x01,
+  0x0f, 0x0c, 0x00, 0x00, 0x95, 0x12, 0x68, 0xeb, 0x24, 0x00, 0xb5, 0x00, 0x18, 0x0c, 0x00, 0x00,
+  0xc2, 0x06, 0x80, 0xe7, 0x75, 0x00, 0xb6, 0x00, 0x21, 0x0c, 0x00, 0x00, 0x7a, 0x05, 0x2c, 0xe8,
+  0x7d, 0x00, 0xb7, 0x00, 0x2a, 0x0c, 0x00, 0x00, 0x2b, 0x07, 0xa3, 0xe6, 0xed, 0x00, 0xb8, 0x00,
+  0x34, 0x0c, 0x00, 0x00, 0x23, 0x05, 0x15, 0xe8, 0xea, 0x00, 0xb9, 0x00, 0x3f, 0x0c, 0x00, 0x00,
+  0xce, 0xeb, 0x67, 0xe9, 0x46, 0x00, 0x2b, 0x01, 0x47, 0x0c, 0x00, 0x00, 0x2d, 0x17, 0x0d, 0x07,
+  0xc2, 0x00, 0x65, 0x01, 0x51, 0x0c, 0x00, 0x00, 0xa4, 0x13, 0xe1, 0xd5, 0x24, 0x00, 0xba, 0x00,
+  0x5f, 0x0c, 0x00, 0x00, 0xc5, 0xf2, 0x12, 0x3b, 0x0c, 0x00, 0x36, 0x01, 0x66, 0x0c, 0x00, 0x00,
+  0x0b, 0xe5, 0x77, 0x0f, 0x08, 0x00, 0xcc, 0x00, 0x6c, 0x0c, 0x00, 0x00, 0x27, 0xf9, 0x93, 0xc5,
+  0xac, 0x00, 0x9d, 0x01, 0x73, 0x0c, 0x00, 0x00, 0xc9, 0x09, 0x76, 0x2f, 0xe1, 0x00, 0x12, 0x01,
+  0x7a, 0x0c, 0x00, 0x00, 0x36, 0x17, 0xab, 0x09, 0x3e, 0x00, 0x66, 0x01, 0x82, 0x0c, 0x00, 0x00,
+  0x8e, 0x00, 0x94, 0x43, 0x73, 0x00, 0x9e, 0x01, 0x89, 0x0c, 0x00, 0x00, 0x25, 0x10, 0x12, 0x1b,
+  0xe8, 0x00, 0x13, 0x01, 0x92, 0x0c, 0x00, 0x00, 0x4c, 0x10, 0x82, 0x11, 0x4d, 0x00, 0x14, 0x01,
+  0x9a, 0x0c, 0x00, 0x00, 0x82, 0x05, 0xee, 0xdd, 0x5e, 0x00, 0xbb, 0x00, 0xa6, 0x0c, 0x00, 0x00,
+  0xef, 0x0d, 0x17, 0x14, 0x69, 0x00, 0x15, 0x01, 0xad, 0x0c, 0x00, 0x00, 0xd3, 0x0e, 0x1c, 0xde,
+  0xe6, 0x00, 0x79, 0x00, 0xb7, 0x0c, 0x00, 0x00, 0xbb, 0x0a, 0x05, 0x23, 0x20, 0x00, 0x16, 0x01,
+  0xbf, 0x0c, 0x00, 0x00, 0xe9, 0x1d, 0x22, 0xe5, 0x52, 0x00, 0xbc, 0x00, 0xc5, 0x0c, 0x00, 0x00,
+  0xb5, 0x0c, 0x4a, 0xd2, 0x9a, 0x00, 0xbd, 0x00, 0xcd, 0x0c, 0x00, 0x00, 0x25, 0x10, 0xbf, 0x07,
+  0x05, 0x00, 0x67, 0x01, 0xd4, 0x0c, 0x00, 0x00, 0xed, 0x0d, 0x96, 0x36, 0x6f, 0x00, 0x17, 0x01,
+  0xda, 0x0c, 0x00, 0x00, 0x12, 0x16, 0x31, 0x21, 0xbc, 0x00, 0x18, 0x01, 0xe0, 0x0c, 0x00, 0x00,
+  0xbf, 0xf7, 0x90, 0xbb, 0xdd, 0x00, 0x9f, 0x01, 0xea, 0x0c, 0x00, 0x00, 0x0d, 0x11, 0xfe, 0xe0,
+  0x24, 0x00, 0xbe, 0x00, 0xf2, 0x0c, 0x00, 0x00, 0x35, 0x07, 0xc2, 0xe6, 0xec, 0x00, 0xbf, 0x00,
+  0xfa, 0x0c, 0x00, 0x00, 0xda, 0x0c, 0x26, 0x05, 0x85, 0x00, 0x31, 0x00, 0x02, 0x0d, 0x00, 0x00,
+  0xdf, 0xe3, 0xfd, 0x00, 0x08, 0x00, 0xcd, 0x00, 0x08, 0x0d, 0x00, 0x00, 0x86, 0xf5, 0x86, 0xe6,
+  0x09, 0x00, 0x43, 0x00, 0x10, 0x0d, 0x00, 0x00, 0x60, 0x0e, 0xfa, 0x03, 0xdc, 0x00, 0x32, 0x00,
+  0x16, 0x0d, 0x00, 0x00, 0xb8, 0x12, 0xc0, 0x29, 0x90, 0x00, 0x19, 0x01, 0x22, 0x0d, 0x00, 0x00,
+  0x39, 0x15, 0xe8, 0x12, 0xbc, 0x00, 0x68, 0x01, 0x2c, 0x0d, 0x00, 0x00, 0x1c, 0x11, 0x36, 0x22,
+  0x2e, 0x00, 0x1a, 0x01, 0x33, 0x0d, 0x00, 0x00, 0x98, 0xea, 0x52, 0xe5, 0x09, 0x00, 0x44, 0x00,
+  0x3b, 0x0d, 0x00, 0x00, 0x38, 0x19, 0xf3, 0x37, 0xbc, 0x00, 0x1b, 0x01, 0x44, 0x0d, 0x00, 0x00,
+  0x6b, 0x12, 0xb8, 0x03, 0x7e, 0x00, 0x69, 0x01, 0x4a, 0x0d, 0x00, 0x00, 0x3f, 0x13, 0xe8, 0xcf,
+  0x24, 0x00, 0xc0, 0x00, 0x54, 0x0d, 0x00, 0x00, 0x5e, 0x10, 0xdd, 0x04, 0xe9, 0x00, 0x6a, 0x01,
+  0x5c, 0x0d, 0x00, 0x00, 0x23, 0x0f, 0xc5, 0xde, 0xe6, 0x00, 0x7a, 0x00, 0x62, 0x0d, 0x00, 0x00,
+  0xd6, 0x12, 0x61, 0x06, 0x0b, 0x00, 0x6b, 0x01, 0x69, 0x0d, 0x00, 0x00, 0x05, 0x07, 0x14, 0x28,
+  0x7b, 0x00, 0x1c, 0x01, 0x73, 0x0d, 0x00, 0x00, 0x5c, 0x15, 0xe4, 0x09, 0x82, 0x00, 0x6c, 0x01,
+  0x7b, 0x0d, 0x00, 0x00, 0x1c, 0x0f, 0xcf, 0xdd, 0xe6, 0x00, 0x7b, 0x00, 0x85, 0x0d, 0x00, 0x00,
+  0xdd, 0x10, 0x89, 0x33, 0xbc, 0x00, 0x1d, 0x01, 0x91, 0x0d, 0x00, 0x00, 0x09, 0x13, 0x5a, 0x11,
+  0xbc, 0x00, 0x6d, 0x01, 0x9b, 0x0d, 0x00, 0x00, 0x60, 0xe1, 0xc2, 0x29, 0x08, 0x00, 0xce, 0x00,
+  0xa2, 0x0d, 0x00, 0x00, 0x88, 0x07, 0x16, 0x41, 0xe5, 0x00, 0xa0, 0x01, 0xa7, 0x0d, 0x00, 0x00,
+  0xce, 0xfa, 0x2f, 0xbb, 0xf0, 0x00, 0xa1, 0x01, 0xae, 0x0d, 0x00, 0x00, 0x69, 0x14, 0x34, 0x08,
+  0xb0, 0x00, 0x6e, 0x01, 0xb5, 0x0d, 0x00, 0x00, 0xb8, 0x17, 0x3f, 0xcb, 0x24, 0x00, 0xc1, 0x00,
+  0xc0, 0x0d, 0x00, 0x00, 0x09, 0x10, 0x2c, 0xde, 0xe6, 0x00, 0x7c, 0x00, 0xc8, 0x0d, 0x00, 0x00,
+  0x2f, 0xf7, 0xae, 0x06, 0x9d, 0x00, 0x33, 0x00, 0xd1, 0x0d, 0x00, 0x00, 0x7c, 0x13, 0x0d, 0xda,
+  0x24, 0x00, 0xc2, 0x00, 0xda, 0x0d, 0x00, 0x00, 0x43, 0x17, 0x6b, 0xc9, 0xe6, 0x00, 0xc3, 0x00,
+  0xe2, 0x0d, 0x00, 0x00, 0x38, 0x18, 0xa7, 0x32, 0xbc, 0x00, 0x1e, 0x01, 0xea, 0x0d, 0x00, 0x00,
+  0x8e, 0x06, 0x91, 0x25, 0x8f, 0x00, 0x1f, 0x01, 0xf1, 0x0d, 0x00, 0x00, 0x35, 0x16, 0xac, 0x17,
+  0xbc, 0x00, 0x20, 0x01, 0xff, 0x0d, 0x00, 0x00, 0xb2, 0x0f, 0x62, 0x11, 0x06, 0x00, 0x21, 0x01,
+  0x07, 0x0e, 0x00, 0x00, 0xe4, 0x11, 0x3d, 0x06, 0x5f, 0x00, 0x6f, 0x01, 0x0e, 0x0e, 0x00, 0x00,
+  0x82, 0x12, 0x55, 0x03, 0x29, 0x00, 0x70, 0x01, 0x41, 0x44, 0x5d, 0x00, 0x00, 0x00, 0x41, 0x45,
+  0x15, 0x0e, 0x00, 0x00, 0x41, 0x46, 0x2a, 0x0e, 0x00, 0x00, 0x41, 0x47, 0x36, 0x0e, 0x00, 0x00,
+  0x41, 0x49, 0x65, 0x00, 0x00, 0x00, 0x41, 0x4c, 0x48, 0x0e, 0x00, 0x00, 0x41, 0x4d, 0x50, 0x0e,
+  0x00, 0x00, 0x41, 0x4f, 0x58, 0x0e, 0x00, 0x00, 0x41, 0x51, 0x5f, 0x0e, 0x00, 0x00, 0x41, 0x52,
+  0x6a, 0x0e, 0x00, 0x00, 0x41, 0x53, 0x74, 0x0e, 0x00, 0x00, 0x41, 0x54, 0x85, 0x0e, 0x00, 0x00,
+  0x41, 0x55, 0x8d, 0x0e, 0x00, 0x00, 0x41, 0x57, 0x9f, 0x00, 0x00, 0x00, 0x41, 0x58, 0x97, 0x0e,
+  0x00, 0x00, 0x41, 0x5a, 0xa5, 0x0e, 0x00, 0x00, 0x42, 0x41, 0xb0, 0x0e, 0x00, 0x00, 0x42, 0x42,
+  0x36, 0x01, 0x00, 0x00, 0x42, 0x44, 0xc5, 0x0e, 0x00, 0x00, 0x42, 0x45, 0xd0, 0x0e, 0x00, 0x00,
+  0x42, 0x46, 0xd8, 0x0e, 0x00, 0x00, 0x42, 0x47, 0xe5, 0x0e, 0x00, 0x00, 0x42, 0x48, 0x0c, 0x01,
+  0x00, 0x00, 0x42, 0x49, 0xee, 0x0e, 0x00, 0x00, 0x42, 0x4a, 0xf6, 0x0e, 0x00, 0x00, 0x42, 0x4c,
+  0xf7, 0x0b, 0x00, 0x00, 0x42, 0x4d, 0x6b, 0x01, 0x00, 0x00, 0x42, 0x4e, 0xef, 0x01, 0x00, 0x00,
+  0x42, 0x4f, 0xfc, 0x0e, 0x00, 0x00, 0x42, 0x51, 0x04, 0x0f, 0x00, 0x00, 0x42, 0x52, 0x11, 0x0f,
+  0x00, 0x00, 0x42, 0x53, 0x18, 0x0f, 0x00, 0x00, 0x42, 0x54, 0x20, 0x0f, 0x00, 0x00, 0x42, 0x57,
+  0x27, 0x0f, 0x00, 0x00, 0x42, 0x59, 0x30, 0x0f, 0x00, 0x00, 0x42, 0x5a, 0x5d, 0x01, 0x00, 0x00,
+  0x43, 0x41, 0x38, 0x0f, 0x00, 0x00, 0x43, 0x43, 0x3f, 0x0f, 0x00, 0x00, 0x43, 0x44, 0x57, 0x0f,
+  0x00, 0x00, 0x43, 0x46, 0x69, 0x0f, 0x00, 0x00, 0x43, 0x47, 0x7e, 0x0f, 0x00, 0x00, 0x43, 0x48,
+  0x8b, 0x0f, 0x00, 0x00, 0x43, 0x49, 0x97, 0x0f, 0x00, 0x00, 0x43, 0x4b, 0xa5, 0x0f, 0x00, 0x00,
+  0x43, 0x4c, 0xb2, 0x0f, 0x00, 0x00, 0x43, 0x4d, 0xb8, 0x0f, 0x00, 0x00, 0x43, 0x4e, 0xc1, 0x0f,
+  0x00, 0x00, 0x43, 0x4f, 0xc7, 0x0f, 0x00, 0x00, 0x43, 0x52, 0x29, 0x03, 0x00, 0x00, 0x43, 0x55,
+  0xd0, 0x0f, 0x00, 0x00, 0x43, 0x56, 0x61, 0x02, 0x00, 0x00, 0x43, 0x57, 0xd5, 0x0f, 0x00, 0x00,
+  0x43, 0x58, 0xdd, 0x0f, 0x00, 0x00, 0x43, 0x59, 0xee, 0x0f, 0x00, 0x00, 0x43, 0x5a, 0xf5, 0x0f,
+  0x00, 0x00, 0x44, 0x45, 0x04, 0x10, 0x00, 0x00, 0x44, 0x4a, 0xba, 0x03, 0x00, 0x00, 0x44, 0x4b,
+  0x0c, 0x10, 0x00, 0x00, 0x44, 0x4d, 0xc3, 0x03, 0x00, 0x00, 0x44, 0x4f, 0x14, 0x10, 0x00, 0x00,
+  0x44, 0x5a, 0x27, 0x10, 0x00, 0x00, 0x45, 0x43, 0x2f, 0x10, 0x00, 0x00, 0x45, 0x45, 0x37, 0x10,
+  0x00, 0x00, 0x45, 0x47, 0x3f, 0x10, 0x00, 0x00, 0x45, 0x48, 0x45, 0x10, 0x00, 0x00, 0x45, 0x52,
+  0x54, 0x10, 0x00, 0x00, 0x45, 0x53, 0x5c, 0x10, 0x00, 0x00, 0x45, 0x54, 0x62, 0x10, 0x00, 0x00,
+  0x46, 0x49, 0x6b, 0x10, 0x00, 0x00, 0x46, 0x4a, 0x4a, 0x04, 0x00, 0x00, 0x46, 0x4b, 0x73, 0x10,
+  0x00, 0x00, 0x46, 0x4d, 0x84, 0x10, 0x00, 0x00, 0x46, 0x4f, 0x8f, 0x10, 0x00, 0x00, 0x46, 0x52,
+  0x9d, 0x10, 0x00, 0x00, 0x47, 0x41, 0xa4, 0x10, 0x00, 0x00, 0x47, 0x42, 0xaa, 0x10, 0x00, 0x00,
+  0x47, 0x44, 0xc0, 0x04, 0x00, 0x00, 0x47, 0x45, 0xb7, 0x10, 0x00, 0x00, 0x47, 0x46, 0xbf, 0x10,
+  0x00, 0x00, 0x47, 0x47, 0xf8, 0x04, 0x00, 0x00, 0x47, 0x48, 0xcd, 0x10, 0x00, 0x00, 0x47, 0x49,
+  0x97, 0x04, 0x00, 0x00, 0x47, 0x4c, 0xd3, 0x10, 0x00, 0x00, 0x47, 0x4d, 0xdd, 0x10, 0x00, 0x00,
+  0x47, 0x4e, 0xe4, 0x10, 0x00, 0x00, 0x47, 0x50, 0xd4, 0x04, 0x00, 0x00, 0x47, 0x51, 0xeb, 0x10,
+  0x00, 0x00, 0x47, 0x52, 0xfd, 0x10, 0x00, 0x00, 0x47, 0x53, 0x04, 0x11, 0x00, 0x00, 0x47, 0x54,
+  0xe4, 0x04, 0x00, 0x00, 0x47, 0x55, 0xdf, 0x04, 0x00, 0x00, 0x47, 0x57, 0x2f, 0x11, 0x00, 0x00,
+  0x47, 0x59, 0x01, 0x05, 0x00, 0x00, 0x48, 0x4b, 0x4c, 0x05, 0x00, 0x00, 0x48, 0x4e, 0x3d, 0x11,
+  0x00, 0x00, 0x48, 0x52, 0x46, 0x11, 0x00, 0x00, 0x48, 0x54, 0x4e, 0x11, 0x00, 0x00, 0x48, 0x55,
+  0x54, 0x11, 0x00, 0x00, 0x49, 0x44, 0x5c, 0x11, 0x00, 0x00, 0x49, 0x45, 0x66, 0x11, 0x00, 0x00,
+  0x49, 0x4c, 0x6e, 0x11, 0x00, 0x00, 0x49, 0x4d, 0x88, 0x05, 0x00, 0x00, 0x49, 0x4e, 0x75, 0x11,
+  0x00, 0x00, 0x49, 0x4f, 0x7b, 0x11, 0x00, 0x00, 0x49, 0x51, 0x9a, 0x11, 0x00, 0x00, 0x49, 0x52,
+  0x9f, 0x11, 0x00, 0x00, 0x49, 0x53, 0xa4, 0x11, 0x00, 0x00, 0x49, 0x54, 0xac, 0x11, 0x00, 0x00,
+  0x4a, 0x45, 0xb6, 0x05, 0x00, 0x00, 0x4a, 0x4d, 0xa5, 0x05, 0x00, 0x00, 0x4a, 0x4f, 0xb2, 0x11,
+  0x00, 0x00, 0x4a, 0x50, 0xb9, 0x11, 0x00, 0x00, 0x4b, 0x45, 0xbf, 0x11, 0x00, 0x00, 0x4b, 0x47,
+  0xc5, 0x11, 0x00, 0x00, 0x4b, 0x48, 0xd0, 0x11, 0x00, 0x00, 0x4b, 0x49, 0xd9, 0x11, 0x00, 0x00,
+  0x4b, 0x4d, 0xe2, 0x11, 0x00, 0x00, 0x4b, 0x4e, 0xea, 0x11, 0x00, 0x00, 0x4b, 0x50, 0xfb, 0x11,
+  0x00, 0x00, 0x4b, 0x52, 0x09, 0x12, 0x00, 0x00, 0x4b, 0x57, 0xa0, 0x06, 0x00, 0x00, 0x4b, 0x59,
+  0x17, 0x12, 0x00, 0x00, 0x4b, 0x5a, 0x26, 0x12, 0x00, 0x00, 0x4c, 0x41, 0x31, 0x12, 0x00, 0x00,
+  0x4c, 0x42, 0x36, 0x12, 0x00, 0x00, 0x4c, 0x43, 0x21, 0x0c, 0x00, 0x00, 0x4c, 0x49, 0x3e, 0x12,
+  0x00, 0x00, 0x4c, 0x4b, 0x4c, 0x12, 0x00, 0x00, 0x4c, 0x52, 0x56, 0x12, 0x00, 0x00, 0x4c, 0x53,
+  0x5e, 0x12, 0x00, 0x00, 0x4c, 0x54, 0x66, 0x12, 0x00, 0x00, 0x4c, 0x55, 0x57, 0x07, 0x00, 0x00,
+  0x4c, 0x56, 0x70, 0x12, 0x00, 0x00, 0x4c, 0x59, 0x77, 0x12, 0x00, 0x00, 0x4d, 0x41, 0x7d, 0x12,
+  0x00, 0x00, 0x4d, 0x43, 0xa4, 0x08, 0x00, 0x00, 0x4d, 0x44, 0x85, 0x12, 0x00, 0x00, 0x4d, 0x45,
+  0x8d, 0x12, 0x00, 0x00, 0x4d, 0x46, 0x98, 0x12, 0x00, 0x00, 0x4d, 0x47, 0xab, 0x12, 0x00, 0x00,
+  0x4d, 0x48, 0xb6, 0x12, 0x00, 0x00, 0x4d, 0x4b, 0xc7, 0x12, 0x00, 0x00, 0x4d, 0x4c, 0xd7, 0x12,
+  0x00, 0x00, 0x4d, 0x4d, 0xdc, 0x12, 0x00, 0x00, 0x4d, 0x4e, 0xec, 0x12, 0x00, 0x00, 0x4d, 0x4f,
+  0x62, 0x07, 0x00, 0x00, 0x4d, 0x50, 0xf5, 0x12, 0x00, 0x00, 0x4d, 0x51, 0xfc, 0x07, 0x00, 0x00,
+  0x4d, 0x52, 0x0e, 0x13, 0x00, 0x00, 0x4d, 0x53, 0xdc, 0x08, 0x00, 0x00, 0x4d, 0x54, 0xb5, 0x07,
+  0x00, 0x00, 0x4d, 0x55, 0x18, 0x08, 0x00, 0x00, 0x4d, 0x56, 0xac, 0x07, 0x00, 0x00, 0x4d, 0x57,
+  0x19, 0x13, 0x00, 0x00, 0x4d, 0x58, 0x20, 0x13, 0x00, 0x00, 0x4d, 0x59, 0x27, 0x13, 0x00, 0x00,
+  0x4d, 0x5a, 0x30, 0x13, 0x00, 0x00, 0x4e, 0x41, 0x3b, 0x13, 0x00, 0x00, 0x4e, 0x43, 0x43, 0x13,
+  0x00, 0x00, 0x4e, 0x45, 0x51, 0x13, 0x00, 0x00, 0x4e, 0x46, 0x57, 0x13, 0x00, 0x00, 0x4e, 0x47,
+  0x66, 0x13, 0x00, 0x00, 0x4e, 0x49, 0x6e, 0x13, 0x00, 0x00, 0x4e, 0x4c, 0x78, 0x13, 0x00, 0x00,
+  0x4e, 0x4f, 0x84, 0x13, 0x00, 0x00, 0x4e, 0x50, 0x8b, 0x13, 0x00, 0x00, 0x4e, 0x52, 0x04, 0x09,
+  0x00, 0x00, 0x4e, 0x55, 0x35, 0x09, 0x00, 0x00, 0x4e, 0x5a, 0x91, 0x13, 0x00, 0x00, 0x4f, 0x4d,
+  0x9d, 0x13, 0x00, 0x00, 0x50, 0x41, 0xb9, 0x09, 0x00, 0x00, 0x50, 0x45, 0xa2, 0x13, 0x00, 0x00,
+  0x50, 0x46, 0xa7, 0x13, 0x00, 0x00, 0x50, 0x47, 0xb8, 0x13, 0x00, 0x00, 0x50, 0x48, 0xc9, 0x13,
+  0x00, 0x00, 0x50, 0x4b, 0xd5, 0x13, 0x00, 0x00, 0x50, 0x4c, 0xde, 0x13, 0x00, 0x00, 0x50, 0x4d,
+  0xe5, 0x13, 0x00, 0x00, 0x50, 0x4e, 0xf5, 0x09, 0x00, 0x00, 0x50, 0x52, 0x62, 0x0a, 0x00, 0x00,
+  0x50, 0x53, 0xfa, 0x13, 0x00, 0x00, 0x50, 0x54, 0x04, 0x14, 0x00, 0x00, 0x50, 0x57, 0xac, 0x09,
+  0x00, 0x00, 0x50, 0x59, 0x0d, 0x14, 0x00, 0x00, 0x51, 0x41, 0x85, 0x0a, 0x00, 0x00, 0x52, 0x45,
+  0x16, 0x14, 0x00, 0x00, 0x52, 0x4f, 0x1e, 0x14, 0x00, 0x00, 0x52, 0x53, 0x26, 0x14, 0x00, 0x00,
+  0x52, 0x55, 0x2d, 0x14, 0x00, 0x00, 0x52, 0x57, 0x34, 0x14, 0x00, 0x00, 0x53, 0x41, 0x3b, 0x14,
+  0x00, 0x00, 0x53, 0x42, 0x48, 0x14, 0x00, 0x00, 0x53, 0x43, 0x58, 0x14, 0x00, 0x00, 0x53, 0x44,
+  0x63, 0x14, 0x00, 0x00, 0x53, 0x45, 0x69, 0x14, 0x00, 0x00, 0x53, 0x47, 0xbe, 0x0b, 0x00, 0x00,
+  0x53, 0x48, 0x05, 0x0c, 0x00, 0x00, 0x53, 0x49, 0x70, 0x14, 0x00, 0x00, 0x53, 0x4a, 0x79, 0x14,
+  0x00, 0x00, 0x53, 0x4b, 0x8e, 0x14, 0x00, 0x00, 0x53, 0x4c, 0x97, 0x14, 0x00, 0x00, 0x53, 0x4d,
+  0x48, 0x0b, 0x00, 0x00, 0x53, 0x4e, 0xa4, 0x14, 0x00, 0x00, 0x53, 0x4f, 0xac, 0x14, 0x00, 0x00,
+  0x53, 0x52, 0xb4, 0x14, 0x00, 0x00, 0x53, 0x53, 0xbd, 0x14, 0x00, 0x00, 0x53, 0x54, 0xc9, 0x14,
+  0x00, 0x00, 0x53, 0x56, 0x20, 0x04, 0x00, 0x00, 0x53, 0x58, 0xdd, 0x14, 0x00, 0x00, 0x53, 0x59,
+  0xf0, 0x14, 0x00, 0x00, 0x53, 0x5a, 0xf6, 0x14, 0x00, 0x00, 0x54, 0x43, 0x0b, 0x15, 0x00, 0x00,
+  0x54, 0x44, 0x1d, 0x15, 0x00, 0x00, 0x54, 0x46, 0x22, 0x15, 0x00, 0x00, 0x54, 0x47, 0x32, 0x15,
+  0x00, 0x00, 0x54, 0x48, 0x37, 0x15, 0x00, 0x00, 0x54, 0x4a, 0x40, 0x15, 0x00, 0x00, 0x54, 0x4b,
+  0x4b, 0x15, 0x00, 0x00, 0x54, 0x4c, 0x53, 0x15, 0x00, 0x00, 0x54, 0x4d, 0x5e, 0x15, 0x00, 0x00,
+  0x54, 0x4e, 0x6b, 0x15, 0x00, 0x00, 0x54, 0x4f, 0x73, 0x15, 0x00, 0x00, 0x54, 0x52, 0x79, 0x15,
+  0x00, 0x00, 0x54, 0x54, 0x80, 0x15, 0x00, 0x00, 0x54, 0x56, 0x92, 0x15, 0x00, 0x00, 0x54, 0x57,
+  0x99, 0x15, 0x00, 0x00, 0x54, 0x5a, 0xa0, 0x15, 0x00, 0x00, 0x55, 0x41, 0xa9, 0x15, 0x00, 0x00,
+  0x55, 0x47, 0xb1, 0x15, 0x00, 0x00, 0x55, 0x4d, 0xb8, 0x15, 0x00, 0x00, 0x55, 0x53, 0xd2, 0x15,
+  0x00, 0x00, 0x55, 0x59, 0xe0, 0x15, 0x00, 0x00, 0x55, 0x5a, 0xe8, 0x15, 0x00, 0x00, 0x56, 0x41,
+  0xf3, 0x15, 0x00, 0x00, 0x56, 0x43, 0x34, 0x0c, 0x00, 0x00, 0x56, 0x45, 0x00, 0x16, 0x00, 0x00,
+  0x56, 0x47, 0x0a, 0x16, 0x00, 0x00, 0x56, 0x49, 0x1e, 0x16, 0x00, 0x00, 0x56, 0x4e, 0x32, 0x16,
+  0x00, 0x00, 0x56, 0x55, 0x3a, 0x16, 0x00, 0x00, 0x57, 0x46, 0x42, 0x16, 0x00, 0x00, 0x57, 0x53,
+  0x52, 0x16, 0x00, 0x00, 0x59, 0x45, 0x62, 0x16, 0x00, 0x00, 0x59, 0x54, 0x29, 0x08, 0x00, 0x00,
+  0x5a, 0x41, 0x68, 0x16, 0x00, 0x00, 0x5a, 0x4d, 0x75, 0x16, 0x00, 0x00, 0x5a, 0x57, 0x7c, 0x16,
+  0x00, 0x00, 0x85, 0x16, 0x00, 0x00, 0x94, 0x16, 0x00, 0x00, 0xa1, 0x16, 0x00, 0x00, 0xb4, 0x16,
+  0x00, 0x00, 0xc3, 0x16, 0x00, 0x00, 0xd1, 0x16, 0x00, 0x00, 0xdf, 0x16, 0x00, 0x00, 0xed, 0x16,
+  0x00, 0x00, 0xfb, 0x16, 0x00, 0x00, 0x09, 0x17, 0x00, 0x00, 0x19, 0x17, 0x00, 0x00, 0x2c, 0x17,
+  0x00, 0x00, 0x3d, 0x17, 0x00, 0x00, 0x4a, 0x17, 0x00, 0x00, 0x5c, 0x17, 0x00, 0x00, 0x69, 0x17,
+  0x00, 0x00, 0x78, 0x17, 0x00, 0x00, 0x85, 0x17, 0x00, 0x00, 0x9a, 0x17, 0x00, 0x00, 0xaa, 0x17,
+  0x00, 0x00, 0xb8, 0x17, 0x00, 0x00, 0xc8, 0x17, 0x00, 0x00, 0xd8, 0x17, 0x00, 0x00, 0xe8, 0x17,
+  0x00, 0x00, 0xf6, 0x17, 0x00, 0x00, 0x0a, 0x18, 0x00, 0x00, 0x16, 0x18, 0x00, 0x00, 0x25, 0x18,
+  0x00, 0x00, 0x35, 0x18, 0x00, 0x00, 0x43, 0x18, 0x00, 0x00, 0x53, 0x18, 0x00, 0x00, 0x60, 0x18,
+  0x00, 0x00, 0x72, 0x18, 0x00, 0x00, 0x7e, 0x18, 0x00, 0x00, 0x8c, 0x18, 0x00, 0x00, 0x9e, 0x18,
+  0x00, 0x00, 0xac, 0x18, 0x00, 0x00, 0xba, 0x18, 0x00, 0x00, 0xc8, 0x18, 0x00, 0x00, 0xd6, 0x18,
+  0x00, 0x00, 0xe5, 0x18, 0x00, 0x00, 0xf6, 0x18, 0x00, 0x00, 0x06, 0x19, 0x00, 0x00, 0x15, 0x19,
+  0x00, 0x00, 0x25, 0x19, 0x00, 0x00, 0x33, 0x19, 0x00, 0x00, 0x45, 0x19, 0x00, 0x00, 0x58, 0x19,
+  0x00, 0x00, 0x6a, 0x19, 0x00, 0x00, 0x7a, 0x19, 0x00, 0x00, 0x89, 0x19, 0x00, 0x00, 0x96, 0x19,
+  0x00, 0x00, 0xa6, 0x19, 0x00, 0x00, 0xb3, 0x19, 0x00, 0x00, 0xc5, 0x19, 0x00, 0x00, 0xd6, 0x19,
+  0x00, 0x00, 0xe6, 0x19, 0x00, 0x00, 0xf8, 0x19, 0x00, 0x00, 0x17, 0x1a, 0x00, 0x00, 0x33, 0x1a,
+  0x00, 0x00, 0x4d, 0x1a, 0x00, 0x00, 0x65, 0x1a, 0x00, 0x00, 0x80, 0x1a, 0x00, 0x00, 0x9a, 0x1a,
+  0x00, 0x00, 0xb9, 0x1a, 0x00, 0x00, 0xd1, 0x1a, 0x00, 0x00, 0xec, 0x1a, 0x00, 0x00, 0x07, 0x1b,
+  0x00, 0x00, 0x21, 0x1b, 0x00, 0x00, 0x3b, 0x1b, 0x00, 0x00, 0x49, 0x1b, 0x00, 0x00, 0x5a, 0x1b,
+  0x00, 0x00, 0x6b, 0x1b, 0x00, 0x00, 0x79, 0x1b, 0x00, 0x00, 0x90, 0x1b, 0x00, 0x00, 0xa1, 0x1b,
+  0x00, 0x00, 0xaf, 0x1b, 0x00, 0x00, 0xbe, 0x1b, 0x00, 0x00, 0xd3, 0x1b, 0x00, 0x00, 0xe5, 0x1b,
+  0x00, 0x00, 0xf4, 0x1b, 0x00, 0x00, 0x02, 0x1c, 0x00, 0x00, 0x18, 0x1c, 0x00, 0x00, 0x2d, 0x1c,
+  0x00, 0x00, 0x3c, 0x1c, 0x00, 0x00, 0x4c, 0x1c, 0x00, 0x00, 0x5c, 0x1c, 0x00, 0x00, 0x6b, 0x1c,
+  0x00, 0x00, 0x7b, 0x1c, 0x00, 0x00, 0x8d, 0x1c, 0x00, 0x00, 0xa3, 0x1c, 0x00, 0x00, 0xb6, 0x1c,
+  0x00, 0x00, 0xc8, 0x1c, 0x00, 0x00, 0xd8, 0x1c, 0x00, 0x00, 0xe7, 0x1c, 0x00, 0x00, 0xf7, 0x1c,
+  0x00, 0x00, 0x0c, 0x1d, 0x00, 0x00, 0x1b, 0x1d, 0x00, 0x00, 0x30, 0x1d, 0x00, 0x00, 0x3f, 0x1d,
+  0x00, 0x00, 0x4f, 0x1d, 0x00, 0x00, 0x60, 0x1d, 0x00, 0x00, 0x71, 0x1d, 0x00, 0x00, 0x82, 0x1d,
+  0x00, 0x00, 0x96, 0x1d, 0x00, 0x00, 0xaa, 0x1d, 0x00, 0x00, 0xbc, 0x1d, 0x00, 0x00, 0xce, 0x1d,
+  0x00, 0x00, 0xe0, 0x1d, 0x00, 0x00, 0xf3, 0x1d, 0x00, 0x00, 0x03, 0x1e, 0x00, 0x00, 0x16, 0x1e,
+  0x00, 0x00, 0x28, 0x1e, 0x00, 0x00, 0x3a, 0x1e, 0x00, 0x00, 0x49, 0x1e, 0x00, 0x00, 0x59, 0x1e,
+  0x00, 0x00, 0x68, 0x1e, 0x00, 0x00, 0x7b, 0x1e, 0x00, 0x00, 0x98, 0x1e, 0x00, 0x00, 0xad, 0x1e,
+  0x00, 0x00, 0xc5, 0x1e, 0x00, 0x00, 0xe0, 0x1e, 0x00, 0x00, 0xfa, 0x1e, 0x00, 0x00, 0x10, 0x1f,
+  0x00, 0x00, 0x2a, 0x1f, 0x00, 0x00, 0x42, 0x1f, 0x00, 0x00, 0x51, 0x1f, 0x00, 0x00, 0x61, 0x1f,
+  0x00, 0x00, 0x71, 0x1f, 0x00, 0x00, 0x80, 0x1f, 0x00, 0x00, 0x9c, 0x1f, 0x00, 0x00, 0xb8, 0x1f,
+  0x00, 0x00, 0xcb, 0x1f, 0x00, 0x00, 0xda, 0x1f, 0x00, 0x00, 0xe7, 0x1f, 0x00, 0x00, 0xfb, 0x1f,
+  0x00, 0x00, 0x11, 0x20, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x30, 0x20, 0x00, 0x00, 0x3f, 0x20,
+  0x00, 0x00, 0x4f, 0x20, 0x00, 0x00, 0x62, 0x20, 0x00, 0x00, 0x74, 0x20, 0x00, 0x00, 0x85, 0x20,
+  0x00, 0x00, 0x97, 0x20, 0x00, 0x00, 0xa6, 0x20, 0x00, 0x00, 0xb9, 0x20, 0x00, 0x00, 0xcd, 0x20,
+  0x00, 0x00, 0xde, 0x20, 0x00, 0x00, 0xee, 0x20, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x13, 0x21,
+  0x00, 0x00, 0x26, 0x21, 0x00, 0x00, 0x35, 0x21, 0x00, 0x00, 0x46, 0x21, 0x00, 0x00, 0x53, 0x21,
+  0x00, 0x00, 0x63, 0x21, 0x00, 0x00, 0x7f, 0x21, 0x00, 0x00, 0x9b, 0x21, 0x00, 0x00, 0xba, 0x21,
+  0x00, 0x00, 0xc7, 0x21, 0x00, 0x00, 0xd7, 0x21, 0x00, 0x00, 0xe6, 0x21, 0x00, 0x00, 0xf9, 0x21,
+  0x00, 0x00, 0x09, 0x22, 0x00, 0x00, 0x20, 0x22, 0x00, 0x00, 0x36, 0x22, 0x00, 0x00, 0x4a, 0x22,
+  0x00, 0x00, 0x5e, 0x22, 0x00, 0x00, 0x73, 0x22, 0x00, 0x00, 0x88, 0x22, 0x00, 0x00, 0x97, 0x22,
+  0x00, 0x00, 0xa6, 0x22, 0x00, 0x00, 0xb7, 0x22, 0x00, 0x00, 0xca, 0x22, 0x00, 0x00, 0xdb, 0x22,
+  0x00, 0x00, 0xec, 0x22, 0x00, 0x00, 0x02, 0x23, 0x00, 0x00, 0x14, 0x23, 0x00, 0x00, 0x29, 0x23,
+  0x00, 0x00, 0x37, 0x23, 0x00, 0x00, 0x4d, 0x23, 0x00, 0x00, 0x5e, 0x23, 0x00, 0x00, 0x6f, 0x23,
+  0x00, 0x00, 0x80, 0x23, 0x00, 0x00, 0x92, 0x23, 0x00, 0x00, 0xa5, 0x23, 0x00, 0x00, 0xbb, 0x23,
+  0x00, 0x00, 0xcf, 0x23, 0x00, 0x00, 0xdd, 0x23, 0x00, 0x00, 0xed, 0x23, 0x00, 0x00, 0xfd, 0x23,
+  0x00, 0x00, 0x0d, 0x24, 0x00, 0x00, 0x1f, 0x24, 0x00, 0x00, 0x32, 0x24, 0x00, 0x00, 0x43, 0x24,
+  0x00, 0x00, 0x53, 0x24, 0x00, 0x00, 0x64, 0x24, 0x00, 0x00, 0x75, 0x24, 0x00, 0x00, 0x8f, 0x24,
+  0x00, 0x00, 0xa4, 0x24, 0x00, 0x00, 0xb6, 0x24, 0x00, 0x00, 0xc9, 0x24, 0x00, 0x00, 0xdb, 0x24,
+  0x00, 0x00, 0xee, 0x24, 0x00, 0x00, 0xff, 0x24, 0x00, 0x00, 0x10, 0x25, 0x00, 0x00, 0x22, 0x25,
+  0x00, 0x00, 0x36, 0x25, 0x00, 0x00, 0x40, 0x25, 0x00, 0x00, 0x4c, 0x25, 0x00, 0x00, 0x57, 0x25,
+  0x00, 0x00, 0x63, 0x25, 0x00, 0x00, 0x6e, 0x25, 0x00, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x88, 0x25,
+  0x00, 0x00, 0x94, 0x25, 0x00, 0x00, 0xa1, 0x25, 0x00, 0x00, 0xae, 0x25, 0x00, 0x00, 0xb8, 0x25,
+  0x00, 0x00, 0xc5, 0x25, 0x00, 0x00, 0xd2, 0x25, 0x00, 0x00, 0xde, 0x25, 0x00, 0x00, 0xeb, 0x25,
+  0x00, 0x00, 0xf7, 0x25, 0x00, 0x00, 0x02, 0x26, 0x00, 0x00, 0x0f, 0x26, 0x00, 0x00, 0x1d, 0x26,
+  0x00, 0x00, 0x28, 0x26, 0x00, 0x00, 0x32, 0x26, 0x00, 0x00, 0x3d, 0x26, 0x00, 0x00, 0x4b, 0x26,
+  0x00, 0x00, 0x5a, 0x26, 0x00, 0x00, 0x64, 0x26, 0x00, 0x00, 0x70, 0x26, 0x00, 0x00, 0x81, 0x26,
+  0x00, 0x00, 0x90, 0x26, 0x00, 0x00, 0x9a, 0x26, 0x00, 0x00, 0xa7, 0x26, 0x00, 0x00, 0xb4, 0x26,
+  0x00, 0x00, 0xc2, 0x26, 0x00, 0x00, 0xd1, 0x26, 0x00, 0x00, 0xdc, 0x26, 0x00, 0x00, 0xeb, 0x26,
+  0x00, 0x00, 0xf8, 0x26, 0x00, 0x00, 0x07, 0x27, 0x00, 0x00, 0x15, 0x27, 0x00, 0x00, 0x22, 0x27,
+  0x00, 0x00, 0x33, 0x27, 0x00, 0x00, 0x45, 0x27, 0x00, 0x00, 0x52, 0x27, 0x00, 0x00, 0x5e, 0x27,
+  0x00, 0x00, 0x69, 0x27, 0x00, 0x00, 0x76, 0x27, 0x00, 0x00, 0x84, 0x27, 0x00, 0x00, 0x90, 0x27,
+  0x00, 0x00, 0x9c, 0x27, 0x00, 0x00, 0xa9, 0x27, 0x00, 0x00, 0xbb, 0x27, 0x00, 0x00, 0xcc, 0x27,
+  0x00, 0x00, 0xd6, 0x27, 0x00, 0x00, 0xe0, 0x27, 0x00, 0x00, 0xf0, 0x27, 0x00, 0x00, 0xff, 0x27,
+  0x00, 0x00, 0x0e, 0x28, 0x00, 0x00, 0x19, 0x28, 0x00, 0x00, 0x27, 0x28, 0x00, 0x00, 0x36, 0x28,
+  0x00, 0x00, 0x42, 0x28, 0x00, 0x00, 0x50, 0x28, 0x00, 0x00, 0x5f, 0x28, 0x00, 0x00, 0x6a, 0x28,
+  0x00, 0x00, 0x78, 0x28, 0x00, 0x00, 0x87, 0x28, 0x00, 0x00, 0x9a, 0x28, 0x00, 0x00, 0xa6, 0x28,
+  0x00, 0x00, 0xb4, 0x28, 0x00, 0x00, 0xc1, 0x28, 0x00, 0x00, 0xcd, 0x28, 0x00, 0x00, 0xda, 0x28,
+  0x00, 0x00, 0xe5, 0x28, 0x00, 0x00, 0xf0, 0x28, 0x00, 0x00, 0x01, 0x29, 0x00, 0x00, 0x0d, 0x29,
+  0x00, 0x00, 0x1b, 0x29, 0x00, 0x00, 0x2a, 0x29, 0x00, 0x00, 0x3b, 0x29, 0x00, 0x00, 0x48, 0x29,
+  0x00, 0x00, 0x54, 0x29, 0x00, 0x00, 0x67, 0x29, 0x00, 0x00, 0x74, 0x29, 0x00, 0x00, 0x84, 0x29,
+  0x00, 0x00, 0x95, 0x29, 0x00, 0x00, 0xa5, 0x29, 0x00, 0x00, 0xb9, 0x29, 0x00, 0x00, 0xc8, 0x29,
+  0x00, 0x00, 0xd9, 0x29, 0x00, 0x00, 0xec, 0x29, 0x00, 0x00, 0x03, 0x2a, 0x00, 0x00, 0x16, 0x2a,
+  0x00, 0x00, 0x27, 0x2a, 0x00, 0x00, 0x3a, 0x2a, 0x00, 0x00, 0x4d, 0x2a, 0x00, 0x00, 0x63, 0x2a,
+  0x00, 0x00, 0x74, 0x2a, 0x00, 0x00, 0x84, 0x2a, 0x00, 0x00, 0x95, 0x2a, 0x00, 0x00, 0xa8, 0x2a,
+  0x00, 0x00, 0xbc, 0x2a, 0x00, 0x00, 0xd0, 0x2a, 0x00, 0x00, 0xe0, 0x2a, 0x00, 0x00, 0xf1, 0x2a,
+  0x00, 0x00, 0x02, 0x2b, 0x00, 0x00, 0x11, 0x2b, 0x00, 0x00, 0x22, 0x2b, 0x00, 0x00, 0x30, 0x2b,
+  0x00, 0x00, 0x40, 0x2b, 0x00, 0x00, 0x4e, 0x2b, 0x00, 0x00, 0x60, 0x2b, 0x00, 0x00, 0x70, 0x2b,
+  0x00, 0x00, 0x81, 0x2b, 0x00, 0x00, 0x91, 0x2b, 0x00, 0x00, 0xa1, 0x2b, 0x00, 0x00, 0xb1, 0x2b,
+  0x00, 0x00, 0xc3, 0x2b, 0x00, 0x00, 0xd1, 0x2b, 0x00, 0x00, 0xe2, 0x2b, 0x00, 0x00, 0xf2, 0x2b,
+  0x00, 0x00, 0x02, 0x2c, 0x00, 0x00, 0x15, 0x2c, 0x00, 0x00, 0x25, 0x2c, 0x00, 0x00, 0x33, 0x2c,
+  0x00, 0x00, 0x46, 0x2c, 0x00, 0x00, 0x53, 0x2c, 0x00, 0x00, 0x5f, 0x2c, 0x00, 0x00, 0x6d, 0x2c,
+  0x00, 0x00, 0x7e, 0x2c, 0x00, 0x00, 0x8c, 0x2c, 0x00, 0x00, 0x9e, 0x2c, 0x00, 0x00, 0xac, 0x2c,
+  0x00, 0x00, 0xb9, 0x2c, 0x00, 0x00, 0xca, 0x2c, 0x00, 0x00, 0xd7, 0x2c, 0x00, 0x00, 0xe5, 0x2c,
+  0x00, 0x00, 0xf3, 0x2c, 0x00, 0x00, 0xff, 0x2c, 0x00, 0x00, 0x0c, 0x2d, 0x00, 0x00, 0x1d, 0x2d,
+  0x00, 0x00, 0x2b, 0x2d, 0x00, 0x00, 0x37, 0x2d, 0x00, 0x00, 0x43, 0x2d, 0x00, 0x00, 0x51, 0x2d,
+  0x00, 0x00, 0x63, 0x2d, 0x00, 0x00, 0x73, 0x2d, 0x00, 0x00, 0x82, 0x2d, 0x00, 0x00, 0x94, 0x2d,
+  0x00, 0x00, 0xa2, 0x2d, 0x00, 0x00, 0xaf, 0x2d, 0x00, 0x00, 0xc0, 0x2d, 0x00, 0x00, 0xcf, 0x2d,
+  0x00, 0x00, 0xdd, 0x2d, 0x00, 0x00, 0xee, 0x2d, 0x00, 0x00, 0xfb, 0x2d, 0x00, 0x00, 0x0a, 0x2e,
+  0x00, 0x00, 0x18, 0x2e, 0x00, 0x00, 0x27, 0x2e, 0x00, 0x00, 0x38, 0x2e, 0x00, 0x00, 0x46, 0x2e,
+  0x00, 0x00, 0x54, 0x2e, 0x00, 0x00, 0x62, 0x2e, 0x00, 0x00, 0x76, 0x2e, 0x00, 0x00, 0x84, 0x2e,
+  0x00, 0x00, 0x95, 0x2e, 0x00, 0x00, 0xa2, 0x2e, 0x00, 0x00, 0xb0, 0x2e, 0x00, 0x00, 0xc1, 0x2e,
+  0x00, 0x00, 0xcd, 0x2e, 0x00, 0x00, 0xdd, 0x2e, 0x00, 0x00, 0xee, 0x2e, 0x00, 0x00, 0xfd, 0x2e,
+  0x00, 0x00, 0x0c, 0x2f, 0x00, 0x00, 0x19, 0x2f, 0x00, 0x00, 0x2a, 0x2f, 0x00, 0x00, 0x3f, 0x2f,
+  0x00, 0x00, 0x4f, 0x2f, 0x00, 0x00, 0x5d, 0x2f, 0x00, 0x00, 0x6c, 0x2f, 0x00, 0x00, 0x7a, 0x2f,
+  0x00, 0x00, 0x8a, 0x2f, 0x00, 0x00, 0x97, 0x2f, 0x00, 0x00, 0xa8, 0x2f, 0x00, 0x00, 0xba, 0x2f,
+  0x00, 0x00, 0xca, 0x2f, 0x00, 0x00, 0xde, 0x2f, 0x00, 0x00, 0xeb, 0x2f, 0x00, 0x00, 0xfc, 0x2f,
+  0x00, 0x00, 0x0b, 0x30, 0x00, 0x00, 0x1e, 0x30, 0x00, 0x00, 0x2d, 0x30, 0x00, 0x00, 0x3f, 0x30,
+  0x00, 0x00, 0x4e, 0x30, 0x00, 0x00, 0x60, 0x30, 0x00, 0x00, 0x6f, 0x30, 0x00, 0x00, 0x7d, 0x30,
+  0x00, 0x00, 0x8a, 0x30, 0x00, 0x00, 0x9a, 0x30, 0x00, 0x00, 0xa9, 0x30, 0x00, 0x00, 0xbb, 0x30,
+  0x00, 0x00, 0xc9, 0x30, 0x00, 0x00, 0xda, 0x30, 0x00, 0x00, 0xea, 0x30, 0x00, 0x00, 0xff, 0x30,
+  0x00, 0x00, 0x11, 0x31, 0x00, 0x00, 0x20, 0x31, 0x00, 0x00, 0x2f, 0x31, 0x00, 0x00, 0x3e, 0x31,
+  0x00, 0x00, 0x50, 0x31, 0x00, 0x00, 0x5d, 0x31, 0x00, 0x00, 0x41, 0x62, 0x69, 0x64, 0x6a, 0x61,
+  0x6e, 0x00, 0x41, 0x63, 0x63, 0x72, 0x61, 0x00, 0x41, 0x64, 0x61, 0x6b, 0x00, 0x41, 0x64, 0x64,
+  0x69, 0x73, 0x20, 0x41, 0x62, 0x61, 0x62, 0x61, 0x00, 0x41, 0x64, 0x65, 0x6c, 0x61, 0x69, 0x64,
+  0x65, 0x00, 0x41, 0x64, 0x65, 0x6e, 0x00, 0x41, 0x6c, 0x67, 0x69, 0x65, 0x72, 0x73, 0x00, 0x41,
+  0x6c, 0x6d, 0x61, 0x74, 0x79, 0x00, 0x41, 0x6d, 0x6d, 0x61, 0x6e, 0x00, 0x41, 0x6d, 0x73, 0x74,
+  0x65, 0x72, 0x64, 0x61, 0x6d, 0x00, 0x41, 0x6e, 0x61, 0x64, 0x79, 0x72, 0x00, 0x41, 0x6e, 0x63,
+  0x68, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x00, 0x41, 0x6e, 0x64, 0x6f, 0x72, 0x72, 0x61, 0x00, 0x41,
+  0x6e, 0x67, 0x75, 0x69, 0x6c, 0x6c, 0x61, 0x00, 0x41, 0x6e, 0x74, 0x61, 0x6e, 0x61, 0x6e, 0x61,
+  0x72, 0x69, 0x76, 0x6f, 0x00, 0x41, 0x6e, 0x74, 0x69, 0x67, 0x75, 0x61, 0x00, 0x41, 0x70, 0x69,
+  0x61, 0x00, 0x41, 0x71, 0x74, 0x61, 0x75, 0x00, 0x41, 0x71, 0x74, 0x6f, 0x62, 0x65, 0x00, 0x41,
+  0x72, 0x61, 0x67, 0x75, 0x61, 0x69, 0x6e, 0x61, 0x00, 0x41, 0x72, 0x75, 0x62, 0x61, 0x00, 0x41,
+  0x73, 0x68, 0x67, 0x61, 0x62, 0x61, 0x74, 0x00, 0x41, 0x73, 0x6d, 0x61, 0x72, 0x61, 0x00, 0x41,
+  0x73, 0x74, 0x72, 0x61, 0x6b, 0x68, 0x61, 0x6e, 0x00, 0x41, 0x73, 0x75, 0x6e, 0x63, 0x69, 0x6f,
+  0x6e, 0x00, 0x41, 0x74, 0x68, 0x65, 0x6e, 0x73, 0x00, 0x41, 0x74, 0x69, 0x6b, 0x6f, 0x6b, 0x61,
+  0x6e, 0x00, 0x41, 0x74, 0x79, 0x72, 0x61, 0x75, 0x00, 0x41, 0x75, 0x63, 0x6b, 0x6c, 0x61, 0x6e,
+  0x64, 0x00, 0x41, 0x7a, 0x6f, 0x72, 0x65, 0x73, 0x00, 0x42, 0x61, 0x67, 0x68, 0x64, 0x61, 0x64,
+  0x00, 0x42, 0x61, 0x68, 0x69, 0x61, 0x00, 0x42, 0x61, 0x68, 0x69, 0x61, 0x20, 0x42, 0x61, 0x6e,
+  0x64, 0x65, 0x72, 0x61, 0x73, 0x00, 0x42, 0x61, 0x68, 0x72, 0x61, 0x69, 0x6e, 0x00, 0x42, 0x61,
+  0x6b, 0x75, 0x00, 0x42, 0x61, 0x6d, 0x61, 0x6b, 0x6f, 0x00, 0x42, 0x61, 0x6e, 0x67, 0x6b, 0x6f,
+  0x6b, 0x00, 0x42, 0x61, 0x6e, 0x67, 0x75, 0x69, 0x00, 0x42, 0x61, 0x6e, 0x6a, 0x75, 0x6c, 0x00,
+  0x42, 0x61, 0x72, 0x62, 0x61, 0x64, 0x6f, 0x73, 0x00, 0x42, 0x61, 0x72, 0x6e, 0x61, 0x75, 0x6c,
+  0x00, 0x42, 0x65, 0x69, 0x72, 0x75, 0x74, 0x00, 0x42, 0x65, 0x6c, 0x65, 0x6d, 0x00, 0x42, 0x65,
+  0x6c, 0x67, 0x72, 0x61, 0x64, 0x65, 0x00, 0x42, 0x65, 0x6c, 0x69, 0x7a, 0x65, 0x00, 0x42, 0x65,
+  0x72, 0x6c, 0x69, 0x6e, 0x00, 0x42, 0x65, 0x72, 0x6d, 0x75, 0x64, 0x61, 0x00, 0x42, 0x65, 0x75,
+  0x6c, 0x61, 0x68, 0x00, 0x42, 0x69, 0x73, 0x68, 0x6b, 0x65, 0x6b, 0x00, 0x42, 0x69, 0x73, 0x73,
+  0x61, 0x75, 0x00, 0x42, 0x6c, 0x61, 0x6e, 0x63, 0x2d, 0x53, 0x61, 0x62, 0x6c, 0x6f, 0x6e, 0x00,
+  0x42, 0x6c, 0x61, 0x6e, 0x74, 0x79, 0x72, 0x65, 0x00, 0x42, 0x6f, 0x61, 0x20, 0x56, 0x69, 0x73,
+  0x74, 0x61, 0x00, 0x42, 0x6f, 0x67, 0x6f, 0x74, 0x61, 0x00, 0x42, 0x6f, 0x69, 0x73, 0x65, 0x00,
+  0x42, 0x6f, 0x75, 0x67, 0x61, 0x69, 0x6e, 0x76, 0x69, 0x6c, 0x6c, 0x65, 0x00, 0x42, 0x72, 0x61,
+  0x74, 0x69, 0x73, 0x6c, 0x61, 0x76, 0x61, 0x00, 0x42, 0x72, 0x61, 0x7a, 0x7a, 0x61, 0x76, 0x69,
+  0x6c, 0x6c, 0x65, 0x00, 0x42, 0x72, 0x69, 0x73, 0x62, 0x61, 0x6e, 0x65, 0x00, 0x42, 0x72, 0x6f,
+  0x6b, 0x65, 0x6e, 0x20, 0x48, 0x69, 0x6c, 0x6c, 0x00, 0x42, 0x72, 0x75, 0x6e, 0x65, 0x69, 0x00,
+  0x42, 0x72, 0x75, 0x73, 0x73, 0x65, 0x6c, 0x73, 0x00, 0x42, 0x75, 0x63, 0x68, 0x61, 0x72, 0x65,
+  0x73, 0x74, 0x00, 0x42, 0x75, 0x64, 0x61, 0x70, 0x65, 0x73, 0x74, 0x00, 0x42, 0x75, 0x65, 0x6e,
+  0x6f, 0x73, 0x20, 0x41, 0x69, 0x72, 0x65, 0x73, 0x00, 0x42, 0x75, 0x6a, 0x75, 0x6d, 0x62, 0x75,
+  0x72, 0x61, 0x00, 0x42, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x65, 0x6e, 0x00, 0x43, 0x61, 0x69, 0x72,
+  0x6f, 0x00, 0x43, 0x61, 0x6d, 0x62, 0x72, 0x69, 0x64, 0x67, 0x65, 0x20, 0x42, 0x61, 0x79, 0x00,
+  0x43, 0x61, 0x6d, 0x70, 0x6f, 0x20, 0x47, 0x72, 0x61, 0x6e, 0x64, 0x65, 0x00, 0x43, 0x61, 0x6e,
+  0x61, 0x72, 0x79, 0x00, 0x43, 0x61, 0x6e, 0x63, 0x75, 0x6e, 0x00, 0x43, 0x61, 0x70, 0x65, 0x20,
+  0x56, 0x65, 0x72, 0x64, 0x65, 0x00, 0x43, 0x61, 0x72, 0x61, 0x63, 0x61, 0x73, 0x00, 0x43, 0x61,
+  0x73, 0x61, 0x62, 0x6c, 0x61, 0x6e, 0x63, 0x61, 0x00, 0x43, 0x61, 0x73, 0x65, 0x79, 0x00, 0x43,
+  0x61, 0x74, 0x61, 0x6d, 0x61, 0x72, 0x63, 0x61, 0x00, 0x43, 0x61, 0x79, 0x65, 0x6e, 0x6e, 0x65,
+  0x00, 0x43, 0x61, 0x79, 0x6d, 0x61, 0x6e, 0x00, 0x43, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x00, 0x43,
+  0x65, 0x75, 0x74, 0x61, 0x00, 0x43, 0x68, 0x61, 0x67, 0x6f, 0x73, 0x00, 0x43, 0x68, 0x61, 0x74,
+  0x68, 0x61, 0x6d, 0x00, 0x43, 0x68, 0x69, 0x63, 0x61, 0x67, 0x6f, 0x00, 0x43, 0x68, 0x69, 0x68,
+  0x75, 0x61, 0x68, 0x75, 0x61, 0x00, 0x43, 0x68, 0x69, 0x73, 0x69, 0x6e, 0x61, 0x75, 0x00, 0x43,
+  0x68, 0x69, 0x74, 0x61, 0x00, 0x43, 0x68, 0x72, 0x69, 0x73, 0x74, 0x6d, 0x61, 0x73, 0x00, 0x43,
+  0x68, 0x75, 0x75, 0x6b, 0x00, 0x43, 0x69, 0x75, 0x64, 0x61, 0x64, 0x20, 0x4a, 0x75, 0x61, 0x72,
+  0x65, 0x7a, 0x00, 0x43, 0x6f, 0x63, 0x6f, 0x73, 0x00, 0x43, 0x6f, 0x6c, 0x6f, 0x6d, 0x62, 0x6f,
+  0x00, 0x43, 0x6f, 0x6d, 0x6f, 0x72, 0x6f, 0x00, 0x43, 0x6f, 0x6e, 0x61, 0x6b, 0x72, 0x79, 0x00,
+  0x43, 0x6f, 0x70, 0x65, 0x6e, 0x68, 0x61, 0x67, 0x65, 0x6e, 0x00, 0x43, 0x6f, 0x72, 0x64, 0x6f,
+  0x62, 0x61, 0x00, 0x43, 0x6f, 0x73, 0x74, 0x61, 0x20, 0x52, 0x69, 0x63, 0x61, 0x00, 0x43, 0x6f,
+  0x79, 0x68, 0x61, 0x69, 0x71, 0x75, 0x65, 0x00, 0x43, 0x72, 0x65, 0x73, 0x74, 0x6f, 0x6e, 0x00,
+  0x43, 0x75, 0x69, 0x61, 0x62, 0x61, 0x00, 0x43, 0x75, 0x72, 0x61, 0x63, 0x61, 0x6f, 0x00, 0x44,
+  0x61, 0x6b, 0x61, 0x72, 0x00, 0x44, 0x61, 0x6d, 0x61, 0x73, 0x63, 0x75, 0x73, 0x00, 0x44, 0x61,
+  0x6e, 0x6d, 0x61, 0x72, 0x6b, 0x73, 0x68, 0x61, 0x76, 0x6e, 0x00, 0x44, 0x61, 0x72, 0x20, 0x65,
+  0x73, 0x20, 0x53, 0x61, 0x6c, 0x61, 0x61, 0x6d, 0x00, 0x44, 0x61, 0x72, 0x77, 0x69, 0x6e, 0x00,
+  0x44, 0x61, 0x76, 0x69, 0x73, 0x00, 0x44, 0x61, 0x77, 0x73, 0x6f, 0x6e, 0x00, 0x44, 0x61, 0x77,
+  0x73, 0x6f, 0x6e, 0x20, 0x43, 0x72, 0x65, 0x65, 0x6b, 0x00, 0x44, 0x65, 0x6e, 0x76, 0x65, 0x72,
+  0x00, 0x44, 0x65, 0x74, 0x72, 0x6f, 0x69, 0x74, 0x00, 0x44, 0x68, 0x61, 0x6b, 0x61, 0x00, 0x44,
+  0x69, 0x6c, 0x69, 0x00, 0x44, 0x6a, 0x69, 0x62, 0x6f, 0x75, 0x74, 0x69, 0x00, 0x44, 0x6f, 0x6d,
+  0x69, 0x6e, 0x69, 0x63, 0x61, 0x00, 0x44, 0x6f, 0x75, 0x61, 0x6c, 0x61, 0x00, 0x44, 0x75, 0x62,
+  0x61, 0x69, 0x00, 0x44, 0x75, 0x62, 0x6c, 0x69, 0x6e, 0x00, 0x44, 0x75, 0x6d, 0x6f, 0x6e, 0x74,
+  0x44, 0x55, 0x72, 0x76, 0x69, 0x6c, 0x6c, 0x65, 0x00, 0x44, 0x75, 0x73, 0x68, 0x61, 0x6e, 0x62,
+  0x65, 0x00, 0x45, 0x61, 0x73, 0x74, 0x65, 0x72, 0x00, 0x45, 0x64, 0x6d, 0x6f, 0x6e, 0x74, 0x6f,
+  0x6e, 0x00, 0x45, 0x66, 0x61, 0x74, 0x65, 0x00, 0x45, 0x69, 0x72, 0x75, 0x6e, 0x65, 0x70, 0x65,
+  0x00, 0x45, 0x6c, 0x20, 0x41, 0x61, 0x69, 0x75, 0x6e, 0x00, 0x45, 0x6c, 0x20, 0x53, 0x61, 0x6c,
+  0x76, 0x61, 0x64, 0x6f, 0x72, 0x00, 0x45, 0x75, 0x63, 0x6c, 0x61, 0x00, 0x46, 0x61, 0x6b, 0x61,
+  0x6f, 0x66, 0x6f, 0x00, 0x46, 0x61, 0x6d, 0x61, 0x67, 0x75, 0x73, 0x74, 0x61, 0x00, 0x46, 0x61,
+  0x72, 0x6f, 0x65, 0x00, 0x46, 0x69, 0x6a, 0x69, 0x00, 0x46, 0x6f, 0x72, 0x74, 0x20, 0x4e, 0x65,
+  0x6c, 0x73, 0x6f, 0x6e, 0x00, 0x46, 0x6f, 0x72, 0x74, 0x61, 0x6c, 0x65, 0x7a, 0x61, 0x00, 0x46,
+  0x72, 0x65, 0x65, 0x74, 0x6f, 0x77, 0x6e, 0x00, 0x46, 0x75, 0x6e, 0x61, 0x66, 0x75, 0x74, 0x69,
+  0x00, 0x47, 0x61, 0x62, 0x6f, 0x72, 0x6f, 0x6e, 0x65, 0x00, 0x47, 0x61, 0x6c, 0x61, 0x70, 0x61,
+  0x67, 0x6f, 0x73, 0x00, 0x47, 0x61, 0x6d, 0x62, 0x69, 0x65, 0x72, 0x00, 0x47, 0x61, 0x7a, 0x61,
+  0x00, 0x47, 0x69, 0x62, 0x72, 0x61, 0x6c, 0x74, 0x61, 0x72, 0x00, 0x47, 0x6c, 0x61, 0x63, 0x65,
+  0x20, 0x42, 0x61, 0x79, 0x00, 0x47, 0x6f, 0x6f, 0x73, 0x65, 0x20, 0x42, 0x61, 0x79, 0x00, 0x47,
+  0x72, 0x61, 0x6e, 0x64, 0x20, 0x54, 0x75, 0x72, 0x6b, 0x00, 0x47, 0x72, 0x65, 0x6e, 0x61, 0x64,
+  0x61, 0x00, 0x47, 0x75, 0x61, 0x64, 0x61, 0x6c, 0x63, 0x61, 0x6e, 0x61, 0x6c, 0x00, 0x47, 0x75,
+  0x61, 0x64, 0x65, 0x6c, 0x6f, 0x75, 0x70, 0x65, 0x00, 0x47, 0x75, 0x61, 0x6d, 0x00, 0x47, 0x75,
+  0x61, 0x74, 0x65, 0x6d, 0x61, 0x6c, 0x61, 0x00, 0x47, 0x75, 0x61, 0x79, 0x61, 0x71, 0x75, 0x69,
+  0x6c, 0x00, 0x47, 0x75, 0x65, 0x72, 0x6e, 0x73, 0x65, 0x79, 0x00, 0x47, 0x75, 0x79, 0x61, 0x6e,
+  0x61, 0x00, 0x48, 0x61, 0x6c, 0x69, 0x66, 0x61, 0x78, 0x00, 0x48, 0x61, 0x72, 0x61, 0x72, 0x65,
+  0x00, 0x48, 0x61, 0x76, 0x61, 0x6e, 0x61, 0x00, 0x48, 0x65, 0x62, 0x72, 0x6f, 0x6e, 0x00, 0x48,
+  0x65, 0x6c, 0x73, 0x69, 0x6e, 0x6b, 0x69, 0x00, 0x48, 0x65, 0x72, 0x6d, 0x6f, 0x73, 0x69, 0x6c,
+  0x6c, 0x6f, 0x00, 0x48, 0x6f, 0x20, 0x43, 0x68, 0x69, 0x20, 0x4d, 0x69, 0x6e, 0x68, 0x00, 0x48,
+  0x6f, 0x62, 0x61, 0x72, 0x74, 0x00, 0x48, 0x6f, 0x6e, 0x67, 0x20, 0x4b, 0x6f, 0x6e, 0x67, 0x00,
+  0x48, 0x6f, 0x6e, 0x6f, 0x6c, 0x75, 0x6c, 0x75, 0x00, 0x48, 0x6f, 0x76, 0x64, 0x00, 0x49, 0x6e,
+  0x64, 0x69, 0x61, 0x6e, 0x61, 0x70, 0x6f, 0x6c, 0x69, 0x73, 0x00, 0x49, 0x6e, 0x75, 0x76, 0x69,
+  0x6b, 0x00, 0x49, 0x71, 0x61, 0x6c, 0x75, 0x69, 0x74, 0x00, 0x49, 0x72, 0x6b, 0x75, 0x74, 0x73,
+  0x6b, 0x00, 0x49, 0x73, 0x6c, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x4d, 0x61, 0x6e, 0x00, 0x49, 0x73,
+  0x74, 0x61, 0x6e, 0x62, 0x75, 0x6c, 0x00, 0x4a, 0x61, 0x6b, 0x61, 0x72, 0x74, 0x61, 0x00, 0x4a,
+  0x61, 0x6d, 0x61, 0x69, 0x63, 0x61, 0x00, 0x4a, 0x61, 0x79, 0x61, 0x70, 0x75, 0x72, 0x61, 0x00,
+  0x4a, 0x65, 0x72, 0x73, 0x65, 0x79, 0x00, 0x4a, 0x65, 0x72, 0x75, 0x73, 0x61, 0x6c, 0x65, 0x6d,
+  0x00, 0x4a, 0x6f, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x73, 0x62, 0x75, 0x72, 0x67, 0x00, 0x4a, 0x75,
+  0x62, 0x61, 0x00, 0x4a, 0x75, 0x6a, 0x75, 0x79, 0x00, 0x4a, 0x75, 0x6e, 0x65, 0x61, 0x75, 0x00,
+  0x4b, 0x61, 0x62, 0x75, 0x6c, 0x00, 0x4b, 0x61, 0x6c, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x72, 0x61,
+  0x64, 0x00, 0x4b, 0x61, 0x6d, 0x63, 0x68, 0x61, 0x74, 0x6b, 0x61, 0x00, 0x4b, 0x61, 0x6d, 0x70,
+  0x61, 0x6c, 0x61, 0x00, 0x4b, 0x61, 0x6e, 0x74, 0x6f, 0x6e, 0x00, 0x4b, 0x61, 0x72, 0x61, 0x63,
+  0x68, 0x69, 0x00, 0x4b, 0x61, 0x74, 0x68, 0x6d, 0x61, 0x6e, 0x64, 0x75, 0x00, 0x4b, 0x65, 0x72,
+  0x67, 0x75, 0x65, 0x6c, 0x65, 0x6e, 0x00, 0x4b, 0x68, 0x61, 0x6e, 0x64, 0x79, 0x67, 0x61, 0x00,
+  0x4b, 0x68, 0x61, 0x72, 0x74, 0x6f, 0x75, 0x6d, 0x00, 0x4b, 0x69, 0x67, 0x61, 0x6c, 0x69, 0x00,
+  0x4b, 0x69, 0x6e, 0x73, 0x68, 0x61, 0x73, 0x61, 0x00, 0x4b, 0x69, 0x72, 0x69, 0x74, 0x69, 0x6d,
+  0x61, 0x74, 0x69, 0x00, 0x4b, 0x69, 0x72, 0x6f, 0x76, 0x00, 0x4b, 0x6e, 0x6f, 0x78, 0x00, 0x4b,
+  0x6f, 0x6c, 0x6b, 0x61, 0x74, 0x61, 0x00, 0x4b, 0x6f, 0x73, 0x72, 0x61, 0x65, 0x00, 0x4b, 0x72,
+  0x61, 0x6c, 0x65, 0x6e, 0x64, 0x69, 0x6a, 0x6b, 0x00, 0x4b, 0x72, 0x61, 0x73, 0x6e, 0x6f, 0x79,
+  0x61, 0x72, 0x73, 0x6b, 0x00, 0x4b, 0x75, 0x61, 0x6c, 0x61, 0x20, 0x4c, 0x75, 0x6d, 0x70, 0x75,
+  0x72, 0x00, 0x4b, 0x75, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x00, 0x4b, 0x75, 0x77, 0x61, 0x69, 0x74,
+  0x00, 0x4b, 0x77, 0x61, 0x6a, 0x61, 0x6c, 0x65, 0x69, 0x6e, 0x00, 0x4b, 0x79, 0x69, 0x76, 0x00,
+  0x4c, 0x61, 0x20, 0x50, 0x61, 0x7a, 0x00, 0x4c, 0x61, 0x20, 0x52, 0x69, 0x6f, 0x6a, 0x61, 0x00,
+  0x4c, 0x61, 0x67, 0x6f, 0x73, 0x00, 0x4c, 0x69, 0x62, 0x72, 0x65, 0x76, 0x69, 0x6c, 0x6c, 0x65,
+  0x00, 0x4c, 0x69, 0x6d, 0x61, 0x00, 0x4c, 0x69, 0x6e, 0x64, 0x65, 0x6d, 0x61, 0x6e, 0x00, 0x4c,
+  0x69, 0x73, 0x62, 0x6f, 0x6e, 0x00, 0x4c, 0x6a, 0x75, 0x62, 0x6c, 0x6a, 0x61, 0x6e, 0x61, 0x00,
+  0x4c, 0x6f, 0x6d, 0x65, 0x00, 0x4c, 0x6f, 0x6e, 0x64, 0x6f, 0x6e, 0x00, 0x4c, 0x6f, 0x6e, 0x67,
+  0x79, 0x65, 0x61, 0x72, 0x62, 0x79, 0x65, 0x6e, 0x00, 0x4c, 0x6f, 0x72, 0x64, 0x20, 0x48, 0x6f,
+  0x77, 0x65, 0x00, 0x4c, 0x6f, 0x73, 0x20, 0x41, 0x6e, 0x67, 0x65, 0x6c, 0x65, 0x73, 0x00, 0x4c,
+  0x6f, 0x75, 0x69, 0x73, 0x76, 0x69, 0x6c, 0x6c, 0x65, 0x00, 0x4c, 0x6f, 0x77, 0x65, 0x72, 0x20,
+  0x50, 0x72, 0x69, 0x6e, 0x63, 0x65, 0x73, 0x00, 0x4c, 0x75, 0x61, 0x6e, 0x64, 0x61, 0x00, 0x4c,
+  0x75, 0x62, 0x75, 0x6d, 0x62, 0x61, 0x73, 0x68, 0x69, 0x00, 0x4c, 0x75, 0x73, 0x61, 0x6b, 0x61,
+  0x00, 0x4c, 0x75, 0x78, 0x65, 0x6d, 0x62, 0x6f, 0x75, 0x72, 0x67, 0x00, 0x4d, 0x61, 0x63, 0x61,
+  0x75, 0x00, 0x4d, 0x61, 0x63, 0x65, 0x69, 0x6f, 0x00, 0x4d, 0x61, 0x63, 0x71, 0x75, 0x61, 0x72,
+  0x69, 0x65, 0x00, 0x4d, 0x61, 0x64, 0x65, 0x69, 0x72, 0x61, 0x00, 0x4d, 0x61, 0x64, 0x72, 0x69,
+  0x64, 0x00, 0x4d, 0x61, 0x67, 0x61, 0x64, 0x61, 0x6e, 0x00, 0x4d, 0x61, 0x68, 0x65, 0x00, 0x4d,
+  0x61, 0x6a, 0x75, 0x72, 0x6f, 0x00, 0x4d, 0x61, 0x6b, 0x61, 0x73, 0x73, 0x61, 0x72, 0x00, 0x4d,
+  0x61, 0x6c, 0x61, 0x62, 0x6f, 0x00, 0x4d, 0x61, 0x6c, 0x64, 0x69, 0x76, 0x65, 0x73, 0x00, 0x4d,
+  0x61, 0x6c, 0x74, 0x61, 0x00, 0x4d, 0x61, 0x6e, 0x61, 0x67, 0x75, 0x61, 0x00, 0x4d, 0x61, 0x6e,
+  0x61, 0x75, 0x73, 0x00, 0x4d, 0x61, 0x6e, 0x69, 0x6c, 0x61, 0x00, 0x4d, 0x61, 0x70, 0x75, 0x74,
+  0x6f, 0x00, 0x4d, 0x61, 0x72, 0x65, 0x6e, 0x67, 0x6f, 0x00, 0x4d, 0x61, 0x72, 0x69, 0x65, 0x68,
+  0x61, 0x6d, 0x6e, 0x00, 0x4d, 0x61, 0x72, 0x69, 0x67, 0x6f, 0x74, 0x00, 0x4d, 0x61, 0x72, 0x71,
+  0x75, 0x65, 0x73, 0x61, 0x73, 0x00, 0x4d, 0x61, 0x72, 0x74, 0x69, 0x6e, 0x69, 0x71, 0x75, 0x65,
+  0x00, 0x4d, 0x61, 0x73, 0x65, 0x72, 0x75, 0x00, 0x4d, 0x61, 0x74, 0x61, 0x6d, 0x6f, 0x72, 0x6f,
+  0x73, 0x00, 0x4d, 0x61, 0x75, 0x72, 0x69, 0x74, 0x69, 0x75, 0x73, 0x00, 0x4d, 0x61, 0x77, 0x73,
+  0x6f, 0x6e, 0x00, 0x4d, 0x61, 0x79, 0x6f, 0x74, 0x74, 0x65, 0x00, 0x4d, 0x61, 0x7a, 0x61, 0x74,
+  0x6c, 0x61, 0x6e, 0x00, 0x4d, 0x62, 0x61, 0x62, 0x61, 0x6e, 0x65, 0x00, 0x4d, 0x63, 0x4d, 0x75,
+  0x72, 0x64, 0x6f, 0x00, 0x4d, 0x65, 0x6c, 0x62, 0x6f, 0x75, 0x72, 0x6e, 0x65, 0x00, 0x4d, 0x65,
+  0x6e, 0x64, 0x6f, 0x7a, 0x61, 0x00, 0x4d, 0x65, 0x6e, 0x6f, 0x6d, 0x69, 0x6e, 0x65, 0x65, 0x00,
+  0x4d, 0x65, 0x72, 0x69, 0x64, 0x61, 0x00, 0x4d, 0x65, 0x74, 0x6c, 0x61, 0x6b, 0x61, 0x74, 0x6c,
+  0x61, 0x00, 0x4d, 0x65, 0x78, 0x69, 0x63, 0x6f, 0x20, 0x43, 0x69, 0x74, 0x79, 0x00, 0x4d, 0x69,
+  0x64, 0x77, 0x61, 0x79, 0x00, 0x4d, 0x69, 0x6e, 0x73, 0x6b, 0x00, 0x4d, 0x69, 0x71, 0x75, 0x65,
+  0x6c, 0x6f, 0x6e, 0x00, 0x4d, 0x6f, 0x67, 0x61, 0x64, 0x69, 0x73, 0x68, 0x75, 0x00, 0x4d, 0x6f,
+  0x6e, 0x61, 0x63, 0x6f, 0x00, 0x4d, 0x6f, 0x6e, 0x63, 0x74, 0x6f, 0x6e, 0x00, 0x4d, 0x6f, 0x6e,
+  0x72, 0x6f, 0x76, 0x69, 0x61, 0x00, 0x4d, 0x6f, 0x6e, 0x74, 0x65, 0x72, 0x72, 0x65, 0x79, 0x00,
+  0x4d, 0x6f, 0x6e, 0x74, 0x65, 0x76, 0x69, 0x64, 0x65, 0x6f, 0x00, 0x4d, 0x6f, 0x6e, 0x74, 0x69,
+  0x63, 0x65, 0x6c, 0x6c, 0x6f, 0x00, 0x4d, 0x6f, 0x6e, 0x74, 0x73, 0x65, 0x72, 0x72, 0x61, 0x74,
+  0x00, 0x4d, 0x6f, 0x73, 0x63, 0x6f, 0x77, 0x00, 0x4d, 0x75, 0x73, 0x63, 0x61, 0x74, 0x00, 0x4e,
+  0x61, 0x69, 0x72, 0x6f, 0x62, 0x69, 0x00, 0x4e, 0x61, 0x73, 0x73, 0x61, 0x75, 0x00, 0x4e, 0x61,
+  0x75, 0x72, 0x75, 0x00, 0x4e, 0x64, 0x6a, 0x61, 0x6d, 0x65, 0x6e, 0x61, 0x00, 0x4e, 0x65, 0x77,
+  0x20, 0x53, 0x61, 0x6c, 0x65, 0x6d, 0x00, 0x4e, 0x65, 0x77, 0x20, 0x59, 0x6f, 0x72, 0x6b, 0x00,
+  0x4e, 0x69, 0x61, 0x6d, 0x65, 0x79, 0x00, 0x4e, 0x69, 0x63, 0x6f, 0x73, 0x69, 0x61, 0x00, 0x4e,
+  0x69, 0x75, 0x65, 0x00, 0x4e, 0x6f, 0x6d, 0x65, 0x00, 0x4e, 0x6f, 0x72, 0x66, 0x6f, 0x6c, 0x6b,
+  0x00, 0x4e, 0x6f, 0x72, 0x6f, 0x6e, 0x68, 0x61, 0x00, 0x4e, 0x6f, 0x75, 0x61, 0x6b, 0x63, 0x68,
+  0x6f, 0x74, 0x74, 0x00, 0x4e, 0x6f, 0x75, 0x6d, 0x65, 0x61, 0x00, 0x4e, 0x6f, 0x76, 0x6f, 0x6b,
+  0x75, 0x7a, 0x6e, 0x65, 0x74, 0x73, 0x6b, 0x00, 0x4e, 0x6f, 0x76, 0x6f, 0x73, 0x69, 0x62, 0x69,
+  0x72, 0x73, 0x6b, 0x00, 0x4e, 0x75, 0x75, 0x6b, 0x00, 0x4f, 0x6a, 0x69, 0x6e, 0x61, 0x67, 0x61,
+  0x00, 0x4f, 0x6d, 0x73, 0x6b, 0x00, 0x4f, 0x72, 0x61, 0x6c, 0x00, 0x4f, 0x73, 0x6c, 0x6f, 0x00,
+  0x4f, 0x75, 0x61, 0x67, 0x61, 0x64, 0x6f, 0x75, 0x67, 0x6f, 0x75, 0x00, 0x50, 0x61, 0x67, 0x6f,
+  0x20, 0x50, 0x61, 0x67, 0x6f, 0x00, 0x50, 0x61, 0x6c, 0x61, 0x75, 0x00, 0x50, 0x61, 0x6c, 0x6d,
+  0x65, 0x72, 0x00, 0x50, 0x61, 0x6e, 0x61, 0x6d, 0x61, 0x00, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x61,
+  0x72, 0x69, 0x62, 0x6f, 0x00, 0x50, 0x61, 0x72, 0x69, 0x73, 0x00, 0x50, 0x65, 0x72, 0x74, 0x68,
+  0x00, 0x50, 0x65, 0x74, 0x65, 0x72, 0x73, 0x62, 0x75, 0x72, 0x67, 0x00, 0x50, 0x68, 0x6e, 0x6f,
+  0x6d, 0x20, 0x50, 0x65, 0x6e, 0x68, 0x00, 0x50, 0x68, 0x6f, 0x65, 0x6e, 0x69, 0x78, 0x00, 0x50,
+  0x69, 0x74, 0x63, 0x61, 0x69, 0x72, 0x6e, 0x00, 0x50, 0x6f, 0x64, 0x67, 0x6f, 0x72, 0x69, 0x63,
+  0x61, 0x00, 0x50, 0x6f, 0x68, 0x6e, 0x70, 0x65, 0x69, 0x00, 0x50, 0x6f, 0x6e, 0x74, 0x69, 0x61,
+  0x6e, 0x61, 0x6b, 0x00, 0x50, 0x6f, 0x72, 0x74, 0x20, 0x4d, 0x6f, 0x72, 0x65, 0x73, 0x62, 0x79,
+  0x00, 0x50, 0x6f, 0x72, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x53, 0x70, 0x61, 0x69, 0x6e, 0x00, 0x50,
+  0x6f, 0x72, 0x74, 0x2d, 0x61, 0x75, 0x2d, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x65, 0x00, 0x50, 0x6f,
+  0x72, 0x74, 0x6f, 0x20, 0x56, 0x65, 0x6c, 0x68, 0x6f, 0x00, 0x50, 0x6f, 0x72, 0x74, 0x6f, 0x2d,
+  0x4e, 0x6f, 0x76, 0x6f, 0x00, 0x50, 0x72, 0x61, 0x67, 0x75, 0x65, 0x00, 0x50, 0x75, 0x65, 0x72,
+  0x74, 0x6f, 0x20, 0x52, 0x69, 0x63, 0x6f, 0x00, 0x50, 0x75, 0x6e, 0x74, 0x61, 0x20, 0x41, 0x72,
+  0x65, 0x6e, 0x61, 0x73, 0x00, 0x50, 0x79, 0x6f, 0x6e, 0x67, 0x79, 0x61, 0x6e, 0x67, 0x00, 0x51,
+  0x61, 0x74, 0x61, 0x72, 0x00, 0x51, 0x6f, 0x73, 0x74, 0x61, 0x6e, 0x61, 0x79, 0x00, 0x51, 0x79,
+  0x7a, 0x79, 0x6c, 0x6f, 0x72, 0x64, 0x61, 0x00, 0x52, 0x61, 0x6e, 0x6b, 0x69, 0x6e, 0x20, 0x49,
+  0x6e, 0x6c, 0x65, 0x74, 0x00, 0x52, 0x61, 0x72, 0x6f, 0x74, 0x6f, 0x6e, 0x67, 0x61, 0x00, 0x52,
+  0x65, 0x63, 0x69, 0x66, 0x65, 0x00, 0x52, 0x65, 0x67, 0x69, 0x6e, 0x61, 0x00, 0x52, 0x65, 0x73,
+  0x6f, 0x6c, 0x75, 0x74, 0x65, 0x00, 0x52, 0x65, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x00, 0x52, 0x65,
+  0x79, 0x6b, 0x6a, 0x61, 0x76, 0x69, 0x6b, 0x00, 0x52, 0x69, 0x67, 0x61, 0x00, 0x52, 0x69, 0x6f,
+  0x20, 0x42, 0x72, 0x61, 0x6e, 0x63, 0x6f, 0x00, 0x52, 0x69, 0x6f, 0x20, 0x47, 0x61, 0x6c, 0x6c,
+  0x65, 0x67, 0x6f, 0x73, 0x00, 0x52, 0x69, 0x79, 0x61, 0x64, 0x68, 0x00, 0x52, 0x6f, 0x6d, 0x65,
+  0x00, 0x52, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x61, 0x00, 0x53, 0x61, 0x69, 0x70, 0x61, 0x6e, 0x00,
+  0x53, 0x61, 0x6b, 0x68, 0x61, 0x6c, 0x69, 0x6e, 0x00, 0x53, 0x61, 0x6c, 0x74, 0x61, 0x00, 0x53,
+  0x61, 0x6d, 0x61, 0x72, 0x61, 0x00, 0x53, 0x61, 0x6d, 0x61, 0x72, 0x6b, 0x61, 0x6e, 0x64, 0x00,
+  0x53, 0x61, 0x6e, 0x20, 0x4a, 0x75, 0x61, 0x6e, 0x00, 0x53, 0x61, 0x6e, 0x20, 0x4c, 0x75, 0x69,
+  0x73, 0x00, 0x53, 0x61, 0x6e, 0x20, 0x4d, 0x61, 0x72, 0x69, 0x6e, 0x6f, 0x00, 0x53, 0x61, 0x6e,
+  0x74, 0x61, 0x72, 0x65, 0x6d, 0x00, 0x53, 0x61, 0x6e, 0x74, 0x69, 0x61, 0x67, 0x6f, 0x00, 0x53,
+  0x61, 0x6e, 0x74, 0x6f, 0x20, 0x44, 0x6f, 0x6d, 0x69, 0x6e, 0x67, 0x6f, 0x00, 0x53, 0x61, 0x6f,
+  0x20, 0x50, 0x61, 0x75, 0x6c, 0x6f, 0x00, 0x53, 0x61, 0x6f, 0x20, 0x54, 0x6f, 0x6d, 0x65, 0x00,
+  0x53, 0x61, 0x72, 0x61, 0x6a, 0x65, 0x76, 0x6f, 0x00, 0x53, 0x61, 0x72, 0x61, 0x74, 0x6f, 0x76,
+  0x00, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x62, 0x79, 0x73, 0x75, 0x6e, 0x64, 0x00, 0x53, 0x65,
+  0x6f, 0x75, 0x6c, 0x00, 0x53, 0x68, 0x61, 0x6e, 0x67, 0x68, 0x61, 0x69, 0x00, 0x53, 0x69, 0x6d,
+  0x66, 0x65, 0x72, 0x6f, 0x70, 0x6f, 0x6c, 0x00, 0x53, 0x69, 0x6e, 0x67, 0x61, 0x70, 0x6f, 0x72,
+  0x65, 0x00, 0x53, 0x69, 0x74, 0x6b, 0x61, 0x00, 0x53, 0x6b, 0x6f, 0x70, 0x6a, 0x65, 0x00, 0x53,
+  0x6f, 0x66, 0x69, 0x61, 0x00, 0x53, 0x6f, 0x75, 0x74, 0x68, 0x20, 0x47, 0x65, 0x6f, 0x72, 0x67,
+  0x69, 0x61, 0x00, 0x53, 0x72, 0x65, 0x64, 0x6e, 0x65, 0x6b, 0x6f, 0x6c, 0x79, 0x6d, 0x73, 0x6b,
+  0x00, 0x53, 0x74, 0x20, 0x42, 0x61, 0x72, 0x74, 0x68, 0x65, 0x6c, 0x65, 0x6d, 0x79, 0x00, 0x53,
+  0x74, 0x20, 0x48, 0x65, 0x6c, 0x65, 0x6e, 0x61, 0x00, 0x53, 0x74, 0x20, 0x4a, 0x6f, 0x68, 0x6e,
+  0x73, 0x00, 0x53, 0x74, 0x20, 0x4b, 0x69, 0x74, 0x74, 0x73, 0x00, 0x53, 0x74, 0x20, 0x4c, 0x75,
+  0x63, 0x69, 0x61, 0x00, 0x53, 0x74, 0x20, 0x54, 0x68, 0x6f, 0x6d, 0x61, 0x73, 0x00, 0x53, 0x74,
+  0x20, 0x56, 0x69, 0x6e, 0x63, 0x65, 0x6e, 0x74, 0x00, 0x53, 0x74, 0x61, 0x6e, 0x6c, 0x65, 0x79,
+  0x00, 0x53, 0x74, 0x6f, 0x63, 0x6b, 0x68, 0x6f, 0x6c, 0x6d, 0x00, 0x53, 0x77, 0x69, 0x66, 0x74,
+  0x20, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x00, 0x53, 0x79, 0x64, 0x6e, 0x65, 0x79, 0x00,
+  0x53, 0x79, 0x6f, 0x77, 0x61, 0x00, 0x54, 0x61, 0x68, 0x69, 0x74, 0x69, 0x00, 0x54, 0x61, 0x69,
+  0x70, 0x65, 0x69, 0x00, 0x54, 0x61, 0x6c, 0x6c, 0x69, 0x6e, 0x6e, 0x00, 0x54, 0x61, 0x72, 0x61,
+  0x77, 0x61, 0x00, 0x54, 0x61, 0x73, 0x68, 0x6b, 0x65, 0x6e, 0x74, 0x00, 0x54, 0x62, 0x69, 0x6c,
+  0x69, 0x73, 0x69, 0x00, 0x54, 0x65, 0x67, 0x75, 0x63, 0x69, 0x67, 0x61, 0x6c, 0x70, 0x61, 0x00,
+  0x54, 0x65, 0x68, 0x72, 0x61, 0x6e, 0x00, 0x54, 0x65, 0x6c, 0x6c, 0x20, 0x43, 0x69, 0x74, 0x79,
+  0x00, 0x54, 0x68, 0x69, 0x6d, 0x70, 0x68, 0x75, 0x00, 0x54, 0x68, 0x75, 0x6c, 0x65, 0x00, 0x54,
+  0x69, 0x6a, 0x75, 0x61, 0x6e, 0x61, 0x00, 0x54, 0x69, 0x72, 0x61, 0x6e, 0x65, 0x00, 0x54, 0x6f,
+  0x6b, 0x79, 0x6f, 0x00, 0x54, 0x6f, 0x6d, 0x73, 0x6b, 0x00, 0x54, 0x6f, 0x6e, 0x67, 0x61, 0x74,
+  0x61, 0x70, 0x75, 0x00, 0x54, 0x6f, 0x72, 0x6f, 0x6e, 0x74, 0x6f, 0x00, 0x54, 0x6f, 0x72, 0x74,
+  0x6f, 0x6c, 0x61, 0x00, 0x54, 0x72, 0x69, 0x70, 0x6f, 0x6c, 0x69, 0x00, 0x54, 0x72, 0x6f, 0x6c,
+  0x6c, 0x00, 0x54, 0x75, 0x63, 0x75, 0x6d, 0x61, 0x6e, 0x00, 0x54, 0x75, 0x6e, 0x69, 0x73, 0x00,
+  0x55, 0x6c, 0x61, 0x61, 0x6e, 0x62, 0x61, 0x61, 0x74, 0x61, 0x72, 0x00, 0x55, 0x6c, 0x79, 0x61,
+  0x6e, 0x6f, 0x76, 0x73, 0x6b, 0x00, 0x55, 0x72, 0x75, 0x6d, 0x71, 0x69, 0x00, 0x55, 0x73, 0x68,
+  0x75, 0x61, 0x69, 0x61, 0x00, 0x55, 0x73, 0x74, 0x2d, 0x4e, 0x65, 0x72, 0x61, 0x00, 0x56, 0x61,
+  0x64, 0x75, 0x7a, 0x00, 0x56, 0x61, 0x6e, 0x63, 0x6f, 0x75, 0x76, 0x65, 0x72, 0x00, 0x56, 0x61,
+  0x74, 0x69, 0x63, 0x61, 0x6e, 0x00, 0x56, 0x65, 0x76, 0x61, 0x79, 0x00, 0x56, 0x69, 0x65, 0x6e,
+  0x6e, 0x61, 0x00, 0x56, 0x69, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6e, 0x65, 0x00, 0x56, 0x69, 0x6c,
+  0x6e, 0x69, 0x75, 0x73, 0x00, 0x56, 0x69, 0x6e, 0x63, 0x65, 0x6e, 0x6e, 0x65, 0x73, 0x00, 0x56,
+  0x6c, 0x61, 0x64, 0x69, 0x76, 0x6f, 0x73, 0x74, 0x6f, 0x6b, 0x00, 0x56, 0x6f, 0x6c, 0x67, 0x6f,
+  0x67, 0x72, 0x61, 0x64, 0x00, 0x56, 0x6f, 0x73, 0x74, 0x6f, 0x6b, 0x00, 0x57, 0x61, 0x6b, 0x65,
+  0x00, 0x57, 0x61, 0x6c, 0x6c, 0x69, 0x73, 0x00, 0x57, 0x61, 0x72, 0x73, 0x61, 0x77, 0x00, 0x57,
+  0x68, 0x69, 0x74, 0x65, 0x68, 0x6f, 0x72, 0x73, 0x65, 0x00, 0x57, 0x69, 0x6e, 0x61, 0x6d, 0x61,
+  0x63, 0x00, 0x57, 0x69, 0x6e, 0x64, 0x68, 0x6f, 0x65, 0x6b, 0x00, 0x57, 0x69, 0x6e, 0x6e, 0x69,
+  0x70, 0x65, 0x67, 0x00, 0x59, 0x61, 0x6b, 0x75, 0x74, 0x61, 0x74, 0x00, 0x59, 0x61, 0x6b, 0x75,
+  0x74, 0x73, 0x6b, 0x00, 0x59, 0x61, 0x6e, 0x67, 0x6f, 0x6e, 0x00, 0x59, 0x65, 0x6b, 0x61, 0x74,
+  0x65, 0x72, 0x69, 0x6e, 0x62, 0x75, 0x72, 0x67, 0x00, 0x59, 0x65, 0x72, 0x65, 0x76, 0x61, 0x6e,
+  0x00, 0x5a, 0x61, 0x67, 0x72, 0x65, 0x62, 0x00, 0x5a, 0x75, 0x72, 0x69, 0x63, 0x68, 0x00, 0x55,
+  0x6e, 0x69, 0x74, 0x65, 0x64, 0x20, 0x41, 0x72, 0x61, 0x62, 0x20, 0x45, 0x6d, 0x69, 0x72, 0x61,
+  0x74, 0x65, 0x73, 0x00, 0x41, 0x66, 0x67, 0x68, 0x61, 0x6e, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x00,
+  0x41, 0x6e, 0x74, 0x69, 0x67, 0x75, 0x61, 0x20, 0x26, 0x20, 0x42, 0x61, 0x72, 0x62, 0x75, 0x64,
+  0x61, 0x00, 0x41, 0x6c, 0x62, 0x61, 0x6e, 0x69, 0x61, 0x00, 0x41, 0x72, 0x6d, 0x65, 0x6e, 0x69,
+  0x61, 0x00, 0x41, 0x6e, 0x67, 0x6f, 0x6c, 0x61, 0x00, 0x41, 0x6e, 0x74, 0x61, 0x72, 0x63, 0x74,
+  0x69, 0x63, 0x61, 0x00, 0x41, 0x72, 0x67, 0x65, 0x6e, 0x74, 0x69, 0x6e, 0x61, 0x00, 0x53, 0x61,
+  0x6d, 0x6f, 0x61, 0x20, 0x28, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x6e, 0x29, 0x00, 0x41,
+  0x75, 0x73, 0x74, 0x72, 0x69, 0x61, 0x00, 0x41, 0x75, 0x73, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x61,
+  0x00, 0x3f, 0x6c, 0x61, 0x6e, 0x64, 0x20, 0x49, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x00, 0x41,
+  0x7a, 0x65, 0x72, 0x62, 0x61, 0x69, 0x6a, 0x61, 0x6e, 0x00, 0x42, 0x6f, 0x73, 0x6e, 0x69, 0x61,
+  0x20, 0x26, 0x20, 0x48, 0x65, 0x72, 0x7a, 0x65, 0x67, 0x6f, 0x76, 0x69, 0x6e, 0x61, 0x00, 0x42,
+  0x61, 0x6e, 0x67, 0x6c, 0x61, 0x64, 0x65, 0x73, 0x68, 0x00, 0x42, 0x65, 0x6c, 0x67, 0x69, 0x75,
+  0x6d, 0x00, 0x42, 0x75, 0x72, 0x6b, 0x69, 0x6e, 0x61, 0x20, 0x46, 0x61, 0x73, 0x6f, 0x00, 0x42,
+  0x75, 0x6c, 0x67, 0x61, 0x72, 0x69, 0x61, 0x00, 0x42, 0x75, 0x72, 0x75, 0x6e, 0x64, 0x69, 0x00,
+  0x42, 0x65, 0x6e, 0x69, 0x6e, 0x00, 0x42, 0x6f, 0x6c, 0x69, 0x76, 0x69, 0x61, 0x00, 0x43, 0x61,
+  0x72, 0x69, 0x62, 0x62, 0x65, 0x61, 0x6e, 0x20, 0x4e, 0x4c, 0x00, 0x42, 0x72, 0x61, 0x7a, 0x69,
+  0x6c, 0x00, 0x42, 0x61, 0x68, 0x61, 0x6d, 0x61, 0x73, 0x00, 0x42, 0x68, 0x75, 0x74, 0x61, 0x6e,
+  0x00, 0x42, 0x6f, 0x74, 0x73, 0x77, 0x61, 0x6e, 0x61, 0x00, 0x42, 0x65, 0x6c, 0x61, 0x72, 0x75,
+  0x73, 0x00, 0x43, 0x61, 0x6e, 0x61, 0x64, 0x61, 0x00, 0x43, 0x6f, 0x63, 0x6f, 0x73, 0x20, 0x28,
+  0x4b, 0x65, 0x65, 0x6c, 0x69, 0x6e, 0x67, 0x29, 0x20, 0x49, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x73,
+  0x00, 0x43, 0x6f, 0x6e, 0x67, 0x6f, 0x20, 0x28, 0x44, 0x65, 0x6d, 0x2e, 0x20, 0x52, 0x65, 0x70,
+  0x2e, 0x29, 0x00, 0x43, 0x65, 0x6e, 0x74, 0x72, 0x61, 0x6c, 0x20, 0x41, 0x66, 0x72, 0x69, 0x63,
+  0x61, 0x6e, 0x20, 0x52, 0x65, 0x70, 0x2e, 0x00, 0x43, 0x6f, 0x6e, 0x67, 0x6f, 0x20, 0x28, 0x52,
+  0x65, 0x70, 0x2e, 0x29, 0x00, 0x53, 0x77, 0x69, 0x74, 0x7a, 0x65, 0x72, 0x6c, 0x61, 0x6e, 0x64,
+  0x00, 0x43, 0x3f, 0x74, 0x65, 0x20, 0x64, 0x27, 0x49, 0x76, 0x6f, 0x69, 0x72, 0x65, 0x00, 0x43,
+  0x6f, 0x6f, 0x6b, 0x20, 0x49, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x00, 0x43, 0x68, 0x69, 0x6c,
+  0x65, 0x00, 0x43, 0x61, 0x6d, 0x65, 0x72, 0x6f, 0x6f, 0x6e, 0x00, 0x43, 0x68, 0x69, 0x6e, 0x61,
+  0x00, 0x43, 0x6f, 0x6c, 0x6f, 0x6d, 0x62, 0x69, 0x61, 0x00, 0x43, 0x75, 0x62, 0x61, 0x00, 0x43,
+  0x75, 0x72, 0x61, 0x3f, 0x61, 0x6f, 0x00, 0x43, 0x68, 0x72, 0x69, 0x73, 0x74, 0x6d, 0x61, 0x73,
+  0x20, 0x49, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x00, 0x43, 0x79, 0x70, 0x72, 0x75, 0x73, 0x00, 0x43,
+  0x7a, 0x65, 0x63, 0x68, 0x20, 0x52, 0x65, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x00, 0x47, 0x65,
+  0x72, 0x6d, 0x61, 0x6e, 0x79, 0x00, 0x44, 0x65, 0x6e, 0x6d, 0x61, 0x72, 0x6b, 0x00, 0x44, 0x6f,
+  0x6d, 0x69, 0x6e, 0x69, 0x63, 0x61, 0x6e, 0x20, 0x52, 0x65, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63,
+  0x00, 0x41, 0x6c, 0x67, 0x65, 0x72, 0x69, 0x61, 0x00, 0x45, 0x63, 0x75, 0x61, 0x64, 0x6f, 0x72,
+  0x00, 0x45, 0x73, 0x74, 0x6f, 0x6e, 0x69, 0x61, 0x00, 0x45, 0x67, 0x79, 0x70, 0x74, 0x00, 0x57,
+  0x65, 0x73, 0x74, 0x65, 0x72, 0x6e, 0x20, 0x53, 0x61, 0x68, 0x61, 0x72, 0x61, 0x00, 0x45, 0x72,
+  0x69, 0x74, 0x72, 0x65, 0x61, 0x00, 0x53, 0x70, 0x61, 0x69, 0x6e, 0x00, 0x45, 0x74, 0x68, 0x69,
+  0x6f, 0x70, 0x69, 0x61, 0x00, 0x46, 0x69, 0x6e, 0x6c, 0x61, 0x6e, 0x64, 0x00, 0x46, 0x61, 0x6c,
+  0x6b, 0x6c, 0x61, 0x6e, 0x64, 0x20, 0x49, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x00, 0x4d, 0x69,
+  0x63, 0x72, 0x6f, 0x6e, 0x65, 0x73, 0x69, 0x61, 0x00, 0x46, 0x61, 0x72, 0x6f, 0x65, 0x20, 0x49,
+  0x73, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x00, 0x46, 0x72, 0x61, 0x6e, 0x63, 0x65, 0x00, 0x47, 0x61,
+  0x62, 0x6f, 0x6e, 0x00, 0x42, 0x72, 0x69, 0x74, 0x61, 0x69, 0x6e, 0x20, 0x28, 0x55, 0x4b, 0x29,
+  0x00, 0x47, 0x65, 0x6f, 0x72, 0x67, 0x69, 0x61, 0x00, 0x46, 0x72, 0x65, 0x6e, 0x63, 0x68, 0x20,
+  0x47, 0x75, 0x69, 0x61, 0x6e, 0x61, 0x00, 0x47, 0x68, 0x61, 0x6e, 0x61, 0x00, 0x47, 0x72, 0x65,
+  0x65, 0x6e, 0x6c, 0x61, 0x6e, 0x64, 0x00, 0x47, 0x61, 0x6d, 0x62, 0x69, 0x61, 0x00, 0x47, 0x75,
+  0x69, 0x6e, 0x65, 0x61, 0x00, 0x45, 0x71, 0x75, 0x61, 0x74, 0x6f, 0x72, 0x69, 0x61, 0x6c, 0x20,
+  0x47, 0x75, 0x69, 0x6e, 0x65, 0x61, 0x00, 0x47, 0x72, 0x65, 0x65, 0x63, 0x65, 0x00, 0x53, 0x6f,
+  0x75, 0x74, 0x68, 0x20, 0x47, 0x65, 0x6f, 0x72, 0x67, 0x69, 0x61, 0x20, 0x26, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x53, 0x6f, 0x75, 0x74, 0x68, 0x20, 0x53, 0x61, 0x6e, 0x64, 0x77, 0x69, 0x63, 0x68,
+  0x20, 0x49, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x00, 0x47, 0x75, 0x69, 0x6e, 0x65, 0x61, 0x2d,
+  0x42, 0x69, 0x73, 0x73, 0x61, 0x75, 0x00, 0x48, 0x6f, 0x6e, 0x64, 0x75, 0x72, 0x61, 0x73, 0x00,
+  0x43, 0x72, 0x6f, 0x61, 0x74, 0x69, 0x61, 0x00, 0x48, 0x61, 0x69, 0x74, 0x69, 0x00, 0x48, 0x75,
+  0x6e, 0x67, 0x61, 0x72, 0x79, 0x00, 0x49, 0x6e, 0x64, 0x6f, 0x6e, 0x65, 0x73, 0x69, 0x61, 0x00,
+  0x49, 0x72, 0x65, 0x6c, 0x61, 0x6e, 0x64, 0x00, 0x49, 0x73, 0x72, 0x61, 0x65, 0x6c, 0x00, 0x49,
+  0x6e, 0x64, 0x69, 0x61, 0x00, 0x42, 0x72, 0x69, 0x74, 0x69, 0x73, 0x68, 0x20, 0x49, 0x6e, 0x64,
+  0x69, 0x61, 0x6e, 0x20, 0x4f, 0x63, 0x65, 0x61, 0x6e, 0x20, 0x54, 0x65, 0x72, 0x72, 0x69, 0x74,
+  0x6f, 0x72, 0x79, 0x00, 0x49, 0x72, 0x61, 0x71, 0x00, 0x49, 0x72, 0x61, 0x6e, 0x00, 0x49, 0x63,
+  0x65, 0x6c, 0x61, 0x6e, 0x64, 0x00, 0x49, 0x74, 0x61, 0x6c, 0x79, 0x00, 0x4a, 0x6f, 0x72, 0x64,
+  0x61, 0x6e, 0x00, 0x4a, 0x61, 0x70, 0x61, 0x6e, 0x00, 0x4b, 0x65, 0x6e, 0x79, 0x61, 0x00, 0x4b,
+  0x79, 0x72, 0x67, 0x79, 0x7a, 0x73, 0x74, 0x61, 0x6e, 0x00, 0x43, 0x61, 0x6d, 0x62, 0x6f, 0x64,
+  0x69, 0x61, 0x00, 0x4b, 0x69, 0x72, 0x69, 0x62, 0x61, 0x74, 0x69, 0x00, 0x43, 0x6f, 0x6d, 0x6f,
+  0x72, 0x6f, 0x73, 0x00, 0x53, 0x74, 0x20, 0x4b, 0x69, 0x74, 0x74, 0x73, 0x20, 0x26, 0x20, 0x4e,
+  0x65, 0x76, 0x69, 0x73, 0x00, 0x4b, 0x6f, 0x72, 0x65, 0x61, 0x20, 0x28, 0x4e, 0x6f, 0x72, 0x74,
+  0x68, 0x29, 0x00, 0x4b, 0x6f, 0x72, 0x65, 0x61, 0x20, 0x28, 0x53, 0x6f, 0x75, 0x74, 0x68, 0x29,
+  0x00, 0x43, 0x61, 0x79, 0x6d, 0x61, 0x6e, 0x20, 0x49, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x00,
+  0x4b, 0x61, 0x7a, 0x61, 0x6b, 0x68, 0x73, 0x74, 0x61, 0x6e, 0x00, 0x4c, 0x61, 0x6f, 0x73, 0x00,
+  0x4c, 0x65, 0x62, 0x61, 0x6e, 0x6f, 0x6e, 0x00, 0x4c, 0x69, 0x65, 0x63, 0x68, 0x74, 0x65, 0x6e,
+  0x73, 0x74, 0x65, 0x69, 0x6e, 0x00, 0x53, 0x72, 0x69, 0x20, 0x4c, 0x61, 0x6e, 0x6b, 0x61, 0x00,
+  0x4c, 0x69, 0x62, 0x65, 0x72, 0x69, 0x61, 0x00, 0x4c, 0x65, 0x73, 0x6f, 0x74, 0x68, 0x6f, 0x00,
+  0x4c, 0x69, 0x74, 0x68, 0x75, 0x61, 0x6e, 0x69, 0x61, 0x00, 0x4c, 0x61, 0x74, 0x76, 0x69, 0x61,
+  0x00, 0x4c, 0x69, 0x62, 0x79, 0x61, 0x00, 0x4d, 0x6f, 0x72, 0x6f, 0x63, 0x63, 0x6f, 0x00, 0x4d,
+  0x6f, 0x6c, 0x64, 0x6f, 0x76, 0x61, 0x00, 0x4d, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x65, 0x67, 0x72,
+  0x6f, 0x00, 0x53, 0x74, 0x20, 0x4d, 0x61, 0x72, 0x74, 0x69, 0x6e, 0x20, 0x28, 0x46, 0x72, 0x65,
+  0x6e, 0x63, 0x68, 0x29, 0x00, 0x4d, 0x61, 0x64, 0x61, 0x67, 0x61, 0x73, 0x63, 0x61, 0x72, 0x00,
+  0x4d, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6c, 0x6c, 0x20, 0x49, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x73,
+  0x00, 0x4e, 0x6f, 0x72, 0x74, 0x68, 0x20, 0x4d, 0x61, 0x63, 0x65, 0x64, 0x6f, 0x6e, 0x69, 0x61,
+  0x00, 0x4d, 0x61, 0x6c, 0x69, 0x00, 0x4d, 0x79, 0x61, 0x6e, 0x6d, 0x61, 0x72, 0x20, 0x28, 0x42,
+  0x75, 0x72, 0x6d, 0x61, 0x29, 0x00, 0x4d, 0x6f, 0x6e, 0x67, 0x6f, 0x6c, 0x69, 0x61, 0x00, 0x4e,
+  0x6f, 0x72, 0x74, 0x68, 0x65, 0x72, 0x6e, 0x20, 0x4d, 0x61, 0x72, 0x69, 0x61, 0x6e, 0x61, 0x20,
+  0x49, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x00, 0x4d, 0x61, 0x75, 0x72, 0x69, 0x74, 0x61, 0x6e,
+  0x69, 0x61, 0x00, 0x4d, 0x61, 0x6c, 0x61, 0x77, 0x69, 0x00, 0x4d, 0x65, 0x78, 0x69, 0x63, 0x6f,
+  0x00, 0x4d, 0x61, 0x6c, 0x61, 0x79, 0x73, 0x69, 0x61, 0x00, 0x4d, 0x6f, 0x7a, 0x61, 0x6d, 0x62,
+  0x69, 0x71, 0x75, 0x65, 0x00, 0x4e, 0x61, 0x6d, 0x69, 0x62, 0x69, 0x61, 0x00, 0x4e, 0x65, 0x77,
+  0x20, 0x43, 0x61, 0x6c, 0x65, 0x64, 0x6f, 0x6e, 0x69, 0x61, 0x00, 0x4e, 0x69, 0x67, 0x65, 0x72,
+  0x00, 0x4e, 0x6f, 0x72, 0x66, 0x6f, 0x6c, 0x6b, 0x20, 0x49, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x00,
+  0x4e, 0x69, 0x67, 0x65, 0x72, 0x69, 0x61, 0x00, 0x4e, 0x69, 0x63, 0x61, 0x72, 0x61, 0x67, 0x75,
+  0x61, 0x00, 0x4e, 0x65, 0x74, 0x68, 0x65, 0x72, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x00, 0x4e, 0x6f,
+  0x72, 0x77, 0x61, 0x79, 0x00, 0x4e, 0x65, 0x70, 0x61, 0x6c, 0x00, 0x4e, 0x65, 0x77, 0x20, 0x5a,
+  0x65, 0x61, 0x6c, 0x61, 0x6e, 0x64, 0x00, 0x4f, 0x6d, 0x61, 0x6e, 0x00, 0x50, 0x65, 0x72, 0x75,
+  0x00, 0x46, 0x72, 0x65, 0x6e, 0x63, 0x68, 0x20, 0x50, 0x6f, 0x6c, 0x79, 0x6e, 0x65, 0x73, 0x69,
+  0x61, 0x00, 0x50, 0x61, 0x70, 0x75, 0x61, 0x20, 0x4e, 0x65, 0x77, 0x20, 0x47, 0x75, 0x69, 0x6e,
+  0x65, 0x61, 0x00, 0x50, 0x68, 0x69, 0x6c, 0x69, 0x70, 0x70, 0x69, 0x6e, 0x65, 0x73, 0x00, 0x50,
+  0x61, 0x6b, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x00, 0x50, 0x6f, 0x6c, 0x61, 0x6e, 0x64, 0x00, 0x53,
+  0x74, 0x20, 0x50, 0x69, 0x65, 0x72, 0x72, 0x65, 0x20, 0x26, 0x20, 0x4d, 0x69, 0x71, 0x75, 0x65,
+  0x6c, 0x6f, 0x6e, 0x00, 0x50, 0x61, 0x6c, 0x65, 0x73, 0x74, 0x69, 0x6e, 0x65, 0x00, 0x50, 0x6f,
+  0x72, 0x74, 0x75, 0x67, 0x61, 0x6c, 0x00, 0x50, 0x61, 0x72, 0x61, 0x67, 0x75, 0x61, 0x79, 0x00,
+  0x52, 0x3f, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x00, 0x52, 0x6f, 0x6d, 0x61, 0x6e, 0x69, 0x61, 0x00,
+  0x53, 0x65, 0x72, 0x62, 0x69, 0x61, 0x00, 0x52, 0x75, 0x73, 0x73, 0x69, 0x61, 0x00, 0x52, 0x77,
+  0x61, 0x6e, 0x64, 0x61, 0x00, 0x53, 0x61, 0x75, 0x64, 0x69, 0x20, 0x41, 0x72, 0x61, 0x62, 0x69,
+  0x61, 0x00, 0x53, 0x6f, 0x6c, 0x6f, 0x6d, 0x6f, 0x6e, 0x20, 0x49, 0x73, 0x6c, 0x61, 0x6e, 0x64,
+  0x73, 0x00, 0x53, 0x65, 0x79, 0x63, 0x68, 0x65, 0x6c, 0x6c, 0x65, 0x73, 0x00, 0x53, 0x75, 0x64,
+  0x61, 0x6e, 0x00, 0x53, 0x77, 0x65, 0x64, 0x65, 0x6e, 0x00, 0x53, 0x6c, 0x6f, 0x76, 0x65, 0x6e,
+  0x69, 0x61, 0x00, 0x53, 0x76, 0x61, 0x6c, 0x62, 0x61, 0x72, 0x64, 0x20, 0x26, 0x20, 0x4a, 0x61,
+  0x6e, 0x20, 0x4d, 0x61, 0x79, 0x65, 0x6e, 0x00, 0x53, 0x6c, 0x6f, 0x76, 0x61, 0x6b, 0x69, 0x61,
+  0x00, 0x53, 0x69, 0x65, 0x72, 0x72, 0x61, 0x20, 0x4c, 0x65, 0x6f, 0x6e, 0x65, 0x00, 0x53, 0x65,
+  0x6e, 0x65, 0x67, 0x61, 0x6c, 0x00, 0x53, 0x6f, 0x6d, 0x61, 0x6c, 0x69, 0x61, 0x00, 0x53, 0x75,
+  0x72, 0x69, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x53, 0x6f, 0x75, 0x74, 0x68, 0x20, 0x53, 0x75, 0x64,
+  0x61, 0x6e, 0x00, 0x53, 0x61, 0x6f, 0x20, 0x54, 0x6f, 0x6d, 0x65, 0x20, 0x26, 0x20, 0x50, 0x72,
+  0x69, 0x6e, 0x63, 0x69, 0x70, 0x65, 0x00, 0x53, 0x74, 0x20, 0x4d, 0x61, 0x61, 0x72, 0x74, 0x65,
+  0x6e, 0x20, 0x28, 0x44, 0x75, 0x74, 0x63, 0x68, 0x29, 0x00, 0x53, 0x79, 0x72, 0x69, 0x61, 0x00,
+  0x45, 0x73, 0x77, 0x61, 0x74, 0x69, 0x6e, 0x69, 0x20, 0x28, 0x53, 0x77, 0x61, 0x7a, 0x69, 0x6c,
+  0x61, 0x6e, 0x64, 0x29, 0x00, 0x54, 0x75, 0x72, 0x6b, 0x73, 0x20, 0x26, 0x20, 0x43, 0x61, 0x69,
+  0x63, 0x6f, 0x73, 0x20, 0x49, 0x73, 0x00, 0x43, 0x68, 0x61, 0x64, 0x00, 0x46, 0x72, 0x65, 0x6e,
+  0x63, 0x68, 0x20, 0x53, 0x2e, 0x20, 0x54, 0x65, 0x72, 0x72, 0x2e, 0x00, 0x54, 0x6f, 0x67, 0x6f,
+  0x00, 0x54, 0x68, 0x61, 0x69, 0x6c, 0x61, 0x6e, 0x64, 0x00, 0x54, 0x61, 0x6a, 0x69, 0x6b, 0x69,
+  0x73, 0x74, 0x61, 0x6e, 0x00, 0x54, 0x6f, 0x6b, 0x65, 0x6c, 0x61, 0x75, 0x00, 0x45, 0x61, 0x73,
+  0x74, 0x20, 0x54, 0x69, 0x6d, 0x6f, 0x72, 0x00, 0x54, 0x75, 0x72, 0x6b, 0x6d, 0x65, 0x6e, 0x69,
+  0x73, 0x74, 0x61, 0x6e, 0x00, 0x54, 0x75, 0x6e, 0x69, 0x73, 0x69, 0x61, 0x00, 0x54, 0x6f, 0x6e,
+  0x67, 0x61, 0x00, 0x54, 0x75, 0x72, 0x6b, 0x65, 0x79, 0x00, 0x54, 0x72, 0x69, 0x6e, 0x69, 0x64,
+  0x61, 0x64, 0x20, 0x26, 0x20, 0x54, 0x6f, 0x62, 0x61, 0x67, 0x6f, 0x00, 0x54, 0x75, 0x76, 0x61,
+  0x6c, 0x75, 0x00, 0x54, 0x61, 0x69, 0x77, 0x61, 0x6e, 0x00, 0x54, 0x61, 0x6e, 0x7a, 0x61, 0x6e,
+  0x69, 0x61, 0x00, 0x55, 0x6b, 0x72, 0x61, 0x69, 0x6e, 0x65, 0x00, 0x55, 0x67, 0x61, 0x6e, 0x64,
+  0x61, 0x00, 0x55, 0x53, 0x20, 0x6d, 0x69, 0x6e, 0x6f, 0x72, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x79,
+  0x69, 0x6e, 0x67, 0x20, 0x69, 0x73, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x00, 0x55, 0x6e, 0x69, 0x74,
+  0x65, 0x64, 0x20, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x00, 0x55, 0x72, 0x75, 0x67, 0x75, 0x61,
+  0x79, 0x00, 0x55, 0x7a, 0x62, 0x65, 0x6b, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x00, 0x56, 0x61, 0x74,
+  0x69, 0x63, 0x61, 0x6e, 0x20, 0x43, 0x69, 0x74, 0x79, 0x00, 0x56, 0x65, 0x6e, 0x65, 0x7a, 0x75,
+  0x65, 0x6c, 0x61, 0x00, 0x56, 0x69, 0x72, 0x67, 0x69, 0x6e, 0x20, 0x49, 0x73, 0x6c, 0x61, 0x6e,
+  0x64, 0x73, 0x20, 0x28, 0x55, 0x4b, 0x29, 0x00, 0x56, 0x69, 0x72, 0x67, 0x69, 0x6e, 0x20, 0x49,
+  0x73, 0x6c, 0x61, 0x6e, 0x64, 0x73, 0x20, 0x28, 0x55, 0x53, 0x29, 0x00, 0x56, 0x69, 0x65, 0x74,
+  0x6e, 0x61, 0x6d, 0x00, 0x56, 0x61, 0x6e, 0x75, 0x61, 0x74, 0x75, 0x00, 0x57, 0x61, 0x6c, 0x6c,
+  0x69, 0x73, 0x20, 0x26, 0x20, 0x46, 0x75, 0x74, 0x75, 0x6e, 0x61, 0x00, 0x53, 0x61, 0x6d, 0x6f,
+  0x61, 0x20, 0x28, 0x77, 0x65, 0x73, 0x74, 0x65, 0x72, 0x6e, 0x29, 0x00, 0x59, 0x65, 0x6d, 0x65,
+  0x6e, 0x00, 0x53, 0x6f, 0x75, 0x74, 0x68, 0x20, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x00, 0x5a,
+  0x61, 0x6d, 0x62, 0x69, 0x61, 0x00, 0x5a, 0x69, 0x6d, 0x62, 0x61, 0x62, 0x77, 0x65, 0x00, 0x41,
+  0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x62, 0x69, 0x64, 0x6a, 0x61, 0x6e, 0x00, 0x41, 0x66,
+  0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x63, 0x63, 0x72, 0x61, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x41, 0x64, 0x64, 0x69, 0x73, 0x5f, 0x41, 0x62, 0x61, 0x62, 0x61, 0x00, 0x41, 0x66,
+  0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x6c, 0x67, 0x69, 0x65, 0x72, 0x73, 0x00, 0x41, 0x66, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x41, 0x73, 0x6d, 0x61, 0x72, 0x61, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x42, 0x61, 0x6d, 0x61, 0x6b, 0x6f, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x42, 0x61, 0x6e, 0x67, 0x75, 0x69, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x42, 0x61,
+  0x6e, 0x6a, 0x75, 0x6c, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x42, 0x69, 0x73, 0x73,
+  0x61, 0x75, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x42, 0x6c, 0x61, 0x6e, 0x74, 0x79,
+  0x72, 0x65, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x42, 0x72, 0x61, 0x7a, 0x7a, 0x61,
+  0x76, 0x69, 0x6c, 0x6c, 0x65, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x42, 0x75, 0x6a,
+  0x75, 0x6d, 0x62, 0x75, 0x72, 0x61, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43, 0x61,
+  0x69, 0x72, 0x6f, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43, 0x61, 0x73, 0x61, 0x62,
+  0x6c, 0x61, 0x6e, 0x63, 0x61, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43, 0x65, 0x75,
+  0x74, 0x61, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43, 0x6f, 0x6e, 0x61, 0x6b, 0x72,
+  0x79, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x44, 0x61, 0x6b, 0x61, 0x72, 0x00, 0x41,
+  0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x44, 0x61, 0x72, 0x5f, 0x65, 0x73, 0x5f, 0x53, 0x61, 0x6c,
+  0x61, 0x61, 0x6d, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x44, 0x6a, 0x69, 0x62, 0x6f,
+  0x75, 0x74, 0x69, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x44, 0x6f, 0x75, 0x61, 0x6c,
+  0x61, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x45, 0x6c, 0x5f, 0x41, 0x61, 0x69, 0x75,
+  0x6e, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x46, 0x72, 0x65, 0x65, 0x74, 0x6f, 0x77,
+  0x6e, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x47, 0x61, 0x62, 0x6f, 0x72, 0x6f, 0x6e,
+  0x65, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x48, 0x61, 0x72, 0x61, 0x72, 0x65, 0x00,
+  0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4a, 0x6f, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x73, 0x62,
+  0x75, 0x72, 0x67, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4a, 0x75, 0x62, 0x61, 0x00,
+  0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4b, 0x61, 0x6d, 0x70, 0x61, 0x6c, 0x61, 0x00, 0x41,
+  0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4b, 0x68, 0x61, 0x72, 0x74, 0x6f, 0x75, 0x6d, 0x00, 0x41,
+  0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4b, 0x69, 0x67, 0x61, 0x6c, 0x69, 0x00, 0x41, 0x66, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x4b, 0x69, 0x6e, 0x73, 0x68, 0x61, 0x73, 0x61, 0x00, 0x41, 0x66, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x4c, 0x61, 0x67, 0x6f, 0x73, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x4c, 0x69, 0x62, 0x72, 0x65, 0x76, 0x69, 0x6c, 0x6c, 0x65, 0x00, 0x41, 0x66, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x4c, 0x6f, 0x6d, 0x65, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4c,
+  0x75, 0x61, 0x6e, 0x64, 0x61, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4c, 0x75, 0x62,
+  0x75, 0x6d, 0x62, 0x61, 0x73, 0x68, 0x69, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4c,
+  0x75, 0x73, 0x61, 0x6b, 0x61, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x61, 0x6c,
+  0x61, 0x62, 0x6f, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x61, 0x70, 0x75, 0x74,
+  0x6f, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x61, 0x73, 0x65, 0x72, 0x75, 0x00,
+  0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x62, 0x61, 0x62, 0x61, 0x6e, 0x65, 0x00, 0x41,
+  0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x6f, 0x67, 0x61, 0x64, 0x69, 0x73, 0x68, 0x75, 0x00,
+  0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x6f, 0x6e, 0x72, 0x6f, 0x76, 0x69, 0x61, 0x00,
+  0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4e, 0x61, 0x69, 0x72, 0x6f, 0x62, 0x69, 0x00, 0x41,
+  0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4e, 0x64, 0x6a, 0x61, 0x6d, 0x65, 0x6e, 0x61, 0x00, 0x41,
+  0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4e, 0x69, 0x61, 0x6d, 0x65, 0x79, 0x00, 0x41, 0x66, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x4e, 0x6f, 0x75, 0x61, 0x6b, 0x63, 0x68, 0x6f, 0x74, 0x74, 0x00, 0x41,
+  0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4f, 0x75, 0x61, 0x67, 0x61, 0x64, 0x6f, 0x75, 0x67, 0x6f,
+  0x75, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x50, 0x6f, 0x72, 0x74, 0x6f, 0x2d, 0x4e,
+  0x6f, 0x76, 0x6f, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x53, 0x61, 0x6f, 0x5f, 0x54,
+  0x6f, 0x6d, 0x65, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x54, 0x72, 0x69, 0x70, 0x6f,
+  0x6c, 0x69, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x54, 0x75, 0x6e, 0x69, 0x73, 0x00,
+  0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x57, 0x69, 0x6e, 0x64, 0x68, 0x6f, 0x65, 0x6b, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x64, 0x61, 0x6b, 0x00, 0x41, 0x6d, 0x65,
+  0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x00, 0x41,
+  0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x6e, 0x67, 0x75, 0x69, 0x6c, 0x6c, 0x61, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x6e, 0x74, 0x69, 0x67, 0x75, 0x61, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x72, 0x61, 0x67, 0x75, 0x61, 0x69, 0x6e,
+  0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x72, 0x67, 0x65, 0x6e, 0x74,
+  0x69, 0x6e, 0x61, 0x2f, 0x42, 0x75, 0x65, 0x6e, 0x6f, 0x73, 0x5f, 0x41, 0x69, 0x72, 0x65, 0x73,
+  0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x72, 0x67, 0x65, 0x6e, 0x74, 0x69,
+  0x6e, 0x61, 0x2f, 0x43, 0x61, 0x74, 0x61, 0x6d, 0x61, 0x72, 0x63, 0x61, 0x00, 0x41, 0x6d, 0x65,
+  0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x72, 0x67, 0x65, 0x6e, 0x74, 0x69, 0x6e, 0x61, 0x2f, 0x43,
+  0x6f, 0x72, 0x64, 0x6f, 0x62, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41,
+  0x72, 0x67, 0x65, 0x6e, 0x74, 0x69, 0x6e, 0x61, 0x2f, 0x4a, 0x75, 0x6a, 0x75, 0x79, 0x00, 0x41,
+  0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x72, 0x67, 0x65, 0x6e, 0x74, 0x69, 0x6e, 0x61,
+  0x2f, 0x4c, 0x61, 0x5f, 0x52, 0x69, 0x6f, 0x6a, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x41, 0x72, 0x67, 0x65, 0x6e, 0x74, 0x69, 0x6e, 0x61, 0x2f, 0x4d, 0x65, 0x6e, 0x64,
+  0x6f, 0x7a, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x72, 0x67, 0x65,
+  0x6e, 0x74, 0x69, 0x6e, 0x61, 0x2f, 0x52, 0x69, 0x6f, 0x5f, 0x47, 0x61, 0x6c, 0x6c, 0x65, 0x67,
+  0x6f, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x72, 0x67, 0x65, 0x6e,
+  0x74, 0x69, 0x6e, 0x61, 0x2f, 0x53, 0x61, 0x6c, 0x74, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x41, 0x72, 0x67, 0x65, 0x6e, 0x74, 0x69, 0x6e, 0x61, 0x2f, 0x53, 0x61, 0x6e,
+  0x5f, 0x4a, 0x75, 0x61, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x72,
+  0x67, 0x65, 0x6e, 0x74, 0x69, 0x6e, 0x61, 0x2f, 0x53, 0x61, 0x6e, 0x5f, 0x4c, 0x75, 0x69, 0x73,
+  0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x72, 0x67, 0x65, 0x6e, 0x74, 0x69,
+  0x6e, 0x61, 0x2f, 0x54, 0x75, 0x63, 0x75, 0x6d, 0x61, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x41, 0x72, 0x67, 0x65, 0x6e, 0x74, 0x69, 0x6e, 0x61, 0x2f, 0x55, 0x73, 0x68,
+  0x75, 0x61, 0x69, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x72, 0x75,
+  0x62, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x73, 0x75, 0x6e, 0x63,
+  0x69, 0x6f, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x74, 0x69, 0x6b,
+  0x6f, 0x6b, 0x61, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x42, 0x61, 0x68,
+  0x69, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x42, 0x61, 0x68, 0x69, 0x61,
+  0x5f, 0x42, 0x61, 0x6e, 0x64, 0x65, 0x72, 0x61, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x42, 0x61, 0x72, 0x62, 0x61, 0x64, 0x6f, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x42, 0x65, 0x6c, 0x65, 0x6d, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x42, 0x65, 0x6c, 0x69, 0x7a, 0x65, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x42, 0x6c, 0x61, 0x6e, 0x63, 0x2d, 0x53, 0x61, 0x62, 0x6c, 0x6f, 0x6e, 0x00, 0x41, 0x6d, 0x65,
+  0x72, 0x69, 0x63, 0x61, 0x2f, 0x42, 0x6f, 0x61, 0x5f, 0x56, 0x69, 0x73, 0x74, 0x61, 0x00, 0x41,
+  0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x42, 0x6f, 0x67, 0x6f, 0x74, 0x61, 0x00, 0x41, 0x6d,
+  0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x42, 0x6f, 0x69, 0x73, 0x65, 0x00, 0x41, 0x6d, 0x65, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x43, 0x61, 0x6d, 0x62, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x42, 0x61,
+  0x79, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43, 0x61, 0x6d, 0x70, 0x6f, 0x5f,
+  0x47, 0x72, 0x61, 0x6e, 0x64, 0x65, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43,
+  0x61, 0x6e, 0x63, 0x75, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43, 0x61,
+  0x72, 0x61, 0x63, 0x61, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43, 0x61,
+  0x79, 0x65, 0x6e, 0x6e, 0x65, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43, 0x61,
+  0x79, 0x6d, 0x61, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43, 0x68, 0x69,
+  0x63, 0x61, 0x67, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43, 0x68, 0x69,
+  0x68, 0x75, 0x61, 0x68, 0x75, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43,
+  0x69, 0x75, 0x64, 0x61, 0x64, 0x5f, 0x4a, 0x75, 0x61, 0x72, 0x65, 0x7a, 0x00, 0x41, 0x6d, 0x65,
+  0x72, 0x69, 0x63, 0x61, 0x2f, 0x43, 0x6f, 0x73, 0x74, 0x61, 0x5f, 0x52, 0x69, 0x63, 0x61, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43, 0x6f, 0x79, 0x68, 0x61, 0x69, 0x71, 0x75,
+  0x65, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43, 0x72, 0x65, 0x73, 0x74, 0x6f,
+  0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43, 0x75, 0x69, 0x61, 0x62, 0x61,
+  0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43, 0x75, 0x72, 0x61, 0x63, 0x61, 0x6f,
+  0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x44, 0x61, 0x6e, 0x6d, 0x61, 0x72, 0x6b,
+  0x73, 0x68, 0x61, 0x76, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x44, 0x61,
+  0x77, 0x73, 0x6f, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x44, 0x61, 0x77,
+  0x73, 0x6f, 0x6e, 0x5f, 0x43, 0x72, 0x65, 0x65, 0x6b, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x44, 0x65, 0x6e, 0x76, 0x65, 0x72, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x44, 0x65, 0x74, 0x72, 0x6f, 0x69, 0x74, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x44, 0x6f, 0x6d, 0x69, 0x6e, 0x69, 0x63, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x45, 0x64, 0x6d, 0x6f, 0x6e, 0x74, 0x6f, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x45, 0x69, 0x72, 0x75, 0x6e, 0x65, 0x70, 0x65, 0x00, 0x41, 0x6d, 0x65, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x45, 0x6c, 0x5f, 0x53, 0x61, 0x6c, 0x76, 0x61, 0x64, 0x6f, 0x72, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x46, 0x6f, 0x72, 0x74, 0x5f, 0x4e, 0x65, 0x6c,
+  0x73, 0x6f, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x46, 0x6f, 0x72, 0x74,
+  0x61, 0x6c, 0x65, 0x7a, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x47, 0x6c,
+  0x61, 0x63, 0x65, 0x5f, 0x42, 0x61, 0x79, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x47, 0x6f, 0x6f, 0x73, 0x65, 0x5f, 0x42, 0x61, 0x79, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x47, 0x72, 0x61, 0x6e, 0x64, 0x5f, 0x54, 0x75, 0x72, 0x6b, 0x00, 0x41, 0x6d, 0x65,
+  0x72, 0x69, 0x63, 0x61, 0x2f, 0x47, 0x72, 0x65, 0x6e, 0x61, 0x64, 0x61, 0x00, 0x41, 0x6d, 0x65,
+  0x72, 0x69, 0x63, 0x61, 0x2f, 0x47, 0x75, 0x61, 0x64, 0x65, 0x6c, 0x6f, 0x75, 0x70, 0x65, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x47, 0x75, 0x61, 0x74, 0x65, 0x6d, 0x61, 0x6c,
+  0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x47, 0x75, 0x61, 0x79, 0x61, 0x71,
+  0x75, 0x69, 0x6c, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x47, 0x75, 0x79, 0x61,
+  0x6e, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x48, 0x61, 0x6c, 0x69, 0x66,
+  0x61, 0x78, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x48, 0x61, 0x76, 0x61, 0x6e,
+  0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x48, 0x65, 0x72, 0x6d, 0x6f, 0x73,
+  0x69, 0x6c, 0x6c, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x49, 0x6e, 0x64,
+  0x69, 0x61, 0x6e, 0x61, 0x2f, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x61, 0x70, 0x6f, 0x6c, 0x69,
+  0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e,
+  0x61, 0x2f, 0x4b, 0x6e, 0x6f, 0x78, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x49,
+  0x6e, 0x64, 0x69, 0x61, 0x6e, 0x61, 0x2f, 0x4d, 0x61, 0x72, 0x65, 0x6e, 0x67, 0x6f, 0x00, 0x41,
+  0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x61, 0x2f, 0x50,
+  0x65, 0x74, 0x65, 0x72, 0x73, 0x62, 0x75, 0x72, 0x67, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x61, 0x2f, 0x54, 0x65, 0x6c, 0x6c, 0x5f, 0x43,
+  0x69, 0x74, 0x79, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x49, 0x6e, 0x64, 0x69,
+  0x61, 0x6e, 0x61, 0x2f, 0x56, 0x65, 0x76, 0x61, 0x79, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x61, 0x2f, 0x56, 0x69, 0x6e, 0x63, 0x65, 0x6e,
+  0x6e, 0x65, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x49, 0x6e, 0x64, 0x69,
+  0x61, 0x6e, 0x61, 0x2f, 0x57, 0x69, 0x6e, 0x61, 0x6d, 0x61, 0x63, 0x00, 0x41, 0x6d, 0x65, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x49, 0x6e, 0x75, 0x76, 0x69, 0x6b, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x49, 0x71, 0x61, 0x6c, 0x75, 0x69, 0x74, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x4a, 0x61, 0x6d, 0x61, 0x69, 0x63, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x4a, 0x75, 0x6e, 0x65, 0x61, 0x75, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x4b, 0x65, 0x6e, 0x74, 0x75, 0x63, 0x6b, 0x79, 0x2f, 0x4c, 0x6f, 0x75, 0x69, 0x73,
+  0x76, 0x69, 0x6c, 0x6c, 0x65, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4b, 0x65,
+  0x6e, 0x74, 0x75, 0x63, 0x6b, 0x79, 0x2f, 0x4d, 0x6f, 0x6e, 0x74, 0x69, 0x63, 0x65, 0x6c, 0x6c,
+  0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4b, 0x72, 0x61, 0x6c, 0x65, 0x6e,
+  0x64, 0x69, 0x6a, 0x6b, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4c, 0x61, 0x5f,
+  0x50, 0x61, 0x7a, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4c, 0x69, 0x6d, 0x61,
+  0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4c, 0x6f, 0x73, 0x5f, 0x41, 0x6e, 0x67,
+  0x65, 0x6c, 0x65, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4c, 0x6f, 0x77,
+  0x65, 0x72, 0x5f, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x65, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x4d, 0x61, 0x63, 0x65, 0x69, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x4d, 0x61, 0x6e, 0x61, 0x67, 0x75, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x4d, 0x61, 0x6e, 0x61, 0x75, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x4d, 0x61, 0x72, 0x69, 0x67, 0x6f, 0x74, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x4d, 0x61, 0x72, 0x74, 0x69, 0x6e, 0x69, 0x71, 0x75, 0x65, 0x00, 0x41, 0x6d, 0x65, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x4d, 0x61, 0x74, 0x61, 0x6d, 0x6f, 0x72, 0x6f, 0x73, 0x00, 0x41, 0x6d,
+  0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x61, 0x7a, 0x61, 0x74, 0x6c, 0x61, 0x6e, 0x00, 0x41,
+  0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x65, 0x6e, 0x6f, 0x6d, 0x69, 0x6e, 0x65, 0x65,
+  0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x65, 0x72, 0x69, 0x64, 0x61, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x65, 0x74, 0x6c, 0x61, 0x6b, 0x61, 0x74,
+  0x6c, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x65, 0x78, 0x69, 0x63,
+  0x6f, 0x5f, 0x43, 0x69, 0x74, 0x79, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d,
+  0x69, 0x71, 0x75, 0x65, 0x6c, 0x6f, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x4d, 0x6f, 0x6e, 0x63, 0x74, 0x6f, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x4d, 0x6f, 0x6e, 0x74, 0x65, 0x72, 0x72, 0x65, 0x79, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x4d, 0x6f, 0x6e, 0x74, 0x65, 0x76, 0x69, 0x64, 0x65, 0x6f, 0x00, 0x41, 0x6d, 0x65,
+  0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x6f, 0x6e, 0x74, 0x73, 0x65, 0x72, 0x72, 0x61, 0x74, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4e, 0x61, 0x73, 0x73, 0x61, 0x75, 0x00, 0x41,
+  0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4e, 0x65, 0x77, 0x5f, 0x59, 0x6f, 0x72, 0x6b, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4e, 0x6f, 0x6d, 0x65, 0x00, 0x41, 0x6d, 0x65,
+  0x72, 0x69, 0x63, 0x61, 0x2f, 0x4e, 0x6f, 0x72, 0x6f, 0x6e, 0x68, 0x61, 0x00, 0x41, 0x6d, 0x65,
+  0x72, 0x69, 0x63, 0x61, 0x2f, 0x4e, 0x6f, 0x72, 0x74, 0x68, 0x5f, 0x44, 0x61, 0x6b, 0x6f, 0x74,
+  0x61, 0x2f, 0x42, 0x65, 0x75, 0x6c, 0x61, 0x68, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x4e, 0x6f, 0x72, 0x74, 0x68, 0x5f, 0x44, 0x61, 0x6b, 0x6f, 0x74, 0x61, 0x2f, 0x43, 0x65,
+  0x6e, 0x74, 0x65, 0x72, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4e, 0x6f, 0x72,
+  0x74, 0x68, 0x5f, 0x44, 0x61, 0x6b, 0x6f, 0x74, 0x61, 0x2f, 0x4e, 0x65, 0x77, 0x5f, 0x53, 0x61,
+  0x6c, 0x65, 0x6d, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4e, 0x75, 0x75, 0x6b,
+  0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4f, 0x6a, 0x69, 0x6e, 0x61, 0x67, 0x61,
+  0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x50, 0x61, 0x6e, 0x61, 0x6d, 0x61, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x61, 0x72, 0x69,
+  0x62, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x50, 0x68, 0x6f, 0x65, 0x6e,
+  0x69, 0x78, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x50, 0x6f, 0x72, 0x74, 0x2d,
+  0x61, 0x75, 0x2d, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x65, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x50, 0x6f, 0x72, 0x74, 0x5f, 0x6f, 0x66, 0x5f, 0x53, 0x70, 0x61, 0x69, 0x6e, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x50, 0x6f, 0x72, 0x74, 0x6f, 0x5f, 0x56, 0x65,
+  0x6c, 0x68, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x50, 0x75, 0x65, 0x72,
+  0x74, 0x6f, 0x5f, 0x52, 0x69, 0x63, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x50, 0x75, 0x6e, 0x74, 0x61, 0x5f, 0x41, 0x72, 0x65, 0x6e, 0x61, 0x73, 0x00, 0x41, 0x6d, 0x65,
+  0x72, 0x69, 0x63, 0x61, 0x2f, 0x52, 0x61, 0x6e, 0x6b, 0x69, 0x6e, 0x5f, 0x49, 0x6e, 0x6c, 0x65,
+  0x74, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x52, 0x65, 0x63, 0x69, 0x66, 0x65,
+  0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x52, 0x65, 0x67, 0x69, 0x6e, 0x61, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65,
+  0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x52, 0x69, 0x6f, 0x5f, 0x42, 0x72, 0x61,
+  0x6e, 0x63, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x53, 0x61, 0x6e, 0x74,
+  0x61, 0x72, 0x65, 0x6d, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x53, 0x61, 0x6e,
+  0x74, 0x69, 0x61, 0x67, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x53, 0x61,
+  0x6e, 0x74, 0x6f, 0x5f, 0x44, 0x6f, 0x6d, 0x69, 0x6e, 0x67, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x53, 0x61, 0x6f, 0x5f, 0x50, 0x61, 0x75, 0x6c, 0x6f, 0x00, 0x41, 0x6d,
+  0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x62, 0x79, 0x73, 0x75,
+  0x6e, 0x64, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x53, 0x69, 0x74, 0x6b, 0x61,
+  0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x53, 0x74, 0x5f, 0x42, 0x61, 0x72, 0x74,
+  0x68, 0x65, 0x6c, 0x65, 0x6d, 0x79, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x53,
+  0x74, 0x5f, 0x4a, 0x6f, 0x68, 0x6e, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x53, 0x74, 0x5f, 0x4b, 0x69, 0x74, 0x74, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x53, 0x74, 0x5f, 0x4c, 0x75, 0x63, 0x69, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x53, 0x74, 0x5f, 0x54, 0x68, 0x6f, 0x6d, 0x61, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x53, 0x74, 0x5f, 0x56, 0x69, 0x6e, 0x63, 0x65, 0x6e, 0x74, 0x00, 0x41,
+  0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x53, 0x77, 0x69, 0x66, 0x74, 0x5f, 0x43, 0x75, 0x72,
+  0x72, 0x65, 0x6e, 0x74, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x54, 0x65, 0x67,
+  0x75, 0x63, 0x69, 0x67, 0x61, 0x6c, 0x70, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x54, 0x68, 0x75, 0x6c, 0x65, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x54,
+  0x69, 0x6a, 0x75, 0x61, 0x6e, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x54,
+  0x6f, 0x72, 0x6f, 0x6e, 0x74, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x54,
+  0x6f, 0x72, 0x74, 0x6f, 0x6c, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x56,
+  0x61, 0x6e, 0x63, 0x6f, 0x75, 0x76, 0x65, 0x72, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x57, 0x68, 0x69, 0x74, 0x65, 0x68, 0x6f, 0x72, 0x73, 0x65, 0x00, 0x41, 0x6d, 0x65, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x57, 0x69, 0x6e, 0x6e, 0x69, 0x70, 0x65, 0x67, 0x00, 0x41, 0x6d, 0x65,
+  0x72, 0x69, 0x63, 0x61, 0x2f, 0x59, 0x61, 0x6b, 0x75, 0x74, 0x61, 0x74, 0x00, 0x41, 0x6e, 0x74,
+  0x61, 0x72, 0x63, 0x74, 0x69, 0x63, 0x61, 0x2f, 0x43, 0x61, 0x73, 0x65, 0x79, 0x00, 0x41, 0x6e,
+  0x74, 0x61, 0x72, 0x63, 0x74, 0x69, 0x63, 0x61, 0x2f, 0x44, 0x61, 0x76, 0x69, 0x73, 0x00, 0x41,
+  0x6e, 0x74, 0x61, 0x72, 0x63, 0x74, 0x69, 0x63, 0x61, 0x2f, 0x44, 0x75, 0x6d, 0x6f, 0x6e, 0x74,
+  0x44, 0x55, 0x72, 0x76, 0x69, 0x6c, 0x6c, 0x65, 0x00, 0x41, 0x6e, 0x74, 0x61, 0x72, 0x63, 0x74,
+  0x69, 0x63, 0x61, 0x2f, 0x4d, 0x61, 0x63, 0x71, 0x75, 0x61, 0x72, 0x69, 0x65, 0x00, 0x41, 0x6e,
+  0x74, 0x61, 0x72, 0x63, 0x74, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x61, 0x77, 0x73, 0x6f, 0x6e, 0x00,
+  0x41, 0x6e, 0x74, 0x61, 0x72, 0x63, 0x74, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x63, 0x4d, 0x75, 0x72,
+  0x64, 0x6f, 0x00, 0x41, 0x6e, 0x74, 0x61, 0x72, 0x63, 0x74, 0x69, 0x63, 0x61, 0x2f, 0x50, 0x61,
+  0x6c, 0x6d, 0x65, 0x72, 0x00, 0x41, 0x6e, 0x74, 0x61, 0x72, 0x63, 0x74, 0x69, 0x63, 0x61, 0x2f,
+  0x52, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x61, 0x00, 0x41, 0x6e, 0x74, 0x61, 0x72, 0x63, 0x74, 0x69,
+  0x63, 0x61, 0x2f, 0x53, 0x79, 0x6f, 0x77, 0x61, 0x00, 0x41, 0x6e, 0x74, 0x61, 0x72, 0x63, 0x74,
+  0x69, 0x63, 0x61, 0x2f, 0x54, 0x72, 0x6f, 0x6c, 0x6c, 0x00, 0x41, 0x6e, 0x74, 0x61, 0x72, 0x63,
+  0x74, 0x69, 0x63, 0x61, 0x2f, 0x56, 0x6f, 0x73, 0x74, 0x6f, 0x6b, 0x00, 0x41, 0x72, 0x63, 0x74,
+  0x69, 0x63, 0x2f, 0x4c, 0x6f, 0x6e, 0x67, 0x79, 0x65, 0x61, 0x72, 0x62, 0x79, 0x65, 0x6e, 0x00,
+  0x41, 0x73, 0x69, 0x61, 0x2f, 0x41, 0x64, 0x65, 0x6e, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x41,
+  0x6c, 0x6d, 0x61, 0x74, 0x79, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x41, 0x6d, 0x6d, 0x61, 0x6e,
+  0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x41, 0x6e, 0x61, 0x64, 0x79, 0x72, 0x00, 0x41, 0x73, 0x69,
+  0x61, 0x2f, 0x41, 0x71, 0x74, 0x61, 0x75, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x41, 0x71, 0x74,
+  0x6f, 0x62, 0x65, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x41, 0x73, 0x68, 0x67, 0x61, 0x62, 0x61,
+  0x74, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x41, 0x74, 0x79, 0x72, 0x61, 0x75, 0x00, 0x41, 0x73,
+  0x69, 0x61, 0x2f, 0x42, 0x61, 0x67, 0x68, 0x64, 0x61, 0x64, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f,
+  0x42, 0x61, 0x68, 0x72, 0x61, 0x69, 0x6e, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x42, 0x61, 0x6b,
+  0x75, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x42, 0x61, 0x6e, 0x67, 0x6b, 0x6f, 0x6b, 0x00, 0x41,
+  0x73, 0x69, 0x61, 0x2f, 0x42, 0x61, 0x72, 0x6e, 0x61, 0x75, 0x6c, 0x00, 0x41, 0x73, 0x69, 0x61,
+  0x2f, 0x42, 0x65, 0x69, 0x72, 0x75, 0x74, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x42, 0x69, 0x73,
+  0x68, 0x6b, 0x65, 0x6b, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x42, 0x72, 0x75, 0x6e, 0x65, 0x69,
+  0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x43, 0x68, 0x69, 0x74, 0x61, 0x00, 0x41, 0x73, 0x69, 0x61,
+  0x2f, 0x43, 0x6f, 0x6c, 0x6f, 0x6d, 0x62, 0x6f, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x44, 0x61,
+  0x6d, 0x61, 0x73, 0x63, 0x75, 0x73, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x44, 0x68, 0x61, 0x6b,
+  0x61, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x44, 0x69, 0x6c, 0x69, 0x00, 0x41, 0x73, 0x69, 0x61,
+  0x2f, 0x44, 0x75, 0x62, 0x61, 0x69, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x44, 0x75, 0x73, 0x68,
+  0x61, 0x6e, 0x62, 0x65, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x46, 0x61, 0x6d, 0x61, 0x67, 0x75,
+  0x73, 0x74, 0x61, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x47, 0x61, 0x7a, 0x61, 0x00, 0x41, 0x73,
+  0x69, 0x61, 0x2f, 0x48, 0x65, 0x62, 0x72, 0x6f, 0x6e, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x48,
+  0x6f, 0x5f, 0x43, 0x68, 0x69, 0x5f, 0x4d, 0x69, 0x6e, 0x68, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f,
+  0x48, 0x6f, 0x6e, 0x67, 0x5f, 0x4b, 0x6f, 0x6e, 0x67, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x48,
+  0x6f, 0x76, 0x64, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x49, 0x72, 0x6b, 0x75, 0x74, 0x73, 0x6b,
+  0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4a, 0x61, 0x6b, 0x61, 0x72, 0x74, 0x61, 0x00, 0x41, 0x73,
+  0x69, 0x61, 0x2f, 0x4a, 0x61, 0x79, 0x61, 0x70, 0x75, 0x72, 0x61, 0x00, 0x41, 0x73, 0x69, 0x61,
+  0x2f, 0x4a, 0x65, 0x72, 0x75, 0x73, 0x61, 0x6c, 0x65, 0x6d, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f,
+  0x4b, 0x61, 0x62, 0x75, 0x6c, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4b, 0x61, 0x6d, 0x63, 0x68,
+  0x61, 0x74, 0x6b, 0x61, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4b, 0x61, 0x72, 0x61, 0x63, 0x68,
+  0x69, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4b, 0x61, 0x74, 0x68, 0x6d, 0x61, 0x6e, 0x64, 0x75,
+  0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4b, 0x68, 0x61, 0x6e, 0x64, 0x79, 0x67, 0x61, 0x00, 0x41,
+  0x73, 0x69, 0x61, 0x2f, 0x4b, 0x6f, 0x6c, 0x6b, 0x61, 0x74, 0x61, 0x00, 0x41, 0x73, 0x69, 0x61,
+  0x2f, 0x4b, 0x72, 0x61, 0x73, 0x6e, 0x6f, 0x79, 0x61, 0x72, 0x73, 0x6b, 0x00, 0x41, 0x73, 0x69,
+  0x61, 0x2f, 0x4b, 0x75, 0x61, 0x6c, 0x61, 0x5f, 0x4c, 0x75, 0x6d, 0x70, 0x75, 0x72, 0x00, 0x41,
+  0x73, 0x69, 0x61, 0x2f, 0x4b, 0x75, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x00, 0x41, 0x73, 0x69, 0x61,
+  0x2f, 0x4b, 0x75, 0x77, 0x61, 0x69, 0x74, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4d, 0x61, 0x63,
+  0x61, 0x75, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4d, 0x61, 0x67, 0x61, 0x64, 0x61, 0x6e, 0x00,
+  0x41, 0x73, 0x69, 0x61, 0x2f, 0x4d, 0x61, 0x6b, 0x61, 0x73, 0x73, 0x61, 0x72, 0x00, 0x41, 0x73,
+  0x69, 0x61, 0x2f, 0x4d, 0x61, 0x6e, 0x69, 0x6c, 0x61, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4d,
+  0x75, 0x73, 0x63, 0x61, 0x74, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4e, 0x69, 0x63, 0x6f, 0x73,
+  0x69, 0x61, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4e, 0x6f, 0x76, 0x6f, 0x6b, 0x75, 0x7a, 0x6e,
+  0x65, 0x74, 0x73, 0x6b, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4e, 0x6f, 0x76, 0x6f, 0x73, 0x69,
+  0x62, 0x69, 0x72, 0x73, 0x6b, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4f, 0x6d, 0x73, 0x6b, 0x00,
+  0x41, 0x73, 0x69, 0x61, 0x2f, 0x4f, 0x72, 0x61, 0x6c, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x50,
+  0x68, 0x6e, 0x6f, 0x6d, 0x5f, 0x50, 0x65, 0x6e, 0x68, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x50,
+  0x6f, 0x6e, 0x74, 0x69, 0x61, 0x6e, 0x61, 0x6b, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x50, 0x79,
+  0x6f, 0x6e, 0x67, 0x79, 0x61, 0x6e, 0x67, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x51, 0x61, 0x74,
+  0x61, 0x72, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x51, 0x6f, 0x73, 0x74, 0x61, 0x6e, 0x61, 0x79,
+  0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x51, 0x79, 0x7a, 0x79, 0x6c, 0x6f, 0x72, 0x64, 0x61, 0x00,
+  0x41, 0x73, 0x69, 0x61, 0x2f, 0x52, 0x69, 0x79, 0x61, 0x64, 0x68, 0x00, 0x41, 0x73, 0x69, 0x61,
+  0x2f, 0x53, 0x61, 0x6b, 0x68, 0x61, 0x6c, 0x69, 0x6e, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x53,
+  0x61, 0x6d, 0x61, 0x72, 0x6b, 0x61, 0x6e, 0x64, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x53, 0x65,
+  0x6f, 0x75, 0x6c, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x53, 0x68, 0x61, 0x6e, 0x67, 0x68, 0x61,
+  0x69, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x53, 0x69, 0x6e, 0x67, 0x61, 0x70, 0x6f, 0x72, 0x65,
+  0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x53, 0x72, 0x65, 0x64, 0x6e, 0x65, 0x6b, 0x6f, 0x6c, 0x79,
+  0x6d, 0x73, 0x6b, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x54, 0x61, 0x69, 0x70, 0x65, 0x69, 0x00,
+  0x41, 0x73, 0x69, 0x61, 0x2f, 0x54, 0x61, 0x73, 0x68, 0x6b, 0x65, 0x6e, 0x74, 0x00, 0x41, 0x73,
+  0x69, 0x61, 0x2f, 0x54, 0x62, 0x69, 0x6c, 0x69, 0x73, 0x69, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f,
+  0x54, 0x65, 0x68, 0x72, 0x61, 0x6e, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x54, 0x68, 0x69, 0x6d,
+  0x70, 0x68, 0x75, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x54, 0x6f, 0x6b, 0x79, 0x6f, 0x00, 0x41,
+  0x73, 0x69, 0x61, 0x2f, 0x54, 0x6f, 0x6d, 0x73, 0x6b, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x55,
+  0x6c, 0x61, 0x61, 0x6e, 0x62, 0x61, 0x61, 0x74, 0x61, 0x72, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f,
+  0x55, 0x72, 0x75, 0x6d, 0x71, 0x69, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x55, 0x73, 0x74, 0x2d,
+  0x4e, 0x65, 0x72, 0x61, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x56, 0x69, 0x65, 0x6e, 0x74, 0x69,
+  0x61, 0x6e, 0x65, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x56, 0x6c, 0x61, 0x64, 0x69, 0x76, 0x6f,
+  0x73, 0x74, 0x6f, 0x6b, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x59, 0x61, 0x6b, 0x75, 0x74, 0x73,
+  0x6b, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x59, 0x61, 0x6e, 0x67, 0x6f, 0x6e, 0x00, 0x41, 0x73,
+  0x69, 0x61, 0x2f, 0x59, 0x65, 0x6b, 0x61, 0x74, 0x65, 0x72, 0x69, 0x6e, 0x62, 0x75, 0x72, 0x67,
+  0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x59, 0x65, 0x72, 0x65, 0x76, 0x61, 0x6e, 0x00, 0x41, 0x74,
+  0x6c, 0x61, 0x6e, 0x74, 0x69, 0x63, 0x2f, 0x41, 0x7a, 0x6f, 0x72, 0x65, 0x73, 0x00, 0x41, 0x74,
+  0x6c, 0x61, 0x6e, 0x74, 0x69, 0x63, 0x2f, 0x42, 0x65, 0x72, 0x6d, 0x75, 0x64, 0x61, 0x00, 0x41,
+  0x74, 0x6c, 0x61, 0x6e, 0x74, 0x69, 0x63, 0x2f, 0x43, 0x61, 0x6e, 0x61, 0x72, 0x79, 0x00, 0x41,
+  0x74, 0x6c, 0x61, 0x6e, 0x74, 0x69, 0x63, 0x2f, 0x43, 0x61, 0x70, 0x65, 0x5f, 0x56, 0x65, 0x72,
+  0x64, 0x65, 0x00, 0x41, 0x74, 0x6c, 0x61, 0x6e, 0x74, 0x69, 0x63, 0x2f, 0x46, 0x61, 0x72, 0x6f,
+  0x65, 0x00, 0x41, 0x74, 0x6c, 0x61, 0x6e, 0x74, 0x69, 0x63, 0x2f, 0x4d, 0x61, 0x64, 0x65, 0x69,
+  0x72, 0x61, 0x00, 0x41, 0x74, 0x6c, 0x61, 0x6e, 0x74, 0x69, 0x63, 0x2f, 0x52, 0x65, 0x79, 0x6b,
+  0x6a, 0x61, 0x76, 0x69, 0x6b, 0x00, 0x41, 0x74, 0x6c, 0x61, 0x6e, 0x74, 0x69, 0x63, 0x2f, 0x53,
+  0x6f, 0x75, 0x74, 0x68, 0x5f, 0x47, 0x65, 0x6f, 0x72, 0x67, 0x69, 0x61, 0x00, 0x41, 0x74, 0x6c,
+  0x61, 0x6e, 0x74, 0x69, 0x63, 0x2f, 0x53, 0x74, 0x5f, 0x48, 0x65, 0x6c, 0x65, 0x6e, 0x61, 0x00,
+  0x41, 0x74, 0x6c, 0x61, 0x6e, 0x74, 0x69, 0x63, 0x2f, 0x53, 0x74, 0x61, 0x6e, 0x6c, 0x65, 0x79,
+  0x00, 0x41, 0x75, 0x73, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x61, 0x2f, 0x41, 0x64, 0x65, 0x6c, 0x61,
+  0x69, 0x64, 0x65, 0x00, 0x41, 0x75, 0x73, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x61, 0x2f, 0x42, 0x72,
+  0x69, 0x73, 0x62, 0x61, 0x6e, 0x65, 0x00, 0x41, 0x75, 0x73, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x61,
+  0x2f, 0x42, 0x72, 0x6f, 0x6b, 0x65, 0x6e, 0x5f, 0x48, 0x69, 0x6c, 0x6c, 0x00, 0x41, 0x75, 0x73,
+  0x74, 0x72, 0x61, 0x6c, 0x69, 0x61, 0x2f, 0x44, 0x61, 0x72, 0x77, 0x69, 0x6e, 0x00, 0x41, 0x75,
+  0x73, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x61, 0x2f, 0x45, 0x75, 0x63, 0x6c, 0x61, 0x00, 0x41, 0x75,
+  0x73, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x61, 0x2f, 0x48, 0x6f, 0x62, 0x61, 0x72, 0x74, 0x00, 0x41,
+  0x75, 0x73, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x61, 0x2f, 0x4c, 0x69, 0x6e, 0x64, 0x65, 0x6d, 0x61,
+  0x6e, 0x00, 0x41, 0x75, 0x73, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x61, 0x2f, 0x4c, 0x6f, 0x72, 0x64,
+  0x5f, 0x48, 0x6f, 0x77, 0x65, 0x00, 0x41, 0x75, 0x73, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x61, 0x2f,
+  0x4d, 0x65, 0x6c, 0x62, 0x6f, 0x75, 0x72, 0x6e, 0x65, 0x00, 0x41, 0x75, 0x73, 0x74, 0x72, 0x61,
+  0x6c, 0x69, 0x61, 0x2f, 0x50, 0x65, 0x72, 0x74, 0x68, 0x00, 0x41, 0x75, 0x73, 0x74, 0x72, 0x61,
+  0x6c, 0x69, 0x61, 0x2f, 0x53, 0x79, 0x64, 0x6e, 0x65, 0x79, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70,
+  0x65, 0x2f, 0x41, 0x6d, 0x73, 0x74, 0x65, 0x72, 0x64, 0x61, 0x6d, 0x00, 0x45, 0x75, 0x72, 0x6f,
+  0x70, 0x65, 0x2f, 0x41, 0x6e, 0x64, 0x6f, 0x72, 0x72, 0x61, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70,
+  0x65, 0x2f, 0x41, 0x73, 0x74, 0x72, 0x61, 0x6b, 0x68, 0x61, 0x6e, 0x00, 0x45, 0x75, 0x72, 0x6f,
+  0x70, 0x65, 0x2f, 0x41, 0x74, 0x68, 0x65, 0x6e, 0x73, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65,
+  0x2f, 0x42, 0x65, 0x6c, 0x67, 0x72, 0x61, 0x64, 0x65, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65,
+  0x2f, 0x42, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x42,
+  0x72, 0x61, 0x74, 0x69, 0x73, 0x6c, 0x61, 0x76, 0x61, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65,
+  0x2f, 0x42, 0x72, 0x75, 0x73, 0x73, 0x65, 0x6c, 0x73, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65,
+  0x2f, 0x42, 0x75, 0x63, 0x68, 0x61, 0x72, 0x65, 0x73, 0x74, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70,
+  0x65, 0x2f, 0x42, 0x75, 0x64, 0x61, 0x70, 0x65, 0x73, 0x74, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70,
+  0x65, 0x2f, 0x42, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x65, 0x6e, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70,
+  0x65, 0x2f, 0x43, 0x68, 0x69, 0x73, 0x69, 0x6e, 0x61, 0x75, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70,
+  0x65, 0x2f, 0x43, 0x6f, 0x70, 0x65, 0x6e, 0x68, 0x61, 0x67, 0x65, 0x6e, 0x00, 0x45, 0x75, 0x72,
+  0x6f, 0x70, 0x65, 0x2f, 0x44, 0x75, 0x62, 0x6c, 0x69, 0x6e, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70,
+  0x65, 0x2f, 0x47, 0x69, 0x62, 0x72, 0x61, 0x6c, 0x74, 0x61, 0x72, 0x00, 0x45, 0x75, 0x72, 0x6f,
+  0x70, 0x65, 0x2f, 0x47, 0x75, 0x65, 0x72, 0x6e, 0x73, 0x65, 0x79, 0x00, 0x45, 0x75, 0x72, 0x6f,
+  0x70, 0x65, 0x2f, 0x48, 0x65, 0x6c, 0x73, 0x69, 0x6e, 0x6b, 0x69, 0x00, 0x45, 0x75, 0x72, 0x6f,
+  0x70, 0x65, 0x2f, 0x49, 0x73, 0x6c, 0x65, 0x5f, 0x6f, 0x66, 0x5f, 0x4d, 0x61, 0x6e, 0x00, 0x45,
+  0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x49, 0x73, 0x74, 0x61, 0x6e, 0x62, 0x75, 0x6c, 0x00, 0x45,
+  0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4a, 0x65, 0x72, 0x73, 0x65, 0x79, 0x00, 0x45, 0x75, 0x72,
+  0x6f, 0x70, 0x65, 0x2f, 0x4b, 0x61, 0x6c, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x00,
+  0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4b, 0x69, 0x72, 0x6f, 0x76, 0x00, 0x45, 0x75, 0x72,
+  0x6f, 0x70, 0x65, 0x2f, 0x4b, 0x79, 0x69, 0x76, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f,
+  0x4c, 0x69, 0x73, 0x62, 0x6f, 0x6e, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4c, 0x6a,
+  0x75, 0x62, 0x6c, 0x6a, 0x61, 0x6e, 0x61, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4c,
+  0x6f, 0x6e, 0x64, 0x6f, 0x6e, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4c, 0x75, 0x78,
+  0x65, 0x6d, 0x62, 0x6f, 0x75, 0x72, 0x67, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4d,
+  0x61, 0x64, 0x72, 0x69, 0x64, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4d, 0x61, 0x6c,
+  0x74, 0x61, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4d, 0x61, 0x72, 0x69, 0x65, 0x68,
+  0x61, 0x6d, 0x6e, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4d, 0x69, 0x6e, 0x73, 0x6b,
+  0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4d, 0x6f, 0x6e, 0x61, 0x63, 0x6f, 0x00, 0x45,
+  0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4d, 0x6f, 0x73, 0x63, 0x6f, 0x77, 0x00, 0x45, 0x75, 0x72,
+  0x6f, 0x70, 0x65, 0x2f, 0x4f, 0x73, 0x6c, 0x6f, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f,
+  0x50, 0x61, 0x72, 0x69, 0x73, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x50, 0x6f, 0x64,
+  0x67, 0x6f, 0x72, 0x69, 0x63, 0x61, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x50, 0x72,
+  0x61, 0x67, 0x75, 0x65, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x52, 0x69, 0x67, 0x61,
+  0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x52, 0x6f, 0x6d, 0x65, 0x00, 0x45, 0x75, 0x72,
+  0x6f, 0x70, 0x65, 0x2f, 0x53, 0x61, 0x6d, 0x61, 0x72, 0x61, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70,
+  0x65, 0x2f, 0x53, 0x61, 0x6e, 0x5f, 0x4d, 0x61, 0x72, 0x69, 0x6e, 0x6f, 0x00, 0x45, 0x75, 0x72,
+  0x6f, 0x70, 0x65, 0x2f, 0x53, 0x61, 0x72, 0x61, 0x6a, 0x65, 0x76, 0x6f, 0x00, 0x45, 0x75, 0x72,
+  0x6f, 0x70, 0x65, 0x2f, 0x53, 0x61, 0x72, 0x61, 0x74, 0x6f, 0x76, 0x00, 0x45, 0x75, 0x72, 0x6f,
+  0x70, 0x65, 0x2f, 0x53, 0x69, 0x6d, 0x66, 0x65, 0x72, 0x6f, 0x70, 0x6f, 0x6c, 0x00, 0x45, 0x75,
+  0x72, 0x6f, 0x70, 0x65, 0x2f, 0x53, 0x6b, 0x6f, 0x70, 0x6a, 0x65, 0x00, 0x45, 0x75, 0x72, 0x6f,
+  0x70, 0x65, 0x2f, 0x53, 0x6f, 0x66, 0x69, 0x61, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f,
+  0x53, 0x74, 0x6f, 0x63, 0x6b, 0x68, 0x6f, 0x6c, 0x6d, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65,
+  0x2f, 0x54, 0x61, 0x6c, 0x6c, 0x69, 0x6e, 0x6e, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f,
+  0x54, 0x69, 0x72, 0x61, 0x6e, 0x65, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x55, 0x6c,
+  0x79, 0x61, 0x6e, 0x6f, 0x76, 0x73, 0x6b, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x56,
+  0x61, 0x64, 0x75, 0x7a, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x56, 0x61, 0x74, 0x69,
+  0x63, 0x61, 0x6e, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x56, 0x69, 0x65, 0x6e, 0x6e,
+  0x61, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x56, 0x69, 0x6c, 0x6e, 0x69, 0x75, 0x73,
+  0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x56, 0x6f, 0x6c, 0x67, 0x6f, 0x67, 0x72, 0x61,
+  0x64, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x57, 0x61, 0x72, 0x73, 0x61, 0x77, 0x00,
+  0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x5a, 0x61, 0x67, 0x72, 0x65, 0x62, 0x00, 0x45, 0x75,
+  0x72, 0x6f, 0x70, 0x65, 0x2f, 0x5a, 0x75, 0x72, 0x69, 0x63, 0x68, 0x00, 0x49, 0x6e, 0x64, 0x69,
+  0x61, 0x6e, 0x2f, 0x41, 0x6e, 0x74, 0x61, 0x6e, 0x61, 0x6e, 0x61, 0x72, 0x69, 0x76, 0x6f, 0x00,
+  0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x2f, 0x43, 0x68, 0x61, 0x67, 0x6f, 0x73, 0x00, 0x49, 0x6e,
+  0x64, 0x69, 0x61, 0x6e, 0x2f, 0x43, 0x68, 0x72, 0x69, 0x73, 0x74, 0x6d, 0x61, 0x73, 0x00, 0x49,
+  0x6e, 0x64, 0x69, 0x61, 0x6e, 0x2f, 0x43, 0x6f, 0x63, 0x6f, 0x73, 0x00, 0x49, 0x6e, 0x64, 0x69,
+  0x61, 0x6e, 0x2f, 0x43, 0x6f, 0x6d, 0x6f, 0x72, 0x6f, 0x00, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e,
+  0x2f, 0x4b, 0x65, 0x72, 0x67, 0x75, 0x65, 0x6c, 0x65, 0x6e, 0x00, 0x49, 0x6e, 0x64, 0x69, 0x61,
+  0x6e, 0x2f, 0x4d, 0x61, 0x68, 0x65, 0x00, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x2f, 0x4d, 0x61,
+  0x6c, 0x64, 0x69, 0x76, 0x65, 0x73, 0x00, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x2f, 0x4d, 0x61,
+  0x75, 0x72, 0x69, 0x74, 0x69, 0x75, 0x73, 0x00, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x2f, 0x4d,
+  0x61, 0x79, 0x6f, 0x74, 0x74, 0x65, 0x00, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x2f, 0x52, 0x65,
+  0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x41, 0x70,
+  0x69, 0x61, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x41, 0x75, 0x63, 0x6b, 0x6c,
+  0x61, 0x6e, 0x64, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x42, 0x6f, 0x75, 0x67,
+  0x61, 0x69, 0x6e, 0x76, 0x69, 0x6c, 0x6c, 0x65, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63,
+  0x2f, 0x43, 0x68, 0x61, 0x74, 0x68, 0x61, 0x6d, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63,
+  0x2f, 0x43, 0x68, 0x75, 0x75, 0x6b, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x45,
+  0x61, 0x73, 0x74, 0x65, 0x72, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x45, 0x66,
+  0x61, 0x74, 0x65, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x46, 0x61, 0x6b, 0x61,
+  0x6f, 0x66, 0x6f, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x46, 0x69, 0x6a, 0x69,
+  0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x46, 0x75, 0x6e, 0x61, 0x66, 0x75, 0x74,
+  0x69, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x47, 0x61, 0x6c, 0x61, 0x70, 0x61,
+  0x67, 0x6f, 0x73, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x47, 0x61, 0x6d, 0x62,
+  0x69, 0x65, 0x72, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x47, 0x75, 0x61, 0x64,
+  0x61, 0x6c, 0x63, 0x61, 0x6e, 0x61, 0x6c, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f,
+  0x47, 0x75, 0x61, 0x6d, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x48, 0x6f, 0x6e,
+  0x6f, 0x6c, 0x75, 0x6c, 0x75, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x4b, 0x61,
+  0x6e, 0x74, 0x6f, 0x6e, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x4b, 0x69, 0x72,
+  0x69, 0x74, 0x69, 0x6d, 0x61, 0x74, 0x69, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f,
+  0x4b, 0x6f, 0x73, 0x72, 0x61, 0x65, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x4b,
+  0x77, 0x61, 0x6a, 0x61, 0x6c, 0x65, 0x69, 0x6e, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63,
+  0x2f, 0x4d, 0x61, 0x6a, 0x75, 0x72, 0x6f, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f,
+  0x4d, 0x61, 0x72, 0x71, 0x75, 0x65, 0x73, 0x61, 0x73, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69,
+  0x63, 0x2f, 0x4d, 0x69, 0x64, 0x77, 0x61, 0x79, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63,
+  0x2f, 0x4e, 0x61, 0x75, 0x72, 0x75, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x4e,
+  0x69, 0x75, 0x65, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x4e, 0x6f, 0x72, 0x66,
+  0x6f, 0x6c, 0x6b, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x4e, 0x6f, 0x75, 0x6d,
+  0x65, 0x61, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x50, 0x61, 0x67, 0x6f, 0x5f,
+  0x50, 0x61, 0x67, 0x6f, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x50, 0x61, 0x6c,
+  0x61, 0x75, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x50, 0x69, 0x74, 0x63, 0x61,
+  0x69, 0x72, 0x6e, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x50, 0x6f, 0x68, 0x6e,
+  0x70, 0x65, 0x69, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x50, 0x6f, 0x72, 0x74,
+  0x5f, 0x4d, 0x6f, 0x72, 0x65, 0x73, 0x62, 0x79, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63,
+  0x2f, 0x52, 0x61, 0x72, 0x6f, 0x74, 0x6f, 0x6e, 0x67, 0x61, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66,
+  0x69, 0x63, 0x2f, 0x53, 0x61, 0x69, 0x70, 0x61, 0x6e, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69,
+  0x63, 0x2f, 0x54, 0x61, 0x68, 0x69, 0x74, 0x69, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63,
+  0x2f, 0x54, 0x61, 0x72, 0x61, 0x77, 0x61, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f,
+  0x54, 0x6f, 0x6e, 0x67, 0x61, 0x74, 0x61, 0x70, 0x75, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69,
+  0x63, 0x2f, 0x57, 0x61, 0x6b, 0x65, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x57,
+  0x61, 0x6c, 0x6c, 0x69, 0x73, 0x00
+};
+
+#endif // CITY_TABLE_H
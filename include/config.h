@@ -20,6 +20,7 @@ inline uint8_t          clockSecIndicatorDiff =     32;
 // Weather (Open-Meteo API)
 inline String           locationLatitude =          "";                                 // Latitude in decimal degrees (-90 to 90). Use "Detect My Location" button in web UI or lookup at https://open-meteo.com/en/docs/geocoding-api
 inline String           locationLongitude =         "";                                 // Longitude in decimal degrees (-180 to 180)
+inline uint8_t          locationAutoTimezone =      0;                                  // Set the time zone from latitude/longitude when they change (offline grid, see TimezoneGrid.h) | 0 => No, 1 => Yes
 inline String           locationUnits =             "metric";                           // "metric" (°C) or "imperial" (°F) | If switched to imperial, also change weatherTempMin/Max values below (limited to two digits, max 99°F ~ 37°C)
 
 //// Weather Temperature Display
@@ -33,6 +34,11 @@ inline uint8_t          ledDimBrightness =          64;
 inline uint8_t          ledDimFadeDuration =        30;                                 // How long (in seconds) the fading between states (normal <-> dimmed) should take
 inline const char*      ledDimStartTime =           "22:00";                            // Time to start dimming (HH:MM, 24-hour format)
 inline const char*      ledDimEndTime =             "06:00";                            // Time to end dimming (HH:MM, 24-hour format)
+inline const char*      ledDimProfile =             "";                                 // Weekly keyframe profile, replaces the dim window if set (format: see BrightnessProfile.h)
+inline uint8_t          ledFadeCurve =              2;                                  // How fades are interpolated | 0 => Linear (PWM), 1 => Quadratic, 2 => Perceptual (CIE L*)
+inline uint8_t          ledAmbientEnabled =         0;                                  // Set brightness from an ambient light sensor, replaces dimming | 0 => No, 1 => Yes
+inline const char*      ledAmbientCurve =           "0=10 300=60 1500=160 3500=255";    // Light level (0-4095 ADC counts) to brightness points (format: see AmbientLight.h)
+inline uint8_t          ledDimSolar =               0;                                  // Follow local sunrise/sunset (civil twilight) instead of the dim window | 0 => No, 1 => Yes (needs latitude/longitude)
 
 /***************************/
 /**** ADVANCED SETTINGS ****/
@@ -46,16 +52,25 @@ inline String           portalSsid =                "LED-Clock-Config";
 
 // Config portal
 #define                 HTTP_PORT                   80                                  // HTTP port to use for config portal
-#define                 NUM_WIFI_CREDENTIALS        1                                   // How many WiFi credentials should be stored (if >1 it connects to the first it finds and tries the next one if it disconnects)
+#define                 NUM_WIFI_CREDENTIALS        4                                   // How many WiFi networks can be stored (the portal network plus networks added via /api/wifi/networks)
 #define                 PORTAL_SHOW_PW_ON_CONSOLE   false                               // Will show the config portal on console during boot if set to true
 
 // Weather (Open-Meteo API)
+inline const char*      weatherLocations =          "";                                 // Extra locations shown in rotation, "label=lat,lon; ..." (label: one of A b C c d E F H h L n o P r U u), e.g. "b=52.52,13.40; L=51.51,-0.13"
 inline int8_t           weatherTempMin =            -40;                                // Min temperature (-99 is min possible. Value and lower temperature will be shown in blue and fades towards red if warmer)
 inline int8_t           weatherTempMax =            50;                                 // Max temperature (99 is max possible. Value and higher temperature will be shown in red and fades towards blue if colder)
 inline const char*      weatherTempSchedule =       "30 * * * * *";                     // When should the temperature be shown in "extended" cron format (at 30 seconds every minute - see below)
+inline uint16_t         weatherUpdateSkew =         120;                                // Delay scheduled weather updates by a random 0-n seconds, so clocks on the same schedule don't hit the API together | 0 => Disabled
 
 // FastLED
 #define                 LED_PIN                     4                                   // LED data pin to use on ESP
+#define                 BRIGHTNESS_PROFILE_MAX_LEN  256                                 // Maximum length of the brightness profile text
+#define                 BRIGHTNESS_FRAME_MS         20                                  // Brightness fade frame period (50 steps/s), the display is only refreshed when the level changes
+#define                 AMBIENT_LIGHT_PIN           34                                  // Light sensor (LDR divider / phototransistor) input, must be an ADC1 pin (ADC2 is unusable with WiFi)
+#define                 AMBIENT_SAMPLE_INTERVAL_MS  250                                 // Light sensor sampling period (own task, independent of the render tick)
+#define                 AMBIENT_EMA_ALPHA           38                                  // Light level smoothing in 1/256 per sample (38 => ~1.5 s time constant at 250 ms)
+#define                 AMBIENT_HYSTERESIS          24                                  // Light level change (ADC counts, plus 1/16 of the level) needed to adjust brightness
+#define                 AMBIENT_CURVE_MAX_LEN       96                                  // Maximum length of the ambient curve text
 
 
 /**************************/
@@ -73,6 +88,74 @@ inline const char*      weatherTempSchedule =       "30 * * * * *";
 #define                 WIFI_MAX_RECONNECT_ATTEMPTS 10                                  // Max attempts before full WiFi restart
 #define                 WIFI_MAX_BACKOFF_MS         60000                               // Maximum backoff interval (1 minute)
 #define                 WIFI_FULL_RESTART_THRESHOLD 30000                               // Trigger full restart after 30 seconds disconnected
+#define                 WIFI_RECONNECT_TIMEOUT_MS   10000                               // Reconnect attempt without result counts as failed
+#define                 WIFI_FULL_RESTART_TIMEOUT_MS 20000                              // Full restart without result counts as failed
+#define                 WIFI_EVENT_QUEUE_LENGTH     8                                   // WiFi events buffered between the WiFi task and loop()
+#define                 WIFI_BOOT_CONNECT_TIMEOUT_MS 30000                              // Restart into the config portal if saved WiFi is not reached during boot
+#define                 WIFI_FAST_CONNECT_TIMEOUT_MS 4000                               // Directed connect (cached BSSID/channel) before falling back to a full scan
+#define                 WIFI_FAST_CONNECT_STATIC_IP false                               // Reuse the last DHCP lease as static IP (skips DHCP, only use with a DHCP reservation)
+#define                 WIFI_CONNECT_SAMPLES        32                                  // Connect times kept for percentile statistics
+#define                 WIFI_SCAN_CACHE_SIZE        16                                  // Known APs kept from the last scan
+#define                 WIFI_SCAN_CACHE_MAX_AGE_MS  120000                              // Scan results older than this are rescanned before use (2 minutes)
+#define                 WIFI_AP_STATS_SIZE          8                                   // APs (BSSIDs) tracked for success rate and connect latency
+#define                 WIFI_ROAM_RSSI_THRESHOLD    -75                                 // Look for a better AP when the signal stays below this (dBm)
+#define                 WIFI_ROAM_HOLD_MS           30000                               // How long the signal must stay weak before scanning
+#define                 WIFI_ROAM_HYSTERESIS_DB     8                                   // Roam only if the candidate is at least this much stronger
+#define                 WIFI_ROAM_SCAN_INTERVAL_MS  300000                              // Minimum time between roaming scans (5 minutes)
+
+// Clock discipline (NTP drift estimation and slewing)
+#define                 CLOCK_SLEW_THRESHOLD_US     1000000                             // Offsets below this are slewed, larger ones step the clock (1 second)
+#define                 CLOCK_MAX_DRIFT_PPM         500                                 // Upper bound for the learned crystal error
+#define                 CLOCK_MIN_SAMPLE_INTERVAL_MS 600000                             // Minimum time between syncs to learn drift from (10 minutes)
+#define                 CLOCK_STABLE_OFFSET_US      50000                               // Offsets below this count as stable and stretch the sync interval
+#define                 CLOCK_DRIFT_APPLY_INTERVAL_MS 60000                             // How often the learned drift is compensated (1 minute)
+#define                 NTP_SYNC_INTERVAL_MIN_MS    3600000                             // NTP poll interval while learning (1 hour)
+#define                 NTP_SYNC_INTERVAL_MAX_MS    21600000                            // NTP poll interval once drift is stable (6 hours)
+
+// Weather
+#define                 WEATHER_JSON_DOC_SIZE       2048                                // Filtered Open-Meteo document (48 hourly times + temperatures + unit), parsed from the stream
+#define                 WEATHER_MAX_LOCATIONS       4                                   // Primary location plus up to 3 labelled extras (weatherLocations), fetched in one request
+#define                 WEATHER_FORECAST_REFRESH_S  21600                               // Refetch the hourly forecast after this long (6 hours), scheduled updates in between use the cache
+
+// Geolocation (ipapi.co lookup for the web UI)
+#define                 GEOLOCATION_BODY_SIZE       320                                 // JSON answer of a lookup (coordinates, city, postal code, region, country)
+#define                 GEOLOCATION_CACHE_SIZE      2                                   // Public IPs whose location is cached
+#define                 GEOLOCATION_CACHE_TTL_S     86400                               // Serve a cached location this long while the network is unchanged
+#define                 GEOLOCATION_JOB_KEEP_MS     60000                               // How long a finished job can be polled
+#define                 GEOLOCATION_TASK_STACK      8192                                // Stack of the lookup worker task in bytes (TLS handshake, JSON parsing)
+#define                 GEOLOCATION_TASK_PRIORITY   1                                   // Same as the loop task, below the async web server
+#define                 CITY_SEARCH_DEFAULT_RESULTS 8                                   // Cities returned by /api/cities without a limit
+#define                 CITY_SEARCH_MAX_RESULTS     20                                  // Largest limit accepted by /api/cities
+
+// HTTP requests (per-host backoff and circuit breaker in SecureHTTPClient, all delays jittered)
+#define                 HTTP_BACKOFF_INITIAL_MS     30000                               // Wait after a failed request (connection, TLS, timeout, 5xx, 429), doubled per further failure
+#define                 HTTP_BACKOFF_MAX_MS         900000                              // Maximum wait between failed requests (15 minutes)
+#define                 HTTP_BREAKER_FAILURES       5                                   // Consecutive failures that open the circuit (no requests to the host at all)
+#define                 HTTP_BREAKER_OPEN_MS        1800000                             // How long the circuit stays open before a single probe request (30 minutes)
+// Keep-alive only helps requests made within HTTP_POOL_IDLE_MS of each other
+// (geolocation lookups in a row, a request right after another one to the same
+// host). Weather fetches are WEATHER_FORECAST_REFRESH_S apart and always open a
+// new connection.
+#define                 HTTP_POOL_SIZE              2                                   // Hosts whose HTTPS connection is kept alive between requests
+#define                 HTTP_POOL_IDLE_MS           30000                               // Close kept-alive connections idle longer than this (servers drop them after ~60 s anyway)
+#define                 HTTP_POOL_MIN_FREE_HEAP     50000                               // Close idle connections when free heap drops below this (a TLS session holds ~40 KB)
+#define                 HTTP_CONNECT_TIMEOUT_MS     5000                                // DNS lookup and TCP connect
+#define                 HTTP_TLS_TIMEOUT_MS         8000                                // TLS handshake (rounded up to seconds)
+#define                 HTTP_FIRST_BYTE_TIMEOUT_MS  5000                                // Request sent until the response headers arrived
+#define                 HTTP_TOTAL_TIMEOUT_MS       15000                               // Whole request including the body, bounds the phase timeouts
+#define                 HTTP_MAX_BODY_SIZE          16384                               // Larger response bodies are refused (captive portal pages, misbehaving endpoints)
+#define                 HTTP_CHUNK_SIZE             256                                 // Body chunk handed to sinks (stack buffer)
+#define                 HTTP_TLS_VERIFY             true                                // Validate servers against their trust anchors (TrustStore), false skips validation for all hosts
+#define                 HTTP_COALESCE_SLOTS         2                                   // URLs whose in-flight request or recent result is shared with identical requests
+#define                 HTTP_COALESCE_TTL_MS        2000                                // How long a finished request answers identical requests
+#define                 HTTP_COALESCE_MAX_BODY      2048                                // Larger bodies are not kept for sharing (identical requests fetch their own after the first)
+
+// DNS cache (shared by HTTPS requests and NTP, lwIP does not expose record TTLs so a fixed TTL is used)
+#define                 DNS_CACHE_TTL_S             300                                 // Serve a resolved address this long without a new lookup
+#define                 DNS_NEGATIVE_TTL_S          30                                  // Remember a failed lookup this long (requests fail at once instead of waiting for DNS)
+#define                 DNS_STALE_MAX_S             3600                                // Use an expired address for up to this long when a new lookup fails
+#define                 DNS_PREFETCH_AHEAD_S        60                                  // Prefetch refreshes addresses expiring within this window
+
 #define                 ESP_DRD_USE_LITTLEFS        true
 #define                 ESP_DRD_USE_SPIFFS          false
 #define                 ESP_DRD_USE_EEPROM          false
@@ -178,6 +178,15 @@ const char SCHEMA_JSON[] PROGMEM = R"===(
           "showIf": {"field": "weatherTempEnabled", "equals": 1},
           "applyMethod": "restart"
         },
+        {
+          "id": "locationAutoTimezone",
+          "type": "checkbox",
+          "label": "Timezone From Location",
+          "help": "Set the timezone from latitude/longitude when they change, looked up offline. Zone borders are approximate; check the zone shown after saving",
+          "default": 0,
+          "showIf": {"field": "weatherTempEnabled", "equals": 1},
+          "applyMethod": "instant"
+        },
         {
           "id": "locationUnits",
           "type": "select",
@@ -230,6 +239,19 @@ const char SCHEMA_JSON[] PROGMEM = R"===(
           "showIf": {"field": "weatherTempEnabled", "equals": 1},
           "applyMethod": "instant"
         },
+        {
+          "id": "weatherLocations",
+          "type": "text",
+          "label": "Extra Locations",
+          "help": "Optional, rotated with the main location on each display. Up to 3 'label=lat,lon' separated by ';', the label glyph is shown in the first digit (A b C c d E F H h L n o P r U u). Example: b=52.52,13.40; L=51.51,-0.13",
+          "default": "",
+          "validation": {
+            "required": false,
+            "maxLength": 128
+          },
+          "showIf": {"field": "weatherTempEnabled", "equals": 1},
+          "applyMethod": "instant"
+        },
         {
           "id": "weatherTempSchedule",
           "type": "text",
@@ -255,6 +277,19 @@ const char SCHEMA_JSON[] PROGMEM = R"===(
           },
           "showIf": {"field": "weatherTempEnabled", "equals": 1},
           "applyMethod": "instant"
+        },
+        {
+          "id": "weatherUpdateSkew",
+          "type": "number",
+          "label": "Update Skew",
+          "help": "Delay scheduled updates by a random 0 to n seconds, so clocks sharing a schedule don't query the API at the same moment (0 = off)",
+          "default": 120,
+          "validation": {
+            "min": 0,
+            "max": 600
+          },
+          "showIf": {"field": "weatherTempEnabled", "equals": 1},
+          "applyMethod": "instant"
         }
       ]
     },
@@ -275,6 +310,27 @@ const char SCHEMA_JSON[] PROGMEM = R"===(
           },
           "applyMethod": "instant"
         },
+        {
+          "id": "ledAmbientEnabled",
+          "type": "checkbox",
+          "label": "Ambient Light Sensor",
+          "help": "Set brightness from a light sensor on GPIO 34 (replaces auto dimming)",
+          "default": 0,
+          "applyMethod": "instant"
+        },
+        {
+          "id": "ledAmbientCurve",
+          "type": "text",
+          "label": "Light Curve",
+          "help": "Ascending 'level=brightness' points, light level 0-4095 (see ambient.raw in /api/stats), brightness 0-255, linear in between. Example: 0=10 300=60 1500=160 3500=255",
+          "default": "0=10 300=60 1500=160 3500=255",
+          "validation": {
+            "required": true,
+            "maxLength": 96
+          },
+          "showIf": {"field": "ledAmbientEnabled", "equals": 1},
+          "applyMethod": "instant"
+        },
         {
           "id": "ledDimEnabled",
           "type": "checkbox",
@@ -309,6 +365,29 @@ const char SCHEMA_JSON[] PROGMEM = R"===(
           "showIf": {"field": "ledDimEnabled", "equals": 1},
           "applyMethod": "instant"
         },
+        {
+          "id": "ledFadeCurve",
+          "type": "select",
+          "label": "Fade Curve",
+          "help": "How brightness transitions are interpolated. Perceptual fades in even visible steps instead of dropping suddenly at the dim end",
+          "default": 2,
+          "options": [
+            {"value": 0, "label": "Linear"},
+            {"value": 1, "label": "Quadratic"},
+            {"value": 2, "label": "Perceptual (CIE L*)"}
+          ],
+          "showIf": {"field": "ledDimEnabled", "equals": 1},
+          "applyMethod": "instant"
+        },
+        {
+          "id": "ledDimSolar",
+          "type": "checkbox",
+          "label": "Follow Sunrise/Sunset",
+          "help": "Dim from civil dusk to civil dawn at the weather location (latitude/longitude), fading during twilight. Replaces the dim times and the weekly profile",
+          "default": 0,
+          "showIf": {"field": "ledDimEnabled", "equals": 1},
+          "applyMethod": "instant"
+        },
         {
           "id": "ledDimStartTime",
           "type": "time",
@@ -334,6 +413,19 @@ const char SCHEMA_JSON[] PROGMEM = R"===(
           },
           "showIf": {"field": "ledDimEnabled", "equals": 1},
           "applyMethod": "instant"
+        },
+        {
+          "id": "ledDimProfile",
+          "type": "text",
+          "label": "Weekly Profile",
+          "help": "Optional, replaces the dim window. Groups of 'days: HH:MM=level[easing] ...' separated by ';' (days: *, mo-su, ranges like mo-fr; easing: l linear, i in, o out, e in-out, s step). Example: *: 06:30=20 07:30=255e 22:00=255 23:00=40; sa,su: 09:00=20 10:00=255e",
+          "default": "",
+          "validation": {
+            "required": false,
+            "maxLength": 256
+          },
+          "showIf": {"field": "ledDimEnabled", "equals": 1},
+          "applyMethod": "instant"
         }
       ]
     },
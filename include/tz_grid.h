@@ -0,0 +1,3182 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Generated by scripts/gen_tz_grid.py, do not edit.
+// 720x360 cells of 1/2 degree, 417 zones (nearest tz database principal city), 10082 runs, 50325 bytes.
+
+#ifndef TZ_GRID_H
+#define TZ_GRID_H
+
+#include <stdint.h>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+static const uint8_t TZ_GRID[] PROGMEM = {
+  0x54, 0x5a, 0x47, 0x31, 0xd0, 0x02, 0x68, 0x01, 0xa1, 0x01, 0x02, 0x00, 0x40, 0xa3, 0x00, 0x00,
+  0xc4, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00,
+  0x58, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00,
+  0x76, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
+  0x9b, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00,
+  0xc5, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00,
+  0xfb, 0x00, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x19, 0x01, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00,
+  0x3a, 0x01, 0x00, 0x00, 0x4c, 0x01, 0x00, 0x00, 0x5e, 0x01, 0x00, 0x00, 0x73, 0x01, 0x00, 0x00,
+  0x89, 0x01, 0x00, 0x00, 0x9f, 0x01, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0xcd, 0x01, 0x00, 0x00,
+  0xe5, 0x01, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00, 0x13, 0x02, 0x00, 0x00, 0x2b, 0x02, 0x00, 0x00,
+  0x44, 0x02, 0x00, 0x00, 0x5d, 0x02, 0x00, 0x00, 0x76, 0x02, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00,
+  0xaa, 0x02, 0x00, 0x00, 0xc5, 0x02, 0x00, 0x00, 0xe1, 0x02, 0x00, 0x00, 0xfd, 0x02, 0x00, 0x00,
+  0x19, 0x03, 0x00, 0x00, 0x35, 0x03, 0x00, 0x00, 0x53, 0x03, 0x00, 0x00, 0x72, 0x03, 0x00, 0x00,
+  0x92, 0x03, 0x00, 0x00, 0xb3, 0x03, 0x00, 0x00, 0xd7, 0x03, 0x00, 0x00, 0xfd, 0x03, 0x00, 0x00,
+  0x25, 0x04, 0x00, 0x00, 0x4d, 0x04, 0x00, 0x00, 0x76, 0x04, 0x00, 0x00, 0x9d, 0x04, 0x00, 0x00,
+  0xc4, 0x04, 0x00, 0x00, 0xec, 0x04, 0x00, 0x00, 0x16, 0x05, 0x00, 0x00, 0x42, 0x05, 0x00, 0x00,
+  0x6c, 0x05, 0x00, 0x00, 0x95, 0x05, 0x00, 0x00, 0xc0, 0x05, 0x00, 0x00, 0xec, 0x05, 0x00, 0x00,
+  0x17, 0x06, 0x00, 0x00, 0x43, 0x06, 0x00, 0x00, 0x6f, 0x06, 0x00, 0x00, 0xa0, 0x06, 0x00, 0x00,
+  0xd1, 0x06, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x30, 0x07, 0x00, 0x00, 0x5e, 0x07, 0x00, 0x00,
+  0x8d, 0x07, 0x00, 0x00, 0xbd, 0x07, 0x00, 0x00, 0xf1, 0x07, 0x00, 0x00, 0x23, 0x08, 0x00, 0x00,
+  0x52, 0x08, 0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0xab, 0x08, 0x00, 0x00, 0xd7, 0x08, 0x00, 0x00,
+  0x04, 0x09, 0x00, 0x00, 0x31, 0x09, 0x00, 0x00, 0x5e, 0x09, 0x00, 0x00, 0x8c, 0x09, 0x00, 0x00,
+  0xb8, 0x09, 0x00, 0x00, 0xe4, 0x09, 0x00, 0x00, 0x13, 0x0a, 0x00, 0x00, 0x40, 0x0a, 0x00, 0x00,
+  0x6f, 0x0a, 0x00, 0x00, 0xa1, 0x0a, 0x00, 0x00, 0xd0, 0x0a, 0x00, 0x00, 0xfc, 0x0a, 0x00, 0x00,
+  0x27, 0x0b, 0x00, 0x00, 0x50, 0x0b, 0x00, 0x00, 0x79, 0x0b, 0x00, 0x00, 0x9e, 0x0b, 0x00, 0x00,
+  0xc3, 0x0b, 0x00, 0x00, 0xe9, 0x0b, 0x00, 0x00, 0x11, 0x0c, 0x00, 0x00, 0x38, 0x0c, 0x00, 0x00,
+  0x61, 0x0c, 0x00, 0x00, 0x89, 0x0c, 0x00, 0x00, 0xad, 0x0c, 0x00, 0x00, 0xd4, 0x0c, 0x00, 0x00,
+  0xfa, 0x0c, 0x00, 0x00, 0x20, 0x0d, 0x00, 0x00, 0x49, 0x0d, 0x00, 0x00, 0x71, 0x0d, 0x00, 0x00,
+  0x99, 0x0d, 0x00, 0x00, 0xc2, 0x0d, 0x00, 0x00, 0xeb, 0x0d, 0x00, 0x00, 0x15, 0x0e, 0x00, 0x00,
+  0x3d, 0x0e, 0x00, 0x00, 0x66, 0x0e, 0x00, 0x00, 0x90, 0x0e, 0x00, 0x00, 0xba, 0x0e, 0x00, 0x00,
+  0xe4, 0x0e, 0x00, 0x00, 0x0d, 0x0f, 0x00, 0x00, 0x35, 0x0f, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00,
+  0x8b, 0x0f, 0x00, 0x00, 0xb8, 0x0f, 0x00, 0x00, 0xe3, 0x0f, 0x00, 0x00, 0x0f, 0x10, 0x00, 0x00,
+  0x3b, 0x10, 0x00, 0x00, 0x66, 0x10, 0x00, 0x00, 0x92, 0x10, 0x00, 0x00, 0xc1, 0x10, 0x00, 0x00,
+  0xf0, 0x10, 0x00, 0x00, 0x1e, 0x11, 0x00, 0x00, 0x4d, 0x11, 0x00, 0x00, 0x7b, 0x11, 0x00, 0x00,
+  0xa9, 0x11, 0x00, 0x00, 0xda, 0x11, 0x00, 0x00, 0x0e, 0x12, 0x00, 0x00, 0x43, 0x12, 0x00, 0x00,
+  0x76, 0x12, 0x00, 0x00, 0xaa, 0x12, 0x00, 0x00, 0xde, 0x12, 0x00, 0x00, 0x10, 0x13, 0x00, 0x00,
+  0x41, 0x13, 0x00, 0x00, 0x73, 0x13, 0x00, 0x00, 0xa3, 0x13, 0x00, 0x00, 0xd4, 0x13, 0x00, 0x00,
+  0x04, 0x14, 0x00, 0x00, 0x38, 0x14, 0x00, 0x00, 0x6b, 0x14, 0x00, 0x00, 0xa1, 0x14, 0x00, 0x00,
+  0xd8, 0x14, 0x00, 0x00, 0x10, 0x15, 0x00, 0x00, 0x46, 0x15, 0x00, 0x00, 0x7c, 0x15, 0x00, 0x00,
+  0xaf, 0x15, 0x00, 0x00, 0xe3, 0x15, 0x00, 0x00, 0x15, 0x16, 0x00, 0x00, 0x45, 0x16, 0x00, 0x00,
+  0x74, 0x16, 0x00, 0x00, 0xa2, 0x16, 0x00, 0x00, 0xcf, 0x16, 0x00, 0x00, 0xfb, 0x16, 0x00, 0x00,
+  0x26, 0x17, 0x00, 0x00, 0x52, 0x17, 0x00, 0x00, 0x7c, 0x17, 0x00, 0x00, 0xa5, 0x17, 0x00, 0x00,
+  0xd0, 0x17, 0x00, 0x00, 0xfc, 0x17, 0x00, 0x00, 0x29, 0x18, 0x00, 0x00, 0x54, 0x18, 0x00, 0x00,
+  0x7e, 0x18, 0x00, 0x00, 0xa9, 0x18, 0x00, 0x00, 0xd1, 0x18, 0x00, 0x00, 0xfb, 0x18, 0x00, 0x00,
+  0x23, 0x19, 0x00, 0x00, 0x4d, 0x19, 0x00, 0x00, 0x77, 0x19, 0x00, 0x00, 0xa1, 0x19, 0x00, 0x00,
+  0xcb, 0x19, 0x00, 0x00, 0xf1, 0x19, 0x00, 0x00, 0x18, 0x1a, 0x00, 0x00, 0x40, 0x1a, 0x00, 0x00,
+  0x6a, 0x1a, 0x00, 0x00, 0x95, 0x1a, 0x00, 0x00, 0xc0, 0x1a, 0x00, 0x00, 0xea, 0x1a, 0x00, 0x00,
+  0x11, 0x1b, 0x00, 0x00, 0x39, 0x1b, 0x00, 0x00, 0x60, 0x1b, 0x00, 0x00, 0x86, 0x1b, 0x00, 0x00,
+  0xac, 0x1b, 0x00, 0x00, 0xd2, 0x1b, 0x00, 0x00, 0xf7, 0x1b, 0x00, 0x00, 0x1d, 0x1c, 0x00, 0x00,
+  0x46, 0x1c, 0x00, 0x00, 0x6d, 0x1c, 0x00, 0x00, 0x95, 0x1c, 0x00, 0x00, 0xbd, 0x1c, 0x00, 0x00,
+  0xe4, 0x1c, 0x00, 0x00, 0x0c, 0x1d, 0x00, 0x00, 0x34, 0x1d, 0x00, 0x00, 0x5b, 0x1d, 0x00, 0x00,
+  0x81, 0x1d, 0x00, 0x00, 0xa3, 0x1d, 0x00, 0x00, 0xc3, 0x1d, 0x00, 0x00, 0xe4, 0x1d, 0x00, 0x00,
+  0x07, 0x1e, 0x00, 0x00, 0x29, 0x1e, 0x00, 0x00, 0x49, 0x1e, 0x00, 0x00, 0x6b, 0x1e, 0x00, 0x00,
+  0x8d, 0x1e, 0x00, 0x00, 0xb1, 0x1e, 0x00, 0x00, 0xd2, 0x1e, 0x00, 0x00, 0xf3, 0x1e, 0x00, 0x00,
+  0x16, 0x1f, 0x00, 0x00, 0x39, 0x1f, 0x00, 0x00, 0x5d, 0x1f, 0x00, 0x00, 0x82, 0x1f, 0x00, 0x00,
+  0xa6, 0x1f, 0x00, 0x00, 0xca, 0x1f, 0x00, 0x00, 0xec, 0x1f, 0x00, 0x00, 0x0d, 0x20, 0x00, 0x00,
+  0x2e, 0x20, 0x00, 0x00, 0x50, 0x20, 0x00, 0x00, 0x71, 0x20, 0x00, 0x00, 0x92, 0x20, 0x00, 0x00,
+  0xb2, 0x20, 0x00, 0x00, 0xd4, 0x20, 0x00, 0x00, 0xf5, 0x20, 0x00, 0x00, 0x16, 0x21, 0x00, 0x00,
+  0x34, 0x21, 0x00, 0x00, 0x53, 0x21, 0x00, 0x00, 0x73, 0x21, 0x00, 0x00, 0x91, 0x21, 0x00, 0x00,
+  0xae, 0x21, 0x00, 0x00, 0xcb, 0x21, 0x00, 0x00, 0xe9, 0x21, 0x00, 0x00, 0x06, 0x22, 0x00, 0x00,
+  0x21, 0x22, 0x00, 0x00, 0x3b, 0x22, 0x00, 0x00, 0x55, 0x22, 0x00, 0x00, 0x6f, 0x22, 0x00, 0x00,
+  0x89, 0x22, 0x00, 0x00, 0xa2, 0x22, 0x00, 0x00, 0xbb, 0x22, 0x00, 0x00, 0xd3, 0x22, 0x00, 0x00,
+  0xec, 0x22, 0x00, 0x00, 0x02, 0x23, 0x00, 0x00, 0x19, 0x23, 0x00, 0x00, 0x2e, 0x23, 0x00, 0x00,
+  0x42, 0x23, 0x00, 0x00, 0x55, 0x23, 0x00, 0x00, 0x68, 0x23, 0x00, 0x00, 0x79, 0x23, 0x00, 0x00,
+  0x8a, 0x23, 0x00, 0x00, 0x9b, 0x23, 0x00, 0x00, 0xab, 0x23, 0x00, 0x00, 0xbb, 0x23, 0x00, 0x00,
+  0xca, 0x23, 0x00, 0x00, 0xd9, 0x23, 0x00, 0x00, 0xe8, 0x23, 0x00, 0x00, 0xf7, 0x23, 0x00, 0x00,
+  0x08, 0x24, 0x00, 0x00, 0x19, 0x24, 0x00, 0x00, 0x2a, 0x24, 0x00, 0x00, 0x3c, 0x24, 0x00, 0x00,
+  0x4d, 0x24, 0x00, 0x00, 0x5c, 0x24, 0x00, 0x00, 0x6a, 0x24, 0x00, 0x00, 0x78, 0x24, 0x00, 0x00,
+  0x86, 0x24, 0x00, 0x00, 0x95, 0x24, 0x00, 0x00, 0xa4, 0x24, 0x00, 0x00, 0xb4, 0x24, 0x00, 0x00,
+  0xc3, 0x24, 0x00, 0x00, 0xd3, 0x24, 0x00, 0x00, 0xe1, 0x24, 0x00, 0x00, 0xf0, 0x24, 0x00, 0x00,
+  0xff, 0x24, 0x00, 0x00, 0x0d, 0x25, 0x00, 0x00, 0x1d, 0x25, 0x00, 0x00, 0x2d, 0x25, 0x00, 0x00,
+  0x3d, 0x25, 0x00, 0x00, 0x4d, 0x25, 0x00, 0x00, 0x5d, 0x25, 0x00, 0x00, 0x6e, 0x25, 0x00, 0x00,
+  0x7d, 0x25, 0x00, 0x00, 0x8c, 0x25, 0x00, 0x00, 0x9a, 0x25, 0x00, 0x00, 0xa7, 0x25, 0x00, 0x00,
+  0xb4, 0x25, 0x00, 0x00, 0xc0, 0x25, 0x00, 0x00, 0xcc, 0x25, 0x00, 0x00, 0xd8, 0x25, 0x00, 0x00,
+  0xe4, 0x25, 0x00, 0x00, 0xf0, 0x25, 0x00, 0x00, 0xfc, 0x25, 0x00, 0x00, 0x08, 0x26, 0x00, 0x00,
+  0x14, 0x26, 0x00, 0x00, 0x1f, 0x26, 0x00, 0x00, 0x2a, 0x26, 0x00, 0x00, 0x35, 0x26, 0x00, 0x00,
+  0x3f, 0x26, 0x00, 0x00, 0x49, 0x26, 0x00, 0x00, 0x53, 0x26, 0x00, 0x00, 0x5d, 0x26, 0x00, 0x00,
+  0x67, 0x26, 0x00, 0x00, 0x70, 0x26, 0x00, 0x00, 0x79, 0x26, 0x00, 0x00, 0x82, 0x26, 0x00, 0x00,
+  0x8b, 0x26, 0x00, 0x00, 0x95, 0x26, 0x00, 0x00, 0xa0, 0x26, 0x00, 0x00, 0xa9, 0x26, 0x00, 0x00,
+  0xb2, 0x26, 0x00, 0x00, 0xbb, 0x26, 0x00, 0x00, 0xc4, 0x26, 0x00, 0x00, 0xcc, 0x26, 0x00, 0x00,
+  0xd4, 0x26, 0x00, 0x00, 0xdc, 0x26, 0x00, 0x00, 0xe4, 0x26, 0x00, 0x00, 0xec, 0x26, 0x00, 0x00,
+  0xf3, 0x26, 0x00, 0x00, 0xf9, 0x26, 0x00, 0x00, 0xff, 0x26, 0x00, 0x00, 0x05, 0x27, 0x00, 0x00,
+  0x0b, 0x27, 0x00, 0x00, 0x11, 0x27, 0x00, 0x00, 0x17, 0x27, 0x00, 0x00, 0x1d, 0x27, 0x00, 0x00,
+  0x22, 0x27, 0x00, 0x00, 0x27, 0x27, 0x00, 0x00, 0x2c, 0x27, 0x00, 0x00, 0x31, 0x27, 0x00, 0x00,
+  0x36, 0x27, 0x00, 0x00, 0x3b, 0x27, 0x00, 0x00, 0x3f, 0x27, 0x00, 0x00, 0x43, 0x27, 0x00, 0x00,
+  0x47, 0x27, 0x00, 0x00, 0x4c, 0x27, 0x00, 0x00, 0x4f, 0x27, 0x00, 0x00, 0x52, 0x27, 0x00, 0x00,
+  0x55, 0x27, 0x00, 0x00, 0x58, 0x27, 0x00, 0x00, 0x5b, 0x27, 0x00, 0x00, 0x5e, 0x27, 0x00, 0x00,
+  0x61, 0x27, 0x00, 0x00, 0x62, 0x27, 0x00, 0x00, 0xce, 0x00, 0xd0, 0x02, 0xce, 0x00, 0xd0, 0x02,
+  0xce, 0x00, 0x46, 0x00, 0xbb, 0x00, 0xc6, 0x00, 0xce, 0x00, 0xd0, 0x02, 0xce, 0x00, 0x1d, 0x00,
+  0xbb, 0x00, 0xf0, 0x00, 0xce, 0x00, 0xd0, 0x02, 0xce, 0x00, 0x0a, 0x00, 0xbb, 0x00, 0x02, 0x01,
+  0xce, 0x00, 0xd0, 0x02, 0xbb, 0x00, 0x09, 0x01, 0x5f, 0x00, 0x17, 0x01, 0xce, 0x00, 0xd0, 0x02,
+  0xbb, 0x00, 0x0a, 0x01, 0x5f, 0x00, 0x29, 0x01, 0xce, 0x00, 0xc8, 0x02, 0xbb, 0x00, 0xd0, 0x02,
+  0xbb, 0x00, 0x0b, 0x01, 0x5f, 0x00, 0x35, 0x01, 0xce, 0x00, 0xc3, 0x02, 0xbb, 0x00, 0xd0, 0x02,
+  0xbb, 0x00, 0x07, 0x00, 0xab, 0x00, 0x57, 0x00, 0xbb, 0x00, 0x0c, 0x01, 0x5f, 0x00, 0x3d, 0x01,
+  0xce, 0x00, 0xbf, 0x02, 0xbb, 0x00, 0xd0, 0x02, 0xab, 0x00, 0x71, 0x00, 0xbb, 0x00, 0x0d, 0x01,
+  0x5f, 0x00, 0x44, 0x01, 0xce, 0x00, 0xbc, 0x02, 0xbb, 0x00, 0xbe, 0x02, 0xab, 0x00, 0xd0, 0x02,
+  0xab, 0x00, 0x80, 0x00, 0xbb, 0x00, 0x0d, 0x01, 0x5f, 0x00, 0x49, 0x01, 0xce, 0x00, 0xb7, 0x02,
+  0xab, 0x00, 0xd0, 0x02, 0xab, 0x00, 0x8b, 0x00, 0xbb, 0x00, 0x0e, 0x01, 0x5f, 0x00, 0x4d, 0x01,
+  0xce, 0x00, 0x9f, 0x02, 0x10, 0x01, 0xb7, 0x02, 0xab, 0x00, 0xd0, 0x02, 0xab, 0x00, 0x94, 0x00,
+  0xbb, 0x00, 0x0e, 0x01, 0x5f, 0x00, 0x51, 0x01, 0xce, 0x00, 0x84, 0x02, 0x10, 0x01, 0xc2, 0x02,
+  0xab, 0x00, 0xd0, 0x02, 0xab, 0x00, 0x9b, 0x00, 0xbb, 0x00, 0x0e, 0x01, 0x5f, 0x00, 0x54, 0x01,
+  0xce, 0x00, 0x75, 0x02, 0x10, 0x01, 0xca, 0x02, 0xab, 0x00, 0xd0, 0x02, 0xab, 0x00, 0xa1, 0x00,
+  0xbb, 0x00, 0x0f, 0x01, 0x5f, 0x00, 0x56, 0x01, 0xce, 0x00, 0x6a, 0x02, 0x10, 0x01, 0xd0, 0x02,
+  0x10, 0x01, 0x05, 0x00, 0xab, 0x00, 0xa5, 0x00, 0xbb, 0x00, 0x0f, 0x01, 0x5f, 0x00, 0x58, 0x01,
+  0xce, 0x00, 0x61, 0x02, 0x10, 0x01, 0xd0, 0x02, 0x10, 0x01, 0x0a, 0x00, 0xab, 0x00, 0xaa, 0x00,
+  0xbb, 0x00, 0x0f, 0x01, 0x5f, 0x00, 0x5a, 0x01, 0xce, 0x00, 0x5a, 0x02, 0x10, 0x01, 0xd0, 0x02,
+  0x10, 0x01, 0x0d, 0x00, 0x7d, 0x00, 0x19, 0x00, 0xab, 0x00, 0xad, 0x00, 0xbb, 0x00, 0x0f, 0x01,
+  0x5f, 0x00, 0x5c, 0x01, 0xce, 0x00, 0x54, 0x02, 0x10, 0x01, 0xd0, 0x02, 0x10, 0x01, 0x0e, 0x00,
+  0x7d, 0x00, 0x2e, 0x00, 0xab, 0x00, 0xb0, 0x00, 0xbb, 0x00, 0x0f, 0x01, 0x5f, 0x00, 0x5e, 0x01,
+  0xce, 0x00, 0x4f, 0x02, 0x10, 0x01, 0xd0, 0x02, 0x10, 0x01, 0x0e, 0x00, 0x7d, 0x00, 0x3b, 0x00,
+  0xab, 0x00, 0xb3, 0x00, 0xbb, 0x00, 0x10, 0x01, 0x5f, 0x00, 0x5f, 0x01, 0xce, 0x00, 0x4a, 0x02,
+  0x10, 0x01, 0xd0, 0x02, 0x10, 0x01, 0x0f, 0x00, 0x7d, 0x00, 0x45, 0x00, 0xab, 0x00, 0xb6, 0x00,
+  0xbb, 0x00, 0x10, 0x01, 0x5f, 0x00, 0x60, 0x01, 0xce, 0x00, 0x46, 0x02, 0x10, 0x01, 0xd0, 0x02,
+  0x10, 0x01, 0x0f, 0x00, 0x7d, 0x00, 0x4d, 0x00, 0xab, 0x00, 0xb8, 0x00, 0xbb, 0x00, 0x10, 0x01,
+  0x5f, 0x00, 0x61, 0x01, 0xce, 0x00, 0x43, 0x02, 0x10, 0x01, 0xd0, 0x02, 0x10, 0x01, 0x0b, 0x00,
+  0xd2, 0x00, 0x11, 0x00, 0x99, 0x00, 0x12, 0x00, 0x7d, 0x00, 0x53, 0x00, 0xab, 0x00, 0xba, 0x00,
+  0xbb, 0x00, 0x10, 0x01, 0x5f, 0x00, 0x62, 0x01, 0xce, 0x00, 0x40, 0x02, 0x10, 0x01, 0xd0, 0x02,
+  0x10, 0x01, 0x08, 0x00, 0xd2, 0x00, 0x11, 0x00, 0x99, 0x00, 0x16, 0x00, 0x7d, 0x00, 0x59, 0x00,
+  0xab, 0x00, 0xbc, 0x00, 0xbb, 0x00, 0x10, 0x01, 0x5f, 0x00, 0x63, 0x01, 0xce, 0x00, 0x3d, 0x02,
+  0x10, 0x01, 0xd0, 0x02, 0x10, 0x01, 0x05, 0x00, 0xd2, 0x00, 0x10, 0x00, 0x99, 0x00, 0x19, 0x00,
+  0x7d, 0x00, 0x5e, 0x00, 0xab, 0x00, 0xbe, 0x00, 0xbb, 0x00, 0x10, 0x01, 0x5f, 0x00, 0x64, 0x01,
+  0xce, 0x00, 0x3a, 0x02, 0x10, 0x01, 0xd0, 0x02, 0x10, 0x01, 0x02, 0x00, 0xd2, 0x00, 0x10, 0x00,
+  0x99, 0x00, 0x1c, 0x00, 0x7d, 0x00, 0x62, 0x00, 0xab, 0x00, 0xbf, 0x00, 0xbb, 0x00, 0x10, 0x01,
+  0x5f, 0x00, 0x65, 0x01, 0xce, 0x00, 0x38, 0x02, 0x10, 0x01, 0xd0, 0x02, 0xd2, 0x00, 0x10, 0x00,
+  0x99, 0x00, 0x1f, 0x00, 0x7d, 0x00, 0x66, 0x00, 0xab, 0x00, 0xc1, 0x00, 0xbb, 0x00, 0x10, 0x01,
+  0x5f, 0x00, 0x65, 0x01, 0xce, 0x00, 0x35, 0x02, 0x1d, 0x01, 0x3b, 0x02, 0x10, 0x01, 0xcf, 0x02,
+  0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0f, 0x00, 0x99, 0x00, 0x21, 0x00, 0x7d, 0x00, 0x6a, 0x00,
+  0xab, 0x00, 0xc2, 0x00, 0xbb, 0x00, 0x10, 0x01, 0x5f, 0x00, 0x66, 0x01, 0xce, 0x00, 0x31, 0x02,
+  0x1d, 0x01, 0x43, 0x02, 0x10, 0x01, 0xcd, 0x02, 0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0f, 0x00,
+  0x99, 0x00, 0x23, 0x00, 0x7d, 0x00, 0x6d, 0x00, 0xab, 0x00, 0xc3, 0x00, 0xbb, 0x00, 0x10, 0x01,
+  0x5f, 0x00, 0x67, 0x01, 0xce, 0x00, 0x2d, 0x02, 0x1d, 0x01, 0x49, 0x02, 0x10, 0x01, 0xcb, 0x02,
+  0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0f, 0x00, 0x99, 0x00, 0x26, 0x00, 0x7d, 0x00, 0x70, 0x00,
+  0xab, 0x00, 0xc4, 0x00, 0xbb, 0x00, 0x11, 0x01, 0x5f, 0x00, 0x67, 0x01, 0xce, 0x00, 0x2a, 0x02,
+  0x1d, 0x01, 0x4d, 0x02, 0x1a, 0x01, 0x52, 0x02, 0x10, 0x01, 0xc9, 0x02, 0xd2, 0x00, 0xd0, 0x02,
+  0xd2, 0x00, 0x0f, 0x00, 0x99, 0x00, 0x28, 0x00, 0x7d, 0x00, 0x73, 0x00, 0xab, 0x00, 0xc6, 0x00,
+  0xbb, 0x00, 0x11, 0x01, 0x5f, 0x00, 0x68, 0x01, 0xce, 0x00, 0x27, 0x02, 0x1d, 0x01, 0x51, 0x02,
+  0x1a, 0x01, 0x59, 0x02, 0x10, 0x01, 0xc7, 0x02, 0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0f, 0x00,
+  0x99, 0x00, 0x29, 0x00, 0x7d, 0x00, 0x75, 0x00, 0xab, 0x00, 0xc7, 0x00, 0xbb, 0x00, 0x11, 0x01,
+  0x5f, 0x00, 0x68, 0x01, 0xce, 0x00, 0x24, 0x02, 0x1d, 0x01, 0x54, 0x02, 0x1a, 0x01, 0x5f, 0x02,
+  0x10, 0x01, 0xc5, 0x02, 0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0e, 0x00, 0x99, 0x00, 0x2b, 0x00,
+  0x7d, 0x00, 0x76, 0x00, 0x51, 0x00, 0x80, 0x00, 0xab, 0x00, 0xc7, 0x00, 0xbb, 0x00, 0x11, 0x01,
+  0x5f, 0x00, 0x25, 0x01, 0xb1, 0x00, 0x37, 0x01, 0x5f, 0x00, 0x69, 0x01, 0xce, 0x00, 0x1e, 0x02,
+  0x17, 0x01, 0x23, 0x02, 0x1d, 0x01, 0x57, 0x02, 0x1a, 0x01, 0x65, 0x02, 0x10, 0x01, 0xc4, 0x02,
+  0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0e, 0x00, 0x99, 0x00, 0x2d, 0x00, 0x7d, 0x00, 0x77, 0x00,
+  0x51, 0x00, 0x8c, 0x00, 0xab, 0x00, 0xc8, 0x00, 0xbb, 0x00, 0x11, 0x01, 0xb1, 0x00, 0x4c, 0x01,
+  0x5f, 0x00, 0x69, 0x01, 0xce, 0x00, 0x13, 0x02, 0x17, 0x01, 0x24, 0x02, 0x1d, 0x01, 0x5a, 0x02,
+  0x1a, 0x01, 0x6a, 0x02, 0x10, 0x01, 0xc2, 0x02, 0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0e, 0x00,
+  0x99, 0x00, 0x2e, 0x00, 0x7d, 0x00, 0x77, 0x00, 0x51, 0x00, 0x94, 0x00, 0xab, 0x00, 0xc9, 0x00,
+  0xbb, 0x00, 0x0f, 0x01, 0xb1, 0x00, 0x57, 0x01, 0x5f, 0x00, 0x6a, 0x01, 0xce, 0x00, 0x0b, 0x02,
+  0x17, 0x01, 0x26, 0x02, 0x1d, 0x01, 0x5c, 0x02, 0x1a, 0x01, 0x6e, 0x02, 0x10, 0x01, 0xc1, 0x02,
+  0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0e, 0x00, 0x99, 0x00, 0x30, 0x00, 0x7d, 0x00, 0x77, 0x00,
+  0x51, 0x00, 0x9b, 0x00, 0xab, 0x00, 0xca, 0x00, 0xbb, 0x00, 0x0e, 0x01, 0xb1, 0x00, 0x5f, 0x01,
+  0x5f, 0x00, 0x6a, 0x01, 0xce, 0x00, 0x04, 0x02, 0x17, 0x01, 0x25, 0x02, 0xf6, 0x00, 0x28, 0x02,
+  0x1d, 0x01, 0x5f, 0x02, 0x1a, 0x01, 0x72, 0x02, 0x10, 0x01, 0xbf, 0x02, 0xd2, 0x00, 0xd0, 0x02,
+  0xd2, 0x00, 0x0e, 0x00, 0x99, 0x00, 0x31, 0x00, 0x7d, 0x00, 0x78, 0x00, 0x51, 0x00, 0xa1, 0x00,
+  0xab, 0x00, 0xcb, 0x00, 0xbb, 0x00, 0x0c, 0x01, 0xb1, 0x00, 0x66, 0x01, 0x5f, 0x00, 0x6a, 0x01,
+  0xce, 0x00, 0xfe, 0x01, 0x17, 0x01, 0x25, 0x02, 0xf6, 0x00, 0x2a, 0x02, 0x1d, 0x01, 0x61, 0x02,
+  0x1a, 0x01, 0x75, 0x02, 0x10, 0x01, 0xbe, 0x02, 0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0e, 0x00,
+  0x99, 0x00, 0x32, 0x00, 0x7d, 0x00, 0x78, 0x00, 0x51, 0x00, 0xa6, 0x00, 0xab, 0x00, 0xcb, 0x00,
+  0xbb, 0x00, 0x01, 0x01, 0x9e, 0x00, 0x0e, 0x01, 0xb1, 0x00, 0x6b, 0x01, 0xce, 0x00, 0xf1, 0x01,
+  0x1f, 0x01, 0xfc, 0x01, 0x17, 0x01, 0x24, 0x02, 0xf6, 0x00, 0x2c, 0x02, 0x1d, 0x01, 0x63, 0x02,
+  0x1a, 0x01, 0x79, 0x02, 0x10, 0x01, 0xbd, 0x02, 0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0d, 0x00,
+  0x99, 0x00, 0x33, 0x00, 0x7d, 0x00, 0x78, 0x00, 0x51, 0x00, 0xab, 0x00, 0xab, 0x00, 0xcc, 0x00,
+  0xbb, 0x00, 0xf8, 0x00, 0x9e, 0x00, 0x10, 0x01, 0xb1, 0x00, 0x6d, 0x01, 0xce, 0x00, 0xd5, 0x01,
+  0x4b, 0x01, 0xef, 0x01, 0x1f, 0x01, 0xfc, 0x01, 0x17, 0x01, 0x24, 0x02, 0xf6, 0x00, 0x2d, 0x02,
+  0x1d, 0x01, 0x65, 0x02, 0x1a, 0x01, 0x7c, 0x02, 0x10, 0x01, 0xbc, 0x02, 0xd2, 0x00, 0xd0, 0x02,
+  0xd2, 0x00, 0x0d, 0x00, 0x99, 0x00, 0x35, 0x00, 0x7d, 0x00, 0x78, 0x00, 0x51, 0x00, 0xaf, 0x00,
+  0xab, 0x00, 0xcd, 0x00, 0xbb, 0x00, 0xf0, 0x00, 0x9e, 0x00, 0x12, 0x01, 0xb1, 0x00, 0x6f, 0x01,
+  0xce, 0x00, 0xca, 0x01, 0x4b, 0x01, 0xed, 0x01, 0x1f, 0x01, 0xfc, 0x01, 0x17, 0x01, 0x23, 0x02,
+  0xf6, 0x00, 0x2f, 0x02, 0x1d, 0x01, 0x66, 0x02, 0xf4, 0x00, 0x67, 0x02, 0x1a, 0x01, 0x7f, 0x02,
+  0x10, 0x01, 0xbb, 0x02, 0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0d, 0x00, 0x99, 0x00, 0x36, 0x00,
+  0x7d, 0x00, 0x79, 0x00, 0x51, 0x00, 0xb3, 0x00, 0xab, 0x00, 0xcc, 0x00, 0x7e, 0x00, 0xee, 0x00,
+  0x9e, 0x00, 0x14, 0x01, 0xb1, 0x00, 0x70, 0x01, 0xce, 0x00, 0xc2, 0x01, 0x4b, 0x01, 0xec, 0x01,
+  0x1f, 0x01, 0xfc, 0x01, 0x17, 0x01, 0x22, 0x02, 0xf6, 0x00, 0x30, 0x02, 0x1d, 0x01, 0x67, 0x02,
+  0xf4, 0x00, 0x6a, 0x02, 0x1a, 0x01, 0x81, 0x02, 0x10, 0x01, 0xba, 0x02, 0xd2, 0x00, 0xd0, 0x02,
+  0xd2, 0x00, 0x0d, 0x00, 0x99, 0x00, 0x37, 0x00, 0x7d, 0x00, 0x79, 0x00, 0x51, 0x00, 0xb6, 0x00,
+  0xab, 0x00, 0xc8, 0x00, 0x7e, 0x00, 0xee, 0x00, 0x9e, 0x00, 0x16, 0x01, 0xb1, 0x00, 0x69, 0x01,
+  0x25, 0x01, 0x76, 0x01, 0xce, 0x00, 0x9a, 0x01, 0x46, 0x01, 0xb3, 0x01, 0xce, 0x00, 0xbc, 0x01,
+  0x4b, 0x01, 0xea, 0x01, 0x1f, 0x01, 0xfb, 0x01, 0x17, 0x01, 0x22, 0x02, 0xf6, 0x00, 0x32, 0x02,
+  0x1d, 0x01, 0x68, 0x02, 0xf4, 0x00, 0x6c, 0x02, 0x1a, 0x01, 0x84, 0x02, 0x10, 0x01, 0xb9, 0x02,
+  0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0d, 0x00, 0x99, 0x00, 0x38, 0x00, 0x7d, 0x00, 0x79, 0x00,
+  0x51, 0x00, 0xb8, 0x00, 0xa8, 0x00, 0xc2, 0x00, 0xab, 0x00, 0xc5, 0x00, 0x7e, 0x00, 0xee, 0x00,
+  0x9e, 0x00, 0x18, 0x01, 0xb1, 0x00, 0x63, 0x01, 0x25, 0x01, 0x77, 0x01, 0x57, 0x01, 0x85, 0x01,
+  0x53, 0x01, 0x94, 0x01, 0x46, 0x01, 0xb9, 0x01, 0x4b, 0x01, 0xe9, 0x01, 0x1f, 0x01, 0xfb, 0x01,
+  0x17, 0x01, 0x21, 0x02, 0xf6, 0x00, 0x33, 0x02, 0x1d, 0x01, 0x69, 0x02, 0xf4, 0x00, 0x6e, 0x02,
+  0x1a, 0x01, 0x86, 0x02, 0x10, 0x01, 0xb8, 0x02, 0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0d, 0x00,
+  0x99, 0x00, 0x38, 0x00, 0x60, 0x00, 0x3d, 0x00, 0x7d, 0x00, 0x79, 0x00, 0x51, 0x00, 0xb4, 0x00,
+  0xa8, 0x00, 0xc5, 0x00, 0x7e, 0x00, 0xee, 0x00, 0x9e, 0x00, 0x1a, 0x01, 0xb1, 0x00, 0x5d, 0x01,
+  0x25, 0x01, 0x76, 0x01, 0x57, 0x01, 0x85, 0x01, 0x53, 0x01, 0x94, 0x01, 0x46, 0x01, 0xb9, 0x01,
+  0x4b, 0x01, 0xe8, 0x01, 0x1f, 0x01, 0xfb, 0x01, 0x17, 0x01, 0x21, 0x02, 0xf6, 0x00, 0x34, 0x02,
+  0x1d, 0x01, 0x69, 0x02, 0xf4, 0x00, 0x70, 0x02, 0x1a, 0x01, 0x88, 0x02, 0x10, 0x01, 0xb7, 0x02,
+  0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0d, 0x00, 0x99, 0x00, 0x38, 0x00, 0x60, 0x00, 0x45, 0x00,
+  0x7d, 0x00, 0x79, 0x00, 0x51, 0x00, 0xb0, 0x00, 0xa8, 0x00, 0xc5, 0x00, 0x7e, 0x00, 0xef, 0x00,
+  0x9e, 0x00, 0x1b, 0x01, 0xb1, 0x00, 0x59, 0x01, 0x25, 0x01, 0x75, 0x01, 0x57, 0x01, 0x85, 0x01,
+  0x53, 0x01, 0x94, 0x01, 0x46, 0x01, 0xb8, 0x01, 0x4b, 0x01, 0xe7, 0x01, 0x1f, 0x01, 0xfb, 0x01,
+  0x17, 0x01, 0x21, 0x02, 0xf6, 0x00, 0x36, 0x02, 0x1d, 0x01, 0x6a, 0x02, 0xf4, 0x00, 0x72, 0x02,
+  0x1a, 0x01, 0x8a, 0x02, 0x10, 0x01, 0xb6, 0x02, 0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0d, 0x00,
+  0x99, 0x00, 0x38, 0x00, 0x60, 0x00, 0x4c, 0x00, 0x7d, 0x00, 0x7a, 0x00, 0x51, 0x00, 0xac, 0x00,
+  0xa8, 0x00, 0xc5, 0x00, 0x7e, 0x00, 0xef, 0x00, 0x9e, 0x00, 0x1d, 0x01, 0xb1, 0x00, 0x34, 0x01,
+  0x27, 0x01, 0x46, 0x01, 0xb1, 0x00, 0x54, 0x01, 0x25, 0x01, 0x74, 0x01, 0x57, 0x01, 0x85, 0x01,
+  0x53, 0x01, 0x94, 0x01, 0x46, 0x01, 0xb8, 0x01, 0x4b, 0x01, 0xe5, 0x01, 0x1f, 0x01, 0xfb, 0x01,
+  0x17, 0x01, 0x20, 0x02, 0xf6, 0x00, 0x37, 0x02, 0x1d, 0x01, 0x6b, 0x02, 0xf4, 0x00, 0x74, 0x02,
+  0x1a, 0x01, 0x8c, 0x02, 0x10, 0x01, 0xb6, 0x02, 0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0c, 0x00,
+  0x99, 0x00, 0x36, 0x00, 0x35, 0x00, 0x3a, 0x00, 0x60, 0x00, 0x51, 0x00, 0x7d, 0x00, 0x7a, 0x00,
+  0x51, 0x00, 0xa9, 0x00, 0xa8, 0x00, 0xc6, 0x00, 0x7e, 0x00, 0xef, 0x00, 0x9e, 0x00, 0x1e, 0x01,
+  0xb1, 0x00, 0x22, 0x01, 0x27, 0x01, 0x52, 0x01, 0x25, 0x01, 0x74, 0x01, 0x57, 0x01, 0x85, 0x01,
+  0x53, 0x01, 0x94, 0x01, 0x46, 0x01, 0xb8, 0x01, 0x4b, 0x01, 0xe4, 0x01, 0x1f, 0x01, 0xfb, 0x01,
+  0x17, 0x01, 0x20, 0x02, 0xf6, 0x00, 0x38, 0x02, 0x1d, 0x01, 0x6c, 0x02, 0xf4, 0x00, 0x76, 0x02,
+  0x1a, 0x01, 0x8e, 0x02, 0x10, 0x01, 0xb5, 0x02, 0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0c, 0x00,
+  0x99, 0x00, 0x35, 0x00, 0x35, 0x00, 0x3c, 0x00, 0x60, 0x00, 0x56, 0x00, 0x7d, 0x00, 0x7a, 0x00,
+  0x51, 0x00, 0xa5, 0x00, 0xa8, 0x00, 0xc6, 0x00, 0x7e, 0x00, 0xef, 0x00, 0x9e, 0x00, 0x1e, 0x01,
+  0x27, 0x01, 0x51, 0x01, 0x25, 0x01, 0x73, 0x01, 0x57, 0x01, 0x85, 0x01, 0x53, 0x01, 0x94, 0x01,
+  0x46, 0x01, 0xb7, 0x01, 0x4b, 0x01, 0xe3, 0x01, 0x1f, 0x01, 0xfb, 0x01, 0x17, 0x01, 0x1f, 0x02,
+  0xf6, 0x00, 0x39, 0x02, 0x1d, 0x01, 0x6c, 0x02, 0xf4, 0x00, 0x77, 0x02, 0x1a, 0x01, 0x90, 0x02,
+  0x10, 0x01, 0xb4, 0x02, 0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0c, 0x00, 0x99, 0x00, 0x34, 0x00,
+  0x35, 0x00, 0x3d, 0x00, 0x60, 0x00, 0x5b, 0x00, 0x7d, 0x00, 0x7a, 0x00, 0x51, 0x00, 0xa2, 0x00,
+  0xa8, 0x00, 0xc6, 0x00, 0x7e, 0x00, 0xef, 0x00, 0x9e, 0x00, 0x1e, 0x01, 0x27, 0x01, 0x50, 0x01,
+  0x25, 0x01, 0x72, 0x01, 0x57, 0x01, 0x86, 0x01, 0x53, 0x01, 0x94, 0x01, 0x46, 0x01, 0xb7, 0x01,
+  0x4b, 0x01, 0xe2, 0x01, 0x1f, 0x01, 0xfb, 0x01, 0x17, 0x01, 0x1f, 0x02, 0xf6, 0x00, 0x3a, 0x02,
+  0x1d, 0x01, 0x6d, 0x02, 0xf4, 0x00, 0x79, 0x02, 0x1a, 0x01, 0x92, 0x02, 0x10, 0x01, 0xb3, 0x02,
+  0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0c, 0x00, 0x99, 0x00, 0x33, 0x00, 0x35, 0x00, 0x3f, 0x00,
+  0x60, 0x00, 0x5f, 0x00, 0x7d, 0x00, 0x7a, 0x00, 0x51, 0x00, 0xa0, 0x00, 0xa8, 0x00, 0xc6, 0x00,
+  0x7e, 0x00, 0xef, 0x00, 0x9e, 0x00, 0x1e, 0x01, 0x27, 0x01, 0x4f, 0x01, 0x25, 0x01, 0x71, 0x01,
+  0x57, 0x01, 0x86, 0x01, 0x53, 0x01, 0x94, 0x01, 0x46, 0x01, 0xb6, 0x01, 0x4b, 0x01, 0xe1, 0x01,
+  0x1f, 0x01, 0xfa, 0x01, 0x02, 0x01, 0xfc, 0x01, 0x17, 0x01, 0x1f, 0x02, 0xf6, 0x00, 0x3b, 0x02,
+  0x1d, 0x01, 0x6e, 0x02, 0xf4, 0x00, 0x7a, 0x02, 0x1a, 0x01, 0x93, 0x02, 0x10, 0x01, 0xb3, 0x02,
+  0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0c, 0x00, 0x99, 0x00, 0x31, 0x00, 0x35, 0x00, 0x40, 0x00,
+  0x60, 0x00, 0x62, 0x00, 0x7d, 0x00, 0x75, 0x00, 0x68, 0x00, 0x7d, 0x00, 0x51, 0x00, 0x9d, 0x00,
+  0xa8, 0x00, 0xc7, 0x00, 0x7e, 0x00, 0xf0, 0x00, 0x9e, 0x00, 0x1e, 0x01, 0x27, 0x01, 0x4e, 0x01,
+  0x25, 0x01, 0x71, 0x01, 0x57, 0x01, 0x86, 0x01, 0x53, 0x01, 0x94, 0x01, 0x46, 0x01, 0xb6, 0x01,
+  0x4b, 0x01, 0xe0, 0x01, 0x1f, 0x01, 0xf9, 0x01, 0x02, 0x01, 0xfc, 0x01, 0x17, 0x01, 0x1e, 0x02,
+  0xf6, 0x00, 0x3c, 0x02, 0x1d, 0x01, 0x6e, 0x02, 0xf4, 0x00, 0x7c, 0x02, 0x1a, 0x01, 0x95, 0x02,
+  0x10, 0x01, 0xb2, 0x02, 0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0c, 0x00, 0x99, 0x00, 0x30, 0x00,
+  0x35, 0x00, 0x42, 0x00, 0x60, 0x00, 0x66, 0x00, 0x7d, 0x00, 0x6f, 0x00, 0x68, 0x00, 0x81, 0x00,
+  0x51, 0x00, 0x9b, 0x00, 0xa8, 0x00, 0xc7, 0x00, 0x7e, 0x00, 0xf0, 0x00, 0x9e, 0x00, 0x1e, 0x01,
+  0x27, 0x01, 0x4d, 0x01, 0x25, 0x01, 0x70, 0x01, 0x57, 0x01, 0x86, 0x01, 0x53, 0x01, 0x94, 0x01,
+  0x46, 0x01, 0xb6, 0x01, 0x4b, 0x01, 0xdf, 0x01, 0x1f, 0x01, 0xf8, 0x01, 0x02, 0x01, 0xfd, 0x01,
+  0x17, 0x01, 0x1e, 0x02, 0xf6, 0x00, 0x3d, 0x02, 0x1d, 0x01, 0x6f, 0x02, 0xf4, 0x00, 0x7d, 0x02,
+  0x1a, 0x01, 0x96, 0x02, 0x10, 0x01, 0xb1, 0x02, 0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0c, 0x00,
+  0x99, 0x00, 0x2f, 0x00, 0x35, 0x00, 0x43, 0x00, 0x60, 0x00, 0x61, 0x00, 0xc0, 0x00, 0x6c, 0x00,
+  0x68, 0x00, 0x84, 0x00, 0x51, 0x00, 0x98, 0x00, 0xa8, 0x00, 0xc7, 0x00, 0x7e, 0x00, 0xf0, 0x00,
+  0x9e, 0x00, 0x1e, 0x01, 0x27, 0x01, 0x4d, 0x01, 0x25, 0x01, 0x6f, 0x01, 0x57, 0x01, 0x86, 0x01,
+  0x53, 0x01, 0x94, 0x01, 0x46, 0x01, 0xb5, 0x01, 0x4b, 0x01, 0xdf, 0x01, 0x1f, 0x01, 0xf7, 0x01,
+  0x02, 0x01, 0xfe, 0x01, 0x17, 0x01, 0x1e, 0x02, 0xf6, 0x00, 0x3e, 0x02, 0x1d, 0x01, 0x70, 0x02,
+  0xf4, 0x00, 0x7e, 0x02, 0x1a, 0x01, 0x98, 0x02, 0x10, 0x01, 0xb1, 0x02, 0xd2, 0x00, 0xd0, 0x02,
+  0xd2, 0x00, 0x0c, 0x00, 0x99, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x45, 0x00, 0x60, 0x00, 0x5c, 0x00,
+  0xc0, 0x00, 0x6b, 0x00, 0x68, 0x00, 0x87, 0x00, 0x51, 0x00, 0x96, 0x00, 0xa8, 0x00, 0xc7, 0x00,
+  0x7e, 0x00, 0xf0, 0x00, 0x9e, 0x00, 0x1e, 0x01, 0x27, 0x01, 0x4c, 0x01, 0x25, 0x01, 0x6f, 0x01,
+  0x57, 0x01, 0x86, 0x01, 0x53, 0x01, 0x95, 0x01, 0x46, 0x01, 0xb5, 0x01, 0x4b, 0x01, 0xde, 0x01,
+  0x1f, 0x01, 0xf7, 0x01, 0x02, 0x01, 0xff, 0x01, 0x17, 0x01, 0x1d, 0x02, 0xf6, 0x00, 0x3f, 0x02,
+  0x1d, 0x01, 0x70, 0x02, 0xf4, 0x00, 0x80, 0x02, 0x1a, 0x01, 0x96, 0x02, 0xfb, 0x00, 0x9f, 0x02,
+  0x10, 0x01, 0xb0, 0x02, 0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0c, 0x00, 0x99, 0x00, 0x2d, 0x00,
+  0x35, 0x00, 0x46, 0x00, 0x60, 0x00, 0x58, 0x00, 0xc0, 0x00, 0x6a, 0x00, 0x68, 0x00, 0x8a, 0x00,
+  0x51, 0x00, 0x94, 0x00, 0xa8, 0x00, 0xc7, 0x00, 0x7e, 0x00, 0xf0, 0x00, 0x9e, 0x00, 0x1e, 0x01,
+  0x27, 0x01, 0x4b, 0x01, 0x25, 0x01, 0x6e, 0x01, 0x57, 0x01, 0x86, 0x01, 0x53, 0x01, 0x95, 0x01,
+  0x46, 0x01, 0xb5, 0x01, 0x4b, 0x01, 0xdd, 0x01, 0x1f, 0x01, 0xf6, 0x01, 0x02, 0x01, 0xff, 0x01,
+  0x17, 0x01, 0x1d, 0x02, 0xf6, 0x00, 0x40, 0x02, 0x1d, 0x01, 0x71, 0x02, 0xf4, 0x00, 0x81, 0x02,
+  0x1a, 0x01, 0x93, 0x02, 0xfb, 0x00, 0xa7, 0x02, 0x10, 0x01, 0xb0, 0x02, 0xd2, 0x00, 0xd0, 0x02,
+  0xd2, 0x00, 0x0c, 0x00, 0x99, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x47, 0x00, 0x60, 0x00, 0x55, 0x00,
+  0xc0, 0x00, 0x6a, 0x00, 0x68, 0x00, 0x8c, 0x00, 0x51, 0x00, 0x92, 0x00, 0xa8, 0x00, 0xc8, 0x00,
+  0x7e, 0x00, 0xf0, 0x00, 0x9e, 0x00, 0x1e, 0x01, 0x27, 0x01, 0x4b, 0x01, 0x25, 0x01, 0x6e, 0x01,
+  0x57, 0x01, 0x86, 0x01, 0x53, 0x01, 0x95, 0x01, 0x46, 0x01, 0xb4, 0x01, 0x56, 0x01, 0xb5, 0x01,
+  0x4b, 0x01, 0xdc, 0x01, 0x1f, 0x01, 0xf5, 0x01, 0x02, 0x01, 0x00, 0x02, 0x17, 0x01, 0x1d, 0x02,
+  0xf6, 0x00, 0x40, 0x02, 0x1d, 0x01, 0x71, 0x02, 0xf4, 0x00, 0x82, 0x02, 0x1a, 0x01, 0x8f, 0x02,
+  0xfb, 0x00, 0xae, 0x02, 0x10, 0x01, 0xaf, 0x02, 0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0c, 0x00,
+  0x99, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x48, 0x00, 0xc2, 0x00, 0x52, 0x00, 0xc0, 0x00, 0x69, 0x00,
+  0x68, 0x00, 0x8f, 0x00, 0x51, 0x00, 0x90, 0x00, 0xa8, 0x00, 0xc8, 0x00, 0x7e, 0x00, 0xf0, 0x00,
+  0x9e, 0x00, 0x1e, 0x01, 0x27, 0x01, 0x4a, 0x01, 0x25, 0x01, 0x6d, 0x01, 0x57, 0x01, 0x86, 0x01,
+  0x64, 0x01, 0x87, 0x01, 0x53, 0x01, 0x95, 0x01, 0x46, 0x01, 0xb2, 0x01, 0x56, 0x01, 0xb6, 0x01,
+  0x4b, 0x01, 0xdc, 0x01, 0x1f, 0x01, 0xf5, 0x01, 0x02, 0x01, 0x00, 0x02, 0x17, 0x01, 0x1c, 0x02,
+  0xf6, 0x00, 0x40, 0x02, 0xec, 0x00, 0x42, 0x02, 0x1d, 0x01, 0x72, 0x02, 0xf4, 0x00, 0x83, 0x02,
+  0x1a, 0x01, 0x8c, 0x02, 0xfb, 0x00, 0xb0, 0x02, 0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0c, 0x00,
+  0x99, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x48, 0x00, 0xc2, 0x00, 0x53, 0x00, 0xc0, 0x00, 0x68, 0x00,
+  0x68, 0x00, 0x90, 0x00, 0xa8, 0x00, 0xc8, 0x00, 0x7e, 0x00, 0xf0, 0x00, 0x9e, 0x00, 0x1e, 0x01,
+  0x27, 0x01, 0x49, 0x01, 0x25, 0x01, 0x6d, 0x01, 0x57, 0x01, 0x86, 0x01, 0x64, 0x01, 0x89, 0x01,
+  0x53, 0x01, 0x95, 0x01, 0x46, 0x01, 0xb0, 0x01, 0x56, 0x01, 0xb8, 0x01, 0x4b, 0x01, 0xdb, 0x01,
+  0x1f, 0x01, 0xf4, 0x01, 0x02, 0x01, 0x01, 0x02, 0x17, 0x01, 0x1c, 0x02, 0xf6, 0x00, 0x3f, 0x02,
+  0xec, 0x00, 0x43, 0x02, 0xdf, 0x00, 0x44, 0x02, 0x1d, 0x01, 0x72, 0x02, 0xf4, 0x00, 0x84, 0x02,
+  0x1a, 0x01, 0x8a, 0x02, 0xfb, 0x00, 0xb1, 0x02, 0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0c, 0x00,
+  0x99, 0x00, 0x29, 0x00, 0x35, 0x00, 0x47, 0x00, 0xc2, 0x00, 0x54, 0x00, 0xc0, 0x00, 0x68, 0x00,
+  0x68, 0x00, 0x90, 0x00, 0xa8, 0x00, 0xc8, 0x00, 0x7e, 0x00, 0xf1, 0x00, 0x9e, 0x00, 0x1e, 0x01,
+  0x27, 0x01, 0x49, 0x01, 0x25, 0x01, 0x6c, 0x01, 0x57, 0x01, 0x86, 0x01, 0x64, 0x01, 0x8b, 0x01,
+  0x53, 0x01, 0x95, 0x01, 0x46, 0x01, 0xaf, 0x01, 0x56, 0x01, 0xb9, 0x01, 0x4b, 0x01, 0xda, 0x01,
+  0x1f, 0x01, 0xf3, 0x01, 0x02, 0x01, 0x02, 0x02, 0x17, 0x01, 0x1c, 0x02, 0xf6, 0x00, 0x3d, 0x02,
+  0xec, 0x00, 0x43, 0x02, 0xdf, 0x00, 0x47, 0x02, 0x1d, 0x01, 0x73, 0x02, 0xf4, 0x00, 0x85, 0x02,
+  0x1a, 0x01, 0x87, 0x02, 0xfb, 0x00, 0xb2, 0x02, 0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0c, 0x00,
+  0x99, 0x00, 0x28, 0x00, 0x35, 0x00, 0x46, 0x00, 0xc2, 0x00, 0x55, 0x00, 0xc0, 0x00, 0x67, 0x00,
+  0x68, 0x00, 0x8e, 0x00, 0x65, 0x00, 0x92, 0x00, 0xa8, 0x00, 0xc8, 0x00, 0x7e, 0x00, 0xf1, 0x00,
+  0x9e, 0x00, 0x1e, 0x01, 0x27, 0x01, 0x48, 0x01, 0x25, 0x01, 0x6c, 0x01, 0x57, 0x01, 0x85, 0x01,
+  0x64, 0x01, 0x8c, 0x01, 0x53, 0x01, 0x95, 0x01, 0x46, 0x01, 0xad, 0x01, 0x56, 0x01, 0xba, 0x01,
+  0x4b, 0x01, 0xd9, 0x01, 0x1f, 0x01, 0xf3, 0x01, 0x02, 0x01, 0x02, 0x02, 0x17, 0x01, 0x1c, 0x02,
+  0xf6, 0x00, 0x3c, 0x02, 0xec, 0x00, 0x43, 0x02, 0xdf, 0x00, 0x4a, 0x02, 0x1d, 0x01, 0x73, 0x02,
+  0xf4, 0x00, 0x85, 0x02, 0xfb, 0x00, 0xb2, 0x02, 0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0b, 0x00,
+  0x99, 0x00, 0x27, 0x00, 0x35, 0x00, 0x46, 0x00, 0xc2, 0x00, 0x56, 0x00, 0xc0, 0x00, 0x65, 0x00,
+  0x80, 0x00, 0x66, 0x00, 0x68, 0x00, 0x8c, 0x00, 0x65, 0x00, 0x94, 0x00, 0xa8, 0x00, 0xc8, 0x00,
+  0x7e, 0x00, 0xf1, 0x00, 0x9e, 0x00, 0x1e, 0x01, 0x27, 0x01, 0x48, 0x01, 0x25, 0x01, 0x6b, 0x01,
+  0x57, 0x01, 0x85, 0x01, 0x64, 0x01, 0x8e, 0x01, 0x53, 0x01, 0x95, 0x01, 0x65, 0x01, 0x9b, 0x01,
+  0x46, 0x01, 0xac, 0x01, 0x56, 0x01, 0xbb, 0x01, 0x4b, 0x01, 0xd9, 0x01, 0x1f, 0x01, 0xf2, 0x01,
+  0x02, 0x01, 0x03, 0x02, 0x17, 0x01, 0x1b, 0x02, 0xf6, 0x00, 0x3a, 0x02, 0xec, 0x00, 0x43, 0x02,
+  0xdf, 0x00, 0x4d, 0x02, 0x1d, 0x01, 0x74, 0x02, 0xf4, 0x00, 0x84, 0x02, 0xfb, 0x00, 0xb3, 0x02,
+  0xd2, 0x00, 0xd0, 0x02, 0xd2, 0x00, 0x0b, 0x00, 0x99, 0x00, 0x27, 0x00, 0x35, 0x00, 0x45, 0x00,
+  0xc2, 0x00, 0x56, 0x00, 0x80, 0x00, 0x67, 0x00, 0x68, 0x00, 0x89, 0x00, 0x65, 0x00, 0x96, 0x00,
+  0xa8, 0x00, 0xc9, 0x00, 0x7e, 0x00, 0xef, 0x00, 0x6b, 0x00, 0xf2, 0x00, 0x9e, 0x00, 0x1e, 0x01,
+  0x27, 0x01, 0x47, 0x01, 0x25, 0x01, 0x6b, 0x01, 0x57, 0x01, 0x85, 0x01, 0x64, 0x01, 0x8f, 0x01,
+  0x53, 0x01, 0x94, 0x01, 0x65, 0x01, 0xa5, 0x01, 0x46, 0x01, 0xaa, 0x01, 0x56, 0x01, 0xbb, 0x01,
+  0x4b, 0x01, 0xd8, 0x01, 0x1f, 0x01, 0xf2, 0x01, 0x02, 0x01, 0x03, 0x02, 0x17, 0x01, 0x1b, 0x02,
+  0xf6, 0x00, 0x39, 0x02, 0xec, 0x00, 0x43, 0x02, 0xdf, 0x00, 0x50, 0x02, 0x1d, 0x01, 0x74, 0x02,
+  0xf4, 0x00, 0x84, 0x02, 0xfb, 0x00, 0xb1, 0x02, 0xf1, 0x00, 0xb5, 0x02, 0xd2, 0x00, 0xd0, 0x02,
+  0xd2, 0x00, 0x0a, 0x00, 0x34, 0x00, 0x0c, 0x00, 0x99, 0x00, 0x26, 0x00, 0x35, 0x00, 0x44, 0x00,
+  0xc2, 0x00, 0x56, 0x00, 0x80, 0x00, 0x67, 0x00, 0x68, 0x00, 0x84, 0x00, 0x61, 0x00, 0x88, 0x00,
+  0x65, 0x00, 0x97, 0x00, 0xa8, 0x00, 0xc9, 0x00, 0x7e, 0x00, 0xea, 0x00, 0x6b, 0x00, 0xf7, 0x00,
+  0x9e, 0x00, 0x1e, 0x01, 0x27, 0x01, 0x46, 0x01, 0x25, 0x01, 0x6a, 0x01, 0x57, 0x01, 0x84, 0x01,
+  0x64, 0x01, 0x91, 0x01, 0x53, 0x01, 0x94, 0x01, 0x65, 0x01, 0xa9, 0x01, 0x56, 0x01, 0xbc, 0x01,
+  0x4b, 0x01, 0xd8, 0x01, 0x1f, 0x01, 0xf1, 0x01, 0x02, 0x01, 0x04, 0x02, 0x17, 0x01, 0x1b, 0x02,
+  0xf6, 0x00, 0x38, 0x02, 0xec, 0x00, 0x43, 0x02, 0xdf, 0x00, 0x52, 0x02, 0x1d, 0x01, 0x74, 0x02,
+  0xf4, 0x00, 0x83, 0x02, 0xfb, 0x00, 0xae, 0x02, 0xf1, 0x00, 0xb7, 0x02, 0xd2, 0x00, 0xd0, 0x02,
+  0x34, 0x00, 0x10, 0x00, 0x99, 0x00, 0x25, 0x00, 0x35, 0x00, 0x44, 0x00, 0xc2, 0x00, 0x55, 0x00,
+  0x80, 0x00, 0x67, 0x00, 0x68, 0x00, 0x7e, 0x00, 0x61, 0x00, 0x86, 0x00, 0x65, 0x00, 0x99, 0x00,
+  0xa8, 0x00, 0xc9, 0x00, 0x7e, 0x00, 0xe5, 0x00, 0x6b, 0x00, 0xfc, 0x00, 0x9e, 0x00, 0x1e, 0x01,
+  0x27, 0x01, 0x46, 0x01, 0x25, 0x01, 0x62, 0x01, 0x47, 0x01, 0x6a, 0x01, 0x57, 0x01, 0x84, 0x01,
+  0x64, 0x01, 0x92, 0x01, 0x53, 0x01, 0x93, 0x01, 0x5b, 0x01, 0x97, 0x01, 0x65, 0x01, 0xa8, 0x01,
+  0x56, 0x01, 0xbd, 0x01, 0x4b, 0x01, 0xd7, 0x01, 0x1f, 0x01, 0xf0, 0x01, 0x02, 0x01, 0x04, 0x02,
+  0x17, 0x01, 0x1b, 0x02, 0xf6, 0x00, 0x36, 0x02, 0xec, 0x00, 0x43, 0x02, 0xdf, 0x00, 0x55, 0x02,
+  0x1d, 0x01, 0x75, 0x02, 0xf4, 0x00, 0x82, 0x02, 0xfb, 0x00, 0xaa, 0x02, 0xf1, 0x00, 0xb9, 0x02,
+  0xd2, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x14, 0x00, 0x99, 0x00, 0x24, 0x00, 0x35, 0x00, 0x43, 0x00,
+  0xc2, 0x00, 0x53, 0x00, 0xb2, 0x00, 0x5a, 0x00, 0x80, 0x00, 0x67, 0x00, 0x68, 0x00, 0x79, 0x00,
+  0x61, 0x00, 0x85, 0x00, 0x65, 0x00, 0x9a, 0x00, 0xa8, 0x00, 0xc9, 0x00, 0x7e, 0x00, 0xe1, 0x00,
+  0x6b, 0x00, 0x00, 0x01, 0x9e, 0x00, 0x1e, 0x01, 0x27, 0x01, 0x45, 0x01, 0x25, 0x01, 0x56, 0x01,
+  0x47, 0x01, 0x6c, 0x01, 0x57, 0x01, 0x7f, 0x01, 0x42, 0x01, 0x85, 0x01, 0x64, 0x01, 0x91, 0x01,
+  0x5b, 0x01, 0xa2, 0x01, 0x65, 0x01, 0xa7, 0x01, 0x56, 0x01, 0xbe, 0x01, 0x4b, 0x01, 0xd6, 0x01,
+  0x1f, 0x01, 0xf0, 0x01, 0x02, 0x01, 0x04, 0x02, 0x01, 0x01, 0x06, 0x02, 0x17, 0x01, 0x1a, 0x02,
+  0xf6, 0x00, 0x35, 0x02, 0xec, 0x00, 0x43, 0x02, 0xdf, 0x00, 0x57, 0x02, 0x1d, 0x01, 0x75, 0x02,
+  0xf4, 0x00, 0x81, 0x02, 0xfb, 0x00, 0xa6, 0x02, 0xf1, 0x00, 0xbc, 0x02, 0xd2, 0x00, 0xc9, 0x02,
+  0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x18, 0x00, 0x99, 0x00, 0x24, 0x00, 0x35, 0x00, 0x43, 0x00,
+  0xc2, 0x00, 0x51, 0x00, 0xb2, 0x00, 0x5e, 0x00, 0x80, 0x00, 0x62, 0x00, 0x90, 0x00, 0x69, 0x00,
+  0x68, 0x00, 0x75, 0x00, 0x61, 0x00, 0x84, 0x00, 0x65, 0x00, 0x9a, 0x00, 0xaa, 0x00, 0x9e, 0x00,
+  0xa8, 0x00, 0xc9, 0x00, 0x7e, 0x00, 0xdd, 0x00, 0x6b, 0x00, 0x03, 0x01, 0x9e, 0x00, 0x1e, 0x01,
+  0x27, 0x01, 0x45, 0x01, 0x25, 0x01, 0x4a, 0x01, 0x43, 0x01, 0x53, 0x01, 0x47, 0x01, 0x6d, 0x01,
+  0x57, 0x01, 0x78, 0x01, 0x42, 0x01, 0x88, 0x01, 0x64, 0x01, 0x90, 0x01, 0x5b, 0x01, 0xa6, 0x01,
+  0x56, 0x01, 0xbf, 0x01, 0x4b, 0x01, 0xd6, 0x01, 0x1f, 0x01, 0xef, 0x01, 0x02, 0x01, 0x04, 0x02,
+  0x01, 0x01, 0x09, 0x02, 0x17, 0x01, 0x1a, 0x02, 0xf6, 0x00, 0x34, 0x02, 0xec, 0x00, 0x43, 0x02,
+  0xdf, 0x00, 0x59, 0x02, 0x1d, 0x01, 0x76, 0x02, 0xf4, 0x00, 0x81, 0x02, 0xfb, 0x00, 0xa3, 0x02,
+  0xf1, 0x00, 0xbe, 0x02, 0xd2, 0x00, 0xc4, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x1b, 0x00,
+  0x99, 0x00, 0x23, 0x00, 0x35, 0x00, 0x42, 0x00, 0xc2, 0x00, 0x4f, 0x00, 0xb2, 0x00, 0x5f, 0x00,
+  0x90, 0x00, 0x6a, 0x00, 0x68, 0x00, 0x71, 0x00, 0x61, 0x00, 0x83, 0x00, 0x65, 0x00, 0x98, 0x00,
+  0xaa, 0x00, 0xa1, 0x00, 0xc1, 0x00, 0xa2, 0x00, 0xa8, 0x00, 0xc9, 0x00, 0x7e, 0x00, 0xd9, 0x00,
+  0x6b, 0x00, 0x03, 0x01, 0x4d, 0x00, 0x09, 0x01, 0x9e, 0x00, 0x1e, 0x01, 0x27, 0x01, 0x44, 0x01,
+  0x43, 0x01, 0x55, 0x01, 0x47, 0x01, 0x6d, 0x01, 0x36, 0x01, 0x72, 0x01, 0x42, 0x01, 0x8a, 0x01,
+  0x64, 0x01, 0x8b, 0x01, 0x4a, 0x01, 0x91, 0x01, 0x5b, 0x01, 0xa4, 0x01, 0x54, 0x01, 0xa7, 0x01,
+  0x56, 0x01, 0xc0, 0x01, 0x67, 0x01, 0xc2, 0x01, 0x4b, 0x01, 0xd5, 0x01, 0x1f, 0x01, 0xef, 0x01,
+  0x02, 0x01, 0x04, 0x02, 0x01, 0x01, 0x0b, 0x02, 0x17, 0x01, 0x1a, 0x02, 0xf6, 0x00, 0x33, 0x02,
+  0xec, 0x00, 0x42, 0x02, 0xdf, 0x00, 0x5b, 0x02, 0x1d, 0x01, 0x76, 0x02, 0xf4, 0x00, 0x80, 0x02,
+  0xfb, 0x00, 0xa0, 0x02, 0xf1, 0x00, 0xbf, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x1f, 0x00,
+  0x99, 0x00, 0x22, 0x00, 0x35, 0x00, 0x42, 0x00, 0xc2, 0x00, 0x4d, 0x00, 0xb2, 0x00, 0x5e, 0x00,
+  0x90, 0x00, 0x6b, 0x00, 0x68, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x82, 0x00, 0x65, 0x00, 0x97, 0x00,
+  0xaa, 0x00, 0xa1, 0x00, 0xc1, 0x00, 0xac, 0x00, 0xa8, 0x00, 0xc9, 0x00, 0x7e, 0x00, 0xd6, 0x00,
+  0x6b, 0x00, 0x00, 0x01, 0x4d, 0x00, 0x0e, 0x01, 0x9e, 0x00, 0x1e, 0x01, 0x27, 0x01, 0x42, 0x01,
+  0x43, 0x01, 0x56, 0x01, 0x47, 0x01, 0x6c, 0x01, 0x36, 0x01, 0x73, 0x01, 0x42, 0x01, 0x8a, 0x01,
+  0x4a, 0x01, 0x93, 0x01, 0x5b, 0x01, 0x9f, 0x01, 0x6b, 0x01, 0xa1, 0x01, 0x54, 0x01, 0xa7, 0x01,
+  0x56, 0x01, 0xbf, 0x01, 0x67, 0x01, 0xce, 0x01, 0x4b, 0x01, 0xd5, 0x01, 0x1f, 0x01, 0xee, 0x01,
+  0x02, 0x01, 0x04, 0x02, 0x01, 0x01, 0x0e, 0x02, 0x17, 0x01, 0x1a, 0x02, 0xf6, 0x00, 0x32, 0x02,
+  0xec, 0x00, 0x42, 0x02, 0xdf, 0x00, 0x5d, 0x02, 0x1d, 0x01, 0x76, 0x02, 0xf4, 0x00, 0x7f, 0x02,
+  0xfb, 0x00, 0x9e, 0x02, 0xf1, 0x00, 0xbf, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x22, 0x00,
+  0x35, 0x00, 0x41, 0x00, 0xc2, 0x00, 0x4c, 0x00, 0xb2, 0x00, 0x5c, 0x00, 0x90, 0x00, 0x6c, 0x00,
+  0x61, 0x00, 0x81, 0x00, 0x65, 0x00, 0x96, 0x00, 0xaa, 0x00, 0xa0, 0x00, 0xc1, 0x00, 0xb2, 0x00,
+  0x47, 0x00, 0xb9, 0x00, 0xa8, 0x00, 0xca, 0x00, 0x7e, 0x00, 0xd3, 0x00, 0x6b, 0x00, 0xfe, 0x00,
+  0x4d, 0x00, 0x12, 0x01, 0x9e, 0x00, 0x1e, 0x01, 0x27, 0x01, 0x40, 0x01, 0x43, 0x01, 0x58, 0x01,
+  0x47, 0x01, 0x6b, 0x01, 0x36, 0x01, 0x75, 0x01, 0x42, 0x01, 0x8a, 0x01, 0x4a, 0x01, 0x95, 0x01,
+  0x5b, 0x01, 0x99, 0x01, 0x6b, 0x01, 0xa0, 0x01, 0x54, 0x01, 0xa8, 0x01, 0x56, 0x01, 0xbf, 0x01,
+  0x67, 0x01, 0xd3, 0x01, 0x5d, 0x01, 0xd5, 0x01, 0x1f, 0x01, 0xea, 0x01, 0x08, 0x01, 0xef, 0x01,
+  0x02, 0x01, 0x04, 0x02, 0x01, 0x01, 0x10, 0x02, 0x17, 0x01, 0x19, 0x02, 0x00, 0x01, 0x1a, 0x02,
+  0xf6, 0x00, 0x31, 0x02, 0xec, 0x00, 0x42, 0x02, 0xdf, 0x00, 0x5f, 0x02, 0x1d, 0x01, 0x77, 0x02,
+  0xf4, 0x00, 0x7f, 0x02, 0xfb, 0x00, 0x9b, 0x02, 0xf1, 0x00, 0xbf, 0x02, 0x34, 0x00, 0xd0, 0x02,
+  0x34, 0x00, 0x23, 0x00, 0x35, 0x00, 0x41, 0x00, 0xc2, 0x00, 0x4a, 0x00, 0xb2, 0x00, 0x5a, 0x00,
+  0x90, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x80, 0x00, 0x65, 0x00, 0x95, 0x00, 0xaa, 0x00, 0xa0, 0x00,
+  0xc1, 0x00, 0xb2, 0x00, 0x47, 0x00, 0xca, 0x00, 0x7e, 0x00, 0xd0, 0x00, 0x6b, 0x00, 0xfc, 0x00,
+  0x4d, 0x00, 0x17, 0x01, 0x9e, 0x00, 0x1e, 0x01, 0x27, 0x01, 0x3e, 0x01, 0x43, 0x01, 0x59, 0x01,
+  0x47, 0x01, 0x6b, 0x01, 0x36, 0x01, 0x76, 0x01, 0x42, 0x01, 0x89, 0x01, 0x4a, 0x01, 0x96, 0x01,
+  0x6b, 0x01, 0x9f, 0x01, 0x54, 0x01, 0xa9, 0x01, 0x56, 0x01, 0xbe, 0x01, 0x67, 0x01, 0xd0, 0x01,
+  0x5d, 0x01, 0xd6, 0x01, 0x1f, 0x01, 0xe6, 0x01, 0x08, 0x01, 0xf0, 0x01, 0x02, 0x01, 0x04, 0x02,
+  0x01, 0x01, 0x12, 0x02, 0x17, 0x01, 0x15, 0x02, 0x00, 0x01, 0x1b, 0x02, 0xf6, 0x00, 0x30, 0x02,
+  0xec, 0x00, 0x42, 0x02, 0xdf, 0x00, 0x61, 0x02, 0x1d, 0x01, 0x77, 0x02, 0xf4, 0x00, 0x7e, 0x02,
+  0xfb, 0x00, 0x98, 0x02, 0xf1, 0x00, 0xbf, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x24, 0x00,
+  0x35, 0x00, 0x40, 0x00, 0xc2, 0x00, 0x49, 0x00, 0xb2, 0x00, 0x58, 0x00, 0x90, 0x00, 0x6c, 0x00,
+  0x61, 0x00, 0x7f, 0x00, 0x65, 0x00, 0x94, 0x00, 0xaa, 0x00, 0xa0, 0x00, 0xc1, 0x00, 0xb1, 0x00,
+  0x47, 0x00, 0xcc, 0x00, 0x7e, 0x00, 0xcd, 0x00, 0x6b, 0x00, 0xfb, 0x00, 0x4d, 0x00, 0x17, 0x01,
+  0xb4, 0x00, 0x1c, 0x01, 0x9e, 0x00, 0x1e, 0x01, 0x27, 0x01, 0x3c, 0x01, 0x43, 0x01, 0x5b, 0x01,
+  0x47, 0x01, 0x6a, 0x01, 0x36, 0x01, 0x77, 0x01, 0x42, 0x01, 0x89, 0x01, 0x4a, 0x01, 0x96, 0x01,
+  0x6b, 0x01, 0x9e, 0x01, 0x54, 0x01, 0xa9, 0x01, 0x56, 0x01, 0xbe, 0x01, 0x67, 0x01, 0xce, 0x01,
+  0x5d, 0x01, 0xd7, 0x01, 0x1f, 0x01, 0xe2, 0x01, 0x08, 0x01, 0xf0, 0x01, 0x02, 0x01, 0x04, 0x02,
+  0x01, 0x01, 0x13, 0x02, 0x00, 0x01, 0x1c, 0x02, 0xf6, 0x00, 0x2f, 0x02, 0xec, 0x00, 0x42, 0x02,
+  0xdf, 0x00, 0x63, 0x02, 0x1d, 0x01, 0x77, 0x02, 0xf4, 0x00, 0x7e, 0x02, 0xfb, 0x00, 0x96, 0x02,
+  0xf1, 0x00, 0xbf, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x25, 0x00, 0x35, 0x00, 0x40, 0x00,
+  0xc2, 0x00, 0x47, 0x00, 0xb2, 0x00, 0x57, 0x00, 0x90, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x7e, 0x00,
+  0x65, 0x00, 0x93, 0x00, 0xaa, 0x00, 0xa0, 0x00, 0xc1, 0x00, 0xb1, 0x00, 0x47, 0x00, 0xcd, 0x00,
+  0x6b, 0x00, 0xf9, 0x00, 0x4d, 0x00, 0x13, 0x01, 0xb4, 0x00, 0x1f, 0x01, 0x27, 0x01, 0x3a, 0x01,
+  0x43, 0x01, 0x5c, 0x01, 0x47, 0x01, 0x68, 0x01, 0x4f, 0x01, 0x6b, 0x01, 0x36, 0x01, 0x79, 0x01,
+  0x42, 0x01, 0x86, 0x01, 0x3b, 0x01, 0x89, 0x01, 0x4a, 0x01, 0x96, 0x01, 0x6b, 0x01, 0x9d, 0x01,
+  0x54, 0x01, 0xaa, 0x01, 0x56, 0x01, 0xbd, 0x01, 0x67, 0x01, 0xcc, 0x01, 0x5d, 0x01, 0xd8, 0x01,
+  0x1f, 0x01, 0xdf, 0x01, 0x08, 0x01, 0xf1, 0x01, 0x02, 0x01, 0x04, 0x02, 0x01, 0x01, 0x0f, 0x02,
+  0xdb, 0x00, 0x12, 0x02, 0x00, 0x01, 0x1d, 0x02, 0xf6, 0x00, 0x2e, 0x02, 0xec, 0x00, 0x42, 0x02,
+  0xdf, 0x00, 0x64, 0x02, 0x1d, 0x01, 0x78, 0x02, 0x0b, 0x01, 0x83, 0x02, 0xfb, 0x00, 0x94, 0x02,
+  0xf1, 0x00, 0xbf, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x26, 0x00, 0x35, 0x00, 0x3f, 0x00,
+  0xc2, 0x00, 0x46, 0x00, 0xb2, 0x00, 0x55, 0x00, 0x90, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x7d, 0x00,
+  0x65, 0x00, 0x91, 0x00, 0xb9, 0x00, 0x93, 0x00, 0xaa, 0x00, 0xa0, 0x00, 0xc1, 0x00, 0xb0, 0x00,
+  0x47, 0x00, 0xcd, 0x00, 0x6b, 0x00, 0xf7, 0x00, 0x4d, 0x00, 0x10, 0x01, 0xb4, 0x00, 0x21, 0x01,
+  0x27, 0x01, 0x38, 0x01, 0x43, 0x01, 0x5d, 0x01, 0x47, 0x01, 0x67, 0x01, 0x4f, 0x01, 0x6b, 0x01,
+  0x36, 0x01, 0x7a, 0x01, 0x42, 0x01, 0x7b, 0x01, 0x3b, 0x01, 0x8a, 0x01, 0x4a, 0x01, 0x96, 0x01,
+  0x6b, 0x01, 0x9c, 0x01, 0x54, 0x01, 0xaa, 0x01, 0x56, 0x01, 0xbc, 0x01, 0x60, 0x01, 0xc1, 0x01,
+  0x67, 0x01, 0xcb, 0x01, 0x5d, 0x01, 0xd8, 0x01, 0xd4, 0x00, 0xdc, 0x01, 0x08, 0x01, 0xf1, 0x01,
+  0x02, 0x01, 0x04, 0x02, 0x01, 0x01, 0x0a, 0x02, 0xdb, 0x00, 0x13, 0x02, 0x00, 0x01, 0x1e, 0x02,
+  0xf6, 0x00, 0x2d, 0x02, 0xec, 0x00, 0x42, 0x02, 0xdf, 0x00, 0x66, 0x02, 0x1d, 0x01, 0x75, 0x02,
+  0x0b, 0x01, 0x88, 0x02, 0xfb, 0x00, 0x92, 0x02, 0xf1, 0x00, 0xbe, 0x02, 0x34, 0x00, 0xd0, 0x02,
+  0x34, 0x00, 0x27, 0x00, 0x35, 0x00, 0x3f, 0x00, 0xc2, 0x00, 0x45, 0x00, 0xb2, 0x00, 0x54, 0x00,
+  0x90, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x7c, 0x00, 0x65, 0x00, 0x8f, 0x00, 0xb9, 0x00, 0x93, 0x00,
+  0xaa, 0x00, 0x9f, 0x00, 0xc1, 0x00, 0xaf, 0x00, 0x47, 0x00, 0xcc, 0x00, 0xbd, 0x00, 0xce, 0x00,
+  0x6b, 0x00, 0xf5, 0x00, 0x4d, 0x00, 0x0d, 0x01, 0xb4, 0x00, 0x23, 0x01, 0x27, 0x01, 0x37, 0x01,
+  0x43, 0x01, 0x5f, 0x01, 0x47, 0x01, 0x65, 0x01, 0x4f, 0x01, 0x6c, 0x01, 0x36, 0x01, 0x7a, 0x01,
+  0x3b, 0x01, 0x8a, 0x01, 0x4a, 0x01, 0x8c, 0x01, 0x6d, 0x01, 0x97, 0x01, 0x6b, 0x01, 0x9b, 0x01,
+  0x54, 0x01, 0xa9, 0x01, 0x4c, 0x01, 0xab, 0x01, 0x56, 0x01, 0xbb, 0x01, 0x60, 0x01, 0xc4, 0x01,
+  0x67, 0x01, 0xc9, 0x01, 0x5d, 0x01, 0xd7, 0x01, 0xd4, 0x00, 0xdd, 0x01, 0x08, 0x01, 0xf2, 0x01,
+  0x02, 0x01, 0x04, 0x02, 0x01, 0x01, 0x05, 0x02, 0xdb, 0x00, 0x13, 0x02, 0x00, 0x01, 0x20, 0x02,
+  0xf6, 0x00, 0x2c, 0x02, 0xec, 0x00, 0x42, 0x02, 0xdf, 0x00, 0x68, 0x02, 0x1d, 0x01, 0x72, 0x02,
+  0x0b, 0x01, 0x8d, 0x02, 0xfb, 0x00, 0x90, 0x02, 0xf1, 0x00, 0xbe, 0x02, 0x34, 0x00, 0xd0, 0x02,
+  0x34, 0x00, 0x28, 0x00, 0x35, 0x00, 0x3e, 0x00, 0xc2, 0x00, 0x43, 0x00, 0xb2, 0x00, 0x52, 0x00,
+  0x90, 0x00, 0x6c, 0x00, 0xbf, 0x00, 0x72, 0x00, 0x61, 0x00, 0x7b, 0x00, 0x65, 0x00, 0x8d, 0x00,
+  0xb9, 0x00, 0x93, 0x00, 0xaa, 0x00, 0x9f, 0x00, 0xc1, 0x00, 0xaf, 0x00, 0x47, 0x00, 0xcb, 0x00,
+  0xbd, 0x00, 0xd0, 0x00, 0x6b, 0x00, 0xf4, 0x00, 0x4d, 0x00, 0x0a, 0x01, 0xb4, 0x00, 0x24, 0x01,
+  0x27, 0x01, 0x35, 0x01, 0x43, 0x01, 0x60, 0x01, 0x47, 0x01, 0x63, 0x01, 0x4f, 0x01, 0x6c, 0x01,
+  0x36, 0x01, 0x7a, 0x01, 0x3b, 0x01, 0x8a, 0x01, 0x6d, 0x01, 0x98, 0x01, 0x6b, 0x01, 0x9a, 0x01,
+  0x54, 0x01, 0xa6, 0x01, 0x4c, 0x01, 0xad, 0x01, 0x56, 0x01, 0xb9, 0x01, 0x60, 0x01, 0xc7, 0x01,
+  0x5d, 0x01, 0xd3, 0x01, 0x03, 0x01, 0xd6, 0x01, 0xd4, 0x00, 0xde, 0x01, 0x08, 0x01, 0xf2, 0x01,
+  0x02, 0x01, 0x04, 0x02, 0xdb, 0x00, 0x13, 0x02, 0x00, 0x01, 0x21, 0x02, 0xf6, 0x00, 0x2b, 0x02,
+  0xec, 0x00, 0x42, 0x02, 0xdf, 0x00, 0x69, 0x02, 0x1d, 0x01, 0x6f, 0x02, 0x0b, 0x01, 0x8f, 0x02,
+  0xf1, 0x00, 0xbe, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x29, 0x00, 0x35, 0x00, 0x3e, 0x00,
+  0xc2, 0x00, 0x42, 0x00, 0xb2, 0x00, 0x51, 0x00, 0x90, 0x00, 0x6a, 0x00, 0xbf, 0x00, 0x78, 0x00,
+  0x61, 0x00, 0x7a, 0x00, 0x65, 0x00, 0x8c, 0x00, 0xb9, 0x00, 0x93, 0x00, 0xaa, 0x00, 0x9f, 0x00,
+  0xc1, 0x00, 0xae, 0x00, 0x47, 0x00, 0xca, 0x00, 0xbd, 0x00, 0xd1, 0x00, 0x6b, 0x00, 0xf2, 0x00,
+  0x4d, 0x00, 0x07, 0x01, 0xb4, 0x00, 0x25, 0x01, 0x27, 0x01, 0x33, 0x01, 0x43, 0x01, 0x61, 0x01,
+  0x47, 0x01, 0x62, 0x01, 0x4f, 0x01, 0x6c, 0x01, 0x36, 0x01, 0x7a, 0x01, 0x3b, 0x01, 0x8a, 0x01,
+  0x6d, 0x01, 0x9a, 0x01, 0x54, 0x01, 0xa3, 0x01, 0x4c, 0x01, 0xaf, 0x01, 0x56, 0x01, 0xb8, 0x01,
+  0x60, 0x01, 0xc8, 0x01, 0x5d, 0x01, 0xce, 0x01, 0x03, 0x01, 0xd6, 0x01, 0xd4, 0x00, 0xdf, 0x01,
+  0x08, 0x01, 0xf3, 0x01, 0x02, 0x01, 0x04, 0x02, 0xdb, 0x00, 0x14, 0x02, 0x00, 0x01, 0x22, 0x02,
+  0xf6, 0x00, 0x2a, 0x02, 0xec, 0x00, 0x42, 0x02, 0xdf, 0x00, 0x69, 0x02, 0x1c, 0x01, 0x6e, 0x02,
+  0x0b, 0x01, 0x90, 0x02, 0xf1, 0x00, 0xbe, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x2a, 0x00,
+  0x35, 0x00, 0x3d, 0x00, 0xc2, 0x00, 0x41, 0x00, 0xb2, 0x00, 0x50, 0x00, 0x90, 0x00, 0x68, 0x00,
+  0xbf, 0x00, 0x79, 0x00, 0x5c, 0x00, 0x7f, 0x00, 0x65, 0x00, 0x8a, 0x00, 0xb9, 0x00, 0x93, 0x00,
+  0xaa, 0x00, 0x9f, 0x00, 0xc1, 0x00, 0xae, 0x00, 0x47, 0x00, 0xc8, 0x00, 0xbd, 0x00, 0xd2, 0x00,
+  0x93, 0x00, 0xd6, 0x00, 0x6b, 0x00, 0xf1, 0x00, 0x4d, 0x00, 0x05, 0x01, 0xb4, 0x00, 0x27, 0x01,
+  0x27, 0x01, 0x32, 0x01, 0x43, 0x01, 0x61, 0x01, 0x4f, 0x01, 0x6d, 0x01, 0x3d, 0x01, 0x6f, 0x01,
+  0x36, 0x01, 0x7a, 0x01, 0x3b, 0x01, 0x8a, 0x01, 0x6d, 0x01, 0x9a, 0x01, 0x54, 0x01, 0xa0, 0x01,
+  0x4c, 0x01, 0xb1, 0x01, 0x56, 0x01, 0xb7, 0x01, 0x60, 0x01, 0xc9, 0x01, 0x5d, 0x01, 0xca, 0x01,
+  0x03, 0x01, 0xd5, 0x01, 0xd4, 0x00, 0xe1, 0x01, 0x08, 0x01, 0xf3, 0x01, 0x02, 0x01, 0x03, 0x02,
+  0xdb, 0x00, 0x14, 0x02, 0x00, 0x01, 0x21, 0x02, 0xeb, 0x00, 0x28, 0x02, 0xf6, 0x00, 0x29, 0x02,
+  0xec, 0x00, 0x42, 0x02, 0xdf, 0x00, 0x68, 0x02, 0x1c, 0x01, 0x6f, 0x02, 0x0b, 0x01, 0x91, 0x02,
+  0xf1, 0x00, 0xbe, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x2a, 0x00, 0x35, 0x00, 0x3d, 0x00,
+  0xc2, 0x00, 0x40, 0x00, 0xb2, 0x00, 0x4e, 0x00, 0x90, 0x00, 0x66, 0x00, 0xbf, 0x00, 0x79, 0x00,
+  0x5c, 0x00, 0x83, 0x00, 0x65, 0x00, 0x89, 0x00, 0xb9, 0x00, 0x93, 0x00, 0xaa, 0x00, 0x9f, 0x00,
+  0xc1, 0x00, 0xad, 0x00, 0x47, 0x00, 0xc7, 0x00, 0xbd, 0x00, 0xd3, 0x00, 0x93, 0x00, 0xdc, 0x00,
+  0x6b, 0x00, 0xef, 0x00, 0x4d, 0x00, 0x02, 0x01, 0xb4, 0x00, 0x28, 0x01, 0x27, 0x01, 0x30, 0x01,
+  0x43, 0x01, 0x5f, 0x01, 0x45, 0x01, 0x62, 0x01, 0x4f, 0x01, 0x6c, 0x01, 0x3d, 0x01, 0x76, 0x01,
+  0x50, 0x01, 0x7b, 0x01, 0x3b, 0x01, 0x83, 0x01, 0x5a, 0x01, 0x8b, 0x01, 0x6d, 0x01, 0x9b, 0x01,
+  0x54, 0x01, 0x9d, 0x01, 0x4c, 0x01, 0xb3, 0x01, 0x56, 0x01, 0xb5, 0x01, 0x6c, 0x01, 0xb8, 0x01,
+  0x60, 0x01, 0xc9, 0x01, 0x03, 0x01, 0xd5, 0x01, 0xd4, 0x00, 0xe2, 0x01, 0x08, 0x01, 0xf4, 0x01,
+  0x02, 0x01, 0x03, 0x02, 0xdb, 0x00, 0x14, 0x02, 0x00, 0x01, 0x1d, 0x02, 0xeb, 0x00, 0x2a, 0x02,
+  0xec, 0x00, 0x42, 0x02, 0xdf, 0x00, 0x67, 0x02, 0x1c, 0x01, 0x70, 0x02, 0x0b, 0x01, 0x92, 0x02,
+  0xf1, 0x00, 0xbe, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x3d, 0x00,
+  0xc2, 0x00, 0x3e, 0x00, 0xb2, 0x00, 0x4d, 0x00, 0x90, 0x00, 0x64, 0x00, 0xbf, 0x00, 0x79, 0x00,
+  0x5c, 0x00, 0x86, 0x00, 0x65, 0x00, 0x87, 0x00, 0xb9, 0x00, 0x93, 0x00, 0xaa, 0x00, 0x9e, 0x00,
+  0xc1, 0x00, 0xad, 0x00, 0x47, 0x00, 0xc6, 0x00, 0xbd, 0x00, 0xd3, 0x00, 0x93, 0x00, 0xe2, 0x00,
+  0x6b, 0x00, 0xee, 0x00, 0x4d, 0x00, 0x00, 0x01, 0xb4, 0x00, 0x28, 0x01, 0x21, 0x01, 0x32, 0x01,
+  0x43, 0x01, 0x5c, 0x01, 0x45, 0x01, 0x64, 0x01, 0x4f, 0x01, 0x6c, 0x01, 0x3d, 0x01, 0x74, 0x01,
+  0x50, 0x01, 0x7c, 0x01, 0x3b, 0x01, 0x7e, 0x01, 0x5a, 0x01, 0x8c, 0x01, 0x6d, 0x01, 0x9b, 0x01,
+  0x4c, 0x01, 0xb4, 0x01, 0x6c, 0x01, 0xbd, 0x01, 0x60, 0x01, 0xc9, 0x01, 0x03, 0x01, 0xd5, 0x01,
+  0xd4, 0x00, 0xe3, 0x01, 0x08, 0x01, 0xf4, 0x01, 0x02, 0x01, 0x02, 0x02, 0xdb, 0x00, 0x15, 0x02,
+  0x00, 0x01, 0x1a, 0x02, 0xeb, 0x00, 0x2b, 0x02, 0xec, 0x00, 0x41, 0x02, 0x18, 0x01, 0x42, 0x02,
+  0xdf, 0x00, 0x65, 0x02, 0x1c, 0x01, 0x71, 0x02, 0x0b, 0x01, 0x93, 0x02, 0xf1, 0x00, 0xbe, 0x02,
+  0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x2c, 0x00, 0x35, 0x00, 0x3c, 0x00, 0xc2, 0x00, 0x3d, 0x00,
+  0xb2, 0x00, 0x4c, 0x00, 0x90, 0x00, 0x63, 0x00, 0xbf, 0x00, 0x79, 0x00, 0x5c, 0x00, 0x87, 0x00,
+  0xb9, 0x00, 0x94, 0x00, 0xaa, 0x00, 0x9e, 0x00, 0xc1, 0x00, 0xac, 0x00, 0x47, 0x00, 0xc4, 0x00,
+  0x8e, 0x00, 0xc6, 0x00, 0xbd, 0x00, 0xd4, 0x00, 0x93, 0x00, 0xe6, 0x00, 0x6b, 0x00, 0xec, 0x00,
+  0x4d, 0x00, 0xfe, 0x00, 0xb4, 0x00, 0x27, 0x01, 0x21, 0x01, 0x34, 0x01, 0x43, 0x01, 0x59, 0x01,
+  0x45, 0x01, 0x66, 0x01, 0x4f, 0x01, 0x6b, 0x01, 0x58, 0x01, 0x6d, 0x01, 0x3d, 0x01, 0x73, 0x01,
+  0x50, 0x01, 0x7c, 0x01, 0x5a, 0x01, 0x8c, 0x01, 0x3c, 0x01, 0x8e, 0x01, 0x6d, 0x01, 0x9b, 0x01,
+  0x4c, 0x01, 0xb3, 0x01, 0x6c, 0x01, 0xc2, 0x01, 0x60, 0x01, 0xc9, 0x01, 0x03, 0x01, 0xd4, 0x01,
+  0xd4, 0x00, 0xe4, 0x01, 0x08, 0x01, 0xf5, 0x01, 0x02, 0x01, 0x02, 0x02, 0xdb, 0x00, 0x15, 0x02,
+  0x00, 0x01, 0x17, 0x02, 0xeb, 0x00, 0x2c, 0x02, 0xec, 0x00, 0x3d, 0x02, 0x18, 0x01, 0x43, 0x02,
+  0xdf, 0x00, 0x64, 0x02, 0x1c, 0x01, 0x72, 0x02, 0x0b, 0x01, 0x94, 0x02, 0xf1, 0x00, 0xbe, 0x02,
+  0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x2d, 0x00, 0x35, 0x00, 0x3c, 0x00, 0xb2, 0x00, 0x4b, 0x00,
+  0x90, 0x00, 0x61, 0x00, 0xbf, 0x00, 0x78, 0x00, 0x5c, 0x00, 0x88, 0x00, 0xb9, 0x00, 0x94, 0x00,
+  0xaa, 0x00, 0x9e, 0x00, 0xc1, 0x00, 0xac, 0x00, 0x47, 0x00, 0xc1, 0x00, 0x8e, 0x00, 0xc5, 0x00,
+  0xbd, 0x00, 0xd4, 0x00, 0x93, 0x00, 0xea, 0x00, 0x6b, 0x00, 0xeb, 0x00, 0x4d, 0x00, 0xfb, 0x00,
+  0xb4, 0x00, 0x26, 0x01, 0x21, 0x01, 0x36, 0x01, 0x43, 0x01, 0x57, 0x01, 0x45, 0x01, 0x65, 0x01,
+  0x49, 0x01, 0x68, 0x01, 0x58, 0x01, 0x6f, 0x01, 0x3d, 0x01, 0x71, 0x01, 0x50, 0x01, 0x7b, 0x01,
+  0x40, 0x01, 0x7d, 0x01, 0x5a, 0x01, 0x8a, 0x01, 0x3c, 0x01, 0x8f, 0x01, 0x3f, 0x01, 0x91, 0x01,
+  0x6d, 0x01, 0x9a, 0x01, 0x4c, 0x01, 0xb3, 0x01, 0x6c, 0x01, 0xc6, 0x01, 0x60, 0x01, 0xc9, 0x01,
+  0x03, 0x01, 0xd4, 0x01, 0xd4, 0x00, 0xe5, 0x01, 0x08, 0x01, 0xf5, 0x01, 0x02, 0x01, 0x02, 0x02,
+  0xdb, 0x00, 0x15, 0x02, 0xeb, 0x00, 0x2c, 0x02, 0xec, 0x00, 0x39, 0x02, 0x18, 0x01, 0x45, 0x02,
+  0xdf, 0x00, 0x63, 0x02, 0x1c, 0x01, 0x73, 0x02, 0x0b, 0x01, 0x95, 0x02, 0xf1, 0x00, 0xbe, 0x02,
+  0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x3b, 0x00, 0xb2, 0x00, 0x4a, 0x00,
+  0x90, 0x00, 0x60, 0x00, 0xbf, 0x00, 0x78, 0x00, 0x5c, 0x00, 0x88, 0x00, 0xb9, 0x00, 0x94, 0x00,
+  0xaa, 0x00, 0x9c, 0x00, 0x9b, 0x00, 0x9f, 0x00, 0xc1, 0x00, 0xab, 0x00, 0x47, 0x00, 0xbf, 0x00,
+  0x8e, 0x00, 0xc5, 0x00, 0xbd, 0x00, 0xd4, 0x00, 0x93, 0x00, 0xeb, 0x00, 0x6a, 0x00, 0xef, 0x00,
+  0x4d, 0x00, 0xf7, 0x00, 0x92, 0x00, 0xfa, 0x00, 0xb4, 0x00, 0x25, 0x01, 0x21, 0x01, 0x39, 0x01,
+  0x43, 0x01, 0x55, 0x01, 0x45, 0x01, 0x63, 0x01, 0x49, 0x01, 0x68, 0x01, 0x58, 0x01, 0x70, 0x01,
+  0x50, 0x01, 0x79, 0x01, 0x40, 0x01, 0x7e, 0x01, 0x5a, 0x01, 0x87, 0x01, 0x6a, 0x01, 0x8a, 0x01,
+  0x3c, 0x01, 0x8e, 0x01, 0x3f, 0x01, 0x97, 0x01, 0x6d, 0x01, 0x99, 0x01, 0x41, 0x01, 0x9e, 0x01,
+  0x4c, 0x01, 0xb3, 0x01, 0x6c, 0x01, 0xc9, 0x01, 0x03, 0x01, 0xd2, 0x01, 0xd6, 0x00, 0xd3, 0x01,
+  0xd4, 0x00, 0xe6, 0x01, 0x08, 0x01, 0xef, 0x01, 0x09, 0x01, 0xf6, 0x01, 0x02, 0x01, 0x01, 0x02,
+  0xd0, 0x00, 0x02, 0x02, 0xdb, 0x00, 0x13, 0x02, 0xeb, 0x00, 0x2d, 0x02, 0xec, 0x00, 0x35, 0x02,
+  0x18, 0x01, 0x46, 0x02, 0xdf, 0x00, 0x62, 0x02, 0x1c, 0x01, 0x74, 0x02, 0x0b, 0x01, 0x96, 0x02,
+  0xf1, 0x00, 0xbd, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x2f, 0x00, 0x35, 0x00, 0x3b, 0x00,
+  0xb2, 0x00, 0x48, 0x00, 0x90, 0x00, 0x5e, 0x00, 0xbf, 0x00, 0x78, 0x00, 0x5c, 0x00, 0x88, 0x00,
+  0xb9, 0x00, 0x94, 0x00, 0xaa, 0x00, 0x99, 0x00, 0x9b, 0x00, 0x9f, 0x00, 0x9c, 0x00, 0xa1, 0x00,
+  0xc1, 0x00, 0xab, 0x00, 0x47, 0x00, 0xbc, 0x00, 0x8e, 0x00, 0xc4, 0x00, 0xbd, 0x00, 0xd5, 0x00,
+  0x93, 0x00, 0xeb, 0x00, 0x6a, 0x00, 0xf1, 0x00, 0x92, 0x00, 0xfa, 0x00, 0xb4, 0x00, 0x24, 0x01,
+  0x21, 0x01, 0x3b, 0x01, 0x43, 0x01, 0x53, 0x01, 0x45, 0x01, 0x62, 0x01, 0x49, 0x01, 0x68, 0x01,
+  0x58, 0x01, 0x71, 0x01, 0x50, 0x01, 0x77, 0x01, 0x40, 0x01, 0x7e, 0x01, 0x68, 0x01, 0x80, 0x01,
+  0x5a, 0x01, 0x85, 0x01, 0x6a, 0x01, 0x8a, 0x01, 0x3c, 0x01, 0x8e, 0x01, 0x3f, 0x01, 0x98, 0x01,
+  0x41, 0x01, 0xa3, 0x01, 0x4c, 0x01, 0xb0, 0x01, 0x61, 0x01, 0xb3, 0x01, 0x6c, 0x01, 0xc8, 0x01,
+  0x38, 0x01, 0xca, 0x01, 0xd6, 0x00, 0xd5, 0x01, 0xd4, 0x00, 0xe6, 0x01, 0x09, 0x01, 0xf8, 0x01,
+  0xdd, 0x00, 0xfc, 0x01, 0xd0, 0x00, 0x05, 0x02, 0xdb, 0x00, 0x11, 0x02, 0xeb, 0x00, 0x2e, 0x02,
+  0xec, 0x00, 0x31, 0x02, 0x18, 0x01, 0x48, 0x02, 0xdf, 0x00, 0x61, 0x02, 0x1c, 0x01, 0x75, 0x02,
+  0x0b, 0x01, 0x97, 0x02, 0xf1, 0x00, 0xbd, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x2f, 0x00,
+  0x35, 0x00, 0x3a, 0x00, 0xb2, 0x00, 0x47, 0x00, 0x90, 0x00, 0x5d, 0x00, 0xbf, 0x00, 0x78, 0x00,
+  0x5c, 0x00, 0x89, 0x00, 0xb9, 0x00, 0x94, 0x00, 0xaa, 0x00, 0x97, 0x00, 0x9b, 0x00, 0x9e, 0x00,
+  0x9c, 0x00, 0xa2, 0x00, 0xc1, 0x00, 0xaa, 0x00, 0x47, 0x00, 0xba, 0x00, 0x8e, 0x00, 0xc4, 0x00,
+  0xbd, 0x00, 0xd5, 0x00, 0x93, 0x00, 0xeb, 0x00, 0x6a, 0x00, 0xf2, 0x00, 0x92, 0x00, 0xfa, 0x00,
+  0xb4, 0x00, 0x23, 0x01, 0x21, 0x01, 0x3d, 0x01, 0x43, 0x01, 0x51, 0x01, 0x45, 0x01, 0x60, 0x01,
+  0x49, 0x01, 0x68, 0x01, 0x58, 0x01, 0x71, 0x01, 0x50, 0x01, 0x75, 0x01, 0x40, 0x01, 0x7d, 0x01,
+  0x68, 0x01, 0x81, 0x01, 0x5a, 0x01, 0x83, 0x01, 0x6a, 0x01, 0x89, 0x01, 0x3c, 0x01, 0x8d, 0x01,
+  0x3f, 0x01, 0x98, 0x01, 0x41, 0x01, 0xa7, 0x01, 0x4c, 0x01, 0xad, 0x01, 0x61, 0x01, 0xb4, 0x01,
+  0x6c, 0x01, 0xc7, 0x01, 0x38, 0x01, 0xcb, 0x01, 0xd6, 0x00, 0xd6, 0x01, 0xd4, 0x00, 0xe5, 0x01,
+  0x09, 0x01, 0xf8, 0x01, 0xdd, 0x00, 0xfc, 0x01, 0xd0, 0x00, 0x09, 0x02, 0xdb, 0x00, 0x10, 0x02,
+  0xeb, 0x00, 0x2f, 0x02, 0x18, 0x01, 0x49, 0x02, 0xdf, 0x00, 0x60, 0x02, 0x1c, 0x01, 0x76, 0x02,
+  0x0b, 0x01, 0x98, 0x02, 0xf1, 0x00, 0xbd, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x30, 0x00,
+  0x35, 0x00, 0x39, 0x00, 0xb2, 0x00, 0x46, 0x00, 0x90, 0x00, 0x5b, 0x00, 0xbf, 0x00, 0x78, 0x00,
+  0x5c, 0x00, 0x89, 0x00, 0xb9, 0x00, 0x94, 0x00, 0x9b, 0x00, 0x9e, 0x00, 0x9c, 0x00, 0xa4, 0x00,
+  0xc1, 0x00, 0xaa, 0x00, 0x47, 0x00, 0xb8, 0x00, 0x8e, 0x00, 0xc4, 0x00, 0xbd, 0x00, 0xd6, 0x00,
+  0x93, 0x00, 0xeb, 0x00, 0x6a, 0x00, 0xf3, 0x00, 0x92, 0x00, 0xfb, 0x00, 0xb4, 0x00, 0x22, 0x01,
+  0x21, 0x01, 0x3f, 0x01, 0x43, 0x01, 0x4f, 0x01, 0x45, 0x01, 0x5f, 0x01, 0x49, 0x01, 0x68, 0x01,
+  0x58, 0x01, 0x72, 0x01, 0x50, 0x01, 0x74, 0x01, 0x6f, 0x01, 0x77, 0x01, 0x40, 0x01, 0x7b, 0x01,
+  0x68, 0x01, 0x81, 0x01, 0x4e, 0x01, 0x84, 0x01, 0x6a, 0x01, 0x89, 0x01, 0x3c, 0x01, 0x8c, 0x01,
+  0x3f, 0x01, 0x98, 0x01, 0x41, 0x01, 0xaa, 0x01, 0x61, 0x01, 0xb5, 0x01, 0x6c, 0x01, 0xc5, 0x01,
+  0x38, 0x01, 0xcb, 0x01, 0xd6, 0x00, 0xd8, 0x01, 0xd4, 0x00, 0xe3, 0x01, 0x09, 0x01, 0xf7, 0x01,
+  0xdd, 0x00, 0xfd, 0x01, 0xd0, 0x00, 0x0c, 0x02, 0x19, 0x01, 0x13, 0x02, 0xeb, 0x00, 0x2f, 0x02,
+  0x18, 0x01, 0x4b, 0x02, 0xdf, 0x00, 0x5e, 0x02, 0x1c, 0x01, 0x76, 0x02, 0x0b, 0x01, 0x99, 0x02,
+  0xf1, 0x00, 0xbd, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x31, 0x00, 0x35, 0x00, 0x39, 0x00,
+  0xb2, 0x00, 0x45, 0x00, 0x90, 0x00, 0x5a, 0x00, 0xbf, 0x00, 0x78, 0x00, 0x5c, 0x00, 0x89, 0x00,
+  0xb9, 0x00, 0x93, 0x00, 0x9b, 0x00, 0x9d, 0x00, 0x9c, 0x00, 0xa5, 0x00, 0xc1, 0x00, 0xa9, 0x00,
+  0x47, 0x00, 0xb6, 0x00, 0x8e, 0x00, 0xc3, 0x00, 0xbd, 0x00, 0xd6, 0x00, 0x93, 0x00, 0xeb, 0x00,
+  0x6a, 0x00, 0xf3, 0x00, 0x92, 0x00, 0xfb, 0x00, 0xb4, 0x00, 0x22, 0x01, 0x21, 0x01, 0x41, 0x01,
+  0x43, 0x01, 0x4d, 0x01, 0x45, 0x01, 0x5e, 0x01, 0x49, 0x01, 0x68, 0x01, 0x58, 0x01, 0x72, 0x01,
+  0x6f, 0x01, 0x7a, 0x01, 0x68, 0x01, 0x81, 0x01, 0x4e, 0x01, 0x86, 0x01, 0x6a, 0x01, 0x89, 0x01,
+  0x3c, 0x01, 0x8b, 0x01, 0x3f, 0x01, 0x98, 0x01, 0x3e, 0x01, 0x99, 0x01, 0x41, 0x01, 0xa9, 0x01,
+  0x61, 0x01, 0xb6, 0x01, 0x6c, 0x01, 0xc4, 0x01, 0x38, 0x01, 0xcc, 0x01, 0xd6, 0x00, 0xd9, 0x01,
+  0xd4, 0x00, 0xe2, 0x01, 0x09, 0x01, 0xf7, 0x01, 0xdd, 0x00, 0xfd, 0x01, 0xd0, 0x00, 0x0c, 0x02,
+  0x19, 0x01, 0x15, 0x02, 0xeb, 0x00, 0x2f, 0x02, 0x18, 0x01, 0x4c, 0x02, 0xdf, 0x00, 0x5d, 0x02,
+  0x1c, 0x01, 0x77, 0x02, 0x0b, 0x01, 0x9a, 0x02, 0xf1, 0x00, 0xbd, 0x02, 0x34, 0x00, 0xd0, 0x02,
+  0x34, 0x00, 0x31, 0x00, 0x35, 0x00, 0x38, 0x00, 0xb2, 0x00, 0x44, 0x00, 0x90, 0x00, 0x59, 0x00,
+  0xbf, 0x00, 0x78, 0x00, 0x5c, 0x00, 0x89, 0x00, 0xb9, 0x00, 0x92, 0x00, 0x9b, 0x00, 0x9b, 0x00,
+  0x9d, 0x00, 0xa0, 0x00, 0x9c, 0x00, 0xa7, 0x00, 0xc1, 0x00, 0xa9, 0x00, 0x47, 0x00, 0xb4, 0x00,
+  0x8e, 0x00, 0xc3, 0x00, 0xbd, 0x00, 0xd6, 0x00, 0x93, 0x00, 0xeb, 0x00, 0x6a, 0x00, 0xf4, 0x00,
+  0x92, 0x00, 0xfb, 0x00, 0xb4, 0x00, 0x21, 0x01, 0x21, 0x01, 0x42, 0x01, 0x43, 0x01, 0x4b, 0x01,
+  0x45, 0x01, 0x5c, 0x01, 0x49, 0x01, 0x68, 0x01, 0x58, 0x01, 0x71, 0x01, 0x6f, 0x01, 0x7a, 0x01,
+  0x68, 0x01, 0x80, 0x01, 0x4e, 0x01, 0x87, 0x01, 0x6e, 0x01, 0x8b, 0x01, 0x3f, 0x01, 0x94, 0x01,
+  0x3a, 0x01, 0x97, 0x01, 0x3e, 0x01, 0x9b, 0x01, 0x41, 0x01, 0xa8, 0x01, 0x61, 0x01, 0xb6, 0x01,
+  0x6c, 0x01, 0xc2, 0x01, 0x38, 0x01, 0xcc, 0x01, 0xd6, 0x00, 0xda, 0x01, 0xd4, 0x00, 0xe1, 0x01,
+  0x09, 0x01, 0xf7, 0x01, 0xdd, 0x00, 0xfd, 0x01, 0xd0, 0x00, 0x0c, 0x02, 0x19, 0x01, 0x17, 0x02,
+  0xeb, 0x00, 0x2f, 0x02, 0x18, 0x01, 0x4d, 0x02, 0xdf, 0x00, 0x5c, 0x02, 0x1c, 0x01, 0x78, 0x02,
+  0x0b, 0x01, 0x9a, 0x02, 0xf1, 0x00, 0xbd, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x32, 0x00,
+  0x35, 0x00, 0x38, 0x00, 0xb2, 0x00, 0x43, 0x00, 0x90, 0x00, 0x57, 0x00, 0xbf, 0x00, 0x78, 0x00,
+  0x5c, 0x00, 0x7a, 0x00, 0x50, 0x00, 0x8a, 0x00, 0xb9, 0x00, 0x91, 0x00, 0x9b, 0x00, 0x99, 0x00,
+  0x9d, 0x00, 0xa4, 0x00, 0x9c, 0x00, 0xa8, 0x00, 0x47, 0x00, 0xb2, 0x00, 0x8e, 0x00, 0xc2, 0x00,
+  0xbd, 0x00, 0xd7, 0x00, 0x93, 0x00, 0xeb, 0x00, 0x6a, 0x00, 0xf4, 0x00, 0x92, 0x00, 0xfc, 0x00,
+  0xb4, 0x00, 0x20, 0x01, 0x21, 0x01, 0x43, 0x01, 0x4d, 0x01, 0x4c, 0x01, 0x45, 0x01, 0x5b, 0x01,
+  0x49, 0x01, 0x67, 0x01, 0x58, 0x01, 0x71, 0x01, 0x6f, 0x01, 0x79, 0x01, 0x68, 0x01, 0x80, 0x01,
+  0x4e, 0x01, 0x87, 0x01, 0x6e, 0x01, 0x8c, 0x01, 0x3f, 0x01, 0x90, 0x01, 0x3a, 0x01, 0x97, 0x01,
+  0x3e, 0x01, 0x9d, 0x01, 0x41, 0x01, 0xa7, 0x01, 0x61, 0x01, 0xb7, 0x01, 0x6c, 0x01, 0xc1, 0x01,
+  0x38, 0x01, 0xcc, 0x01, 0xd6, 0x00, 0xdb, 0x01, 0xd4, 0x00, 0xdf, 0x01, 0x09, 0x01, 0xf6, 0x01,
+  0xdd, 0x00, 0xfe, 0x01, 0xd0, 0x00, 0x0c, 0x02, 0x19, 0x01, 0x1a, 0x02, 0xeb, 0x00, 0x2e, 0x02,
+  0x18, 0x01, 0x4e, 0x02, 0xdf, 0x00, 0x5b, 0x02, 0x06, 0x01, 0x5c, 0x02, 0x1c, 0x01, 0x79, 0x02,
+  0x0b, 0x01, 0x9b, 0x02, 0xf1, 0x00, 0xbd, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x33, 0x00,
+  0x35, 0x00, 0x37, 0x00, 0xb2, 0x00, 0x42, 0x00, 0x90, 0x00, 0x56, 0x00, 0xbf, 0x00, 0x77, 0x00,
+  0x50, 0x00, 0x8c, 0x00, 0xb9, 0x00, 0x90, 0x00, 0x9b, 0x00, 0x97, 0x00, 0x9d, 0x00, 0xa8, 0x00,
+  0x9c, 0x00, 0xa9, 0x00, 0x47, 0x00, 0xb0, 0x00, 0x8e, 0x00, 0xc2, 0x00, 0xbd, 0x00, 0xd6, 0x00,
+  0x98, 0x00, 0xd8, 0x00, 0x93, 0x00, 0xea, 0x00, 0x72, 0x00, 0xec, 0x00, 0x6a, 0x00, 0xf5, 0x00,
+  0x92, 0x00, 0xfc, 0x00, 0xb4, 0x00, 0x1f, 0x01, 0x21, 0x01, 0x44, 0x01, 0x4d, 0x01, 0x50, 0x01,
+  0x45, 0x01, 0x5a, 0x01, 0x49, 0x01, 0x67, 0x01, 0x37, 0x01, 0x69, 0x01, 0x58, 0x01, 0x70, 0x01,
+  0x55, 0x01, 0x75, 0x01, 0x6f, 0x01, 0x79, 0x01, 0x68, 0x01, 0x7f, 0x01, 0x5e, 0x01, 0x80, 0x01,
+  0x4e, 0x01, 0x86, 0x01, 0x6e, 0x01, 0x8d, 0x01, 0x3a, 0x01, 0x97, 0x01, 0x3e, 0x01, 0x9f, 0x01,
+  0x41, 0x01, 0xa7, 0x01, 0x61, 0x01, 0xb8, 0x01, 0x6c, 0x01, 0xc0, 0x01, 0x38, 0x01, 0xcb, 0x01,
+  0xd3, 0x00, 0xcf, 0x01, 0xd6, 0x00, 0xdd, 0x01, 0xd4, 0x00, 0xde, 0x01, 0x09, 0x01, 0xf6, 0x01,
+  0xdd, 0x00, 0xfe, 0x01, 0xd0, 0x00, 0x0c, 0x02, 0x19, 0x01, 0x1c, 0x02, 0xeb, 0x00, 0x2e, 0x02,
+  0x18, 0x01, 0x50, 0x02, 0xdf, 0x00, 0x59, 0x02, 0x06, 0x01, 0x5d, 0x02, 0x1c, 0x01, 0x79, 0x02,
+  0x0b, 0x01, 0x9c, 0x02, 0xf1, 0x00, 0xbd, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x34, 0x00,
+  0x35, 0x00, 0x37, 0x00, 0xb2, 0x00, 0x41, 0x00, 0x90, 0x00, 0x55, 0x00, 0xbf, 0x00, 0x75, 0x00,
+  0x50, 0x00, 0x8d, 0x00, 0xb9, 0x00, 0x8f, 0x00, 0x9b, 0x00, 0x95, 0x00, 0x9d, 0x00, 0xa9, 0x00,
+  0x47, 0x00, 0xaf, 0x00, 0x8e, 0x00, 0xc1, 0x00, 0x63, 0x00, 0xc2, 0x00, 0xbd, 0x00, 0xd5, 0x00,
+  0x98, 0x00, 0xd9, 0x00, 0x93, 0x00, 0xe7, 0x00, 0x72, 0x00, 0xed, 0x00, 0x6a, 0x00, 0xf5, 0x00,
+  0x92, 0x00, 0xfc, 0x00, 0xb4, 0x00, 0x1e, 0x01, 0x21, 0x01, 0x44, 0x01, 0x4d, 0x01, 0x54, 0x01,
+  0x45, 0x01, 0x59, 0x01, 0x49, 0x01, 0x63, 0x01, 0x37, 0x01, 0x6f, 0x01, 0x55, 0x01, 0x7a, 0x01,
+  0x68, 0x01, 0x7d, 0x01, 0x5e, 0x01, 0x82, 0x01, 0x4e, 0x01, 0x86, 0x01, 0x6e, 0x01, 0x8c, 0x01,
+  0x5f, 0x01, 0x8d, 0x01, 0x3a, 0x01, 0x97, 0x01, 0x3e, 0x01, 0xa1, 0x01, 0x41, 0x01, 0xa6, 0x01,
+  0x61, 0x01, 0xb9, 0x01, 0x6c, 0x01, 0xbe, 0x01, 0x38, 0x01, 0xca, 0x01, 0xd3, 0x00, 0xd2, 0x01,
+  0xd6, 0x00, 0xdd, 0x01, 0x09, 0x01, 0xf5, 0x01, 0xdd, 0x00, 0xfe, 0x01, 0xd0, 0x00, 0x0c, 0x02,
+  0x19, 0x01, 0x1e, 0x02, 0xeb, 0x00, 0x2e, 0x02, 0x18, 0x01, 0x51, 0x02, 0xdf, 0x00, 0x57, 0x02,
+  0x06, 0x01, 0x5f, 0x02, 0x1c, 0x01, 0x7a, 0x02, 0x0b, 0x01, 0x9d, 0x02, 0xf1, 0x00, 0xbd, 0x02,
+  0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0xb2, 0x00, 0x40, 0x00,
+  0x90, 0x00, 0x54, 0x00, 0xbf, 0x00, 0x73, 0x00, 0x50, 0x00, 0x8e, 0x00, 0x9b, 0x00, 0x92, 0x00,
+  0x9d, 0x00, 0xa9, 0x00, 0x47, 0x00, 0xad, 0x00, 0x8e, 0x00, 0xc0, 0x00, 0x63, 0x00, 0xc3, 0x00,
+  0xbd, 0x00, 0xd4, 0x00, 0x98, 0x00, 0xda, 0x00, 0x93, 0x00, 0xe5, 0x00, 0x72, 0x00, 0xee, 0x00,
+  0x6a, 0x00, 0xf6, 0x00, 0x92, 0x00, 0xfc, 0x00, 0xb4, 0x00, 0x1e, 0x01, 0x21, 0x01, 0x44, 0x01,
+  0x4d, 0x01, 0x55, 0x01, 0x51, 0x01, 0x61, 0x01, 0x37, 0x01, 0x70, 0x01, 0x55, 0x01, 0x7c, 0x01,
+  0x5e, 0x01, 0x84, 0x01, 0x4e, 0x01, 0x86, 0x01, 0x6e, 0x01, 0x8a, 0x01, 0x5f, 0x01, 0x8e, 0x01,
+  0x3a, 0x01, 0x97, 0x01, 0x3e, 0x01, 0xa3, 0x01, 0x41, 0x01, 0xa5, 0x01, 0x61, 0x01, 0xb9, 0x01,
+  0x13, 0x01, 0xc1, 0x01, 0x38, 0x01, 0xc8, 0x01, 0xd3, 0x00, 0xd5, 0x01, 0xd6, 0x00, 0xdd, 0x01,
+  0x09, 0x01, 0xf5, 0x01, 0xdd, 0x00, 0xff, 0x01, 0xd0, 0x00, 0x0c, 0x02, 0x19, 0x01, 0x20, 0x02,
+  0xeb, 0x00, 0x2e, 0x02, 0x18, 0x01, 0x52, 0x02, 0xdf, 0x00, 0x55, 0x02, 0x06, 0x01, 0x60, 0x02,
+  0x1c, 0x01, 0x7b, 0x02, 0x0b, 0x01, 0x9d, 0x02, 0xf1, 0x00, 0xbd, 0x02, 0x34, 0x00, 0xd0, 0x02,
+  0x34, 0x00, 0x35, 0x00, 0x35, 0x00, 0x36, 0x00, 0xb2, 0x00, 0x3f, 0x00, 0x90, 0x00, 0x52, 0x00,
+  0xbf, 0x00, 0x72, 0x00, 0x50, 0x00, 0x8e, 0x00, 0x62, 0x00, 0x92, 0x00, 0x9d, 0x00, 0xaa, 0x00,
+  0x47, 0x00, 0xab, 0x00, 0x8e, 0x00, 0xbf, 0x00, 0x63, 0x00, 0xc4, 0x00, 0xbd, 0x00, 0xd3, 0x00,
+  0x98, 0x00, 0xdb, 0x00, 0x93, 0x00, 0xe2, 0x00, 0x72, 0x00, 0xee, 0x00, 0x6a, 0x00, 0xf6, 0x00,
+  0x92, 0x00, 0xfd, 0x00, 0xb4, 0x00, 0x1d, 0x01, 0x21, 0x01, 0x44, 0x01, 0x4d, 0x01, 0x56, 0x01,
+  0x51, 0x01, 0x62, 0x01, 0x37, 0x01, 0x70, 0x01, 0x55, 0x01, 0x7c, 0x01, 0x5e, 0x01, 0x86, 0x01,
+  0x6e, 0x01, 0x89, 0x01, 0x5f, 0x01, 0x8f, 0x01, 0x3a, 0x01, 0x95, 0x01, 0x63, 0x01, 0x98, 0x01,
+  0x3e, 0x01, 0xa4, 0x01, 0x61, 0x01, 0xb8, 0x01, 0x13, 0x01, 0xc4, 0x01, 0x38, 0x01, 0xc6, 0x01,
+  0xd3, 0x00, 0xd7, 0x01, 0xd6, 0x00, 0xdc, 0x01, 0x09, 0x01, 0xf3, 0x01, 0x12, 0x01, 0xf5, 0x01,
+  0xdd, 0x00, 0xff, 0x01, 0xd0, 0x00, 0x0c, 0x02, 0x19, 0x01, 0x22, 0x02, 0xeb, 0x00, 0x2e, 0x02,
+  0x18, 0x01, 0x53, 0x02, 0x06, 0x01, 0x62, 0x02, 0x1c, 0x01, 0x7c, 0x02, 0x0b, 0x01, 0x9e, 0x02,
+  0xf1, 0x00, 0xbc, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x35, 0x00, 0xb2, 0x00, 0x3e, 0x00,
+  0x90, 0x00, 0x51, 0x00, 0xbf, 0x00, 0x70, 0x00, 0x50, 0x00, 0x8e, 0x00, 0x62, 0x00, 0x96, 0x00,
+  0x9d, 0x00, 0xaa, 0x00, 0x8e, 0x00, 0xbd, 0x00, 0x63, 0x00, 0xc5, 0x00, 0xbd, 0x00, 0xd2, 0x00,
+  0x98, 0x00, 0xdc, 0x00, 0x93, 0x00, 0xe0, 0x00, 0x72, 0x00, 0xef, 0x00, 0x6a, 0x00, 0xf6, 0x00,
+  0x92, 0x00, 0xfd, 0x00, 0xb4, 0x00, 0x1c, 0x01, 0x21, 0x01, 0x44, 0x01, 0x4d, 0x01, 0x56, 0x01,
+  0x51, 0x01, 0x62, 0x01, 0x37, 0x01, 0x70, 0x01, 0x55, 0x01, 0x7c, 0x01, 0x5e, 0x01, 0x87, 0x01,
+  0x5f, 0x01, 0x90, 0x01, 0x3a, 0x01, 0x94, 0x01, 0x63, 0x01, 0x99, 0x01, 0x3e, 0x01, 0xa4, 0x01,
+  0x48, 0x01, 0xa5, 0x01, 0x61, 0x01, 0xb8, 0x01, 0x13, 0x01, 0xc6, 0x01, 0xd3, 0x00, 0xda, 0x01,
+  0xd6, 0x00, 0xdc, 0x01, 0x09, 0x01, 0xf1, 0x01, 0x12, 0x01, 0xf6, 0x01, 0xdd, 0x00, 0xff, 0x01,
+  0xd0, 0x00, 0x0c, 0x02, 0x19, 0x01, 0x24, 0x02, 0xeb, 0x00, 0x2e, 0x02, 0x18, 0x01, 0x52, 0x02,
+  0x06, 0x01, 0x63, 0x02, 0x1c, 0x01, 0x7c, 0x02, 0x0b, 0x01, 0x9f, 0x02, 0xf1, 0x00, 0xbc, 0x02,
+  0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x36, 0x00, 0xb2, 0x00, 0x3e, 0x00, 0x90, 0x00, 0x50, 0x00,
+  0xbf, 0x00, 0x6f, 0x00, 0x50, 0x00, 0x8d, 0x00, 0x62, 0x00, 0x9a, 0x00, 0x9d, 0x00, 0xaa, 0x00,
+  0x57, 0x00, 0xbd, 0x00, 0x63, 0x00, 0xc5, 0x00, 0xbd, 0x00, 0xd1, 0x00, 0x98, 0x00, 0xdd, 0x00,
+  0x93, 0x00, 0xde, 0x00, 0x72, 0x00, 0xf0, 0x00, 0x6a, 0x00, 0xf7, 0x00, 0x92, 0x00, 0xfd, 0x00,
+  0xb4, 0x00, 0x1c, 0x01, 0x21, 0x01, 0x44, 0x01, 0x4d, 0x01, 0x57, 0x01, 0x51, 0x01, 0x63, 0x01,
+  0x37, 0x01, 0x71, 0x01, 0x55, 0x01, 0x7c, 0x01, 0x5e, 0x01, 0x87, 0x01, 0x5f, 0x01, 0x8e, 0x01,
+  0x59, 0x01, 0x92, 0x01, 0x62, 0x01, 0x93, 0x01, 0x63, 0x01, 0x9a, 0x01, 0x3e, 0x01, 0xa1, 0x01,
+  0x48, 0x01, 0xa6, 0x01, 0x61, 0x01, 0xb7, 0x01, 0x13, 0x01, 0xc7, 0x01, 0xd3, 0x00, 0xdb, 0x01,
+  0xd5, 0x00, 0xdd, 0x01, 0x09, 0x01, 0xef, 0x01, 0x12, 0x01, 0xf7, 0x01, 0xdd, 0x00, 0xff, 0x01,
+  0xd0, 0x00, 0x0d, 0x02, 0x19, 0x01, 0x26, 0x02, 0xeb, 0x00, 0x2e, 0x02, 0x18, 0x01, 0x51, 0x02,
+  0x06, 0x01, 0x64, 0x02, 0x1c, 0x01, 0x7d, 0x02, 0x0b, 0x01, 0xa0, 0x02, 0xf1, 0x00, 0xbc, 0x02,
+  0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x36, 0x00, 0xb2, 0x00, 0x3d, 0x00, 0x90, 0x00, 0x4f, 0x00,
+  0xbf, 0x00, 0x6d, 0x00, 0x50, 0x00, 0x8c, 0x00, 0x62, 0x00, 0x9d, 0x00, 0x9d, 0x00, 0xa9, 0x00,
+  0x57, 0x00, 0xbc, 0x00, 0x76, 0x00, 0xbd, 0x00, 0x63, 0x00, 0xc6, 0x00, 0xbd, 0x00, 0xd0, 0x00,
+  0x98, 0x00, 0xde, 0x00, 0x72, 0x00, 0xf1, 0x00, 0x6a, 0x00, 0xf7, 0x00, 0x92, 0x00, 0xfe, 0x00,
+  0xb4, 0x00, 0x1b, 0x01, 0x21, 0x01, 0x44, 0x01, 0x4d, 0x01, 0x58, 0x01, 0x51, 0x01, 0x64, 0x01,
+  0x37, 0x01, 0x71, 0x01, 0x55, 0x01, 0x7c, 0x01, 0x69, 0x01, 0x81, 0x01, 0x5c, 0x01, 0x87, 0x01,
+  0x5f, 0x01, 0x8b, 0x01, 0x59, 0x01, 0x91, 0x01, 0x62, 0x01, 0x94, 0x01, 0x63, 0x01, 0x9b, 0x01,
+  0x3e, 0x01, 0x9f, 0x01, 0x48, 0x01, 0xa8, 0x01, 0x61, 0x01, 0xb6, 0x01, 0x13, 0x01, 0xc8, 0x01,
+  0xd3, 0x00, 0xd9, 0x01, 0xd5, 0x00, 0xdf, 0x01, 0x09, 0x01, 0xee, 0x01, 0x12, 0x01, 0xf7, 0x01,
+  0xdd, 0x00, 0x00, 0x02, 0xd0, 0x00, 0x0d, 0x02, 0x19, 0x01, 0x27, 0x02, 0xeb, 0x00, 0x2e, 0x02,
+  0x18, 0x01, 0x50, 0x02, 0x06, 0x01, 0x66, 0x02, 0x1c, 0x01, 0x7e, 0x02, 0x0b, 0x01, 0xa0, 0x02,
+  0xf1, 0x00, 0xbc, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x36, 0x00, 0xb2, 0x00, 0x3c, 0x00,
+  0x90, 0x00, 0x4e, 0x00, 0xbf, 0x00, 0x6c, 0x00, 0x50, 0x00, 0x8c, 0x00, 0x62, 0x00, 0xa1, 0x00,
+  0x9d, 0x00, 0xa8, 0x00, 0x57, 0x00, 0xbb, 0x00, 0x76, 0x00, 0xbe, 0x00, 0x63, 0x00, 0xc7, 0x00,
+  0xbd, 0x00, 0xcf, 0x00, 0x98, 0x00, 0xdf, 0x00, 0x72, 0x00, 0xf2, 0x00, 0x6a, 0x00, 0xf8, 0x00,
+  0x92, 0x00, 0xfe, 0x00, 0xb4, 0x00, 0x1a, 0x01, 0x21, 0x01, 0x44, 0x01, 0x4d, 0x01, 0x58, 0x01,
+  0x51, 0x01, 0x65, 0x01, 0x37, 0x01, 0x72, 0x01, 0x55, 0x01, 0x7b, 0x01, 0x69, 0x01, 0x81, 0x01,
+  0x5c, 0x01, 0x88, 0x01, 0x59, 0x01, 0x91, 0x01, 0x62, 0x01, 0x95, 0x01, 0x63, 0x01, 0x9c, 0x01,
+  0x3e, 0x01, 0x9d, 0x01, 0x48, 0x01, 0xa9, 0x01, 0x61, 0x01, 0xb6, 0x01, 0x13, 0x01, 0xc8, 0x01,
+  0xd9, 0x00, 0xd2, 0x01, 0xd3, 0x00, 0xd8, 0x01, 0xd5, 0x00, 0xe1, 0x01, 0x09, 0x01, 0xec, 0x01,
+  0x12, 0x01, 0xf8, 0x01, 0xdd, 0x00, 0x00, 0x02, 0xd0, 0x00, 0x0d, 0x02, 0x19, 0x01, 0x29, 0x02,
+  0xeb, 0x00, 0x2e, 0x02, 0x18, 0x01, 0x4f, 0x02, 0x06, 0x01, 0x67, 0x02, 0x1c, 0x01, 0x7e, 0x02,
+  0x0b, 0x01, 0xa1, 0x02, 0xf1, 0x00, 0xbc, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x36, 0x00,
+  0xb2, 0x00, 0x3b, 0x00, 0x90, 0x00, 0x4d, 0x00, 0xbf, 0x00, 0x6b, 0x00, 0x50, 0x00, 0x8b, 0x00,
+  0x62, 0x00, 0xa4, 0x00, 0x9d, 0x00, 0xa8, 0x00, 0x57, 0x00, 0xba, 0x00, 0x76, 0x00, 0xbe, 0x00,
+  0x63, 0x00, 0xc7, 0x00, 0xbd, 0x00, 0xce, 0x00, 0x98, 0x00, 0xe0, 0x00, 0x72, 0x00, 0xf2, 0x00,
+  0x6a, 0x00, 0xf8, 0x00, 0x92, 0x00, 0xfe, 0x00, 0xb4, 0x00, 0x19, 0x01, 0x21, 0x01, 0x44, 0x01,
+  0x4d, 0x01, 0x59, 0x01, 0x51, 0x01, 0x65, 0x01, 0x37, 0x01, 0x72, 0x01, 0x55, 0x01, 0x7b, 0x01,
+  0x69, 0x01, 0x81, 0x01, 0x5c, 0x01, 0x88, 0x01, 0x59, 0x01, 0x8e, 0x01, 0x66, 0x01, 0x91, 0x01,
+  0x62, 0x01, 0x96, 0x01, 0x63, 0x01, 0x9c, 0x01, 0x48, 0x01, 0xaa, 0x01, 0x61, 0x01, 0xb5, 0x01,
+  0x13, 0x01, 0xc7, 0x01, 0xd9, 0x00, 0xd7, 0x01, 0xd5, 0x00, 0xe2, 0x01, 0x09, 0x01, 0xe6, 0x01,
+  0x0c, 0x01, 0xed, 0x01, 0x12, 0x01, 0xf8, 0x01, 0xdd, 0x00, 0x00, 0x02, 0xd0, 0x00, 0x0d, 0x02,
+  0x19, 0x01, 0x2b, 0x02, 0xeb, 0x00, 0x2e, 0x02, 0x18, 0x01, 0x4e, 0x02, 0x06, 0x01, 0x68, 0x02,
+  0x1c, 0x01, 0x7f, 0x02, 0x0b, 0x01, 0xa2, 0x02, 0xf1, 0x00, 0xbc, 0x02, 0x34, 0x00, 0xd0, 0x02,
+  0x34, 0x00, 0x37, 0x00, 0xb2, 0x00, 0x3a, 0x00, 0x90, 0x00, 0x4c, 0x00, 0xbf, 0x00, 0x69, 0x00,
+  0x50, 0x00, 0x8a, 0x00, 0x62, 0x00, 0xa7, 0x00, 0x57, 0x00, 0xb9, 0x00, 0x76, 0x00, 0xbe, 0x00,
+  0x7c, 0x00, 0xbf, 0x00, 0x63, 0x00, 0xc8, 0x00, 0xbd, 0x00, 0xcd, 0x00, 0x98, 0x00, 0xe0, 0x00,
+  0x72, 0x00, 0xf3, 0x00, 0x6a, 0x00, 0xf9, 0x00, 0x92, 0x00, 0xfe, 0x00, 0xb4, 0x00, 0x19, 0x01,
+  0x21, 0x01, 0x45, 0x01, 0x4d, 0x01, 0x59, 0x01, 0x51, 0x01, 0x66, 0x01, 0x37, 0x01, 0x72, 0x01,
+  0x55, 0x01, 0x7a, 0x01, 0x69, 0x01, 0x81, 0x01, 0x5c, 0x01, 0x88, 0x01, 0x59, 0x01, 0x8b, 0x01,
+  0x66, 0x01, 0x92, 0x01, 0x62, 0x01, 0x96, 0x01, 0x63, 0x01, 0x9c, 0x01, 0x48, 0x01, 0xac, 0x01,
+  0x61, 0x01, 0xb5, 0x01, 0x20, 0x01, 0xbc, 0x01, 0x13, 0x01, 0xc7, 0x01, 0xd9, 0x00, 0xd6, 0x01,
+  0xd5, 0x00, 0xe3, 0x01, 0x0c, 0x01, 0xee, 0x01, 0x12, 0x01, 0xf9, 0x01, 0xdd, 0x00, 0x01, 0x02,
+  0xd0, 0x00, 0x0d, 0x02, 0x19, 0x01, 0x2c, 0x02, 0xeb, 0x00, 0x2e, 0x02, 0x18, 0x01, 0x4d, 0x02,
+  0x06, 0x01, 0x69, 0x02, 0x1c, 0x01, 0x7e, 0x02, 0x16, 0x01, 0x83, 0x02, 0x0b, 0x01, 0xa2, 0x02,
+  0xf1, 0x00, 0xbc, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x37, 0x00, 0xb2, 0x00, 0x39, 0x00,
+  0x90, 0x00, 0x4b, 0x00, 0xbf, 0x00, 0x68, 0x00, 0x50, 0x00, 0x8a, 0x00, 0x62, 0x00, 0xa7, 0x00,
+  0x57, 0x00, 0xb8, 0x00, 0x7c, 0x00, 0xbf, 0x00, 0x75, 0x00, 0xc0, 0x00, 0x63, 0x00, 0xc8, 0x00,
+  0xbd, 0x00, 0xcc, 0x00, 0x98, 0x00, 0xe1, 0x00, 0x72, 0x00, 0xf4, 0x00, 0x6a, 0x00, 0xf9, 0x00,
+  0x92, 0x00, 0xff, 0x00, 0xb4, 0x00, 0x18, 0x01, 0x21, 0x01, 0x45, 0x01, 0x4d, 0x01, 0x5a, 0x01,
+  0x51, 0x01, 0x67, 0x01, 0x37, 0x01, 0x73, 0x01, 0x55, 0x01, 0x79, 0x01, 0x69, 0x01, 0x81, 0x01,
+  0x5c, 0x01, 0x88, 0x01, 0x66, 0x01, 0x93, 0x01, 0x62, 0x01, 0x97, 0x01, 0x63, 0x01, 0x9b, 0x01,
+  0x48, 0x01, 0xad, 0x01, 0x61, 0x01, 0xb4, 0x01, 0x20, 0x01, 0xc5, 0x01, 0x13, 0x01, 0xc6, 0x01,
+  0xd9, 0x00, 0xd6, 0x01, 0xd5, 0x00, 0xe4, 0x01, 0x0c, 0x01, 0xf0, 0x01, 0x12, 0x01, 0xf9, 0x01,
+  0xdd, 0x00, 0x01, 0x02, 0xd0, 0x00, 0x0d, 0x02, 0x19, 0x01, 0x2e, 0x02, 0x18, 0x01, 0x4d, 0x02,
+  0x06, 0x01, 0x6a, 0x02, 0x1c, 0x01, 0x7c, 0x02, 0x16, 0x01, 0x89, 0x02, 0x0b, 0x01, 0xa3, 0x02,
+  0xf1, 0x00, 0xbc, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x34, 0x00, 0x33, 0x00, 0x89, 0x01, 0x3a, 0x00,
+  0x90, 0x00, 0x4a, 0x00, 0xbf, 0x00, 0x67, 0x00, 0x50, 0x00, 0x89, 0x00, 0x62, 0x00, 0xa7, 0x00,
+  0x57, 0x00, 0xb7, 0x00, 0x7c, 0x00, 0xba, 0x00, 0x75, 0x00, 0xc0, 0x00, 0x7a, 0x00, 0xc2, 0x00,
+  0x63, 0x00, 0xc9, 0x00, 0xbd, 0x00, 0xcb, 0x00, 0x98, 0x00, 0xe1, 0x00, 0x72, 0x00, 0xf5, 0x00,
+  0x6a, 0x00, 0xf9, 0x00, 0x92, 0x00, 0xff, 0x00, 0xb4, 0x00, 0x18, 0x01, 0x21, 0x01, 0x45, 0x01,
+  0x4d, 0x01, 0x5a, 0x01, 0x51, 0x01, 0x67, 0x01, 0x37, 0x01, 0x73, 0x01, 0x55, 0x01, 0x79, 0x01,
+  0x69, 0x01, 0x81, 0x01, 0x5c, 0x01, 0x88, 0x01, 0x66, 0x01, 0x93, 0x01, 0x62, 0x01, 0x97, 0x01,
+  0x39, 0x01, 0x9b, 0x01, 0x48, 0x01, 0xae, 0x01, 0x61, 0x01, 0xb3, 0x01, 0x20, 0x01, 0xc6, 0x01,
+  0xd9, 0x00, 0xd5, 0x01, 0xd5, 0x00, 0xe4, 0x01, 0x0c, 0x01, 0xf1, 0x01, 0x12, 0x01, 0xfa, 0x01,
+  0xdd, 0x00, 0x01, 0x02, 0xd0, 0x00, 0x0d, 0x02, 0x19, 0x01, 0x2f, 0x02, 0x18, 0x01, 0x4c, 0x02,
+  0x06, 0x01, 0x6c, 0x02, 0x1c, 0x01, 0x7b, 0x02, 0x16, 0x01, 0x8e, 0x02, 0x0b, 0x01, 0xa4, 0x02,
+  0xf1, 0x00, 0xbc, 0x02, 0x34, 0x00, 0xd0, 0x02, 0x90, 0x01, 0x13, 0x00, 0x34, 0x00, 0x2f, 0x00,
+  0x89, 0x01, 0x3c, 0x00, 0x90, 0x00, 0x49, 0x00, 0xbf, 0x00, 0x66, 0x00, 0x50, 0x00, 0x89, 0x00,
+  0x62, 0x00, 0xa8, 0x00, 0x7b, 0x00, 0xb9, 0x00, 0x75, 0x00, 0xbe, 0x00, 0x7a, 0x00, 0xc5, 0x00,
+  0x63, 0x00, 0xca, 0x00, 0x98, 0x00, 0xe2, 0x00, 0x72, 0x00, 0xf5, 0x00, 0x6a, 0x00, 0xfa, 0x00,
+  0x92, 0x00, 0xff, 0x00, 0xb4, 0x00, 0x17, 0x01, 0x21, 0x01, 0x45, 0x01, 0x4d, 0x01, 0x5b, 0x01,
+  0x51, 0x01, 0x68, 0x01, 0x37, 0x01, 0x6e, 0x01, 0x03, 0x00, 0x75, 0x01, 0x55, 0x01, 0x76, 0x01,
+  0x32, 0x00, 0x7b, 0x01, 0x69, 0x01, 0x80, 0x01, 0x5c, 0x01, 0x88, 0x01, 0x66, 0x01, 0x94, 0x01,
+  0x39, 0x01, 0x9c, 0x01, 0x48, 0x01, 0xae, 0x01, 0xe6, 0x00, 0xb3, 0x01, 0x20, 0x01, 0xc6, 0x01,
+  0xd9, 0x00, 0xd5, 0x01, 0xd5, 0x00, 0xe4, 0x01, 0x0c, 0x01, 0xf1, 0x01, 0xe5, 0x00, 0xf6, 0x01,
+  0x12, 0x01, 0xfa, 0x01, 0xdd, 0x00, 0x01, 0x02, 0xd0, 0x00, 0x0d, 0x02, 0x19, 0x01, 0x2f, 0x02,
+  0x18, 0x01, 0x4b, 0x02, 0x06, 0x01, 0x6b, 0x02, 0x0d, 0x01, 0x6d, 0x02, 0x1c, 0x01, 0x79, 0x02,
+  0x16, 0x01, 0x93, 0x02, 0x0b, 0x01, 0xa4, 0x02, 0xf1, 0x00, 0xbc, 0x02, 0x34, 0x00, 0xc1, 0x02,
+  0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x1d, 0x00, 0x34, 0x00, 0x2b, 0x00, 0x89, 0x01, 0x3f, 0x00,
+  0x90, 0x00, 0x48, 0x00, 0xbf, 0x00, 0x62, 0x00, 0x86, 0x00, 0x76, 0x00, 0x50, 0x00, 0x88, 0x00,
+  0x62, 0x00, 0xa8, 0x00, 0x7b, 0x00, 0xba, 0x00, 0x75, 0x00, 0xbd, 0x00, 0x7a, 0x00, 0xc7, 0x00,
+  0x63, 0x00, 0xca, 0x00, 0x98, 0x00, 0xe3, 0x00, 0x72, 0x00, 0xf6, 0x00, 0x6a, 0x00, 0xfa, 0x00,
+  0x92, 0x00, 0xff, 0x00, 0xb4, 0x00, 0x16, 0x01, 0x21, 0x01, 0x45, 0x01, 0x4d, 0x01, 0x5b, 0x01,
+  0x51, 0x01, 0x69, 0x01, 0x03, 0x00, 0x75, 0x01, 0x32, 0x00, 0x7f, 0x01, 0x69, 0x01, 0x80, 0x01,
+  0x5c, 0x01, 0x87, 0x01, 0x52, 0x01, 0x88, 0x01, 0x66, 0x01, 0x92, 0x01, 0x39, 0x01, 0x9d, 0x01,
+  0x48, 0x01, 0xac, 0x01, 0xe6, 0x00, 0xb4, 0x01, 0x20, 0x01, 0xc6, 0x01, 0xd9, 0x00, 0xd4, 0x01,
+  0xd5, 0x00, 0xe5, 0x01, 0x0c, 0x01, 0xf0, 0x01, 0xe5, 0x00, 0xfb, 0x01, 0xdd, 0x00, 0x02, 0x02,
+  0xd0, 0x00, 0x0d, 0x02, 0x19, 0x01, 0x2f, 0x02, 0x18, 0x01, 0x4a, 0x02, 0x06, 0x01, 0x69, 0x02,
+  0x0d, 0x01, 0x6f, 0x02, 0x1c, 0x01, 0x77, 0x02, 0x16, 0x01, 0x97, 0x02, 0x0b, 0x01, 0xa5, 0x02,
+  0xf1, 0x00, 0xbb, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x25, 0x00, 0x34, 0x00, 0x28, 0x00,
+  0x89, 0x01, 0x41, 0x00, 0x90, 0x00, 0x47, 0x00, 0xbf, 0x00, 0x5e, 0x00, 0x86, 0x00, 0x7f, 0x00,
+  0x50, 0x00, 0x86, 0x00, 0xa2, 0x00, 0x89, 0x00, 0x62, 0x00, 0xa7, 0x00, 0x7b, 0x00, 0xba, 0x00,
+  0x78, 0x00, 0xbb, 0x00, 0x77, 0x00, 0xbc, 0x00, 0x81, 0x00, 0xbd, 0x00, 0x7a, 0x00, 0xc9, 0x00,
+  0x98, 0x00, 0xe3, 0x00, 0x72, 0x00, 0xf7, 0x00, 0x6a, 0x00, 0xfb, 0x00, 0x92, 0x00, 0x00, 0x01,
+  0xb4, 0x00, 0x16, 0x01, 0x21, 0x01, 0x44, 0x01, 0x26, 0x01, 0x46, 0x01, 0x4d, 0x01, 0x5c, 0x01,
+  0x51, 0x01, 0x68, 0x01, 0x03, 0x00, 0x75, 0x01, 0x32, 0x00, 0x82, 0x01, 0x52, 0x01, 0x8a, 0x01,
+  0x66, 0x01, 0x91, 0x01, 0x39, 0x01, 0x9e, 0x01, 0x48, 0x01, 0xa9, 0x01, 0xff, 0x00, 0xac, 0x01,
+  0xe6, 0x00, 0xb5, 0x01, 0x20, 0x01, 0xc7, 0x01, 0xd9, 0x00, 0xd4, 0x01, 0xd5, 0x00, 0xe5, 0x01,
+  0x0c, 0x01, 0xef, 0x01, 0xe5, 0x00, 0xfc, 0x01, 0xdd, 0x00, 0x02, 0x02, 0xd0, 0x00, 0x0d, 0x02,
+  0x19, 0x01, 0x30, 0x02, 0x18, 0x01, 0x4a, 0x02, 0x06, 0x01, 0x67, 0x02, 0x0d, 0x01, 0x71, 0x02,
+  0x1c, 0x01, 0x76, 0x02, 0x16, 0x01, 0x9b, 0x02, 0x0b, 0x01, 0xa5, 0x02, 0xf1, 0x00, 0xb9, 0x02,
+  0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x27, 0x00, 0x89, 0x01, 0x43, 0x00, 0x90, 0x00, 0x46, 0x00,
+  0xbf, 0x00, 0x5b, 0x00, 0x86, 0x00, 0x83, 0x00, 0xa2, 0x00, 0x8a, 0x00, 0x62, 0x00, 0xa7, 0x00,
+  0x7b, 0x00, 0xb8, 0x00, 0x78, 0x00, 0xba, 0x00, 0x79, 0x00, 0xbb, 0x00, 0x77, 0x00, 0xbc, 0x00,
+  0x81, 0x00, 0xbe, 0x00, 0x7a, 0x00, 0xca, 0x00, 0x98, 0x00, 0xe3, 0x00, 0x22, 0x01, 0xee, 0x00,
+  0x72, 0x00, 0xf7, 0x00, 0x6a, 0x00, 0xfb, 0x00, 0x92, 0x00, 0x00, 0x01, 0xb4, 0x00, 0x15, 0x01,
+  0x21, 0x01, 0x43, 0x01, 0x26, 0x01, 0x47, 0x01, 0x4d, 0x01, 0x5b, 0x01, 0x44, 0x01, 0x5f, 0x01,
+  0x51, 0x01, 0x67, 0x01, 0x03, 0x00, 0x75, 0x01, 0x32, 0x00, 0x82, 0x01, 0x52, 0x01, 0x8b, 0x01,
+  0x66, 0x01, 0x90, 0x01, 0x39, 0x01, 0x9f, 0x01, 0x48, 0x01, 0xa7, 0x01, 0xff, 0x00, 0xac, 0x01,
+  0xe6, 0x00, 0xb5, 0x01, 0x20, 0x01, 0xc7, 0x01, 0xd9, 0x00, 0xd0, 0x01, 0x14, 0x01, 0xd4, 0x01,
+  0xd5, 0x00, 0xe6, 0x01, 0x0c, 0x01, 0xee, 0x01, 0xe5, 0x00, 0xfd, 0x01, 0xdd, 0x00, 0x02, 0x02,
+  0xd0, 0x00, 0x0d, 0x02, 0x19, 0x01, 0x30, 0x02, 0x18, 0x01, 0x48, 0x02, 0x0e, 0x01, 0x4b, 0x02,
+  0x06, 0x01, 0x65, 0x02, 0x0d, 0x01, 0x73, 0x02, 0x1c, 0x01, 0x74, 0x02, 0x16, 0x01, 0x9f, 0x02,
+  0x0b, 0x01, 0xa6, 0x02, 0xf1, 0x00, 0xb7, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x26, 0x00,
+  0x89, 0x01, 0x45, 0x00, 0xbf, 0x00, 0x58, 0x00, 0x86, 0x00, 0x83, 0x00, 0xa2, 0x00, 0x8c, 0x00,
+  0x62, 0x00, 0xa7, 0x00, 0x7b, 0x00, 0xb7, 0x00, 0x78, 0x00, 0xb8, 0x00, 0x79, 0x00, 0xbc, 0x00,
+  0x81, 0x00, 0xbe, 0x00, 0x82, 0x00, 0xca, 0x00, 0x98, 0x00, 0xe1, 0x00, 0x22, 0x01, 0xf7, 0x00,
+  0x72, 0x00, 0xf8, 0x00, 0x6a, 0x00, 0xfb, 0x00, 0x92, 0x00, 0x00, 0x01, 0xb4, 0x00, 0x15, 0x01,
+  0x21, 0x01, 0x42, 0x01, 0x26, 0x01, 0x49, 0x01, 0x4d, 0x01, 0x5a, 0x01, 0x44, 0x01, 0x63, 0x01,
+  0x51, 0x01, 0x66, 0x01, 0x03, 0x00, 0x75, 0x01, 0x32, 0x00, 0x82, 0x01, 0x52, 0x01, 0x8d, 0x01,
+  0x66, 0x01, 0x8e, 0x01, 0x39, 0x01, 0xa0, 0x01, 0x48, 0x01, 0xa5, 0x01, 0xff, 0x00, 0xac, 0x01,
+  0xe6, 0x00, 0xb6, 0x01, 0x20, 0x01, 0xc7, 0x01, 0xd9, 0x00, 0xcb, 0x01, 0x14, 0x01, 0xd5, 0x01,
+  0xd5, 0x00, 0xe6, 0x01, 0x0c, 0x01, 0xed, 0x01, 0xe5, 0x00, 0xff, 0x01, 0xdd, 0x00, 0x02, 0x02,
+  0xd0, 0x00, 0x0e, 0x02, 0x19, 0x01, 0x30, 0x02, 0x18, 0x01, 0x46, 0x02, 0x0e, 0x01, 0x4f, 0x02,
+  0x06, 0x01, 0x63, 0x02, 0x0d, 0x01, 0x73, 0x02, 0x16, 0x01, 0xa2, 0x02, 0x0b, 0x01, 0xa7, 0x02,
+  0xf1, 0x00, 0xb6, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x25, 0x00, 0x89, 0x01, 0x47, 0x00,
+  0xbf, 0x00, 0x55, 0x00, 0x86, 0x00, 0x83, 0x00, 0xa2, 0x00, 0x8d, 0x00, 0x62, 0x00, 0xa7, 0x00,
+  0x7b, 0x00, 0xb6, 0x00, 0x78, 0x00, 0xb7, 0x00, 0x79, 0x00, 0xbc, 0x00, 0x82, 0x00, 0xcb, 0x00,
+  0x98, 0x00, 0xe0, 0x00, 0x22, 0x01, 0xfb, 0x00, 0x6a, 0x00, 0xfc, 0x00, 0x92, 0x00, 0x00, 0x01,
+  0xb4, 0x00, 0x14, 0x01, 0x21, 0x01, 0x41, 0x01, 0x26, 0x01, 0x4a, 0x01, 0x4d, 0x01, 0x59, 0x01,
+  0x44, 0x01, 0x65, 0x01, 0x03, 0x00, 0x75, 0x01, 0x32, 0x00, 0x81, 0x01, 0x52, 0x01, 0x8e, 0x01,
+  0x39, 0x01, 0xa1, 0x01, 0x48, 0x01, 0xa3, 0x01, 0xff, 0x00, 0xac, 0x01, 0xe6, 0x00, 0xb4, 0x01,
+  0xdc, 0x00, 0xb5, 0x01, 0xe1, 0x00, 0xb8, 0x01, 0x20, 0x01, 0xc7, 0x01, 0x14, 0x01, 0xd5, 0x01,
+  0xd5, 0x00, 0xe6, 0x01, 0x0c, 0x01, 0xec, 0x01, 0xe5, 0x00, 0x00, 0x02, 0xdd, 0x00, 0x03, 0x02,
+  0xd0, 0x00, 0x0e, 0x02, 0x19, 0x01, 0x31, 0x02, 0x18, 0x01, 0x45, 0x02, 0x0e, 0x01, 0x52, 0x02,
+  0x06, 0x01, 0x61, 0x02, 0x0d, 0x01, 0x73, 0x02, 0x16, 0x01, 0xa5, 0x02, 0x0b, 0x01, 0xa7, 0x02,
+  0xf1, 0x00, 0xb4, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x25, 0x00, 0x89, 0x01, 0x48, 0x00,
+  0xbf, 0x00, 0x53, 0x00, 0x86, 0x00, 0x83, 0x00, 0xa2, 0x00, 0x8e, 0x00, 0x62, 0x00, 0xa7, 0x00,
+  0x7b, 0x00, 0xb5, 0x00, 0x79, 0x00, 0xbb, 0x00, 0x82, 0x00, 0xcb, 0x00, 0x98, 0x00, 0xde, 0x00,
+  0x22, 0x01, 0xfe, 0x00, 0x92, 0x00, 0x00, 0x01, 0xb4, 0x00, 0x13, 0x01, 0x21, 0x01, 0x40, 0x01,
+  0x26, 0x01, 0x4b, 0x01, 0x4d, 0x01, 0x58, 0x01, 0x44, 0x01, 0x66, 0x01, 0x03, 0x00, 0x75, 0x01,
+  0x32, 0x00, 0x81, 0x01, 0x52, 0x01, 0x8e, 0x01, 0x39, 0x01, 0xa1, 0x01, 0xff, 0x00, 0xac, 0x01,
+  0xe6, 0x00, 0xb3, 0x01, 0xdc, 0x00, 0xb4, 0x01, 0xe1, 0x00, 0xb9, 0x01, 0x20, 0x01, 0xbb, 0x01,
+  0xd7, 0x00, 0xc3, 0x01, 0x20, 0x01, 0xc6, 0x01, 0x14, 0x01, 0xd6, 0x01, 0xd5, 0x00, 0xe6, 0x01,
+  0x0c, 0x01, 0xec, 0x01, 0xe5, 0x00, 0xfb, 0x01, 0xf0, 0x00, 0x01, 0x02, 0xdd, 0x00, 0x03, 0x02,
+  0xd0, 0x00, 0x0e, 0x02, 0x19, 0x01, 0x31, 0x02, 0x18, 0x01, 0x43, 0x02, 0x0e, 0x01, 0x56, 0x02,
+  0x06, 0x01, 0x5f, 0x02, 0x0d, 0x01, 0x73, 0x02, 0x16, 0x01, 0xa8, 0x02, 0xf1, 0x00, 0xb3, 0x02,
+  0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x24, 0x00, 0x89, 0x01, 0x49, 0x00, 0xbf, 0x00, 0x50, 0x00,
+  0x86, 0x00, 0x82, 0x00, 0xa2, 0x00, 0x90, 0x00, 0x62, 0x00, 0xa7, 0x00, 0x7b, 0x00, 0xb4, 0x00,
+  0x79, 0x00, 0xba, 0x00, 0x82, 0x00, 0xcc, 0x00, 0x98, 0x00, 0xdd, 0x00, 0x22, 0x01, 0x00, 0x01,
+  0x92, 0x00, 0x01, 0x01, 0xb4, 0x00, 0x13, 0x01, 0x21, 0x01, 0x3f, 0x01, 0x26, 0x01, 0x4c, 0x01,
+  0x4d, 0x01, 0x57, 0x01, 0x44, 0x01, 0x64, 0x01, 0x0e, 0x00, 0x66, 0x01, 0x03, 0x00, 0x75, 0x01,
+  0x32, 0x00, 0x81, 0x01, 0x52, 0x01, 0x8f, 0x01, 0x39, 0x01, 0xa1, 0x01, 0xff, 0x00, 0xac, 0x01,
+  0xe6, 0x00, 0xb2, 0x01, 0xdc, 0x00, 0xb3, 0x01, 0xe1, 0x00, 0xb9, 0x01, 0xd7, 0x00, 0xc6, 0x01,
+  0x14, 0x01, 0xd6, 0x01, 0xd5, 0x00, 0xe7, 0x01, 0x0c, 0x01, 0xeb, 0x01, 0xf0, 0x00, 0x03, 0x02,
+  0xd0, 0x00, 0x0e, 0x02, 0x19, 0x01, 0x31, 0x02, 0x18, 0x01, 0x41, 0x02, 0x0e, 0x01, 0x59, 0x02,
+  0x06, 0x01, 0x5d, 0x02, 0x0d, 0x01, 0x73, 0x02, 0x16, 0x01, 0xa9, 0x02, 0xf1, 0x00, 0xb0, 0x02,
+  0x9f, 0x01, 0xb2, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x24, 0x00, 0x89, 0x01, 0x4b, 0x00,
+  0xbf, 0x00, 0x4d, 0x00, 0x86, 0x00, 0x82, 0x00, 0xa2, 0x00, 0x90, 0x00, 0x59, 0x00, 0x94, 0x00,
+  0x62, 0x00, 0xa7, 0x00, 0x7b, 0x00, 0xb2, 0x00, 0x79, 0x00, 0xb9, 0x00, 0x82, 0x00, 0xcc, 0x00,
+  0x98, 0x00, 0xdb, 0x00, 0x22, 0x01, 0x02, 0x01, 0xb4, 0x00, 0x12, 0x01, 0x21, 0x01, 0x3f, 0x01,
+  0x26, 0x01, 0x4e, 0x01, 0x4d, 0x01, 0x53, 0x01, 0x0d, 0x00, 0x58, 0x01, 0x0e, 0x00, 0x66, 0x01,
+  0x03, 0x00, 0x75, 0x01, 0x32, 0x00, 0x80, 0x01, 0x52, 0x01, 0x8f, 0x01, 0x39, 0x01, 0xa0, 0x01,
+  0xff, 0x00, 0xab, 0x01, 0xe6, 0x00, 0xb0, 0x01, 0xdc, 0x00, 0xb3, 0x01, 0xe1, 0x00, 0xb9, 0x01,
+  0xd7, 0x00, 0xc7, 0x01, 0x14, 0x01, 0xd7, 0x01, 0xd5, 0x00, 0xe7, 0x01, 0x0c, 0x01, 0xe8, 0x01,
+  0xf0, 0x00, 0x05, 0x02, 0xd0, 0x00, 0x0c, 0x02, 0xf3, 0x00, 0x15, 0x02, 0x19, 0x01, 0x1c, 0x02,
+  0x15, 0x01, 0x32, 0x02, 0x18, 0x01, 0x40, 0x02, 0x0e, 0x01, 0x5c, 0x02, 0x0d, 0x01, 0x72, 0x02,
+  0x16, 0x01, 0xaa, 0x02, 0x9f, 0x01, 0xb3, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x23, 0x00,
+  0x89, 0x01, 0x4c, 0x00, 0x86, 0x00, 0x82, 0x00, 0xa2, 0x00, 0x90, 0x00, 0x59, 0x00, 0x9c, 0x00,
+  0x62, 0x00, 0xa7, 0x00, 0x7b, 0x00, 0xb1, 0x00, 0x79, 0x00, 0xb9, 0x00, 0x82, 0x00, 0xcd, 0x00,
+  0x98, 0x00, 0xda, 0x00, 0x22, 0x01, 0x04, 0x01, 0xb4, 0x00, 0x12, 0x01, 0x21, 0x01, 0x3e, 0x01,
+  0x26, 0x01, 0x4f, 0x01, 0x0d, 0x00, 0x5a, 0x01, 0x0e, 0x00, 0x66, 0x01, 0x03, 0x00, 0x75, 0x01,
+  0x32, 0x00, 0x80, 0x01, 0x52, 0x01, 0x8f, 0x01, 0x39, 0x01, 0xa0, 0x01, 0xff, 0x00, 0xab, 0x01,
+  0xe6, 0x00, 0xaf, 0x01, 0xdc, 0x00, 0xb2, 0x01, 0xe1, 0x00, 0xb9, 0x01, 0xd7, 0x00, 0xc7, 0x01,
+  0x14, 0x01, 0xd7, 0x01, 0xd5, 0x00, 0xe7, 0x01, 0xf0, 0x00, 0x06, 0x02, 0xd0, 0x00, 0x09, 0x02,
+  0xf3, 0x00, 0x18, 0x02, 0x15, 0x01, 0x34, 0x02, 0x18, 0x01, 0x3e, 0x02, 0x0e, 0x01, 0x5d, 0x02,
+  0x0d, 0x01, 0x72, 0x02, 0x16, 0x01, 0xa9, 0x02, 0x9f, 0x01, 0xb3, 0x02, 0x90, 0x01, 0xd0, 0x02,
+  0x90, 0x01, 0x23, 0x00, 0x89, 0x01, 0x4c, 0x00, 0x86, 0x00, 0x82, 0x00, 0xa2, 0x00, 0x8f, 0x00,
+  0x59, 0x00, 0xa2, 0x00, 0x62, 0x00, 0xa7, 0x00, 0x7b, 0x00, 0xb0, 0x00, 0x79, 0x00, 0xb8, 0x00,
+  0x82, 0x00, 0xcd, 0x00, 0x98, 0x00, 0xd9, 0x00, 0x22, 0x01, 0x05, 0x01, 0xb4, 0x00, 0x11, 0x01,
+  0x21, 0x01, 0x3d, 0x01, 0x26, 0x01, 0x4f, 0x01, 0x0d, 0x00, 0x5b, 0x01, 0x0e, 0x00, 0x66, 0x01,
+  0x03, 0x00, 0x75, 0x01, 0x32, 0x00, 0x7f, 0x01, 0x31, 0x00, 0x81, 0x01, 0x52, 0x01, 0x90, 0x01,
+  0x39, 0x01, 0xa0, 0x01, 0xff, 0x00, 0xab, 0x01, 0xe6, 0x00, 0xae, 0x01, 0xdc, 0x00, 0xb1, 0x01,
+  0xe1, 0x00, 0xb9, 0x01, 0xd7, 0x00, 0xc8, 0x01, 0x14, 0x01, 0xd8, 0x01, 0xd5, 0x00, 0xe6, 0x01,
+  0xf0, 0x00, 0x07, 0x02, 0xf3, 0x00, 0x18, 0x02, 0x15, 0x01, 0x36, 0x02, 0x18, 0x01, 0x3d, 0x02,
+  0x0e, 0x01, 0x5f, 0x02, 0x0d, 0x01, 0x72, 0x02, 0x16, 0x01, 0xa8, 0x02, 0x9f, 0x01, 0xb4, 0x02,
+  0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x22, 0x00, 0x89, 0x01, 0x4d, 0x00, 0x86, 0x00, 0x80, 0x00,
+  0xbc, 0x00, 0x82, 0x00, 0xa2, 0x00, 0x8f, 0x00, 0x59, 0x00, 0xa0, 0x00, 0x9f, 0x00, 0xa7, 0x00,
+  0x7b, 0x00, 0xae, 0x00, 0x79, 0x00, 0xb7, 0x00, 0x82, 0x00, 0xce, 0x00, 0x98, 0x00, 0xd7, 0x00,
+  0x22, 0x01, 0x07, 0x01, 0xb4, 0x00, 0x11, 0x01, 0x21, 0x01, 0x3c, 0x01, 0x26, 0x01, 0x4f, 0x01,
+  0x0d, 0x00, 0x5d, 0x01, 0x0e, 0x00, 0x66, 0x01, 0x03, 0x00, 0x75, 0x01, 0x32, 0x00, 0x7d, 0x01,
+  0x31, 0x00, 0x85, 0x01, 0x52, 0x01, 0x90, 0x01, 0x39, 0x01, 0x9f, 0x01, 0xff, 0x00, 0xab, 0x01,
+  0xe6, 0x00, 0xad, 0x01, 0xdc, 0x00, 0xb1, 0x01, 0xe1, 0x00, 0xb9, 0x01, 0xd7, 0x00, 0xc8, 0x01,
+  0x14, 0x01, 0xd8, 0x01, 0xd5, 0x00, 0xe6, 0x01, 0xf0, 0x00, 0x07, 0x02, 0xf3, 0x00, 0x18, 0x02,
+  0x15, 0x01, 0x38, 0x02, 0x18, 0x01, 0x3b, 0x02, 0x0e, 0x01, 0x61, 0x02, 0x0d, 0x01, 0x72, 0x02,
+  0x16, 0x01, 0xa7, 0x02, 0x9f, 0x01, 0xb5, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x22, 0x00,
+  0x89, 0x01, 0x4d, 0x00, 0x86, 0x00, 0x7e, 0x00, 0xbc, 0x00, 0x82, 0x00, 0xa2, 0x00, 0x8e, 0x00,
+  0x59, 0x00, 0x9e, 0x00, 0x9f, 0x00, 0xa7, 0x00, 0x8c, 0x00, 0xa9, 0x00, 0x7b, 0x00, 0xad, 0x00,
+  0x79, 0x00, 0xb6, 0x00, 0x82, 0x00, 0xcf, 0x00, 0x98, 0x00, 0xd6, 0x00, 0x22, 0x01, 0x08, 0x01,
+  0xb4, 0x00, 0x10, 0x01, 0x21, 0x01, 0x3b, 0x01, 0x26, 0x01, 0x4f, 0x01, 0x0d, 0x00, 0x5e, 0x01,
+  0x0e, 0x00, 0x67, 0x01, 0x03, 0x00, 0x75, 0x01, 0x32, 0x00, 0x7b, 0x01, 0x31, 0x00, 0x88, 0x01,
+  0x52, 0x01, 0x90, 0x01, 0x39, 0x01, 0x9e, 0x01, 0x0c, 0x00, 0xa0, 0x01, 0xff, 0x00, 0xab, 0x01,
+  0xe6, 0x00, 0xac, 0x01, 0xdc, 0x00, 0xb0, 0x01, 0xe1, 0x00, 0xb9, 0x01, 0xd7, 0x00, 0xc9, 0x01,
+  0x14, 0x01, 0xd9, 0x01, 0xd5, 0x00, 0xe5, 0x01, 0xf0, 0x00, 0x06, 0x02, 0xf3, 0x00, 0x18, 0x02,
+  0x15, 0x01, 0x39, 0x02, 0xfa, 0x00, 0x3c, 0x02, 0x0e, 0x01, 0x62, 0x02, 0x0d, 0x01, 0x72, 0x02,
+  0x16, 0x01, 0xa6, 0x02, 0x9f, 0x01, 0xb6, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x21, 0x00,
+  0x89, 0x01, 0x4e, 0x00, 0x86, 0x00, 0x7d, 0x00, 0xbc, 0x00, 0x83, 0x00, 0xa2, 0x00, 0x8e, 0x00,
+  0x59, 0x00, 0x9d, 0x00, 0x9f, 0x00, 0xa6, 0x00, 0x8c, 0x00, 0xab, 0x00, 0x7b, 0x00, 0xac, 0x00,
+  0x79, 0x00, 0xb5, 0x00, 0x82, 0x00, 0xcf, 0x00, 0x98, 0x00, 0xd5, 0x00, 0x22, 0x01, 0x0a, 0x01,
+  0xb4, 0x00, 0x10, 0x01, 0x21, 0x01, 0x3a, 0x01, 0x26, 0x01, 0x4f, 0x01, 0x0d, 0x00, 0x5f, 0x01,
+  0x0e, 0x00, 0x67, 0x01, 0x03, 0x00, 0x75, 0x01, 0x32, 0x00, 0x79, 0x01, 0x31, 0x00, 0x8b, 0x01,
+  0x52, 0x01, 0x91, 0x01, 0x39, 0x01, 0x9d, 0x01, 0x0c, 0x00, 0xa4, 0x01, 0xff, 0x00, 0xab, 0x01,
+  0xdc, 0x00, 0xaf, 0x01, 0xe1, 0x00, 0xb9, 0x01, 0xd7, 0x00, 0xc9, 0x01, 0x14, 0x01, 0xd9, 0x01,
+  0xd5, 0x00, 0xe5, 0x01, 0xf0, 0x00, 0x05, 0x02, 0xf3, 0x00, 0x18, 0x02, 0x15, 0x01, 0x38, 0x02,
+  0xfa, 0x00, 0x3e, 0x02, 0x0e, 0x01, 0x64, 0x02, 0x0d, 0x01, 0x71, 0x02, 0x16, 0x01, 0xa5, 0x02,
+  0x9f, 0x01, 0xb7, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x21, 0x00, 0x89, 0x01, 0x4e, 0x00,
+  0x86, 0x00, 0x7b, 0x00, 0xbc, 0x00, 0x83, 0x00, 0xa2, 0x00, 0x8e, 0x00, 0x59, 0x00, 0x9b, 0x00,
+  0x9f, 0x00, 0xa6, 0x00, 0x8c, 0x00, 0xad, 0x00, 0x79, 0x00, 0xb4, 0x00, 0x82, 0x00, 0xce, 0x00,
+  0x97, 0x00, 0xd2, 0x00, 0x98, 0x00, 0xd4, 0x00, 0x22, 0x01, 0x0c, 0x01, 0xb4, 0x00, 0x0f, 0x01,
+  0x21, 0x01, 0x39, 0x01, 0x26, 0x01, 0x50, 0x01, 0x0d, 0x00, 0x61, 0x01, 0x0e, 0x00, 0x67, 0x01,
+  0x03, 0x00, 0x75, 0x01, 0x32, 0x00, 0x78, 0x01, 0x31, 0x00, 0x8e, 0x01, 0x52, 0x01, 0x91, 0x01,
+  0x39, 0x01, 0x9b, 0x01, 0x0c, 0x00, 0xa7, 0x01, 0xe7, 0x00, 0xad, 0x01, 0xef, 0x00, 0xaf, 0x01,
+  0xd1, 0x00, 0xb0, 0x01, 0xe1, 0x00, 0xb9, 0x01, 0xd7, 0x00, 0xc9, 0x01, 0xf9, 0x00, 0xca, 0x01,
+  0x14, 0x01, 0xda, 0x01, 0xd5, 0x00, 0xe4, 0x01, 0xf0, 0x00, 0x05, 0x02, 0xf3, 0x00, 0x18, 0x02,
+  0x15, 0x01, 0x38, 0x02, 0xfa, 0x00, 0x3f, 0x02, 0x0e, 0x01, 0x66, 0x02, 0x0d, 0x01, 0x71, 0x02,
+  0x16, 0x01, 0xa4, 0x02, 0x9f, 0x01, 0xb8, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x20, 0x00,
+  0x89, 0x01, 0x4f, 0x00, 0x86, 0x00, 0x79, 0x00, 0xbc, 0x00, 0x83, 0x00, 0xa2, 0x00, 0x8d, 0x00,
+  0x59, 0x00, 0x9a, 0x00, 0x9f, 0x00, 0xa5, 0x00, 0x8c, 0x00, 0xae, 0x00, 0x79, 0x00, 0xb4, 0x00,
+  0x82, 0x00, 0xcc, 0x00, 0x97, 0x00, 0xd4, 0x00, 0x22, 0x01, 0x0d, 0x01, 0xb4, 0x00, 0x0f, 0x01,
+  0x21, 0x01, 0x39, 0x01, 0x26, 0x01, 0x50, 0x01, 0x0d, 0x00, 0x62, 0x01, 0x0e, 0x00, 0x67, 0x01,
+  0x03, 0x00, 0x75, 0x01, 0x32, 0x00, 0x76, 0x01, 0x31, 0x00, 0x90, 0x01, 0x52, 0x01, 0x91, 0x01,
+  0x39, 0x01, 0x9a, 0x01, 0x0c, 0x00, 0xa8, 0x01, 0xe7, 0x00, 0xad, 0x01, 0xef, 0x00, 0xaf, 0x01,
+  0xd1, 0x00, 0xb6, 0x01, 0xe1, 0x00, 0xb9, 0x01, 0xd7, 0x00, 0xc7, 0x01, 0xf9, 0x00, 0xcd, 0x01,
+  0x14, 0x01, 0xda, 0x01, 0xd5, 0x00, 0xe4, 0x01, 0xf0, 0x00, 0x04, 0x02, 0xf3, 0x00, 0x18, 0x02,
+  0x15, 0x01, 0x38, 0x02, 0xfa, 0x00, 0x41, 0x02, 0x0e, 0x01, 0x67, 0x02, 0x0d, 0x01, 0x71, 0x02,
+  0x16, 0x01, 0xa3, 0x02, 0x9f, 0x01, 0xb9, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x20, 0x00,
+  0x89, 0x01, 0x4f, 0x00, 0x86, 0x00, 0x77, 0x00, 0xbc, 0x00, 0x84, 0x00, 0xa2, 0x00, 0x8d, 0x00,
+  0x59, 0x00, 0x98, 0x00, 0x9f, 0x00, 0xa4, 0x00, 0x8c, 0x00, 0xb0, 0x00, 0x79, 0x00, 0xb3, 0x00,
+  0x82, 0x00, 0xca, 0x00, 0x97, 0x00, 0xd5, 0x00, 0x22, 0x01, 0x0e, 0x01, 0x21, 0x01, 0x38, 0x01,
+  0x26, 0x01, 0x50, 0x01, 0x0d, 0x00, 0x63, 0x01, 0x0e, 0x00, 0x67, 0x01, 0x03, 0x00, 0x75, 0x01,
+  0x31, 0x00, 0x92, 0x01, 0x39, 0x01, 0x99, 0x01, 0x0c, 0x00, 0xa8, 0x01, 0xe7, 0x00, 0xae, 0x01,
+  0xef, 0x00, 0xaf, 0x01, 0xd1, 0x00, 0xb9, 0x01, 0xd7, 0x00, 0xc6, 0x01, 0xf9, 0x00, 0xcf, 0x01,
+  0x14, 0x01, 0xdb, 0x01, 0xd5, 0x00, 0xe4, 0x01, 0xf0, 0x00, 0x04, 0x02, 0xf3, 0x00, 0x18, 0x02,
+  0x15, 0x01, 0x37, 0x02, 0xfa, 0x00, 0x43, 0x02, 0x0e, 0x01, 0x69, 0x02, 0x0d, 0x01, 0x71, 0x02,
+  0x16, 0x01, 0xa2, 0x02, 0x9f, 0x01, 0xb9, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x1f, 0x00,
+  0x89, 0x01, 0x50, 0x00, 0x86, 0x00, 0x76, 0x00, 0xbc, 0x00, 0x84, 0x00, 0xa2, 0x00, 0x89, 0x00,
+  0x74, 0x00, 0x8d, 0x00, 0x59, 0x00, 0x97, 0x00, 0x9f, 0x00, 0xa3, 0x00, 0x8c, 0x00, 0xb1, 0x00,
+  0x79, 0x00, 0xb2, 0x00, 0x82, 0x00, 0xc7, 0x00, 0x97, 0x00, 0xd6, 0x00, 0x22, 0x01, 0x0e, 0x01,
+  0x21, 0x01, 0x37, 0x01, 0x26, 0x01, 0x4f, 0x01, 0x23, 0x01, 0x50, 0x01, 0x0d, 0x00, 0x65, 0x01,
+  0x0e, 0x00, 0x67, 0x01, 0x03, 0x00, 0x74, 0x01, 0x31, 0x00, 0x92, 0x01, 0x39, 0x01, 0x97, 0x01,
+  0x0c, 0x00, 0xa9, 0x01, 0xe7, 0x00, 0xae, 0x01, 0xe8, 0x00, 0xb0, 0x01, 0xd1, 0x00, 0xb9, 0x01,
+  0xd7, 0x00, 0xc4, 0x01, 0xf9, 0x00, 0xd2, 0x01, 0x14, 0x01, 0xd9, 0x01, 0xe4, 0x00, 0xde, 0x01,
+  0xd5, 0x00, 0xe3, 0x01, 0xf0, 0x00, 0x03, 0x02, 0xf3, 0x00, 0x18, 0x02, 0x15, 0x01, 0x37, 0x02,
+  0xfa, 0x00, 0x45, 0x02, 0x0e, 0x01, 0x6a, 0x02, 0x0d, 0x01, 0x70, 0x02, 0x16, 0x01, 0xa2, 0x02,
+  0x9f, 0x01, 0xba, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x1f, 0x00, 0x89, 0x01, 0x50, 0x00,
+  0x86, 0x00, 0x74, 0x00, 0xbc, 0x00, 0x84, 0x00, 0x74, 0x00, 0x8e, 0x00, 0x59, 0x00, 0x95, 0x00,
+  0x9f, 0x00, 0xa2, 0x00, 0x8c, 0x00, 0xb3, 0x00, 0x82, 0x00, 0xc5, 0x00, 0x97, 0x00, 0xd7, 0x00,
+  0x22, 0x01, 0x0f, 0x01, 0x21, 0x01, 0x36, 0x01, 0x26, 0x01, 0x4b, 0x01, 0x23, 0x01, 0x4f, 0x01,
+  0x14, 0x00, 0x52, 0x01, 0x0d, 0x00, 0x66, 0x01, 0x0e, 0x00, 0x67, 0x01, 0x03, 0x00, 0x74, 0x01,
+  0x31, 0x00, 0x93, 0x01, 0x39, 0x01, 0x96, 0x01, 0x0c, 0x00, 0xaa, 0x01, 0xe7, 0x00, 0xae, 0x01,
+  0xe8, 0x00, 0xb0, 0x01, 0xd1, 0x00, 0xb9, 0x01, 0xd7, 0x00, 0xc3, 0x01, 0xf9, 0x00, 0xd3, 0x01,
+  0xd8, 0x00, 0xd5, 0x01, 0xe4, 0x00, 0xe2, 0x01, 0xfe, 0x00, 0xe3, 0x01, 0xf0, 0x00, 0x02, 0x02,
+  0xf3, 0x00, 0x17, 0x02, 0x15, 0x01, 0x37, 0x02, 0xfa, 0x00, 0x46, 0x02, 0x0e, 0x01, 0x6c, 0x02,
+  0x0d, 0x01, 0x70, 0x02, 0x16, 0x01, 0xa1, 0x02, 0x9f, 0x01, 0xbb, 0x02, 0x90, 0x01, 0xd0, 0x02,
+  0x90, 0x01, 0x1e, 0x00, 0x89, 0x01, 0x51, 0x00, 0x86, 0x00, 0x73, 0x00, 0xbc, 0x00, 0x83, 0x00,
+  0x74, 0x00, 0x8f, 0x00, 0x59, 0x00, 0x94, 0x00, 0x9f, 0x00, 0xa2, 0x00, 0x8c, 0x00, 0xb4, 0x00,
+  0x82, 0x00, 0xc3, 0x00, 0x97, 0x00, 0xd7, 0x00, 0x22, 0x01, 0x0f, 0x01, 0x21, 0x01, 0x36, 0x01,
+  0x26, 0x01, 0x47, 0x01, 0x23, 0x01, 0x4e, 0x01, 0x14, 0x00, 0x54, 0x01, 0x0d, 0x00, 0x67, 0x01,
+  0x0e, 0x00, 0x68, 0x01, 0x03, 0x00, 0x73, 0x01, 0x31, 0x00, 0x94, 0x01, 0x0c, 0x00, 0xaa, 0x01,
+  0xe7, 0x00, 0xae, 0x01, 0xe8, 0x00, 0xb1, 0x01, 0xd1, 0x00, 0xb9, 0x01, 0xd7, 0x00, 0xc1, 0x01,
+  0xf9, 0x00, 0xd2, 0x01, 0xd8, 0x00, 0xd5, 0x01, 0xe4, 0x00, 0xe2, 0x01, 0xfe, 0x00, 0xe3, 0x01,
+  0xf2, 0x00, 0xe9, 0x01, 0xf0, 0x00, 0x02, 0x02, 0xf3, 0x00, 0x17, 0x02, 0x15, 0x01, 0x37, 0x02,
+  0xfa, 0x00, 0x48, 0x02, 0x0e, 0x01, 0x6d, 0x02, 0x0d, 0x01, 0x70, 0x02, 0x16, 0x01, 0xa0, 0x02,
+  0x9f, 0x01, 0xbc, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x1e, 0x00, 0x89, 0x01, 0x51, 0x00,
+  0x86, 0x00, 0x71, 0x00, 0xbc, 0x00, 0x82, 0x00, 0x74, 0x00, 0x8f, 0x00, 0x58, 0x00, 0x95, 0x00,
+  0x9f, 0x00, 0xa1, 0x00, 0x94, 0x00, 0xa2, 0x00, 0x8c, 0x00, 0xb5, 0x00, 0x82, 0x00, 0xbe, 0x00,
+  0x73, 0x00, 0xc3, 0x00, 0x97, 0x00, 0xd8, 0x00, 0x22, 0x01, 0x0f, 0x01, 0x21, 0x01, 0x35, 0x01,
+  0x26, 0x01, 0x43, 0x01, 0x23, 0x01, 0x4e, 0x01, 0x14, 0x00, 0x55, 0x01, 0x0d, 0x00, 0x68, 0x01,
+  0x03, 0x00, 0x73, 0x01, 0x31, 0x00, 0x94, 0x01, 0x0c, 0x00, 0xab, 0x01, 0xe7, 0x00, 0xae, 0x01,
+  0xe8, 0x00, 0xb2, 0x01, 0xd1, 0x00, 0xba, 0x01, 0xd7, 0x00, 0xc0, 0x01, 0xf9, 0x00, 0xd0, 0x01,
+  0xd8, 0x00, 0xd4, 0x01, 0xe4, 0x00, 0xe1, 0x01, 0xfe, 0x00, 0xe4, 0x01, 0xf2, 0x00, 0xef, 0x01,
+  0xf0, 0x00, 0x01, 0x02, 0xf3, 0x00, 0x17, 0x02, 0x15, 0x01, 0x36, 0x02, 0x1b, 0x01, 0x37, 0x02,
+  0xfa, 0x00, 0x49, 0x02, 0xea, 0x00, 0x4a, 0x02, 0x0e, 0x01, 0x6f, 0x02, 0x0d, 0x01, 0x70, 0x02,
+  0x16, 0x01, 0x9f, 0x02, 0x9f, 0x01, 0xbc, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x1d, 0x00,
+  0x89, 0x01, 0x51, 0x00, 0x86, 0x00, 0x70, 0x00, 0xbc, 0x00, 0x82, 0x00, 0x74, 0x00, 0x8f, 0x00,
+  0x58, 0x00, 0x95, 0x00, 0x9f, 0x00, 0x9f, 0x00, 0x94, 0x00, 0xa2, 0x00, 0x8c, 0x00, 0xb6, 0x00,
+  0x82, 0x00, 0xb7, 0x00, 0x73, 0x00, 0xc3, 0x00, 0x97, 0x00, 0xd9, 0x00, 0x22, 0x01, 0x0f, 0x01,
+  0x21, 0x01, 0x34, 0x01, 0x26, 0x01, 0x3f, 0x01, 0x23, 0x01, 0x4d, 0x01, 0x14, 0x00, 0x57, 0x01,
+  0x0d, 0x00, 0x68, 0x01, 0x03, 0x00, 0x72, 0x01, 0x31, 0x00, 0x94, 0x01, 0x0c, 0x00, 0xac, 0x01,
+  0xe7, 0x00, 0xae, 0x01, 0xe8, 0x00, 0xb2, 0x01, 0xd1, 0x00, 0xba, 0x01, 0xd7, 0x00, 0xbe, 0x01,
+  0xf9, 0x00, 0xcf, 0x01, 0xd8, 0x00, 0xd4, 0x01, 0xe4, 0x00, 0xe0, 0x01, 0xfe, 0x00, 0xe4, 0x01,
+  0xf2, 0x00, 0xf5, 0x01, 0xf0, 0x00, 0x01, 0x02, 0xf3, 0x00, 0x17, 0x02, 0x15, 0x01, 0x35, 0x02,
+  0x1b, 0x01, 0x37, 0x02, 0xfa, 0x00, 0x49, 0x02, 0xea, 0x00, 0x4b, 0x02, 0x0e, 0x01, 0x70, 0x02,
+  0x16, 0x01, 0x9e, 0x02, 0x9f, 0x01, 0xbd, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x1d, 0x00,
+  0x89, 0x01, 0x52, 0x00, 0x86, 0x00, 0x6e, 0x00, 0xbc, 0x00, 0x81, 0x00, 0x74, 0x00, 0x8f, 0x00,
+  0x58, 0x00, 0x96, 0x00, 0x9f, 0x00, 0x9e, 0x00, 0x94, 0x00, 0xa2, 0x00, 0x8c, 0x00, 0xb5, 0x00,
+  0x8f, 0x00, 0xb7, 0x00, 0x73, 0x00, 0xc4, 0x00, 0x97, 0x00, 0xda, 0x00, 0x22, 0x01, 0x0f, 0x01,
+  0x21, 0x01, 0x33, 0x01, 0x26, 0x01, 0x3c, 0x01, 0x23, 0x01, 0x4d, 0x01, 0x14, 0x00, 0x58, 0x01,
+  0x0d, 0x00, 0x69, 0x01, 0x03, 0x00, 0x72, 0x01, 0x31, 0x00, 0x93, 0x01, 0x0c, 0x00, 0xac, 0x01,
+  0xe7, 0x00, 0xae, 0x01, 0xe8, 0x00, 0xb3, 0x01, 0xd1, 0x00, 0xba, 0x01, 0xd7, 0x00, 0xbd, 0x01,
+  0xf9, 0x00, 0xcd, 0x01, 0xd8, 0x00, 0xd4, 0x01, 0xe4, 0x00, 0xe0, 0x01, 0xfe, 0x00, 0xe4, 0x01,
+  0xf2, 0x00, 0xfa, 0x01, 0xf0, 0x00, 0x00, 0x02, 0xf3, 0x00, 0x17, 0x02, 0x15, 0x01, 0x34, 0x02,
+  0x1b, 0x01, 0x38, 0x02, 0xfa, 0x00, 0x49, 0x02, 0xea, 0x00, 0x4d, 0x02, 0x0e, 0x01, 0x70, 0x02,
+  0x16, 0x01, 0x9d, 0x02, 0x9f, 0x01, 0xbe, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x1c, 0x00,
+  0x89, 0x01, 0x52, 0x00, 0x86, 0x00, 0x6d, 0x00, 0xbc, 0x00, 0x80, 0x00, 0x74, 0x00, 0x8f, 0x00,
+  0x58, 0x00, 0x97, 0x00, 0x9f, 0x00, 0x9d, 0x00, 0x94, 0x00, 0xa2, 0x00, 0x8c, 0x00, 0xb4, 0x00,
+  0x8f, 0x00, 0xb7, 0x00, 0x53, 0x00, 0xb8, 0x00, 0x73, 0x00, 0xc4, 0x00, 0x97, 0x00, 0xda, 0x00,
+  0x22, 0x01, 0x10, 0x01, 0x21, 0x01, 0x33, 0x01, 0x26, 0x01, 0x39, 0x01, 0x23, 0x01, 0x4c, 0x01,
+  0x14, 0x00, 0x5a, 0x01, 0x0d, 0x00, 0x69, 0x01, 0x03, 0x00, 0x71, 0x01, 0x31, 0x00, 0x93, 0x01,
+  0x0c, 0x00, 0xad, 0x01, 0xe7, 0x00, 0xae, 0x01, 0xe8, 0x00, 0xb4, 0x01, 0xd1, 0x00, 0xba, 0x01,
+  0xd7, 0x00, 0xbb, 0x01, 0xf9, 0x00, 0xcc, 0x01, 0xd8, 0x00, 0xd3, 0x01, 0xe4, 0x00, 0xdf, 0x01,
+  0xfe, 0x00, 0xe4, 0x01, 0xf2, 0x00, 0xff, 0x01, 0xf0, 0x00, 0x00, 0x02, 0xf3, 0x00, 0x17, 0x02,
+  0x15, 0x01, 0x33, 0x02, 0x1b, 0x01, 0x38, 0x02, 0xfa, 0x00, 0x4a, 0x02, 0xea, 0x00, 0x4f, 0x02,
+  0x0e, 0x01, 0x70, 0x02, 0x16, 0x01, 0x9d, 0x02, 0x9f, 0x01, 0xbf, 0x02, 0x90, 0x01, 0xd0, 0x02,
+  0x90, 0x01, 0x1c, 0x00, 0x89, 0x01, 0x53, 0x00, 0x86, 0x00, 0x6b, 0x00, 0xbc, 0x00, 0x80, 0x00,
+  0x74, 0x00, 0x8f, 0x00, 0x58, 0x00, 0x97, 0x00, 0x9f, 0x00, 0x9c, 0x00, 0x94, 0x00, 0xa2, 0x00,
+  0x8c, 0x00, 0xb4, 0x00, 0x8f, 0x00, 0xb7, 0x00, 0x53, 0x00, 0xb8, 0x00, 0x73, 0x00, 0xc5, 0x00,
+  0x97, 0x00, 0xda, 0x00, 0x6c, 0x00, 0xdc, 0x00, 0x22, 0x01, 0x10, 0x01, 0x21, 0x01, 0x32, 0x01,
+  0x26, 0x01, 0x35, 0x01, 0x23, 0x01, 0x4c, 0x01, 0x14, 0x00, 0x5b, 0x01, 0x0d, 0x00, 0x69, 0x01,
+  0x03, 0x00, 0x71, 0x01, 0x31, 0x00, 0x93, 0x01, 0x0c, 0x00, 0xad, 0x01, 0xe7, 0x00, 0xae, 0x01,
+  0xe8, 0x00, 0xb4, 0x01, 0xd1, 0x00, 0xba, 0x01, 0x0a, 0x01, 0xbf, 0x01, 0xf9, 0x00, 0xca, 0x01,
+  0xd8, 0x00, 0xd3, 0x01, 0xe4, 0x00, 0xde, 0x01, 0xfe, 0x00, 0xe4, 0x01, 0xf2, 0x00, 0x00, 0x02,
+  0xf3, 0x00, 0x17, 0x02, 0x15, 0x01, 0x32, 0x02, 0x1b, 0x01, 0x39, 0x02, 0xfa, 0x00, 0x4a, 0x02,
+  0xea, 0x00, 0x50, 0x02, 0x11, 0x01, 0x71, 0x02, 0x16, 0x01, 0x9c, 0x02, 0x9f, 0x01, 0xbf, 0x02,
+  0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x1b, 0x00, 0x89, 0x01, 0x53, 0x00, 0x86, 0x00, 0x6a, 0x00,
+  0xbc, 0x00, 0x7f, 0x00, 0x74, 0x00, 0x8f, 0x00, 0x58, 0x00, 0x98, 0x00, 0x9f, 0x00, 0x9a, 0x00,
+  0x94, 0x00, 0xa2, 0x00, 0x8c, 0x00, 0xb3, 0x00, 0x8f, 0x00, 0xb7, 0x00, 0x53, 0x00, 0xb9, 0x00,
+  0x73, 0x00, 0xc5, 0x00, 0x97, 0x00, 0xd9, 0x00, 0x6c, 0x00, 0xde, 0x00, 0x22, 0x01, 0x10, 0x01,
+  0x21, 0x01, 0x31, 0x01, 0x26, 0x01, 0x32, 0x01, 0x23, 0x01, 0x4b, 0x01, 0x14, 0x00, 0x5c, 0x01,
+  0x0d, 0x00, 0x6a, 0x01, 0x03, 0x00, 0x70, 0x01, 0x31, 0x00, 0x93, 0x01, 0x0c, 0x00, 0xae, 0x01,
+  0xe8, 0x00, 0xb5, 0x01, 0xd1, 0x00, 0xb9, 0x01, 0x0a, 0x01, 0xc4, 0x01, 0xf9, 0x00, 0xc9, 0x01,
+  0xd8, 0x00, 0xd2, 0x01, 0x07, 0x01, 0xd3, 0x01, 0xe4, 0x00, 0xdd, 0x01, 0xfe, 0x00, 0xe4, 0x01,
+  0xf2, 0x00, 0x00, 0x02, 0xf3, 0x00, 0x17, 0x02, 0x15, 0x01, 0x31, 0x02, 0x1b, 0x01, 0x39, 0x02,
+  0xfa, 0x00, 0x4a, 0x02, 0xea, 0x00, 0x50, 0x02, 0x11, 0x01, 0x71, 0x02, 0x16, 0x01, 0x98, 0x02,
+  0x9b, 0x01, 0x9c, 0x02, 0x9f, 0x01, 0xc0, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x1b, 0x00,
+  0x89, 0x01, 0x54, 0x00, 0x86, 0x00, 0x68, 0x00, 0xbc, 0x00, 0x7e, 0x00, 0x74, 0x00, 0x8e, 0x00,
+  0x58, 0x00, 0x99, 0x00, 0x94, 0x00, 0xa2, 0x00, 0x8c, 0x00, 0xb2, 0x00, 0x8f, 0x00, 0xb7, 0x00,
+  0x53, 0x00, 0xba, 0x00, 0x73, 0x00, 0xc6, 0x00, 0x97, 0x00, 0xd9, 0x00, 0x6c, 0x00, 0xe0, 0x00,
+  0x22, 0x01, 0x10, 0x01, 0x21, 0x01, 0x30, 0x01, 0x23, 0x01, 0x4a, 0x01, 0x14, 0x00, 0x5e, 0x01,
+  0x0d, 0x00, 0x6a, 0x01, 0x03, 0x00, 0x70, 0x01, 0x31, 0x00, 0x93, 0x01, 0x0c, 0x00, 0xae, 0x01,
+  0xe8, 0x00, 0xb6, 0x01, 0xd1, 0x00, 0xb8, 0x01, 0x0a, 0x01, 0xc8, 0x01, 0xd8, 0x00, 0xd1, 0x01,
+  0x07, 0x01, 0xd3, 0x01, 0xe4, 0x00, 0xdd, 0x01, 0xfe, 0x00, 0xe5, 0x01, 0xf2, 0x00, 0x00, 0x02,
+  0xf3, 0x00, 0x17, 0x02, 0x15, 0x01, 0x2d, 0x02, 0xe2, 0x00, 0x30, 0x02, 0x1b, 0x01, 0x3a, 0x02,
+  0xfa, 0x00, 0x4a, 0x02, 0xea, 0x00, 0x51, 0x02, 0x11, 0x01, 0x72, 0x02, 0x16, 0x01, 0x92, 0x02,
+  0x9b, 0x01, 0x9c, 0x02, 0x9f, 0x01, 0xc1, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x1a, 0x00,
+  0x89, 0x01, 0x54, 0x00, 0x86, 0x00, 0x67, 0x00, 0xbc, 0x00, 0x7d, 0x00, 0x74, 0x00, 0x8e, 0x00,
+  0x58, 0x00, 0x98, 0x00, 0x94, 0x00, 0xa2, 0x00, 0x8c, 0x00, 0xb1, 0x00, 0x8f, 0x00, 0xb7, 0x00,
+  0x53, 0x00, 0xba, 0x00, 0x73, 0x00, 0xc6, 0x00, 0x97, 0x00, 0xd8, 0x00, 0x6c, 0x00, 0xe3, 0x00,
+  0x22, 0x01, 0x07, 0x01, 0x37, 0x00, 0x10, 0x01, 0x21, 0x01, 0x2f, 0x01, 0x23, 0x01, 0x4a, 0x01,
+  0x14, 0x00, 0x5f, 0x01, 0x0d, 0x00, 0x6b, 0x01, 0x03, 0x00, 0x70, 0x01, 0x31, 0x00, 0x92, 0x01,
+  0x0c, 0x00, 0xaf, 0x01, 0xe8, 0x00, 0xb6, 0x01, 0xd1, 0x00, 0xb7, 0x01, 0x0a, 0x01, 0xc8, 0x01,
+  0xd8, 0x00, 0xcf, 0x01, 0x07, 0x01, 0xd3, 0x01, 0xe4, 0x00, 0xdc, 0x01, 0xfe, 0x00, 0xe5, 0x01,
+  0xf2, 0x00, 0x00, 0x02, 0xf3, 0x00, 0x17, 0x02, 0x15, 0x01, 0x25, 0x02, 0xe2, 0x00, 0x2f, 0x02,
+  0x1b, 0x01, 0x3a, 0x02, 0xfa, 0x00, 0x4a, 0x02, 0xea, 0x00, 0x51, 0x02, 0x11, 0x01, 0x73, 0x02,
+  0x16, 0x01, 0x8d, 0x02, 0x9b, 0x01, 0x9c, 0x02, 0x9f, 0x01, 0xc2, 0x02, 0x90, 0x01, 0xd0, 0x02,
+  0x90, 0x01, 0x1a, 0x00, 0x89, 0x01, 0x54, 0x00, 0x86, 0x00, 0x66, 0x00, 0xbc, 0x00, 0x7d, 0x00,
+  0x74, 0x00, 0x8d, 0x00, 0x8d, 0x00, 0x98, 0x00, 0x94, 0x00, 0xa2, 0x00, 0x8c, 0x00, 0xb0, 0x00,
+  0x8f, 0x00, 0xb7, 0x00, 0x53, 0x00, 0xbb, 0x00, 0x73, 0x00, 0xc7, 0x00, 0x97, 0x00, 0xd7, 0x00,
+  0x6c, 0x00, 0xe5, 0x00, 0x22, 0x01, 0xf6, 0x00, 0x36, 0x00, 0xfd, 0x00, 0x37, 0x00, 0x11, 0x01,
+  0x21, 0x01, 0x2b, 0x01, 0x24, 0x01, 0x2f, 0x01, 0x23, 0x01, 0x49, 0x01, 0x14, 0x00, 0x60, 0x01,
+  0x0d, 0x00, 0x6b, 0x01, 0x03, 0x00, 0x6f, 0x01, 0x31, 0x00, 0x92, 0x01, 0x0c, 0x00, 0xaf, 0x01,
+  0xe8, 0x00, 0xb7, 0x01, 0x0a, 0x01, 0xc9, 0x01, 0xd8, 0x00, 0xce, 0x01, 0x07, 0x01, 0xd3, 0x01,
+  0xe4, 0x00, 0xdc, 0x01, 0xfe, 0x00, 0xe5, 0x01, 0xf2, 0x00, 0x00, 0x02, 0xf3, 0x00, 0x17, 0x02,
+  0x15, 0x01, 0x1e, 0x02, 0xe2, 0x00, 0x2f, 0x02, 0x1b, 0x01, 0x3b, 0x02, 0xfa, 0x00, 0x4b, 0x02,
+  0xea, 0x00, 0x52, 0x02, 0x11, 0x01, 0x74, 0x02, 0x16, 0x01, 0x89, 0x02, 0x9b, 0x01, 0x9c, 0x02,
+  0x9f, 0x01, 0xc2, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x19, 0x00, 0x89, 0x01, 0x55, 0x00,
+  0x86, 0x00, 0x64, 0x00, 0xbc, 0x00, 0x7c, 0x00, 0x74, 0x00, 0x8c, 0x00, 0x8d, 0x00, 0x98, 0x00,
+  0x94, 0x00, 0xa2, 0x00, 0x8c, 0x00, 0xb0, 0x00, 0x8f, 0x00, 0xb7, 0x00, 0x53, 0x00, 0xbb, 0x00,
+  0x73, 0x00, 0xc7, 0x00, 0x97, 0x00, 0xd6, 0x00, 0x6c, 0x00, 0xe6, 0x00, 0xbe, 0x00, 0xeb, 0x00,
+  0x36, 0x00, 0xfc, 0x00, 0x37, 0x00, 0x12, 0x01, 0x21, 0x01, 0x23, 0x01, 0x24, 0x01, 0x32, 0x01,
+  0x23, 0x01, 0x49, 0x01, 0x14, 0x00, 0x62, 0x01, 0x0d, 0x00, 0x6b, 0x01, 0x03, 0x00, 0x6f, 0x01,
+  0x31, 0x00, 0x92, 0x01, 0x0c, 0x00, 0xb0, 0x01, 0xe8, 0x00, 0xb6, 0x01, 0x0a, 0x01, 0xca, 0x01,
+  0xd8, 0x00, 0xcc, 0x01, 0x07, 0x01, 0xd3, 0x01, 0xe4, 0x00, 0xdb, 0x01, 0xfe, 0x00, 0xe5, 0x01,
+  0xf2, 0x00, 0x01, 0x02, 0xf3, 0x00, 0x16, 0x02, 0xf5, 0x00, 0x18, 0x02, 0xe2, 0x00, 0x2e, 0x02,
+  0x1b, 0x01, 0x3b, 0x02, 0xfa, 0x00, 0x4b, 0x02, 0xea, 0x00, 0x52, 0x02, 0x11, 0x01, 0x74, 0x02,
+  0x16, 0x01, 0x84, 0x02, 0x9b, 0x01, 0x9d, 0x02, 0x9f, 0x01, 0xc3, 0x02, 0x90, 0x01, 0xd0, 0x02,
+  0x90, 0x01, 0x19, 0x00, 0x89, 0x01, 0x55, 0x00, 0x86, 0x00, 0x63, 0x00, 0xbc, 0x00, 0x7b, 0x00,
+  0x74, 0x00, 0x8a, 0x00, 0x8d, 0x00, 0x99, 0x00, 0x94, 0x00, 0xa2, 0x00, 0x8c, 0x00, 0xaf, 0x00,
+  0x8f, 0x00, 0xb7, 0x00, 0x53, 0x00, 0xbc, 0x00, 0x73, 0x00, 0xc8, 0x00, 0x97, 0x00, 0xd6, 0x00,
+  0x6c, 0x00, 0xe5, 0x00, 0xbe, 0x00, 0xeb, 0x00, 0x36, 0x00, 0xfa, 0x00, 0x37, 0x00, 0x13, 0x01,
+  0x21, 0x01, 0x1d, 0x01, 0x24, 0x01, 0x34, 0x01, 0x23, 0x01, 0x48, 0x01, 0x14, 0x00, 0x63, 0x01,
+  0x0d, 0x00, 0x69, 0x01, 0x2c, 0x00, 0x70, 0x01, 0x31, 0x00, 0x92, 0x01, 0x0c, 0x00, 0xb0, 0x01,
+  0xe8, 0x00, 0xb5, 0x01, 0x0a, 0x01, 0xca, 0x01, 0xd8, 0x00, 0xcb, 0x01, 0x07, 0x01, 0xd3, 0x01,
+  0xe4, 0x00, 0xda, 0x01, 0xfe, 0x00, 0xe5, 0x01, 0xf2, 0x00, 0x01, 0x02, 0xf3, 0x00, 0x14, 0x02,
+  0xf5, 0x00, 0x19, 0x02, 0xe2, 0x00, 0x2e, 0x02, 0x1b, 0x01, 0x3c, 0x02, 0xfa, 0x00, 0x4b, 0x02,
+  0xea, 0x00, 0x53, 0x02, 0x11, 0x01, 0x75, 0x02, 0x16, 0x01, 0x80, 0x02, 0x9b, 0x01, 0x9d, 0x02,
+  0x9f, 0x01, 0xc4, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x19, 0x00, 0x89, 0x01, 0x56, 0x00,
+  0x86, 0x00, 0x62, 0x00, 0xbc, 0x00, 0x7b, 0x00, 0x74, 0x00, 0x89, 0x00, 0x8d, 0x00, 0x99, 0x00,
+  0x94, 0x00, 0xa2, 0x00, 0x8c, 0x00, 0xae, 0x00, 0x8f, 0x00, 0xb7, 0x00, 0x53, 0x00, 0xbc, 0x00,
+  0x73, 0x00, 0xc8, 0x00, 0x97, 0x00, 0xd5, 0x00, 0x6c, 0x00, 0xe5, 0x00, 0xbe, 0x00, 0xeb, 0x00,
+  0x36, 0x00, 0xf9, 0x00, 0x37, 0x00, 0x13, 0x01, 0x21, 0x01, 0x17, 0x01, 0x24, 0x01, 0x36, 0x01,
+  0x23, 0x01, 0x48, 0x01, 0x14, 0x00, 0x64, 0x01, 0x0d, 0x00, 0x66, 0x01, 0x2c, 0x00, 0x72, 0x01,
+  0x31, 0x00, 0x92, 0x01, 0x0c, 0x00, 0xb1, 0x01, 0xe8, 0x00, 0xb4, 0x01, 0x0a, 0x01, 0xca, 0x01,
+  0x07, 0x01, 0xd3, 0x01, 0xe4, 0x00, 0xda, 0x01, 0xfe, 0x00, 0xe6, 0x01, 0xf2, 0x00, 0x01, 0x02,
+  0xf3, 0x00, 0x12, 0x02, 0xf5, 0x00, 0x19, 0x02, 0xe2, 0x00, 0x2d, 0x02, 0x1b, 0x01, 0x3c, 0x02,
+  0xfa, 0x00, 0x4b, 0x02, 0xea, 0x00, 0x53, 0x02, 0x11, 0x01, 0x76, 0x02, 0x16, 0x01, 0x7c, 0x02,
+  0x9b, 0x01, 0x9d, 0x02, 0x9f, 0x01, 0xc4, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x18, 0x00,
+  0x89, 0x01, 0x56, 0x00, 0x86, 0x00, 0x61, 0x00, 0xbc, 0x00, 0x7a, 0x00, 0x74, 0x00, 0x87, 0x00,
+  0x8d, 0x00, 0x9a, 0x00, 0x94, 0x00, 0xa2, 0x00, 0x8c, 0x00, 0xad, 0x00, 0x8f, 0x00, 0xb7, 0x00,
+  0x53, 0x00, 0xbd, 0x00, 0x73, 0x00, 0xc9, 0x00, 0x97, 0x00, 0xd4, 0x00, 0x6c, 0x00, 0xe4, 0x00,
+  0xa6, 0x00, 0xe5, 0x00, 0xbe, 0x00, 0xea, 0x00, 0x36, 0x00, 0xf8, 0x00, 0x37, 0x00, 0x14, 0x01,
+  0x24, 0x01, 0x38, 0x01, 0x23, 0x01, 0x47, 0x01, 0x14, 0x00, 0x64, 0x01, 0x2c, 0x00, 0x75, 0x01,
+  0x31, 0x00, 0x91, 0x01, 0x0c, 0x00, 0xb1, 0x01, 0xe8, 0x00, 0xb4, 0x01, 0x0a, 0x01, 0xcb, 0x01,
+  0x07, 0x01, 0xd3, 0x01, 0xe4, 0x00, 0xd9, 0x01, 0xfe, 0x00, 0xe6, 0x01, 0xf2, 0x00, 0x01, 0x02,
+  0xf3, 0x00, 0x10, 0x02, 0xf5, 0x00, 0x1a, 0x02, 0xe2, 0x00, 0x2c, 0x02, 0x1b, 0x01, 0x3d, 0x02,
+  0xfa, 0x00, 0x4b, 0x02, 0xea, 0x00, 0x54, 0x02, 0x11, 0x01, 0x76, 0x02, 0x16, 0x01, 0x79, 0x02,
+  0x9b, 0x01, 0x9d, 0x02, 0x9f, 0x01, 0xc5, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x18, 0x00,
+  0x89, 0x01, 0x56, 0x00, 0x86, 0x00, 0x5f, 0x00, 0xbc, 0x00, 0x79, 0x00, 0x74, 0x00, 0x86, 0x00,
+  0x8d, 0x00, 0x9a, 0x00, 0x94, 0x00, 0xa3, 0x00, 0x8c, 0x00, 0xad, 0x00, 0x8f, 0x00, 0xb7, 0x00,
+  0x53, 0x00, 0xbe, 0x00, 0x73, 0x00, 0xc9, 0x00, 0x97, 0x00, 0xd4, 0x00, 0x6c, 0x00, 0xe3, 0x00,
+  0xa6, 0x00, 0xe5, 0x00, 0xbe, 0x00, 0xea, 0x00, 0x36, 0x00, 0xf7, 0x00, 0x37, 0x00, 0x13, 0x01,
+  0x4a, 0x00, 0x14, 0x01, 0x24, 0x01, 0x3a, 0x01, 0x2d, 0x00, 0x3f, 0x01, 0x23, 0x01, 0x47, 0x01,
+  0x14, 0x00, 0x63, 0x01, 0x2c, 0x00, 0x77, 0x01, 0x31, 0x00, 0x91, 0x01, 0x0c, 0x00, 0xb1, 0x01,
+  0x04, 0x00, 0xb4, 0x01, 0x0a, 0x01, 0xcb, 0x01, 0x07, 0x01, 0xd3, 0x01, 0xe4, 0x00, 0xd8, 0x01,
+  0xfe, 0x00, 0xe6, 0x01, 0xf2, 0x00, 0x01, 0x02, 0xf3, 0x00, 0x0e, 0x02, 0xf5, 0x00, 0x1b, 0x02,
+  0xe2, 0x00, 0x2b, 0x02, 0x1e, 0x01, 0x2c, 0x02, 0x1b, 0x01, 0x3d, 0x02, 0xfa, 0x00, 0x4b, 0x02,
+  0xea, 0x00, 0x54, 0x02, 0x11, 0x01, 0x77, 0x02, 0x9b, 0x01, 0x9e, 0x02, 0x9f, 0x01, 0xc6, 0x02,
+  0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x17, 0x00, 0x89, 0x01, 0x57, 0x00, 0x86, 0x00, 0x5e, 0x00,
+  0xbc, 0x00, 0x79, 0x00, 0x74, 0x00, 0x84, 0x00, 0x8d, 0x00, 0x98, 0x00, 0x49, 0x00, 0x9c, 0x00,
+  0x94, 0x00, 0xa3, 0x00, 0x8c, 0x00, 0xac, 0x00, 0x8f, 0x00, 0xb7, 0x00, 0x53, 0x00, 0xbe, 0x00,
+  0x73, 0x00, 0xca, 0x00, 0x97, 0x00, 0xd3, 0x00, 0x6c, 0x00, 0xe3, 0x00, 0xa6, 0x00, 0xe5, 0x00,
+  0xbe, 0x00, 0xea, 0x00, 0x36, 0x00, 0xf6, 0x00, 0x37, 0x00, 0x11, 0x01, 0x4a, 0x00, 0x14, 0x01,
+  0x24, 0x01, 0x3b, 0x01, 0x2d, 0x00, 0x4a, 0x01, 0x14, 0x00, 0x62, 0x01, 0x2c, 0x00, 0x79, 0x01,
+  0x31, 0x00, 0x8c, 0x01, 0x2b, 0x00, 0x91, 0x01, 0x0c, 0x00, 0xa6, 0x01, 0x1b, 0x00, 0xb0, 0x01,
+  0x04, 0x00, 0xb6, 0x01, 0x0a, 0x01, 0xcb, 0x01, 0x07, 0x01, 0xd3, 0x01, 0xe4, 0x00, 0xd8, 0x01,
+  0xfe, 0x00, 0xe6, 0x01, 0xf2, 0x00, 0x02, 0x02, 0xf3, 0x00, 0x0c, 0x02, 0xf5, 0x00, 0x1b, 0x02,
+  0xe2, 0x00, 0x2a, 0x02, 0x1e, 0x01, 0x2d, 0x02, 0x1b, 0x01, 0x3e, 0x02, 0xfa, 0x00, 0x4c, 0x02,
+  0xea, 0x00, 0x54, 0x02, 0x11, 0x01, 0x76, 0x02, 0x9b, 0x01, 0x9e, 0x02, 0x9f, 0x01, 0xc6, 0x02,
+  0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x17, 0x00, 0x89, 0x01, 0x57, 0x00, 0x86, 0x00, 0x5d, 0x00,
+  0xbc, 0x00, 0x78, 0x00, 0x74, 0x00, 0x83, 0x00, 0x8d, 0x00, 0x96, 0x00, 0x49, 0x00, 0x9d, 0x00,
+  0x91, 0x00, 0xa7, 0x00, 0x8c, 0x00, 0xab, 0x00, 0x8f, 0x00, 0xb8, 0x00, 0x53, 0x00, 0xbf, 0x00,
+  0x73, 0x00, 0xca, 0x00, 0x97, 0x00, 0xd2, 0x00, 0x6c, 0x00, 0xe2, 0x00, 0xa6, 0x00, 0xe5, 0x00,
+  0xbe, 0x00, 0xea, 0x00, 0x36, 0x00, 0xf5, 0x00, 0x37, 0x00, 0x0e, 0x01, 0x4a, 0x00, 0x14, 0x01,
+  0x24, 0x01, 0x3b, 0x01, 0x2d, 0x00, 0x4e, 0x01, 0x14, 0x00, 0x61, 0x01, 0x2e, 0x00, 0x62, 0x01,
+  0x2c, 0x00, 0x7b, 0x01, 0x31, 0x00, 0x7e, 0x01, 0x2b, 0x00, 0x93, 0x01, 0x0c, 0x00, 0x9c, 0x01,
+  0x1b, 0x00, 0xb0, 0x01, 0x04, 0x00, 0xb7, 0x01, 0x0a, 0x01, 0xcb, 0x01, 0x07, 0x01, 0xd3, 0x01,
+  0xe4, 0x00, 0xd7, 0x01, 0xfe, 0x00, 0xe6, 0x01, 0xf2, 0x00, 0x02, 0x02, 0xf3, 0x00, 0x0a, 0x02,
+  0xf5, 0x00, 0x1c, 0x02, 0xe2, 0x00, 0x28, 0x02, 0x1e, 0x01, 0x2d, 0x02, 0x1b, 0x01, 0x3e, 0x02,
+  0xfa, 0x00, 0x4c, 0x02, 0xea, 0x00, 0x55, 0x02, 0x11, 0x01, 0x76, 0x02, 0x9b, 0x01, 0x9e, 0x02,
+  0x9f, 0x01, 0xc7, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x17, 0x00, 0x89, 0x01, 0x57, 0x00,
+  0x86, 0x00, 0x5c, 0x00, 0xbc, 0x00, 0x77, 0x00, 0x74, 0x00, 0x82, 0x00, 0x8d, 0x00, 0x93, 0x00,
+  0x49, 0x00, 0x9c, 0x00, 0x91, 0x00, 0xab, 0x00, 0x8f, 0x00, 0xb8, 0x00, 0x53, 0x00, 0xbf, 0x00,
+  0x73, 0x00, 0xc9, 0x00, 0x56, 0x00, 0xcb, 0x00, 0x97, 0x00, 0xd1, 0x00, 0x6c, 0x00, 0xe1, 0x00,
+  0xa6, 0x00, 0xe5, 0x00, 0xbe, 0x00, 0xea, 0x00, 0x36, 0x00, 0xf4, 0x00, 0x37, 0x00, 0x0c, 0x01,
+  0x4a, 0x00, 0x14, 0x01, 0x24, 0x01, 0x3c, 0x01, 0x2d, 0x00, 0x51, 0x01, 0x14, 0x00, 0x5f, 0x01,
+  0x2e, 0x00, 0x62, 0x01, 0x2c, 0x00, 0x7b, 0x01, 0x2b, 0x00, 0x94, 0x01, 0x1b, 0x00, 0xb0, 0x01,
+  0x04, 0x00, 0xb9, 0x01, 0x0a, 0x01, 0xcb, 0x01, 0x07, 0x01, 0xd3, 0x01, 0xe4, 0x00, 0xd7, 0x01,
+  0xfe, 0x00, 0xe6, 0x01, 0xf2, 0x00, 0x02, 0x02, 0xf3, 0x00, 0x09, 0x02, 0xf5, 0x00, 0x1d, 0x02,
+  0xe2, 0x00, 0x27, 0x02, 0x1e, 0x01, 0x2d, 0x02, 0x1b, 0x01, 0x3f, 0x02, 0xfa, 0x00, 0x4c, 0x02,
+  0xea, 0x00, 0x55, 0x02, 0x11, 0x01, 0x75, 0x02, 0x9b, 0x01, 0x9e, 0x02, 0x9f, 0x01, 0xc8, 0x02,
+  0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x16, 0x00, 0x89, 0x01, 0x58, 0x00, 0x86, 0x00, 0x5a, 0x00,
+  0xbc, 0x00, 0x77, 0x00, 0x74, 0x00, 0x80, 0x00, 0x8d, 0x00, 0x91, 0x00, 0x49, 0x00, 0x9c, 0x00,
+  0x91, 0x00, 0xab, 0x00, 0x8f, 0x00, 0xb8, 0x00, 0x53, 0x00, 0xc0, 0x00, 0x73, 0x00, 0xc5, 0x00,
+  0x56, 0x00, 0xcc, 0x00, 0x7f, 0x00, 0xd2, 0x00, 0x6c, 0x00, 0xe1, 0x00, 0xa6, 0x00, 0xe5, 0x00,
+  0xbe, 0x00, 0xe9, 0x00, 0x36, 0x00, 0xf3, 0x00, 0x37, 0x00, 0x09, 0x01, 0x4a, 0x00, 0x14, 0x01,
+  0x24, 0x01, 0x3c, 0x01, 0x2d, 0x00, 0x55, 0x01, 0x14, 0x00, 0x5c, 0x01, 0x05, 0x00, 0x5f, 0x01,
+  0x2e, 0x00, 0x63, 0x01, 0x2c, 0x00, 0x7b, 0x01, 0x2b, 0x00, 0x94, 0x01, 0x1b, 0x00, 0xb0, 0x01,
+  0x04, 0x00, 0xba, 0x01, 0x0a, 0x01, 0xcb, 0x01, 0x07, 0x01, 0xd3, 0x01, 0xe4, 0x00, 0xd6, 0x01,
+  0xfe, 0x00, 0xe7, 0x01, 0xf2, 0x00, 0x02, 0x02, 0xf3, 0x00, 0x07, 0x02, 0xf5, 0x00, 0x1d, 0x02,
+  0xe2, 0x00, 0x25, 0x02, 0x1e, 0x01, 0x2d, 0x02, 0x1b, 0x01, 0x3f, 0x02, 0xfa, 0x00, 0x4c, 0x02,
+  0xea, 0x00, 0x56, 0x02, 0x11, 0x01, 0x75, 0x02, 0x9b, 0x01, 0x9e, 0x02, 0x9f, 0x01, 0xc8, 0x02,
+  0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x16, 0x00, 0x89, 0x01, 0x58, 0x00, 0x86, 0x00, 0x59, 0x00,
+  0xbc, 0x00, 0x76, 0x00, 0x74, 0x00, 0x7f, 0x00, 0x8d, 0x00, 0x8e, 0x00, 0x49, 0x00, 0x9c, 0x00,
+  0x91, 0x00, 0xab, 0x00, 0x8f, 0x00, 0xb8, 0x00, 0x53, 0x00, 0xc0, 0x00, 0x56, 0x00, 0xcb, 0x00,
+  0x7f, 0x00, 0xd2, 0x00, 0xa3, 0x00, 0xd4, 0x00, 0x6c, 0x00, 0xdf, 0x00, 0xaf, 0x00, 0xe0, 0x00,
+  0xa6, 0x00, 0xe5, 0x00, 0xbe, 0x00, 0xe9, 0x00, 0x36, 0x00, 0xf2, 0x00, 0x37, 0x00, 0x07, 0x01,
+  0x4a, 0x00, 0x14, 0x01, 0x24, 0x01, 0x3d, 0x01, 0x2d, 0x00, 0x58, 0x01, 0x05, 0x00, 0x5f, 0x01,
+  0x2e, 0x00, 0x63, 0x01, 0x2c, 0x00, 0x7b, 0x01, 0x2b, 0x00, 0x94, 0x01, 0x1b, 0x00, 0xb0, 0x01,
+  0x04, 0x00, 0xbb, 0x01, 0x0a, 0x01, 0xcc, 0x01, 0x07, 0x01, 0xd3, 0x01, 0xe4, 0x00, 0xd5, 0x01,
+  0xfe, 0x00, 0xe7, 0x01, 0xf2, 0x00, 0x02, 0x02, 0xf3, 0x00, 0x05, 0x02, 0xf5, 0x00, 0x1e, 0x02,
+  0xe2, 0x00, 0x24, 0x02, 0x1e, 0x01, 0x2d, 0x02, 0x1b, 0x01, 0x3f, 0x02, 0xfa, 0x00, 0x4c, 0x02,
+  0xea, 0x00, 0x56, 0x02, 0x11, 0x01, 0x74, 0x02, 0x9b, 0x01, 0x9f, 0x02, 0x9f, 0x01, 0xc9, 0x02,
+  0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x15, 0x00, 0x89, 0x01, 0x59, 0x00, 0xbc, 0x00, 0x75, 0x00,
+  0x74, 0x00, 0x7d, 0x00, 0x8d, 0x00, 0x8c, 0x00, 0x49, 0x00, 0x9c, 0x00, 0x91, 0x00, 0xab, 0x00,
+  0x8f, 0x00, 0xb8, 0x00, 0x53, 0x00, 0xc0, 0x00, 0x56, 0x00, 0xcb, 0x00, 0x7f, 0x00, 0xd2, 0x00,
+  0xa3, 0x00, 0xd7, 0x00, 0x6c, 0x00, 0xdd, 0x00, 0xaf, 0x00, 0xe0, 0x00, 0xa6, 0x00, 0xe5, 0x00,
+  0xbe, 0x00, 0xe9, 0x00, 0x36, 0x00, 0xf1, 0x00, 0x37, 0x00, 0x04, 0x01, 0x4a, 0x00, 0x14, 0x01,
+  0x24, 0x01, 0x3d, 0x01, 0x2d, 0x00, 0x58, 0x01, 0x05, 0x00, 0x5f, 0x01, 0x2e, 0x00, 0x64, 0x01,
+  0x2c, 0x00, 0x7b, 0x01, 0x2b, 0x00, 0x95, 0x01, 0x1b, 0x00, 0xb0, 0x01, 0x04, 0x00, 0xbd, 0x01,
+  0x0a, 0x01, 0xcc, 0x01, 0x07, 0x01, 0xd3, 0x01, 0xe4, 0x00, 0xd5, 0x01, 0xfe, 0x00, 0xe7, 0x01,
+  0xf2, 0x00, 0x02, 0x02, 0xf3, 0x00, 0x03, 0x02, 0xf5, 0x00, 0x1f, 0x02, 0xe2, 0x00, 0x23, 0x02,
+  0x1e, 0x01, 0x2e, 0x02, 0x1b, 0x01, 0x40, 0x02, 0xfa, 0x00, 0x4c, 0x02, 0xea, 0x00, 0x57, 0x02,
+  0x11, 0x01, 0x74, 0x02, 0x9b, 0x01, 0x9f, 0x02, 0x9f, 0x01, 0xca, 0x02, 0x90, 0x01, 0xd0, 0x02,
+  0x90, 0x01, 0x15, 0x00, 0x89, 0x01, 0x59, 0x00, 0xbc, 0x00, 0x75, 0x00, 0x74, 0x00, 0x7c, 0x00,
+  0x8d, 0x00, 0x8a, 0x00, 0x49, 0x00, 0x9b, 0x00, 0x91, 0x00, 0xab, 0x00, 0x8f, 0x00, 0xb8, 0x00,
+  0x53, 0x00, 0xc0, 0x00, 0x56, 0x00, 0xcb, 0x00, 0x7f, 0x00, 0xd2, 0x00, 0xa3, 0x00, 0xda, 0x00,
+  0xaf, 0x00, 0xe0, 0x00, 0xa6, 0x00, 0xe5, 0x00, 0xbe, 0x00, 0xe9, 0x00, 0x36, 0x00, 0xef, 0x00,
+  0x37, 0x00, 0x02, 0x01, 0x4a, 0x00, 0x13, 0x01, 0x55, 0x00, 0x15, 0x01, 0x24, 0x01, 0x3d, 0x01,
+  0x2d, 0x00, 0x57, 0x01, 0x05, 0x00, 0x5f, 0x01, 0x2e, 0x00, 0x64, 0x01, 0x2c, 0x00, 0x7b, 0x01,
+  0x2b, 0x00, 0x95, 0x01, 0x1b, 0x00, 0xb0, 0x01, 0x04, 0x00, 0xbe, 0x01, 0x0a, 0x01, 0xcc, 0x01,
+  0x07, 0x01, 0xd3, 0x01, 0xe4, 0x00, 0xd4, 0x01, 0xfe, 0x00, 0xe7, 0x01, 0xf2, 0x00, 0x03, 0x02,
+  0xf5, 0x00, 0x1f, 0x02, 0xe2, 0x00, 0x21, 0x02, 0x1e, 0x01, 0x2e, 0x02, 0x1b, 0x01, 0x40, 0x02,
+  0xfa, 0x00, 0x4d, 0x02, 0xea, 0x00, 0x57, 0x02, 0xfd, 0x00, 0x5d, 0x02, 0x11, 0x01, 0x73, 0x02,
+  0x88, 0x01, 0x75, 0x02, 0x9b, 0x01, 0x9f, 0x02, 0x9f, 0x01, 0xca, 0x02, 0x90, 0x01, 0xd0, 0x02,
+  0x90, 0x01, 0x14, 0x00, 0x89, 0x01, 0x59, 0x00, 0xbc, 0x00, 0x74, 0x00, 0x74, 0x00, 0x7b, 0x00,
+  0x8d, 0x00, 0x88, 0x00, 0x49, 0x00, 0x9b, 0x00, 0x91, 0x00, 0xac, 0x00, 0x8f, 0x00, 0xb6, 0x00,
+  0x4c, 0x00, 0xb9, 0x00, 0x53, 0x00, 0xbf, 0x00, 0x56, 0x00, 0xca, 0x00, 0x7f, 0x00, 0xd3, 0x00,
+  0xa3, 0x00, 0xda, 0x00, 0xaf, 0x00, 0xe0, 0x00, 0xa6, 0x00, 0xe5, 0x00, 0xb7, 0x00, 0xe6, 0x00,
+  0xbe, 0x00, 0xe9, 0x00, 0x36, 0x00, 0xee, 0x00, 0xb3, 0x00, 0xef, 0x00, 0x37, 0x00, 0x00, 0x01,
+  0x4a, 0x00, 0x11, 0x01, 0x55, 0x00, 0x15, 0x01, 0x24, 0x01, 0x3e, 0x01, 0x2d, 0x00, 0x56, 0x01,
+  0x05, 0x00, 0x5f, 0x01, 0x2e, 0x00, 0x64, 0x01, 0x2c, 0x00, 0x7b, 0x01, 0x2b, 0x00, 0x95, 0x01,
+  0x1b, 0x00, 0xb0, 0x01, 0x04, 0x00, 0xbf, 0x01, 0x0a, 0x01, 0xcc, 0x01, 0x07, 0x01, 0xd3, 0x01,
+  0xe4, 0x00, 0xd4, 0x01, 0xfe, 0x00, 0xe7, 0x01, 0xf2, 0x00, 0x02, 0x02, 0xf5, 0x00, 0x20, 0x02,
+  0x1e, 0x01, 0x2e, 0x02, 0x1b, 0x01, 0x41, 0x02, 0xfa, 0x00, 0x4d, 0x02, 0xea, 0x00, 0x55, 0x02,
+  0xfd, 0x00, 0x6b, 0x02, 0x11, 0x01, 0x72, 0x02, 0x96, 0x01, 0x74, 0x02, 0x88, 0x01, 0x77, 0x02,
+  0x9b, 0x01, 0x9f, 0x02, 0x9f, 0x01, 0xcb, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x14, 0x00,
+  0x89, 0x01, 0x5a, 0x00, 0xbc, 0x00, 0x74, 0x00, 0x74, 0x00, 0x79, 0x00, 0x8d, 0x00, 0x86, 0x00,
+  0x49, 0x00, 0x9b, 0x00, 0x91, 0x00, 0xac, 0x00, 0x8f, 0x00, 0xb4, 0x00, 0x4c, 0x00, 0xbc, 0x00,
+  0x53, 0x00, 0xbf, 0x00, 0x56, 0x00, 0xca, 0x00, 0x7f, 0x00, 0xd3, 0x00, 0xa3, 0x00, 0xda, 0x00,
+  0xaf, 0x00, 0xe0, 0x00, 0xa6, 0x00, 0xe5, 0x00, 0xb7, 0x00, 0xe6, 0x00, 0xbe, 0x00, 0xe8, 0x00,
+  0x36, 0x00, 0xec, 0x00, 0xb3, 0x00, 0xee, 0x00, 0x37, 0x00, 0xfc, 0x00, 0x6e, 0x00, 0xfe, 0x00,
+  0x4a, 0x00, 0x10, 0x01, 0x55, 0x00, 0x15, 0x01, 0x24, 0x01, 0x3e, 0x01, 0x2d, 0x00, 0x55, 0x01,
+  0x05, 0x00, 0x5f, 0x01, 0x2e, 0x00, 0x65, 0x01, 0x2c, 0x00, 0x7b, 0x01, 0x2b, 0x00, 0x95, 0x01,
+  0x1b, 0x00, 0xb0, 0x01, 0x04, 0x00, 0xc0, 0x01, 0xcf, 0x00, 0xc3, 0x01, 0x0a, 0x01, 0xcc, 0x01,
+  0x07, 0x01, 0xd3, 0x01, 0xfe, 0x00, 0xe8, 0x01, 0xf2, 0x00, 0x02, 0x02, 0xf5, 0x00, 0x1f, 0x02,
+  0x1e, 0x01, 0x2e, 0x02, 0x1b, 0x01, 0x41, 0x02, 0xfa, 0x00, 0x4d, 0x02, 0xea, 0x00, 0x54, 0x02,
+  0xfd, 0x00, 0x71, 0x02, 0x96, 0x01, 0x74, 0x02, 0x88, 0x01, 0x79, 0x02, 0x9b, 0x01, 0xa0, 0x02,
+  0x9f, 0x01, 0xcb, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x14, 0x00, 0x89, 0x01, 0x5a, 0x00,
+  0xbc, 0x00, 0x73, 0x00, 0x74, 0x00, 0x78, 0x00, 0x8d, 0x00, 0x84, 0x00, 0x49, 0x00, 0x9b, 0x00,
+  0x91, 0x00, 0xac, 0x00, 0x8f, 0x00, 0xb1, 0x00, 0x4c, 0x00, 0xbe, 0x00, 0x56, 0x00, 0xca, 0x00,
+  0x7f, 0x00, 0xd3, 0x00, 0xa3, 0x00, 0xda, 0x00, 0xaf, 0x00, 0xe0, 0x00, 0xa6, 0x00, 0xe5, 0x00,
+  0xb7, 0x00, 0xe7, 0x00, 0xbe, 0x00, 0xe8, 0x00, 0x36, 0x00, 0xeb, 0x00, 0xb3, 0x00, 0xed, 0x00,
+  0x37, 0x00, 0xf8, 0x00, 0x6e, 0x00, 0xfc, 0x00, 0x4a, 0x00, 0x0f, 0x01, 0x55, 0x00, 0x16, 0x01,
+  0x24, 0x01, 0x3f, 0x01, 0x2d, 0x00, 0x54, 0x01, 0x05, 0x00, 0x5f, 0x01, 0x2e, 0x00, 0x65, 0x01,
+  0x2c, 0x00, 0x7a, 0x01, 0x2b, 0x00, 0x96, 0x01, 0x1b, 0x00, 0xb0, 0x01, 0x04, 0x00, 0xc0, 0x01,
+  0xcf, 0x00, 0xcb, 0x01, 0x0a, 0x01, 0xcc, 0x01, 0x07, 0x01, 0xd3, 0x01, 0xfe, 0x00, 0xe8, 0x01,
+  0xf2, 0x00, 0x02, 0x02, 0xf5, 0x00, 0x1e, 0x02, 0x1e, 0x01, 0x2e, 0x02, 0x1b, 0x01, 0x42, 0x02,
+  0xfa, 0x00, 0x4d, 0x02, 0xea, 0x00, 0x53, 0x02, 0xfd, 0x00, 0x70, 0x02, 0x96, 0x01, 0x75, 0x02,
+  0x88, 0x01, 0x7b, 0x02, 0x9b, 0x01, 0xa0, 0x02, 0x9f, 0x01, 0xcc, 0x02, 0x90, 0x01, 0xd0, 0x02,
+  0x90, 0x01, 0x13, 0x00, 0x89, 0x01, 0x5a, 0x00, 0xbc, 0x00, 0x72, 0x00, 0x74, 0x00, 0x77, 0x00,
+  0x8d, 0x00, 0x82, 0x00, 0x49, 0x00, 0x9a, 0x00, 0x91, 0x00, 0xab, 0x00, 0x6f, 0x00, 0xb1, 0x00,
+  0x4c, 0x00, 0xbf, 0x00, 0x56, 0x00, 0xc9, 0x00, 0x7f, 0x00, 0xd3, 0x00, 0xa3, 0x00, 0xda, 0x00,
+  0xaf, 0x00, 0xe0, 0x00, 0xa6, 0x00, 0xe5, 0x00, 0xb7, 0x00, 0xe7, 0x00, 0xbe, 0x00, 0xe8, 0x00,
+  0x8a, 0x00, 0xea, 0x00, 0xb3, 0x00, 0xec, 0x00, 0x37, 0x00, 0xf4, 0x00, 0x6e, 0x00, 0xfa, 0x00,
+  0x4a, 0x00, 0x0d, 0x01, 0x55, 0x00, 0x16, 0x01, 0x24, 0x01, 0x3f, 0x01, 0x10, 0x00, 0x40, 0x01,
+  0x2d, 0x00, 0x54, 0x01, 0x05, 0x00, 0x5f, 0x01, 0x2e, 0x00, 0x65, 0x01, 0x2c, 0x00, 0x7a, 0x01,
+  0x2b, 0x00, 0x96, 0x01, 0x1b, 0x00, 0xb0, 0x01, 0x04, 0x00, 0xbf, 0x01, 0xcf, 0x00, 0xce, 0x01,
+  0x07, 0x01, 0xd2, 0x01, 0xfe, 0x00, 0xe8, 0x01, 0xf2, 0x00, 0x01, 0x02, 0xe0, 0x00, 0x04, 0x02,
+  0xf5, 0x00, 0x1d, 0x02, 0x1e, 0x01, 0x2f, 0x02, 0x1b, 0x01, 0x42, 0x02, 0xfa, 0x00, 0x4d, 0x02,
+  0xea, 0x00, 0x51, 0x02, 0xfd, 0x00, 0x6f, 0x02, 0x96, 0x01, 0x76, 0x02, 0x88, 0x01, 0x7d, 0x02,
+  0x9b, 0x01, 0xa0, 0x02, 0x9f, 0x01, 0xcd, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x13, 0x00,
+  0x89, 0x01, 0x5a, 0x00, 0xbc, 0x00, 0x72, 0x00, 0x74, 0x00, 0x76, 0x00, 0x8d, 0x00, 0x80, 0x00,
+  0x49, 0x00, 0x9a, 0x00, 0x91, 0x00, 0xab, 0x00, 0x6f, 0x00, 0xb2, 0x00, 0x4c, 0x00, 0xbf, 0x00,
+  0x56, 0x00, 0xc9, 0x00, 0x7f, 0x00, 0xd3, 0x00, 0xa3, 0x00, 0xda, 0x00, 0xaf, 0x00, 0xe0, 0x00,
+  0xa6, 0x00, 0xe5, 0x00, 0xb7, 0x00, 0xe7, 0x00, 0xbe, 0x00, 0xe8, 0x00, 0xb5, 0x00, 0xec, 0x00,
+  0x37, 0x00, 0xf1, 0x00, 0x6e, 0x00, 0xf8, 0x00, 0x4a, 0x00, 0x0c, 0x01, 0x55, 0x00, 0x16, 0x01,
+  0x24, 0x01, 0x3f, 0x01, 0x10, 0x00, 0x42, 0x01, 0x2d, 0x00, 0x53, 0x01, 0x05, 0x00, 0x5f, 0x01,
+  0x2e, 0x00, 0x66, 0x01, 0x2c, 0x00, 0x7a, 0x01, 0x2b, 0x00, 0x96, 0x01, 0x1b, 0x00, 0xb0, 0x01,
+  0x04, 0x00, 0xbf, 0x01, 0xcf, 0x00, 0xd0, 0x01, 0x07, 0x01, 0xd2, 0x01, 0xfe, 0x00, 0xe8, 0x01,
+  0xf2, 0x00, 0xff, 0x01, 0xe0, 0x00, 0x06, 0x02, 0xf5, 0x00, 0x1d, 0x02, 0x1e, 0x01, 0x2f, 0x02,
+  0x1b, 0x01, 0x43, 0x02, 0xfa, 0x00, 0x4d, 0x02, 0xea, 0x00, 0x50, 0x02, 0xfd, 0x00, 0x6f, 0x02,
+  0x96, 0x01, 0x76, 0x02, 0x88, 0x01, 0x7f, 0x02, 0x9b, 0x01, 0xa0, 0x02, 0x9f, 0x01, 0xcd, 0x02,
+  0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x13, 0x00, 0x89, 0x01, 0x5b, 0x00, 0xbc, 0x00, 0x71, 0x00,
+  0x74, 0x00, 0x74, 0x00, 0x8d, 0x00, 0x7e, 0x00, 0x49, 0x00, 0x9a, 0x00, 0x91, 0x00, 0xaa, 0x00,
+  0x6f, 0x00, 0xb3, 0x00, 0x4c, 0x00, 0xbf, 0x00, 0x56, 0x00, 0xc9, 0x00, 0x7f, 0x00, 0xd3, 0x00,
+  0xa3, 0x00, 0xda, 0x00, 0xaf, 0x00, 0xe0, 0x00, 0xa6, 0x00, 0xe5, 0x00, 0xb7, 0x00, 0xe7, 0x00,
+  0xb5, 0x00, 0xea, 0x00, 0x96, 0x00, 0xec, 0x00, 0x37, 0x00, 0xed, 0x00, 0x6e, 0x00, 0xf6, 0x00,
+  0x4a, 0x00, 0x0b, 0x01, 0x55, 0x00, 0x17, 0x01, 0x24, 0x01, 0x3f, 0x01, 0x10, 0x00, 0x45, 0x01,
+  0x2d, 0x00, 0x52, 0x01, 0x05, 0x00, 0x5f, 0x01, 0x2e, 0x00, 0x66, 0x01, 0x2c, 0x00, 0x7a, 0x01,
+  0x2b, 0x00, 0x96, 0x01, 0x1b, 0x00, 0xb0, 0x01, 0x04, 0x00, 0xbe, 0x01, 0xcf, 0x00, 0xd2, 0x01,
+  0xfe, 0x00, 0xe8, 0x01, 0xf2, 0x00, 0xfe, 0x01, 0xe0, 0x00, 0x08, 0x02, 0xf5, 0x00, 0x1c, 0x02,
+  0x1e, 0x01, 0x2f, 0x02, 0x1b, 0x01, 0x43, 0x02, 0xfa, 0x00, 0x4d, 0x02, 0xea, 0x00, 0x4f, 0x02,
+  0xfd, 0x00, 0x6e, 0x02, 0x96, 0x01, 0x77, 0x02, 0x88, 0x01, 0x81, 0x02, 0x9b, 0x01, 0xa0, 0x02,
+  0x98, 0x01, 0xa1, 0x02, 0x9f, 0x01, 0xce, 0x02, 0x90, 0x01, 0xd0, 0x02, 0x90, 0x01, 0x12, 0x00,
+  0x89, 0x01, 0x5b, 0x00, 0xbc, 0x00, 0x71, 0x00, 0x74, 0x00, 0x73, 0x00, 0x8d, 0x00, 0x7c, 0x00,
+  0x49, 0x00, 0x9a, 0x00, 0x91, 0x00, 0xa9, 0x00, 0x6f, 0x00, 0xb5, 0x00, 0x4c, 0x00, 0xbc, 0x00,
+  0xba, 0x00, 0xc0, 0x00, 0x56, 0x00, 0xc8, 0x00, 0x7f, 0x00, 0xd3, 0x00, 0xa3, 0x00, 0xda, 0x00,
+  0xaf, 0x00, 0xe0, 0x00, 0xa6, 0x00, 0xe4, 0x00, 0xb7, 0x00, 0xe7, 0x00, 0xb5, 0x00, 0xe9, 0x00,
+  0x96, 0x00, 0xec, 0x00, 0x6e, 0x00, 0xf4, 0x00, 0x8b, 0x00, 0xf5, 0x00, 0x4a, 0x00, 0x09, 0x01,
+  0x55, 0x00, 0x17, 0x01, 0x24, 0x01, 0x3f, 0x01, 0x10, 0x00, 0x47, 0x01, 0x2d, 0x00, 0x51, 0x01,
+  0x05, 0x00, 0x5f, 0x01, 0x2e, 0x00, 0x66, 0x01, 0x2c, 0x00, 0x7a, 0x01, 0x2b, 0x00, 0x96, 0x01,
+  0x1b, 0x00, 0xaf, 0x01, 0x04, 0x00, 0xbe, 0x01, 0xcf, 0x00, 0xd3, 0x01, 0xfe, 0x00, 0xe8, 0x01,
+  0xf2, 0x00, 0xfc, 0x01, 0xe0, 0x00, 0x0a, 0x02, 0xf5, 0x00, 0x1b, 0x02, 0x1e, 0x01, 0x2e, 0x02,
+  0xda, 0x00, 0x31, 0x02, 0x1b, 0x01, 0x41, 0x02, 0xe9, 0x00, 0x45, 0x02, 0xfa, 0x00, 0x4e, 0x02,
+  0xfd, 0x00, 0x6e, 0x02, 0x96, 0x01, 0x78, 0x02, 0x88, 0x01, 0x83, 0x02, 0x9b, 0x01, 0x9f, 0x02,
+  0x98, 0x01, 0xa3, 0x02, 0x9f, 0x01, 0xcc, 0x02, 0x8e, 0x01, 0xcf, 0x02, 0x90, 0x01, 0xd0, 0x02,
+  0x8e, 0x01, 0x01, 0x00, 0x90, 0x01, 0x12, 0x00, 0x89, 0x01, 0x5b, 0x00, 0xbc, 0x00, 0x70, 0x00,
+  0x74, 0x00, 0x72, 0x00, 0x8d, 0x00, 0x7a, 0x00, 0x49, 0x00, 0x99, 0x00, 0x91, 0x00, 0xa9, 0x00,
+  0x6f, 0x00, 0xb6, 0x00, 0x4c, 0x00, 0xb8, 0x00, 0xba, 0x00, 0xc1, 0x00, 0x56, 0x00, 0xc8, 0x00,
+  0x7f, 0x00, 0xd4, 0x00, 0xa3, 0x00, 0xda, 0x00, 0xaf, 0x00, 0xe0, 0x00, 0xa6, 0x00, 0xe4, 0x00,
+  0xb7, 0x00, 0xe6, 0x00, 0xb5, 0x00, 0xe8, 0x00, 0x96, 0x00, 0xeb, 0x00, 0x6e, 0x00, 0xed, 0x00,
+  0x64, 0x00, 0xf1, 0x00, 0x8b, 0x00, 0xf3, 0x00, 0x4a, 0x00, 0x08, 0x01, 0x55, 0x00, 0x18, 0x01,
+  0x24, 0x01, 0x3f, 0x01, 0x10, 0x00, 0x4a, 0x01, 0x2d, 0x00, 0x51, 0x01, 0x05, 0x00, 0x5f, 0x01,
+  0x2e, 0x00, 0x67, 0x01, 0x2c, 0x00, 0x7a, 0x01, 0x2b, 0x00, 0x97, 0x01, 0x1b, 0x00, 0xaf, 0x01,
+  0x04, 0x00, 0xbe, 0x01, 0xcf, 0x00, 0xd4, 0x01, 0xfe, 0x00, 0xe8, 0x01, 0xf2, 0x00, 0xfb, 0x01,
+  0xe0, 0x00, 0x0c, 0x02, 0xf5, 0x00, 0x1a, 0x02, 0x1e, 0x01, 0x2d, 0x02, 0xda, 0x00, 0x34, 0x02,
+  0x1b, 0x01, 0x3e, 0x02, 0x04, 0x01, 0x40, 0x02, 0xe9, 0x00, 0x47, 0x02, 0xfa, 0x00, 0x4d, 0x02,
+  0xfd, 0x00, 0x6d, 0x02, 0x96, 0x01, 0x78, 0x02, 0x88, 0x01, 0x85, 0x02, 0x9b, 0x01, 0x9e, 0x02,
+  0x7f, 0x01, 0x9f, 0x02, 0x98, 0x01, 0xa4, 0x02, 0x9f, 0x01, 0xc9, 0x02, 0x8e, 0x01, 0xd0, 0x02,
+  0x8e, 0x01, 0x03, 0x00, 0x90, 0x01, 0x11, 0x00, 0x89, 0x01, 0x5c, 0x00, 0xbc, 0x00, 0x6f, 0x00,
+  0x74, 0x00, 0x71, 0x00, 0x8d, 0x00, 0x78, 0x00, 0x49, 0x00, 0x99, 0x00, 0x91, 0x00, 0xa8, 0x00,
+  0x6f, 0x00, 0xb6, 0x00, 0x67, 0x00, 0xb7, 0x00, 0xba, 0x00, 0xc2, 0x00, 0x56, 0x00, 0xc8, 0x00,
+  0x7f, 0x00, 0xd4, 0x00, 0xa3, 0x00, 0xd8, 0x00, 0x45, 0x00, 0xdf, 0x00, 0x83, 0x00, 0xe2, 0x00,
+  0xa6, 0x00, 0xe4, 0x00, 0xb7, 0x00, 0xe6, 0x00, 0xb5, 0x00, 0xe7, 0x00, 0x96, 0x00, 0xea, 0x00,
+  0x64, 0x00, 0xef, 0x00, 0x8b, 0x00, 0xf2, 0x00, 0x4a, 0x00, 0x07, 0x01, 0x55, 0x00, 0x18, 0x01,
+  0x24, 0x01, 0x3f, 0x01, 0x10, 0x00, 0x4a, 0x01, 0x07, 0x00, 0x4f, 0x01, 0x2d, 0x00, 0x50, 0x01,
+  0x05, 0x00, 0x5f, 0x01, 0x2e, 0x00, 0x67, 0x01, 0x2c, 0x00, 0x7a, 0x01, 0x2b, 0x00, 0x97, 0x01,
+  0x1b, 0x00, 0xaf, 0x01, 0x04, 0x00, 0xbd, 0x01, 0xcf, 0x00, 0xd5, 0x01, 0xfe, 0x00, 0xe9, 0x01,
+  0xf2, 0x00, 0xf9, 0x01, 0xe0, 0x00, 0x0e, 0x02, 0xf5, 0x00, 0x19, 0x02, 0x1e, 0x01, 0x2d, 0x02,
+  0xda, 0x00, 0x36, 0x02, 0x1b, 0x01, 0x3a, 0x02, 0x04, 0x01, 0x40, 0x02, 0xe9, 0x00, 0x48, 0x02,
+  0xfa, 0x00, 0x4c, 0x02, 0xfd, 0x00, 0x6c, 0x02, 0x96, 0x01, 0x79, 0x02, 0x88, 0x01, 0x87, 0x02,
+  0x9b, 0x01, 0x9c, 0x02, 0x7f, 0x01, 0x9f, 0x02, 0x98, 0x01, 0xa6, 0x02, 0x9f, 0x01, 0xc6, 0x02,
+  0x8e, 0x01, 0xd0, 0x02, 0x8e, 0x01, 0x05, 0x00, 0x90, 0x01, 0x11, 0x00, 0x89, 0x01, 0x5c, 0x00,
+  0xbc, 0x00, 0x6f, 0x00, 0x8d, 0x00, 0x76, 0x00, 0x49, 0x00, 0x99, 0x00, 0x91, 0x00, 0xa8, 0x00,
+  0x6f, 0x00, 0xb5, 0x00, 0x67, 0x00, 0xb7, 0x00, 0xba, 0x00, 0xc2, 0x00, 0x88, 0x00, 0xc3, 0x00,
+  0x56, 0x00, 0xc7, 0x00, 0x7f, 0x00, 0xd4, 0x00, 0xa3, 0x00, 0xd6, 0x00, 0x45, 0x00, 0xdf, 0x00,
+  0x83, 0x00, 0xe5, 0x00, 0x96, 0x00, 0xe8, 0x00, 0x64, 0x00, 0xed, 0x00, 0x8b, 0x00, 0xf1, 0x00,
+  0x4a, 0x00, 0x06, 0x01, 0x55, 0x00, 0x18, 0x01, 0x24, 0x01, 0x3f, 0x01, 0x10, 0x00, 0x48, 0x01,
+  0x07, 0x00, 0x4f, 0x01, 0x08, 0x00, 0x50, 0x01, 0x05, 0x00, 0x5f, 0x01, 0x2e, 0x00, 0x67, 0x01,
+  0x2c, 0x00, 0x7a, 0x01, 0x2b, 0x00, 0x97, 0x01, 0x1b, 0x00, 0xaf, 0x01, 0x04, 0x00, 0xbc, 0x01,
+  0x12, 0x00, 0xbd, 0x01, 0xcf, 0x00, 0xd6, 0x01, 0xfe, 0x00, 0xe9, 0x01, 0xf2, 0x00, 0xf6, 0x01,
+  0x77, 0x01, 0xf9, 0x01, 0xe0, 0x00, 0x10, 0x02, 0xf5, 0x00, 0x19, 0x02, 0x1e, 0x01, 0x2c, 0x02,
+  0xda, 0x00, 0x38, 0x02, 0x04, 0x01, 0x3f, 0x02, 0xe9, 0x00, 0x4a, 0x02, 0xfa, 0x00, 0x4b, 0x02,
+  0xfd, 0x00, 0x6c, 0x02, 0x96, 0x01, 0x7a, 0x02, 0x88, 0x01, 0x89, 0x02, 0x9b, 0x01, 0x9b, 0x02,
+  0x7f, 0x01, 0x9f, 0x02, 0x98, 0x01, 0xa8, 0x02, 0x9f, 0x01, 0xc3, 0x02, 0x8e, 0x01, 0xd0, 0x02,
+  0x8e, 0x01, 0x07, 0x00, 0x90, 0x01, 0x11, 0x00, 0x89, 0x01, 0x5c, 0x00, 0xbc, 0x00, 0x6e, 0x00,
+  0x8d, 0x00, 0x74, 0x00, 0x49, 0x00, 0x99, 0x00, 0x91, 0x00, 0xa7, 0x00, 0x6f, 0x00, 0xb4, 0x00,
+  0x67, 0x00, 0xb7, 0x00, 0xba, 0x00, 0xc0, 0x00, 0x88, 0x00, 0xc4, 0x00, 0x5a, 0x00, 0xc5, 0x00,
+  0x56, 0x00, 0xc7, 0x00, 0x7f, 0x00, 0xd4, 0x00, 0x45, 0x00, 0xde, 0x00, 0x5e, 0x00, 0xdf, 0x00,
+  0x83, 0x00, 0xe6, 0x00, 0x64, 0x00, 0xea, 0x00, 0x8b, 0x00, 0xed, 0x00, 0xb6, 0x00, 0xf0, 0x00,
+  0x4a, 0x00, 0x05, 0x01, 0x55, 0x00, 0x19, 0x01, 0x24, 0x01, 0x3f, 0x01, 0x10, 0x00, 0x47, 0x01,
+  0x07, 0x00, 0x4d, 0x01, 0x08, 0x00, 0x50, 0x01, 0x05, 0x00, 0x5f, 0x01, 0x2e, 0x00, 0x68, 0x01,
+  0x2c, 0x00, 0x7a, 0x01, 0x2b, 0x00, 0x97, 0x01, 0x1b, 0x00, 0xaf, 0x01, 0x04, 0x00, 0xbc, 0x01,
+  0x12, 0x00, 0xbe, 0x01, 0xcf, 0x00, 0xd6, 0x01, 0xfe, 0x00, 0xe9, 0x01, 0xf2, 0x00, 0xf3, 0x01,
+  0x77, 0x01, 0xf9, 0x01, 0xe0, 0x00, 0x12, 0x02, 0xf5, 0x00, 0x18, 0x02, 0x1e, 0x01, 0x2b, 0x02,
+  0xda, 0x00, 0x37, 0x02, 0x04, 0x01, 0x3f, 0x02, 0xe9, 0x00, 0x4b, 0x02, 0xfd, 0x00, 0x6b, 0x02,
+  0x96, 0x01, 0x7a, 0x02, 0x88, 0x01, 0x8b, 0x02, 0x9b, 0x01, 0x9a, 0x02, 0x7f, 0x01, 0x9f, 0x02,
+  0x98, 0x01, 0xa9, 0x02, 0x9f, 0x01, 0xb8, 0x02, 0x8d, 0x01, 0xc1, 0x02, 0x8e, 0x01, 0xd0, 0x02,
+  0x8e, 0x01, 0x09, 0x00, 0x90, 0x01, 0x10, 0x00, 0x89, 0x01, 0x5a, 0x00, 0x8f, 0x01, 0x5e, 0x00,
+  0xbc, 0x00, 0x6d, 0x00, 0x8d, 0x00, 0x72, 0x00, 0x49, 0x00, 0x98, 0x00, 0x91, 0x00, 0xa7, 0x00,
+  0x6f, 0x00, 0xb4, 0x00, 0x67, 0x00, 0xb8, 0x00, 0xba, 0x00, 0xbd, 0x00, 0x88, 0x00, 0xc3, 0x00,
+  0x5a, 0x00, 0xc6, 0x00, 0xa0, 0x00, 0xca, 0x00, 0x7f, 0x00, 0xd3, 0x00, 0x45, 0x00, 0xde, 0x00,
+  0x5e, 0x00, 0xdf, 0x00, 0x83, 0x00, 0xe6, 0x00, 0x6d, 0x00, 0xe8, 0x00, 0xb8, 0x00, 0xec, 0x00,
+  0xb6, 0x00, 0xf0, 0x00, 0x4a, 0x00, 0x03, 0x01, 0x55, 0x00, 0x19, 0x01, 0x24, 0x01, 0x3f, 0x01,
+  0x10, 0x00, 0x45, 0x01, 0x07, 0x00, 0x4b, 0x01, 0x08, 0x00, 0x50, 0x01, 0x05, 0x00, 0x5f, 0x01,
+  0x2e, 0x00, 0x68, 0x01, 0x2c, 0x00, 0x79, 0x01, 0x2b, 0x00, 0x98, 0x01, 0x1b, 0x00, 0xaf, 0x01,
+  0x04, 0x00, 0xbb, 0x01, 0x12, 0x00, 0xbe, 0x01, 0xcf, 0x00, 0xd7, 0x01, 0xfe, 0x00, 0xe9, 0x01,
+  0xf2, 0x00, 0xf0, 0x01, 0x77, 0x01, 0xfa, 0x01, 0xe0, 0x00, 0x14, 0x02, 0xf5, 0x00, 0x17, 0x02,
+  0x1e, 0x01, 0x2a, 0x02, 0xda, 0x00, 0x37, 0x02, 0x04, 0x01, 0x3e, 0x02, 0xe9, 0x00, 0x4b, 0x02,
+  0xfd, 0x00, 0x6b, 0x02, 0x96, 0x01, 0x7b, 0x02, 0x88, 0x01, 0x8d, 0x02, 0x9b, 0x01, 0x98, 0x02,
+  0x7f, 0x01, 0x9f, 0x02, 0x98, 0x01, 0xab, 0x02, 0x8d, 0x01, 0xc0, 0x02, 0x8e, 0x01, 0xd0, 0x02,
+  0x8e, 0x01, 0x0b, 0x00, 0x90, 0x01, 0x10, 0x00, 0x89, 0x01, 0x58, 0x00, 0x8f, 0x01, 0x60, 0x00,
+  0xbc, 0x00, 0x6c, 0x00, 0x8d, 0x00, 0x70, 0x00, 0x49, 0x00, 0x98, 0x00, 0x91, 0x00, 0xa6, 0x00,
+  0x6f, 0x00, 0xb3, 0x00, 0x67, 0x00, 0xb8, 0x00, 0xba, 0x00, 0xbb, 0x00, 0x88, 0x00, 0xc2, 0x00,
+  0x5a, 0x00, 0xc6, 0x00, 0xa0, 0x00, 0xcd, 0x00, 0x7f, 0x00, 0xd2, 0x00, 0x45, 0x00, 0xde, 0x00,
+  0x5e, 0x00, 0xdf, 0x00, 0x83, 0x00, 0xe6, 0x00, 0x6d, 0x00, 0xea, 0x00, 0xb8, 0x00, 0xef, 0x00,
+  0x4a, 0x00, 0x02, 0x01, 0x55, 0x00, 0x19, 0x01, 0x24, 0x01, 0x3f, 0x01, 0x10, 0x00, 0x43, 0x01,
+  0x07, 0x00, 0x4a, 0x01, 0x08, 0x00, 0x50, 0x01, 0x05, 0x00, 0x5f, 0x01, 0x2e, 0x00, 0x68, 0x01,
+  0x2c, 0x00, 0x79, 0x01, 0x2b, 0x00, 0x98, 0x01, 0x1b, 0x00, 0xaf, 0x01, 0x04, 0x00, 0xba, 0x01,
+  0x12, 0x00, 0xbf, 0x01, 0xcf, 0x00, 0xd8, 0x01, 0xfe, 0x00, 0xe9, 0x01, 0xf2, 0x00, 0xec, 0x01,
+  0x77, 0x01, 0xfa, 0x01, 0xe0, 0x00, 0x16, 0x02, 0x1e, 0x01, 0x2a, 0x02, 0xda, 0x00, 0x36, 0x02,
+  0x04, 0x01, 0x3e, 0x02, 0xe9, 0x00, 0x4b, 0x02, 0xfd, 0x00, 0x6a, 0x02, 0x96, 0x01, 0x7c, 0x02,
+  0x88, 0x01, 0x8e, 0x02, 0x9b, 0x01, 0x97, 0x02, 0x7f, 0x01, 0x9f, 0x02, 0x98, 0x01, 0xab, 0x02,
+  0x8d, 0x01, 0xc0, 0x02, 0x8e, 0x01, 0xd0, 0x02, 0x8e, 0x01, 0x0c, 0x00, 0x8a, 0x01, 0x11, 0x00,
+  0x89, 0x01, 0x57, 0x00, 0x8f, 0x01, 0x63, 0x00, 0xbc, 0x00, 0x6c, 0x00, 0x8d, 0x00, 0x6f, 0x00,
+  0x49, 0x00, 0x98, 0x00, 0x91, 0x00, 0xa5, 0x00, 0x6f, 0x00, 0xb2, 0x00, 0x67, 0x00, 0xb8, 0x00,
+  0xba, 0x00, 0xb9, 0x00, 0x88, 0x00, 0xc1, 0x00, 0x5a, 0x00, 0xc6, 0x00, 0xa0, 0x00, 0xd1, 0x00,
+  0x45, 0x00, 0xdd, 0x00, 0x5e, 0x00, 0xdf, 0x00, 0x83, 0x00, 0xe4, 0x00, 0x54, 0x00, 0xe6, 0x00,
+  0x6d, 0x00, 0xec, 0x00, 0xb8, 0x00, 0xef, 0x00, 0x4a, 0x00, 0x01, 0x01, 0x55, 0x00, 0x1a, 0x01,
+  0x24, 0x01, 0x3f, 0x01, 0x10, 0x00, 0x42, 0x01, 0x07, 0x00, 0x48, 0x01, 0x08, 0x00, 0x50, 0x01,
+  0x05, 0x00, 0x5f, 0x01, 0x2e, 0x00, 0x69, 0x01, 0x2c, 0x00, 0x79, 0x01, 0x2b, 0x00, 0x98, 0x01,
+  0x1b, 0x00, 0xaf, 0x01, 0x04, 0x00, 0xb9, 0x01, 0x12, 0x00, 0xc0, 0x01, 0xcf, 0x00, 0xd9, 0x01,
+  0xfe, 0x00, 0xe9, 0x01, 0x77, 0x01, 0xfb, 0x01, 0xe0, 0x00, 0x17, 0x02, 0x1e, 0x01, 0x29, 0x02,
+  0xda, 0x00, 0x36, 0x02, 0x04, 0x01, 0x3d, 0x02, 0xe9, 0x00, 0x4c, 0x02, 0xfd, 0x00, 0x6a, 0x02,
+  0x96, 0x01, 0x7c, 0x02, 0x88, 0x01, 0x90, 0x02, 0x9b, 0x01, 0x95, 0x02, 0x7f, 0x01, 0x9f, 0x02,
+  0x98, 0x01, 0xab, 0x02, 0x8d, 0x01, 0xbf, 0x02, 0x8e, 0x01, 0xd0, 0x02, 0x8e, 0x01, 0x0c, 0x00,
+  0x8a, 0x01, 0x13, 0x00, 0x89, 0x01, 0x55, 0x00, 0x8f, 0x01, 0x65, 0x00, 0xbc, 0x00, 0x6b, 0x00,
+  0x8d, 0x00, 0x6d, 0x00, 0x49, 0x00, 0x98, 0x00, 0x91, 0x00, 0xa5, 0x00, 0x6f, 0x00, 0xb1, 0x00,
+  0x67, 0x00, 0xb8, 0x00, 0x88, 0x00, 0xc0, 0x00, 0x5a, 0x00, 0xc6, 0x00, 0xa0, 0x00, 0xd1, 0x00,
+  0x45, 0x00, 0xdd, 0x00, 0x5e, 0x00, 0xdf, 0x00, 0x83, 0x00, 0xe3, 0x00, 0x54, 0x00, 0xe7, 0x00,
+  0x6d, 0x00, 0xef, 0x00, 0x4a, 0x00, 0xff, 0x00, 0xa1, 0x00, 0x01, 0x01, 0x55, 0x00, 0x1a, 0x01,
+  0x24, 0x01, 0x3f, 0x01, 0x10, 0x00, 0x40, 0x01, 0x07, 0x00, 0x46, 0x01, 0x08, 0x00, 0x4f, 0x01,
+  0x0f, 0x00, 0x51, 0x01, 0x05, 0x00, 0x5e, 0x01, 0x2e, 0x00, 0x69, 0x01, 0x2c, 0x00, 0x79, 0x01,
+  0x2b, 0x00, 0x98, 0x01, 0x1b, 0x00, 0xaf, 0x01, 0x02, 0x00, 0xb0, 0x01, 0x04, 0x00, 0xb8, 0x01,
+  0x12, 0x00, 0xc0, 0x01, 0xcf, 0x00, 0xda, 0x01, 0xfe, 0x00, 0xe8, 0x01, 0x77, 0x01, 0xfb, 0x01,
+  0xe0, 0x00, 0x17, 0x02, 0x1e, 0x01, 0x28, 0x02, 0xda, 0x00, 0x35, 0x02, 0x04, 0x01, 0x3d, 0x02,
+  0xe9, 0x00, 0x4c, 0x02, 0xfd, 0x00, 0x69, 0x02, 0x96, 0x01, 0x7d, 0x02, 0x88, 0x01, 0x92, 0x02,
+  0x9b, 0x01, 0x94, 0x02, 0x7f, 0x01, 0x9f, 0x02, 0x98, 0x01, 0xac, 0x02, 0x8d, 0x01, 0xbf, 0x02,
+  0x8e, 0x01, 0xd0, 0x02, 0x8e, 0x01, 0x0b, 0x00, 0x8a, 0x01, 0x15, 0x00, 0x89, 0x01, 0x53, 0x00,
+  0x8f, 0x01, 0x67, 0x00, 0xbc, 0x00, 0x6a, 0x00, 0x8d, 0x00, 0x6b, 0x00, 0x49, 0x00, 0x97, 0x00,
+  0x91, 0x00, 0xa4, 0x00, 0x6f, 0x00, 0xb1, 0x00, 0x67, 0x00, 0xb7, 0x00, 0x88, 0x00, 0xbf, 0x00,
+  0x5a, 0x00, 0xc5, 0x00, 0xa0, 0x00, 0xd2, 0x00, 0x45, 0x00, 0xdd, 0x00, 0x5e, 0x00, 0xdf, 0x00,
+  0x83, 0x00, 0xe2, 0x00, 0x54, 0x00, 0xe7, 0x00, 0x6d, 0x00, 0xef, 0x00, 0x4a, 0x00, 0xfd, 0x00,
+  0xa1, 0x00, 0x01, 0x01, 0x55, 0x00, 0x1b, 0x01, 0x24, 0x01, 0x3f, 0x01, 0x07, 0x00, 0x45, 0x01,
+  0x08, 0x00, 0x4d, 0x01, 0x0f, 0x00, 0x52, 0x01, 0x05, 0x00, 0x5e, 0x01, 0x2e, 0x00, 0x69, 0x01,
+  0x2c, 0x00, 0x79, 0x01, 0x2b, 0x00, 0x98, 0x01, 0x1b, 0x00, 0xae, 0x01, 0x02, 0x00, 0xb8, 0x01,
+  0x12, 0x00, 0xc1, 0x01, 0xcf, 0x00, 0xdb, 0x01, 0xfe, 0x00, 0xe7, 0x01, 0x77, 0x01, 0xfc, 0x01,
+  0xe0, 0x00, 0x18, 0x02, 0x1e, 0x01, 0x28, 0x02, 0xda, 0x00, 0x35, 0x02, 0x04, 0x01, 0x3c, 0x02,
+  0xe9, 0x00, 0x4b, 0x02, 0xde, 0x00, 0x4d, 0x02, 0xfd, 0x00, 0x68, 0x02, 0x96, 0x01, 0x7e, 0x02,
+  0x88, 0x01, 0x93, 0x02, 0x7f, 0x01, 0x9f, 0x02, 0x98, 0x01, 0xac, 0x02, 0x8d, 0x01, 0xbe, 0x02,
+  0x8e, 0x01, 0xd0, 0x02, 0x8e, 0x01, 0x0a, 0x00, 0x8a, 0x01, 0x17, 0x00, 0x89, 0x01, 0x1c, 0x00,
+  0x8b, 0x01, 0x52, 0x00, 0x8f, 0x01, 0x69, 0x00, 0x49, 0x00, 0x97, 0x00, 0x91, 0x00, 0xa4, 0x00,
+  0x6f, 0x00, 0xb0, 0x00, 0x67, 0x00, 0xb7, 0x00, 0x88, 0x00, 0xbe, 0x00, 0x5a, 0x00, 0xc5, 0x00,
+  0xa0, 0x00, 0xd2, 0x00, 0x45, 0x00, 0xdc, 0x00, 0x5e, 0x00, 0xdf, 0x00, 0x83, 0x00, 0xe1, 0x00,
+  0x54, 0x00, 0xe7, 0x00, 0x6d, 0x00, 0xeb, 0x00, 0xa4, 0x00, 0xf1, 0x00, 0x4a, 0x00, 0xfb, 0x00,
+  0xa1, 0x00, 0x00, 0x01, 0x55, 0x00, 0x1b, 0x01, 0x24, 0x01, 0x3f, 0x01, 0x07, 0x00, 0x43, 0x01,
+  0x08, 0x00, 0x4c, 0x01, 0x0f, 0x00, 0x52, 0x01, 0x05, 0x00, 0x5e, 0x01, 0x2e, 0x00, 0x6a, 0x01,
+  0x2c, 0x00, 0x79, 0x01, 0x2b, 0x00, 0x98, 0x01, 0x06, 0x00, 0x99, 0x01, 0x1b, 0x00, 0xad, 0x01,
+  0x02, 0x00, 0xb9, 0x01, 0x12, 0x00, 0xc1, 0x01, 0xcf, 0x00, 0xdc, 0x01, 0xfe, 0x00, 0xe5, 0x01,
+  0x77, 0x01, 0xfc, 0x01, 0xe0, 0x00, 0x19, 0x02, 0x1e, 0x01, 0x27, 0x02, 0xda, 0x00, 0x34, 0x02,
+  0x04, 0x01, 0x3c, 0x02, 0xe9, 0x00, 0x4b, 0x02, 0xde, 0x00, 0x4f, 0x02, 0xfd, 0x00, 0x68, 0x02,
+  0x96, 0x01, 0x7e, 0x02, 0x88, 0x01, 0x92, 0x02, 0x7f, 0x01, 0x9f, 0x02, 0x98, 0x01, 0xac, 0x02,
+  0x8d, 0x01, 0xbe, 0x02, 0x8e, 0x01, 0xd0, 0x02, 0x8e, 0x01, 0x0a, 0x00, 0x8a, 0x01, 0x18, 0x00,
+  0x8b, 0x01, 0x51, 0x00, 0x8f, 0x01, 0x6a, 0x00, 0x49, 0x00, 0x97, 0x00, 0x91, 0x00, 0xa3, 0x00,
+  0x6f, 0x00, 0xaf, 0x00, 0x67, 0x00, 0xb6, 0x00, 0x88, 0x00, 0xbd, 0x00, 0x5a, 0x00, 0xc5, 0x00,
+  0xa0, 0x00, 0xd2, 0x00, 0x45, 0x00, 0xdc, 0x00, 0x5e, 0x00, 0xdf, 0x00, 0x54, 0x00, 0xe8, 0x00,
+  0xa4, 0x00, 0xf2, 0x00, 0x4a, 0x00, 0xfa, 0x00, 0xa1, 0x00, 0x00, 0x01, 0x55, 0x00, 0x1a, 0x01,
+  0x69, 0x00, 0x1c, 0x01, 0x24, 0x01, 0x3e, 0x01, 0x07, 0x00, 0x42, 0x01, 0x08, 0x00, 0x4b, 0x01,
+  0x0f, 0x00, 0x53, 0x01, 0x05, 0x00, 0x5e, 0x01, 0x2e, 0x00, 0x6a, 0x01, 0x2c, 0x00, 0x77, 0x01,
+  0x1e, 0x00, 0x79, 0x01, 0x2b, 0x00, 0x95, 0x01, 0x06, 0x00, 0x9a, 0x01, 0x1b, 0x00, 0xac, 0x01,
+  0x02, 0x00, 0xb9, 0x01, 0x12, 0x00, 0xc2, 0x01, 0xcf, 0x00, 0xdc, 0x01, 0xfe, 0x00, 0xe4, 0x01,
+  0x77, 0x01, 0xfd, 0x01, 0xe0, 0x00, 0x19, 0x02, 0x1e, 0x01, 0x26, 0x02, 0xda, 0x00, 0x33, 0x02,
+  0x04, 0x01, 0x3b, 0x02, 0xe9, 0x00, 0x4a, 0x02, 0xde, 0x00, 0x51, 0x02, 0xfd, 0x00, 0x67, 0x02,
+  0x96, 0x01, 0x7f, 0x02, 0x88, 0x01, 0x91, 0x02, 0x7f, 0x01, 0x9f, 0x02, 0x98, 0x01, 0xac, 0x02,
+  0x8d, 0x01, 0xbd, 0x02, 0x8e, 0x01, 0xd0, 0x02, 0x8e, 0x01, 0x09, 0x00, 0x8a, 0x01, 0x18, 0x00,
+  0x8b, 0x01, 0x50, 0x00, 0x8f, 0x01, 0x6b, 0x00, 0x49, 0x00, 0x97, 0x00, 0x91, 0x00, 0xa2, 0x00,
+  0x6f, 0x00, 0xae, 0x00, 0x67, 0x00, 0xb6, 0x00, 0x88, 0x00, 0xbc, 0x00, 0x5a, 0x00, 0xc5, 0x00,
+  0xa0, 0x00, 0xd3, 0x00, 0x45, 0x00, 0xdc, 0x00, 0x5e, 0x00, 0xde, 0x00, 0x54, 0x00, 0xe8, 0x00,
+  0xa4, 0x00, 0xf3, 0x00, 0x4a, 0x00, 0xf5, 0x00, 0x71, 0x00, 0xf9, 0x00, 0xa1, 0x00, 0x00, 0x01,
+  0x55, 0x00, 0x19, 0x01, 0x69, 0x00, 0x1e, 0x01, 0x24, 0x01, 0x3e, 0x01, 0x07, 0x00, 0x40, 0x01,
+  0x08, 0x00, 0x4a, 0x01, 0x0f, 0x00, 0x53, 0x01, 0x05, 0x00, 0x5e, 0x01, 0x2e, 0x00, 0x6a, 0x01,
+  0x2c, 0x00, 0x71, 0x01, 0x1e, 0x00, 0x79, 0x01, 0x13, 0x00, 0x7a, 0x01, 0x2b, 0x00, 0x93, 0x01,
+  0x06, 0x00, 0x9a, 0x01, 0x19, 0x00, 0xa8, 0x01, 0x1b, 0x00, 0xab, 0x01, 0x02, 0x00, 0xba, 0x01,
+  0x12, 0x00, 0xc3, 0x01, 0xcf, 0x00, 0xdd, 0x01, 0xfe, 0x00, 0xe2, 0x01, 0x77, 0x01, 0xfd, 0x01,
+  0xe0, 0x00, 0x1a, 0x02, 0x1e, 0x01, 0x25, 0x02, 0xda, 0x00, 0x33, 0x02, 0x04, 0x01, 0x3b, 0x02,
+  0xe9, 0x00, 0x49, 0x02, 0xde, 0x00, 0x52, 0x02, 0xfd, 0x00, 0x67, 0x02, 0x96, 0x01, 0x7f, 0x02,
+  0x88, 0x01, 0x90, 0x02, 0x7f, 0x01, 0x9e, 0x02, 0x98, 0x01, 0xac, 0x02, 0x8c, 0x01, 0xad, 0x02,
+  0x8d, 0x01, 0xbd, 0x02, 0x8e, 0x01, 0xd0, 0x02, 0x8e, 0x01, 0x08, 0x00, 0x8a, 0x01, 0x18, 0x00,
+  0x8b, 0x01, 0x50, 0x00, 0x8f, 0x01, 0x6c, 0x00, 0x49, 0x00, 0x97, 0x00, 0x91, 0x00, 0xa2, 0x00,
+  0x6f, 0x00, 0xae, 0x00, 0x67, 0x00, 0xb5, 0x00, 0x88, 0x00, 0xbb, 0x00, 0x5a, 0x00, 0xc5, 0x00,
+  0xa0, 0x00, 0xd3, 0x00, 0x45, 0x00, 0xdb, 0x00, 0x5e, 0x00, 0xdd, 0x00, 0x54, 0x00, 0xe8, 0x00,
+  0xa4, 0x00, 0xf3, 0x00, 0x71, 0x00, 0xf9, 0x00, 0xa1, 0x00, 0xff, 0x00, 0x55, 0x00, 0x19, 0x01,
+  0x69, 0x00, 0x1f, 0x01, 0x24, 0x01, 0x3e, 0x01, 0x07, 0x00, 0x3f, 0x01, 0x08, 0x00, 0x48, 0x01,
+  0x0f, 0x00, 0x50, 0x01, 0x15, 0x00, 0x54, 0x01, 0x05, 0x00, 0x5e, 0x01, 0x2e, 0x00, 0x6a, 0x01,
+  0x2f, 0x00, 0x6e, 0x01, 0x1e, 0x00, 0x79, 0x01, 0x13, 0x00, 0x7c, 0x01, 0x2b, 0x00, 0x91, 0x01,
+  0x06, 0x00, 0x9a, 0x01, 0x19, 0x00, 0xab, 0x01, 0x02, 0x00, 0xbb, 0x01, 0x12, 0x00, 0xc3, 0x01,
+  0xcf, 0x00, 0xde, 0x01, 0xfe, 0x00, 0xe1, 0x01, 0x77, 0x01, 0xfe, 0x01, 0xe0, 0x00, 0x1b, 0x02,
+  0x1e, 0x01, 0x25, 0x02, 0xda, 0x00, 0x32, 0x02, 0x04, 0x01, 0x3a, 0x02, 0xe9, 0x00, 0x48, 0x02,
+  0xde, 0x00, 0x54, 0x02, 0xfd, 0x00, 0x66, 0x02, 0x96, 0x01, 0x80, 0x02, 0x88, 0x01, 0x8f, 0x02,
+  0x7f, 0x01, 0x9e, 0x02, 0x98, 0x01, 0xac, 0x02, 0x8c, 0x01, 0xae, 0x02, 0x8d, 0x01, 0xbc, 0x02,
+  0x8e, 0x01, 0xd0, 0x02, 0x8e, 0x01, 0x08, 0x00, 0x8a, 0x01, 0x19, 0x00, 0x8b, 0x01, 0x4f, 0x00,
+  0x8f, 0x01, 0x6d, 0x00, 0x49, 0x00, 0x96, 0x00, 0x91, 0x00, 0xa1, 0x00, 0x6f, 0x00, 0xad, 0x00,
+  0x67, 0x00, 0xb4, 0x00, 0x88, 0x00, 0xba, 0x00, 0x5a, 0x00, 0xc4, 0x00, 0xa0, 0x00, 0xd2, 0x00,
+  0x4f, 0x00, 0xd5, 0x00, 0x45, 0x00, 0xdb, 0x00, 0x5e, 0x00, 0xdd, 0x00, 0x54, 0x00, 0xe8, 0x00,
+  0xa4, 0x00, 0xf2, 0x00, 0x71, 0x00, 0xf9, 0x00, 0xa1, 0x00, 0xff, 0x00, 0x55, 0x00, 0x18, 0x01,
+  0x69, 0x00, 0x20, 0x01, 0x24, 0x01, 0x3e, 0x01, 0x08, 0x00, 0x47, 0x01, 0x0f, 0x00, 0x4e, 0x01,
+  0x15, 0x00, 0x53, 0x01, 0x29, 0x00, 0x56, 0x01, 0x05, 0x00, 0x5d, 0x01, 0x00, 0x00, 0x60, 0x01,
+  0x2e, 0x00, 0x68, 0x01, 0x20, 0x00, 0x6a, 0x01, 0x2f, 0x00, 0x6e, 0x01, 0x1e, 0x00, 0x78, 0x01,
+  0x13, 0x00, 0x7d, 0x01, 0x2b, 0x00, 0x8e, 0x01, 0x06, 0x00, 0x9a, 0x01, 0x19, 0x00, 0xac, 0x01,
+  0x02, 0x00, 0xbb, 0x01, 0x12, 0x00, 0xc4, 0x01, 0xcf, 0x00, 0xdf, 0x01, 0xfe, 0x00, 0xe0, 0x01,
+  0x77, 0x01, 0xfe, 0x01, 0xe0, 0x00, 0x1b, 0x02, 0x1e, 0x01, 0x24, 0x02, 0xda, 0x00, 0x32, 0x02,
+  0x04, 0x01, 0x3a, 0x02, 0xe9, 0x00, 0x48, 0x02, 0xde, 0x00, 0x56, 0x02, 0xfd, 0x00, 0x66, 0x02,
+  0x96, 0x01, 0x81, 0x02, 0x88, 0x01, 0x8e, 0x02, 0x7f, 0x01, 0x9e, 0x02, 0x98, 0x01, 0xab, 0x02,
+  0x8c, 0x01, 0xaf, 0x02, 0x8d, 0x01, 0xbc, 0x02, 0x8e, 0x01, 0xd0, 0x02, 0x8e, 0x01, 0x07, 0x00,
+  0x8a, 0x01, 0x19, 0x00, 0x8b, 0x01, 0x4e, 0x00, 0x8f, 0x01, 0x6e, 0x00, 0x49, 0x00, 0x96, 0x00,
+  0x91, 0x00, 0xa1, 0x00, 0x6f, 0x00, 0xac, 0x00, 0x67, 0x00, 0xb4, 0x00, 0x88, 0x00, 0xb9, 0x00,
+  0x5a, 0x00, 0xc4, 0x00, 0xa0, 0x00, 0xd2, 0x00, 0x4f, 0x00, 0xd7, 0x00, 0x45, 0x00, 0xdb, 0x00,
+  0x5e, 0x00, 0xdc, 0x00, 0x54, 0x00, 0xe8, 0x00, 0xa4, 0x00, 0xf0, 0x00, 0x71, 0x00, 0xf8, 0x00,
+  0xa1, 0x00, 0xff, 0x00, 0x55, 0x00, 0x18, 0x01, 0x69, 0x00, 0x22, 0x01, 0x24, 0x01, 0x3d, 0x01,
+  0x08, 0x00, 0x46, 0x01, 0x0f, 0x00, 0x4c, 0x01, 0x15, 0x00, 0x52, 0x01, 0x29, 0x00, 0x59, 0x01,
+  0x05, 0x00, 0x5b, 0x01, 0x00, 0x00, 0x63, 0x01, 0x2e, 0x00, 0x64, 0x01, 0x01, 0x00, 0x67, 0x01,
+  0x20, 0x00, 0x6b, 0x01, 0x2f, 0x00, 0x6e, 0x01, 0x1e, 0x00, 0x78, 0x01, 0x13, 0x00, 0x7f, 0x01,
+  0x2b, 0x00, 0x8c, 0x01, 0x06, 0x00, 0x9a, 0x01, 0x19, 0x00, 0xac, 0x01, 0x02, 0x00, 0xbc, 0x01,
+  0x12, 0x00, 0xc4, 0x01, 0xcf, 0x00, 0xdd, 0x01, 0x76, 0x01, 0xe0, 0x01, 0x77, 0x01, 0xff, 0x01,
+  0xe0, 0x00, 0x1c, 0x02, 0x1e, 0x01, 0x23, 0x02, 0xda, 0x00, 0x31, 0x02, 0x04, 0x01, 0x39, 0x02,
+  0xe9, 0x00, 0x47, 0x02, 0xde, 0x00, 0x57, 0x02, 0xfd, 0x00, 0x65, 0x02, 0x96, 0x01, 0x81, 0x02,
+  0x88, 0x01, 0x8e, 0x02, 0x7f, 0x01, 0x9e, 0x02, 0x98, 0x01, 0xab, 0x02, 0x8c, 0x01, 0xb0, 0x02,
+  0x8d, 0x01, 0xbb, 0x02, 0x8e, 0x01, 0xd0, 0x02, 0x8e, 0x01, 0x07, 0x00, 0x8a, 0x01, 0x19, 0x00,
+  0x8b, 0x01, 0x4e, 0x00, 0x8f, 0x01, 0x6e, 0x00, 0x49, 0x00, 0x96, 0x00, 0x91, 0x00, 0xa0, 0x00,
+  0x6f, 0x00, 0xac, 0x00, 0x67, 0x00, 0xb3, 0x00, 0x88, 0x00, 0xb8, 0x00, 0x5a, 0x00, 0xc4, 0x00,
+  0xa0, 0x00, 0xd1, 0x00, 0x4f, 0x00, 0xd9, 0x00, 0x45, 0x00, 0xda, 0x00, 0x5e, 0x00, 0xdb, 0x00,
+  0x54, 0x00, 0xe8, 0x00, 0xa4, 0x00, 0xef, 0x00, 0x71, 0x00, 0xf8, 0x00, 0xa1, 0x00, 0xfe, 0x00,
+  0x55, 0x00, 0x17, 0x01, 0x69, 0x00, 0x22, 0x01, 0x9a, 0x00, 0x24, 0x01, 0x24, 0x01, 0x3d, 0x01,
+  0x08, 0x00, 0x44, 0x01, 0x0f, 0x00, 0x4a, 0x01, 0x15, 0x00, 0x52, 0x01, 0x29, 0x00, 0x5a, 0x01,
+  0x00, 0x00, 0x63, 0x01, 0x01, 0x00, 0x67, 0x01, 0x20, 0x00, 0x6b, 0x01, 0x2f, 0x00, 0x6e, 0x01,
+  0x1e, 0x00, 0x77, 0x01, 0x24, 0x00, 0x78, 0x01, 0x13, 0x00, 0x80, 0x01, 0x2b, 0x00, 0x8a, 0x01,
+  0x06, 0x00, 0x9a, 0x01, 0x19, 0x00, 0xad, 0x01, 0x02, 0x00, 0xbc, 0x01, 0x12, 0x00, 0xc5, 0x01,
+  0xcf, 0x00, 0xdb, 0x01, 0x76, 0x01, 0xe1, 0x01, 0x77, 0x01, 0xff, 0x01, 0xe0, 0x00, 0x1c, 0x02,
+  0x1e, 0x01, 0x23, 0x02, 0xda, 0x00, 0x2e, 0x02, 0xf7, 0x00, 0x32, 0x02, 0x04, 0x01, 0x39, 0x02,
+  0xe9, 0x00, 0x46, 0x02, 0xde, 0x00, 0x59, 0x02, 0xfd, 0x00, 0x65, 0x02, 0x96, 0x01, 0x82, 0x02,
+  0x88, 0x01, 0x8d, 0x02, 0x7f, 0x01, 0x9e, 0x02, 0x98, 0x01, 0xab, 0x02, 0x8c, 0x01, 0xb0, 0x02,
+  0x8d, 0x01, 0xbb, 0x02, 0x8e, 0x01, 0xd0, 0x02, 0x8e, 0x01, 0x06, 0x00, 0x8a, 0x01, 0x1a, 0x00,
+  0x8b, 0x01, 0x4d, 0x00, 0x8f, 0x01, 0x6f, 0x00, 0x49, 0x00, 0x96, 0x00, 0x91, 0x00, 0xa0, 0x00,
+  0x6f, 0x00, 0xab, 0x00, 0x67, 0x00, 0xb3, 0x00, 0x88, 0x00, 0xb7, 0x00, 0x5a, 0x00, 0xc4, 0x00,
+  0xa0, 0x00, 0xd0, 0x00, 0x4f, 0x00, 0xdb, 0x00, 0x54, 0x00, 0xe8, 0x00, 0xa4, 0x00, 0xee, 0x00,
+  0x71, 0x00, 0xf8, 0x00, 0xa1, 0x00, 0xfe, 0x00, 0x55, 0x00, 0x16, 0x01, 0x69, 0x00, 0x22, 0x01,
+  0x9a, 0x00, 0x26, 0x01, 0x24, 0x01, 0x3c, 0x01, 0x08, 0x00, 0x43, 0x01, 0x0f, 0x00, 0x47, 0x01,
+  0x15, 0x00, 0x51, 0x01, 0x29, 0x00, 0x5a, 0x01, 0x00, 0x00, 0x63, 0x01, 0x01, 0x00, 0x67, 0x01,
+  0x20, 0x00, 0x6b, 0x01, 0x2f, 0x00, 0x6e, 0x01, 0x1e, 0x00, 0x77, 0x01, 0x24, 0x00, 0x78, 0x01,
+  0x13, 0x00, 0x82, 0x01, 0x2b, 0x00, 0x87, 0x01, 0x06, 0x00, 0x9a, 0x01, 0x19, 0x00, 0xad, 0x01,
+  0x02, 0x00, 0xbd, 0x01, 0x12, 0x00, 0xc5, 0x01, 0xcf, 0x00, 0xda, 0x01, 0x76, 0x01, 0xe1, 0x01,
+  0x77, 0x01, 0xff, 0x01, 0xe0, 0x00, 0x1d, 0x02, 0x1e, 0x01, 0x22, 0x02, 0xda, 0x00, 0x26, 0x02,
+  0xf7, 0x00, 0x35, 0x02, 0x04, 0x01, 0x38, 0x02, 0xe9, 0x00, 0x45, 0x02, 0xde, 0x00, 0x5a, 0x02,
+  0xfd, 0x00, 0x64, 0x02, 0x96, 0x01, 0x82, 0x02, 0x88, 0x01, 0x8c, 0x02, 0x7f, 0x01, 0x9e, 0x02,
+  0x98, 0x01, 0xaa, 0x02, 0x8c, 0x01, 0xb1, 0x02, 0x8d, 0x01, 0xba, 0x02, 0x8e, 0x01, 0xd0, 0x02,
+  0x8e, 0x01, 0x04, 0x00, 0x9d, 0x01, 0x06, 0x00, 0x8a, 0x01, 0x1a, 0x00, 0x8b, 0x01, 0x4c, 0x00,
+  0x8f, 0x01, 0x70, 0x00, 0x49, 0x00, 0x95, 0x00, 0x91, 0x00, 0x9f, 0x00, 0x6f, 0x00, 0xaa, 0x00,
+  0x67, 0x00, 0xb2, 0x00, 0x88, 0x00, 0xb6, 0x00, 0x5a, 0x00, 0xc3, 0x00, 0xa0, 0x00, 0xcf, 0x00,
+  0x4f, 0x00, 0xdb, 0x00, 0x54, 0x00, 0xe8, 0x00, 0xa4, 0x00, 0xed, 0x00, 0x71, 0x00, 0xf7, 0x00,
+  0xa1, 0x00, 0xfe, 0x00, 0x55, 0x00, 0x16, 0x01, 0x69, 0x00, 0x22, 0x01, 0x9a, 0x00, 0x29, 0x01,
+  0x24, 0x01, 0x3c, 0x01, 0x08, 0x00, 0x42, 0x01, 0x0f, 0x00, 0x45, 0x01, 0x15, 0x00, 0x50, 0x01,
+  0x29, 0x00, 0x5a, 0x01, 0x00, 0x00, 0x64, 0x01, 0x01, 0x00, 0x68, 0x01, 0x20, 0x00, 0x6b, 0x01,
+  0x2f, 0x00, 0x6e, 0x01, 0x1e, 0x00, 0x76, 0x01, 0x24, 0x00, 0x78, 0x01, 0x13, 0x00, 0x83, 0x01,
+  0x2b, 0x00, 0x85, 0x01, 0x06, 0x00, 0x9a, 0x01, 0x19, 0x00, 0xae, 0x01, 0x02, 0x00, 0xbd, 0x01,
+  0x12, 0x00, 0xc4, 0x01, 0x28, 0x00, 0xd8, 0x01, 0x76, 0x01, 0xe2, 0x01, 0x77, 0x01, 0x00, 0x02,
+  0xe0, 0x00, 0x1e, 0x02, 0x1e, 0x01, 0x20, 0x02, 0xf7, 0x00, 0x37, 0x02, 0x04, 0x01, 0x38, 0x02,
+  0xe9, 0x00, 0x45, 0x02, 0xde, 0x00, 0x5c, 0x02, 0xfd, 0x00, 0x63, 0x02, 0x96, 0x01, 0x83, 0x02,
+  0x88, 0x01, 0x8b, 0x02, 0x7f, 0x01, 0x9e, 0x02, 0x98, 0x01, 0xaa, 0x02, 0x8c, 0x01, 0xb2, 0x02,
+  0x8d, 0x01, 0xba, 0x02, 0x8e, 0x01, 0xd0, 0x02, 0x9d, 0x01, 0x05, 0x00, 0x8a, 0x01, 0x1a, 0x00,
+  0x8b, 0x01, 0x4c, 0x00, 0x8f, 0x01, 0x71, 0x00, 0x49, 0x00, 0x95, 0x00, 0x91, 0x00, 0x9f, 0x00,
+  0x6f, 0x00, 0xa9, 0x00, 0x67, 0x00, 0xb2, 0x00, 0x88, 0x00, 0xb5, 0x00, 0x5a, 0x00, 0xc3, 0x00,
+  0xa0, 0x00, 0xce, 0x00, 0x4f, 0x00, 0xdc, 0x00, 0x54, 0x00, 0xe8, 0x00, 0xa4, 0x00, 0xec, 0x00,
+  0x71, 0x00, 0xf7, 0x00, 0xa1, 0x00, 0xfd, 0x00, 0x55, 0x00, 0x14, 0x01, 0x4b, 0x00, 0x15, 0x01,
+  0x69, 0x00, 0x22, 0x01, 0x9a, 0x00, 0x2b, 0x01, 0x24, 0x01, 0x3c, 0x01, 0x08, 0x00, 0x41, 0x01,
+  0x0f, 0x00, 0x43, 0x01, 0x15, 0x00, 0x4f, 0x01, 0x29, 0x00, 0x59, 0x01, 0x00, 0x00, 0x64, 0x01,
+  0x01, 0x00, 0x68, 0x01, 0x20, 0x00, 0x6c, 0x01, 0x2f, 0x00, 0x6e, 0x01, 0x1e, 0x00, 0x76, 0x01,
+  0x24, 0x00, 0x79, 0x01, 0x13, 0x00, 0x84, 0x01, 0x06, 0x00, 0x9a, 0x01, 0x19, 0x00, 0xaf, 0x01,
+  0x02, 0x00, 0xbe, 0x01, 0x12, 0x00, 0xc0, 0x01, 0x28, 0x00, 0xd8, 0x01, 0x76, 0x01, 0xe2, 0x01,
+  0x77, 0x01, 0x00, 0x02, 0xe0, 0x00, 0x1e, 0x02, 0xf7, 0x00, 0x39, 0x02, 0xe9, 0x00, 0x44, 0x02,
+  0xde, 0x00, 0x5e, 0x02, 0xfd, 0x00, 0x63, 0x02, 0x96, 0x01, 0x84, 0x02, 0x88, 0x01, 0x8a, 0x02,
+  0x7f, 0x01, 0x9e, 0x02, 0x98, 0x01, 0xaa, 0x02, 0x8c, 0x01, 0xb3, 0x02, 0x8d, 0x01, 0xb9, 0x02,
+  0x8e, 0x01, 0xd0, 0x02, 0x9d, 0x01, 0x05, 0x00, 0x8a, 0x01, 0x1b, 0x00, 0x8b, 0x01, 0x4b, 0x00,
+  0x8f, 0x01, 0x72, 0x00, 0x49, 0x00, 0x95, 0x00, 0x91, 0x00, 0x9e, 0x00, 0x6f, 0x00, 0xa2, 0x00,
+  0x85, 0x01, 0xb3, 0x00, 0x88, 0x00, 0xb4, 0x00, 0x5a, 0x00, 0xc3, 0x00, 0xa0, 0x00, 0xce, 0x00,
+  0x4f, 0x00, 0xdd, 0x00, 0x54, 0x00, 0xe7, 0x00, 0x4e, 0x00, 0xed, 0x00, 0x71, 0x00, 0xf7, 0x00,
+  0xa1, 0x00, 0xfd, 0x00, 0x55, 0x00, 0x12, 0x01, 0x4b, 0x00, 0x15, 0x01, 0x69, 0x00, 0x22, 0x01,
+  0x9a, 0x00, 0x2d, 0x01, 0x24, 0x01, 0x3b, 0x01, 0x08, 0x00, 0x3f, 0x01, 0x0f, 0x00, 0x41, 0x01,
+  0x15, 0x00, 0x4e, 0x01, 0x29, 0x00, 0x59, 0x01, 0x00, 0x00, 0x64, 0x01, 0x01, 0x00, 0x69, 0x01,
+  0x20, 0x00, 0x6c, 0x01, 0x2f, 0x00, 0x6e, 0x01, 0x1e, 0x00, 0x75, 0x01, 0x24, 0x00, 0x79, 0x01,
+  0x13, 0x00, 0x84, 0x01, 0x06, 0x00, 0x9a, 0x01, 0x19, 0x00, 0xaf, 0x01, 0x02, 0x00, 0xbe, 0x01,
+  0x28, 0x00, 0xd7, 0x01, 0x76, 0x01, 0xe3, 0x01, 0x77, 0x01, 0x01, 0x02, 0xe0, 0x00, 0x1e, 0x02,
+  0xf7, 0x00, 0x3b, 0x02, 0xe9, 0x00, 0x42, 0x02, 0xf8, 0x00, 0x45, 0x02, 0xde, 0x00, 0x5f, 0x02,
+  0xfd, 0x00, 0x62, 0x02, 0x96, 0x01, 0x84, 0x02, 0x88, 0x01, 0x89, 0x02, 0x7f, 0x01, 0x9e, 0x02,
+  0x98, 0x01, 0xa9, 0x02, 0x8c, 0x01, 0xb4, 0x02, 0x8d, 0x01, 0xb9, 0x02, 0x8e, 0x01, 0xcd, 0x02,
+  0x9d, 0x01, 0xd0, 0x02, 0x9d, 0x01, 0x05, 0x00, 0x8a, 0x01, 0x1b, 0x00, 0x8b, 0x01, 0x4b, 0x00,
+  0x8f, 0x01, 0x73, 0x00, 0x49, 0x00, 0x95, 0x00, 0x91, 0x00, 0x9c, 0x00, 0x85, 0x01, 0xb5, 0x00,
+  0x5a, 0x00, 0xc3, 0x00, 0xa0, 0x00, 0xcd, 0x00, 0x4f, 0x00, 0xde, 0x00, 0x54, 0x00, 0xe6, 0x00,
+  0x4e, 0x00, 0xee, 0x00, 0x71, 0x00, 0xf6, 0x00, 0xa1, 0x00, 0xfd, 0x00, 0x55, 0x00, 0x11, 0x01,
+  0x4b, 0x00, 0x15, 0x01, 0x69, 0x00, 0x22, 0x01, 0x9a, 0x00, 0x2f, 0x01, 0x24, 0x01, 0x3b, 0x01,
+  0x08, 0x00, 0x3e, 0x01, 0x0f, 0x00, 0x3f, 0x01, 0x15, 0x00, 0x4d, 0x01, 0x29, 0x00, 0x59, 0x01,
+  0x00, 0x00, 0x64, 0x01, 0x01, 0x00, 0x69, 0x01, 0x20, 0x00, 0x6c, 0x01, 0x2f, 0x00, 0x6e, 0x01,
+  0x1e, 0x00, 0x75, 0x01, 0x24, 0x00, 0x79, 0x01, 0x13, 0x00, 0x84, 0x01, 0x06, 0x00, 0x9a, 0x01,
+  0x19, 0x00, 0xb0, 0x01, 0x02, 0x00, 0xbd, 0x01, 0x28, 0x00, 0xd6, 0x01, 0x76, 0x01, 0xe3, 0x01,
+  0x77, 0x01, 0x01, 0x02, 0xe0, 0x00, 0x1e, 0x02, 0xf7, 0x00, 0x3c, 0x02, 0xe9, 0x00, 0x3f, 0x02,
+  0xf8, 0x00, 0x46, 0x02, 0xde, 0x00, 0x61, 0x02, 0xfd, 0x00, 0x62, 0x02, 0x96, 0x01, 0x85, 0x02,
+  0x88, 0x01, 0x88, 0x02, 0x7f, 0x01, 0x9e, 0x02, 0x98, 0x01, 0xa9, 0x02, 0x8c, 0x01, 0xb5, 0x02,
+  0x8d, 0x01, 0xb8, 0x02, 0x8e, 0x01, 0xca, 0x02, 0x9d, 0x01, 0xd0, 0x02, 0x9d, 0x01, 0x05, 0x00,
+  0x8a, 0x01, 0x1b, 0x00, 0x8b, 0x01, 0x4a, 0x00, 0x8f, 0x01, 0x74, 0x00, 0x49, 0x00, 0x94, 0x00,
+  0x91, 0x00, 0x9a, 0x00, 0x85, 0x01, 0xb7, 0x00, 0x5a, 0x00, 0xc3, 0x00, 0xa0, 0x00, 0xcc, 0x00,
+  0x4f, 0x00, 0xdf, 0x00, 0x54, 0x00, 0xe5, 0x00, 0x4e, 0x00, 0xf0, 0x00, 0x71, 0x00, 0xf6, 0x00,
+  0xa1, 0x00, 0xfc, 0x00, 0x55, 0x00, 0x0f, 0x01, 0x4b, 0x00, 0x15, 0x01, 0x69, 0x00, 0x21, 0x01,
+  0x9a, 0x00, 0x31, 0x01, 0x24, 0x01, 0x3a, 0x01, 0x08, 0x00, 0x3d, 0x01, 0x15, 0x00, 0x4c, 0x01,
+  0x29, 0x00, 0x59, 0x01, 0x00, 0x00, 0x64, 0x01, 0x01, 0x00, 0x69, 0x01, 0x20, 0x00, 0x6c, 0x01,
+  0x2f, 0x00, 0x6e, 0x01, 0x1e, 0x00, 0x74, 0x01, 0x24, 0x00, 0x7a, 0x01, 0x13, 0x00, 0x84, 0x01,
+  0x06, 0x00, 0x9a, 0x01, 0x19, 0x00, 0xb0, 0x01, 0x02, 0x00, 0xbb, 0x01, 0x28, 0x00, 0xd6, 0x01,
+  0x76, 0x01, 0xe4, 0x01, 0x77, 0x01, 0x02, 0x02, 0xe0, 0x00, 0x1e, 0x02, 0xf7, 0x00, 0x3b, 0x02,
+  0x0f, 0x01, 0x3e, 0x02, 0xf8, 0x00, 0x46, 0x02, 0xde, 0x00, 0x62, 0x02, 0x96, 0x01, 0x84, 0x02,
+  0xee, 0x00, 0x87, 0x02, 0x7f, 0x01, 0x9e, 0x02, 0x98, 0x01, 0xa9, 0x02, 0x8c, 0x01, 0xb6, 0x02,
+  0x8d, 0x01, 0xb8, 0x02, 0x8e, 0x01, 0xc6, 0x02, 0x9d, 0x01, 0xd0, 0x02, 0x9d, 0x01, 0x04, 0x00,
+  0x8a, 0x01, 0x1c, 0x00, 0x8b, 0x01, 0x49, 0x00, 0x8f, 0x01, 0x75, 0x00, 0x49, 0x00, 0x94, 0x00,
+  0x91, 0x00, 0x98, 0x00, 0x85, 0x01, 0xb9, 0x00, 0x5a, 0x00, 0xc2, 0x00, 0xa0, 0x00, 0xcb, 0x00,
+  0x4f, 0x00, 0xe0, 0x00, 0x54, 0x00, 0xe4, 0x00, 0x4e, 0x00, 0xf1, 0x00, 0x71, 0x00, 0xf6, 0x00,
+  0xa1, 0x00, 0xfc, 0x00, 0x55, 0x00, 0x0d, 0x01, 0x4b, 0x00, 0x14, 0x01, 0x69, 0x00, 0x21, 0x01,
+  0x9a, 0x00, 0x33, 0x01, 0x24, 0x01, 0x3a, 0x01, 0x08, 0x00, 0x3c, 0x01, 0x15, 0x00, 0x4b, 0x01,
+  0x29, 0x00, 0x59, 0x01, 0x00, 0x00, 0x64, 0x01, 0x01, 0x00, 0x6a, 0x01, 0x20, 0x00, 0x6d, 0x01,
+  0x2f, 0x00, 0x6e, 0x01, 0x1e, 0x00, 0x74, 0x01, 0x24, 0x00, 0x7a, 0x01, 0x13, 0x00, 0x84, 0x01,
+  0x06, 0x00, 0x9a, 0x01, 0x19, 0x00, 0xb1, 0x01, 0x02, 0x00, 0xba, 0x01, 0x28, 0x00, 0xd5, 0x01,
+  0x76, 0x01, 0xe4, 0x01, 0x77, 0x01, 0x02, 0x02, 0xe0, 0x00, 0x1d, 0x02, 0xf7, 0x00, 0x3a, 0x02,
+  0x0f, 0x01, 0x3e, 0x02, 0xf8, 0x00, 0x47, 0x02, 0xde, 0x00, 0x62, 0x02, 0x96, 0x01, 0x83, 0x02,
+  0xee, 0x00, 0x88, 0x02, 0x7f, 0x01, 0x9e, 0x02, 0x98, 0x01, 0xa8, 0x02, 0x8c, 0x01, 0xb7, 0x02,
+  0x8e, 0x01, 0xc3, 0x02, 0x9d, 0x01, 0xd0, 0x02, 0x9d, 0x01, 0x04, 0x00, 0x8a, 0x01, 0x1c, 0x00,
+  0x8b, 0x01, 0x49, 0x00, 0x8f, 0x01, 0x76, 0x00, 0x49, 0x00, 0x94, 0x00, 0x91, 0x00, 0x96, 0x00,
+  0x85, 0x01, 0xbb, 0x00, 0x5a, 0x00, 0xc2, 0x00, 0xa0, 0x00, 0xca, 0x00, 0x4f, 0x00, 0xe0, 0x00,
+  0x54, 0x00, 0xe2, 0x00, 0x4e, 0x00, 0xf3, 0x00, 0x71, 0x00, 0xf5, 0x00, 0xa1, 0x00, 0xfc, 0x00,
+  0x55, 0x00, 0x0c, 0x01, 0x4b, 0x00, 0x14, 0x01, 0x69, 0x00, 0x21, 0x01, 0x9a, 0x00, 0x35, 0x01,
+  0x24, 0x01, 0x3a, 0x01, 0x15, 0x00, 0x4a, 0x01, 0x29, 0x00, 0x59, 0x01, 0x00, 0x00, 0x64, 0x01,
+  0x01, 0x00, 0x6a, 0x01, 0x20, 0x00, 0x6d, 0x01, 0x2f, 0x00, 0x6e, 0x01, 0x1e, 0x00, 0x73, 0x01,
+  0x24, 0x00, 0x7a, 0x01, 0x13, 0x00, 0x84, 0x01, 0x06, 0x00, 0x9a, 0x01, 0x19, 0x00, 0xb2, 0x01,
+  0x02, 0x00, 0xb9, 0x01, 0x28, 0x00, 0xd4, 0x01, 0x76, 0x01, 0xe5, 0x01, 0x77, 0x01, 0x02, 0x02,
+  0xe0, 0x00, 0x1d, 0x02, 0xf7, 0x00, 0x39, 0x02, 0x0f, 0x01, 0x3e, 0x02, 0xf8, 0x00, 0x48, 0x02,
+  0xde, 0x00, 0x62, 0x02, 0x96, 0x01, 0x81, 0x02, 0xee, 0x00, 0x89, 0x02, 0x7f, 0x01, 0x9e, 0x02,
+  0x98, 0x01, 0xa8, 0x02, 0x8c, 0x01, 0xb7, 0x02, 0x8e, 0x01, 0xc0, 0x02, 0x9d, 0x01, 0xd0, 0x02,
+  0x9d, 0x01, 0x04, 0x00, 0x8a, 0x01, 0x1c, 0x00, 0x8b, 0x01, 0x48, 0x00, 0x8f, 0x01, 0x77, 0x00,
+  0x49, 0x00, 0x94, 0x00, 0x85, 0x01, 0xbd, 0x00, 0x5a, 0x00, 0xc2, 0x00, 0xa0, 0x00, 0xc9, 0x00,
+  0x4f, 0x00, 0xe1, 0x00, 0x4e, 0x00, 0xf5, 0x00, 0xa1, 0x00, 0xfb, 0x00, 0x55, 0x00, 0x0a, 0x01,
+  0x4b, 0x00, 0x14, 0x01, 0x69, 0x00, 0x21, 0x01, 0x9a, 0x00, 0x38, 0x01, 0x24, 0x01, 0x39, 0x01,
+  0x15, 0x00, 0x49, 0x01, 0x29, 0x00, 0x59, 0x01, 0x00, 0x00, 0x64, 0x01, 0x01, 0x00, 0x6b, 0x01,
+  0x20, 0x00, 0x6d, 0x01, 0x2f, 0x00, 0x6e, 0x01, 0x1e, 0x00, 0x73, 0x01, 0x24, 0x00, 0x7b, 0x01,
+  0x13, 0x00, 0x84, 0x01, 0x06, 0x00, 0x9a, 0x01, 0x19, 0x00, 0xb1, 0x01, 0x2a, 0x00, 0xb5, 0x01,
+  0x02, 0x00, 0xb8, 0x01, 0x28, 0x00, 0xd4, 0x01, 0x76, 0x01, 0xe5, 0x01, 0x77, 0x01, 0x03, 0x02,
+  0xe0, 0x00, 0x1d, 0x02, 0xf7, 0x00, 0x38, 0x02, 0x0f, 0x01, 0x3e, 0x02, 0xf8, 0x00, 0x48, 0x02,
+  0xde, 0x00, 0x62, 0x02, 0x96, 0x01, 0x80, 0x02, 0xee, 0x00, 0x8a, 0x02, 0x7f, 0x01, 0x9e, 0x02,
+  0x98, 0x01, 0xa8, 0x02, 0x8c, 0x01, 0xb6, 0x02, 0x91, 0x01, 0xb9, 0x02, 0x8e, 0x01, 0xbd, 0x02,
+  0x9d, 0x01, 0xd0, 0x02, 0x9d, 0x01, 0x03, 0x00, 0x8a, 0x01, 0x1d, 0x00, 0x8b, 0x01, 0x47, 0x00,
+  0x8f, 0x01, 0x78, 0x00, 0x49, 0x00, 0x93, 0x00, 0x85, 0x01, 0xbf, 0x00, 0x5a, 0x00, 0xc0, 0x00,
+  0x70, 0x00, 0xc9, 0x00, 0x4f, 0x00, 0xe1, 0x00, 0x4e, 0x00, 0xf5, 0x00, 0xa1, 0x00, 0xfb, 0x00,
+  0x55, 0x00, 0x08, 0x01, 0x4b, 0x00, 0x14, 0x01, 0x69, 0x00, 0x21, 0x01, 0x9a, 0x00, 0x39, 0x01,
+  0x15, 0x00, 0x49, 0x01, 0x29, 0x00, 0x58, 0x01, 0x00, 0x00, 0x64, 0x01, 0x01, 0x00, 0x6b, 0x01,
+  0x20, 0x00, 0x6d, 0x01, 0x2f, 0x00, 0x6e, 0x01, 0x1e, 0x00, 0x72, 0x01, 0x30, 0x00, 0x73, 0x01,
+  0x24, 0x00, 0x7b, 0x01, 0x13, 0x00, 0x84, 0x01, 0x06, 0x00, 0x9a, 0x01, 0x19, 0x00, 0xb0, 0x01,
+  0x2a, 0x00, 0xb8, 0x01, 0x28, 0x00, 0xd3, 0x01, 0x76, 0x01, 0xe6, 0x01, 0x77, 0x01, 0x03, 0x02,
+  0xe0, 0x00, 0x1d, 0x02, 0xf7, 0x00, 0x37, 0x02, 0x0f, 0x01, 0x3e, 0x02, 0xf8, 0x00, 0x49, 0x02,
+  0xde, 0x00, 0x61, 0x02, 0xfc, 0x00, 0x62, 0x02, 0x96, 0x01, 0x7e, 0x02, 0xee, 0x00, 0x8b, 0x02,
+  0x7f, 0x01, 0x9d, 0x02, 0x98, 0x01, 0xa7, 0x02, 0x8c, 0x01, 0xb4, 0x02, 0x91, 0x01, 0xba, 0x02,
+  0x9d, 0x01, 0xd0, 0x02, 0x9d, 0x01, 0x03, 0x00, 0x8a, 0x01, 0x1d, 0x00, 0x8b, 0x01, 0x47, 0x00,
+  0x8f, 0x01, 0x78, 0x00, 0x49, 0x00, 0x91, 0x00, 0x85, 0x01, 0xc0, 0x00, 0x70, 0x00, 0xca, 0x00,
+  0x4f, 0x00, 0xe1, 0x00, 0x4e, 0x00, 0xf6, 0x00, 0xa1, 0x00, 0xfb, 0x00, 0x55, 0x00, 0x07, 0x01,
+  0x4b, 0x00, 0x13, 0x01, 0x69, 0x00, 0x21, 0x01, 0x9a, 0x00, 0x3a, 0x01, 0x15, 0x00, 0x48, 0x01,
+  0x29, 0x00, 0x58, 0x01, 0x00, 0x00, 0x64, 0x01, 0x01, 0x00, 0x6c, 0x01, 0x20, 0x00, 0x6e, 0x01,
+  0x1e, 0x00, 0x70, 0x01, 0x30, 0x00, 0x75, 0x01, 0x24, 0x00, 0x7b, 0x01, 0x13, 0x00, 0x84, 0x01,
+  0x06, 0x00, 0x9a, 0x01, 0x19, 0x00, 0xaa, 0x01, 0x1a, 0x00, 0xb0, 0x01, 0x2a, 0x00, 0xb8, 0x01,
+  0x28, 0x00, 0xd2, 0x01, 0x76, 0x01, 0xe6, 0x01, 0x77, 0x01, 0x04, 0x02, 0xe0, 0x00, 0x1d, 0x02,
+  0xf7, 0x00, 0x36, 0x02, 0x0f, 0x01, 0x3e, 0x02, 0xf8, 0x00, 0x4a, 0x02, 0xde, 0x00, 0x5f, 0x02,
+  0xfc, 0x00, 0x63, 0x02, 0x96, 0x01, 0x7c, 0x02, 0xee, 0x00, 0x8c, 0x02, 0x7f, 0x01, 0x9d, 0x02,
+  0x98, 0x01, 0xa7, 0x02, 0x8c, 0x01, 0xb3, 0x02, 0x91, 0x01, 0xba, 0x02, 0x9d, 0x01, 0xd0, 0x02,
+  0x9d, 0x01, 0x03, 0x00, 0x8a, 0x01, 0x1d, 0x00, 0x8b, 0x01, 0x46, 0x00, 0x8f, 0x01, 0x79, 0x00,
+  0x49, 0x00, 0x90, 0x00, 0x85, 0x01, 0xc0, 0x00, 0x70, 0x00, 0xcc, 0x00, 0x4f, 0x00, 0xe1, 0x00,
+  0x4e, 0x00, 0xf6, 0x00, 0xa1, 0x00, 0xfb, 0x00, 0x55, 0x00, 0x05, 0x01, 0x4b, 0x00, 0x13, 0x01,
+  0x69, 0x00, 0x21, 0x01, 0x9a, 0x00, 0x3a, 0x01, 0x15, 0x00, 0x47, 0x01, 0x29, 0x00, 0x58, 0x01,
+  0x00, 0x00, 0x64, 0x01, 0x01, 0x00, 0x6c, 0x01, 0x20, 0x00, 0x6e, 0x01, 0x30, 0x00, 0x77, 0x01,
+  0x24, 0x00, 0x7c, 0x01, 0x13, 0x00, 0x84, 0x01, 0x06, 0x00, 0x9a, 0x01, 0x1c, 0x00, 0x9f, 0x01,
+  0x19, 0x00, 0xa4, 0x01, 0x1a, 0x00, 0xaf, 0x01, 0x2a, 0x00, 0xb9, 0x01, 0x28, 0x00, 0xd2, 0x01,
+  0x76, 0x01, 0xe7, 0x01, 0x77, 0x01, 0x04, 0x02, 0xe0, 0x00, 0x1d, 0x02, 0xf7, 0x00, 0x36, 0x02,
+  0x0f, 0x01, 0x3e, 0x02, 0x05, 0x01, 0x3f, 0x02, 0xf8, 0x00, 0x4b, 0x02, 0xde, 0x00, 0x5d, 0x02,
+  0xfc, 0x00, 0x64, 0x02, 0x96, 0x01, 0x7b, 0x02, 0xee, 0x00, 0x8d, 0x02, 0x7f, 0x01, 0x9d, 0x02,
+  0x98, 0x01, 0xa6, 0x02, 0x8c, 0x01, 0xb1, 0x02, 0x91, 0x01, 0xbb, 0x02, 0x9d, 0x01, 0xd0, 0x02,
+  0x9d, 0x01, 0x03, 0x00, 0x8a, 0x01, 0x1e, 0x00, 0x8b, 0x01, 0x46, 0x00, 0x8f, 0x01, 0x7a, 0x00,
+  0x49, 0x00, 0x8e, 0x00, 0x85, 0x01, 0xbf, 0x00, 0x70, 0x00, 0xcd, 0x00, 0x4f, 0x00, 0xe1, 0x00,
+  0x4e, 0x00, 0xf7, 0x00, 0xa1, 0x00, 0xfa, 0x00, 0x55, 0x00, 0x03, 0x01, 0x4b, 0x00, 0x13, 0x01,
+  0x69, 0x00, 0x21, 0x01, 0x9a, 0x00, 0x3b, 0x01, 0x15, 0x00, 0x46, 0x01, 0x29, 0x00, 0x58, 0x01,
+  0x00, 0x00, 0x64, 0x01, 0x01, 0x00, 0x6c, 0x01, 0x20, 0x00, 0x6d, 0x01, 0x30, 0x00, 0x78, 0x01,
+  0x1f, 0x00, 0x85, 0x01, 0x06, 0x00, 0x99, 0x01, 0x1c, 0x00, 0xa2, 0x01, 0x1a, 0x00, 0xaf, 0x01,
+  0x2a, 0x00, 0xb9, 0x01, 0x28, 0x00, 0xd1, 0x01, 0x76, 0x01, 0xe7, 0x01, 0x77, 0x01, 0x05, 0x02,
+  0xe0, 0x00, 0x1c, 0x02, 0xf7, 0x00, 0x35, 0x02, 0x0f, 0x01, 0x3e, 0x02, 0x05, 0x01, 0x41, 0x02,
+  0xf8, 0x00, 0x4b, 0x02, 0xde, 0x00, 0x5b, 0x02, 0xfc, 0x00, 0x65, 0x02, 0x96, 0x01, 0x79, 0x02,
+  0xee, 0x00, 0x8e, 0x02, 0x7f, 0x01, 0x9d, 0x02, 0x98, 0x01, 0xa6, 0x02, 0x8c, 0x01, 0xb0, 0x02,
+  0x91, 0x01, 0xbb, 0x02, 0x9d, 0x01, 0xd0, 0x02, 0x9d, 0x01, 0x02, 0x00, 0x8a, 0x01, 0x1e, 0x00,
+  0x8b, 0x01, 0x45, 0x00, 0x8f, 0x01, 0x7b, 0x00, 0x49, 0x00, 0x8d, 0x00, 0x85, 0x01, 0xbf, 0x00,
+  0x70, 0x00, 0xce, 0x00, 0x4f, 0x00, 0xe1, 0x00, 0x4e, 0x00, 0xf6, 0x00, 0xad, 0x00, 0xfd, 0x00,
+  0x55, 0x00, 0x02, 0x01, 0x4b, 0x00, 0x13, 0x01, 0x69, 0x00, 0x21, 0x01, 0x9a, 0x00, 0x3c, 0x01,
+  0x15, 0x00, 0x45, 0x01, 0x29, 0x00, 0x58, 0x01, 0x00, 0x00, 0x64, 0x01, 0x01, 0x00, 0x6c, 0x01,
+  0x30, 0x00, 0x78, 0x01, 0x1f, 0x00, 0x85, 0x01, 0x06, 0x00, 0x99, 0x01, 0x1c, 0x00, 0xa2, 0x01,
+  0x1a, 0x00, 0xae, 0x01, 0x2a, 0x00, 0xba, 0x01, 0x28, 0x00, 0xd0, 0x01, 0x76, 0x01, 0xe7, 0x01,
+  0x77, 0x01, 0x05, 0x02, 0xe0, 0x00, 0x1c, 0x02, 0xf7, 0x00, 0x34, 0x02, 0x0f, 0x01, 0x3d, 0x02,
+  0x05, 0x01, 0x42, 0x02, 0xf8, 0x00, 0x4c, 0x02, 0xde, 0x00, 0x58, 0x02, 0xfc, 0x00, 0x66, 0x02,
+  0x96, 0x01, 0x78, 0x02, 0xee, 0x00, 0x8f, 0x02, 0x7f, 0x01, 0x9d, 0x02, 0x98, 0x01, 0xa6, 0x02,
+  0x8c, 0x01, 0xae, 0x02, 0x91, 0x01, 0xbb, 0x02, 0x9d, 0x01, 0xd0, 0x02, 0x9d, 0x01, 0x02, 0x00,
+  0x8a, 0x01, 0x1e, 0x00, 0x8b, 0x01, 0x44, 0x00, 0x8f, 0x01, 0x7c, 0x00, 0x49, 0x00, 0x8c, 0x00,
+  0x85, 0x01, 0xbf, 0x00, 0x70, 0x00, 0xcf, 0x00, 0x4f, 0x00, 0xe0, 0x00, 0x4e, 0x00, 0xf5, 0x00,
+  0xad, 0x00, 0x00, 0x01, 0x4b, 0x00, 0x13, 0x01, 0x69, 0x00, 0x21, 0x01, 0x9a, 0x00, 0x3c, 0x01,
+  0x15, 0x00, 0x44, 0x01, 0x29, 0x00, 0x58, 0x01, 0x00, 0x00, 0x64, 0x01, 0x01, 0x00, 0x6b, 0x01,
+  0x30, 0x00, 0x78, 0x01, 0x1f, 0x00, 0x85, 0x01, 0x0a, 0x00, 0x86, 0x01, 0x06, 0x00, 0x98, 0x01,
+  0x1c, 0x00, 0xa3, 0x01, 0x1a, 0x00, 0xae, 0x01, 0x2a, 0x00, 0xba, 0x01, 0x28, 0x00, 0xd0, 0x01,
+  0x76, 0x01, 0xe8, 0x01, 0x77, 0x01, 0x06, 0x02, 0xe0, 0x00, 0x1c, 0x02, 0xf7, 0x00, 0x33, 0x02,
+  0x0f, 0x01, 0x3d, 0x02, 0x05, 0x01, 0x44, 0x02, 0xf8, 0x00, 0x4d, 0x02, 0xde, 0x00, 0x56, 0x02,
+  0xfc, 0x00, 0x65, 0x02, 0xe3, 0x00, 0x67, 0x02, 0x96, 0x01, 0x76, 0x02, 0xee, 0x00, 0x90, 0x02,
+  0x7f, 0x01, 0x9c, 0x02, 0x7d, 0x01, 0x9e, 0x02, 0x98, 0x01, 0xa5, 0x02, 0x8c, 0x01, 0xad, 0x02,
+  0x91, 0x01, 0xbc, 0x02, 0x9d, 0x01, 0xd0, 0x02, 0x9d, 0x01, 0x02, 0x00, 0x8a, 0x01, 0x1e, 0x00,
+  0x8b, 0x01, 0x44, 0x00, 0x8f, 0x01, 0x7d, 0x00, 0x49, 0x00, 0x8a, 0x00, 0x85, 0x01, 0xbf, 0x00,
+  0x70, 0x00, 0xd0, 0x00, 0x4f, 0x00, 0xdf, 0x00, 0x66, 0x00, 0xe1, 0x00, 0x4e, 0x00, 0xf5, 0x00,
+  0xad, 0x00, 0x00, 0x01, 0x4b, 0x00, 0x12, 0x01, 0x69, 0x00, 0x21, 0x01, 0x9a, 0x00, 0x3d, 0x01,
+  0x15, 0x00, 0x43, 0x01, 0x29, 0x00, 0x58, 0x01, 0x00, 0x00, 0x64, 0x01, 0x01, 0x00, 0x6a, 0x01,
+  0x30, 0x00, 0x78, 0x01, 0x1f, 0x00, 0x84, 0x01, 0x0a, 0x00, 0x89, 0x01, 0x06, 0x00, 0x98, 0x01,
+  0x1c, 0x00, 0xa4, 0x01, 0x1a, 0x00, 0xae, 0x01, 0x2a, 0x00, 0xba, 0x01, 0x28, 0x00, 0xcf, 0x01,
+  0x76, 0x01, 0xe8, 0x01, 0x77, 0x01, 0x06, 0x02, 0xe0, 0x00, 0x1c, 0x02, 0xf7, 0x00, 0x32, 0x02,
+  0x0f, 0x01, 0x3d, 0x02, 0x05, 0x01, 0x45, 0x02, 0xf8, 0x00, 0x4e, 0x02, 0xde, 0x00, 0x54, 0x02,
+  0xfc, 0x00, 0x65, 0x02, 0xe3, 0x00, 0x69, 0x02, 0x96, 0x01, 0x74, 0x02, 0xee, 0x00, 0x90, 0x02,
+  0x7f, 0x01, 0x99, 0x02, 0x7d, 0x01, 0xa3, 0x02, 0x98, 0x01, 0xa5, 0x02, 0x8c, 0x01, 0xac, 0x02,
+  0x91, 0x01, 0xbc, 0x02, 0x9d, 0x01, 0xd0, 0x02, 0x9d, 0x01, 0x02, 0x00, 0x8a, 0x01, 0x1f, 0x00,
+  0x8b, 0x01, 0x43, 0x00, 0x8f, 0x01, 0x7e, 0x00, 0x49, 0x00, 0x89, 0x00, 0x85, 0x01, 0xbf, 0x00,
+  0x70, 0x00, 0xd2, 0x00, 0x4f, 0x00, 0xdc, 0x00, 0x66, 0x00, 0xe2, 0x00, 0x4e, 0x00, 0xee, 0x00,
+  0x89, 0x00, 0xf4, 0x00, 0xad, 0x00, 0x00, 0x01, 0x4b, 0x00, 0x12, 0x01, 0x69, 0x00, 0x21, 0x01,
+  0x9a, 0x00, 0x3e, 0x01, 0x15, 0x00, 0x42, 0x01, 0x29, 0x00, 0x57, 0x01, 0x00, 0x00, 0x64, 0x01,
+  0x01, 0x00, 0x6a, 0x01, 0x30, 0x00, 0x78, 0x01, 0x1f, 0x00, 0x83, 0x01, 0x0a, 0x00, 0x8b, 0x01,
+  0x06, 0x00, 0x97, 0x01, 0x0b, 0x00, 0x9a, 0x01, 0x1c, 0x00, 0xa5, 0x01, 0x1a, 0x00, 0xad, 0x01,
+  0x2a, 0x00, 0xbb, 0x01, 0x28, 0x00, 0xce, 0x01, 0x76, 0x01, 0xe9, 0x01, 0x77, 0x01, 0x06, 0x02,
+  0xe0, 0x00, 0x1c, 0x02, 0xf7, 0x00, 0x31, 0x02, 0x0f, 0x01, 0x3d, 0x02, 0x05, 0x01, 0x47, 0x02,
+  0xf8, 0x00, 0x4e, 0x02, 0xde, 0x00, 0x52, 0x02, 0xfc, 0x00, 0x64, 0x02, 0xe3, 0x00, 0x6b, 0x02,
+  0x96, 0x01, 0x73, 0x02, 0xee, 0x00, 0x91, 0x02, 0x7f, 0x01, 0x95, 0x02, 0x7d, 0x01, 0xa6, 0x02,
+  0x8c, 0x01, 0xaa, 0x02, 0x91, 0x01, 0xbc, 0x02, 0x9d, 0x01, 0xd0, 0x02, 0x9d, 0x01, 0x01, 0x00,
+  0x8a, 0x01, 0x1f, 0x00, 0x8b, 0x01, 0x43, 0x00, 0x8f, 0x01, 0x7f, 0x00, 0x49, 0x00, 0x88, 0x00,
+  0x85, 0x01, 0xbf, 0x00, 0x70, 0x00, 0xd3, 0x00, 0x4f, 0x00, 0xda, 0x00, 0x66, 0x00, 0xe3, 0x00,
+  0x4e, 0x00, 0xe4, 0x00, 0x89, 0x00, 0xf5, 0x00, 0xad, 0x00, 0x00, 0x01, 0x4b, 0x00, 0x12, 0x01,
+  0x69, 0x00, 0x21, 0x01, 0x9a, 0x00, 0x3e, 0x01, 0x15, 0x00, 0x41, 0x01, 0x29, 0x00, 0x57, 0x01,
+  0x00, 0x00, 0x65, 0x01, 0x01, 0x00, 0x69, 0x01, 0x30, 0x00, 0x78, 0x01, 0x1f, 0x00, 0x83, 0x01,
+  0x0a, 0x00, 0x8e, 0x01, 0x06, 0x00, 0x96, 0x01, 0x0b, 0x00, 0x9c, 0x01, 0x1c, 0x00, 0xa6, 0x01,
+  0x1a, 0x00, 0xad, 0x01, 0x2a, 0x00, 0xbb, 0x01, 0x28, 0x00, 0xce, 0x01, 0x76, 0x01, 0xe9, 0x01,
+  0x77, 0x01, 0x07, 0x02, 0xe0, 0x00, 0x1c, 0x02, 0xf7, 0x00, 0x30, 0x02, 0x0f, 0x01, 0x3d, 0x02,
+  0x05, 0x01, 0x48, 0x02, 0xf8, 0x00, 0x4f, 0x02, 0xfc, 0x00, 0x64, 0x02, 0xe3, 0x00, 0x6d, 0x02,
+  0x96, 0x01, 0x71, 0x02, 0xee, 0x00, 0x92, 0x02, 0x7d, 0x01, 0xa7, 0x02, 0x8c, 0x01, 0xa9, 0x02,
+  0x91, 0x01, 0xbd, 0x02, 0x9d, 0x01, 0xd0, 0x02, 0x84, 0x01, 0x02, 0x00, 0x8a, 0x01, 0x1f, 0x00,
+  0x8b, 0x01, 0x42, 0x00, 0x8f, 0x01, 0x80, 0x00, 0x49, 0x00, 0x86, 0x00, 0x85, 0x01, 0xbf, 0x00,
+  0x70, 0x00, 0xd4, 0x00, 0x4f, 0x00, 0xd7, 0x00, 0x66, 0x00, 0xe3, 0x00, 0x89, 0x00, 0xf5, 0x00,
+  0xad, 0x00, 0x00, 0x01, 0x4b, 0x00, 0x12, 0x01, 0x69, 0x00, 0x21, 0x01, 0x9a, 0x00, 0x3f, 0x01,
+  0x15, 0x00, 0x41, 0x01, 0x29, 0x00, 0x57, 0x01, 0x00, 0x00, 0x65, 0x01, 0x01, 0x00, 0x68, 0x01,
+  0x30, 0x00, 0x78, 0x01, 0x1f, 0x00, 0x82, 0x01, 0x0a, 0x00, 0x91, 0x01, 0x06, 0x00, 0x95, 0x01,
+  0x0b, 0x00, 0x9e, 0x01, 0x1c, 0x00, 0xa7, 0x01, 0x1a, 0x00, 0xad, 0x01, 0x2a, 0x00, 0xbb, 0x01,
+  0x28, 0x00, 0xcd, 0x01, 0x76, 0x01, 0xe9, 0x01, 0x71, 0x01, 0xf3, 0x01, 0x77, 0x01, 0x07, 0x02,
+  0xe0, 0x00, 0x1b, 0x02, 0xf7, 0x00, 0x2f, 0x02, 0x0f, 0x01, 0x3c, 0x02, 0x05, 0x01, 0x4a, 0x02,
+  0xf8, 0x00, 0x4f, 0x02, 0xfc, 0x00, 0x63, 0x02, 0xe3, 0x00, 0x6e, 0x02, 0x96, 0x01, 0x70, 0x02,
+  0xee, 0x00, 0x92, 0x02, 0x7d, 0x01, 0xa8, 0x02, 0x91, 0x01, 0xbd, 0x02, 0x9d, 0x01, 0xd0, 0x02,
+  0x84, 0x01, 0x03, 0x00, 0x8a, 0x01, 0x20, 0x00, 0x8b, 0x01, 0x41, 0x00, 0x8f, 0x01, 0x81, 0x00,
+  0x49, 0x00, 0x85, 0x00, 0x85, 0x01, 0xbf, 0x00, 0x70, 0x00, 0xd5, 0x00, 0x66, 0x00, 0xe4, 0x00,
+  0x89, 0x00, 0xf5, 0x00, 0xad, 0x00, 0x01, 0x01, 0x4b, 0x00, 0x11, 0x01, 0x69, 0x00, 0x21, 0x01,
+  0x9a, 0x00, 0x40, 0x01, 0x29, 0x00, 0x57, 0x01, 0x00, 0x00, 0x65, 0x01, 0x01, 0x00, 0x67, 0x01,
+  0x30, 0x00, 0x78, 0x01, 0x1f, 0x00, 0x81, 0x01, 0x0a, 0x00, 0x91, 0x01, 0x1d, 0x00, 0x93, 0x01,
+  0x06, 0x00, 0x95, 0x01, 0x0b, 0x00, 0xa0, 0x01, 0x1c, 0x00, 0xa8, 0x01, 0x1a, 0x00, 0xac, 0x01,
+  0x2a, 0x00, 0xbc, 0x01, 0x28, 0x00, 0xcc, 0x01, 0x76, 0x01, 0xe9, 0x01, 0x71, 0x01, 0xfd, 0x01,
+  0x77, 0x01, 0x08, 0x02, 0xe0, 0x00, 0x1b, 0x02, 0x73, 0x01, 0x1d, 0x02, 0xf7, 0x00, 0x2f, 0x02,
+  0x0f, 0x01, 0x3c, 0x02, 0x05, 0x01, 0x4c, 0x02, 0xf8, 0x00, 0x4e, 0x02, 0xfc, 0x00, 0x63, 0x02,
+  0xe3, 0x00, 0x6f, 0x02, 0xee, 0x00, 0x91, 0x02, 0x99, 0x01, 0x92, 0x02, 0x7d, 0x01, 0xa9, 0x02,
+  0x91, 0x01, 0xbd, 0x02, 0x9d, 0x01, 0xce, 0x02, 0x84, 0x01, 0xd0, 0x02, 0x84, 0x01, 0x03, 0x00,
+  0x8a, 0x01, 0x20, 0x00, 0x8b, 0x01, 0x41, 0x00, 0x8f, 0x01, 0x82, 0x00, 0x49, 0x00, 0x83, 0x00,
+  0x85, 0x01, 0xbe, 0x00, 0x70, 0x00, 0xd4, 0x00, 0x66, 0x00, 0xe4, 0x00, 0x89, 0x00, 0xf5, 0x00,
+  0xad, 0x00, 0x01, 0x01, 0x4b, 0x00, 0x11, 0x01, 0x69, 0x00, 0x21, 0x01, 0x9a, 0x00, 0x40, 0x01,
+  0x29, 0x00, 0x57, 0x01, 0x00, 0x00, 0x65, 0x01, 0x01, 0x00, 0x67, 0x01, 0x30, 0x00, 0x78, 0x01,
+  0x1f, 0x00, 0x80, 0x01, 0x0a, 0x00, 0x8f, 0x01, 0x1d, 0x00, 0x94, 0x01, 0x0b, 0x00, 0xa2, 0x01,
+  0x1c, 0x00, 0xa9, 0x01, 0x1a, 0x00, 0xac, 0x01, 0x2a, 0x00, 0xbc, 0x01, 0x28, 0x00, 0xcc, 0x01,
+  0x76, 0x01, 0xe9, 0x01, 0x71, 0x01, 0x08, 0x02, 0xe0, 0x00, 0x1a, 0x02, 0x73, 0x01, 0x20, 0x02,
+  0xf7, 0x00, 0x2e, 0x02, 0x0f, 0x01, 0x3c, 0x02, 0x05, 0x01, 0x4d, 0x02, 0xfc, 0x00, 0x62, 0x02,
+  0xe3, 0x00, 0x70, 0x02, 0xee, 0x00, 0x90, 0x02, 0x99, 0x01, 0x92, 0x02, 0x7d, 0x01, 0xa9, 0x02,
+  0x91, 0x01, 0xbe, 0x02, 0x9d, 0x01, 0xcc, 0x02, 0x84, 0x01, 0xd0, 0x02, 0x84, 0x01, 0x04, 0x00,
+  0x8a, 0x01, 0x20, 0x00, 0x8b, 0x01, 0x40, 0x00, 0x8f, 0x01, 0x82, 0x00, 0x80, 0x01, 0x83, 0x00,
+  0x85, 0x01, 0xbe, 0x00, 0x70, 0x00, 0xd4, 0x00, 0x66, 0x00, 0xe5, 0x00, 0x89, 0x00, 0xf5, 0x00,
+  0xad, 0x00, 0x01, 0x01, 0x4b, 0x00, 0x11, 0x01, 0x69, 0x00, 0x21, 0x01, 0x9a, 0x00, 0x41, 0x01,
+  0x29, 0x00, 0x57, 0x01, 0x00, 0x00, 0x65, 0x01, 0x01, 0x00, 0x66, 0x01, 0x30, 0x00, 0x78, 0x01,
+  0x1f, 0x00, 0x7f, 0x01, 0x0a, 0x00, 0x8d, 0x01, 0x1d, 0x00, 0x95, 0x01, 0x0b, 0x00, 0xa4, 0x01,
+  0x1c, 0x00, 0xaa, 0x01, 0x1a, 0x00, 0xac, 0x01, 0x2a, 0x00, 0xba, 0x01, 0x11, 0x00, 0xbe, 0x01,
+  0x28, 0x00, 0xcb, 0x01, 0x76, 0x01, 0xe9, 0x01, 0x71, 0x01, 0x0a, 0x02, 0xe0, 0x00, 0x18, 0x02,
+  0x73, 0x01, 0x23, 0x02, 0xf7, 0x00, 0x2d, 0x02, 0x0f, 0x01, 0x39, 0x02, 0xed, 0x00, 0x3e, 0x02,
+  0x05, 0x01, 0x4d, 0x02, 0xfc, 0x00, 0x62, 0x02, 0xe3, 0x00, 0x70, 0x02, 0xee, 0x00, 0x8f, 0x02,
+  0x99, 0x01, 0x93, 0x02, 0x7d, 0x01, 0xaa, 0x02, 0x91, 0x01, 0xbe, 0x02, 0x9d, 0x01, 0xcb, 0x02,
+  0x84, 0x01, 0xd0, 0x02, 0x84, 0x01, 0x04, 0x00, 0x8a, 0x01, 0x21, 0x00, 0x8b, 0x01, 0x40, 0x00,
+  0x8f, 0x01, 0x81, 0x00, 0x80, 0x01, 0x84, 0x00, 0x85, 0x01, 0xbe, 0x00, 0x70, 0x00, 0xd3, 0x00,
+  0x66, 0x00, 0xe5, 0x00, 0x89, 0x00, 0xf5, 0x00, 0xad, 0x00, 0x01, 0x01, 0x4b, 0x00, 0x11, 0x01,
+  0x69, 0x00, 0x21, 0x01, 0x9a, 0x00, 0x41, 0x01, 0x29, 0x00, 0x57, 0x01, 0x00, 0x00, 0x65, 0x01,
+  0x30, 0x00, 0x78, 0x01, 0x1f, 0x00, 0x7f, 0x01, 0x0a, 0x00, 0x8b, 0x01, 0x1d, 0x00, 0x95, 0x01,
+  0x0b, 0x00, 0xa6, 0x01, 0x1c, 0x00, 0xab, 0x01, 0x2a, 0x00, 0xb8, 0x01, 0x11, 0x00, 0xbf, 0x01,
+  0x28, 0x00, 0xca, 0x01, 0x76, 0x01, 0xe9, 0x01, 0x71, 0x01, 0x0c, 0x02, 0xe0, 0x00, 0x17, 0x02,
+  0x73, 0x01, 0x27, 0x02, 0xf7, 0x00, 0x2c, 0x02, 0x0f, 0x01, 0x37, 0x02, 0xed, 0x00, 0x41, 0x02,
+  0x05, 0x01, 0x4c, 0x02, 0xfc, 0x00, 0x61, 0x02, 0xe3, 0x00, 0x70, 0x02, 0xee, 0x00, 0x8e, 0x02,
+  0x99, 0x01, 0x93, 0x02, 0x7d, 0x01, 0xaa, 0x02, 0x91, 0x01, 0xbe, 0x02, 0x9d, 0x01, 0xc9, 0x02,
+  0x84, 0x01, 0xd0, 0x02, 0x84, 0x01, 0x05, 0x00, 0x8a, 0x01, 0x21, 0x00, 0x8b, 0x01, 0x3f, 0x00,
+  0x8f, 0x01, 0x80, 0x00, 0x80, 0x01, 0x86, 0x00, 0x85, 0x01, 0xbe, 0x00, 0x70, 0x00, 0xd3, 0x00,
+  0x66, 0x00, 0xe5, 0x00, 0xa5, 0x00, 0xe6, 0x00, 0x89, 0x00, 0xf5, 0x00, 0xad, 0x00, 0x01, 0x01,
+  0x4b, 0x00, 0x10, 0x01, 0x69, 0x00, 0x21, 0x01, 0x9a, 0x00, 0x41, 0x01, 0x29, 0x00, 0x56, 0x01,
+  0x00, 0x00, 0x65, 0x01, 0x30, 0x00, 0x78, 0x01, 0x1f, 0x00, 0x7e, 0x01, 0x0a, 0x00, 0x89, 0x01,
+  0x1d, 0x00, 0x95, 0x01, 0x0b, 0x00, 0xa8, 0x01, 0x1c, 0x00, 0xab, 0x01, 0x2a, 0x00, 0xb5, 0x01,
+  0x11, 0x00, 0xc1, 0x01, 0x28, 0x00, 0xca, 0x01, 0x76, 0x01, 0xe9, 0x01, 0x71, 0x01, 0x0e, 0x02,
+  0xe0, 0x00, 0x16, 0x02, 0x73, 0x01, 0x2a, 0x02, 0xf7, 0x00, 0x2b, 0x02, 0x0f, 0x01, 0x34, 0x02,
+  0xed, 0x00, 0x43, 0x02, 0x05, 0x01, 0x4c, 0x02, 0xfc, 0x00, 0x60, 0x02, 0xe3, 0x00, 0x71, 0x02,
+  0xee, 0x00, 0x8d, 0x02, 0x99, 0x01, 0x94, 0x02, 0x7d, 0x01, 0xaa, 0x02, 0x87, 0x01, 0xac, 0x02,
+  0x91, 0x01, 0xbf, 0x02, 0x9d, 0x01, 0xc8, 0x02, 0x84, 0x01, 0xd0, 0x02, 0x84, 0x01, 0x06, 0x00,
+  0x8a, 0x01, 0x21, 0x00, 0x8b, 0x01, 0x3e, 0x00, 0x8f, 0x01, 0x80, 0x00, 0x80, 0x01, 0x87, 0x00,
+  0x85, 0x01, 0xbe, 0x00, 0x70, 0x00, 0xd2, 0x00, 0x66, 0x00, 0xe5, 0x00, 0xa5, 0x00, 0xe7, 0x00,
+  0x89, 0x00, 0xf6, 0x00, 0xad, 0x00, 0x01, 0x01, 0x4b, 0x00, 0x0a, 0x01, 0x38, 0x00, 0x10, 0x01,
+  0x69, 0x00, 0x21, 0x01, 0x9a, 0x00, 0x42, 0x01, 0x29, 0x00, 0x56, 0x01, 0x00, 0x00, 0x64, 0x01,
+  0x30, 0x00, 0x78, 0x01, 0x1f, 0x00, 0x7d, 0x01, 0x0a, 0x00, 0x87, 0x01, 0x1d, 0x00, 0x95, 0x01,
+  0x0b, 0x00, 0xaa, 0x01, 0x1c, 0x00, 0xab, 0x01, 0x2a, 0x00, 0xb3, 0x01, 0x11, 0x00, 0xc2, 0x01,
+  0x28, 0x00, 0xc9, 0x01, 0x76, 0x01, 0xe8, 0x01, 0x71, 0x01, 0x10, 0x02, 0xe0, 0x00, 0x15, 0x02,
+  0x73, 0x01, 0x2c, 0x02, 0x0f, 0x01, 0x31, 0x02, 0xed, 0x00, 0x46, 0x02, 0x05, 0x01, 0x4b, 0x02,
+  0xfc, 0x00, 0x60, 0x02, 0xe3, 0x00, 0x71, 0x02, 0xee, 0x00, 0x8c, 0x02, 0x99, 0x01, 0x94, 0x02,
+  0x7d, 0x01, 0xa9, 0x02, 0x87, 0x01, 0xad, 0x02, 0x91, 0x01, 0xbf, 0x02, 0x9d, 0x01, 0xc6, 0x02,
+  0x84, 0x01, 0xd0, 0x02, 0x84, 0x01, 0x06, 0x00, 0x8a, 0x01, 0x22, 0x00, 0x8b, 0x01, 0x3e, 0x00,
+  0x8f, 0x01, 0x7f, 0x00, 0x80, 0x01, 0x88, 0x00, 0x85, 0x01, 0xbe, 0x00, 0x70, 0x00, 0xd2, 0x00,
+  0x66, 0x00, 0xe4, 0x00, 0xa5, 0x00, 0xe9, 0x00, 0x89, 0x00, 0xf6, 0x00, 0xad, 0x00, 0x01, 0x01,
+  0x38, 0x00, 0x11, 0x01, 0x69, 0x00, 0x21, 0x01, 0x9a, 0x00, 0x42, 0x01, 0x29, 0x00, 0x56, 0x01,
+  0x00, 0x00, 0x64, 0x01, 0x30, 0x00, 0x78, 0x01, 0x1f, 0x00, 0x7c, 0x01, 0x21, 0x00, 0x7d, 0x01,
+  0x0a, 0x00, 0x85, 0x01, 0x1d, 0x00, 0x95, 0x01, 0x0b, 0x00, 0xac, 0x01, 0x2a, 0x00, 0xb1, 0x01,
+  0x11, 0x00, 0xc4, 0x01, 0x28, 0x00, 0xc8, 0x01, 0x76, 0x01, 0xe8, 0x01, 0x71, 0x01, 0x12, 0x02,
+  0xe0, 0x00, 0x14, 0x02, 0x73, 0x01, 0x2e, 0x02, 0x0f, 0x01, 0x2f, 0x02, 0xed, 0x00, 0x48, 0x02,
+  0x05, 0x01, 0x4b, 0x02, 0xfc, 0x00, 0x5f, 0x02, 0xe3, 0x00, 0x71, 0x02, 0x2e, 0x01, 0x72, 0x02,
+  0xee, 0x00, 0x8b, 0x02, 0x99, 0x01, 0x94, 0x02, 0x7d, 0x01, 0xa8, 0x02, 0x87, 0x01, 0xae, 0x02,
+  0x91, 0x01, 0xbf, 0x02, 0x9d, 0x01, 0xc4, 0x02, 0x84, 0x01, 0xd0, 0x02, 0x84, 0x01, 0x07, 0x00,
+  0x8a, 0x01, 0x22, 0x00, 0x8b, 0x01, 0x3d, 0x00, 0x8f, 0x01, 0x7f, 0x00, 0x80, 0x01, 0x8a, 0x00,
+  0x85, 0x01, 0xbe, 0x00, 0x70, 0x00, 0xd2, 0x00, 0x66, 0x00, 0xe4, 0x00, 0xa5, 0x00, 0xea, 0x00,
+  0x89, 0x00, 0xf6, 0x00, 0xad, 0x00, 0x00, 0x01, 0x38, 0x00, 0x11, 0x01, 0x69, 0x00, 0x20, 0x01,
+  0xa9, 0x00, 0x22, 0x01, 0x9a, 0x00, 0x43, 0x01, 0x29, 0x00, 0x54, 0x01, 0x29, 0x01, 0x5d, 0x01,
+  0x00, 0x00, 0x63, 0x01, 0x30, 0x00, 0x78, 0x01, 0x1f, 0x00, 0x7a, 0x01, 0x21, 0x00, 0x7f, 0x01,
+  0x0a, 0x00, 0x83, 0x01, 0x1d, 0x00, 0x95, 0x01, 0x0b, 0x00, 0xac, 0x01, 0x2a, 0x00, 0xaf, 0x01,
+  0x11, 0x00, 0xc4, 0x01, 0x74, 0x01, 0xc7, 0x01, 0x28, 0x00, 0xc8, 0x01, 0x76, 0x01, 0xe8, 0x01,
+  0x71, 0x01, 0x13, 0x02, 0x73, 0x01, 0x2f, 0x02, 0xed, 0x00, 0x4a, 0x02, 0xfc, 0x00, 0x5f, 0x02,
+  0xe3, 0x00, 0x70, 0x02, 0x2e, 0x01, 0x73, 0x02, 0xee, 0x00, 0x8a, 0x02, 0x99, 0x01, 0x95, 0x02,
+  0x7d, 0x01, 0xa8, 0x02, 0x87, 0x01, 0xb0, 0x02, 0x91, 0x01, 0xc0, 0x02, 0x9d, 0x01, 0xc3, 0x02,
+  0x84, 0x01, 0xd0, 0x02, 0x84, 0x01, 0x08, 0x00, 0x8a, 0x01, 0x1a, 0x00, 0x82, 0x01, 0x23, 0x00,
+  0x8b, 0x01, 0x3c, 0x00, 0x8f, 0x01, 0x7e, 0x00, 0x80, 0x01, 0x8b, 0x00, 0x85, 0x01, 0xbd, 0x00,
+  0x70, 0x00, 0xd1, 0x00, 0x66, 0x00, 0xe4, 0x00, 0xa5, 0x00, 0xec, 0x00, 0x89, 0x00, 0xf6, 0x00,
+  0xad, 0x00, 0x00, 0x01, 0x38, 0x00, 0x12, 0x01, 0x69, 0x00, 0x1f, 0x01, 0xa9, 0x00, 0x24, 0x01,
+  0x9a, 0x00, 0x43, 0x01, 0x29, 0x00, 0x4f, 0x01, 0x29, 0x01, 0x64, 0x01, 0x30, 0x00, 0x78, 0x01,
+  0x21, 0x00, 0x81, 0x01, 0x1d, 0x00, 0x95, 0x01, 0x0b, 0x00, 0xac, 0x01, 0x11, 0x00, 0xc3, 0x01,
+  0x74, 0x01, 0xc8, 0x01, 0x76, 0x01, 0xe8, 0x01, 0x71, 0x01, 0x13, 0x02, 0x73, 0x01, 0x30, 0x02,
+  0xed, 0x00, 0x4a, 0x02, 0xfc, 0x00, 0x5e, 0x02, 0xe3, 0x00, 0x70, 0x02, 0x2e, 0x01, 0x74, 0x02,
+  0xee, 0x00, 0x88, 0x02, 0x99, 0x01, 0x95, 0x02, 0x7d, 0x01, 0xa7, 0x02, 0x87, 0x01, 0xb1, 0x02,
+  0x91, 0x01, 0xc0, 0x02, 0x9d, 0x01, 0xc1, 0x02, 0x84, 0x01, 0xd0, 0x02, 0x84, 0x01, 0x08, 0x00,
+  0x8a, 0x01, 0x0c, 0x00, 0x82, 0x01, 0x24, 0x00, 0x8b, 0x01, 0x3c, 0x00, 0x8f, 0x01, 0x7d, 0x00,
+  0x80, 0x01, 0x8c, 0x00, 0x85, 0x01, 0xbd, 0x00, 0x70, 0x00, 0xd1, 0x00, 0x66, 0x00, 0xe3, 0x00,
+  0xa5, 0x00, 0xed, 0x00, 0x89, 0x00, 0xf6, 0x00, 0xad, 0x00, 0xff, 0x00, 0x38, 0x00, 0x12, 0x01,
+  0x69, 0x00, 0x1e, 0x01, 0xa9, 0x00, 0x26, 0x01, 0x9a, 0x00, 0x44, 0x01, 0x29, 0x00, 0x4a, 0x01,
+  0x29, 0x01, 0x65, 0x01, 0x30, 0x00, 0x76, 0x01, 0x21, 0x00, 0x83, 0x01, 0x1d, 0x00, 0x95, 0x01,
+  0x22, 0x00, 0x96, 0x01, 0x0b, 0x00, 0xac, 0x01, 0x11, 0x00, 0xc2, 0x01, 0x74, 0x01, 0xc7, 0x01,
+  0x79, 0x01, 0xc9, 0x01, 0x76, 0x01, 0xe8, 0x01, 0x71, 0x01, 0x13, 0x02, 0x73, 0x01, 0x30, 0x02,
+  0xed, 0x00, 0x4a, 0x02, 0xfc, 0x00, 0x5e, 0x02, 0xe3, 0x00, 0x6f, 0x02, 0x2e, 0x01, 0x75, 0x02,
+  0xee, 0x00, 0x87, 0x02, 0x99, 0x01, 0x95, 0x02, 0x7d, 0x01, 0xa6, 0x02, 0x87, 0x01, 0xb2, 0x02,
+  0x91, 0x01, 0xc0, 0x02, 0x84, 0x01, 0xd0, 0x02, 0x84, 0x01, 0x08, 0x00, 0x82, 0x01, 0x24, 0x00,
+  0x8b, 0x01, 0x3b, 0x00, 0x9c, 0x01, 0x3c, 0x00, 0x8f, 0x01, 0x7d, 0x00, 0x80, 0x01, 0x8e, 0x00,
+  0x85, 0x01, 0xbd, 0x00, 0x70, 0x00, 0xce, 0x00, 0x85, 0x00, 0xd1, 0x00, 0x66, 0x00, 0xe3, 0x00,
+  0xa5, 0x00, 0xee, 0x00, 0x89, 0x00, 0xf6, 0x00, 0xad, 0x00, 0xfe, 0x00, 0x38, 0x00, 0x12, 0x01,
+  0x69, 0x00, 0x1c, 0x01, 0xa9, 0x00, 0x27, 0x01, 0x9a, 0x00, 0x44, 0x01, 0x29, 0x00, 0x46, 0x01,
+  0x29, 0x01, 0x66, 0x01, 0x30, 0x00, 0x75, 0x01, 0x21, 0x00, 0x85, 0x01, 0x1d, 0x00, 0x94, 0x01,
+  0x22, 0x00, 0x9a, 0x01, 0x0b, 0x00, 0xab, 0x01, 0x11, 0x00, 0xc1, 0x01, 0x74, 0x01, 0xc7, 0x01,
+  0x79, 0x01, 0xca, 0x01, 0x76, 0x01, 0xe8, 0x01, 0x71, 0x01, 0x12, 0x02, 0x73, 0x01, 0x31, 0x02,
+  0xed, 0x00, 0x4a, 0x02, 0xfc, 0x00, 0x5d, 0x02, 0xe3, 0x00, 0x6e, 0x02, 0x2e, 0x01, 0x76, 0x02,
+  0xee, 0x00, 0x86, 0x02, 0x99, 0x01, 0x96, 0x02, 0x7d, 0x01, 0xa5, 0x02, 0x87, 0x01, 0xb4, 0x02,
+  0x91, 0x01, 0xbf, 0x02, 0x84, 0x01, 0xd0, 0x02, 0x84, 0x01, 0x08, 0x00, 0x82, 0x01, 0x25, 0x00,
+  0x8b, 0x01, 0x38, 0x00, 0x9c, 0x01, 0x3d, 0x00, 0x8f, 0x01, 0x7b, 0x00, 0x97, 0x01, 0x7d, 0x00,
+  0x80, 0x01, 0x8f, 0x00, 0x85, 0x01, 0xbd, 0x00, 0x70, 0x00, 0xca, 0x00, 0x85, 0x00, 0xd2, 0x00,
+  0x66, 0x00, 0xe2, 0x00, 0xac, 0x00, 0xe3, 0x00, 0xa5, 0x00, 0xf0, 0x00, 0x89, 0x00, 0xf6, 0x00,
+  0xad, 0x00, 0xfd, 0x00, 0x38, 0x00, 0x13, 0x01, 0x69, 0x00, 0x1b, 0x01, 0xa9, 0x00, 0x29, 0x01,
+  0x9a, 0x00, 0x44, 0x01, 0x29, 0x01, 0x68, 0x01, 0x30, 0x00, 0x73, 0x01, 0x21, 0x00, 0x88, 0x01,
+  0x1d, 0x00, 0x94, 0x01, 0x22, 0x00, 0x9e, 0x01, 0x0b, 0x00, 0xab, 0x01, 0x11, 0x00, 0xc0, 0x01,
+  0x74, 0x01, 0xc6, 0x01, 0x79, 0x01, 0xca, 0x01, 0x76, 0x01, 0xe7, 0x01, 0x71, 0x01, 0x12, 0x02,
+  0x73, 0x01, 0x31, 0x02, 0x72, 0x01, 0x34, 0x02, 0xed, 0x00, 0x4a, 0x02, 0xfc, 0x00, 0x5d, 0x02,
+  0xe3, 0x00, 0x6d, 0x02, 0x2e, 0x01, 0x77, 0x02, 0xee, 0x00, 0x85, 0x02, 0x99, 0x01, 0x96, 0x02,
+  0x7d, 0x01, 0xa5, 0x02, 0x87, 0x01, 0xb5, 0x02, 0x91, 0x01, 0xbe, 0x02, 0x84, 0x01, 0xd0, 0x02,
+  0x84, 0x01, 0x08, 0x00, 0x82, 0x01, 0x26, 0x00, 0x8b, 0x01, 0x35, 0x00, 0x9c, 0x01, 0x3d, 0x00,
+  0x8f, 0x01, 0x7a, 0x00, 0x97, 0x01, 0x7d, 0x00, 0x80, 0x01, 0x90, 0x00, 0x85, 0x01, 0xbd, 0x00,
+  0x70, 0x00, 0xc6, 0x00, 0x85, 0x00, 0xd3, 0x00, 0x66, 0x00, 0xe0, 0x00, 0xac, 0x00, 0xe3, 0x00,
+  0xa5, 0x00, 0xf1, 0x00, 0x89, 0x00, 0xf6, 0x00, 0xad, 0x00, 0xfd, 0x00, 0x38, 0x00, 0x13, 0x01,
+  0x69, 0x00, 0x19, 0x01, 0x87, 0x00, 0x1d, 0x01, 0xa9, 0x00, 0x2b, 0x01, 0x9a, 0x00, 0x44, 0x01,
+  0x29, 0x01, 0x69, 0x01, 0x30, 0x00, 0x72, 0x01, 0x21, 0x00, 0x8a, 0x01, 0x1d, 0x00, 0x93, 0x01,
+  0x22, 0x00, 0xa3, 0x01, 0x0b, 0x00, 0xab, 0x01, 0x11, 0x00, 0xbe, 0x01, 0x74, 0x01, 0xc6, 0x01,
+  0x79, 0x01, 0xcb, 0x01, 0x76, 0x01, 0xe7, 0x01, 0x71, 0x01, 0x12, 0x02, 0x73, 0x01, 0x31, 0x02,
+  0x72, 0x01, 0x38, 0x02, 0xed, 0x00, 0x4b, 0x02, 0xfc, 0x00, 0x5c, 0x02, 0xe3, 0x00, 0x6d, 0x02,
+  0x2e, 0x01, 0x78, 0x02, 0xee, 0x00, 0x84, 0x02, 0x99, 0x01, 0x97, 0x02, 0x7d, 0x01, 0xa4, 0x02,
+  0x87, 0x01, 0xb7, 0x02, 0x91, 0x01, 0xbe, 0x02, 0x84, 0x01, 0xd0, 0x02, 0x84, 0x01, 0x08, 0x00,
+  0x82, 0x01, 0x27, 0x00, 0x8b, 0x01, 0x33, 0x00, 0x9c, 0x01, 0x3e, 0x00, 0x8f, 0x01, 0x78, 0x00,
+  0x97, 0x01, 0x7c, 0x00, 0x80, 0x01, 0x92, 0x00, 0x85, 0x01, 0xbd, 0x00, 0x70, 0x00, 0xc3, 0x00,
+  0x85, 0x00, 0xd3, 0x00, 0x66, 0x00, 0xdf, 0x00, 0xac, 0x00, 0xe4, 0x00, 0xa5, 0x00, 0xf3, 0x00,
+  0x89, 0x00, 0xf7, 0x00, 0xad, 0x00, 0xfc, 0x00, 0x38, 0x00, 0x13, 0x01, 0x69, 0x00, 0x17, 0x01,
+  0x87, 0x00, 0x1f, 0x01, 0xa9, 0x00, 0x2d, 0x01, 0x9a, 0x00, 0x43, 0x01, 0x29, 0x01, 0x6a, 0x01,
+  0x30, 0x00, 0x70, 0x01, 0x21, 0x00, 0x8c, 0x01, 0x1d, 0x00, 0x92, 0x01, 0x22, 0x00, 0xa7, 0x01,
+  0x0b, 0x00, 0xaa, 0x01, 0x11, 0x00, 0xbd, 0x01, 0x74, 0x01, 0xc5, 0x01, 0x79, 0x01, 0xcc, 0x01,
+  0x76, 0x01, 0xe7, 0x01, 0x71, 0x01, 0x12, 0x02, 0x73, 0x01, 0x31, 0x02, 0x72, 0x01, 0x3c, 0x02,
+  0xed, 0x00, 0x4b, 0x02, 0xfc, 0x00, 0x5b, 0x02, 0xe3, 0x00, 0x6c, 0x02, 0x2e, 0x01, 0x79, 0x02,
+  0xee, 0x00, 0x83, 0x02, 0x99, 0x01, 0x97, 0x02, 0x7d, 0x01, 0xa3, 0x02, 0x87, 0x01, 0xb8, 0x02,
+  0x91, 0x01, 0xbd, 0x02, 0x84, 0x01, 0xd0, 0x02, 0x84, 0x01, 0x08, 0x00, 0x82, 0x01, 0x28, 0x00,
+  0x8b, 0x01, 0x30, 0x00, 0x9c, 0x01, 0x3f, 0x00, 0x8f, 0x01, 0x77, 0x00, 0x97, 0x01, 0x7c, 0x00,
+  0x80, 0x01, 0x93, 0x00, 0x85, 0x01, 0xbd, 0x00, 0x70, 0x00, 0xbf, 0x00, 0x85, 0x00, 0xd4, 0x00,
+  0x66, 0x00, 0xdd, 0x00, 0xac, 0x00, 0xe4, 0x00, 0xa5, 0x00, 0xf4, 0x00, 0x89, 0x00, 0xf7, 0x00,
+  0xad, 0x00, 0xfb, 0x00, 0x38, 0x00, 0x13, 0x01, 0x48, 0x00, 0x18, 0x01, 0x87, 0x00, 0x21, 0x01,
+  0xa9, 0x00, 0x2e, 0x01, 0x9a, 0x00, 0x43, 0x01, 0x29, 0x01, 0x6c, 0x01, 0x30, 0x00, 0x6f, 0x01,
+  0x21, 0x00, 0x8e, 0x01, 0x1d, 0x00, 0x92, 0x01, 0x22, 0x00, 0xaa, 0x01, 0x11, 0x00, 0xbc, 0x01,
+  0x74, 0x01, 0xc5, 0x01, 0x79, 0x01, 0xcd, 0x01, 0x76, 0x01, 0xe7, 0x01, 0x71, 0x01, 0x12, 0x02,
+  0x73, 0x01, 0x32, 0x02, 0x72, 0x01, 0x40, 0x02, 0xed, 0x00, 0x4b, 0x02, 0xfc, 0x00, 0x5b, 0x02,
+  0xe3, 0x00, 0x6b, 0x02, 0x2e, 0x01, 0x7a, 0x02, 0xee, 0x00, 0x82, 0x02, 0x99, 0x01, 0x97, 0x02,
+  0x7d, 0x01, 0xa2, 0x02, 0x87, 0x01, 0xb9, 0x02, 0x91, 0x01, 0xbc, 0x02, 0x84, 0x01, 0xd0, 0x02,
+  0x84, 0x01, 0x07, 0x00, 0xa0, 0x01, 0x09, 0x00, 0x82, 0x01, 0x29, 0x00, 0x8b, 0x01, 0x2e, 0x00,
+  0x9c, 0x01, 0x40, 0x00, 0x8f, 0x01, 0x75, 0x00, 0x97, 0x01, 0x7c, 0x00, 0x80, 0x01, 0x94, 0x00,
+  0x85, 0x01, 0xbc, 0x00, 0x85, 0x00, 0xd5, 0x00, 0x66, 0x00, 0xdb, 0x00, 0xac, 0x00, 0xe4, 0x00,
+  0xa5, 0x00, 0xf5, 0x00, 0x5d, 0x00, 0xfb, 0x00, 0x38, 0x00, 0x12, 0x01, 0x48, 0x00, 0x19, 0x01,
+  0x87, 0x00, 0x23, 0x01, 0xa9, 0x00, 0x30, 0x01, 0x9a, 0x00, 0x42, 0x01, 0x29, 0x01, 0x6d, 0x01,
+  0x21, 0x00, 0x91, 0x01, 0x22, 0x00, 0xab, 0x01, 0x11, 0x00, 0xbb, 0x01, 0x74, 0x01, 0xc4, 0x01,
+  0x79, 0x01, 0xce, 0x01, 0x76, 0x01, 0xe7, 0x01, 0x71, 0x01, 0x11, 0x02, 0x73, 0x01, 0x32, 0x02,
+  0x72, 0x01, 0x44, 0x02, 0xed, 0x00, 0x4b, 0x02, 0xfc, 0x00, 0x5a, 0x02, 0xe3, 0x00, 0x6a, 0x02,
+  0x2e, 0x01, 0x7b, 0x02, 0xee, 0x00, 0x81, 0x02, 0x99, 0x01, 0x98, 0x02, 0x7d, 0x01, 0xa2, 0x02,
+  0x87, 0x01, 0xb9, 0x02, 0x81, 0x01, 0xbd, 0x02, 0x84, 0x01, 0xd0, 0x02, 0x84, 0x01, 0x06, 0x00,
+  0xa0, 0x01, 0x0a, 0x00, 0x82, 0x01, 0x29, 0x00, 0x9a, 0x01, 0x2b, 0x00, 0x9c, 0x01, 0x41, 0x00,
+  0x8f, 0x01, 0x73, 0x00, 0x97, 0x01, 0x7c, 0x00, 0x80, 0x01, 0x96, 0x00, 0x85, 0x01, 0xbb, 0x00,
+  0x85, 0x00, 0xd6, 0x00, 0x66, 0x00, 0xda, 0x00, 0xac, 0x00, 0xe5, 0x00, 0xa5, 0x00, 0xf4, 0x00,
+  0x5d, 0x00, 0xfc, 0x00, 0x38, 0x00, 0x12, 0x01, 0x48, 0x00, 0x1a, 0x01, 0x87, 0x00, 0x25, 0x01,
+  0xa9, 0x00, 0x32, 0x01, 0x9a, 0x00, 0x42, 0x01, 0x29, 0x01, 0x6e, 0x01, 0x21, 0x00, 0x91, 0x01,
+  0x22, 0x00, 0xab, 0x01, 0x09, 0x00, 0xac, 0x01, 0x11, 0x00, 0xb9, 0x01, 0x74, 0x01, 0xc3, 0x01,
+  0x79, 0x01, 0xce, 0x01, 0x76, 0x01, 0xe7, 0x01, 0x71, 0x01, 0x11, 0x02, 0x73, 0x01, 0x32, 0x02,
+  0x72, 0x01, 0x49, 0x02, 0xed, 0x00, 0x4b, 0x02, 0xfc, 0x00, 0x5a, 0x02, 0xe3, 0x00, 0x6a, 0x02,
+  0x2e, 0x01, 0x7c, 0x02, 0xee, 0x00, 0x80, 0x02, 0x99, 0x01, 0x98, 0x02, 0x7d, 0x01, 0xa1, 0x02,
+  0x87, 0x01, 0xb8, 0x02, 0x81, 0x01, 0xbe, 0x02, 0x84, 0x01, 0xd0, 0x02, 0x84, 0x01, 0x04, 0x00,
+  0xa0, 0x01, 0x0b, 0x00, 0x82, 0x01, 0x28, 0x00, 0x9a, 0x01, 0x2c, 0x00, 0x9c, 0x01, 0x42, 0x00,
+  0x8f, 0x01, 0x72, 0x00, 0x97, 0x01, 0x7c, 0x00, 0x80, 0x01, 0x97, 0x00, 0x85, 0x01, 0xba, 0x00,
+  0x85, 0x00, 0xd6, 0x00, 0x66, 0x00, 0xd8, 0x00, 0xac, 0x00, 0xe5, 0x00, 0xa5, 0x00, 0xf3, 0x00,
+  0x5d, 0x00, 0xfd, 0x00, 0x38, 0x00, 0x11, 0x01, 0x48, 0x00, 0x1b, 0x01, 0x87, 0x00, 0x27, 0x01,
+  0xa9, 0x00, 0x34, 0x01, 0x9a, 0x00, 0x41, 0x01, 0x29, 0x01, 0x6e, 0x01, 0x21, 0x00, 0x91, 0x01,
+  0x22, 0x00, 0xaa, 0x01, 0x09, 0x00, 0xae, 0x01, 0x11, 0x00, 0xb8, 0x01, 0x74, 0x01, 0xc3, 0x01,
+  0x79, 0x01, 0xcf, 0x01, 0x76, 0x01, 0xe6, 0x01, 0x71, 0x01, 0x11, 0x02, 0x73, 0x01, 0x32, 0x02,
+  0x72, 0x01, 0x4b, 0x02, 0xfc, 0x00, 0x59, 0x02, 0xe3, 0x00, 0x69, 0x02, 0x2e, 0x01, 0x7d, 0x02,
+  0xee, 0x00, 0x7e, 0x02, 0x99, 0x01, 0x99, 0x02, 0x7d, 0x01, 0xa0, 0x02, 0x87, 0x01, 0xb7, 0x02,
+  0x81, 0x01, 0xbf, 0x02, 0x84, 0x01, 0xd0, 0x02, 0x84, 0x01, 0x03, 0x00, 0xa0, 0x01, 0x0c, 0x00,
+  0x82, 0x01, 0x24, 0x00, 0x95, 0x01, 0x27, 0x00, 0x9a, 0x01, 0x2c, 0x00, 0x9c, 0x01, 0x43, 0x00,
+  0x8f, 0x01, 0x70, 0x00, 0x97, 0x01, 0x7c, 0x00, 0x80, 0x01, 0x98, 0x00, 0x85, 0x01, 0xb9, 0x00,
+  0x85, 0x00, 0xd7, 0x00, 0xac, 0x00, 0xe5, 0x00, 0xa5, 0x00, 0xf3, 0x00, 0x5d, 0x00, 0xfe, 0x00,
+  0x38, 0x00, 0x10, 0x01, 0x48, 0x00, 0x1c, 0x01, 0x87, 0x00, 0x29, 0x01, 0xa9, 0x00, 0x36, 0x01,
+  0x9a, 0x00, 0x41, 0x01, 0x29, 0x01, 0x6e, 0x01, 0x21, 0x00, 0x90, 0x01, 0x22, 0x00, 0xaa, 0x01,
+  0x09, 0x00, 0xb0, 0x01, 0x11, 0x00, 0xb7, 0x01, 0x74, 0x01, 0xc2, 0x01, 0x79, 0x01, 0xd0, 0x01,
+  0x76, 0x01, 0xe6, 0x01, 0x71, 0x01, 0x11, 0x02, 0x73, 0x01, 0x32, 0x02, 0x72, 0x01, 0x4c, 0x02,
+  0xfc, 0x00, 0x59, 0x02, 0xe3, 0x00, 0x68, 0x02, 0x2e, 0x01, 0x7e, 0x02, 0x99, 0x01, 0x99, 0x02,
+  0x7d, 0x01, 0xa0, 0x02, 0x87, 0x01, 0xb6, 0x02, 0x81, 0x01, 0xc0, 0x02, 0x84, 0x01, 0xd0, 0x02,
+  0x84, 0x01, 0x02, 0x00, 0xa0, 0x01, 0x0c, 0x00, 0x82, 0x01, 0x1c, 0x00, 0x95, 0x01, 0x26, 0x00,
+  0x9a, 0x01, 0x2c, 0x00, 0x9c, 0x01, 0x43, 0x00, 0x8f, 0x01, 0x6f, 0x00, 0x97, 0x01, 0x7c, 0x00,
+  0x80, 0x01, 0x9a, 0x00, 0x85, 0x01, 0xb8, 0x00, 0x85, 0x00, 0xd7, 0x00, 0xac, 0x00, 0xe6, 0x00,
+  0xa5, 0x00, 0xf2, 0x00, 0x5d, 0x00, 0xff, 0x00, 0x38, 0x00, 0x10, 0x01, 0x48, 0x00, 0x1e, 0x01,
+  0x87, 0x00, 0x2b, 0x01, 0xa9, 0x00, 0x37, 0x01, 0x9a, 0x00, 0x40, 0x01, 0x29, 0x01, 0x6f, 0x01,
+  0x21, 0x00, 0x90, 0x01, 0x22, 0x00, 0xa9, 0x01, 0x09, 0x00, 0xb2, 0x01, 0x11, 0x00, 0xb5, 0x01,
+  0x74, 0x01, 0xc2, 0x01, 0x79, 0x01, 0xd1, 0x01, 0x76, 0x01, 0xe6, 0x01, 0x71, 0x01, 0x11, 0x02,
+  0x73, 0x01, 0x33, 0x02, 0x72, 0x01, 0x4c, 0x02, 0xfc, 0x00, 0x58, 0x02, 0xe3, 0x00, 0x67, 0x02,
+  0x2e, 0x01, 0x7e, 0x02, 0x99, 0x01, 0x99, 0x02, 0x7d, 0x01, 0x9f, 0x02, 0x87, 0x01, 0xb5, 0x02,
+  0x81, 0x01, 0xc0, 0x02, 0x84, 0x01, 0xd0, 0x02, 0x84, 0x01, 0x01, 0x00, 0xa0, 0x01, 0x0d, 0x00,
+  0x7b, 0x01, 0x14, 0x00, 0x95, 0x01, 0x26, 0x00, 0x9a, 0x01, 0x2d, 0x00, 0x9c, 0x01, 0x44, 0x00,
+  0x8f, 0x01, 0x6d, 0x00, 0x97, 0x01, 0x7c, 0x00, 0x80, 0x01, 0x9b, 0x00, 0x85, 0x01, 0xb8, 0x00,
+  0x85, 0x00, 0xd8, 0x00, 0xac, 0x00, 0xe6, 0x00, 0xa5, 0x00, 0xf1, 0x00, 0x5d, 0x00, 0x01, 0x01,
+  0x38, 0x00, 0x0f, 0x01, 0x48, 0x00, 0x1f, 0x01, 0x87, 0x00, 0x2d, 0x01, 0xa9, 0x00, 0x39, 0x01,
+  0x9a, 0x00, 0x40, 0x01, 0x29, 0x01, 0x6f, 0x01, 0x21, 0x00, 0x90, 0x01, 0x22, 0x00, 0xa9, 0x01,
+  0x09, 0x00, 0xb4, 0x01, 0x74, 0x01, 0xc1, 0x01, 0x79, 0x01, 0xd2, 0x01, 0x76, 0x01, 0xe3, 0x01,
+  0x78, 0x01, 0xe6, 0x01, 0x71, 0x01, 0x10, 0x02, 0x73, 0x01, 0x33, 0x02, 0x72, 0x01, 0x4c, 0x02,
+  0xfc, 0x00, 0x57, 0x02, 0xe3, 0x00, 0x66, 0x02, 0x2e, 0x01, 0x7e, 0x02, 0x99, 0x01, 0x9a, 0x02,
+  0x7d, 0x01, 0x9e, 0x02, 0x87, 0x01, 0xb4, 0x02, 0x81, 0x01, 0xc1, 0x02, 0x84, 0x01, 0xd0, 0x02,
+  0xa0, 0x01, 0x0c, 0x00, 0x7b, 0x01, 0x13, 0x00, 0x95, 0x01, 0x25, 0x00, 0x9a, 0x01, 0x2d, 0x00,
+  0x9c, 0x01, 0x45, 0x00, 0x8f, 0x01, 0x6b, 0x00, 0x97, 0x01, 0x7c, 0x00, 0x80, 0x01, 0x9d, 0x00,
+  0x85, 0x01, 0xb7, 0x00, 0x85, 0x00, 0xd8, 0x00, 0xac, 0x00, 0xe6, 0x00, 0xa5, 0x00, 0xf0, 0x00,
+  0x5d, 0x00, 0x02, 0x01, 0x38, 0x00, 0x0f, 0x01, 0x48, 0x00, 0x20, 0x01, 0x87, 0x00, 0x30, 0x01,
+  0xa9, 0x00, 0x3b, 0x01, 0x9a, 0x00, 0x3f, 0x01, 0x29, 0x01, 0x70, 0x01, 0x21, 0x00, 0x90, 0x01,
+  0x22, 0x00, 0xa8, 0x01, 0x09, 0x00, 0xb5, 0x01, 0x74, 0x01, 0xc0, 0x01, 0x79, 0x01, 0xd3, 0x01,
+  0x76, 0x01, 0xdc, 0x01, 0x78, 0x01, 0xe7, 0x01, 0x71, 0x01, 0x10, 0x02, 0x73, 0x01, 0x33, 0x02,
+  0x72, 0x01, 0x4d, 0x02, 0xfc, 0x00, 0x57, 0x02, 0xe3, 0x00, 0x66, 0x02, 0x2e, 0x01, 0x7f, 0x02,
+  0x99, 0x01, 0x9a, 0x02, 0x7d, 0x01, 0x9d, 0x02, 0x87, 0x01, 0xb3, 0x02, 0x81, 0x01, 0xc2, 0x02,
+  0x84, 0x01, 0xd0, 0x02, 0xa0, 0x01, 0x0c, 0x00, 0x7b, 0x01, 0x13, 0x00, 0x95, 0x01, 0x24, 0x00,
+  0x9a, 0x01, 0x2e, 0x00, 0x9c, 0x01, 0x46, 0x00, 0x8f, 0x01, 0x6a, 0x00, 0x97, 0x01, 0x7b, 0x00,
+  0x80, 0x01, 0x9e, 0x00, 0x85, 0x01, 0xb6, 0x00, 0x85, 0x00, 0xd8, 0x00, 0xac, 0x00, 0xe6, 0x00,
+  0xa5, 0x00, 0xef, 0x00, 0x5d, 0x00, 0x03, 0x01, 0x38, 0x00, 0x0e, 0x01, 0x48, 0x00, 0x21, 0x01,
+  0x87, 0x00, 0x32, 0x01, 0xa9, 0x00, 0x3d, 0x01, 0x9a, 0x00, 0x3f, 0x01, 0x29, 0x01, 0x70, 0x01,
+  0x21, 0x00, 0x90, 0x01, 0x22, 0x00, 0xa7, 0x01, 0x23, 0x00, 0xa8, 0x01, 0x09, 0x00, 0xb5, 0x01,
+  0x74, 0x01, 0xc0, 0x01, 0x79, 0x01, 0xd3, 0x01, 0x78, 0x01, 0xe8, 0x01, 0x71, 0x01, 0x10, 0x02,
+  0x73, 0x01, 0x33, 0x02, 0x72, 0x01, 0x4d, 0x02, 0xfc, 0x00, 0x56, 0x02, 0xe3, 0x00, 0x65, 0x02,
+  0x2e, 0x01, 0x7f, 0x02, 0x99, 0x01, 0x9b, 0x02, 0x7d, 0x01, 0x9d, 0x02, 0x87, 0x01, 0xb2, 0x02,
+  0x81, 0x01, 0xc3, 0x02, 0x84, 0x01, 0xcf, 0x02, 0xa0, 0x01, 0xd0, 0x02, 0xa0, 0x01, 0x0c, 0x00,
+  0x7b, 0x01, 0x12, 0x00, 0x95, 0x01, 0x24, 0x00, 0x9a, 0x01, 0x2e, 0x00, 0x9c, 0x01, 0x47, 0x00,
+  0x8f, 0x01, 0x67, 0x00, 0x86, 0x01, 0x69, 0x00, 0x97, 0x01, 0x7b, 0x00, 0x80, 0x01, 0x9f, 0x00,
+  0x85, 0x01, 0xb5, 0x00, 0x85, 0x00, 0xd8, 0x00, 0x84, 0x00, 0xe1, 0x00, 0xac, 0x00, 0xe7, 0x00,
+  0xa5, 0x00, 0xee, 0x00, 0x5d, 0x00, 0x04, 0x01, 0x38, 0x00, 0x0d, 0x01, 0x48, 0x00, 0x23, 0x01,
+  0x87, 0x00, 0x34, 0x01, 0xa9, 0x00, 0x3e, 0x01, 0x29, 0x01, 0x70, 0x01, 0x21, 0x00, 0x8f, 0x01,
+  0x22, 0x00, 0xa3, 0x01, 0x23, 0x00, 0xa8, 0x01, 0x09, 0x00, 0xb6, 0x01, 0x74, 0x01, 0xbf, 0x01,
+  0x79, 0x01, 0xd3, 0x01, 0x7a, 0x01, 0xd4, 0x01, 0x78, 0x01, 0xe9, 0x01, 0x71, 0x01, 0x10, 0x02,
+  0x73, 0x01, 0x33, 0x02, 0x72, 0x01, 0x4e, 0x02, 0xfc, 0x00, 0x56, 0x02, 0xe3, 0x00, 0x64, 0x02,
+  0x2e, 0x01, 0x7f, 0x02, 0x99, 0x01, 0x9b, 0x02, 0x7d, 0x01, 0x9c, 0x02, 0x87, 0x01, 0xb1, 0x02,
+  0x81, 0x01, 0xc3, 0x02, 0x83, 0x01, 0xcc, 0x02, 0x84, 0x01, 0xce, 0x02, 0xa0, 0x01, 0xd0, 0x02,
+  0xa0, 0x01, 0x0c, 0x00, 0x7b, 0x01, 0x12, 0x00, 0x95, 0x01, 0x23, 0x00, 0x9a, 0x01, 0x2e, 0x00,
+  0x9c, 0x01, 0x48, 0x00, 0x8f, 0x01, 0x64, 0x00, 0x86, 0x01, 0x68, 0x00, 0x97, 0x01, 0x7b, 0x00,
+  0x80, 0x01, 0xa1, 0x00, 0x85, 0x01, 0xb4, 0x00, 0x85, 0x00, 0xd7, 0x00, 0x84, 0x00, 0xe8, 0x00,
+  0xa5, 0x00, 0xed, 0x00, 0x5d, 0x00, 0x05, 0x01, 0x38, 0x00, 0x0d, 0x01, 0x48, 0x00, 0x24, 0x01,
+  0x87, 0x00, 0x36, 0x01, 0xa9, 0x00, 0x3e, 0x01, 0x29, 0x01, 0x71, 0x01, 0x21, 0x00, 0x8f, 0x01,
+  0x22, 0x00, 0x9e, 0x01, 0x23, 0x00, 0xa7, 0x01, 0x09, 0x00, 0xb6, 0x01, 0x74, 0x01, 0xbf, 0x01,
+  0x79, 0x01, 0xd0, 0x01, 0x70, 0x01, 0xd2, 0x01, 0x7a, 0x01, 0xd4, 0x01, 0x78, 0x01, 0xea, 0x01,
+  0x71, 0x01, 0x10, 0x02, 0x73, 0x01, 0x34, 0x02, 0x72, 0x01, 0x4e, 0x02, 0xfc, 0x00, 0x55, 0x02,
+  0xe3, 0x00, 0x63, 0x02, 0x2e, 0x01, 0x7f, 0x02, 0x99, 0x01, 0x9b, 0x02, 0x87, 0x01, 0xb0, 0x02,
+  0x81, 0x01, 0xc3, 0x02, 0x83, 0x01, 0xcf, 0x02, 0xa0, 0x01, 0xd0, 0x02, 0xa0, 0x01, 0x0c, 0x00,
+  0x7b, 0x01, 0x11, 0x00, 0x95, 0x01, 0x22, 0x00, 0x9a, 0x01, 0x2f, 0x00, 0x9c, 0x01, 0x49, 0x00,
+  0x8f, 0x01, 0x61, 0x00, 0x86, 0x01, 0x68, 0x00, 0x97, 0x01, 0x7b, 0x00, 0x80, 0x01, 0xa2, 0x00,
+  0x85, 0x01, 0xb3, 0x00, 0x85, 0x00, 0xd7, 0x00, 0x84, 0x00, 0xea, 0x00, 0xa5, 0x00, 0xec, 0x00,
+  0x5d, 0x00, 0x06, 0x01, 0x38, 0x00, 0x0c, 0x01, 0x48, 0x00, 0x25, 0x01, 0x87, 0x00, 0x39, 0x01,
+  0xa9, 0x00, 0x3e, 0x01, 0x29, 0x01, 0x71, 0x01, 0x21, 0x00, 0x8f, 0x01, 0x22, 0x00, 0x99, 0x01,
+  0x23, 0x00, 0xa7, 0x01, 0x09, 0x00, 0xb7, 0x01, 0x74, 0x01, 0xbe, 0x01, 0x79, 0x01, 0xce, 0x01,
+  0x70, 0x01, 0xd2, 0x01, 0x7a, 0x01, 0xd4, 0x01, 0x78, 0x01, 0xeb, 0x01, 0x71, 0x01, 0x0f, 0x02,
+  0x73, 0x01, 0x34, 0x02, 0x72, 0x01, 0x4e, 0x02, 0xfc, 0x00, 0x54, 0x02, 0xe3, 0x00, 0x63, 0x02,
+  0x2e, 0x01, 0x7f, 0x02, 0x99, 0x01, 0x98, 0x02, 0x31, 0x01, 0x9c, 0x02, 0x87, 0x01, 0xaf, 0x02,
+  0x81, 0x01, 0xc3, 0x02, 0x83, 0x01, 0xcf, 0x02, 0xa0, 0x01, 0xd0, 0x02, 0xa0, 0x01, 0x0c, 0x00,
+  0x7b, 0x01, 0x11, 0x00, 0x95, 0x01, 0x22, 0x00, 0x9a, 0x01, 0x2f, 0x00, 0x9c, 0x01, 0x4a, 0x00,
+  0x8f, 0x01, 0x5e, 0x00, 0x86, 0x01, 0x67, 0x00, 0x97, 0x01, 0x7b, 0x00, 0x80, 0x01, 0xa4, 0x00,
+  0x85, 0x01, 0xb2, 0x00, 0x85, 0x00, 0xd6, 0x00, 0x84, 0x00, 0xec, 0x00, 0x5d, 0x00, 0x07, 0x01,
+  0x38, 0x00, 0x0b, 0x01, 0x48, 0x00, 0x26, 0x01, 0x87, 0x00, 0x3b, 0x01, 0xa9, 0x00, 0x3e, 0x01,
+  0x29, 0x01, 0x72, 0x01, 0x21, 0x00, 0x8d, 0x01, 0x33, 0x00, 0x8f, 0x01, 0x22, 0x00, 0x93, 0x01,
+  0x23, 0x00, 0xa7, 0x01, 0x17, 0x00, 0xa8, 0x01, 0x09, 0x00, 0xb7, 0x01, 0x74, 0x01, 0xbe, 0x01,
+  0x79, 0x01, 0xcb, 0x01, 0x70, 0x01, 0xd2, 0x01, 0x7a, 0x01, 0xd5, 0x01, 0x78, 0x01, 0xec, 0x01,
+  0x71, 0x01, 0x0f, 0x02, 0x73, 0x01, 0x34, 0x02, 0x72, 0x01, 0x4f, 0x02, 0xfc, 0x00, 0x54, 0x02,
+  0xe3, 0x00, 0x62, 0x02, 0x2e, 0x01, 0x7f, 0x02, 0x99, 0x01, 0x92, 0x02, 0x31, 0x01, 0x9d, 0x02,
+  0x87, 0x01, 0xae, 0x02, 0x81, 0x01, 0xc3, 0x02, 0x83, 0x01, 0xd0, 0x02, 0x83, 0x01, 0x01, 0x00,
+  0xa0, 0x01, 0x0c, 0x00, 0x7b, 0x01, 0x10, 0x00, 0x95, 0x01, 0x21, 0x00, 0x9a, 0x01, 0x2f, 0x00,
+  0x9c, 0x01, 0x4b, 0x00, 0x8f, 0x01, 0x5b, 0x00, 0x86, 0x01, 0x67, 0x00, 0x97, 0x01, 0x7b, 0x00,
+  0x80, 0x01, 0xa5, 0x00, 0x85, 0x01, 0xb1, 0x00, 0x85, 0x00, 0xd6, 0x00, 0x84, 0x00, 0xec, 0x00,
+  0x5d, 0x00, 0x09, 0x01, 0x38, 0x00, 0x0b, 0x01, 0x48, 0x00, 0x28, 0x01, 0x87, 0x00, 0x3d, 0x01,
+  0x29, 0x01, 0x72, 0x01, 0x21, 0x00, 0x8a, 0x01, 0x33, 0x00, 0x90, 0x01, 0x23, 0x00, 0xa6, 0x01,
+  0x17, 0x00, 0xa8, 0x01, 0x09, 0x00, 0xb8, 0x01, 0x74, 0x01, 0xbd, 0x01, 0x79, 0x01, 0xc8, 0x01,
+  0x70, 0x01, 0xd1, 0x01, 0x7a, 0x01, 0xd5, 0x01, 0x78, 0x01, 0xed, 0x01, 0x71, 0x01, 0x0f, 0x02,
+  0x73, 0x01, 0x34, 0x02, 0x72, 0x01, 0x4f, 0x02, 0xfc, 0x00, 0x53, 0x02, 0xe3, 0x00, 0x61, 0x02,
+  0x2e, 0x01, 0x80, 0x02, 0x99, 0x01, 0x8b, 0x02, 0x31, 0x01, 0x9e, 0x02, 0x87, 0x01, 0xad, 0x02,
+  0x81, 0x01, 0xc3, 0x02, 0x83, 0x01, 0xd0, 0x02, 0x83, 0x01, 0x02, 0x00, 0xa0, 0x01, 0x0c, 0x00,
+  0x7b, 0x01, 0x10, 0x00, 0x95, 0x01, 0x1e, 0x00, 0x92, 0x01, 0x20, 0x00, 0x9a, 0x01, 0x30, 0x00,
+  0x9c, 0x01, 0x4c, 0x00, 0x8f, 0x01, 0x58, 0x00, 0x86, 0x01, 0x66, 0x00, 0x97, 0x01, 0x7b, 0x00,
+  0x80, 0x01, 0xa7, 0x00, 0x85, 0x01, 0xb0, 0x00, 0x85, 0x00, 0xd5, 0x00, 0x84, 0x00, 0xec, 0x00,
+  0x5d, 0x00, 0x08, 0x01, 0xb0, 0x00, 0x0c, 0x01, 0x48, 0x00, 0x29, 0x01, 0x87, 0x00, 0x3d, 0x01,
+  0x29, 0x01, 0x72, 0x01, 0x21, 0x00, 0x86, 0x01, 0x33, 0x00, 0x91, 0x01, 0x23, 0x00, 0xa5, 0x01,
+  0x17, 0x00, 0xa9, 0x01, 0x09, 0x00, 0xb8, 0x01, 0x74, 0x01, 0xbc, 0x01, 0x79, 0x01, 0xc5, 0x01,
+  0x70, 0x01, 0xd1, 0x01, 0x7a, 0x01, 0xd5, 0x01, 0x78, 0x01, 0xee, 0x01, 0x71, 0x01, 0x0f, 0x02,
+  0x73, 0x01, 0x35, 0x02, 0x72, 0x01, 0x50, 0x02, 0xfc, 0x00, 0x53, 0x02, 0xe3, 0x00, 0x60, 0x02,
+  0x2e, 0x01, 0x80, 0x02, 0x99, 0x01, 0x84, 0x02, 0x31, 0x01, 0x9f, 0x02, 0x87, 0x01, 0xac, 0x02,
+  0x81, 0x01, 0xc3, 0x02, 0x83, 0x01, 0xd0, 0x02, 0x83, 0x01, 0x03, 0x00, 0xa0, 0x01, 0x0b, 0x00,
+  0x7b, 0x01, 0x10, 0x00, 0x95, 0x01, 0x18, 0x00, 0x92, 0x01, 0x20, 0x00, 0x9a, 0x01, 0x30, 0x00,
+  0x9c, 0x01, 0x4c, 0x00, 0x8f, 0x01, 0x54, 0x00, 0x86, 0x01, 0x66, 0x00, 0x97, 0x01, 0x7b, 0x00,
+  0x80, 0x01, 0xa8, 0x00, 0x85, 0x01, 0xaf, 0x00, 0x85, 0x00, 0xd5, 0x00, 0x84, 0x00, 0xec, 0x00,
+  0x5d, 0x00, 0x05, 0x01, 0x52, 0x00, 0x08, 0x01, 0xb0, 0x00, 0x0d, 0x01, 0x48, 0x00, 0x2a, 0x01,
+  0x87, 0x00, 0x3d, 0x01, 0x29, 0x01, 0x73, 0x01, 0x21, 0x00, 0x82, 0x01, 0x33, 0x00, 0x92, 0x01,
+  0x23, 0x00, 0xa4, 0x01, 0x17, 0x00, 0xa9, 0x01, 0x09, 0x00, 0xb9, 0x01, 0x74, 0x01, 0xbc, 0x01,
+  0x79, 0x01, 0xc2, 0x01, 0x70, 0x01, 0xd1, 0x01, 0x7a, 0x01, 0xd6, 0x01, 0x78, 0x01, 0xef, 0x01,
+  0x71, 0x01, 0x0f, 0x02, 0x73, 0x01, 0x35, 0x02, 0x72, 0x01, 0x50, 0x02, 0xfc, 0x00, 0x52, 0x02,
+  0xe3, 0x00, 0x5f, 0x02, 0x2e, 0x01, 0x80, 0x02, 0x31, 0x01, 0xa0, 0x02, 0x87, 0x01, 0xab, 0x02,
+  0x81, 0x01, 0xc3, 0x02, 0x83, 0x01, 0xd0, 0x02, 0x83, 0x01, 0x04, 0x00, 0xa0, 0x01, 0x0b, 0x00,
+  0x7b, 0x01, 0x0f, 0x00, 0x95, 0x01, 0x12, 0x00, 0x92, 0x01, 0x20, 0x00, 0x9a, 0x01, 0x31, 0x00,
+  0x9c, 0x01, 0x4d, 0x00, 0x8f, 0x01, 0x51, 0x00, 0x86, 0x01, 0x66, 0x00, 0x97, 0x01, 0x7b, 0x00,
+  0x80, 0x01, 0xaa, 0x00, 0x85, 0x01, 0xae, 0x00, 0x85, 0x00, 0xd4, 0x00, 0x84, 0x00, 0xec, 0x00,
+  0x5d, 0x00, 0x02, 0x01, 0x52, 0x00, 0x07, 0x01, 0xb0, 0x00, 0x0f, 0x01, 0x48, 0x00, 0x2c, 0x01,
+  0x87, 0x00, 0x3d, 0x01, 0x29, 0x01, 0x73, 0x01, 0x21, 0x00, 0x7e, 0x01, 0x33, 0x00, 0x92, 0x01,
+  0x23, 0x00, 0xa3, 0x01, 0x17, 0x00, 0xaa, 0x01, 0x09, 0x00, 0xba, 0x01, 0x74, 0x01, 0xbb, 0x01,
+  0x79, 0x01, 0xbf, 0x01, 0x70, 0x01, 0xd1, 0x01, 0x7a, 0x01, 0xd6, 0x01, 0x78, 0x01, 0xf0, 0x01,
+  0x71, 0x01, 0x0e, 0x02, 0x73, 0x01, 0x35, 0x02, 0x72, 0x01, 0x51, 0x02, 0xe3, 0x00, 0x5e, 0x02,
+  0x2e, 0x01, 0x7f, 0x02, 0x31, 0x01, 0xa1, 0x02, 0x87, 0x01, 0xaa, 0x02, 0x81, 0x01, 0xc3, 0x02,
+  0x83, 0x01, 0xd0, 0x02, 0x83, 0x01, 0x05, 0x00, 0xa0, 0x01, 0x08, 0x00, 0x9e, 0x01, 0x0c, 0x00,
+  0x7b, 0x01, 0x0d, 0x00, 0x92, 0x01, 0x20, 0x00, 0x9a, 0x01, 0x31, 0x00, 0x9c, 0x01, 0x4e, 0x00,
+  0x86, 0x01, 0x65, 0x00, 0x97, 0x01, 0x7a, 0x00, 0x80, 0x01, 0xab, 0x00, 0x85, 0x01, 0xad, 0x00,
+  0x85, 0x00, 0xd4, 0x00, 0x84, 0x00, 0xec, 0x00, 0x5d, 0x00, 0xff, 0x00, 0x52, 0x00, 0x07, 0x01,
+  0xb0, 0x00, 0x10, 0x01, 0x48, 0x00, 0x2d, 0x01, 0x87, 0x00, 0x3c, 0x01, 0x29, 0x01, 0x74, 0x01,
+  0x21, 0x00, 0x79, 0x01, 0x33, 0x00, 0x93, 0x01, 0x23, 0x00, 0xa2, 0x01, 0x17, 0x00, 0xab, 0x01,
+  0x09, 0x00, 0xba, 0x01, 0x79, 0x01, 0xbc, 0x01, 0x70, 0x01, 0xd0, 0x01, 0x7a, 0x01, 0xd6, 0x01,
+  0x78, 0x01, 0xf1, 0x01, 0x71, 0x01, 0x0e, 0x02, 0x73, 0x01, 0x35, 0x02, 0x72, 0x01, 0x51, 0x02,
+  0xe3, 0x00, 0x5e, 0x02, 0x2e, 0x01, 0x7f, 0x02, 0x31, 0x01, 0xa2, 0x02, 0x87, 0x01, 0xa8, 0x02,
+  0x94, 0x01, 0xa9, 0x02, 0x81, 0x01, 0xc3, 0x02, 0x83, 0x01, 0xd0, 0x02, 0x83, 0x01, 0x05, 0x00,
+  0x9e, 0x01, 0x0d, 0x00, 0x92, 0x01, 0x1f, 0x00, 0x9a, 0x01, 0x31, 0x00, 0x9c, 0x01, 0x4e, 0x00,
+  0x86, 0x01, 0x65, 0x00, 0x97, 0x01, 0x7a, 0x00, 0x80, 0x01, 0xac, 0x00, 0x85, 0x00, 0xd3, 0x00,
+  0x84, 0x00, 0xec, 0x00, 0x5d, 0x00, 0xfb, 0x00, 0x52, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x12, 0x01,
+  0x48, 0x00, 0x2e, 0x01, 0x87, 0x00, 0x3c, 0x01, 0x29, 0x01, 0x74, 0x01, 0x21, 0x00, 0x75, 0x01,
+  0x33, 0x00, 0x94, 0x01, 0x23, 0x00, 0xa1, 0x01, 0x17, 0x00, 0xab, 0x01, 0x09, 0x00, 0xba, 0x01,
+  0x70, 0x01, 0xd0, 0x01, 0x7a, 0x01, 0xd7, 0x01, 0x78, 0x01, 0xf2, 0x01, 0x71, 0x01, 0x0e, 0x02,
+  0x73, 0x01, 0x35, 0x02, 0x72, 0x01, 0x51, 0x02, 0xe3, 0x00, 0x5d, 0x02, 0x2e, 0x01, 0x7e, 0x02,
+  0x31, 0x01, 0xa3, 0x02, 0x87, 0x01, 0xa6, 0x02, 0x94, 0x01, 0xac, 0x02, 0x81, 0x01, 0xc3, 0x02,
+  0x83, 0x01, 0xd0, 0x02, 0x83, 0x01, 0x05, 0x00, 0x9e, 0x01, 0x0d, 0x00, 0x92, 0x01, 0x1f, 0x00,
+  0x9a, 0x01, 0x32, 0x00, 0x9c, 0x01, 0x4d, 0x00, 0x86, 0x01, 0x64, 0x00, 0x97, 0x01, 0x7a, 0x00,
+  0x80, 0x01, 0xad, 0x00, 0x85, 0x00, 0xd2, 0x00, 0x84, 0x00, 0xec, 0x00, 0x5d, 0x00, 0xf8, 0x00,
+  0x52, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x13, 0x01, 0x48, 0x00, 0x30, 0x01, 0x87, 0x00, 0x3c, 0x01,
+  0x29, 0x01, 0x74, 0x01, 0x33, 0x00, 0x94, 0x01, 0x23, 0x00, 0xa0, 0x01, 0x17, 0x00, 0xac, 0x01,
+  0x09, 0x00, 0xba, 0x01, 0x70, 0x01, 0xd0, 0x01, 0x7a, 0x01, 0xd7, 0x01, 0x78, 0x01, 0xf3, 0x01,
+  0x71, 0x01, 0x0e, 0x02, 0x73, 0x01, 0x36, 0x02, 0x72, 0x01, 0x51, 0x02, 0xe3, 0x00, 0x5c, 0x02,
+  0x2e, 0x01, 0x7e, 0x02, 0x31, 0x01, 0xa4, 0x02, 0x94, 0x01, 0xae, 0x02, 0x81, 0x01, 0xc3, 0x02,
+  0x83, 0x01, 0xd0, 0x02, 0x83, 0x01, 0x04, 0x00, 0x9e, 0x01, 0x0e, 0x00, 0x92, 0x01, 0x1f, 0x00,
+  0x9a, 0x01, 0x32, 0x00, 0x9c, 0x01, 0x4d, 0x00, 0x86, 0x01, 0x64, 0x00, 0x97, 0x01, 0x7a, 0x00,
+  0x80, 0x01, 0xad, 0x00, 0x85, 0x00, 0xd2, 0x00, 0x84, 0x00, 0xec, 0x00, 0x5d, 0x00, 0xf4, 0x00,
+  0x52, 0x00, 0x06, 0x01, 0xb0, 0x00, 0x14, 0x01, 0x48, 0x00, 0x31, 0x01, 0x87, 0x00, 0x3c, 0x01,
+  0x29, 0x01, 0x73, 0x01, 0x33, 0x00, 0x95, 0x01, 0x23, 0x00, 0x9f, 0x01, 0x17, 0x00, 0xac, 0x01,
+  0x09, 0x00, 0xba, 0x01, 0x70, 0x01, 0xd0, 0x01, 0x7a, 0x01, 0xd8, 0x01, 0x78, 0x01, 0xf4, 0x01,
+  0x71, 0x01, 0x0d, 0x02, 0x73, 0x01, 0x36, 0x02, 0x72, 0x01, 0x51, 0x02, 0x34, 0x01, 0x52, 0x02,
+  0xe3, 0x00, 0x5b, 0x02, 0x2e, 0x01, 0x7d, 0x02, 0x31, 0x01, 0xa4, 0x02, 0x94, 0x01, 0xb1, 0x02,
+  0x81, 0x01, 0xc3, 0x02, 0x83, 0x01, 0xd0, 0x02, 0x83, 0x01, 0x04, 0x00, 0x9e, 0x01, 0x0e, 0x00,
+  0x92, 0x01, 0x1f, 0x00, 0x9a, 0x01, 0x33, 0x00, 0x9c, 0x01, 0x4c, 0x00, 0x86, 0x01, 0x63, 0x00,
+  0x97, 0x01, 0x7a, 0x00, 0x80, 0x01, 0xae, 0x00, 0x85, 0x00, 0xd1, 0x00, 0x84, 0x00, 0xe9, 0x00,
+  0x3c, 0x00, 0xed, 0x00, 0x5d, 0x00, 0xf0, 0x00, 0x52, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x16, 0x01,
+  0x48, 0x00, 0x33, 0x01, 0x87, 0x00, 0x3b, 0x01, 0x29, 0x01, 0x73, 0x01, 0x33, 0x00, 0x95, 0x01,
+  0x16, 0x00, 0x98, 0x01, 0x23, 0x00, 0x9e, 0x01, 0x17, 0x00, 0xad, 0x01, 0x09, 0x00, 0xb9, 0x01,
+  0x70, 0x01, 0xcf, 0x01, 0x7a, 0x01, 0xd8, 0x01, 0x78, 0x01, 0xf5, 0x01, 0x71, 0x01, 0x0d, 0x02,
+  0x73, 0x01, 0x36, 0x02, 0x72, 0x01, 0x4e, 0x02, 0x34, 0x01, 0x54, 0x02, 0xe3, 0x00, 0x5a, 0x02,
+  0x2e, 0x01, 0x7d, 0x02, 0x31, 0x01, 0xa4, 0x02, 0x94, 0x01, 0xb3, 0x02, 0x81, 0x01, 0xc3, 0x02,
+  0x83, 0x01, 0xd0, 0x02, 0x83, 0x01, 0x03, 0x00, 0x9e, 0x01, 0x0f, 0x00, 0x92, 0x01, 0x1e, 0x00,
+  0x9a, 0x01, 0x33, 0x00, 0x9c, 0x01, 0x4c, 0x00, 0x86, 0x01, 0x63, 0x00, 0x97, 0x01, 0x7a, 0x00,
+  0x80, 0x01, 0xae, 0x00, 0x85, 0x00, 0xd1, 0x00, 0x84, 0x00, 0xe6, 0x00, 0x3c, 0x00, 0xee, 0x00,
+  0x52, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x17, 0x01, 0x48, 0x00, 0x34, 0x01, 0x87, 0x00, 0x3b, 0x01,
+  0x29, 0x01, 0x73, 0x01, 0x33, 0x00, 0x95, 0x01, 0x16, 0x00, 0x9c, 0x01, 0x23, 0x00, 0x9d, 0x01,
+  0x17, 0x00, 0xad, 0x01, 0x09, 0x00, 0xb9, 0x01, 0x70, 0x01, 0xcf, 0x01, 0x7a, 0x01, 0xd8, 0x01,
+  0x78, 0x01, 0xf6, 0x01, 0x71, 0x01, 0x0d, 0x02, 0x73, 0x01, 0x36, 0x02, 0x72, 0x01, 0x4c, 0x02,
+  0x34, 0x01, 0x57, 0x02, 0xe3, 0x00, 0x59, 0x02, 0x2e, 0x01, 0x7c, 0x02, 0x31, 0x01, 0xa4, 0x02,
+  0x94, 0x01, 0xb6, 0x02, 0x81, 0x01, 0xc3, 0x02, 0x83, 0x01, 0xd0, 0x02, 0x83, 0x01, 0x03, 0x00,
+  0x9e, 0x01, 0x0f, 0x00, 0x92, 0x01, 0x1e, 0x00, 0x9a, 0x01, 0x33, 0x00, 0x9c, 0x01, 0x4b, 0x00,
+  0x86, 0x01, 0x63, 0x00, 0x97, 0x01, 0x7a, 0x00, 0x80, 0x01, 0xaf, 0x00, 0x85, 0x00, 0xd0, 0x00,
+  0x84, 0x00, 0xe3, 0x00, 0x3c, 0x00, 0xee, 0x00, 0x52, 0x00, 0x04, 0x01, 0xb0, 0x00, 0x19, 0x01,
+  0x48, 0x00, 0x35, 0x01, 0x87, 0x00, 0x3b, 0x01, 0x29, 0x01, 0x72, 0x01, 0x33, 0x00, 0x95, 0x01,
+  0x16, 0x00, 0x9e, 0x01, 0x17, 0x00, 0xae, 0x01, 0x09, 0x00, 0xb9, 0x01, 0x70, 0x01, 0xcf, 0x01,
+  0x7a, 0x01, 0xd9, 0x01, 0x78, 0x01, 0xf7, 0x01, 0x71, 0x01, 0x0d, 0x02, 0x73, 0x01, 0x37, 0x02,
+  0x72, 0x01, 0x4a, 0x02, 0x34, 0x01, 0x59, 0x02, 0x2e, 0x01, 0x7c, 0x02, 0x31, 0x01, 0xa4, 0x02,
+  0x94, 0x01, 0xb8, 0x02, 0x81, 0x01, 0xc3, 0x02, 0x83, 0x01, 0xd0, 0x02, 0x83, 0x01, 0x02, 0x00,
+  0x9e, 0x01, 0x10, 0x00, 0x92, 0x01, 0x1e, 0x00, 0x9a, 0x01, 0x34, 0x00, 0x9c, 0x01, 0x4b, 0x00,
+  0x86, 0x01, 0x62, 0x00, 0x97, 0x01, 0x7a, 0x00, 0x80, 0x01, 0xb0, 0x00, 0x85, 0x00, 0xd0, 0x00,
+  0x84, 0x00, 0xe0, 0x00, 0x3c, 0x00, 0xee, 0x00, 0x46, 0x00, 0xf0, 0x00, 0x52, 0x00, 0x04, 0x01,
+  0xb0, 0x00, 0x1a, 0x01, 0x48, 0x00, 0x37, 0x01, 0x87, 0x00, 0x3b, 0x01, 0x29, 0x01, 0x72, 0x01,
+  0x33, 0x00, 0x95, 0x01, 0x16, 0x00, 0xa0, 0x01, 0x17, 0x00, 0xaf, 0x01, 0x09, 0x00, 0xb9, 0x01,
+  0x70, 0x01, 0xce, 0x01, 0x7a, 0x01, 0xd9, 0x01, 0x78, 0x01, 0xf8, 0x01, 0x71, 0x01, 0x0d, 0x02,
+  0x73, 0x01, 0x37, 0x02, 0x72, 0x01, 0x47, 0x02, 0x34, 0x01, 0x5b, 0x02, 0x2e, 0x01, 0x7b, 0x02,
+  0x31, 0x01, 0xa2, 0x02, 0x2c, 0x01, 0xa4, 0x02, 0x94, 0x01, 0xbb, 0x02, 0x81, 0x01, 0xc3, 0x02,
+  0x83, 0x01, 0xd0, 0x02, 0x83, 0x01, 0x01, 0x00, 0x9e, 0x01, 0x10, 0x00, 0x92, 0x01, 0x1e, 0x00,
+  0x9a, 0x01, 0x34, 0x00, 0x9c, 0x01, 0x4b, 0x00, 0x86, 0x01, 0x62, 0x00, 0x97, 0x01, 0x7a, 0x00,
+  0x80, 0x01, 0xb0, 0x00, 0x85, 0x00, 0xcf, 0x00, 0x84, 0x00, 0xdd, 0x00, 0x3c, 0x00, 0xee, 0x00,
+  0x46, 0x00, 0xf2, 0x00, 0x52, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x1c, 0x01, 0x48, 0x00, 0x38, 0x01,
+  0x87, 0x00, 0x3a, 0x01, 0x29, 0x01, 0x72, 0x01, 0x33, 0x00, 0x94, 0x01, 0x16, 0x00, 0xa1, 0x01,
+  0x17, 0x00, 0xaf, 0x01, 0x09, 0x00, 0xb8, 0x01, 0x70, 0x01, 0xce, 0x01, 0x7a, 0x01, 0xda, 0x01,
+  0x78, 0x01, 0xf9, 0x01, 0x71, 0x01, 0x0c, 0x02, 0x73, 0x01, 0x37, 0x02, 0x72, 0x01, 0x45, 0x02,
+  0x34, 0x01, 0x5c, 0x02, 0x2e, 0x01, 0x7b, 0x02, 0x31, 0x01, 0xa1, 0x02, 0x2c, 0x01, 0xa4, 0x02,
+  0x94, 0x01, 0xbe, 0x02, 0x81, 0x01, 0xc2, 0x02, 0x83, 0x01, 0xd0, 0x02, 0x83, 0x01, 0x01, 0x00,
+  0x9e, 0x01, 0x10, 0x00, 0x92, 0x01, 0x1d, 0x00, 0x9a, 0x01, 0x35, 0x00, 0x9c, 0x01, 0x4a, 0x00,
+  0x86, 0x01, 0x61, 0x00, 0x97, 0x01, 0x79, 0x00, 0x80, 0x01, 0xb1, 0x00, 0x85, 0x00, 0xce, 0x00,
+  0x84, 0x00, 0xd9, 0x00, 0x3c, 0x00, 0xee, 0x00, 0x46, 0x00, 0xf4, 0x00, 0x52, 0x00, 0x03, 0x01,
+  0xb0, 0x00, 0x1e, 0x01, 0x48, 0x00, 0x3a, 0x01, 0x29, 0x01, 0x71, 0x01, 0x33, 0x00, 0x94, 0x01,
+  0x16, 0x00, 0xa3, 0x01, 0x17, 0x00, 0xa9, 0x01, 0x25, 0x00, 0xb5, 0x01, 0x09, 0x00, 0xb8, 0x01,
+  0x70, 0x01, 0xce, 0x01, 0x7a, 0x01, 0xda, 0x01, 0x78, 0x01, 0xfa, 0x01, 0x71, 0x01, 0x0c, 0x02,
+  0x73, 0x01, 0x37, 0x02, 0x72, 0x01, 0x42, 0x02, 0x34, 0x01, 0x5c, 0x02, 0x2f, 0x01, 0x65, 0x02,
+  0x2e, 0x01, 0x7a, 0x02, 0x2d, 0x01, 0x7b, 0x02, 0x31, 0x01, 0x9f, 0x02, 0x2c, 0x01, 0xa5, 0x02,
+  0x94, 0x01, 0xc1, 0x02, 0x81, 0x01, 0xc2, 0x02, 0x83, 0x01, 0xd0, 0x02, 0x9e, 0x01, 0x11, 0x00,
+  0x92, 0x01, 0x1d, 0x00, 0x9a, 0x01, 0x35, 0x00, 0x9c, 0x01, 0x4a, 0x00, 0x86, 0x01, 0x61, 0x00,
+  0x97, 0x01, 0x79, 0x00, 0x80, 0x01, 0xb1, 0x00, 0x85, 0x00, 0xce, 0x00, 0x84, 0x00, 0xd6, 0x00,
+  0x3c, 0x00, 0xee, 0x00, 0x46, 0x00, 0xf6, 0x00, 0x52, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x1f, 0x01,
+  0x48, 0x00, 0x3a, 0x01, 0x29, 0x01, 0x71, 0x01, 0x33, 0x00, 0x94, 0x01, 0x16, 0x00, 0xa3, 0x01,
+  0x27, 0x00, 0xa6, 0x01, 0x25, 0x00, 0xb8, 0x01, 0x70, 0x01, 0xce, 0x01, 0x7a, 0x01, 0xda, 0x01,
+  0x78, 0x01, 0xfb, 0x01, 0x71, 0x01, 0x0c, 0x02, 0x73, 0x01, 0x37, 0x02, 0x72, 0x01, 0x40, 0x02,
+  0x34, 0x01, 0x5c, 0x02, 0x2f, 0x01, 0x70, 0x02, 0x2e, 0x01, 0x78, 0x02, 0x2d, 0x01, 0x7d, 0x02,
+  0x31, 0x01, 0x9d, 0x02, 0x2c, 0x01, 0xa5, 0x02, 0x94, 0x01, 0xc3, 0x02, 0x83, 0x01, 0xd0, 0x02,
+  0x9e, 0x01, 0x11, 0x00, 0x92, 0x01, 0x1d, 0x00, 0x9a, 0x01, 0x36, 0x00, 0x9c, 0x01, 0x49, 0x00,
+  0x86, 0x01, 0x60, 0x00, 0x97, 0x01, 0x79, 0x00, 0x80, 0x01, 0xb2, 0x00, 0x85, 0x00, 0xcd, 0x00,
+  0x84, 0x00, 0xd2, 0x00, 0x40, 0x00, 0xd3, 0x00, 0x3c, 0x00, 0xee, 0x00, 0x46, 0x00, 0xf7, 0x00,
+  0x52, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x21, 0x01, 0x48, 0x00, 0x3a, 0x01, 0x29, 0x01, 0x71, 0x01,
+  0x33, 0x00, 0x93, 0x01, 0x16, 0x00, 0xa3, 0x01, 0x27, 0x00, 0xa6, 0x01, 0x25, 0x00, 0xb9, 0x01,
+  0x70, 0x01, 0xcd, 0x01, 0x7a, 0x01, 0xdb, 0x01, 0x78, 0x01, 0xfc, 0x01, 0x71, 0x01, 0x0c, 0x02,
+  0x73, 0x01, 0x38, 0x02, 0x72, 0x01, 0x3d, 0x02, 0x34, 0x01, 0x5c, 0x02, 0x2f, 0x01, 0x77, 0x02,
+  0x2d, 0x01, 0x7e, 0x02, 0x31, 0x01, 0x9b, 0x02, 0x2c, 0x01, 0xa6, 0x02, 0x94, 0x01, 0xc3, 0x02,
+  0x83, 0x01, 0xd0, 0x02, 0x9e, 0x01, 0x12, 0x00, 0x92, 0x01, 0x1d, 0x00, 0x9a, 0x01, 0x36, 0x00,
+  0x9c, 0x01, 0x49, 0x00, 0x86, 0x01, 0x60, 0x00, 0x97, 0x01, 0x79, 0x00, 0x80, 0x01, 0xb2, 0x00,
+  0x85, 0x00, 0xcd, 0x00, 0x84, 0x00, 0xce, 0x00, 0x40, 0x00, 0xd8, 0x00, 0x3c, 0x00, 0xee, 0x00,
+  0x46, 0x00, 0xf9, 0x00, 0x52, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x22, 0x01, 0x48, 0x00, 0x3a, 0x01,
+  0x29, 0x01, 0x70, 0x01, 0x33, 0x00, 0x93, 0x01, 0x16, 0x00, 0xa2, 0x01, 0x18, 0x00, 0xa3, 0x01,
+  0x27, 0x00, 0xa6, 0x01, 0x25, 0x00, 0xb9, 0x01, 0x70, 0x01, 0xcd, 0x01, 0x7a, 0x01, 0xdb, 0x01,
+  0x78, 0x01, 0xfd, 0x01, 0x71, 0x01, 0x0b, 0x02, 0x73, 0x01, 0x38, 0x02, 0x72, 0x01, 0x3a, 0x02,
+  0x34, 0x01, 0x5c, 0x02, 0x2f, 0x01, 0x77, 0x02, 0x2d, 0x01, 0x80, 0x02, 0x31, 0x01, 0x99, 0x02,
+  0x2c, 0x01, 0xa6, 0x02, 0x94, 0x01, 0xc3, 0x02, 0x83, 0x01, 0xcf, 0x02, 0x9e, 0x01, 0xd0, 0x02,
+  0x9e, 0x01, 0x12, 0x00, 0x92, 0x01, 0x1c, 0x00, 0x9a, 0x01, 0x36, 0x00, 0x9c, 0x01, 0x48, 0x00,
+  0x86, 0x01, 0x5f, 0x00, 0x97, 0x01, 0x79, 0x00, 0x80, 0x01, 0xb3, 0x00, 0x85, 0x00, 0xcb, 0x00,
+  0x41, 0x00, 0xcc, 0x00, 0x3d, 0x00, 0xcd, 0x00, 0x40, 0x00, 0xdd, 0x00, 0x3c, 0x00, 0xed, 0x00,
+  0x46, 0x00, 0xfb, 0x00, 0x52, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x24, 0x01, 0x48, 0x00, 0x3a, 0x01,
+  0x29, 0x01, 0x70, 0x01, 0x33, 0x00, 0x93, 0x01, 0x16, 0x00, 0xa1, 0x01, 0x18, 0x00, 0xa3, 0x01,
+  0x27, 0x00, 0xa6, 0x01, 0x25, 0x00, 0xba, 0x01, 0x70, 0x01, 0xcd, 0x01, 0x7a, 0x01, 0xdc, 0x01,
+  0x78, 0x01, 0xfe, 0x01, 0x71, 0x01, 0x0b, 0x02, 0x73, 0x01, 0x38, 0x02, 0x34, 0x01, 0x5c, 0x02,
+  0x2f, 0x01, 0x77, 0x02, 0x2d, 0x01, 0x82, 0x02, 0x31, 0x01, 0x96, 0x02, 0x2c, 0x01, 0xa7, 0x02,
+  0x94, 0x01, 0xc4, 0x02, 0x83, 0x01, 0xcf, 0x02, 0x9e, 0x01, 0xd0, 0x02, 0x9e, 0x01, 0x13, 0x00,
+  0x92, 0x01, 0x1c, 0x00, 0x9a, 0x01, 0x37, 0x00, 0x9c, 0x01, 0x48, 0x00, 0x86, 0x01, 0x5f, 0x00,
+  0x97, 0x01, 0x79, 0x00, 0x80, 0x01, 0xb3, 0x00, 0x85, 0x00, 0xc7, 0x00, 0xae, 0x00, 0xcb, 0x00,
+  0x41, 0x00, 0xce, 0x00, 0x3d, 0x00, 0xd0, 0x00, 0x40, 0x00, 0xe2, 0x00, 0x3c, 0x00, 0xed, 0x00,
+  0x46, 0x00, 0xfd, 0x00, 0x52, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x26, 0x01, 0x48, 0x00, 0x3a, 0x01,
+  0x29, 0x01, 0x70, 0x01, 0x33, 0x00, 0x93, 0x01, 0x16, 0x00, 0xa0, 0x01, 0x18, 0x00, 0xa3, 0x01,
+  0x27, 0x00, 0xa7, 0x01, 0x25, 0x00, 0xba, 0x01, 0x70, 0x01, 0xcc, 0x01, 0x7a, 0x01, 0xdc, 0x01,
+  0x78, 0x01, 0xff, 0x01, 0x71, 0x01, 0x0b, 0x02, 0x73, 0x01, 0x37, 0x02, 0x34, 0x01, 0x5c, 0x02,
+  0x2f, 0x01, 0x77, 0x02, 0x2d, 0x01, 0x84, 0x02, 0x31, 0x01, 0x94, 0x02, 0x2c, 0x01, 0xa7, 0x02,
+  0x94, 0x01, 0xc4, 0x02, 0x83, 0x01, 0xce, 0x02, 0x9e, 0x01, 0xd0, 0x02, 0x9e, 0x01, 0x13, 0x00,
+  0x92, 0x01, 0x1c, 0x00, 0x9a, 0x01, 0x37, 0x00, 0x9c, 0x01, 0x47, 0x00, 0x86, 0x01, 0x5e, 0x00,
+  0x97, 0x01, 0x79, 0x00, 0x80, 0x01, 0xb4, 0x00, 0x85, 0x00, 0xc2, 0x00, 0xae, 0x00, 0xcc, 0x00,
+  0x41, 0x00, 0xcf, 0x00, 0x3d, 0x00, 0xd3, 0x00, 0x40, 0x00, 0xe9, 0x00, 0x3c, 0x00, 0xed, 0x00,
+  0x46, 0x00, 0xff, 0x00, 0x52, 0x00, 0x00, 0x01, 0xb0, 0x00, 0x28, 0x01, 0x48, 0x00, 0x3a, 0x01,
+  0x29, 0x01, 0x6f, 0x01, 0x33, 0x00, 0x92, 0x01, 0x16, 0x00, 0x9f, 0x01, 0x18, 0x00, 0xa3, 0x01,
+  0x27, 0x00, 0xa7, 0x01, 0x25, 0x00, 0xbb, 0x01, 0x70, 0x01, 0xcc, 0x01, 0x7a, 0x01, 0xdc, 0x01,
+  0x78, 0x01, 0x00, 0x02, 0x71, 0x01, 0x0b, 0x02, 0x73, 0x01, 0x35, 0x02, 0x34, 0x01, 0x5c, 0x02,
+  0x2f, 0x01, 0x77, 0x02, 0x2d, 0x01, 0x86, 0x02, 0x31, 0x01, 0x92, 0x02, 0x2c, 0x01, 0xa8, 0x02,
+  0x94, 0x01, 0xc0, 0x02, 0x93, 0x01, 0xc6, 0x02, 0x83, 0x01, 0xce, 0x02, 0x9e, 0x01, 0xd0, 0x02,
+  0x9e, 0x01, 0x14, 0x00, 0x92, 0x01, 0x1c, 0x00, 0x9a, 0x01, 0x38, 0x00, 0x9c, 0x01, 0x47, 0x00,
+  0x86, 0x01, 0x5e, 0x00, 0x97, 0x01, 0x79, 0x00, 0x80, 0x01, 0xb5, 0x00, 0x85, 0x00, 0xbc, 0x00,
+  0xae, 0x00, 0xcd, 0x00, 0x41, 0x00, 0xd1, 0x00, 0x3d, 0x00, 0xd6, 0x00, 0x40, 0x00, 0xed, 0x00,
+  0x46, 0x00, 0x00, 0x01, 0xb0, 0x00, 0x29, 0x01, 0x48, 0x00, 0x39, 0x01, 0x29, 0x01, 0x6f, 0x01,
+  0x33, 0x00, 0x92, 0x01, 0x16, 0x00, 0x9e, 0x01, 0x18, 0x00, 0xa3, 0x01, 0x27, 0x00, 0xa7, 0x01,
+  0x25, 0x00, 0xbb, 0x01, 0x70, 0x01, 0xcc, 0x01, 0x7a, 0x01, 0xdd, 0x01, 0x78, 0x01, 0x01, 0x02,
+  0x71, 0x01, 0x0a, 0x02, 0x73, 0x01, 0x34, 0x02, 0x34, 0x01, 0x5c, 0x02, 0x2f, 0x01, 0x77, 0x02,
+  0x2d, 0x01, 0x87, 0x02, 0x31, 0x01, 0x90, 0x02, 0x2c, 0x01, 0xa7, 0x02, 0x32, 0x01, 0xa9, 0x02,
+  0x94, 0x01, 0xbb, 0x02, 0x93, 0x01, 0xc7, 0x02, 0x83, 0x01, 0xcd, 0x02, 0x9e, 0x01, 0xd0, 0x02,
+  0x9e, 0x01, 0x14, 0x00, 0x92, 0x01, 0x1b, 0x00, 0x9a, 0x01, 0x38, 0x00, 0x9c, 0x01, 0x46, 0x00,
+  0x86, 0x01, 0x5d, 0x00, 0x97, 0x01, 0x78, 0x00, 0x80, 0x01, 0xb5, 0x00, 0xae, 0x00, 0xce, 0x00,
+  0x41, 0x00, 0xd2, 0x00, 0x3d, 0x00, 0xd9, 0x00, 0x40, 0x00, 0xe7, 0x00, 0x43, 0x00, 0xed, 0x00,
+  0x46, 0x00, 0x00, 0x01, 0xb0, 0x00, 0x2b, 0x01, 0x48, 0x00, 0x39, 0x01, 0x29, 0x01, 0x6f, 0x01,
+  0x33, 0x00, 0x92, 0x01, 0x16, 0x00, 0x9d, 0x01, 0x18, 0x00, 0xa3, 0x01, 0x27, 0x00, 0xa7, 0x01,
+  0x25, 0x00, 0xbc, 0x01, 0x70, 0x01, 0xcc, 0x01, 0x7a, 0x01, 0xdd, 0x01, 0x78, 0x01, 0x02, 0x02,
+  0x71, 0x01, 0x0a, 0x02, 0x73, 0x01, 0x33, 0x02, 0x34, 0x01, 0x5c, 0x02, 0x2f, 0x01, 0x77, 0x02,
+  0x2d, 0x01, 0x89, 0x02, 0x31, 0x01, 0x8e, 0x02, 0x2c, 0x01, 0xa6, 0x02, 0x32, 0x01, 0xaa, 0x02,
+  0x94, 0x01, 0xb5, 0x02, 0x93, 0x01, 0xc8, 0x02, 0x83, 0x01, 0xcc, 0x02, 0x9e, 0x01, 0xd0, 0x02,
+  0x9e, 0x01, 0x15, 0x00, 0x92, 0x01, 0x1b, 0x00, 0x9a, 0x01, 0x39, 0x00, 0x9c, 0x01, 0x46, 0x00,
+  0x86, 0x01, 0x5d, 0x00, 0x97, 0x01, 0x78, 0x00, 0x80, 0x01, 0xb5, 0x00, 0xae, 0x00, 0xcf, 0x00,
+  0x41, 0x00, 0xd3, 0x00, 0x3d, 0x00, 0xdd, 0x00, 0x43, 0x00, 0xed, 0x00, 0x46, 0x00, 0x00, 0x01,
+  0xb0, 0x00, 0x2d, 0x01, 0x48, 0x00, 0x39, 0x01, 0x29, 0x01, 0x6e, 0x01, 0x33, 0x00, 0x91, 0x01,
+  0x16, 0x00, 0x9c, 0x01, 0x18, 0x00, 0xa3, 0x01, 0x27, 0x00, 0xa8, 0x01, 0x25, 0x00, 0xbd, 0x01,
+  0x70, 0x01, 0xcb, 0x01, 0x7a, 0x01, 0xde, 0x01, 0x78, 0x01, 0x04, 0x02, 0x71, 0x01, 0x0a, 0x02,
+  0x73, 0x01, 0x31, 0x02, 0x34, 0x01, 0x5c, 0x02, 0x2f, 0x01, 0x77, 0x02, 0x2d, 0x01, 0x8b, 0x02,
+  0x2c, 0x01, 0xa6, 0x02, 0x32, 0x01, 0xac, 0x02, 0x94, 0x01, 0xaf, 0x02, 0x93, 0x01, 0xc9, 0x02,
+  0x83, 0x01, 0xcc, 0x02, 0x9e, 0x01, 0xd0, 0x02, 0x9e, 0x01, 0x15, 0x00, 0x92, 0x01, 0x1b, 0x00,
+  0x9a, 0x01, 0x39, 0x00, 0x9c, 0x01, 0x45, 0x00, 0x86, 0x01, 0x5c, 0x00, 0x97, 0x01, 0x78, 0x00,
+  0x80, 0x01, 0xb5, 0x00, 0xae, 0x00, 0xd0, 0x00, 0x41, 0x00, 0xd5, 0x00, 0x3d, 0x00, 0xde, 0x00,
+  0x3a, 0x00, 0xdf, 0x00, 0x43, 0x00, 0xee, 0x00, 0x46, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x2f, 0x01,
+  0x48, 0x00, 0x39, 0x01, 0x29, 0x01, 0x6e, 0x01, 0x33, 0x00, 0x91, 0x01, 0x16, 0x00, 0x9b, 0x01,
+  0x18, 0x00, 0xa3, 0x01, 0x27, 0x00, 0xa8, 0x01, 0x25, 0x00, 0xbd, 0x01, 0x70, 0x01, 0xcb, 0x01,
+  0x7a, 0x01, 0xde, 0x01, 0x78, 0x01, 0x05, 0x02, 0x71, 0x01, 0x0a, 0x02, 0x73, 0x01, 0x30, 0x02,
+  0x34, 0x01, 0x5c, 0x02, 0x2f, 0x01, 0x77, 0x02, 0x2d, 0x01, 0x8c, 0x02, 0x2c, 0x01, 0xa5, 0x02,
+  0x32, 0x01, 0xad, 0x02, 0x93, 0x01, 0xcb, 0x02, 0x9e, 0x01, 0xd0, 0x02, 0x9e, 0x01, 0x16, 0x00,
+  0x92, 0x01, 0x1b, 0x00, 0x9a, 0x01, 0x3a, 0x00, 0x9c, 0x01, 0x45, 0x00, 0x86, 0x01, 0x5c, 0x00,
+  0x97, 0x01, 0x78, 0x00, 0x80, 0x01, 0xb5, 0x00, 0xae, 0x00, 0xd1, 0x00, 0x41, 0x00, 0xd6, 0x00,
+  0x3d, 0x00, 0xdf, 0x00, 0x3a, 0x00, 0xe2, 0x00, 0x43, 0x00, 0xee, 0x00, 0x46, 0x00, 0x01, 0x01,
+  0xb0, 0x00, 0x31, 0x01, 0x48, 0x00, 0x39, 0x01, 0x29, 0x01, 0x6e, 0x01, 0x33, 0x00, 0x91, 0x01,
+  0x16, 0x00, 0x9a, 0x01, 0x18, 0x00, 0xa3, 0x01, 0x27, 0x00, 0xa8, 0x01, 0x25, 0x00, 0xbe, 0x01,
+  0x70, 0x01, 0xcb, 0x01, 0x7a, 0x01, 0xdf, 0x01, 0x78, 0x01, 0x06, 0x02, 0x71, 0x01, 0x09, 0x02,
+  0x73, 0x01, 0x2e, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x77, 0x02, 0x2d, 0x01, 0x8c, 0x02,
+  0x2c, 0x01, 0xa4, 0x02, 0x32, 0x01, 0xad, 0x02, 0x93, 0x01, 0xcc, 0x02, 0x9e, 0x01, 0xd0, 0x02,
+  0x9e, 0x01, 0x16, 0x00, 0x92, 0x01, 0x1a, 0x00, 0x9a, 0x01, 0x3a, 0x00, 0x9c, 0x01, 0x44, 0x00,
+  0x86, 0x01, 0x5b, 0x00, 0x97, 0x01, 0x78, 0x00, 0x80, 0x01, 0xb4, 0x00, 0xae, 0x00, 0xd2, 0x00,
+  0x41, 0x00, 0xd8, 0x00, 0x3d, 0x00, 0xe1, 0x00, 0x3a, 0x00, 0xe6, 0x00, 0x43, 0x00, 0xee, 0x00,
+  0x46, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x33, 0x01, 0x48, 0x00, 0x39, 0x01, 0x29, 0x01, 0x6d, 0x01,
+  0x33, 0x00, 0x91, 0x01, 0x16, 0x00, 0x98, 0x01, 0x26, 0x00, 0x9e, 0x01, 0x18, 0x00, 0xa3, 0x01,
+  0x27, 0x00, 0xa9, 0x01, 0x25, 0x00, 0xbe, 0x01, 0x70, 0x01, 0xca, 0x01, 0x7a, 0x01, 0xdf, 0x01,
+  0x78, 0x01, 0x07, 0x02, 0x71, 0x01, 0x09, 0x02, 0x73, 0x01, 0x2d, 0x02, 0x34, 0x01, 0x5d, 0x02,
+  0x2f, 0x01, 0x77, 0x02, 0x2d, 0x01, 0x8d, 0x02, 0x2c, 0x01, 0xa3, 0x02, 0x32, 0x01, 0xad, 0x02,
+  0x93, 0x01, 0xcc, 0x02, 0x9e, 0x01, 0xd0, 0x02, 0x9e, 0x01, 0x17, 0x00, 0x92, 0x01, 0x1a, 0x00,
+  0x9a, 0x01, 0x3a, 0x00, 0x9c, 0x01, 0x44, 0x00, 0x86, 0x01, 0x5b, 0x00, 0x97, 0x01, 0x78, 0x00,
+  0x80, 0x01, 0xb4, 0x00, 0xae, 0x00, 0xd3, 0x00, 0x41, 0x00, 0xd9, 0x00, 0x3d, 0x00, 0xe2, 0x00,
+  0x3a, 0x00, 0xea, 0x00, 0x43, 0x00, 0xee, 0x00, 0x46, 0x00, 0x01, 0x01, 0xb0, 0x00, 0x35, 0x01,
+  0x48, 0x00, 0x39, 0x01, 0x29, 0x01, 0x6d, 0x01, 0x33, 0x00, 0x90, 0x01, 0x16, 0x00, 0x93, 0x01,
+  0x26, 0x00, 0xa3, 0x01, 0x27, 0x00, 0xa9, 0x01, 0x25, 0x00, 0xbf, 0x01, 0x70, 0x01, 0xca, 0x01,
+  0x7a, 0x01, 0xdf, 0x01, 0x78, 0x01, 0x08, 0x02, 0x71, 0x01, 0x09, 0x02, 0x73, 0x01, 0x2b, 0x02,
+  0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x76, 0x02, 0x2d, 0x01, 0x8d, 0x02, 0x2c, 0x01, 0xa2, 0x02,
+  0x32, 0x01, 0xae, 0x02, 0x93, 0x01, 0xcd, 0x02, 0x9e, 0x01, 0xd0, 0x02, 0x9e, 0x01, 0x17, 0x00,
+  0x92, 0x01, 0x1a, 0x00, 0x9a, 0x01, 0x3b, 0x00, 0x9c, 0x01, 0x43, 0x00, 0x86, 0x01, 0x5a, 0x00,
+  0x97, 0x01, 0x78, 0x00, 0x80, 0x01, 0xb4, 0x00, 0xae, 0x00, 0xd4, 0x00, 0x41, 0x00, 0xdb, 0x00,
+  0x3d, 0x00, 0xe3, 0x00, 0x3a, 0x00, 0xec, 0x00, 0x3b, 0x00, 0xef, 0x00, 0x46, 0x00, 0x01, 0x01,
+  0xb0, 0x00, 0x37, 0x01, 0x48, 0x00, 0x39, 0x01, 0x29, 0x01, 0x6c, 0x01, 0x33, 0x00, 0x90, 0x01,
+  0x26, 0x00, 0xa5, 0x01, 0x27, 0x00, 0xa9, 0x01, 0x25, 0x00, 0xc0, 0x01, 0x70, 0x01, 0xca, 0x01,
+  0x7a, 0x01, 0xe0, 0x01, 0x78, 0x01, 0x07, 0x02, 0x75, 0x01, 0x0a, 0x02, 0x73, 0x01, 0x2a, 0x02,
+  0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x76, 0x02, 0x2d, 0x01, 0x8e, 0x02, 0x2c, 0x01, 0xa1, 0x02,
+  0x32, 0x01, 0xae, 0x02, 0x93, 0x01, 0xcb, 0x02, 0x7c, 0x01, 0xcf, 0x02, 0x9e, 0x01, 0xd0, 0x02,
+  0x7c, 0x01, 0x01, 0x00, 0x9e, 0x01, 0x18, 0x00, 0x92, 0x01, 0x19, 0x00, 0x9a, 0x01, 0x3b, 0x00,
+  0x9c, 0x01, 0x43, 0x00, 0x86, 0x01, 0x5a, 0x00, 0x97, 0x01, 0x78, 0x00, 0x80, 0x01, 0xb4, 0x00,
+  0xae, 0x00, 0xd5, 0x00, 0x41, 0x00, 0xdd, 0x00, 0x3d, 0x00, 0xe4, 0x00, 0x3a, 0x00, 0xe9, 0x00,
+  0x3b, 0x00, 0xf1, 0x00, 0x46, 0x00, 0x02, 0x01, 0xb0, 0x00, 0x39, 0x01, 0x29, 0x01, 0x6c, 0x01,
+  0x33, 0x00, 0x8f, 0x01, 0x26, 0x00, 0xa6, 0x01, 0x27, 0x00, 0xa9, 0x01, 0x25, 0x00, 0xc0, 0x01,
+  0x70, 0x01, 0xc9, 0x01, 0x7a, 0x01, 0xe0, 0x01, 0x78, 0x01, 0x05, 0x02, 0x75, 0x01, 0x0c, 0x02,
+  0x73, 0x01, 0x28, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x76, 0x02, 0x2d, 0x01, 0x8e, 0x02,
+  0x2c, 0x01, 0xa1, 0x02, 0x32, 0x01, 0xae, 0x02, 0x93, 0x01, 0xca, 0x02, 0x7c, 0x01, 0xd0, 0x02,
+  0x7c, 0x01, 0x03, 0x00, 0x9e, 0x01, 0x18, 0x00, 0x92, 0x01, 0x19, 0x00, 0x9a, 0x01, 0x3c, 0x00,
+  0x9c, 0x01, 0x42, 0x00, 0x86, 0x01, 0x59, 0x00, 0x97, 0x01, 0x77, 0x00, 0x80, 0x01, 0xb4, 0x00,
+  0xae, 0x00, 0xd6, 0x00, 0x41, 0x00, 0xde, 0x00, 0x3d, 0x00, 0xe5, 0x00, 0x3a, 0x00, 0xe7, 0x00,
+  0x3b, 0x00, 0xf2, 0x00, 0x46, 0x00, 0xfc, 0x00, 0x95, 0x00, 0x03, 0x01, 0xb0, 0x00, 0x39, 0x01,
+  0x29, 0x01, 0x6c, 0x01, 0x33, 0x00, 0x8e, 0x01, 0x26, 0x00, 0xa7, 0x01, 0x27, 0x00, 0xaa, 0x01,
+  0x25, 0x00, 0xc1, 0x01, 0x70, 0x01, 0xc9, 0x01, 0x7a, 0x01, 0xe1, 0x01, 0x78, 0x01, 0x03, 0x02,
+  0x75, 0x01, 0x0e, 0x02, 0x73, 0x01, 0x27, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x76, 0x02,
+  0x2d, 0x01, 0x8e, 0x02, 0x35, 0x01, 0x90, 0x02, 0x2c, 0x01, 0xa0, 0x02, 0x32, 0x01, 0xaf, 0x02,
+  0x93, 0x01, 0xc8, 0x02, 0x7c, 0x01, 0xd0, 0x02, 0x7c, 0x01, 0x05, 0x00, 0x9e, 0x01, 0x19, 0x00,
+  0x9a, 0x01, 0x3c, 0x00, 0x9c, 0x01, 0x42, 0x00, 0x86, 0x01, 0x59, 0x00, 0x97, 0x01, 0x77, 0x00,
+  0x80, 0x01, 0xb3, 0x00, 0xae, 0x00, 0xd7, 0x00, 0x41, 0x00, 0xe0, 0x00, 0x3d, 0x00, 0xe5, 0x00,
+  0x3b, 0x00, 0xf2, 0x00, 0x39, 0x00, 0xf7, 0x00, 0x95, 0x00, 0x05, 0x01, 0xb0, 0x00, 0x39, 0x01,
+  0x29, 0x01, 0x6b, 0x01, 0x33, 0x00, 0x8d, 0x01, 0x26, 0x00, 0xa8, 0x01, 0x27, 0x00, 0xaa, 0x01,
+  0x25, 0x00, 0xc2, 0x01, 0x70, 0x01, 0xc9, 0x01, 0x7a, 0x01, 0xe1, 0x01, 0x78, 0x01, 0x00, 0x02,
+  0x75, 0x01, 0x10, 0x02, 0x73, 0x01, 0x25, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x76, 0x02,
+  0x2b, 0x01, 0x77, 0x02, 0x2d, 0x01, 0x8e, 0x02, 0x35, 0x01, 0x94, 0x02, 0x2c, 0x01, 0x9f, 0x02,
+  0x32, 0x01, 0xaf, 0x02, 0x93, 0x01, 0xc7, 0x02, 0x7c, 0x01, 0xd0, 0x02, 0x7c, 0x01, 0x08, 0x00,
+  0x9e, 0x01, 0x19, 0x00, 0x9a, 0x01, 0x3d, 0x00, 0x9c, 0x01, 0x41, 0x00, 0x86, 0x01, 0x58, 0x00,
+  0x97, 0x01, 0x77, 0x00, 0x80, 0x01, 0xb3, 0x00, 0xae, 0x00, 0xd9, 0x00, 0x41, 0x00, 0xe2, 0x00,
+  0x3d, 0x00, 0xe4, 0x00, 0x3b, 0x00, 0xf1, 0x00, 0x39, 0x00, 0xf7, 0x00, 0x95, 0x00, 0x06, 0x01,
+  0xb0, 0x00, 0x39, 0x01, 0x29, 0x01, 0x6b, 0x01, 0x33, 0x00, 0x8c, 0x01, 0x26, 0x00, 0xa9, 0x01,
+  0x27, 0x00, 0xaa, 0x01, 0x25, 0x00, 0xc2, 0x01, 0x70, 0x01, 0xc8, 0x01, 0x7a, 0x01, 0xe2, 0x01,
+  0x78, 0x01, 0xfe, 0x01, 0x75, 0x01, 0x12, 0x02, 0x73, 0x01, 0x24, 0x02, 0x34, 0x01, 0x5d, 0x02,
+  0x2f, 0x01, 0x76, 0x02, 0x2b, 0x01, 0x78, 0x02, 0x2d, 0x01, 0x8e, 0x02, 0x35, 0x01, 0x99, 0x02,
+  0x2c, 0x01, 0x9e, 0x02, 0x32, 0x01, 0xaf, 0x02, 0x93, 0x01, 0xc5, 0x02, 0x7c, 0x01, 0xd0, 0x02,
+  0x7c, 0x01, 0x0a, 0x00, 0x9e, 0x01, 0x19, 0x00, 0x9a, 0x01, 0x3d, 0x00, 0x9c, 0x01, 0x41, 0x00,
+  0x86, 0x01, 0x58, 0x00, 0x97, 0x01, 0x77, 0x00, 0x80, 0x01, 0xb3, 0x00, 0xae, 0x00, 0xda, 0x00,
+  0x41, 0x00, 0xe3, 0x00, 0x3b, 0x00, 0xf0, 0x00, 0x39, 0x00, 0xf7, 0x00, 0x95, 0x00, 0x08, 0x01,
+  0xb0, 0x00, 0x3a, 0x01, 0x29, 0x01, 0x6a, 0x01, 0x33, 0x00, 0x8b, 0x01, 0x26, 0x00, 0xab, 0x01,
+  0x25, 0x00, 0xc3, 0x01, 0x70, 0x01, 0xc8, 0x01, 0x7a, 0x01, 0xe2, 0x01, 0x78, 0x01, 0xfb, 0x01,
+  0x75, 0x01, 0x14, 0x02, 0x73, 0x01, 0x22, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x75, 0x02,
+  0x2b, 0x01, 0x7a, 0x02, 0x2d, 0x01, 0x8e, 0x02, 0x35, 0x01, 0x9d, 0x02, 0x32, 0x01, 0xb0, 0x02,
+  0x93, 0x01, 0xc4, 0x02, 0x7c, 0x01, 0xd0, 0x02, 0x7c, 0x01, 0x0c, 0x00, 0x9e, 0x01, 0x19, 0x00,
+  0x9a, 0x01, 0x3e, 0x00, 0x9c, 0x01, 0x40, 0x00, 0x86, 0x01, 0x57, 0x00, 0x97, 0x01, 0x77, 0x00,
+  0x80, 0x01, 0xb3, 0x00, 0xae, 0x00, 0xdb, 0x00, 0x41, 0x00, 0xe3, 0x00, 0x42, 0x00, 0xe4, 0x00,
+  0x3b, 0x00, 0xef, 0x00, 0x39, 0x00, 0xf7, 0x00, 0x95, 0x00, 0x0a, 0x01, 0xb0, 0x00, 0x3a, 0x01,
+  0x29, 0x01, 0x6a, 0x01, 0x33, 0x00, 0x8a, 0x01, 0x26, 0x00, 0xac, 0x01, 0x25, 0x00, 0xc4, 0x01,
+  0x70, 0x01, 0xc8, 0x01, 0x7a, 0x01, 0xe3, 0x01, 0x78, 0x01, 0xf9, 0x01, 0x75, 0x01, 0x16, 0x02,
+  0x73, 0x01, 0x20, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x75, 0x02, 0x2b, 0x01, 0x7b, 0x02,
+  0x2d, 0x01, 0x8d, 0x02, 0x35, 0x01, 0x9e, 0x02, 0x32, 0x01, 0xb0, 0x02, 0x93, 0x01, 0xc2, 0x02,
+  0x7c, 0x01, 0xd0, 0x02, 0x7c, 0x01, 0x0f, 0x00, 0x9e, 0x01, 0x19, 0x00, 0x9a, 0x01, 0x3e, 0x00,
+  0x9c, 0x01, 0x40, 0x00, 0x86, 0x01, 0x57, 0x00, 0x97, 0x01, 0x77, 0x00, 0x80, 0x01, 0xb2, 0x00,
+  0xae, 0x00, 0xdc, 0x00, 0x3e, 0x00, 0xdf, 0x00, 0x41, 0x00, 0xe2, 0x00, 0x42, 0x00, 0xe5, 0x00,
+  0x3b, 0x00, 0xee, 0x00, 0x39, 0x00, 0xf6, 0x00, 0x95, 0x00, 0x0c, 0x01, 0xb0, 0x00, 0x3a, 0x01,
+  0x29, 0x01, 0x6a, 0x01, 0x33, 0x00, 0x89, 0x01, 0x26, 0x00, 0xad, 0x01, 0x25, 0x00, 0xc4, 0x01,
+  0x70, 0x01, 0xc7, 0x01, 0x7a, 0x01, 0xe3, 0x01, 0x78, 0x01, 0xf6, 0x01, 0x75, 0x01, 0x18, 0x02,
+  0x73, 0x01, 0x1f, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x74, 0x02, 0x2b, 0x01, 0x7d, 0x02,
+  0x2d, 0x01, 0x8d, 0x02, 0x35, 0x01, 0x9e, 0x02, 0x32, 0x01, 0xb1, 0x02, 0x93, 0x01, 0xc1, 0x02,
+  0x7c, 0x01, 0xd0, 0x02, 0x7c, 0x01, 0x11, 0x00, 0x7e, 0x01, 0x19, 0x00, 0x9a, 0x01, 0x3f, 0x00,
+  0x86, 0x01, 0x56, 0x00, 0x97, 0x01, 0x77, 0x00, 0x80, 0x01, 0xb2, 0x00, 0xae, 0x00, 0xdc, 0x00,
+  0x3e, 0x00, 0xe1, 0x00, 0x42, 0x00, 0xe6, 0x00, 0x3b, 0x00, 0xee, 0x00, 0x39, 0x00, 0xf6, 0x00,
+  0x95, 0x00, 0x0d, 0x01, 0xb0, 0x00, 0x3a, 0x01, 0x29, 0x01, 0x69, 0x01, 0x33, 0x00, 0x88, 0x01,
+  0x26, 0x00, 0xae, 0x01, 0x25, 0x00, 0xc5, 0x01, 0x70, 0x01, 0xc7, 0x01, 0x7a, 0x01, 0xe4, 0x01,
+  0x78, 0x01, 0xf3, 0x01, 0x75, 0x01, 0x1a, 0x02, 0x73, 0x01, 0x1d, 0x02, 0x34, 0x01, 0x5d, 0x02,
+  0x2f, 0x01, 0x74, 0x02, 0x2b, 0x01, 0x7e, 0x02, 0x2d, 0x01, 0x8d, 0x02, 0x35, 0x01, 0x9e, 0x02,
+  0x32, 0x01, 0xb1, 0x02, 0x93, 0x01, 0xbf, 0x02, 0x7c, 0x01, 0xd0, 0x02, 0x7c, 0x01, 0x0f, 0x00,
+  0x7e, 0x01, 0x1b, 0x00, 0x9a, 0x01, 0x3f, 0x00, 0x86, 0x01, 0x55, 0x00, 0x97, 0x01, 0x76, 0x00,
+  0x80, 0x01, 0xb2, 0x00, 0xae, 0x00, 0xdd, 0x00, 0x3e, 0x00, 0xe1, 0x00, 0x42, 0x00, 0xe8, 0x00,
+  0x3b, 0x00, 0xed, 0x00, 0x39, 0x00, 0xf6, 0x00, 0x95, 0x00, 0x0f, 0x01, 0xb0, 0x00, 0x3b, 0x01,
+  0x29, 0x01, 0x69, 0x01, 0x33, 0x00, 0x87, 0x01, 0x26, 0x00, 0xaf, 0x01, 0x25, 0x00, 0xc6, 0x01,
+  0x70, 0x01, 0xc7, 0x01, 0x7a, 0x01, 0xe4, 0x01, 0x78, 0x01, 0xf0, 0x01, 0x75, 0x01, 0x1c, 0x02,
+  0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x73, 0x02, 0x2b, 0x01, 0x80, 0x02, 0x2d, 0x01, 0x8c, 0x02,
+  0x35, 0x01, 0x9f, 0x02, 0x32, 0x01, 0xb1, 0x02, 0x93, 0x01, 0xbe, 0x02, 0x7c, 0x01, 0xd0, 0x02,
+  0x7c, 0x01, 0x0e, 0x00, 0x7e, 0x01, 0x1d, 0x00, 0x9a, 0x01, 0x3f, 0x00, 0x86, 0x01, 0x55, 0x00,
+  0x97, 0x01, 0x76, 0x00, 0x80, 0x01, 0xb2, 0x00, 0xae, 0x00, 0xdd, 0x00, 0x3e, 0x00, 0xe1, 0x00,
+  0x42, 0x00, 0xe9, 0x00, 0x3b, 0x00, 0xec, 0x00, 0x39, 0x00, 0xf6, 0x00, 0x95, 0x00, 0x11, 0x01,
+  0xb0, 0x00, 0x38, 0x01, 0x28, 0x01, 0x3c, 0x01, 0x29, 0x01, 0x68, 0x01, 0x33, 0x00, 0x86, 0x01,
+  0x26, 0x00, 0xb0, 0x01, 0x25, 0x00, 0xc6, 0x01, 0x7a, 0x01, 0xe5, 0x01, 0x78, 0x01, 0xed, 0x01,
+  0x75, 0x01, 0x1d, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x73, 0x02, 0x2b, 0x01, 0x81, 0x02,
+  0x2d, 0x01, 0x8c, 0x02, 0x35, 0x01, 0x9f, 0x02, 0x32, 0x01, 0xb2, 0x02, 0x93, 0x01, 0xbc, 0x02,
+  0x7c, 0x01, 0xd0, 0x02, 0x7c, 0x01, 0x0d, 0x00, 0x7e, 0x01, 0x20, 0x00, 0x9a, 0x01, 0x3f, 0x00,
+  0x86, 0x01, 0x54, 0x00, 0x97, 0x01, 0x76, 0x00, 0x80, 0x01, 0xb1, 0x00, 0xae, 0x00, 0xdd, 0x00,
+  0x3e, 0x00, 0xe0, 0x00, 0x42, 0x00, 0xea, 0x00, 0x3b, 0x00, 0xeb, 0x00, 0x39, 0x00, 0xf6, 0x00,
+  0x95, 0x00, 0x13, 0x01, 0xb0, 0x00, 0x36, 0x01, 0x28, 0x01, 0x3e, 0x01, 0x29, 0x01, 0x68, 0x01,
+  0x33, 0x00, 0x85, 0x01, 0x26, 0x00, 0xb1, 0x01, 0x25, 0x00, 0xc7, 0x01, 0x7a, 0x01, 0xe5, 0x01,
+  0x78, 0x01, 0xea, 0x01, 0x75, 0x01, 0x1d, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x72, 0x02,
+  0x2b, 0x01, 0x83, 0x02, 0x2d, 0x01, 0x89, 0x02, 0x33, 0x01, 0x8d, 0x02, 0x35, 0x01, 0xa0, 0x02,
+  0x32, 0x01, 0xb2, 0x02, 0x93, 0x01, 0xba, 0x02, 0x7c, 0x01, 0xd0, 0x02, 0x7c, 0x01, 0x0c, 0x00,
+  0x7e, 0x01, 0x22, 0x00, 0x9a, 0x01, 0x3f, 0x00, 0x86, 0x01, 0x54, 0x00, 0x97, 0x01, 0x76, 0x00,
+  0x80, 0x01, 0xb1, 0x00, 0xae, 0x00, 0xde, 0x00, 0x3e, 0x00, 0xe0, 0x00, 0x42, 0x00, 0xeb, 0x00,
+  0x39, 0x00, 0xf5, 0x00, 0x95, 0x00, 0x15, 0x01, 0xb0, 0x00, 0x33, 0x01, 0x28, 0x01, 0x40, 0x01,
+  0x29, 0x01, 0x67, 0x01, 0x33, 0x00, 0x84, 0x01, 0x26, 0x00, 0xb2, 0x01, 0x25, 0x00, 0xc7, 0x01,
+  0x7a, 0x01, 0xe6, 0x01, 0x78, 0x01, 0xe7, 0x01, 0x75, 0x01, 0x1e, 0x02, 0x34, 0x01, 0x5d, 0x02,
+  0x2f, 0x01, 0x72, 0x02, 0x2b, 0x01, 0x84, 0x02, 0x2d, 0x01, 0x87, 0x02, 0x33, 0x01, 0x8e, 0x02,
+  0x35, 0x01, 0xa0, 0x02, 0x32, 0x01, 0xb3, 0x02, 0x93, 0x01, 0xb8, 0x02, 0x7c, 0x01, 0xd0, 0x02,
+  0x7c, 0x01, 0x0b, 0x00, 0x7e, 0x01, 0x24, 0x00, 0x9a, 0x01, 0x3f, 0x00, 0x86, 0x01, 0x53, 0x00,
+  0x97, 0x01, 0x76, 0x00, 0x80, 0x01, 0xb1, 0x00, 0xae, 0x00, 0xde, 0x00, 0x3e, 0x00, 0xe0, 0x00,
+  0x42, 0x00, 0xeb, 0x00, 0x39, 0x00, 0xf5, 0x00, 0x95, 0x00, 0x17, 0x01, 0xb0, 0x00, 0x30, 0x01,
+  0x28, 0x01, 0x42, 0x01, 0x29, 0x01, 0x67, 0x01, 0x33, 0x00, 0x83, 0x01, 0x26, 0x00, 0xb3, 0x01,
+  0x25, 0x00, 0xc7, 0x01, 0x7a, 0x01, 0xe4, 0x01, 0x75, 0x01, 0x1e, 0x02, 0x34, 0x01, 0x5d, 0x02,
+  0x2f, 0x01, 0x71, 0x02, 0x2b, 0x01, 0x85, 0x02, 0x33, 0x01, 0x8f, 0x02, 0x35, 0x01, 0xa1, 0x02,
+  0x32, 0x01, 0xb3, 0x02, 0x93, 0x01, 0xb7, 0x02, 0x7c, 0x01, 0xd0, 0x02, 0x7c, 0x01, 0x0a, 0x00,
+  0x7e, 0x01, 0x26, 0x00, 0x9a, 0x01, 0x3e, 0x00, 0x86, 0x01, 0x52, 0x00, 0x97, 0x01, 0x76, 0x00,
+  0x80, 0x01, 0xb1, 0x00, 0xae, 0x00, 0xdf, 0x00, 0x42, 0x00, 0xea, 0x00, 0x39, 0x00, 0xf5, 0x00,
+  0x95, 0x00, 0x19, 0x01, 0xb0, 0x00, 0x2d, 0x01, 0x28, 0x01, 0x44, 0x01, 0x29, 0x01, 0x67, 0x01,
+  0x33, 0x00, 0x82, 0x01, 0x26, 0x00, 0xb4, 0x01, 0x25, 0x00, 0xc8, 0x01, 0x7a, 0x01, 0xe0, 0x01,
+  0x75, 0x01, 0x1f, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x71, 0x02, 0x2b, 0x01, 0x84, 0x02,
+  0x33, 0x01, 0x90, 0x02, 0x35, 0x01, 0xa1, 0x02, 0x32, 0x01, 0xb3, 0x02, 0x93, 0x01, 0xb5, 0x02,
+  0x7c, 0x01, 0xd0, 0x02, 0x7c, 0x01, 0x09, 0x00, 0x7e, 0x01, 0x29, 0x00, 0x9a, 0x01, 0x3e, 0x00,
+  0x86, 0x01, 0x52, 0x00, 0x97, 0x01, 0x76, 0x00, 0x80, 0x01, 0xb0, 0x00, 0x5b, 0x00, 0xb1, 0x00,
+  0xae, 0x00, 0xdf, 0x00, 0x42, 0x00, 0xea, 0x00, 0x39, 0x00, 0xf5, 0x00, 0x95, 0x00, 0x1b, 0x01,
+  0xb0, 0x00, 0x2a, 0x01, 0x28, 0x01, 0x46, 0x01, 0x29, 0x01, 0x66, 0x01, 0x33, 0x00, 0x81, 0x01,
+  0x26, 0x00, 0xb5, 0x01, 0x25, 0x00, 0xc8, 0x01, 0x7a, 0x01, 0xdd, 0x01, 0x75, 0x01, 0x1f, 0x02,
+  0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x70, 0x02, 0x2b, 0x01, 0x84, 0x02, 0x33, 0x01, 0x91, 0x02,
+  0x35, 0x01, 0xa1, 0x02, 0x32, 0x01, 0xb4, 0x02, 0x7c, 0x01, 0xd0, 0x02, 0x7c, 0x01, 0x08, 0x00,
+  0x7e, 0x01, 0x2b, 0x00, 0x9a, 0x01, 0x3e, 0x00, 0x86, 0x01, 0x51, 0x00, 0x97, 0x01, 0x75, 0x00,
+  0x80, 0x01, 0xb0, 0x00, 0x5b, 0x00, 0xb5, 0x00, 0xae, 0x00, 0xdf, 0x00, 0x42, 0x00, 0xea, 0x00,
+  0x39, 0x00, 0xf4, 0x00, 0x95, 0x00, 0x1e, 0x01, 0xb0, 0x00, 0x26, 0x01, 0x28, 0x01, 0x49, 0x01,
+  0x29, 0x01, 0x66, 0x01, 0x33, 0x00, 0x80, 0x01, 0x26, 0x00, 0xb6, 0x01, 0x25, 0x00, 0xc8, 0x01,
+  0x7a, 0x01, 0xda, 0x01, 0x75, 0x01, 0x20, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x70, 0x02,
+  0x2b, 0x01, 0x83, 0x02, 0x33, 0x01, 0x92, 0x02, 0x35, 0x01, 0xa2, 0x02, 0x32, 0x01, 0xb3, 0x02,
+  0x7c, 0x01, 0xd0, 0x02, 0x7c, 0x01, 0x06, 0x00, 0x7e, 0x01, 0x2e, 0x00, 0x9a, 0x01, 0x3e, 0x00,
+  0x86, 0x01, 0x50, 0x00, 0x97, 0x01, 0x75, 0x00, 0x80, 0x01, 0xaf, 0x00, 0x5b, 0x00, 0xb9, 0x00,
+  0xae, 0x00, 0xdf, 0x00, 0x42, 0x00, 0xea, 0x00, 0x39, 0x00, 0xf4, 0x00, 0x95, 0x00, 0x20, 0x01,
+  0xb0, 0x00, 0x22, 0x01, 0x28, 0x01, 0x4b, 0x01, 0x29, 0x01, 0x65, 0x01, 0x33, 0x00, 0x7f, 0x01,
+  0x26, 0x00, 0xb7, 0x01, 0x25, 0x00, 0xc9, 0x01, 0x7a, 0x01, 0xd6, 0x01, 0x75, 0x01, 0x21, 0x02,
+  0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x6f, 0x02, 0x2b, 0x01, 0x82, 0x02, 0x33, 0x01, 0x93, 0x02,
+  0x35, 0x01, 0xa2, 0x02, 0x32, 0x01, 0xb2, 0x02, 0x7c, 0x01, 0xd0, 0x02, 0x7c, 0x01, 0x05, 0x00,
+  0x7e, 0x01, 0x31, 0x00, 0x9a, 0x01, 0x3e, 0x00, 0x86, 0x01, 0x50, 0x00, 0x97, 0x01, 0x75, 0x00,
+  0x80, 0x01, 0xae, 0x00, 0x5b, 0x00, 0xbe, 0x00, 0xae, 0x00, 0xdf, 0x00, 0x42, 0x00, 0xe9, 0x00,
+  0x39, 0x00, 0xf4, 0x00, 0x95, 0x00, 0x20, 0x01, 0x28, 0x01, 0x4d, 0x01, 0x29, 0x01, 0x65, 0x01,
+  0x33, 0x00, 0x7e, 0x01, 0x26, 0x00, 0xb9, 0x01, 0x25, 0x00, 0xc9, 0x01, 0x7a, 0x01, 0xd2, 0x01,
+  0x75, 0x01, 0x21, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x6f, 0x02, 0x2b, 0x01, 0x82, 0x02,
+  0x33, 0x01, 0x94, 0x02, 0x35, 0x01, 0xa3, 0x02, 0x32, 0x01, 0xb2, 0x02, 0x7c, 0x01, 0xd0, 0x02,
+  0x7c, 0x01, 0x04, 0x00, 0x7e, 0x01, 0x33, 0x00, 0x9a, 0x01, 0x3e, 0x00, 0x86, 0x01, 0x4f, 0x00,
+  0x97, 0x01, 0x75, 0x00, 0x80, 0x01, 0xad, 0x00, 0x5b, 0x00, 0xc4, 0x00, 0xae, 0x00, 0xdf, 0x00,
+  0x42, 0x00, 0xe9, 0x00, 0x39, 0x00, 0xf4, 0x00, 0x95, 0x00, 0x1f, 0x01, 0x28, 0x01, 0x50, 0x01,
+  0x29, 0x01, 0x64, 0x01, 0x33, 0x00, 0x7d, 0x01, 0x26, 0x00, 0xba, 0x01, 0x25, 0x00, 0xc9, 0x01,
+  0x7a, 0x01, 0xcd, 0x01, 0x75, 0x01, 0x22, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x6e, 0x02,
+  0x2b, 0x01, 0x81, 0x02, 0x33, 0x01, 0x95, 0x02, 0x35, 0x01, 0xa3, 0x02, 0x32, 0x01, 0xb1, 0x02,
+  0x7c, 0x01, 0xd0, 0x02, 0x7c, 0x01, 0x02, 0x00, 0x7e, 0x01, 0x36, 0x00, 0x9a, 0x01, 0x3e, 0x00,
+  0x86, 0x01, 0x4f, 0x00, 0x97, 0x01, 0x75, 0x00, 0x80, 0x01, 0xac, 0x00, 0x5b, 0x00, 0xca, 0x00,
+  0xae, 0x00, 0xdf, 0x00, 0x42, 0x00, 0xe9, 0x00, 0x39, 0x00, 0xf4, 0x00, 0x95, 0x00, 0x1d, 0x01,
+  0x28, 0x01, 0x52, 0x01, 0x29, 0x01, 0x64, 0x01, 0x33, 0x00, 0x7b, 0x01, 0x26, 0x00, 0xbb, 0x01,
+  0x25, 0x00, 0xc9, 0x01, 0x75, 0x01, 0x23, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x6e, 0x02,
+  0x2b, 0x01, 0x80, 0x02, 0x33, 0x01, 0x96, 0x02, 0x35, 0x01, 0xa4, 0x02, 0x32, 0x01, 0xb1, 0x02,
+  0x7c, 0x01, 0xd0, 0x02, 0x7c, 0x01, 0x01, 0x00, 0x7e, 0x01, 0x3a, 0x00, 0x9a, 0x01, 0x3e, 0x00,
+  0x86, 0x01, 0x4e, 0x00, 0x97, 0x01, 0x75, 0x00, 0x80, 0x01, 0xab, 0x00, 0x5b, 0x00, 0xd3, 0x00,
+  0xae, 0x00, 0xe0, 0x00, 0x42, 0x00, 0xe8, 0x00, 0x39, 0x00, 0xf3, 0x00, 0x95, 0x00, 0x1c, 0x01,
+  0x28, 0x01, 0x55, 0x01, 0x29, 0x01, 0x63, 0x01, 0x33, 0x00, 0x7a, 0x01, 0x26, 0x00, 0xbc, 0x01,
+  0x25, 0x00, 0xc8, 0x01, 0x75, 0x01, 0x23, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x6d, 0x02,
+  0x2b, 0x01, 0x7f, 0x02, 0x33, 0x01, 0x94, 0x02, 0x30, 0x01, 0x9a, 0x02, 0x35, 0x01, 0xa4, 0x02,
+  0x32, 0x01, 0xb0, 0x02, 0x7c, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x3d, 0x00, 0x86, 0x01, 0x4d, 0x00,
+  0x97, 0x01, 0x74, 0x00, 0x80, 0x01, 0xab, 0x00, 0x5b, 0x00, 0xe0, 0x00, 0x42, 0x00, 0xe8, 0x00,
+  0x39, 0x00, 0xf3, 0x00, 0x95, 0x00, 0x1a, 0x01, 0x28, 0x01, 0x58, 0x01, 0x29, 0x01, 0x63, 0x01,
+  0x33, 0x00, 0x79, 0x01, 0x26, 0x00, 0xbe, 0x01, 0x25, 0x00, 0xc7, 0x01, 0x75, 0x01, 0x24, 0x02,
+  0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x6d, 0x02, 0x2b, 0x01, 0x7e, 0x02, 0x33, 0x01, 0x91, 0x02,
+  0x30, 0x01, 0x9e, 0x02, 0x35, 0x01, 0xa5, 0x02, 0x32, 0x01, 0xb0, 0x02, 0x7c, 0x01, 0xd0, 0x02,
+  0x7e, 0x01, 0x3e, 0x00, 0x86, 0x01, 0x4c, 0x00, 0x97, 0x01, 0x74, 0x00, 0x80, 0x01, 0xaa, 0x00,
+  0x5b, 0x00, 0xe4, 0x00, 0x42, 0x00, 0xe8, 0x00, 0x39, 0x00, 0xf3, 0x00, 0x95, 0x00, 0x19, 0x01,
+  0x28, 0x01, 0x5b, 0x01, 0x29, 0x01, 0x62, 0x01, 0x33, 0x00, 0x78, 0x01, 0x26, 0x00, 0xbf, 0x01,
+  0x25, 0x00, 0xc6, 0x01, 0x75, 0x01, 0x25, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x6c, 0x02,
+  0x2b, 0x01, 0x7e, 0x02, 0x33, 0x01, 0x8d, 0x02, 0x30, 0x01, 0xa4, 0x02, 0x35, 0x01, 0xa5, 0x02,
+  0x32, 0x01, 0xaf, 0x02, 0x7c, 0x01, 0xce, 0x02, 0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x3f, 0x00,
+  0x86, 0x01, 0x4c, 0x00, 0x97, 0x01, 0x74, 0x00, 0x80, 0x01, 0xa9, 0x00, 0x5b, 0x00, 0xe8, 0x00,
+  0x39, 0x00, 0xf3, 0x00, 0x95, 0x00, 0x17, 0x01, 0x28, 0x01, 0x5e, 0x01, 0x29, 0x01, 0x62, 0x01,
+  0x33, 0x00, 0x76, 0x01, 0x26, 0x00, 0xc0, 0x01, 0x25, 0x00, 0xc5, 0x01, 0x75, 0x01, 0x25, 0x02,
+  0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x6c, 0x02, 0x2b, 0x01, 0x7d, 0x02, 0x33, 0x01, 0x89, 0x02,
+  0x30, 0x01, 0xa7, 0x02, 0x32, 0x01, 0xae, 0x02, 0x7c, 0x01, 0xcd, 0x02, 0x7e, 0x01, 0xd0, 0x02,
+  0x7e, 0x01, 0x40, 0x00, 0x86, 0x01, 0x4b, 0x00, 0x97, 0x01, 0x74, 0x00, 0x80, 0x01, 0xa8, 0x00,
+  0x5b, 0x00, 0xe9, 0x00, 0x39, 0x00, 0xf2, 0x00, 0x95, 0x00, 0x16, 0x01, 0x28, 0x01, 0x61, 0x01,
+  0x33, 0x00, 0x75, 0x01, 0x26, 0x00, 0xc2, 0x01, 0x25, 0x00, 0xc4, 0x01, 0x75, 0x01, 0x26, 0x02,
+  0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x6b, 0x02, 0x2b, 0x01, 0x7c, 0x02, 0x33, 0x01, 0x85, 0x02,
+  0x30, 0x01, 0xa9, 0x02, 0x32, 0x01, 0xae, 0x02, 0x7c, 0x01, 0xcc, 0x02, 0x7e, 0x01, 0xd0, 0x02,
+  0x7e, 0x01, 0x41, 0x00, 0x86, 0x01, 0x4a, 0x00, 0x97, 0x01, 0x74, 0x00, 0x80, 0x01, 0xa7, 0x00,
+  0x5b, 0x00, 0xeb, 0x00, 0x39, 0x00, 0xf2, 0x00, 0x95, 0x00, 0x14, 0x01, 0x28, 0x01, 0x62, 0x01,
+  0x33, 0x00, 0x74, 0x01, 0x26, 0x00, 0xc3, 0x01, 0x75, 0x01, 0x27, 0x02, 0x34, 0x01, 0x5d, 0x02,
+  0x2f, 0x01, 0x6a, 0x02, 0x2b, 0x01, 0x7b, 0x02, 0x33, 0x01, 0x80, 0x02, 0x30, 0x01, 0xaa, 0x02,
+  0x32, 0x01, 0xad, 0x02, 0x7c, 0x01, 0xca, 0x02, 0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x42, 0x00,
+  0x86, 0x01, 0x49, 0x00, 0x97, 0x01, 0x74, 0x00, 0x80, 0x01, 0xa6, 0x00, 0x5b, 0x00, 0xec, 0x00,
+  0x39, 0x00, 0xf2, 0x00, 0x95, 0x00, 0x12, 0x01, 0x28, 0x01, 0x64, 0x01, 0x33, 0x00, 0x72, 0x01,
+  0x26, 0x00, 0xc2, 0x01, 0x75, 0x01, 0x27, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x6a, 0x02,
+  0x2b, 0x01, 0x7a, 0x02, 0x33, 0x01, 0x7b, 0x02, 0x30, 0x01, 0xac, 0x02, 0x32, 0x01, 0xad, 0x02,
+  0x7c, 0x01, 0xc9, 0x02, 0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x43, 0x00, 0x86, 0x01, 0x49, 0x00,
+  0x97, 0x01, 0x73, 0x00, 0x80, 0x01, 0xa5, 0x00, 0x5b, 0x00, 0xee, 0x00, 0x39, 0x00, 0xf2, 0x00,
+  0x95, 0x00, 0x10, 0x01, 0x28, 0x01, 0x65, 0x01, 0x33, 0x00, 0x71, 0x01, 0x26, 0x00, 0xc1, 0x01,
+  0x75, 0x01, 0x28, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x69, 0x02, 0x2b, 0x01, 0x79, 0x02,
+  0x30, 0x01, 0xad, 0x02, 0x7c, 0x01, 0xc7, 0x02, 0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x44, 0x00,
+  0x86, 0x01, 0x48, 0x00, 0x97, 0x01, 0x73, 0x00, 0x80, 0x01, 0xa4, 0x00, 0x5b, 0x00, 0xef, 0x00,
+  0x2a, 0x01, 0xf4, 0x00, 0x95, 0x00, 0x0f, 0x01, 0x28, 0x01, 0x66, 0x01, 0x33, 0x00, 0x6f, 0x01,
+  0x26, 0x00, 0xc0, 0x01, 0x75, 0x01, 0x29, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x69, 0x02,
+  0x2b, 0x01, 0x77, 0x02, 0x30, 0x01, 0xad, 0x02, 0x7c, 0x01, 0xc5, 0x02, 0x7e, 0x01, 0xd0, 0x02,
+  0x7e, 0x01, 0x45, 0x00, 0x86, 0x01, 0x47, 0x00, 0x97, 0x01, 0x73, 0x00, 0x80, 0x01, 0xa3, 0x00,
+  0x5b, 0x00, 0xee, 0x00, 0x2a, 0x01, 0x0e, 0x01, 0x28, 0x01, 0x67, 0x01, 0x33, 0x00, 0x6e, 0x01,
+  0x26, 0x00, 0xbf, 0x01, 0x75, 0x01, 0x2a, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x68, 0x02,
+  0x2b, 0x01, 0x75, 0x02, 0x30, 0x01, 0xad, 0x02, 0xc6, 0x00, 0xaf, 0x02, 0x7c, 0x01, 0xc4, 0x02,
+  0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x46, 0x00, 0x97, 0x01, 0x73, 0x00, 0x80, 0x01, 0xa2, 0x00,
+  0x5b, 0x00, 0xee, 0x00, 0x2a, 0x01, 0x0e, 0x01, 0x28, 0x01, 0x69, 0x01, 0x33, 0x00, 0x6c, 0x01,
+  0x26, 0x00, 0xbe, 0x01, 0x75, 0x01, 0x2a, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x67, 0x02,
+  0x2b, 0x01, 0x73, 0x02, 0x30, 0x01, 0xab, 0x02, 0xc6, 0x00, 0xb1, 0x02, 0x7c, 0x01, 0xc2, 0x02,
+  0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x47, 0x00, 0x97, 0x01, 0x73, 0x00, 0x80, 0x01, 0xa1, 0x00,
+  0x5b, 0x00, 0xed, 0x00, 0x2a, 0x01, 0x0e, 0x01, 0x28, 0x01, 0x6a, 0x01, 0x33, 0x00, 0x6b, 0x01,
+  0x26, 0x00, 0xbd, 0x01, 0x75, 0x01, 0x2b, 0x02, 0x34, 0x01, 0x5d, 0x02, 0x2f, 0x01, 0x67, 0x02,
+  0x2b, 0x01, 0x71, 0x02, 0x30, 0x01, 0xa9, 0x02, 0xc6, 0x00, 0xb3, 0x02, 0x7c, 0x01, 0xc0, 0x02,
+  0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x48, 0x00, 0x97, 0x01, 0x72, 0x00, 0x80, 0x01, 0xa0, 0x00,
+  0x5b, 0x00, 0xec, 0x00, 0x2a, 0x01, 0x0e, 0x01, 0x28, 0x01, 0x6b, 0x01, 0x26, 0x00, 0xbc, 0x01,
+  0x75, 0x01, 0x2c, 0x02, 0x34, 0x01, 0x5e, 0x02, 0x2f, 0x01, 0x66, 0x02, 0x2b, 0x01, 0x6f, 0x02,
+  0x30, 0x01, 0xa8, 0x02, 0xc6, 0x00, 0xb5, 0x02, 0x7c, 0x01, 0xbe, 0x02, 0x7e, 0x01, 0xd0, 0x02,
+  0x7e, 0x01, 0x49, 0x00, 0x97, 0x01, 0x72, 0x00, 0x80, 0x01, 0x9f, 0x00, 0x5b, 0x00, 0xeb, 0x00,
+  0x2a, 0x01, 0x0d, 0x01, 0x28, 0x01, 0x6c, 0x01, 0x26, 0x00, 0xbb, 0x01, 0x75, 0x01, 0x2d, 0x02,
+  0x34, 0x01, 0x5e, 0x02, 0x2f, 0x01, 0x65, 0x02, 0x2b, 0x01, 0x6c, 0x02, 0x30, 0x01, 0xa6, 0x02,
+  0xc6, 0x00, 0xb7, 0x02, 0x7c, 0x01, 0xbd, 0x02, 0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x4a, 0x00,
+  0x97, 0x01, 0x72, 0x00, 0x80, 0x01, 0x9e, 0x00, 0x5b, 0x00, 0xea, 0x00, 0x2a, 0x01, 0x0d, 0x01,
+  0x28, 0x01, 0x6d, 0x01, 0x26, 0x00, 0xba, 0x01, 0x75, 0x01, 0x2e, 0x02, 0x34, 0x01, 0x5e, 0x02,
+  0x2f, 0x01, 0x64, 0x02, 0x2b, 0x01, 0x6a, 0x02, 0x30, 0x01, 0xa4, 0x02, 0xc6, 0x00, 0xba, 0x02,
+  0x7c, 0x01, 0xbb, 0x02, 0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x4b, 0x00, 0x97, 0x01, 0x72, 0x00,
+  0x80, 0x01, 0x9c, 0x00, 0x5b, 0x00, 0xe9, 0x00, 0x2a, 0x01, 0x0d, 0x01, 0x28, 0x01, 0x6c, 0x01,
+  0xcc, 0x00, 0x6f, 0x01, 0x26, 0x00, 0xb9, 0x01, 0x75, 0x01, 0x2f, 0x02, 0x34, 0x01, 0x5e, 0x02,
+  0x2f, 0x01, 0x64, 0x02, 0x2b, 0x01, 0x68, 0x02, 0x30, 0x01, 0xa2, 0x02, 0xc6, 0x00, 0xbb, 0x02,
+  0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x4c, 0x00, 0x97, 0x01, 0x71, 0x00, 0x80, 0x01, 0x9b, 0x00,
+  0xa7, 0x00, 0x9c, 0x00, 0x5b, 0x00, 0xe6, 0x00, 0x3f, 0x00, 0xe9, 0x00, 0x2a, 0x01, 0x0d, 0x01,
+  0x28, 0x01, 0x6b, 0x01, 0xcc, 0x00, 0x72, 0x01, 0x26, 0x00, 0xb8, 0x01, 0x75, 0x01, 0x2f, 0x02,
+  0x34, 0x01, 0x5e, 0x02, 0x2f, 0x01, 0x63, 0x02, 0x2b, 0x01, 0x65, 0x02, 0x30, 0x01, 0xa0, 0x02,
+  0xc6, 0x00, 0xbc, 0x02, 0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x4d, 0x00, 0x97, 0x01, 0x71, 0x00,
+  0x80, 0x01, 0x99, 0x00, 0xa7, 0x00, 0xa1, 0x00, 0x5b, 0x00, 0xe2, 0x00, 0x3f, 0x00, 0xe9, 0x00,
+  0x2a, 0x01, 0x0c, 0x01, 0x28, 0x01, 0x6a, 0x01, 0xcc, 0x00, 0x75, 0x01, 0x26, 0x00, 0xb7, 0x01,
+  0x75, 0x01, 0x2f, 0x02, 0xc3, 0x00, 0x33, 0x02, 0x34, 0x01, 0x5e, 0x02, 0x2f, 0x01, 0x62, 0x02,
+  0x30, 0x01, 0x9e, 0x02, 0xc6, 0x00, 0xbd, 0x02, 0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x4e, 0x00,
+  0x97, 0x01, 0x71, 0x00, 0x80, 0x01, 0x97, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0x5b, 0x00, 0xde, 0x00,
+  0x3f, 0x00, 0xe9, 0x00, 0x2a, 0x01, 0x0c, 0x01, 0x28, 0x01, 0x69, 0x01, 0xcc, 0x00, 0x78, 0x01,
+  0x26, 0x00, 0xb5, 0x01, 0x75, 0x01, 0x2e, 0x02, 0xc3, 0x00, 0x3a, 0x02, 0x34, 0x01, 0x5e, 0x02,
+  0x2f, 0x01, 0x61, 0x02, 0x30, 0x01, 0x9c, 0x02, 0xc6, 0x00, 0xbe, 0x02, 0x7e, 0x01, 0xd0, 0x02,
+  0x7e, 0x01, 0x4f, 0x00, 0x97, 0x01, 0x71, 0x00, 0x80, 0x01, 0x96, 0x00, 0xa7, 0x00, 0xae, 0x00,
+  0x5b, 0x00, 0xd9, 0x00, 0x3f, 0x00, 0xe9, 0x00, 0x2a, 0x01, 0x0c, 0x01, 0x28, 0x01, 0x69, 0x01,
+  0xcc, 0x00, 0x7c, 0x01, 0x26, 0x00, 0xb0, 0x01, 0xcb, 0x00, 0xb6, 0x01, 0x75, 0x01, 0x2d, 0x02,
+  0xc3, 0x00, 0x42, 0x02, 0x34, 0x01, 0x5e, 0x02, 0x2f, 0x01, 0x5f, 0x02, 0x30, 0x01, 0x99, 0x02,
+  0xc6, 0x00, 0xbf, 0x02, 0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x50, 0x00, 0x97, 0x01, 0x71, 0x00,
+  0x80, 0x01, 0x94, 0x00, 0xa7, 0x00, 0xb8, 0x00, 0x5b, 0x00, 0xd4, 0x00, 0x3f, 0x00, 0xe9, 0x00,
+  0x2a, 0x01, 0x0c, 0x01, 0x28, 0x01, 0x68, 0x01, 0xcc, 0x00, 0x7f, 0x01, 0x26, 0x00, 0xa8, 0x01,
+  0xcb, 0x00, 0xb7, 0x01, 0x75, 0x01, 0x2c, 0x02, 0xc3, 0x00, 0x51, 0x02, 0x34, 0x01, 0x5e, 0x02,
+  0x30, 0x01, 0x97, 0x02, 0xc6, 0x00, 0xc0, 0x02, 0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x51, 0x00,
+  0x97, 0x01, 0x70, 0x00, 0x80, 0x01, 0x91, 0x00, 0xa7, 0x00, 0xd1, 0x00, 0x3f, 0x00, 0xe9, 0x00,
+  0x2a, 0x01, 0x0b, 0x01, 0x28, 0x01, 0x67, 0x01, 0xcc, 0x00, 0x83, 0x01, 0x26, 0x00, 0x9d, 0x01,
+  0xcb, 0x00, 0xb9, 0x01, 0x75, 0x01, 0x2c, 0x02, 0xc3, 0x00, 0x5f, 0x02, 0x30, 0x01, 0x94, 0x02,
+  0xc6, 0x00, 0xc1, 0x02, 0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x52, 0x00, 0x97, 0x01, 0x70, 0x00,
+  0x80, 0x01, 0x8f, 0x00, 0xa7, 0x00, 0xd3, 0x00, 0x3f, 0x00, 0xe9, 0x00, 0x2a, 0x01, 0x0b, 0x01,
+  0x28, 0x01, 0x66, 0x01, 0xcc, 0x00, 0x84, 0x01, 0xcb, 0x00, 0xba, 0x01, 0x75, 0x01, 0x2b, 0x02,
+  0xc3, 0x00, 0x60, 0x02, 0x30, 0x01, 0x92, 0x02, 0xc6, 0x00, 0xc2, 0x02, 0x7e, 0x01, 0xd0, 0x02,
+  0x7e, 0x01, 0x53, 0x00, 0x97, 0x01, 0x70, 0x00, 0x80, 0x01, 0x8d, 0x00, 0xa7, 0x00, 0xd5, 0x00,
+  0x3f, 0x00, 0xe9, 0x00, 0x2a, 0x01, 0x0b, 0x01, 0x28, 0x01, 0x65, 0x01, 0xcc, 0x00, 0x85, 0x01,
+  0xcb, 0x00, 0xbb, 0x01, 0x75, 0x01, 0x2a, 0x02, 0xc3, 0x00, 0x62, 0x02, 0x30, 0x01, 0x8f, 0x02,
+  0xc6, 0x00, 0xc3, 0x02, 0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x55, 0x00, 0x97, 0x01, 0x70, 0x00,
+  0x80, 0x01, 0x8b, 0x00, 0xa7, 0x00, 0xd7, 0x00, 0x3f, 0x00, 0xe9, 0x00, 0x2a, 0x01, 0x0a, 0x01,
+  0x28, 0x01, 0x64, 0x01, 0xcc, 0x00, 0x85, 0x01, 0xcb, 0x00, 0xbd, 0x01, 0x75, 0x01, 0x29, 0x02,
+  0xc3, 0x00, 0x63, 0x02, 0x30, 0x01, 0x8c, 0x02, 0xc6, 0x00, 0xc4, 0x02, 0x7e, 0x01, 0xd0, 0x02,
+  0x7e, 0x01, 0x56, 0x00, 0x97, 0x01, 0x6f, 0x00, 0x80, 0x01, 0x88, 0x00, 0xa7, 0x00, 0xd9, 0x00,
+  0x3f, 0x00, 0xe9, 0x00, 0x2a, 0x01, 0x0a, 0x01, 0x28, 0x01, 0x63, 0x01, 0xcc, 0x00, 0x85, 0x01,
+  0xcb, 0x00, 0xbe, 0x01, 0x75, 0x01, 0x27, 0x02, 0xc3, 0x00, 0x64, 0x02, 0xc5, 0x00, 0x66, 0x02,
+  0x30, 0x01, 0x89, 0x02, 0xc6, 0x00, 0xc5, 0x02, 0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x57, 0x00,
+  0x97, 0x01, 0x6f, 0x00, 0x80, 0x01, 0x86, 0x00, 0xa7, 0x00, 0xdb, 0x00, 0x3f, 0x00, 0xe9, 0x00,
+  0x2a, 0x01, 0x0a, 0x01, 0x28, 0x01, 0x62, 0x01, 0xcc, 0x00, 0x85, 0x01, 0xcb, 0x00, 0xc0, 0x01,
+  0x75, 0x01, 0x26, 0x02, 0xc3, 0x00, 0x64, 0x02, 0xc5, 0x00, 0x6a, 0x02, 0x30, 0x01, 0x86, 0x02,
+  0xc6, 0x00, 0xc6, 0x02, 0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x58, 0x00, 0x97, 0x01, 0x6f, 0x00,
+  0x80, 0x01, 0x83, 0x00, 0xa7, 0x00, 0xde, 0x00, 0x3f, 0x00, 0xe6, 0x00, 0x44, 0x00, 0xe9, 0x00,
+  0x2a, 0x01, 0x09, 0x01, 0x28, 0x01, 0x61, 0x01, 0xcc, 0x00, 0x85, 0x01, 0xcb, 0x00, 0xc1, 0x01,
+  0x75, 0x01, 0x25, 0x02, 0xc3, 0x00, 0x64, 0x02, 0xc5, 0x00, 0x6e, 0x02, 0x30, 0x01, 0x82, 0x02,
+  0xc6, 0x00, 0xc8, 0x02, 0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x5a, 0x00, 0x97, 0x01, 0x6e, 0x00,
+  0x80, 0x01, 0x80, 0x00, 0xa7, 0x00, 0xdf, 0x00, 0x44, 0x00, 0xea, 0x00, 0x2a, 0x01, 0x09, 0x01,
+  0x28, 0x01, 0x60, 0x01, 0xcc, 0x00, 0x86, 0x01, 0xcb, 0x00, 0xc3, 0x01, 0x75, 0x01, 0x24, 0x02,
+  0xc3, 0x00, 0x64, 0x02, 0xc5, 0x00, 0x73, 0x02, 0x30, 0x01, 0x7e, 0x02, 0xc6, 0x00, 0xc9, 0x02,
+  0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x5b, 0x00, 0x97, 0x01, 0x6e, 0x00, 0x80, 0x01, 0x79, 0x00,
+  0xca, 0x00, 0x81, 0x00, 0xa7, 0x00, 0xde, 0x00, 0x44, 0x00, 0xeb, 0x00, 0x2a, 0x01, 0x09, 0x01,
+  0x28, 0x01, 0x5f, 0x01, 0xcc, 0x00, 0x86, 0x01, 0xcb, 0x00, 0xc4, 0x01, 0x75, 0x01, 0x23, 0x02,
+  0xc3, 0x00, 0x64, 0x02, 0xc5, 0x00, 0x79, 0x02, 0x30, 0x01, 0x7a, 0x02, 0xc6, 0x00, 0xca, 0x02,
+  0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x5c, 0x00, 0x97, 0x01, 0x6d, 0x00, 0xca, 0x00, 0x84, 0x00,
+  0xa7, 0x00, 0xdc, 0x00, 0x44, 0x00, 0xec, 0x00, 0x2a, 0x01, 0x08, 0x01, 0x28, 0x01, 0x5d, 0x01,
+  0xcc, 0x00, 0x86, 0x01, 0xcb, 0x00, 0xc6, 0x01, 0x75, 0x01, 0x22, 0x02, 0xc3, 0x00, 0x64, 0x02,
+  0xc5, 0x00, 0x7b, 0x02, 0xc6, 0x00, 0xcc, 0x02, 0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x5e, 0x00,
+  0x97, 0x01, 0x6a, 0x00, 0xca, 0x00, 0x87, 0x00, 0xa7, 0x00, 0xda, 0x00, 0x44, 0x00, 0xed, 0x00,
+  0x2a, 0x01, 0x08, 0x01, 0x28, 0x01, 0x5c, 0x01, 0xcc, 0x00, 0x86, 0x01, 0xcb, 0x00, 0xc7, 0x01,
+  0xc7, 0x00, 0xc8, 0x01, 0x75, 0x01, 0x21, 0x02, 0xc3, 0x00, 0x64, 0x02, 0xc5, 0x00, 0x7c, 0x02,
+  0xc6, 0x00, 0xcd, 0x02, 0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x5f, 0x00, 0x97, 0x01, 0x65, 0x00,
+  0xca, 0x00, 0x8a, 0x00, 0xa7, 0x00, 0xd8, 0x00, 0x44, 0x00, 0xee, 0x00, 0x2a, 0x01, 0x08, 0x01,
+  0x28, 0x01, 0x5b, 0x01, 0xcc, 0x00, 0x87, 0x01, 0xcb, 0x00, 0xc7, 0x01, 0xc7, 0x00, 0xcb, 0x01,
+  0x75, 0x01, 0x1f, 0x02, 0xc3, 0x00, 0x64, 0x02, 0xc5, 0x00, 0x7e, 0x02, 0xc6, 0x00, 0xce, 0x02,
+  0x7e, 0x01, 0xd0, 0x02, 0x7e, 0x01, 0x5e, 0x00, 0xc8, 0x00, 0x62, 0x00, 0xca, 0x00, 0x8d, 0x00,
+  0xa7, 0x00, 0xd6, 0x00, 0x44, 0x00, 0xee, 0x00, 0x2a, 0x01, 0x07, 0x01, 0x28, 0x01, 0x5a, 0x01,
+  0xcc, 0x00, 0x87, 0x01, 0xcb, 0x00, 0xc8, 0x01, 0xc7, 0x00, 0xcf, 0x01, 0x75, 0x01, 0x1e, 0x02,
+  0xc3, 0x00, 0x64, 0x02, 0xc5, 0x00, 0x80, 0x02, 0xc6, 0x00, 0xd0, 0x02, 0xc6, 0x00, 0x01, 0x00,
+  0x7e, 0x01, 0x5c, 0x00, 0xc8, 0x00, 0x63, 0x00, 0xca, 0x00, 0x90, 0x00, 0xa7, 0x00, 0xd4, 0x00,
+  0x44, 0x00, 0xef, 0x00, 0x2a, 0x01, 0x07, 0x01, 0x28, 0x01, 0x58, 0x01, 0xcc, 0x00, 0x87, 0x01,
+  0xcb, 0x00, 0xc8, 0x01, 0xc7, 0x00, 0xd3, 0x01, 0x75, 0x01, 0x1a, 0x02, 0xc4, 0x00, 0x1e, 0x02,
+  0xc3, 0x00, 0x64, 0x02, 0xc5, 0x00, 0x82, 0x02, 0xc6, 0x00, 0xd0, 0x02, 0xc6, 0x00, 0x03, 0x00,
+  0x7e, 0x01, 0x58, 0x00, 0xc8, 0x00, 0x63, 0x00, 0xca, 0x00, 0x94, 0x00, 0xa7, 0x00, 0xd1, 0x00,
+  0x44, 0x00, 0xf0, 0x00, 0x2a, 0x01, 0x07, 0x01, 0x28, 0x01, 0x57, 0x01, 0xcc, 0x00, 0x87, 0x01,
+  0xcb, 0x00, 0xc8, 0x01, 0xc7, 0x00, 0xd8, 0x01, 0x75, 0x01, 0x16, 0x02, 0xc4, 0x00, 0x1e, 0x02,
+  0xc3, 0x00, 0x64, 0x02, 0xc5, 0x00, 0x83, 0x02, 0xc6, 0x00, 0xd0, 0x02, 0xc6, 0x00, 0x05, 0x00,
+  0x7e, 0x01, 0x55, 0x00, 0xc8, 0x00, 0x63, 0x00, 0xca, 0x00, 0x98, 0x00, 0xa7, 0x00, 0xcf, 0x00,
+  0x44, 0x00, 0xf1, 0x00, 0x2a, 0x01, 0x06, 0x01, 0x28, 0x01, 0x56, 0x01, 0xcc, 0x00, 0x88, 0x01,
+  0xcb, 0x00, 0xc8, 0x01, 0xc7, 0x00, 0xdd, 0x01, 0x75, 0x01, 0x12, 0x02, 0xc4, 0x00, 0x1e, 0x02,
+  0xc3, 0x00, 0x64, 0x02, 0xc5, 0x00, 0x85, 0x02, 0xc6, 0x00, 0xd0, 0x02, 0xc6, 0x00, 0x06, 0x00,
+  0x7e, 0x01, 0x51, 0x00, 0xc8, 0x00, 0x64, 0x00, 0xca, 0x00, 0x9c, 0x00, 0xa7, 0x00, 0xcd, 0x00,
+  0x44, 0x00, 0xf3, 0x00, 0x2a, 0x01, 0x06, 0x01, 0x28, 0x01, 0x54, 0x01, 0xcc, 0x00, 0x88, 0x01,
+  0xcb, 0x00, 0xc8, 0x01, 0xc7, 0x00, 0xe3, 0x01, 0x75, 0x01, 0x0d, 0x02, 0xc4, 0x00, 0x1f, 0x02,
+  0xc3, 0x00, 0x63, 0x02, 0xc5, 0x00, 0x87, 0x02, 0xc6, 0x00, 0xd0, 0x02, 0xc6, 0x00, 0x08, 0x00,
+  0x7e, 0x01, 0x4e, 0x00, 0xc8, 0x00, 0x64, 0x00, 0xca, 0x00, 0xa1, 0x00, 0xa7, 0x00, 0xca, 0x00,
+  0x44, 0x00, 0xf4, 0x00, 0x2a, 0x01, 0x05, 0x01, 0x28, 0x01, 0x53, 0x01, 0xcc, 0x00, 0x88, 0x01,
+  0xcb, 0x00, 0xc9, 0x01, 0xc7, 0x00, 0xea, 0x01, 0x75, 0x01, 0x06, 0x02, 0xc4, 0x00, 0x1f, 0x02,
+  0xc3, 0x00, 0x63, 0x02, 0xc5, 0x00, 0x89, 0x02, 0xc6, 0x00, 0xd0, 0x02, 0xc6, 0x00, 0x0a, 0x00,
+  0x7e, 0x01, 0x49, 0x00, 0xc8, 0x00, 0x64, 0x00, 0xca, 0x00, 0xa6, 0x00, 0xa7, 0x00, 0xc7, 0x00,
+  0x44, 0x00, 0xf3, 0x00, 0xc9, 0x00, 0xf8, 0x00, 0x2a, 0x01, 0x05, 0x01, 0x28, 0x01, 0x51, 0x01,
+  0xcc, 0x00, 0x88, 0x01, 0xcb, 0x00, 0xc9, 0x01, 0xc7, 0x00, 0xf4, 0x01, 0x75, 0x01, 0xff, 0x01,
+  0xc4, 0x00, 0x1f, 0x02, 0xc3, 0x00, 0x63, 0x02, 0xc5, 0x00, 0x8c, 0x02, 0xc6, 0x00, 0xd0, 0x02,
+  0xc6, 0x00, 0x0c, 0x00, 0x7e, 0x01, 0x44, 0x00, 0xc8, 0x00, 0x65, 0x00, 0xca, 0x00, 0xac, 0x00,
+  0xa7, 0x00, 0xc4, 0x00, 0x44, 0x00, 0xec, 0x00, 0xc9, 0x00, 0x05, 0x01, 0x28, 0x01, 0x4f, 0x01,
+  0xcc, 0x00, 0x89, 0x01, 0xcb, 0x00, 0xc9, 0x01, 0xc7, 0x00, 0xfb, 0x01, 0xc4, 0x00, 0x1f, 0x02,
+  0xc3, 0x00, 0x63, 0x02, 0xc5, 0x00, 0x8e, 0x02, 0xc6, 0x00, 0xd0, 0x02, 0xc6, 0x00, 0x0e, 0x00,
+  0x7e, 0x01, 0x3f, 0x00, 0xc8, 0x00, 0x65, 0x00, 0xca, 0x00, 0xb4, 0x00, 0xa7, 0x00, 0xc1, 0x00,
+  0x44, 0x00, 0xe4, 0x00, 0xc9, 0x00, 0x06, 0x01, 0x28, 0x01, 0x4e, 0x01, 0xcc, 0x00, 0x89, 0x01,
+  0xcb, 0x00, 0xc9, 0x01, 0xc7, 0x00, 0xfa, 0x01, 0xc4, 0x00, 0x20, 0x02, 0xc3, 0x00, 0x63, 0x02,
+  0xc5, 0x00, 0x90, 0x02, 0xc6, 0x00, 0xd0, 0x02, 0xc6, 0x00, 0x10, 0x00, 0x7e, 0x01, 0x39, 0x00,
+  0xc8, 0x00, 0x66, 0x00, 0xca, 0x00, 0xbf, 0x00, 0x44, 0x00, 0xd8, 0x00, 0xc9, 0x00, 0x08, 0x01,
+  0x28, 0x01, 0x4c, 0x01, 0xcc, 0x00, 0x89, 0x01, 0xcb, 0x00, 0xca, 0x01, 0xc7, 0x00, 0xfa, 0x01,
+  0xc4, 0x00, 0x20, 0x02, 0xc3, 0x00, 0x63, 0x02, 0xc5, 0x00, 0x93, 0x02, 0xc6, 0x00, 0xd0, 0x02,
+  0xc6, 0x00, 0x12, 0x00, 0x7e, 0x01, 0x30, 0x00, 0xc8, 0x00, 0x66, 0x00, 0xca, 0x00, 0xc4, 0x00,
+  0xc9, 0x00, 0x09, 0x01, 0x28, 0x01, 0x4a, 0x01, 0xcc, 0x00, 0x8a, 0x01, 0xcb, 0x00, 0xca, 0x01,
+  0xc7, 0x00, 0xfa, 0x01, 0xc4, 0x00, 0x20, 0x02, 0xc3, 0x00, 0x63, 0x02, 0xc5, 0x00, 0x96, 0x02,
+  0xc6, 0x00, 0xd0, 0x02, 0xc6, 0x00, 0x15, 0x00, 0x7e, 0x01, 0x24, 0x00, 0xc8, 0x00, 0x66, 0x00,
+  0xca, 0x00, 0xc7, 0x00, 0xc9, 0x00, 0x0b, 0x01, 0x28, 0x01, 0x48, 0x01, 0xcc, 0x00, 0x8a, 0x01,
+  0xcb, 0x00, 0xca, 0x01, 0xc7, 0x00, 0xfa, 0x01, 0xc4, 0x00, 0x20, 0x02, 0xc3, 0x00, 0x63, 0x02,
+  0xc5, 0x00, 0x99, 0x02, 0xc6, 0x00, 0xd0, 0x02, 0xc6, 0x00, 0x14, 0x00, 0xc8, 0x00, 0x67, 0x00,
+  0xca, 0x00, 0xc9, 0x00, 0xc9, 0x00, 0x0d, 0x01, 0x28, 0x01, 0x46, 0x01, 0xcc, 0x00, 0x8a, 0x01,
+  0xcb, 0x00, 0xca, 0x01, 0xc7, 0x00, 0xf9, 0x01, 0xc4, 0x00, 0x21, 0x02, 0xc3, 0x00, 0x63, 0x02,
+  0xc5, 0x00, 0x9c, 0x02, 0xc6, 0x00, 0xd0, 0x02, 0xc6, 0x00, 0x10, 0x00, 0xc8, 0x00, 0x67, 0x00,
+  0xca, 0x00, 0xcb, 0x00, 0xc9, 0x00, 0x0f, 0x01, 0x28, 0x01, 0x44, 0x01, 0xcc, 0x00, 0x8b, 0x01,
+  0xcb, 0x00, 0xcb, 0x01, 0xc7, 0x00, 0xf9, 0x01, 0xc4, 0x00, 0x21, 0x02, 0xc3, 0x00, 0x63, 0x02,
+  0xc5, 0x00, 0x9f, 0x02, 0xc6, 0x00, 0xd0, 0x02, 0xc6, 0x00, 0x0d, 0x00, 0xc8, 0x00, 0x68, 0x00,
+  0xca, 0x00, 0xce, 0x00, 0xc9, 0x00, 0x11, 0x01, 0x28, 0x01, 0x42, 0x01, 0xcc, 0x00, 0x8b, 0x01,
+  0xcb, 0x00, 0xcb, 0x01, 0xc7, 0x00, 0xf9, 0x01, 0xc4, 0x00, 0x21, 0x02, 0xc3, 0x00, 0x63, 0x02,
+  0xc5, 0x00, 0xa2, 0x02, 0xc6, 0x00, 0xd0, 0x02, 0xc6, 0x00, 0x08, 0x00, 0xc8, 0x00, 0x68, 0x00,
+  0xca, 0x00, 0xd0, 0x00, 0xc9, 0x00, 0x13, 0x01, 0x28, 0x01, 0x3f, 0x01, 0xcc, 0x00, 0x8c, 0x01,
+  0xcb, 0x00, 0xcb, 0x01, 0xc7, 0x00, 0xf8, 0x01, 0xc4, 0x00, 0x22, 0x02, 0xc3, 0x00, 0x63, 0x02,
+  0xc5, 0x00, 0xa6, 0x02, 0xc6, 0x00, 0xd0, 0x02, 0xc6, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x69, 0x00,
+  0xca, 0x00, 0xd3, 0x00, 0xc9, 0x00, 0x15, 0x01, 0x28, 0x01, 0x3d, 0x01, 0xcc, 0x00, 0x8c, 0x01,
+  0xcb, 0x00, 0xcb, 0x01, 0xc7, 0x00, 0xf8, 0x01, 0xc4, 0x00, 0x22, 0x02, 0xc3, 0x00, 0x63, 0x02,
+  0xc5, 0x00, 0xab, 0x02, 0xc6, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x69, 0x00, 0xca, 0x00, 0xd6, 0x00,
+  0xc9, 0x00, 0x17, 0x01, 0x28, 0x01, 0x3a, 0x01, 0xcc, 0x00, 0x8c, 0x01, 0xcb, 0x00, 0xcc, 0x01,
+  0xc7, 0x00, 0xf8, 0x01, 0xc4, 0x00, 0x23, 0x02, 0xc3, 0x00, 0x63, 0x02, 0xc5, 0x00, 0xaf, 0x02,
+  0xc6, 0x00, 0xcf, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x6a, 0x00, 0xca, 0x00, 0xd9, 0x00,
+  0xc9, 0x00, 0x1a, 0x01, 0x28, 0x01, 0x37, 0x01, 0xcc, 0x00, 0x8d, 0x01, 0xcb, 0x00, 0xcc, 0x01,
+  0xc7, 0x00, 0xf7, 0x01, 0xc4, 0x00, 0x23, 0x02, 0xc3, 0x00, 0x63, 0x02, 0xc5, 0x00, 0xb5, 0x02,
+  0xc6, 0x00, 0xc9, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x6b, 0x00, 0xca, 0x00, 0xdd, 0x00,
+  0xc9, 0x00, 0x1c, 0x01, 0x28, 0x01, 0x34, 0x01, 0xcc, 0x00, 0x8d, 0x01, 0xcb, 0x00, 0xcc, 0x01,
+  0xc7, 0x00, 0xf7, 0x01, 0xc4, 0x00, 0x23, 0x02, 0xc3, 0x00, 0x63, 0x02, 0xc5, 0x00, 0xbb, 0x02,
+  0xc6, 0x00, 0xc1, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x6b, 0x00, 0xca, 0x00, 0xe0, 0x00,
+  0xc9, 0x00, 0x1f, 0x01, 0x28, 0x01, 0x31, 0x01, 0xcc, 0x00, 0x8e, 0x01, 0xcb, 0x00, 0xcd, 0x01,
+  0xc7, 0x00, 0xf7, 0x01, 0xc4, 0x00, 0x24, 0x02, 0xc3, 0x00, 0x63, 0x02, 0xc5, 0x00, 0xbd, 0x02,
+  0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x6c, 0x00, 0xca, 0x00, 0xe4, 0x00, 0xc9, 0x00, 0x22, 0x01,
+  0x28, 0x01, 0x2e, 0x01, 0xcc, 0x00, 0x8e, 0x01, 0xcb, 0x00, 0xcd, 0x01, 0xc7, 0x00, 0xf6, 0x01,
+  0xc4, 0x00, 0x24, 0x02, 0xc3, 0x00, 0x62, 0x02, 0xc5, 0x00, 0xbb, 0x02, 0xc8, 0x00, 0xd0, 0x02,
+  0xc8, 0x00, 0x6c, 0x00, 0xca, 0x00, 0xe9, 0x00, 0xc9, 0x00, 0x25, 0x01, 0x28, 0x01, 0x2a, 0x01,
+  0xcc, 0x00, 0x8f, 0x01, 0xcb, 0x00, 0xce, 0x01, 0xc7, 0x00, 0xf6, 0x01, 0xc4, 0x00, 0x25, 0x02,
+  0xc3, 0x00, 0x62, 0x02, 0xc5, 0x00, 0xb9, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x6d, 0x00,
+  0xca, 0x00, 0xee, 0x00, 0xc9, 0x00, 0x27, 0x01, 0xcc, 0x00, 0x8f, 0x01, 0xcb, 0x00, 0xce, 0x01,
+  0xc7, 0x00, 0xf5, 0x01, 0xc4, 0x00, 0x25, 0x02, 0xc3, 0x00, 0x62, 0x02, 0xc5, 0x00, 0xb6, 0x02,
+  0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x6e, 0x00, 0xca, 0x00, 0xf4, 0x00, 0xc9, 0x00, 0x26, 0x01,
+  0xcc, 0x00, 0x90, 0x01, 0xcb, 0x00, 0xce, 0x01, 0xc7, 0x00, 0xf5, 0x01, 0xc4, 0x00, 0x26, 0x02,
+  0xc3, 0x00, 0x62, 0x02, 0xc5, 0x00, 0xb4, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x6f, 0x00,
+  0xca, 0x00, 0xfa, 0x00, 0xc9, 0x00, 0x25, 0x01, 0xcc, 0x00, 0x90, 0x01, 0xcb, 0x00, 0xcf, 0x01,
+  0xc7, 0x00, 0xf5, 0x01, 0xc4, 0x00, 0x26, 0x02, 0xc3, 0x00, 0x62, 0x02, 0xc5, 0x00, 0xb2, 0x02,
+  0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x6f, 0x00, 0xca, 0x00, 0x03, 0x01, 0xc9, 0x00, 0x24, 0x01,
+  0xcc, 0x00, 0x91, 0x01, 0xcb, 0x00, 0xcf, 0x01, 0xc7, 0x00, 0xf4, 0x01, 0xc4, 0x00, 0x27, 0x02,
+  0xc3, 0x00, 0x62, 0x02, 0xc5, 0x00, 0xaf, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x70, 0x00,
+  0xca, 0x00, 0x0f, 0x01, 0xc9, 0x00, 0x23, 0x01, 0xcc, 0x00, 0x92, 0x01, 0xcb, 0x00, 0xd0, 0x01,
+  0xc7, 0x00, 0xf4, 0x01, 0xc4, 0x00, 0x27, 0x02, 0xc3, 0x00, 0x62, 0x02, 0xc5, 0x00, 0xac, 0x02,
+  0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x71, 0x00, 0xca, 0x00, 0x23, 0x01, 0xcc, 0x00, 0x92, 0x01,
+  0xcb, 0x00, 0xd0, 0x01, 0xc7, 0x00, 0xf3, 0x01, 0xc4, 0x00, 0x28, 0x02, 0xc3, 0x00, 0x62, 0x02,
+  0xc5, 0x00, 0xa9, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x72, 0x00, 0xca, 0x00, 0x22, 0x01,
+  0xcc, 0x00, 0x93, 0x01, 0xcb, 0x00, 0xd1, 0x01, 0xc7, 0x00, 0xf2, 0x01, 0xc4, 0x00, 0x28, 0x02,
+  0xc3, 0x00, 0x62, 0x02, 0xc5, 0x00, 0xa6, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x73, 0x00,
+  0xca, 0x00, 0x21, 0x01, 0xcc, 0x00, 0x94, 0x01, 0xcb, 0x00, 0xd1, 0x01, 0xc7, 0x00, 0xf2, 0x01,
+  0xc4, 0x00, 0x29, 0x02, 0xc3, 0x00, 0x62, 0x02, 0xc5, 0x00, 0xa3, 0x02, 0xc8, 0x00, 0xd0, 0x02,
+  0xc8, 0x00, 0x74, 0x00, 0xca, 0x00, 0x21, 0x01, 0xcc, 0x00, 0x95, 0x01, 0xcb, 0x00, 0xd2, 0x01,
+  0xc7, 0x00, 0xf1, 0x01, 0xc4, 0x00, 0x2a, 0x02, 0xc3, 0x00, 0x61, 0x02, 0xc5, 0x00, 0x9f, 0x02,
+  0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x75, 0x00, 0xca, 0x00, 0x20, 0x01, 0xcc, 0x00, 0x95, 0x01,
+  0xcb, 0x00, 0xd2, 0x01, 0xc7, 0x00, 0xf1, 0x01, 0xc4, 0x00, 0x2a, 0x02, 0xcd, 0x00, 0x2c, 0x02,
+  0xc3, 0x00, 0x61, 0x02, 0xc5, 0x00, 0x9b, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x76, 0x00,
+  0xca, 0x00, 0x1f, 0x01, 0xcc, 0x00, 0x96, 0x01, 0xcb, 0x00, 0xd3, 0x01, 0xc7, 0x00, 0xf0, 0x01,
+  0xc4, 0x00, 0x26, 0x02, 0xcd, 0x00, 0x3c, 0x02, 0xc3, 0x00, 0x5c, 0x02, 0xcd, 0x00, 0x62, 0x02,
+  0xc5, 0x00, 0x96, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x77, 0x00, 0xca, 0x00, 0x1f, 0x01,
+  0xcc, 0x00, 0x97, 0x01, 0xcb, 0x00, 0xd4, 0x01, 0xc7, 0x00, 0xef, 0x01, 0xc4, 0x00, 0x23, 0x02,
+  0xcd, 0x00, 0x66, 0x02, 0xc5, 0x00, 0x91, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x78, 0x00,
+  0xca, 0x00, 0x1e, 0x01, 0xcc, 0x00, 0x98, 0x01, 0xcb, 0x00, 0xd4, 0x01, 0xc7, 0x00, 0xee, 0x01,
+  0xc4, 0x00, 0x1f, 0x02, 0xcd, 0x00, 0x6b, 0x02, 0xc5, 0x00, 0x8c, 0x02, 0xc8, 0x00, 0xd0, 0x02,
+  0xc8, 0x00, 0x7a, 0x00, 0xca, 0x00, 0x1d, 0x01, 0xcc, 0x00, 0x99, 0x01, 0xcb, 0x00, 0xd5, 0x01,
+  0xc7, 0x00, 0xee, 0x01, 0xc4, 0x00, 0x1a, 0x02, 0xcd, 0x00, 0x70, 0x02, 0xc5, 0x00, 0x85, 0x02,
+  0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x7b, 0x00, 0xca, 0x00, 0x1c, 0x01, 0xcc, 0x00, 0x9a, 0x01,
+  0xcb, 0x00, 0xd6, 0x01, 0xc7, 0x00, 0xed, 0x01, 0xc4, 0x00, 0x15, 0x02, 0xcd, 0x00, 0x76, 0x02,
+  0xc5, 0x00, 0x7d, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x7d, 0x00, 0xca, 0x00, 0x1b, 0x01,
+  0xcc, 0x00, 0x9c, 0x01, 0xcb, 0x00, 0xd7, 0x01, 0xc7, 0x00, 0xec, 0x01, 0xc4, 0x00, 0x10, 0x02,
+  0xcd, 0x00, 0x79, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x7e, 0x00, 0xca, 0x00, 0x1a, 0x01,
+  0xcc, 0x00, 0x9d, 0x01, 0xcb, 0x00, 0xd8, 0x01, 0xc7, 0x00, 0xeb, 0x01, 0xc4, 0x00, 0x09, 0x02,
+  0xcd, 0x00, 0x79, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x80, 0x00, 0xca, 0x00, 0x19, 0x01,
+  0xcc, 0x00, 0x9e, 0x01, 0xcb, 0x00, 0xd9, 0x01, 0xc7, 0x00, 0xea, 0x01, 0xc4, 0x00, 0x01, 0x02,
+  0xcd, 0x00, 0x79, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x82, 0x00, 0xca, 0x00, 0x18, 0x01,
+  0xcc, 0x00, 0xa0, 0x01, 0xcb, 0x00, 0xda, 0x01, 0xc7, 0x00, 0xe9, 0x01, 0xc4, 0x00, 0xf7, 0x01,
+  0xcd, 0x00, 0x79, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x84, 0x00, 0xca, 0x00, 0x17, 0x01,
+  0xcc, 0x00, 0xa1, 0x01, 0xcb, 0x00, 0xdb, 0x01, 0xc7, 0x00, 0xe7, 0x01, 0xc4, 0x00, 0xe9, 0x01,
+  0xcd, 0x00, 0x7a, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x86, 0x00, 0xca, 0x00, 0x15, 0x01,
+  0xcc, 0x00, 0xa3, 0x01, 0xcb, 0x00, 0xdc, 0x01, 0xc7, 0x00, 0xe0, 0x01, 0xcd, 0x00, 0x7a, 0x02,
+  0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x88, 0x00, 0xca, 0x00, 0x14, 0x01, 0xcc, 0x00, 0xa5, 0x01,
+  0xcb, 0x00, 0xda, 0x01, 0xcd, 0x00, 0x7a, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x8b, 0x00,
+  0xca, 0x00, 0x12, 0x01, 0xcc, 0x00, 0xa7, 0x01, 0xcb, 0x00, 0xd6, 0x01, 0xcd, 0x00, 0x7a, 0x02,
+  0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x8e, 0x00, 0xca, 0x00, 0x10, 0x01, 0xcc, 0x00, 0xa9, 0x01,
+  0xcb, 0x00, 0xd2, 0x01, 0xcd, 0x00, 0x7b, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x91, 0x00,
+  0xca, 0x00, 0x0e, 0x01, 0xcc, 0x00, 0xab, 0x01, 0xcb, 0x00, 0xcc, 0x01, 0xcd, 0x00, 0x7b, 0x02,
+  0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x95, 0x00, 0xca, 0x00, 0x0c, 0x01, 0xcc, 0x00, 0xae, 0x01,
+  0xcb, 0x00, 0xc6, 0x01, 0xcd, 0x00, 0x7b, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x99, 0x00,
+  0xca, 0x00, 0x0a, 0x01, 0xcc, 0x00, 0xb1, 0x01, 0xcb, 0x00, 0xbf, 0x01, 0xcd, 0x00, 0x7b, 0x02,
+  0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0x9d, 0x00, 0xca, 0x00, 0x07, 0x01, 0xcc, 0x00, 0xb5, 0x01,
+  0xcb, 0x00, 0xb6, 0x01, 0xcd, 0x00, 0x7c, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0xa3, 0x00,
+  0xca, 0x00, 0x04, 0x01, 0xcc, 0x00, 0xb2, 0x01, 0xcd, 0x00, 0x7c, 0x02, 0xc8, 0x00, 0xd0, 0x02,
+  0xc8, 0x00, 0xa9, 0x00, 0xca, 0x00, 0x01, 0x01, 0xcc, 0x00, 0xaf, 0x01, 0xcd, 0x00, 0x7d, 0x02,
+  0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0xb0, 0x00, 0xca, 0x00, 0xfd, 0x00, 0xcc, 0x00, 0xaa, 0x01,
+  0xcd, 0x00, 0x7d, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0xb9, 0x00, 0xca, 0x00, 0xf8, 0x00,
+  0xcc, 0x00, 0xa6, 0x01, 0xcd, 0x00, 0x7e, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0xc5, 0x00,
+  0xca, 0x00, 0xf3, 0x00, 0xcc, 0x00, 0xa0, 0x01, 0xcd, 0x00, 0x7e, 0x02, 0xc8, 0x00, 0xd0, 0x02,
+  0xc8, 0x00, 0xd5, 0x00, 0xca, 0x00, 0xed, 0x00, 0xcc, 0x00, 0x99, 0x01, 0xcd, 0x00, 0x7f, 0x02,
+  0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0xe9, 0x00, 0xcc, 0x00, 0x90, 0x01, 0xcd, 0x00, 0x80, 0x02,
+  0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0xf0, 0x00, 0xcc, 0x00, 0x85, 0x01, 0xcd, 0x00, 0x81, 0x02,
+  0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0xf8, 0x00, 0xcc, 0x00, 0x76, 0x01, 0xcd, 0x00, 0x83, 0x02,
+  0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0xfd, 0x00, 0xcd, 0x00, 0x0c, 0x01, 0xcc, 0x00, 0x5d, 0x01,
+  0xcd, 0x00, 0x84, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0xfb, 0x00, 0xcd, 0x00, 0x86, 0x02,
+  0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0xf9, 0x00, 0xcd, 0x00, 0x89, 0x02, 0xc8, 0x00, 0xd0, 0x02,
+  0xc8, 0x00, 0xf5, 0x00, 0xcd, 0x00, 0x8d, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0xf0, 0x00,
+  0xcd, 0x00, 0x92, 0x02, 0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0xe7, 0x00, 0xcd, 0x00, 0x9b, 0x02,
+  0xc8, 0x00, 0xd0, 0x02, 0xc8, 0x00, 0xd7, 0x00, 0xcd, 0x00, 0xab, 0x02, 0xc8, 0x00, 0xd0, 0x02,
+  0xcd, 0x00, 0x07, 0x00, 0xc8, 0x00, 0xaa, 0x00, 0xcd, 0x00, 0xd0, 0x02, 0xcd, 0x00, 0xd0, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+  0x76, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00,
+  0xb8, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00,
+  0xf3, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x15, 0x01, 0x00, 0x00, 0x25, 0x01, 0x00, 0x00,
+  0x33, 0x01, 0x00, 0x00, 0x43, 0x01, 0x00, 0x00, 0x53, 0x01, 0x00, 0x00, 0x63, 0x01, 0x00, 0x00,
+  0x71, 0x01, 0x00, 0x00, 0x85, 0x01, 0x00, 0x00, 0x91, 0x01, 0x00, 0x00, 0xa0, 0x01, 0x00, 0x00,
+  0xb0, 0x01, 0x00, 0x00, 0xbe, 0x01, 0x00, 0x00, 0xce, 0x01, 0x00, 0x00, 0xdb, 0x01, 0x00, 0x00,
+  0xed, 0x01, 0x00, 0x00, 0xf9, 0x01, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x19, 0x02, 0x00, 0x00,
+  0x27, 0x02, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, 0x43, 0x02, 0x00, 0x00, 0x51, 0x02, 0x00, 0x00,
+  0x60, 0x02, 0x00, 0x00, 0x71, 0x02, 0x00, 0x00, 0x81, 0x02, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00,
+  0xa0, 0x02, 0x00, 0x00, 0xae, 0x02, 0x00, 0x00, 0xc0, 0x02, 0x00, 0x00, 0xd3, 0x02, 0x00, 0x00,
+  0xe5, 0x02, 0x00, 0x00, 0xf5, 0x02, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x11, 0x03, 0x00, 0x00,
+  0x21, 0x03, 0x00, 0x00, 0x2e, 0x03, 0x00, 0x00, 0x40, 0x03, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00,
+  0x61, 0x03, 0x00, 0x00, 0x73, 0x03, 0x00, 0x00, 0x92, 0x03, 0x00, 0x00, 0xae, 0x03, 0x00, 0x00,
+  0xc8, 0x03, 0x00, 0x00, 0xe0, 0x03, 0x00, 0x00, 0xfb, 0x03, 0x00, 0x00, 0x15, 0x04, 0x00, 0x00,
+  0x34, 0x04, 0x00, 0x00, 0x4c, 0x04, 0x00, 0x00, 0x67, 0x04, 0x00, 0x00, 0x82, 0x04, 0x00, 0x00,
+  0x9c, 0x04, 0x00, 0x00, 0xb6, 0x04, 0x00, 0x00, 0xc4, 0x04, 0x00, 0x00, 0xd5, 0x04, 0x00, 0x00,
+  0xe6, 0x04, 0x00, 0x00, 0xf4, 0x04, 0x00, 0x00, 0x0b, 0x05, 0x00, 0x00, 0x1c, 0x05, 0x00, 0x00,
+  0x2a, 0x05, 0x00, 0x00, 0x39, 0x05, 0x00, 0x00, 0x4e, 0x05, 0x00, 0x00, 0x60, 0x05, 0x00, 0x00,
+  0x6f, 0x05, 0x00, 0x00, 0x7d, 0x05, 0x00, 0x00, 0x93, 0x05, 0x00, 0x00, 0xa8, 0x05, 0x00, 0x00,
+  0xb7, 0x05, 0x00, 0x00, 0xc7, 0x05, 0x00, 0x00, 0xd7, 0x05, 0x00, 0x00, 0xe6, 0x05, 0x00, 0x00,
+  0xf6, 0x05, 0x00, 0x00, 0x08, 0x06, 0x00, 0x00, 0x1e, 0x06, 0x00, 0x00, 0x31, 0x06, 0x00, 0x00,
+  0x43, 0x06, 0x00, 0x00, 0x53, 0x06, 0x00, 0x00, 0x62, 0x06, 0x00, 0x00, 0x72, 0x06, 0x00, 0x00,
+  0x87, 0x06, 0x00, 0x00, 0x96, 0x06, 0x00, 0x00, 0xab, 0x06, 0x00, 0x00, 0xba, 0x06, 0x00, 0x00,
+  0xca, 0x06, 0x00, 0x00, 0xdb, 0x06, 0x00, 0x00, 0xec, 0x06, 0x00, 0x00, 0xfd, 0x06, 0x00, 0x00,
+  0x11, 0x07, 0x00, 0x00, 0x25, 0x07, 0x00, 0x00, 0x37, 0x07, 0x00, 0x00, 0x49, 0x07, 0x00, 0x00,
+  0x5b, 0x07, 0x00, 0x00, 0x6e, 0x07, 0x00, 0x00, 0x7e, 0x07, 0x00, 0x00, 0x91, 0x07, 0x00, 0x00,
+  0xa3, 0x07, 0x00, 0x00, 0xb5, 0x07, 0x00, 0x00, 0xc4, 0x07, 0x00, 0x00, 0xd4, 0x07, 0x00, 0x00,
+  0xe3, 0x07, 0x00, 0x00, 0xf6, 0x07, 0x00, 0x00, 0x13, 0x08, 0x00, 0x00, 0x28, 0x08, 0x00, 0x00,
+  0x40, 0x08, 0x00, 0x00, 0x5b, 0x08, 0x00, 0x00, 0x75, 0x08, 0x00, 0x00, 0x8b, 0x08, 0x00, 0x00,
+  0xa5, 0x08, 0x00, 0x00, 0xbd, 0x08, 0x00, 0x00, 0xcc, 0x08, 0x00, 0x00, 0xdc, 0x08, 0x00, 0x00,
+  0xec, 0x08, 0x00, 0x00, 0xfb, 0x08, 0x00, 0x00, 0x17, 0x09, 0x00, 0x00, 0x33, 0x09, 0x00, 0x00,
+  0x46, 0x09, 0x00, 0x00, 0x55, 0x09, 0x00, 0x00, 0x62, 0x09, 0x00, 0x00, 0x76, 0x09, 0x00, 0x00,
+  0x85, 0x09, 0x00, 0x00, 0x95, 0x09, 0x00, 0x00, 0xa4, 0x09, 0x00, 0x00, 0xb4, 0x09, 0x00, 0x00,
+  0xc7, 0x09, 0x00, 0x00, 0xd9, 0x09, 0x00, 0x00, 0xea, 0x09, 0x00, 0x00, 0xfc, 0x09, 0x00, 0x00,
+  0x0b, 0x0a, 0x00, 0x00, 0x1e, 0x0a, 0x00, 0x00, 0x32, 0x0a, 0x00, 0x00, 0x43, 0x0a, 0x00, 0x00,
+  0x53, 0x0a, 0x00, 0x00, 0x65, 0x0a, 0x00, 0x00, 0x78, 0x0a, 0x00, 0x00, 0x8b, 0x0a, 0x00, 0x00,
+  0x9a, 0x0a, 0x00, 0x00, 0xab, 0x0a, 0x00, 0x00, 0xb8, 0x0a, 0x00, 0x00, 0xc8, 0x0a, 0x00, 0x00,
+  0xe4, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x1f, 0x0b, 0x00, 0x00, 0x2c, 0x0b, 0x00, 0x00,
+  0x3c, 0x0b, 0x00, 0x00, 0x4b, 0x0b, 0x00, 0x00, 0x5e, 0x0b, 0x00, 0x00, 0x6e, 0x0b, 0x00, 0x00,
+  0x85, 0x0b, 0x00, 0x00, 0x9b, 0x0b, 0x00, 0x00, 0xaf, 0x0b, 0x00, 0x00, 0xc3, 0x0b, 0x00, 0x00,
+  0xd8, 0x0b, 0x00, 0x00, 0xed, 0x0b, 0x00, 0x00, 0xfc, 0x0b, 0x00, 0x00, 0x0b, 0x0c, 0x00, 0x00,
+  0x1c, 0x0c, 0x00, 0x00, 0x2f, 0x0c, 0x00, 0x00, 0x40, 0x0c, 0x00, 0x00, 0x51, 0x0c, 0x00, 0x00,
+  0x67, 0x0c, 0x00, 0x00, 0x79, 0x0c, 0x00, 0x00, 0x8e, 0x0c, 0x00, 0x00, 0x9c, 0x0c, 0x00, 0x00,
+  0xb2, 0x0c, 0x00, 0x00, 0xc3, 0x0c, 0x00, 0x00, 0xd4, 0x0c, 0x00, 0x00, 0xe5, 0x0c, 0x00, 0x00,
+  0xf7, 0x0c, 0x00, 0x00, 0x0a, 0x0d, 0x00, 0x00, 0x20, 0x0d, 0x00, 0x00, 0x34, 0x0d, 0x00, 0x00,
+  0x42, 0x0d, 0x00, 0x00, 0x52, 0x0d, 0x00, 0x00, 0x62, 0x0d, 0x00, 0x00, 0x72, 0x0d, 0x00, 0x00,
+  0x84, 0x0d, 0x00, 0x00, 0x97, 0x0d, 0x00, 0x00, 0xa8, 0x0d, 0x00, 0x00, 0xb8, 0x0d, 0x00, 0x00,
+  0xc9, 0x0d, 0x00, 0x00, 0xda, 0x0d, 0x00, 0x00, 0xf4, 0x0d, 0x00, 0x00, 0x09, 0x0e, 0x00, 0x00,
+  0x1b, 0x0e, 0x00, 0x00, 0x2e, 0x0e, 0x00, 0x00, 0x40, 0x0e, 0x00, 0x00, 0x53, 0x0e, 0x00, 0x00,
+  0x64, 0x0e, 0x00, 0x00, 0x75, 0x0e, 0x00, 0x00, 0x87, 0x0e, 0x00, 0x00, 0x9b, 0x0e, 0x00, 0x00,
+  0xa5, 0x0e, 0x00, 0x00, 0xb1, 0x0e, 0x00, 0x00, 0xbc, 0x0e, 0x00, 0x00, 0xc8, 0x0e, 0x00, 0x00,
+  0xd3, 0x0e, 0x00, 0x00, 0xdf, 0x0e, 0x00, 0x00, 0xed, 0x0e, 0x00, 0x00, 0xf9, 0x0e, 0x00, 0x00,
+  0x06, 0x0f, 0x00, 0x00, 0x13, 0x0f, 0x00, 0x00, 0x1d, 0x0f, 0x00, 0x00, 0x2a, 0x0f, 0x00, 0x00,
+  0x37, 0x0f, 0x00, 0x00, 0x43, 0x0f, 0x00, 0x00, 0x50, 0x0f, 0x00, 0x00, 0x5c, 0x0f, 0x00, 0x00,
+  0x67, 0x0f, 0x00, 0x00, 0x74, 0x0f, 0x00, 0x00, 0x82, 0x0f, 0x00, 0x00, 0x8d, 0x0f, 0x00, 0x00,
+  0x97, 0x0f, 0x00, 0x00, 0xa2, 0x0f, 0x00, 0x00, 0xb0, 0x0f, 0x00, 0x00, 0xbf, 0x0f, 0x00, 0x00,
+  0xc9, 0x0f, 0x00, 0x00, 0xd5, 0x0f, 0x00, 0x00, 0xe6, 0x0f, 0x00, 0x00, 0xf5, 0x0f, 0x00, 0x00,
+  0xff, 0x0f, 0x00, 0x00, 0x0c, 0x10, 0x00, 0x00, 0x19, 0x10, 0x00, 0x00, 0x27, 0x10, 0x00, 0x00,
+  0x36, 0x10, 0x00, 0x00, 0x41, 0x10, 0x00, 0x00, 0x50, 0x10, 0x00, 0x00, 0x5d, 0x10, 0x00, 0x00,
+  0x6c, 0x10, 0x00, 0x00, 0x7a, 0x10, 0x00, 0x00, 0x87, 0x10, 0x00, 0x00, 0x98, 0x10, 0x00, 0x00,
+  0xaa, 0x10, 0x00, 0x00, 0xb7, 0x10, 0x00, 0x00, 0xc3, 0x10, 0x00, 0x00, 0xce, 0x10, 0x00, 0x00,
+  0xdb, 0x10, 0x00, 0x00, 0xe9, 0x10, 0x00, 0x00, 0xf5, 0x10, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00,
+  0x0e, 0x11, 0x00, 0x00, 0x20, 0x11, 0x00, 0x00, 0x31, 0x11, 0x00, 0x00, 0x3b, 0x11, 0x00, 0x00,
+  0x45, 0x11, 0x00, 0x00, 0x55, 0x11, 0x00, 0x00, 0x64, 0x11, 0x00, 0x00, 0x73, 0x11, 0x00, 0x00,
+  0x7e, 0x11, 0x00, 0x00, 0x8c, 0x11, 0x00, 0x00, 0x9b, 0x11, 0x00, 0x00, 0xa7, 0x11, 0x00, 0x00,
+  0xb5, 0x11, 0x00, 0x00, 0xc4, 0x11, 0x00, 0x00, 0xcf, 0x11, 0x00, 0x00, 0xdd, 0x11, 0x00, 0x00,
+  0xec, 0x11, 0x00, 0x00, 0xff, 0x11, 0x00, 0x00, 0x0b, 0x12, 0x00, 0x00, 0x19, 0x12, 0x00, 0x00,
+  0x26, 0x12, 0x00, 0x00, 0x32, 0x12, 0x00, 0x00, 0x3f, 0x12, 0x00, 0x00, 0x4a, 0x12, 0x00, 0x00,
+  0x55, 0x12, 0x00, 0x00, 0x66, 0x12, 0x00, 0x00, 0x72, 0x12, 0x00, 0x00, 0x80, 0x12, 0x00, 0x00,
+  0x8f, 0x12, 0x00, 0x00, 0xa0, 0x12, 0x00, 0x00, 0xad, 0x12, 0x00, 0x00, 0xb9, 0x12, 0x00, 0x00,
+  0xcc, 0x12, 0x00, 0x00, 0xd9, 0x12, 0x00, 0x00, 0xe9, 0x12, 0x00, 0x00, 0xfa, 0x12, 0x00, 0x00,
+  0x0a, 0x13, 0x00, 0x00, 0x1e, 0x13, 0x00, 0x00, 0x2d, 0x13, 0x00, 0x00, 0x3e, 0x13, 0x00, 0x00,
+  0x51, 0x13, 0x00, 0x00, 0x68, 0x13, 0x00, 0x00, 0x7b, 0x13, 0x00, 0x00, 0x8c, 0x13, 0x00, 0x00,
+  0x9f, 0x13, 0x00, 0x00, 0xb2, 0x13, 0x00, 0x00, 0xc8, 0x13, 0x00, 0x00, 0xd9, 0x13, 0x00, 0x00,
+  0xe9, 0x13, 0x00, 0x00, 0xfa, 0x13, 0x00, 0x00, 0x0d, 0x14, 0x00, 0x00, 0x21, 0x14, 0x00, 0x00,
+  0x35, 0x14, 0x00, 0x00, 0x45, 0x14, 0x00, 0x00, 0x56, 0x14, 0x00, 0x00, 0x67, 0x14, 0x00, 0x00,
+  0x76, 0x14, 0x00, 0x00, 0x87, 0x14, 0x00, 0x00, 0x95, 0x14, 0x00, 0x00, 0xa5, 0x14, 0x00, 0x00,
+  0xb3, 0x14, 0x00, 0x00, 0xc5, 0x14, 0x00, 0x00, 0xd5, 0x14, 0x00, 0x00, 0xe6, 0x14, 0x00, 0x00,
+  0xf6, 0x14, 0x00, 0x00, 0x06, 0x15, 0x00, 0x00, 0x16, 0x15, 0x00, 0x00, 0x28, 0x15, 0x00, 0x00,
+  0x36, 0x15, 0x00, 0x00, 0x47, 0x15, 0x00, 0x00, 0x57, 0x15, 0x00, 0x00, 0x67, 0x15, 0x00, 0x00,
+  0x7a, 0x15, 0x00, 0x00, 0x8a, 0x15, 0x00, 0x00, 0x98, 0x15, 0x00, 0x00, 0xab, 0x15, 0x00, 0x00,
+  0xb8, 0x15, 0x00, 0x00, 0xc4, 0x15, 0x00, 0x00, 0xd2, 0x15, 0x00, 0x00, 0xe3, 0x15, 0x00, 0x00,
+  0xf1, 0x15, 0x00, 0x00, 0x03, 0x16, 0x00, 0x00, 0x11, 0x16, 0x00, 0x00, 0x1e, 0x16, 0x00, 0x00,
+  0x2f, 0x16, 0x00, 0x00, 0x3c, 0x16, 0x00, 0x00, 0x4a, 0x16, 0x00, 0x00, 0x58, 0x16, 0x00, 0x00,
+  0x64, 0x16, 0x00, 0x00, 0x71, 0x16, 0x00, 0x00, 0x82, 0x16, 0x00, 0x00, 0x90, 0x16, 0x00, 0x00,
+  0x9c, 0x16, 0x00, 0x00, 0xa8, 0x16, 0x00, 0x00, 0xb6, 0x16, 0x00, 0x00, 0xc8, 0x16, 0x00, 0x00,
+  0xd8, 0x16, 0x00, 0x00, 0xe7, 0x16, 0x00, 0x00, 0xf9, 0x16, 0x00, 0x00, 0x07, 0x17, 0x00, 0x00,
+  0x14, 0x17, 0x00, 0x00, 0x25, 0x17, 0x00, 0x00, 0x34, 0x17, 0x00, 0x00, 0x42, 0x17, 0x00, 0x00,
+  0x53, 0x17, 0x00, 0x00, 0x60, 0x17, 0x00, 0x00, 0x6f, 0x17, 0x00, 0x00, 0x7d, 0x17, 0x00, 0x00,
+  0x8c, 0x17, 0x00, 0x00, 0x9d, 0x17, 0x00, 0x00, 0xab, 0x17, 0x00, 0x00, 0xb9, 0x17, 0x00, 0x00,
+  0xc7, 0x17, 0x00, 0x00, 0xdb, 0x17, 0x00, 0x00, 0xe9, 0x17, 0x00, 0x00, 0xfa, 0x17, 0x00, 0x00,
+  0x07, 0x18, 0x00, 0x00, 0x15, 0x18, 0x00, 0x00, 0x26, 0x18, 0x00, 0x00, 0x32, 0x18, 0x00, 0x00,
+  0x42, 0x18, 0x00, 0x00, 0x53, 0x18, 0x00, 0x00, 0x62, 0x18, 0x00, 0x00, 0x71, 0x18, 0x00, 0x00,
+  0x7e, 0x18, 0x00, 0x00, 0x8f, 0x18, 0x00, 0x00, 0xa4, 0x18, 0x00, 0x00, 0xb4, 0x18, 0x00, 0x00,
+  0xc2, 0x18, 0x00, 0x00, 0xd1, 0x18, 0x00, 0x00, 0xdf, 0x18, 0x00, 0x00, 0xef, 0x18, 0x00, 0x00,
+  0xfc, 0x18, 0x00, 0x00, 0x0d, 0x19, 0x00, 0x00, 0x1f, 0x19, 0x00, 0x00, 0x2f, 0x19, 0x00, 0x00,
+  0x43, 0x19, 0x00, 0x00, 0x50, 0x19, 0x00, 0x00, 0x61, 0x19, 0x00, 0x00, 0x70, 0x19, 0x00, 0x00,
+  0x83, 0x19, 0x00, 0x00, 0x92, 0x19, 0x00, 0x00, 0xa4, 0x19, 0x00, 0x00, 0xb3, 0x19, 0x00, 0x00,
+  0xc5, 0x19, 0x00, 0x00, 0xd4, 0x19, 0x00, 0x00, 0xe2, 0x19, 0x00, 0x00, 0xef, 0x19, 0x00, 0x00,
+  0xff, 0x19, 0x00, 0x00, 0x0e, 0x1a, 0x00, 0x00, 0x20, 0x1a, 0x00, 0x00, 0x2e, 0x1a, 0x00, 0x00,
+  0x3f, 0x1a, 0x00, 0x00, 0x4f, 0x1a, 0x00, 0x00, 0x64, 0x1a, 0x00, 0x00, 0x76, 0x1a, 0x00, 0x00,
+  0x85, 0x1a, 0x00, 0x00, 0x94, 0x1a, 0x00, 0x00, 0xa3, 0x1a, 0x00, 0x00, 0xb5, 0x1a, 0x00, 0x00,
+  0xc2, 0x1a, 0x00, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x62, 0x69, 0x64, 0x6a,
+  0x61, 0x6e, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x63, 0x63, 0x72, 0x61, 0x00,
+  0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x64, 0x64, 0x69, 0x73, 0x5f, 0x41, 0x62, 0x61,
+  0x62, 0x61, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x6c, 0x67, 0x69, 0x65, 0x72,
+  0x73, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x73, 0x6d, 0x61, 0x72, 0x61, 0x00,
+  0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x42, 0x61, 0x6d, 0x61, 0x6b, 0x6f, 0x00, 0x41, 0x66,
+  0x72, 0x69, 0x63, 0x61, 0x2f, 0x42, 0x61, 0x6e, 0x67, 0x75, 0x69, 0x00, 0x41, 0x66, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x42, 0x61, 0x6e, 0x6a, 0x75, 0x6c, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x42, 0x69, 0x73, 0x73, 0x61, 0x75, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x42,
+  0x6c, 0x61, 0x6e, 0x74, 0x79, 0x72, 0x65, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x42,
+  0x72, 0x61, 0x7a, 0x7a, 0x61, 0x76, 0x69, 0x6c, 0x6c, 0x65, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x42, 0x75, 0x6a, 0x75, 0x6d, 0x62, 0x75, 0x72, 0x61, 0x00, 0x41, 0x66, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x43, 0x61, 0x69, 0x72, 0x6f, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x43, 0x61, 0x73, 0x61, 0x62, 0x6c, 0x61, 0x6e, 0x63, 0x61, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x43, 0x65, 0x75, 0x74, 0x61, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43,
+  0x6f, 0x6e, 0x61, 0x6b, 0x72, 0x79, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x44, 0x61,
+  0x6b, 0x61, 0x72, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x44, 0x61, 0x72, 0x5f, 0x65,
+  0x73, 0x5f, 0x53, 0x61, 0x6c, 0x61, 0x61, 0x6d, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x44, 0x6a, 0x69, 0x62, 0x6f, 0x75, 0x74, 0x69, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x44, 0x6f, 0x75, 0x61, 0x6c, 0x61, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x45, 0x6c,
+  0x5f, 0x41, 0x61, 0x69, 0x75, 0x6e, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x46, 0x72,
+  0x65, 0x65, 0x74, 0x6f, 0x77, 0x6e, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x47, 0x61,
+  0x62, 0x6f, 0x72, 0x6f, 0x6e, 0x65, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x48, 0x61,
+  0x72, 0x61, 0x72, 0x65, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4a, 0x6f, 0x68, 0x61,
+  0x6e, 0x6e, 0x65, 0x73, 0x62, 0x75, 0x72, 0x67, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x4a, 0x75, 0x62, 0x61, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4b, 0x61, 0x6d, 0x70,
+  0x61, 0x6c, 0x61, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4b, 0x68, 0x61, 0x72, 0x74,
+  0x6f, 0x75, 0x6d, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4b, 0x69, 0x67, 0x61, 0x6c,
+  0x69, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4b, 0x69, 0x6e, 0x73, 0x68, 0x61, 0x73,
+  0x61, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4c, 0x61, 0x67, 0x6f, 0x73, 0x00, 0x41,
+  0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4c, 0x69, 0x62, 0x72, 0x65, 0x76, 0x69, 0x6c, 0x6c, 0x65,
+  0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4c, 0x6f, 0x6d, 0x65, 0x00, 0x41, 0x66, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x4c, 0x75, 0x61, 0x6e, 0x64, 0x61, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x4c, 0x75, 0x62, 0x75, 0x6d, 0x62, 0x61, 0x73, 0x68, 0x69, 0x00, 0x41, 0x66, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x4c, 0x75, 0x73, 0x61, 0x6b, 0x61, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x4d, 0x61, 0x6c, 0x61, 0x62, 0x6f, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x4d, 0x61, 0x70, 0x75, 0x74, 0x6f, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x61,
+  0x73, 0x65, 0x72, 0x75, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x62, 0x61, 0x62,
+  0x61, 0x6e, 0x65, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x6f, 0x67, 0x61, 0x64,
+  0x69, 0x73, 0x68, 0x75, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x6f, 0x6e, 0x72,
+  0x6f, 0x76, 0x69, 0x61, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4e, 0x61, 0x69, 0x72,
+  0x6f, 0x62, 0x69, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4e, 0x64, 0x6a, 0x61, 0x6d,
+  0x65, 0x6e, 0x61, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4e, 0x69, 0x61, 0x6d, 0x65,
+  0x79, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4e, 0x6f, 0x75, 0x61, 0x6b, 0x63, 0x68,
+  0x6f, 0x74, 0x74, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4f, 0x75, 0x61, 0x67, 0x61,
+  0x64, 0x6f, 0x75, 0x67, 0x6f, 0x75, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x50, 0x6f,
+  0x72, 0x74, 0x6f, 0x2d, 0x4e, 0x6f, 0x76, 0x6f, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x53, 0x61, 0x6f, 0x5f, 0x54, 0x6f, 0x6d, 0x65, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x54, 0x72, 0x69, 0x70, 0x6f, 0x6c, 0x69, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x54,
+  0x75, 0x6e, 0x69, 0x73, 0x00, 0x41, 0x66, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x57, 0x69, 0x6e, 0x64,
+  0x68, 0x6f, 0x65, 0x6b, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x64, 0x61,
+  0x6b, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x6e, 0x63, 0x68, 0x6f, 0x72,
+  0x61, 0x67, 0x65, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x6e, 0x67, 0x75,
+  0x69, 0x6c, 0x6c, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x6e, 0x74,
+  0x69, 0x67, 0x75, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x72, 0x61,
+  0x67, 0x75, 0x61, 0x69, 0x6e, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41,
+  0x72, 0x67, 0x65, 0x6e, 0x74, 0x69, 0x6e, 0x61, 0x2f, 0x42, 0x75, 0x65, 0x6e, 0x6f, 0x73, 0x5f,
+  0x41, 0x69, 0x72, 0x65, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x72,
+  0x67, 0x65, 0x6e, 0x74, 0x69, 0x6e, 0x61, 0x2f, 0x43, 0x61, 0x74, 0x61, 0x6d, 0x61, 0x72, 0x63,
+  0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x72, 0x67, 0x65, 0x6e, 0x74,
+  0x69, 0x6e, 0x61, 0x2f, 0x43, 0x6f, 0x72, 0x64, 0x6f, 0x62, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x41, 0x72, 0x67, 0x65, 0x6e, 0x74, 0x69, 0x6e, 0x61, 0x2f, 0x4a, 0x75,
+  0x6a, 0x75, 0x79, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x72, 0x67, 0x65,
+  0x6e, 0x74, 0x69, 0x6e, 0x61, 0x2f, 0x4c, 0x61, 0x5f, 0x52, 0x69, 0x6f, 0x6a, 0x61, 0x00, 0x41,
+  0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x72, 0x67, 0x65, 0x6e, 0x74, 0x69, 0x6e, 0x61,
+  0x2f, 0x4d, 0x65, 0x6e, 0x64, 0x6f, 0x7a, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x41, 0x72, 0x67, 0x65, 0x6e, 0x74, 0x69, 0x6e, 0x61, 0x2f, 0x52, 0x69, 0x6f, 0x5f, 0x47,
+  0x61, 0x6c, 0x6c, 0x65, 0x67, 0x6f, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x41, 0x72, 0x67, 0x65, 0x6e, 0x74, 0x69, 0x6e, 0x61, 0x2f, 0x53, 0x61, 0x6c, 0x74, 0x61, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x72, 0x67, 0x65, 0x6e, 0x74, 0x69, 0x6e,
+  0x61, 0x2f, 0x53, 0x61, 0x6e, 0x5f, 0x4a, 0x75, 0x61, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x41, 0x72, 0x67, 0x65, 0x6e, 0x74, 0x69, 0x6e, 0x61, 0x2f, 0x53, 0x61, 0x6e,
+  0x5f, 0x4c, 0x75, 0x69, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x72,
+  0x67, 0x65, 0x6e, 0x74, 0x69, 0x6e, 0x61, 0x2f, 0x54, 0x75, 0x63, 0x75, 0x6d, 0x61, 0x6e, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x41, 0x72, 0x67, 0x65, 0x6e, 0x74, 0x69, 0x6e,
+  0x61, 0x2f, 0x55, 0x73, 0x68, 0x75, 0x61, 0x69, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x41, 0x72, 0x75, 0x62, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x41, 0x73, 0x75, 0x6e, 0x63, 0x69, 0x6f, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x41, 0x74, 0x69, 0x6b, 0x6f, 0x6b, 0x61, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x42, 0x61, 0x68, 0x69, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x42, 0x61, 0x68, 0x69, 0x61, 0x5f, 0x42, 0x61, 0x6e, 0x64, 0x65, 0x72, 0x61, 0x73, 0x00, 0x41,
+  0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x42, 0x61, 0x72, 0x62, 0x61, 0x64, 0x6f, 0x73, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x42, 0x65, 0x6c, 0x65, 0x6d, 0x00, 0x41, 0x6d,
+  0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x42, 0x65, 0x6c, 0x69, 0x7a, 0x65, 0x00, 0x41, 0x6d, 0x65,
+  0x72, 0x69, 0x63, 0x61, 0x2f, 0x42, 0x6c, 0x61, 0x6e, 0x63, 0x2d, 0x53, 0x61, 0x62, 0x6c, 0x6f,
+  0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x42, 0x6f, 0x61, 0x5f, 0x56, 0x69,
+  0x73, 0x74, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x42, 0x6f, 0x67, 0x6f,
+  0x74, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x42, 0x6f, 0x69, 0x73, 0x65,
+  0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43, 0x61, 0x6d, 0x62, 0x72, 0x69, 0x64,
+  0x67, 0x65, 0x5f, 0x42, 0x61, 0x79, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43,
+  0x61, 0x6d, 0x70, 0x6f, 0x5f, 0x47, 0x72, 0x61, 0x6e, 0x64, 0x65, 0x00, 0x41, 0x6d, 0x65, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x43, 0x61, 0x6e, 0x63, 0x75, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x43, 0x61, 0x72, 0x61, 0x63, 0x61, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x43, 0x61, 0x79, 0x65, 0x6e, 0x6e, 0x65, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x43, 0x61, 0x79, 0x6d, 0x61, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x43, 0x68, 0x69, 0x63, 0x61, 0x67, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x43, 0x68, 0x69, 0x68, 0x75, 0x61, 0x68, 0x75, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x43, 0x69, 0x75, 0x64, 0x61, 0x64, 0x5f, 0x4a, 0x75, 0x61, 0x72, 0x65,
+  0x7a, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43, 0x6f, 0x73, 0x74, 0x61, 0x5f,
+  0x52, 0x69, 0x63, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43, 0x6f, 0x79,
+  0x68, 0x61, 0x69, 0x71, 0x75, 0x65, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43,
+  0x72, 0x65, 0x73, 0x74, 0x6f, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43,
+  0x75, 0x69, 0x61, 0x62, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x43, 0x75,
+  0x72, 0x61, 0x63, 0x61, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x44, 0x61,
+  0x6e, 0x6d, 0x61, 0x72, 0x6b, 0x73, 0x68, 0x61, 0x76, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x44, 0x61, 0x77, 0x73, 0x6f, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x44, 0x61, 0x77, 0x73, 0x6f, 0x6e, 0x5f, 0x43, 0x72, 0x65, 0x65, 0x6b, 0x00, 0x41,
+  0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x44, 0x65, 0x6e, 0x76, 0x65, 0x72, 0x00, 0x41, 0x6d,
+  0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x44, 0x65, 0x74, 0x72, 0x6f, 0x69, 0x74, 0x00, 0x41, 0x6d,
+  0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x44, 0x6f, 0x6d, 0x69, 0x6e, 0x69, 0x63, 0x61, 0x00, 0x41,
+  0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x45, 0x64, 0x6d, 0x6f, 0x6e, 0x74, 0x6f, 0x6e, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x45, 0x69, 0x72, 0x75, 0x6e, 0x65, 0x70, 0x65,
+  0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x45, 0x6c, 0x5f, 0x53, 0x61, 0x6c, 0x76,
+  0x61, 0x64, 0x6f, 0x72, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x46, 0x6f, 0x72,
+  0x74, 0x5f, 0x4e, 0x65, 0x6c, 0x73, 0x6f, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x46, 0x6f, 0x72, 0x74, 0x61, 0x6c, 0x65, 0x7a, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x47, 0x6c, 0x61, 0x63, 0x65, 0x5f, 0x42, 0x61, 0x79, 0x00, 0x41, 0x6d, 0x65,
+  0x72, 0x69, 0x63, 0x61, 0x2f, 0x47, 0x6f, 0x6f, 0x73, 0x65, 0x5f, 0x42, 0x61, 0x79, 0x00, 0x41,
+  0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x47, 0x72, 0x61, 0x6e, 0x64, 0x5f, 0x54, 0x75, 0x72,
+  0x6b, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x47, 0x72, 0x65, 0x6e, 0x61, 0x64,
+  0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x47, 0x75, 0x61, 0x64, 0x65, 0x6c,
+  0x6f, 0x75, 0x70, 0x65, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x47, 0x75, 0x61,
+  0x74, 0x65, 0x6d, 0x61, 0x6c, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x47,
+  0x75, 0x61, 0x79, 0x61, 0x71, 0x75, 0x69, 0x6c, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x47, 0x75, 0x79, 0x61, 0x6e, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x48, 0x61, 0x6c, 0x69, 0x66, 0x61, 0x78, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x48, 0x61, 0x76, 0x61, 0x6e, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x48,
+  0x65, 0x72, 0x6d, 0x6f, 0x73, 0x69, 0x6c, 0x6c, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x61, 0x2f, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e,
+  0x61, 0x70, 0x6f, 0x6c, 0x69, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x49,
+  0x6e, 0x64, 0x69, 0x61, 0x6e, 0x61, 0x2f, 0x4b, 0x6e, 0x6f, 0x78, 0x00, 0x41, 0x6d, 0x65, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x61, 0x2f, 0x4d, 0x61, 0x72, 0x65,
+  0x6e, 0x67, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x49, 0x6e, 0x64, 0x69,
+  0x61, 0x6e, 0x61, 0x2f, 0x50, 0x65, 0x74, 0x65, 0x72, 0x73, 0x62, 0x75, 0x72, 0x67, 0x00, 0x41,
+  0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x61, 0x2f, 0x54,
+  0x65, 0x6c, 0x6c, 0x5f, 0x43, 0x69, 0x74, 0x79, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x61, 0x2f, 0x56, 0x65, 0x76, 0x61, 0x79, 0x00, 0x41,
+  0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x61, 0x2f, 0x56,
+  0x69, 0x6e, 0x63, 0x65, 0x6e, 0x6e, 0x65, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x61, 0x2f, 0x57, 0x69, 0x6e, 0x61, 0x6d, 0x61, 0x63,
+  0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x49, 0x6e, 0x75, 0x76, 0x69, 0x6b, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x49, 0x71, 0x61, 0x6c, 0x75, 0x69, 0x74, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4a, 0x61, 0x6d, 0x61, 0x69, 0x63, 0x61, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4a, 0x75, 0x6e, 0x65, 0x61, 0x75, 0x00, 0x41,
+  0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4b, 0x65, 0x6e, 0x74, 0x75, 0x63, 0x6b, 0x79, 0x2f,
+  0x4c, 0x6f, 0x75, 0x69, 0x73, 0x76, 0x69, 0x6c, 0x6c, 0x65, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x4b, 0x65, 0x6e, 0x74, 0x75, 0x63, 0x6b, 0x79, 0x2f, 0x4d, 0x6f, 0x6e, 0x74,
+  0x69, 0x63, 0x65, 0x6c, 0x6c, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4b,
+  0x72, 0x61, 0x6c, 0x65, 0x6e, 0x64, 0x69, 0x6a, 0x6b, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x4c, 0x61, 0x5f, 0x50, 0x61, 0x7a, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x4c, 0x69, 0x6d, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4c, 0x6f,
+  0x73, 0x5f, 0x41, 0x6e, 0x67, 0x65, 0x6c, 0x65, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63,
+  0x61, 0x2f, 0x4d, 0x61, 0x63, 0x65, 0x69, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x4d, 0x61, 0x6e, 0x61, 0x67, 0x75, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x4d, 0x61, 0x6e, 0x61, 0x75, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x4d, 0x61, 0x72, 0x69, 0x67, 0x6f, 0x74, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x4d, 0x61, 0x72, 0x74, 0x69, 0x6e, 0x69, 0x71, 0x75, 0x65, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x4d, 0x61, 0x74, 0x61, 0x6d, 0x6f, 0x72, 0x6f, 0x73, 0x00, 0x41, 0x6d, 0x65,
+  0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x61, 0x7a, 0x61, 0x74, 0x6c, 0x61, 0x6e, 0x00, 0x41, 0x6d,
+  0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x65, 0x6e, 0x6f, 0x6d, 0x69, 0x6e, 0x65, 0x65, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x65, 0x72, 0x69, 0x64, 0x61, 0x00, 0x41,
+  0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x65, 0x74, 0x6c, 0x61, 0x6b, 0x61, 0x74, 0x6c,
+  0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x65, 0x78, 0x69, 0x63, 0x6f,
+  0x5f, 0x43, 0x69, 0x74, 0x79, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x69,
+  0x71, 0x75, 0x65, 0x6c, 0x6f, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d,
+  0x6f, 0x6e, 0x63, 0x74, 0x6f, 0x6e, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4d,
+  0x6f, 0x6e, 0x74, 0x65, 0x72, 0x72, 0x65, 0x79, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x4d, 0x6f, 0x6e, 0x74, 0x65, 0x76, 0x69, 0x64, 0x65, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x4d, 0x6f, 0x6e, 0x74, 0x73, 0x65, 0x72, 0x72, 0x61, 0x74, 0x00, 0x41,
+  0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4e, 0x61, 0x73, 0x73, 0x61, 0x75, 0x00, 0x41, 0x6d,
+  0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4e, 0x65, 0x77, 0x5f, 0x59, 0x6f, 0x72, 0x6b, 0x00, 0x41,
+  0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4e, 0x6f, 0x6d, 0x65, 0x00, 0x41, 0x6d, 0x65, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x4e, 0x6f, 0x72, 0x6f, 0x6e, 0x68, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x4e, 0x6f, 0x72, 0x74, 0x68, 0x5f, 0x44, 0x61, 0x6b, 0x6f, 0x74, 0x61,
+  0x2f, 0x42, 0x65, 0x75, 0x6c, 0x61, 0x68, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x4e, 0x6f, 0x72, 0x74, 0x68, 0x5f, 0x44, 0x61, 0x6b, 0x6f, 0x74, 0x61, 0x2f, 0x43, 0x65, 0x6e,
+  0x74, 0x65, 0x72, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4e, 0x6f, 0x72, 0x74,
+  0x68, 0x5f, 0x44, 0x61, 0x6b, 0x6f, 0x74, 0x61, 0x2f, 0x4e, 0x65, 0x77, 0x5f, 0x53, 0x61, 0x6c,
+  0x65, 0x6d, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4e, 0x75, 0x75, 0x6b, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x4f, 0x6a, 0x69, 0x6e, 0x61, 0x67, 0x61, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x50, 0x61, 0x6e, 0x61, 0x6d, 0x61, 0x00, 0x41,
+  0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x61, 0x72, 0x69, 0x62,
+  0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x50, 0x68, 0x6f, 0x65, 0x6e, 0x69,
+  0x78, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x50, 0x6f, 0x72, 0x74, 0x2d, 0x61,
+  0x75, 0x2d, 0x50, 0x72, 0x69, 0x6e, 0x63, 0x65, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x50, 0x6f, 0x72, 0x74, 0x5f, 0x6f, 0x66, 0x5f, 0x53, 0x70, 0x61, 0x69, 0x6e, 0x00, 0x41,
+  0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x50, 0x6f, 0x72, 0x74, 0x6f, 0x5f, 0x56, 0x65, 0x6c,
+  0x68, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x50, 0x75, 0x65, 0x72, 0x74,
+  0x6f, 0x5f, 0x52, 0x69, 0x63, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x50,
+  0x75, 0x6e, 0x74, 0x61, 0x5f, 0x41, 0x72, 0x65, 0x6e, 0x61, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x52, 0x61, 0x6e, 0x6b, 0x69, 0x6e, 0x5f, 0x49, 0x6e, 0x6c, 0x65, 0x74,
+  0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x52, 0x65, 0x63, 0x69, 0x66, 0x65, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x52, 0x65, 0x67, 0x69, 0x6e, 0x61, 0x00, 0x41,
+  0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x52, 0x69, 0x6f, 0x5f, 0x42, 0x72, 0x61, 0x6e,
+  0x63, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x53, 0x61, 0x6e, 0x74, 0x61,
+  0x72, 0x65, 0x6d, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x53, 0x61, 0x6e, 0x74,
+  0x69, 0x61, 0x67, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x53, 0x61, 0x6e,
+  0x74, 0x6f, 0x5f, 0x44, 0x6f, 0x6d, 0x69, 0x6e, 0x67, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x53, 0x61, 0x6f, 0x5f, 0x50, 0x61, 0x75, 0x6c, 0x6f, 0x00, 0x41, 0x6d, 0x65,
+  0x72, 0x69, 0x63, 0x61, 0x2f, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x62, 0x79, 0x73, 0x75, 0x6e,
+  0x64, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x53, 0x69, 0x74, 0x6b, 0x61, 0x00,
+  0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x53, 0x74, 0x5f, 0x42, 0x61, 0x72, 0x74, 0x68,
+  0x65, 0x6c, 0x65, 0x6d, 0x79, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x53, 0x74,
+  0x5f, 0x4a, 0x6f, 0x68, 0x6e, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x53,
+  0x74, 0x5f, 0x4b, 0x69, 0x74, 0x74, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x53, 0x74, 0x5f, 0x4c, 0x75, 0x63, 0x69, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61,
+  0x2f, 0x53, 0x74, 0x5f, 0x54, 0x68, 0x6f, 0x6d, 0x61, 0x73, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x53, 0x74, 0x5f, 0x56, 0x69, 0x6e, 0x63, 0x65, 0x6e, 0x74, 0x00, 0x41, 0x6d,
+  0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x53, 0x77, 0x69, 0x66, 0x74, 0x5f, 0x43, 0x75, 0x72, 0x72,
+  0x65, 0x6e, 0x74, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x54, 0x65, 0x67, 0x75,
+  0x63, 0x69, 0x67, 0x61, 0x6c, 0x70, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x54, 0x68, 0x75, 0x6c, 0x65, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x54, 0x69,
+  0x6a, 0x75, 0x61, 0x6e, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x54, 0x6f,
+  0x72, 0x6f, 0x6e, 0x74, 0x6f, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x54, 0x6f,
+  0x72, 0x74, 0x6f, 0x6c, 0x61, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f, 0x56, 0x61,
+  0x6e, 0x63, 0x6f, 0x75, 0x76, 0x65, 0x72, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x61, 0x2f,
+  0x57, 0x68, 0x69, 0x74, 0x65, 0x68, 0x6f, 0x72, 0x73, 0x65, 0x00, 0x41, 0x6d, 0x65, 0x72, 0x69,
+  0x63, 0x61, 0x2f, 0x57, 0x69, 0x6e, 0x6e, 0x69, 0x70, 0x65, 0x67, 0x00, 0x41, 0x6d, 0x65, 0x72,
+  0x69, 0x63, 0x61, 0x2f, 0x59, 0x61, 0x6b, 0x75, 0x74, 0x61, 0x74, 0x00, 0x41, 0x6e, 0x74, 0x61,
+  0x72, 0x63, 0x74, 0x69, 0x63, 0x61, 0x2f, 0x43, 0x61, 0x73, 0x65, 0x79, 0x00, 0x41, 0x6e, 0x74,
+  0x61, 0x72, 0x63, 0x74, 0x69, 0x63, 0x61, 0x2f, 0x44, 0x61, 0x76, 0x69, 0x73, 0x00, 0x41, 0x6e,
+  0x74, 0x61, 0x72, 0x63, 0x74, 0x69, 0x63, 0x61, 0x2f, 0x44, 0x75, 0x6d, 0x6f, 0x6e, 0x74, 0x44,
+  0x55, 0x72, 0x76, 0x69, 0x6c, 0x6c, 0x65, 0x00, 0x41, 0x6e, 0x74, 0x61, 0x72, 0x63, 0x74, 0x69,
+  0x63, 0x61, 0x2f, 0x4d, 0x61, 0x63, 0x71, 0x75, 0x61, 0x72, 0x69, 0x65, 0x00, 0x41, 0x6e, 0x74,
+  0x61, 0x72, 0x63, 0x74, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x61, 0x77, 0x73, 0x6f, 0x6e, 0x00, 0x41,
+  0x6e, 0x74, 0x61, 0x72, 0x63, 0x74, 0x69, 0x63, 0x61, 0x2f, 0x4d, 0x63, 0x4d, 0x75, 0x72, 0x64,
+  0x6f, 0x00, 0x41, 0x6e, 0x74, 0x61, 0x72, 0x63, 0x74, 0x69, 0x63, 0x61, 0x2f, 0x50, 0x61, 0x6c,
+  0x6d, 0x65, 0x72, 0x00, 0x41, 0x6e, 0x74, 0x61, 0x72, 0x63, 0x74, 0x69, 0x63, 0x61, 0x2f, 0x52,
+  0x6f, 0x74, 0x68, 0x65, 0x72, 0x61, 0x00, 0x41, 0x6e, 0x74, 0x61, 0x72, 0x63, 0x74, 0x69, 0x63,
+  0x61, 0x2f, 0x53, 0x79, 0x6f, 0x77, 0x61, 0x00, 0x41, 0x6e, 0x74, 0x61, 0x72, 0x63, 0x74, 0x69,
+  0x63, 0x61, 0x2f, 0x54, 0x72, 0x6f, 0x6c, 0x6c, 0x00, 0x41, 0x6e, 0x74, 0x61, 0x72, 0x63, 0x74,
+  0x69, 0x63, 0x61, 0x2f, 0x56, 0x6f, 0x73, 0x74, 0x6f, 0x6b, 0x00, 0x41, 0x72, 0x63, 0x74, 0x69,
+  0x63, 0x2f, 0x4c, 0x6f, 0x6e, 0x67, 0x79, 0x65, 0x61, 0x72, 0x62, 0x79, 0x65, 0x6e, 0x00, 0x41,
+  0x73, 0x69, 0x61, 0x2f, 0x41, 0x64, 0x65, 0x6e, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x41, 0x6c,
+  0x6d, 0x61, 0x74, 0x79, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x41, 0x6d, 0x6d, 0x61, 0x6e, 0x00,
+  0x41, 0x73, 0x69, 0x61, 0x2f, 0x41, 0x6e, 0x61, 0x64, 0x79, 0x72, 0x00, 0x41, 0x73, 0x69, 0x61,
+  0x2f, 0x41, 0x71, 0x74, 0x61, 0x75, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x41, 0x71, 0x74, 0x6f,
+  0x62, 0x65, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x41, 0x73, 0x68, 0x67, 0x61, 0x62, 0x61, 0x74,
+  0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x41, 0x74, 0x79, 0x72, 0x61, 0x75, 0x00, 0x41, 0x73, 0x69,
+  0x61, 0x2f, 0x42, 0x61, 0x67, 0x68, 0x64, 0x61, 0x64, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x42,
+  0x61, 0x68, 0x72, 0x61, 0x69, 0x6e, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x42, 0x61, 0x6b, 0x75,
+  0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x42, 0x61, 0x6e, 0x67, 0x6b, 0x6f, 0x6b, 0x00, 0x41, 0x73,
+  0x69, 0x61, 0x2f, 0x42, 0x61, 0x72, 0x6e, 0x61, 0x75, 0x6c, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f,
+  0x42, 0x65, 0x69, 0x72, 0x75, 0x74, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x42, 0x69, 0x73, 0x68,
+  0x6b, 0x65, 0x6b, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x42, 0x72, 0x75, 0x6e, 0x65, 0x69, 0x00,
+  0x41, 0x73, 0x69, 0x61, 0x2f, 0x43, 0x68, 0x69, 0x74, 0x61, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f,
+  0x43, 0x6f, 0x6c, 0x6f, 0x6d, 0x62, 0x6f, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x44, 0x61, 0x6d,
+  0x61, 0x73, 0x63, 0x75, 0x73, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x44, 0x68, 0x61, 0x6b, 0x61,
+  0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x44, 0x69, 0x6c, 0x69, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f,
+  0x44, 0x75, 0x62, 0x61, 0x69, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x44, 0x75, 0x73, 0x68, 0x61,
+  0x6e, 0x62, 0x65, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x46, 0x61, 0x6d, 0x61, 0x67, 0x75, 0x73,
+  0x74, 0x61, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x47, 0x61, 0x7a, 0x61, 0x00, 0x41, 0x73, 0x69,
+  0x61, 0x2f, 0x48, 0x65, 0x62, 0x72, 0x6f, 0x6e, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x48, 0x6f,
+  0x5f, 0x43, 0x68, 0x69, 0x5f, 0x4d, 0x69, 0x6e, 0x68, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x48,
+  0x6f, 0x6e, 0x67, 0x5f, 0x4b, 0x6f, 0x6e, 0x67, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x48, 0x6f,
+  0x76, 0x64, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x49, 0x72, 0x6b, 0x75, 0x74, 0x73, 0x6b, 0x00,
+  0x41, 0x73, 0x69, 0x61, 0x2f, 0x4a, 0x61, 0x6b, 0x61, 0x72, 0x74, 0x61, 0x00, 0x41, 0x73, 0x69,
+  0x61, 0x2f, 0x4a, 0x61, 0x79, 0x61, 0x70, 0x75, 0x72, 0x61, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f,
+  0x4a, 0x65, 0x72, 0x75, 0x73, 0x61, 0x6c, 0x65, 0x6d, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4b,
+  0x61, 0x62, 0x75, 0x6c, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4b, 0x61, 0x6d, 0x63, 0x68, 0x61,
+  0x74, 0x6b, 0x61, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4b, 0x61, 0x72, 0x61, 0x63, 0x68, 0x69,
+  0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4b, 0x61, 0x74, 0x68, 0x6d, 0x61, 0x6e, 0x64, 0x75, 0x00,
+  0x41, 0x73, 0x69, 0x61, 0x2f, 0x4b, 0x68, 0x61, 0x6e, 0x64, 0x79, 0x67, 0x61, 0x00, 0x41, 0x73,
+  0x69, 0x61, 0x2f, 0x4b, 0x6f, 0x6c, 0x6b, 0x61, 0x74, 0x61, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f,
+  0x4b, 0x72, 0x61, 0x73, 0x6e, 0x6f, 0x79, 0x61, 0x72, 0x73, 0x6b, 0x00, 0x41, 0x73, 0x69, 0x61,
+  0x2f, 0x4b, 0x75, 0x61, 0x6c, 0x61, 0x5f, 0x4c, 0x75, 0x6d, 0x70, 0x75, 0x72, 0x00, 0x41, 0x73,
+  0x69, 0x61, 0x2f, 0x4b, 0x75, 0x63, 0x68, 0x69, 0x6e, 0x67, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f,
+  0x4b, 0x75, 0x77, 0x61, 0x69, 0x74, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4d, 0x61, 0x63, 0x61,
+  0x75, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4d, 0x61, 0x67, 0x61, 0x64, 0x61, 0x6e, 0x00, 0x41,
+  0x73, 0x69, 0x61, 0x2f, 0x4d, 0x61, 0x6b, 0x61, 0x73, 0x73, 0x61, 0x72, 0x00, 0x41, 0x73, 0x69,
+  0x61, 0x2f, 0x4d, 0x61, 0x6e, 0x69, 0x6c, 0x61, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4d, 0x75,
+  0x73, 0x63, 0x61, 0x74, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4e, 0x69, 0x63, 0x6f, 0x73, 0x69,
+  0x61, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4e, 0x6f, 0x76, 0x6f, 0x6b, 0x75, 0x7a, 0x6e, 0x65,
+  0x74, 0x73, 0x6b, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4e, 0x6f, 0x76, 0x6f, 0x73, 0x69, 0x62,
+  0x69, 0x72, 0x73, 0x6b, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x4f, 0x6d, 0x73, 0x6b, 0x00, 0x41,
+  0x73, 0x69, 0x61, 0x2f, 0x4f, 0x72, 0x61, 0x6c, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x50, 0x68,
+  0x6e, 0x6f, 0x6d, 0x5f, 0x50, 0x65, 0x6e, 0x68, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x50, 0x6f,
+  0x6e, 0x74, 0x69, 0x61, 0x6e, 0x61, 0x6b, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x50, 0x79, 0x6f,
+  0x6e, 0x67, 0x79, 0x61, 0x6e, 0x67, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x51, 0x61, 0x74, 0x61,
+  0x72, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x51, 0x6f, 0x73, 0x74, 0x61, 0x6e, 0x61, 0x79, 0x00,
+  0x41, 0x73, 0x69, 0x61, 0x2f, 0x51, 0x79, 0x7a, 0x79, 0x6c, 0x6f, 0x72, 0x64, 0x61, 0x00, 0x41,
+  0x73, 0x69, 0x61, 0x2f, 0x52, 0x69, 0x79, 0x61, 0x64, 0x68, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f,
+  0x53, 0x61, 0x6b, 0x68, 0x61, 0x6c, 0x69, 0x6e, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x53, 0x61,
+  0x6d, 0x61, 0x72, 0x6b, 0x61, 0x6e, 0x64, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x53, 0x65, 0x6f,
+  0x75, 0x6c, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x53, 0x68, 0x61, 0x6e, 0x67, 0x68, 0x61, 0x69,
+  0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x53, 0x69, 0x6e, 0x67, 0x61, 0x70, 0x6f, 0x72, 0x65, 0x00,
+  0x41, 0x73, 0x69, 0x61, 0x2f, 0x53, 0x72, 0x65, 0x64, 0x6e, 0x65, 0x6b, 0x6f, 0x6c, 0x79, 0x6d,
+  0x73, 0x6b, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x54, 0x61, 0x69, 0x70, 0x65, 0x69, 0x00, 0x41,
+  0x73, 0x69, 0x61, 0x2f, 0x54, 0x61, 0x73, 0x68, 0x6b, 0x65, 0x6e, 0x74, 0x00, 0x41, 0x73, 0x69,
+  0x61, 0x2f, 0x54, 0x62, 0x69, 0x6c, 0x69, 0x73, 0x69, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x54,
+  0x65, 0x68, 0x72, 0x61, 0x6e, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x54, 0x68, 0x69, 0x6d, 0x70,
+  0x68, 0x75, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x54, 0x6f, 0x6b, 0x79, 0x6f, 0x00, 0x41, 0x73,
+  0x69, 0x61, 0x2f, 0x54, 0x6f, 0x6d, 0x73, 0x6b, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x55, 0x6c,
+  0x61, 0x61, 0x6e, 0x62, 0x61, 0x61, 0x74, 0x61, 0x72, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x55,
+  0x72, 0x75, 0x6d, 0x71, 0x69, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x55, 0x73, 0x74, 0x2d, 0x4e,
+  0x65, 0x72, 0x61, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x56, 0x69, 0x65, 0x6e, 0x74, 0x69, 0x61,
+  0x6e, 0x65, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x56, 0x6c, 0x61, 0x64, 0x69, 0x76, 0x6f, 0x73,
+  0x74, 0x6f, 0x6b, 0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x59, 0x61, 0x6b, 0x75, 0x74, 0x73, 0x6b,
+  0x00, 0x41, 0x73, 0x69, 0x61, 0x2f, 0x59, 0x61, 0x6e, 0x67, 0x6f, 0x6e, 0x00, 0x41, 0x73, 0x69,
+  0x61, 0x2f, 0x59, 0x65, 0x6b, 0x61, 0x74, 0x65, 0x72, 0x69, 0x6e, 0x62, 0x75, 0x72, 0x67, 0x00,
+  0x41, 0x73, 0x69, 0x61, 0x2f, 0x59, 0x65, 0x72, 0x65, 0x76, 0x61, 0x6e, 0x00, 0x41, 0x74, 0x6c,
+  0x61, 0x6e, 0x74, 0x69, 0x63, 0x2f, 0x41, 0x7a, 0x6f, 0x72, 0x65, 0x73, 0x00, 0x41, 0x74, 0x6c,
+  0x61, 0x6e, 0x74, 0x69, 0x63, 0x2f, 0x42, 0x65, 0x72, 0x6d, 0x75, 0x64, 0x61, 0x00, 0x41, 0x74,
+  0x6c, 0x61, 0x6e, 0x74, 0x69, 0x63, 0x2f, 0x43, 0x61, 0x6e, 0x61, 0x72, 0x79, 0x00, 0x41, 0x74,
+  0x6c, 0x61, 0x6e, 0x74, 0x69, 0x63, 0x2f, 0x43, 0x61, 0x70, 0x65, 0x5f, 0x56, 0x65, 0x72, 0x64,
+  0x65, 0x00, 0x41, 0x74, 0x6c, 0x61, 0x6e, 0x74, 0x69, 0x63, 0x2f, 0x46, 0x61, 0x72, 0x6f, 0x65,
+  0x00, 0x41, 0x74, 0x6c, 0x61, 0x6e, 0x74, 0x69, 0x63, 0x2f, 0x4d, 0x61, 0x64, 0x65, 0x69, 0x72,
+  0x61, 0x00, 0x41, 0x74, 0x6c, 0x61, 0x6e, 0x74, 0x69, 0x63, 0x2f, 0x52, 0x65, 0x79, 0x6b, 0x6a,
+  0x61, 0x76, 0x69, 0x6b, 0x00, 0x41, 0x74, 0x6c, 0x61, 0x6e, 0x74, 0x69, 0x63, 0x2f, 0x53, 0x6f,
+  0x75, 0x74, 0x68, 0x5f, 0x47, 0x65, 0x6f, 0x72, 0x67, 0x69, 0x61, 0x00, 0x41, 0x74, 0x6c, 0x61,
+  0x6e, 0x74, 0x69, 0x63, 0x2f, 0x53, 0x74, 0x5f, 0x48, 0x65, 0x6c, 0x65, 0x6e, 0x61, 0x00, 0x41,
+  0x74, 0x6c, 0x61, 0x6e, 0x74, 0x69, 0x63, 0x2f, 0x53, 0x74, 0x61, 0x6e, 0x6c, 0x65, 0x79, 0x00,
+  0x41, 0x75, 0x73, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x61, 0x2f, 0x41, 0x64, 0x65, 0x6c, 0x61, 0x69,
+  0x64, 0x65, 0x00, 0x41, 0x75, 0x73, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x61, 0x2f, 0x42, 0x72, 0x69,
+  0x73, 0x62, 0x61, 0x6e, 0x65, 0x00, 0x41, 0x75, 0x73, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x61, 0x2f,
+  0x42, 0x72, 0x6f, 0x6b, 0x65, 0x6e, 0x5f, 0x48, 0x69, 0x6c, 0x6c, 0x00, 0x41, 0x75, 0x73, 0x74,
+  0x72, 0x61, 0x6c, 0x69, 0x61, 0x2f, 0x44, 0x61, 0x72, 0x77, 0x69, 0x6e, 0x00, 0x41, 0x75, 0x73,
+  0x74, 0x72, 0x61, 0x6c, 0x69, 0x61, 0x2f, 0x45, 0x75, 0x63, 0x6c, 0x61, 0x00, 0x41, 0x75, 0x73,
+  0x74, 0x72, 0x61, 0x6c, 0x69, 0x61, 0x2f, 0x48, 0x6f, 0x62, 0x61, 0x72, 0x74, 0x00, 0x41, 0x75,
+  0x73, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x61, 0x2f, 0x4c, 0x69, 0x6e, 0x64, 0x65, 0x6d, 0x61, 0x6e,
+  0x00, 0x41, 0x75, 0x73, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x61, 0x2f, 0x4c, 0x6f, 0x72, 0x64, 0x5f,
+  0x48, 0x6f, 0x77, 0x65, 0x00, 0x41, 0x75, 0x73, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x61, 0x2f, 0x4d,
+  0x65, 0x6c, 0x62, 0x6f, 0x75, 0x72, 0x6e, 0x65, 0x00, 0x41, 0x75, 0x73, 0x74, 0x72, 0x61, 0x6c,
+  0x69, 0x61, 0x2f, 0x50, 0x65, 0x72, 0x74, 0x68, 0x00, 0x41, 0x75, 0x73, 0x74, 0x72, 0x61, 0x6c,
+  0x69, 0x61, 0x2f, 0x53, 0x79, 0x64, 0x6e, 0x65, 0x79, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65,
+  0x2f, 0x41, 0x6d, 0x73, 0x74, 0x65, 0x72, 0x64, 0x61, 0x6d, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70,
+  0x65, 0x2f, 0x41, 0x6e, 0x64, 0x6f, 0x72, 0x72, 0x61, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65,
+  0x2f, 0x41, 0x73, 0x74, 0x72, 0x61, 0x6b, 0x68, 0x61, 0x6e, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70,
+  0x65, 0x2f, 0x41, 0x74, 0x68, 0x65, 0x6e, 0x73, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f,
+  0x42, 0x65, 0x6c, 0x67, 0x72, 0x61, 0x64, 0x65, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f,
+  0x42, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x42, 0x72,
+  0x61, 0x74, 0x69, 0x73, 0x6c, 0x61, 0x76, 0x61, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f,
+  0x42, 0x72, 0x75, 0x73, 0x73, 0x65, 0x6c, 0x73, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f,
+  0x42, 0x75, 0x63, 0x68, 0x61, 0x72, 0x65, 0x73, 0x74, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65,
+  0x2f, 0x42, 0x75, 0x64, 0x61, 0x70, 0x65, 0x73, 0x74, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65,
+  0x2f, 0x42, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x65, 0x6e, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65,
+  0x2f, 0x43, 0x68, 0x69, 0x73, 0x69, 0x6e, 0x61, 0x75, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65,
+  0x2f, 0x43, 0x6f, 0x70, 0x65, 0x6e, 0x68, 0x61, 0x67, 0x65, 0x6e, 0x00, 0x45, 0x75, 0x72, 0x6f,
+  0x70, 0x65, 0x2f, 0x44, 0x75, 0x62, 0x6c, 0x69, 0x6e, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65,
+  0x2f, 0x47, 0x69, 0x62, 0x72, 0x61, 0x6c, 0x74, 0x61, 0x72, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70,
+  0x65, 0x2f, 0x47, 0x75, 0x65, 0x72, 0x6e, 0x73, 0x65, 0x79, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70,
+  0x65, 0x2f, 0x48, 0x65, 0x6c, 0x73, 0x69, 0x6e, 0x6b, 0x69, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70,
+  0x65, 0x2f, 0x49, 0x73, 0x6c, 0x65, 0x5f, 0x6f, 0x66, 0x5f, 0x4d, 0x61, 0x6e, 0x00, 0x45, 0x75,
+  0x72, 0x6f, 0x70, 0x65, 0x2f, 0x49, 0x73, 0x74, 0x61, 0x6e, 0x62, 0x75, 0x6c, 0x00, 0x45, 0x75,
+  0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4a, 0x65, 0x72, 0x73, 0x65, 0x79, 0x00, 0x45, 0x75, 0x72, 0x6f,
+  0x70, 0x65, 0x2f, 0x4b, 0x61, 0x6c, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x72, 0x61, 0x64, 0x00, 0x45,
+  0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4b, 0x69, 0x72, 0x6f, 0x76, 0x00, 0x45, 0x75, 0x72, 0x6f,
+  0x70, 0x65, 0x2f, 0x4b, 0x79, 0x69, 0x76, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4c,
+  0x69, 0x73, 0x62, 0x6f, 0x6e, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4c, 0x6a, 0x75,
+  0x62, 0x6c, 0x6a, 0x61, 0x6e, 0x61, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4c, 0x6f,
+  0x6e, 0x64, 0x6f, 0x6e, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4c, 0x75, 0x78, 0x65,
+  0x6d, 0x62, 0x6f, 0x75, 0x72, 0x67, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4d, 0x61,
+  0x64, 0x72, 0x69, 0x64, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4d, 0x61, 0x6c, 0x74,
+  0x61, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4d, 0x61, 0x72, 0x69, 0x65, 0x68, 0x61,
+  0x6d, 0x6e, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4d, 0x69, 0x6e, 0x73, 0x6b, 0x00,
+  0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4d, 0x6f, 0x6e, 0x61, 0x63, 0x6f, 0x00, 0x45, 0x75,
+  0x72, 0x6f, 0x70, 0x65, 0x2f, 0x4d, 0x6f, 0x73, 0x63, 0x6f, 0x77, 0x00, 0x45, 0x75, 0x72, 0x6f,
+  0x70, 0x65, 0x2f, 0x4f, 0x73, 0x6c, 0x6f, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x50,
+  0x61, 0x72, 0x69, 0x73, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x50, 0x6f, 0x64, 0x67,
+  0x6f, 0x72, 0x69, 0x63, 0x61, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x50, 0x72, 0x61,
+  0x67, 0x75, 0x65, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x52, 0x69, 0x67, 0x61, 0x00,
+  0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x52, 0x6f, 0x6d, 0x65, 0x00, 0x45, 0x75, 0x72, 0x6f,
+  0x70, 0x65, 0x2f, 0x53, 0x61, 0x6d, 0x61, 0x72, 0x61, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65,
+  0x2f, 0x53, 0x61, 0x6e, 0x5f, 0x4d, 0x61, 0x72, 0x69, 0x6e, 0x6f, 0x00, 0x45, 0x75, 0x72, 0x6f,
+  0x70, 0x65, 0x2f, 0x53, 0x61, 0x72, 0x61, 0x6a, 0x65, 0x76, 0x6f, 0x00, 0x45, 0x75, 0x72, 0x6f,
+  0x70, 0x65, 0x2f, 0x53, 0x61, 0x72, 0x61, 0x74, 0x6f, 0x76, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70,
+  0x65, 0x2f, 0x53, 0x69, 0x6d, 0x66, 0x65, 0x72, 0x6f, 0x70, 0x6f, 0x6c, 0x00, 0x45, 0x75, 0x72,
+  0x6f, 0x70, 0x65, 0x2f, 0x53, 0x6b, 0x6f, 0x70, 0x6a, 0x65, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70,
+  0x65, 0x2f, 0x53, 0x6f, 0x66, 0x69, 0x61, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x53,
+  0x74, 0x6f, 0x63, 0x6b, 0x68, 0x6f, 0x6c, 0x6d, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f,
+  0x54, 0x61, 0x6c, 0x6c, 0x69, 0x6e, 0x6e, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x54,
+  0x69, 0x72, 0x61, 0x6e, 0x65, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x55, 0x6c, 0x79,
+  0x61, 0x6e, 0x6f, 0x76, 0x73, 0x6b, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x56, 0x61,
+  0x64, 0x75, 0x7a, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x56, 0x61, 0x74, 0x69, 0x63,
+  0x61, 0x6e, 0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x56, 0x69, 0x65, 0x6e, 0x6e, 0x61,
+  0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x56, 0x69, 0x6c, 0x6e, 0x69, 0x75, 0x73, 0x00,
+  0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x56, 0x6f, 0x6c, 0x67, 0x6f, 0x67, 0x72, 0x61, 0x64,
+  0x00, 0x45, 0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x57, 0x61, 0x72, 0x73, 0x61, 0x77, 0x00, 0x45,
+  0x75, 0x72, 0x6f, 0x70, 0x65, 0x2f, 0x5a, 0x61, 0x67, 0x72, 0x65, 0x62, 0x00, 0x45, 0x75, 0x72,
+  0x6f, 0x70, 0x65, 0x2f, 0x5a, 0x75, 0x72, 0x69, 0x63, 0x68, 0x00, 0x49, 0x6e, 0x64, 0x69, 0x61,
+  0x6e, 0x2f, 0x41, 0x6e, 0x74, 0x61, 0x6e, 0x61, 0x6e, 0x61, 0x72, 0x69, 0x76, 0x6f, 0x00, 0x49,
+  0x6e, 0x64, 0x69, 0x61, 0x6e, 0x2f, 0x43, 0x68, 0x61, 0x67, 0x6f, 0x73, 0x00, 0x49, 0x6e, 0x64,
+  0x69, 0x61, 0x6e, 0x2f, 0x43, 0x68, 0x72, 0x69, 0x73, 0x74, 0x6d, 0x61, 0x73, 0x00, 0x49, 0x6e,
+  0x64, 0x69, 0x61, 0x6e, 0x2f, 0x43, 0x6f, 0x63, 0x6f, 0x73, 0x00, 0x49, 0x6e, 0x64, 0x69, 0x61,
+  0x6e, 0x2f, 0x43, 0x6f, 0x6d, 0x6f, 0x72, 0x6f, 0x00, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x2f,
+  0x4b, 0x65, 0x72, 0x67, 0x75, 0x65, 0x6c, 0x65, 0x6e, 0x00, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e,
+  0x2f, 0x4d, 0x61, 0x68, 0x65, 0x00, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x2f, 0x4d, 0x61, 0x6c,
+  0x64, 0x69, 0x76, 0x65, 0x73, 0x00, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x2f, 0x4d, 0x61, 0x75,
+  0x72, 0x69, 0x74, 0x69, 0x75, 0x73, 0x00, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x2f, 0x4d, 0x61,
+  0x79, 0x6f, 0x74, 0x74, 0x65, 0x00, 0x49, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x2f, 0x52, 0x65, 0x75,
+  0x6e, 0x69, 0x6f, 0x6e, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x41, 0x70, 0x69,
+  0x61, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x41, 0x75, 0x63, 0x6b, 0x6c, 0x61,
+  0x6e, 0x64, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x42, 0x6f, 0x75, 0x67, 0x61,
+  0x69, 0x6e, 0x76, 0x69, 0x6c, 0x6c, 0x65, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f,
+  0x43, 0x68, 0x61, 0x74, 0x68, 0x61, 0x6d, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f,
+  0x43, 0x68, 0x75, 0x75, 0x6b, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x45, 0x61,
+  0x73, 0x74, 0x65, 0x72, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x45, 0x66, 0x61,
+  0x74, 0x65, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x46, 0x61, 0x6b, 0x61, 0x6f,
+  0x66, 0x6f, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x46, 0x69, 0x6a, 0x69, 0x00,
+  0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x46, 0x75, 0x6e, 0x61, 0x66, 0x75, 0x74, 0x69,
+  0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x47, 0x61, 0x6c, 0x61, 0x70, 0x61, 0x67,
+  0x6f, 0x73, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x47, 0x61, 0x6d, 0x62, 0x69,
+  0x65, 0x72, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x47, 0x75, 0x61, 0x64, 0x61,
+  0x6c, 0x63, 0x61, 0x6e, 0x61, 0x6c, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x47,
+  0x75, 0x61, 0x6d, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x48, 0x6f, 0x6e, 0x6f,
+  0x6c, 0x75, 0x6c, 0x75, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x4b, 0x61, 0x6e,
+  0x74, 0x6f, 0x6e, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x4b, 0x69, 0x72, 0x69,
+  0x74, 0x69, 0x6d, 0x61, 0x74, 0x69, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x4b,
+  0x6f, 0x73, 0x72, 0x61, 0x65, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x4b, 0x77,
+  0x61, 0x6a, 0x61, 0x6c, 0x65, 0x69, 0x6e, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f,
+  0x4d, 0x61, 0x6a, 0x75, 0x72, 0x6f, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x4d,
+  0x61, 0x72, 0x71, 0x75, 0x65, 0x73, 0x61, 0x73, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63,
+  0x2f, 0x4d, 0x69, 0x64, 0x77, 0x61, 0x79, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f,
+  0x4e, 0x61, 0x75, 0x72, 0x75, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x4e, 0x69,
+  0x75, 0x65, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x4e, 0x6f, 0x72, 0x66, 0x6f,
+  0x6c, 0x6b, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x4e, 0x6f, 0x75, 0x6d, 0x65,
+  0x61, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x50, 0x61, 0x67, 0x6f, 0x5f, 0x50,
+  0x61, 0x67, 0x6f, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x50, 0x61, 0x6c, 0x61,
+  0x75, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x50, 0x69, 0x74, 0x63, 0x61, 0x69,
+  0x72, 0x6e, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x50, 0x6f, 0x68, 0x6e, 0x70,
+  0x65, 0x69, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x50, 0x6f, 0x72, 0x74, 0x5f,
+  0x4d, 0x6f, 0x72, 0x65, 0x73, 0x62, 0x79, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f,
+  0x52, 0x61, 0x72, 0x6f, 0x74, 0x6f, 0x6e, 0x67, 0x61, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69,
+  0x63, 0x2f, 0x53, 0x61, 0x69, 0x70, 0x61, 0x6e, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63,
+  0x2f, 0x54, 0x61, 0x68, 0x69, 0x74, 0x69, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f,
+  0x54, 0x61, 0x72, 0x61, 0x77, 0x61, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x54,
+  0x6f, 0x6e, 0x67, 0x61, 0x74, 0x61, 0x70, 0x75, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63,
+  0x2f, 0x57, 0x61, 0x6b, 0x65, 0x00, 0x50, 0x61, 0x63, 0x69, 0x66, 0x69, 0x63, 0x2f, 0x57, 0x61,
+  0x6c, 0x6c, 0x69, 0x73, 0x00
+};
+
+#endif // TZ_GRID_H
@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+#
+# This file is part of the 7 Segment LED Clock Project
+#   https://github.com/ursweiss/7-Segment-LED-Clock
+#   https://www.printables.com/model/68013-7-segment-led-clock
+#
+# Copyright (c) 2021-2025 Urs Weiss
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, version 3.
+#
+# This program is distributed in the hope that it will be useful, but
+# WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+"""Generate include/web_assets.h, the gzipped web UI and schema.
+
+Runs before every PlatformIO build (extra_scripts in platformio.ini) and can
+be run by hand. The sources stay where they are edited:
+
+  src/web_html.h     INDEX_HTML, minified by trimming every line and dropping
+                     blank ones (no <pre>/<textarea>, so whitespace at line
+                     starts carries no meaning)
+  include/schema.h   SCHEMA_JSON, re-serialized without whitespace
+
+Each asset is gzipped (level 9, no timestamp, so builds are reproducible)
+into a PROGMEM array with a strong ETag from its SHA-256. The page requests
+the schema as /api/schema?v=<hash>, which lets browsers cache the schema
+for good; the page itself is revalidated with its ETag.
+
+The output is only rewritten when it changes, so unchanged assets do not
+trigger a rebuild.
+"""
+
+import gzip
+import hashlib
+import json
+import os
+import re
+
+# License header of every generated file
+LICENSE_HEADER = """\
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+"""
+
+SCHEMA_FETCH = "fetch('/api/schema')"
+
+
+def read_raw_literal(path, name):
+    """Content of the C++ raw string literal assigned to name."""
+    with open(path, "r", encoding="utf-8") as f:
+        source = f.read()
+    match = re.search(r"\b%s\[\]\s*(?:PROGMEM\s*)?=\s*R\"([^(]*)\((.*?)\)\1\"" % name, source, re.S)
+    if match is None:
+        raise SystemExit("%s not found in %s" % (name, path))
+    return match.group(2)
+
+
+def minify_html(html):
+    lines = (line.strip() for line in html.splitlines())
+    return "\n".join(line for line in lines if line) + "\n"
+
+
+def compress(data):
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def content_hash(data):
+    return hashlib.sha256(data).hexdigest()[:16]
+
+
+def format_array(name, data):
+    lines = ["static const uint8_t %s[] PROGMEM = {" % name]
+    for i in range(0, len(data), 16):
+        chunk = ", ".join("0x%02x" % b for b in data[i:i + 16])
+        lines.append("  %s%s" % (chunk, "," if i + 16 < len(data) else ""))
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def generate(root):
+    schema = json.loads(read_raw_literal(os.path.join(root, "include", "schema.h"), "SCHEMA_JSON"))
+    schema_json = json.dumps(schema, separators=(",", ":"), ensure_ascii=False).encode("utf-8")
+    schema_gz = compress(schema_json)
+    schema_version = content_hash(schema_gz)
+
+    html = read_raw_literal(os.path.join(root, "src", "web_html.h"), "INDEX_HTML")
+    if SCHEMA_FETCH not in html:
+        raise SystemExit("%s not found in INDEX_HTML" % SCHEMA_FETCH)
+    html = html.replace(SCHEMA_FETCH, "fetch('/api/schema?v=%s')" % schema_version)
+    html_gz = compress(minify_html(html).encode("utf-8"))
+
+    parts = [LICENSE_HEADER,
+             "// Generated by scripts/build_web_assets.py from src/web_html.h and",
+             "// include/schema.h on every build, do not edit.",
+             "// Web UI: %d bytes, %d gzipped. Schema: %d bytes, %d gzipped."
+             % (len(html.encode("utf-8")), len(html_gz), len(schema_json), len(schema_gz)),
+             "",
+             "#ifndef WEB_ASSETS_H",
+             "#define WEB_ASSETS_H",
+             "",
+             "#include <stdint.h>",
+             "",
+             "#ifndef PROGMEM",
+             "#define PROGMEM",
+             "#endif",
+             "",
+             "#define INDEX_HTML_GZ_ETAG \"\\\"%s\\\"\"" % content_hash(html_gz),
+             "#define SCHEMA_JSON_GZ_ETAG \"\\\"%s\\\"\"" % schema_version,
+             "#define SCHEMA_JSON_GZ_VERSION \"%s\"  // ?v= of the schema URL in the page" % schema_version,
+             "",
+             format_array("INDEX_HTML_GZ", html_gz),
+             "",
+             format_array("SCHEMA_JSON_GZ", schema_gz),
+             "",
+             "#endif // WEB_ASSETS_H"]
+    content = "\n".join(parts) + "\n"
+
+    output = os.path.join(root, "include", "web_assets.h")
+    if os.path.exists(output):
+        with open(output, "r", encoding="utf-8") as f:
+            if f.read() == content:
+                return
+    with open(output, "w", encoding="utf-8") as f:
+        f.write(content)
+    print("Wrote %s (web UI %d -> %d bytes, schema %d -> %d bytes)"
+          % (output, len(html.encode("utf-8")), len(html_gz), len(schema_json), len(schema_gz)))
+
+
+try:
+    # PlatformIO pre: script (SCons provides Import and env, not __file__)
+    Import("env")  # noqa: F821
+except NameError:
+    env = None
+
+if env is not None:
+    generate(env.subst("$PROJECT_DIR"))
+elif __name__ == "__main__":
+    generate(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
@@ -0,0 +1,229 @@
+#!/usr/bin/env python3
+#
+# This file is part of the 7 Segment LED Clock Project
+#   https://github.com/ursweiss/7-Segment-LED-Clock
+#   https://www.printables.com/model/68013-7-segment-led-clock
+#
+# Copyright (c) 2021-2025 Urs Weiss
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, version 3.
+#
+# This program is distributed in the hope that it will be useful, but
+# WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+"""Generate include/city_table.h, the offline city table for /api/cities.
+
+The table is one little endian blob (read by CityIndex):
+
+  header     "CTY1", city count, country count, zone count (uint16 each),
+             offset of the string pool (uint32)
+  cities     12 bytes each, sorted by lower case name: name offset (uint32),
+             latitude and longitude in 1/100 degree (int16), country index,
+             size rank (uint8, 255 = largest), zone index (uint16)
+  countries  6 bytes each: ISO 3166 code (2 chars), name offset (uint32)
+  zones      name offset (uint32) each
+  pool       NUL terminated ASCII strings, each stored once
+
+Sorted names make the table its own prefix index: a search is a binary
+search for the first match followed by a scan while the prefix matches.
+
+Sources, both from the tz database in /usr/share/zoneinfo by default:
+  zone.tab      the principal city of every time zone (about 400)
+  iso3166.tab   country names
+A GeoNames city dump (https://download.geonames.org/export/dump/, e.g.
+cities15000.txt) can replace zone.tab for a larger table; its population
+gives the size rank.
+
+Usage: scripts/gen_city_table.py [--geonames FILE] [--max-cities N]
+                                 [--zoneinfo DIR]
+"""
+
+import argparse
+import math
+import os
+import struct
+
+# License header of every generated file
+LICENSE_HEADER = """\
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+"""
+
+MAGIC = b"CTY1"
+
+
+def parse_iso6709(value):
+    """Return (latitude, longitude) of a zone.tab coordinate (+DDMM[SS]+DDDMM[SS])."""
+    split = max(value.rfind("+"), value.rfind("-"))
+    result = []
+    for part, degree_digits in ((value[:split], 2), (value[split:], 3)):
+        sign = -1 if part[0] == "-" else 1
+        digits = part[1:]
+        degrees = int(digits[:degree_digits])
+        minutes = int(digits[degree_digits:degree_digits + 2])
+        seconds = int(digits[degree_digits + 2:] or 0)
+        result.append(sign * (degrees + minutes / 60 + seconds / 3600))
+    return tuple(result)
+
+
+def read_countries(zoneinfo):
+    countries = {}
+    with open(os.path.join(zoneinfo, "iso3166.tab"), "r", encoding="utf-8") as f:
+        for line in f:
+            if line.startswith("#") or not line.strip():
+                continue
+            code, name = line.rstrip("\n").split("\t")[:2]
+            countries[code] = name
+    return countries
+
+
+def read_zone_cities(zoneinfo):
+    """Principal city of each time zone, named after the last part of the zone id."""
+    cities = []
+    with open(os.path.join(zoneinfo, "zone.tab"), "r", encoding="utf-8") as f:
+        for line in f:
+            if line.startswith("#") or not line.strip():
+                continue
+            fields = line.rstrip("\n").split("\t")
+            code, coordinates, zone = fields[:3]
+            latitude, longitude = parse_iso6709(coordinates)
+            name = zone.rsplit("/", 1)[-1].replace("_", " ")
+            cities.append((name, code, latitude, longitude, zone, 0))
+    return cities
+
+
+def read_geonames(path, max_cities):
+    """Largest cities of a GeoNames dump (tab separated, ASCII names)."""
+    cities = []
+    with open(path, "r", encoding="utf-8") as f:
+        for line in f:
+            fields = line.rstrip("\n").split("\t")
+            if len(fields) < 18 or not fields[17]:
+                continue
+            cities.append((fields[2], fields[8], float(fields[4]), float(fields[5]),
+                           fields[17], int(fields[14] or 0)))
+    cities.sort(key=lambda city: -city[5])
+    return cities[:max_cities] if max_cities else cities
+
+
+def size_rank(population, largest):
+    """Population on a log scale, 1-255 (0 = unknown)."""
+    if population <= 0 or largest <= 1:
+        return 0
+    return max(1, min(255, round(255 * math.log(population) / math.log(largest))))
+
+
+def build_table(cities, country_names):
+    cities = [city for city in cities if city[0].isascii() and city[0]]
+    cities.sort(key=lambda city: (city[0].lower(), -city[5], city[1]))
+    countries = sorted({city[1] for city in cities})
+    zones = sorted({city[4] for city in cities})
+    if len(countries) > 255 or len(zones) > 65535 or len(cities) > 65535:
+        raise SystemExit("Too many cities, countries or zones for the table format")
+    largest = max(city[5] for city in cities)
+
+    pool = bytearray()
+    pool_offsets = {}
+
+    def add_string(value):
+        if value not in pool_offsets:
+            pool_offsets[value] = len(pool)
+            pool.extend(value.encode("ascii", "replace") + b"\0")
+        return pool_offsets[value]
+
+    country_index = {code: i for i, code in enumerate(countries)}
+    zone_index = {zone: i for i, zone in enumerate(zones)}
+
+    records = bytearray()
+    for name, code, latitude, longitude, zone, population in cities:
+        records += struct.pack("<IhhBBH", add_string(name), round(latitude * 100), round(longitude * 100),
+                               country_index[code], size_rank(population, largest), zone_index[zone])
+    country_records = bytearray()
+    for code in countries:
+        country_records += code.encode("ascii") + struct.pack("<I", add_string(country_names.get(code, code)))
+    zone_records = bytearray()
+    for zone in zones:
+        zone_records += struct.pack("<I", add_string(zone))
+
+    pool_offset = 16 + len(records) + len(country_records) + len(zone_records)
+    header = MAGIC + struct.pack("<HHHxxI", len(cities), len(countries), len(zones), pool_offset)
+    return header + records + country_records + zone_records + pool, len(cities), len(countries), len(zones)
+
+
+def format_array(name, data):
+    lines = ["static const uint8_t %s[] PROGMEM = {" % name]
+    for i in range(0, len(data), 16):
+        chunk = ", ".join("0x%02x" % b for b in data[i:i + 16])
+        lines.append("  %s%s" % (chunk, "," if i + 16 < len(data) else ""))
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate include/city_table.h")
+    parser.add_argument("--geonames", help="GeoNames city dump to use instead of zone.tab")
+    parser.add_argument("--max-cities", type=int, default=4000, help="Largest cities kept from --geonames")
+    parser.add_argument("--zoneinfo", default="/usr/share/zoneinfo", help="Directory with zone.tab and iso3166.tab")
+    args = parser.parse_args()
+
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    output = os.path.join(root, "include", "city_table.h")
+
+    country_names = read_countries(args.zoneinfo)
+    if args.geonames:
+        cities = read_geonames(args.geonames, args.max_cities)
+        source = os.path.basename(args.geonames)
+    else:
+        cities = read_zone_cities(args.zoneinfo)
+        source = "tz database zone.tab"
+    table, city_count, country_count, zone_count = build_table(cities, country_names)
+
+    parts = [LICENSE_HEADER,
+             "// Generated by scripts/gen_city_table.py, do not edit.",
+             "// %d cities in %d countries and %d time zones from %s (%d bytes)."
+             % (city_count, country_count, zone_count, source, len(table)),
+             "",
+             "#ifndef CITY_TABLE_H",
+             "#define CITY_TABLE_H",
+             "",
+             "#include <stdint.h>",
+             "",
+             "#ifndef PROGMEM",
+             "#define PROGMEM",
+             "#endif",
+             "",
+             format_array("CITY_TABLE", table),
+             "",
+             "#endif // CITY_TABLE_H"]
+
+    with open(output, "w", encoding="utf-8") as f:
+        f.write("\n".join(parts) + "\n")
+    print("Wrote %s (%d cities, %d bytes)" % (output, city_count, len(table)))
+
+
+if __name__ == "__main__":
+    main()
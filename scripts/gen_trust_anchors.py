@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+#
+# This file is part of the 7 Segment LED Clock Project
+#   https://github.com/ursweiss/7-Segment-LED-Clock
+#   https://www.printables.com/model/68013-7-segment-led-clock
+#
+# Copyright (c) 2021-2025 Urs Weiss
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, version 3.
+#
+# This program is distributed in the hope that it will be useful, but
+# WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+"""Generate include/trust_anchors.h from PEM root certificates.
+
+Each trust set becomes one certificate bundle in the format of ESP-IDF's
+esp_crt_bundle (as used by WiFiClientSecure::setCACertBundle): a big endian
+certificate count, then per certificate the lengths of its DER subject name
+and DER public key followed by both, sorted by subject name. The handshake
+looks up the issuer of the server's chain by name and parses only that one
+public key, no PEM is parsed at run time.
+
+Usage: scripts/gen_trust_anchors.py [certificate directory]
+       (default /etc/ssl/certs, file names as in Debian's ca-certificates)
+"""
+
+import base64
+import os
+import sys
+
+# Trust set name -> root certificates (file names without .pem)
+TRUST_SETS = {
+    # Let's Encrypt (RSA and ECDSA chains)
+    "OPEN_METEO": ["ISRG_Root_X1", "ISRG_Root_X2"],
+    # Cloudflare edge certificates, from any CA Cloudflare issues from: Google
+    # Trust Services (R1-R4, also cross-signed by GlobalSign Root CA), Let's
+    # Encrypt, SSL.com (its 2022 TLS roots are cross-signed by these) and
+    # Sectigo (USERTrust, cross-signed by AAA Certificate Services)
+    "IPAPI": ["GTS_Root_R1", "GTS_Root_R2", "GTS_Root_R3", "GTS_Root_R4", "GlobalSign_Root_CA",
+              "ISRG_Root_X1", "ISRG_Root_X2",
+              "SSL.com_Root_Certification_Authority_RSA", "SSL.com_Root_Certification_Authority_ECC",
+              "USERTrust_RSA_Certification_Authority", "USERTrust_ECC_Certification_Authority",
+              "Comodo_AAA_Services_root"],
+}
+
+# License header of every generated file
+LICENSE_HEADER = """\
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+"""
+
+OID_COMMON_NAME = bytes([0x06, 0x03, 0x55, 0x04, 0x03])
+
+
+def read_tlv(data, offset):
+    """Return (tag, content start, content end) of the DER element at offset."""
+    tag = data[offset]
+    length = data[offset + 1]
+    offset += 2
+    if length & 0x80:
+        count = length & 0x7F
+        length = int.from_bytes(data[offset:offset + count], "big")
+        offset += count
+    return tag, offset, offset + length
+
+
+def pem_to_der(path):
+    with open(path, "r", encoding="ascii") as f:
+        lines = [line.strip() for line in f]
+    start = lines.index("-----BEGIN CERTIFICATE-----")
+    end = lines.index("-----END CERTIFICATE-----")
+    return base64.b64decode("".join(lines[start + 1:end]))
+
+
+def parse_certificate(der):
+    """Return raw DER subject, raw DER SubjectPublicKeyInfo, common name, not after."""
+    _, cert_start, _ = read_tlv(der, 0)
+    _, tbs_start, tbs_end = read_tlv(der, cert_start)
+    fields = []
+    offset = tbs_start
+    while offset < tbs_end:
+        tag, start, end = read_tlv(der, offset)
+        fields.append((tag, offset, start, end))
+        offset = end
+    if fields[0][0] == 0xA0:  # [0] version
+        fields = fields[1:]
+    # serial, signature, issuer, validity, subject, subjectPublicKeyInfo
+    _, _, validity_start, _ = fields[3]
+    _, subject_offset, _, subject_end = fields[4]
+    _, spki_offset, _, spki_end = fields[5]
+
+    _, _, not_before_end = read_tlv(der, validity_start)
+    _, after_start, after_end = read_tlv(der, not_before_end)
+    not_after = der[after_start:after_end].decode("ascii")
+    if len(not_after) == 13:  # UTCTime YYMMDDhhmmssZ
+        not_after = "20" + not_after
+    not_after = "%s-%s-%s" % (not_after[0:4], not_after[4:6], not_after[6:8])
+
+    subject = der[subject_offset:subject_end]
+    name = ""
+    position = subject.find(OID_COMMON_NAME)
+    if position >= 0:
+        _, start, end = read_tlv(subject, position + len(OID_COMMON_NAME))
+        name = subject[start:end].decode("utf-8", "replace")
+    return subject, der[spki_offset:spki_end], name, not_after
+
+
+def build_bundle(certificates):
+    certificates = sorted(certificates, key=lambda cert: cert[0])
+    bundle = bytearray(len(certificates).to_bytes(2, "big"))
+    for subject, key, _, _ in certificates:
+        bundle += len(subject).to_bytes(2, "big") + len(key).to_bytes(2, "big")
+        bundle += subject + key
+    return bytes(bundle)
+
+
+def format_array(name, data):
+    lines = ["static const uint8_t %s[] PROGMEM = {" % name]
+    for i in range(0, len(data), 16):
+        chunk = ", ".join("0x%02x" % b for b in data[i:i + 16])
+        lines.append("  %s%s" % (chunk, "," if i + 16 < len(data) else ""))
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    cert_dir = sys.argv[1] if len(sys.argv) > 1 else "/etc/ssl/certs"
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    output = os.path.join(root, "include", "trust_anchors.h")
+
+    parts = [LICENSE_HEADER,
+             "// Generated by scripts/gen_trust_anchors.py, do not edit.",
+             "// Certificate bundles (esp_crt_bundle format) per trust set.",
+             "",
+             "#ifndef TRUST_ANCHORS_H",
+             "#define TRUST_ANCHORS_H",
+             "",
+             "#include <stdint.h>",
+             "",
+             "#ifndef PROGMEM",
+             "#define PROGMEM",
+             "#endif",
+             ""]
+    total = 0
+    for set_name, files in TRUST_SETS.items():
+        certificates = [parse_certificate(pem_to_der(os.path.join(cert_dir, f + ".pem"))) for f in files]
+        bundle = build_bundle(certificates)
+        total += len(bundle)
+        for _, _, name, not_after in sorted(certificates, key=lambda cert: cert[0]):
+            parts.append("// %s (valid until %s)" % (name, not_after))
+        parts.append(format_array("TRUST_BUNDLE_" + set_name, bundle))
+        parts.append("")
+    parts.append("#endif // TRUST_ANCHORS_H")
+
+    with open(output, "w", encoding="utf-8") as f:
+        f.write("\n".join(parts) + "\n")
+    print("Wrote %s (%d bytes of anchors)" % (output, total))
+
+
+if __name__ == "__main__":
+    main()
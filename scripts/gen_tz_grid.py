@@ -0,0 +1,301 @@
+#!/usr/bin/env python3
+#
+# This file is part of the 7 Segment LED Clock Project
+#   https://github.com/ursweiss/7-Segment-LED-Clock
+#   https://www.printables.com/model/68013-7-segment-led-clock
+#
+# Copyright (c) 2021-2025 Urs Weiss
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, version 3.
+#
+# This program is distributed in the hope that it will be useful, but
+# WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+"""Generate include/tz_grid.h, the time zone raster read by TimezoneGrid.
+
+The world is split into cells of 1/N degree (N = --cells-per-degree), each
+holding the time zone at its center. Rows run north to south, columns west
+to east, and each row is run length encoded. The blob is little endian:
+
+  header  "TZG1", columns, rows, zone count (uint16 each), cells per
+          degree (uint8), pad (uint8), offsets of the zone table and the
+          string pool (uint32 each), 20 bytes
+  rows    rows + 1 run indexes (uint32): runs of row r are [row r, row r+1)
+  runs    4 bytes each: zone index (uint16), end column, exclusive (uint16)
+  zones   name offset (uint32) each
+  pool    NUL terminated zone names
+
+Zones are assigned one of two ways:
+  default       nearest principal city of the tz database (zone.tab) by
+                great circle distance. Needs no extra data, but borders are
+                only approximated (halfway between the cities). --geonames
+                adds the cities of a GeoNames dump (e.g. cities15000.txt),
+                which moves the borders much closer to the real ones.
+  --boundaries  time zone polygons as GeoJSON (combined.json of
+                https://github.com/evansiroky/timezone-boundary-builder);
+                cells outside every polygon get the nautical zone of their
+                longitude (Etc/GMT+N).
+
+Usage: scripts/gen_tz_grid.py [--boundaries FILE | --geonames FILE]
+                              [--cells-per-degree N] [--zoneinfo DIR]
+"""
+
+import argparse
+import bisect
+import json
+import math
+import os
+import struct
+
+# License header of every generated file
+LICENSE_HEADER = """\
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+"""
+
+MAGIC = b"TZG1"
+
+
+def parse_iso6709(value):
+    """Return (latitude, longitude) of a zone.tab coordinate (+DDMM[SS]+DDDMM[SS])."""
+    split = max(value.rfind("+"), value.rfind("-"))
+    result = []
+    for part, degree_digits in ((value[:split], 2), (value[split:], 3)):
+        sign = -1 if part[0] == "-" else 1
+        digits = part[1:]
+        degrees = int(digits[:degree_digits])
+        minutes = int(digits[degree_digits:degree_digits + 2])
+        seconds = int(digits[degree_digits + 2:] or 0)
+        result.append(sign * (degrees + minutes / 60 + seconds / 3600))
+    return tuple(result)
+
+
+def read_zone_points(zoneinfo):
+    points = []
+    with open(os.path.join(zoneinfo, "zone.tab"), "r", encoding="utf-8") as f:
+        for line in f:
+            if line.startswith("#") or not line.strip():
+                continue
+            _, coordinates, zone = line.rstrip("\n").split("\t")[:3]
+            points.append((zone,) + parse_iso6709(coordinates))
+    return points
+
+
+def cell_center(row, column, cells_per_degree):
+    return 90 - (row + 0.5) / cells_per_degree, -180 + (column + 0.5) / cells_per_degree
+
+
+def unit_vector(latitude, longitude):
+    lat = math.radians(latitude)
+    lon = math.radians(longitude)
+    return math.cos(lat) * math.cos(lon), math.cos(lat) * math.sin(lon), math.sin(lat)
+
+
+def nearest_city_grid(points, columns, rows, cells_per_degree):
+    """Zone of the nearest city per cell (largest dot product of unit vectors).
+
+    Cities are sorted by latitude and searched outwards from the cell's; the
+    great circle distance is at least the latitude difference, so a side is
+    done once that alone is farther than the best city found.
+    """
+    points = sorted(points, key=lambda point: point[1])
+    latitudes = [latitude for _, latitude, _ in points]
+    cities = [(zone,) + unit_vector(latitude, longitude) for zone, latitude, longitude in points]
+    grid = []
+    for row in range(rows):
+        latitude = cell_center(row, 0, cells_per_degree)[0]
+        start = bisect.bisect_left(latitudes, latitude)
+        cells = []
+        for column in range(columns):
+            x, y, z = unit_vector(*cell_center(row, column, cells_per_degree))
+            best_dot = -2.0
+            best_zone = None
+            below, above = start - 1, start
+            while below >= 0 or above < len(cities):
+                for index in (below, above):
+                    if 0 <= index < len(cities):
+                        zone, cx, cy, cz = cities[index]
+                        dot = cx * x + cy * y + cz * z
+                        if dot > best_dot:
+                            best_dot, best_zone = dot, zone
+                if below >= 0 and math.cos(math.radians(latitude - latitudes[below])) >= best_dot:
+                    below -= 1
+                else:
+                    below = -1
+                if above < len(cities) and math.cos(math.radians(latitudes[above] - latitude)) >= best_dot:
+                    above += 1
+                else:
+                    above = len(cities)
+            cells.append(best_zone)
+        grid.append(cells)
+    return grid
+
+
+def read_geonames_points(path):
+    """Cities of a GeoNames dump as additional nearest-city points."""
+    points = []
+    with open(path, "r", encoding="utf-8") as f:
+        for line in f:
+            fields = line.rstrip("\n").split("\t")
+            if len(fields) >= 18 and fields[17]:
+                points.append((fields[17], float(fields[4]), float(fields[5])))
+    return points
+
+
+def nautical_zone(longitude):
+    offset = int(math.floor((longitude + 7.5) / 15))
+    offset = max(-12, min(12, offset))
+    # POSIX convention: Etc/GMT-1 is one hour ahead of UTC
+    return "Etc/GMT" if offset == 0 else "Etc/GMT%+d" % -offset
+
+
+def fill_ring(crossings, ring, rows, cells_per_degree):
+    """Collect the longitudes where the ring crosses each row's center line."""
+    for (lon1, lat1), (lon2, lat2) in zip(ring, ring[1:] + ring[:1]):
+        if lat1 == lat2:
+            continue
+        low, high = min(lat1, lat2), max(lat1, lat2)
+        first = max(0, int(math.ceil((90 - high) * cells_per_degree - 0.5)))
+        last = min(rows - 1, int(math.floor((90 - low) * cells_per_degree - 0.5)))
+        for row in range(first, last + 1):
+            latitude = 90 - (row + 0.5) / cells_per_degree
+            if low <= latitude < high:
+                crossings[row].append(lon1 + (latitude - lat1) * (lon2 - lon1) / (lat2 - lat1))
+
+
+def boundary_grid(path, columns, rows, cells_per_degree):
+    """Scanline fill of each zone's polygons (even-odd rule), nautical zones elsewhere."""
+    grid = [[nautical_zone(cell_center(row, column, cells_per_degree)[1]) for column in range(columns)]
+            for row in range(rows)]
+    with open(path, "r", encoding="utf-8") as f:
+        features = json.load(f)["features"]
+    for feature in features:
+        zone = feature["properties"].get("tzid")
+        geometry = feature["geometry"]
+        polygons = geometry["coordinates"] if geometry["type"] == "MultiPolygon" else [geometry["coordinates"]]
+        crossings = [[] for _ in range(rows)]
+        for polygon in polygons:
+            for ring in polygon:
+                fill_ring(crossings, [tuple(point[:2]) for point in ring], rows, cells_per_degree)
+        for row, longitudes in enumerate(crossings):
+            longitudes.sort()
+            for west, east in zip(longitudes[0::2], longitudes[1::2]):
+                first = max(0, int(math.ceil((west + 180) * cells_per_degree - 0.5)))
+                last = min(columns - 1, int(math.floor((east + 180) * cells_per_degree - 0.5)))
+                for column in range(first, last + 1):
+                    grid[row][column] = zone
+    return grid
+
+
+def build_table(grid, cells_per_degree):
+    rows = len(grid)
+    columns = len(grid[0])
+    zones = sorted({zone for cells in grid for zone in cells})
+    zone_index = {zone: i for i, zone in enumerate(zones)}
+
+    row_starts = bytearray()
+    runs = bytearray()
+    run_count = 0
+    for cells in grid:
+        row_starts += struct.pack("<I", run_count)
+        for column in range(columns):
+            if column + 1 == columns or cells[column + 1] != cells[column]:
+                runs += struct.pack("<HH", zone_index[cells[column]], column + 1)
+                run_count += 1
+    row_starts += struct.pack("<I", run_count)
+
+    pool = bytearray()
+    zone_records = bytearray()
+    for zone in zones:
+        zone_records += struct.pack("<I", len(pool))
+        pool += zone.encode("ascii") + b"\0"
+
+    zones_offset = 20 + len(row_starts) + len(runs)
+    pool_offset = zones_offset + len(zone_records)
+    header = MAGIC + struct.pack("<HHHBxII", columns, rows, len(zones), cells_per_degree, zones_offset, pool_offset)
+    return header + row_starts + runs + zone_records + pool, len(zones), run_count
+
+
+def format_array(name, data):
+    lines = ["static const uint8_t %s[] PROGMEM = {" % name]
+    for i in range(0, len(data), 16):
+        chunk = ", ".join("0x%02x" % b for b in data[i:i + 16])
+        lines.append("  %s%s" % (chunk, "," if i + 16 < len(data) else ""))
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate include/tz_grid.h")
+    parser.add_argument("--boundaries", help="Time zone polygons (GeoJSON) instead of nearest principal city")
+    parser.add_argument("--geonames", help="GeoNames city dump, more nearest-city points")
+    parser.add_argument("--cells-per-degree", type=int, default=2, help="Grid resolution (default 2 = 0.5 degree)")
+    parser.add_argument("--zoneinfo", default="/usr/share/zoneinfo", help="Directory with zone.tab")
+    args = parser.parse_args()
+
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    output = os.path.join(root, "include", "tz_grid.h")
+
+    columns = 360 * args.cells_per_degree
+    rows = 180 * args.cells_per_degree
+    if args.boundaries:
+        grid = boundary_grid(args.boundaries, columns, rows, args.cells_per_degree)
+        source = os.path.basename(args.boundaries)
+    else:
+        points = read_zone_points(args.zoneinfo)
+        source = "nearest tz database principal city"
+        if args.geonames:
+            points += read_geonames_points(args.geonames)
+            source = "nearest city of zone.tab and %s" % os.path.basename(args.geonames)
+        grid = nearest_city_grid(points, columns, rows, args.cells_per_degree)
+    table, zone_count, run_count = build_table(grid, args.cells_per_degree)
+
+    parts = [LICENSE_HEADER,
+             "// Generated by scripts/gen_tz_grid.py, do not edit.",
+             "// %dx%d cells of 1/%d degree, %d zones (%s), %d runs, %d bytes."
+             % (columns, rows, args.cells_per_degree, zone_count, source, run_count, len(table)),
+             "",
+             "#ifndef TZ_GRID_H",
+             "#define TZ_GRID_H",
+             "",
+             "#include <stdint.h>",
+             "",
+             "#ifndef PROGMEM",
+             "#define PROGMEM",
+             "#endif",
+             "",
+             format_array("TZ_GRID", table),
+             "",
+             "#endif // TZ_GRID_H"]
+
+    with open(output, "w", encoding="utf-8") as f:
+        f.write("\n".join(parts) + "\n")
+    print("Wrote %s (%d zones, %d runs, %d bytes)" % (output, zone_count, run_count, len(table)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,168 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AmbientLight.h"
+#include <string.h>
+
+ReplaySampleSource::ReplaySampleSource(const uint16_t* samples, uint16_t count)
+    : samples(samples), count(count), next(0) {
+}
+
+bool ReplaySampleSource::read(uint16_t& level) {
+  if (samples == nullptr || count == 0) {
+    return false;
+  }
+  level = samples[next];
+  next = (next + 1) % count;
+  return true;
+}
+
+AmbientLightFilter::AmbientLightFilter(uint8_t emaAlpha, uint16_t hysteresis)
+    : emaAlpha(emaAlpha), hysteresis(hysteresis) {
+  reset();
+}
+
+void AmbientLightFilter::reset() {
+  next = 0;
+  count = 0;
+  emaQ8 = 0;
+  output = 0;
+  lastSmoothed = 0;
+  steadySamples = 0;
+}
+
+bool AmbientLightFilter::add(uint16_t raw) {
+  if (raw > AMBIENT_MAX_LEVEL) {
+    raw = AMBIENT_MAX_LEVEL;
+  }
+  window[next] = raw;
+  next = (next + 1) % AMBIENT_MEDIAN_WINDOW;
+  if (count < AMBIENT_MEDIAN_WINDOW) {
+    count++;
+  }
+
+  // Median over the samples held so far (insertion sort, at most 5 entries)
+  uint16_t sorted[AMBIENT_MEDIAN_WINDOW];
+  memcpy(sorted, window, count * sizeof(uint16_t));
+  for (uint8_t i = 1; i < count; i++) {
+    uint16_t value = sorted[i];
+    uint8_t j = i;
+    while (j > 0 && sorted[j - 1] > value) {
+      sorted[j] = sorted[j - 1];
+      j--;
+    }
+    sorted[j] = value;
+  }
+  uint16_t median = sorted[count / 2];
+
+  // First sample seeds the filter so the level is right immediately after boot
+  if (count == 1) {
+    emaQ8 = (uint32_t)median << 8;
+    output = median;
+    lastSmoothed = median;
+    steadySamples = 0;
+    return true;
+  }
+
+  int32_t delta = ((int32_t)median << 8) - (int32_t)emaQ8;
+  emaQ8 = (uint32_t)((int32_t)emaQ8 + delta * emaAlpha / 256);
+
+  uint16_t value = smoothed();
+  if (value == lastSmoothed) {
+    if (steadySamples < AMBIENT_SETTLE_SAMPLES) {
+      steadySamples++;
+    }
+  } else {
+    lastSmoothed = value;
+    steadySamples = 0;
+  }
+  if (value == output) {
+    return false;
+  }
+
+  // The band would otherwise hold the output short of a settled level
+  bool settled = value == 0 || value == AMBIENT_MAX_LEVEL || steadySamples >= AMBIENT_SETTLE_SAMPLES;
+  uint16_t diff = value > output ? value - output : output - value;
+  if (!settled && diff <= hysteresis + output / 16) {
+    return false;
+  }
+  output = value;
+  return true;
+}
+
+static void skipBlanks(const char*& p) {
+  while (*p == ' ' || *p == '\t') {
+    p++;
+  }
+}
+
+static bool parseNumber(const char*& p, uint32_t& value, uint8_t maxDigits) {
+  uint8_t digits = 0;
+  value = 0;
+  while (*p >= '0' && *p <= '9' && digits < maxDigits) {
+    value = value * 10 + (*p++ - '0');
+    digits++;
+  }
+  return digits > 0;
+}
+
+bool compileAmbientCurve(const char* text, AmbientCurve& curve) {
+  curve.count = 0;
+  const char* p = text;
+  skipBlanks(p);
+  while (*p != '\0') {
+    uint32_t level, brightness;
+    if (!parseNumber(p, level, 4) || *p++ != '=' || !parseNumber(p, brightness, 3)) {
+      return false;
+    }
+    if (level > AMBIENT_MAX_LEVEL || brightness > 255 || curve.count >= AMBIENT_CURVE_MAX_POINTS) {
+      return false;
+    }
+    if (curve.count > 0 && level <= curve.level[curve.count - 1]) {
+      return false;
+    }
+    if (*p != ' ' && *p != '\t' && *p != '\0') {
+      return false;
+    }
+    curve.level[curve.count] = level;
+    curve.brightness[curve.count] = brightness;
+    curve.count++;
+    skipBlanks(p);
+  }
+  return curve.count > 0;
+}
+
+uint8_t evaluateAmbientCurve(const AmbientCurve& curve, uint16_t level) {
+  if (curve.count == 0) {
+    return 255;
+  }
+  if (level <= curve.level[0]) {
+    return curve.brightness[0];
+  }
+  for (uint8_t i = 1; i < curve.count; i++) {
+    if (level <= curve.level[i]) {
+      int32_t span = curve.level[i] - curve.level[i - 1];
+      int32_t from = curve.brightness[i - 1];
+      int32_t to = curve.brightness[i];
+      return (uint8_t)(from + ((to - from) * (int32_t)(level - curve.level[i - 1]) + span / 2) / span);
+    }
+  }
+  return curve.brightness[curve.count - 1];
+}
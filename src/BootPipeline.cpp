@@ -0,0 +1,71 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BootPipeline.h"
+#include "Logger.h"
+
+static const uint8_t STAGE_COUNT = static_cast<uint8_t>(BootStage::Count);
+
+static const char* const stageNames[STAGE_COUNT] = {
+  "config",
+  "display",
+  "web",
+  "wifi",
+  "time",
+  "mdns",
+  "weather"
+};
+
+static uint32_t stageMillis[STAGE_COUNT] = {0};
+static uint8_t stagesDone = 0;
+
+void bootStageDone(BootStage stage) {
+  uint8_t index = static_cast<uint8_t>(stage);
+  if (index >= STAGE_COUNT || stageMillis[index] != 0) {
+    return;
+  }
+  // millis() can legitimately be 0 very early, keep 0 reserved for "pending"
+  uint32_t now = millis();
+  stageMillis[index] = now > 0 ? now : 1;
+  stagesDone++;
+  LOG_INFOF("Boot stage '%s' done after %lu ms", stageNames[index], (unsigned long)stageMillis[index]);
+  if (stagesDone == STAGE_COUNT) {
+    LOG_INFOF("Boot complete after %lu ms", (unsigned long)stageMillis[index]);
+  }
+}
+
+bool isBootStageDone(BootStage stage) {
+  uint8_t index = static_cast<uint8_t>(stage);
+  return index < STAGE_COUNT && stageMillis[index] != 0;
+}
+
+bool isBootComplete() {
+  return stagesDone == STAGE_COUNT;
+}
+
+uint32_t getBootStageMillis(BootStage stage) {
+  uint8_t index = static_cast<uint8_t>(stage);
+  return index < STAGE_COUNT ? stageMillis[index] : 0;
+}
+
+const char* getBootStageName(BootStage stage) {
+  uint8_t index = static_cast<uint8_t>(stage);
+  return index < STAGE_COUNT ? stageNames[index] : "unknown";
+}
@@ -19,169 +19,173 @@
  */
 
 #include "BrightnessControl.h"
+#include "BrightnessProfile.h"
+#include "AmbientLight.h"
 #include "config.h"
 #include "ConfigManager.h"
 #include "Logger.h"
+#include "SolarCalculator.h"
 #include <FastLED.h>
+#include <sys/time.h>
+#include <time.h>
 
-enum BrightnessState {
-  NORMAL,
-  FADING_DOWN,
-  DIMMED,
-  FADING_UP
-};
-
-static BrightnessState currentState = NORMAL;
 static uint8_t currentMainBrightness = 128;  // Will be set from config
 static uint8_t currentColonBrightness = 128;
-static unsigned long fadeStartMillis = 0;
-static uint8_t lastLoggedSecond = 255;
-static bool fadeCompleteLogged = false;
+static uint8_t currentKeyframe = 255;
+
+// Profile compiled from the config (once, recompiled after config changes)
+static BrightnessProfile profile;
+static bool profileValid = false;
+static bool dimmingActive = false;
+
+// Fades are evaluated once per frame (BRIGHTNESS_FRAME_MS)
+static int32_t memoFrame = -1;
+
+// Ambient light mode: sampled on its own task, the render tick only reads the result
+class AdcSampleSource : public AmbientSampleSource {
+public:
+  bool read(uint16_t& level) override {
+    level = analogRead(AMBIENT_LIGHT_PIN);
+    return true;
+  }
+};
+
+static AdcSampleSource adcSource;
+static AmbientSampleSource* ambientSource = &adcSource;
+static AmbientLightFilter ambientFilter(AMBIENT_EMA_ALPHA, AMBIENT_HYSTERESIS);
+static AmbientCurve ambientCurve;
+static bool ambientActive = false;
+static uint8_t ambientBrightness = 255;
+static uint16_t ambientRaw = 0;
+static uint32_t ambientSamples = 0;
+static uint32_t ambientChanges = 0;
+
+// Local date the solar keyframes were computed for (year * 1000 + day of year)
+static int32_t solarDay = -1;
 
-// Cached parsed time values to avoid re-parsing every 100ms
-static int cachedDimStartSeconds = -1;
-static int cachedDimEndSeconds = -1;
-static bool timeCacheValid = false;
+// Clock is considered set after 2020-01-01
+static const time_t MIN_VALID_EPOCH = 1577836800;
 
 bool parseTime(const char* timeStr, int& hours, int& minutes) {
   return sscanf(timeStr, "%d:%d", &hours, &minutes) == 2;
 }
 
-void initBrightnessControl() {
-  Config& cfg = configManager.getConfig();
+static uint32_t localSecondOfDay(int64_t utc) {
+  time_t t = (time_t)utc;
+  struct tm local;
+  localtime_r(&t, &local);
+  return local.tm_hour * 3600 + local.tm_min * 60 + local.tm_sec;
+}
 
-  if (!cfg.ledDimEnabled) {
-    currentState = NORMAL;
-    currentMainBrightness = cfg.ledBrightness;
-    currentColonBrightness = cfg.ledBrightness;
-    LOG_INFO("Brightness dimming disabled");
-    return;
+// Keyframes for today's sun: civil dusk -> dim, civil dawn -> normal
+static bool buildSolarProfile(const Config& cfg) {
+  time_t now = time(nullptr);
+  if (now < MIN_VALID_EPOCH || cfg.locationLatitude.length() == 0 || cfg.locationLongitude.length() == 0) {
+    return false;
   }
-
-  int startHours, startMinutes, endHours, endMinutes;
-  bool validStart = parseTime(cfg.ledDimStartTime.c_str(), startHours, startMinutes);
-  bool validEnd = parseTime(cfg.ledDimEndTime.c_str(), endHours, endMinutes);
-
-  if (!validStart || !validEnd) {
-    LOG_ERROR("Invalid dim time format - dimming disabled");
-    currentState = NORMAL;
-    currentMainBrightness = cfg.ledBrightness;
-    currentColonBrightness = cfg.ledBrightness;
-    timeCacheValid = false;
-    return;
+  struct tm local;
+  localtime_r(&now, &local);
+  solarDay = (local.tm_year + 1900) * 1000 + local.tm_yday;
+
+  SolarTimes sun;
+  computeSolarTimes(local.tm_year + 1900, local.tm_mon + 1, local.tm_mday,
+                    cfg.locationLatitude.toFloat(), cfg.locationLongitude.toFloat(), sun);
+
+  uint8_t normal = cfg.ledBrightness;
+  uint8_t dim = cfg.ledDimBrightness;
+  if (sun.sun != SolarEvent::Normal) {
+    // Polar day or night, hold one level all day
+    const uint32_t times[1] = {0};
+    const uint8_t levels[1] = {sun.sun == SolarEvent::AlwaysAbove ? normal : dim};
+    compileDailyProfile(profile, times, levels, 1);
+    LOG_INFOF("Solar dimming: sun %s all day", sun.sun == SolarEvent::AlwaysAbove ? "up" : "down");
+    return true;
   }
 
-  // Cache parsed times as seconds since midnight
-  cachedDimStartSeconds = startHours * 3600 + startMinutes * 60;
-  cachedDimEndSeconds = endHours * 3600 + endMinutes * 60;
-  timeCacheValid = true;
-
-  LOG_INFOF("Brightness dimming enabled: %s-%s (fade %ds)", cfg.ledDimStartTime.c_str(), cfg.ledDimEndTime.c_str(), cfg.ledDimFadeDuration);
-}
-
-void invalidateBrightnessCache() {
-  timeCacheValid = false;
-}
-
-static bool isInTimePeriod(int currentSeconds, int startSeconds, int endSeconds) {
-  if (startSeconds < endSeconds) {
-    return (currentSeconds >= startSeconds && currentSeconds < endSeconds);
+  uint32_t sunrise = localSecondOfDay(sun.sunrise);
+  uint32_t sunset = localSecondOfDay(sun.sunset);
+  if (sun.civil == SolarEvent::Normal) {
+    const uint32_t times[4] = {localSecondOfDay(sun.dawn), sunrise, sunset, localSecondOfDay(sun.dusk)};
+    const uint8_t levels[4] = {dim, normal, normal, dim};
+    compileDailyProfile(profile, times, levels, 4);
   } else {
-    return (currentSeconds >= startSeconds || currentSeconds < endSeconds);
+    // White night: no civil dusk, reach the dimmed level at solar midnight only
+    const uint32_t times[3] = {sunrise, sunset, localSecondOfDay(sun.noon + SECONDS_PER_DAY / 2)};
+    const uint8_t levels[3] = {normal, normal, dim};
+    compileDailyProfile(profile, times, levels, 3);
   }
+  LOG_INFOF("Solar dimming: sunrise %02lu:%02lu, sunset %02lu:%02lu",
+            (unsigned long)(sunrise / 3600), (unsigned long)(sunrise / 60 % 60),
+            (unsigned long)(sunset / 3600), (unsigned long)(sunset / 60 % 60));
+  return true;
 }
 
-static uint8_t interpolateBrightness(uint8_t fromBrightness, uint8_t toBrightness, unsigned long elapsed, unsigned long duration) {
-  if (elapsed >= duration) {
-    return toBrightness;
+static void buildAmbientCurve(const Config& cfg) {
+  ambientActive = false;
+  if (!cfg.ledAmbientEnabled) {
+    return;
+  }
+  if (!compileAmbientCurve(cfg.ledAmbientCurve.c_str(), ambientCurve)) {
+    LOG_ERROR("Invalid ambient light curve - using time based brightness");
+    return;
+  }
+  ambientActive = true;
+  if (ambientFilter.isReady()) {
+    ambientBrightness = evaluateAmbientCurve(ambientCurve, ambientFilter.level());
   }
-  float progress = (float)elapsed / (float)duration;
-  int range = toBrightness - fromBrightness;
-  return fromBrightness + (uint8_t)(range * progress);
 }
 
-void calculateBrightness(int currentSeconds, int dimStartSeconds, int dimEndSeconds, uint8_t currentSecond) {
+static void buildProfile() {
   Config& cfg = configManager.getConfig();
+  profile.curve = (BrightnessCurve)cfg.ledFadeCurve;
+  profileValid = true;
+  memoFrame = -1;
+  currentKeyframe = 255;
+  dimmingActive = false;
+  buildAmbientCurve(cfg);
 
   if (!cfg.ledDimEnabled) {
-    currentState = NORMAL;
-    currentMainBrightness = cfg.ledBrightness;
-    currentColonBrightness = cfg.ledBrightness;
     return;
   }
 
-  int fadeDurationSeconds = cfg.ledDimFadeDuration;
-  int fadeDownStartSeconds = dimStartSeconds - fadeDurationSeconds;
-  int fadeUpEndSeconds = (dimEndSeconds + fadeDurationSeconds) % 86400;
-
-  bool inDimPeriod = isInTimePeriod(currentSeconds, dimStartSeconds, dimEndSeconds);
-
-  // Handle fade-down period (may wrap around midnight)
-  if (fadeDownStartSeconds < 0) {
-    fadeDownStartSeconds += 86400;
-  }
-  bool inFadeDownPeriod = isInTimePeriod(currentSeconds, fadeDownStartSeconds, dimStartSeconds);
-
-  // Handle fade-up period
-  bool inFadeUpPeriod = isInTimePeriod(currentSeconds, dimEndSeconds, fadeUpEndSeconds);
-
-  BrightnessState newState;
-  if (inDimPeriod) {
-    newState = DIMMED;
-  } else if (inFadeDownPeriod) {
-    newState = FADING_DOWN;
-  } else if (inFadeUpPeriod) {
-    newState = FADING_UP;
-  } else {
-    newState = NORMAL;
-  }
-
-  if (newState != currentState) {
-    currentState = newState;
-    fadeStartMillis = millis();
-    fadeCompleteLogged = false;
-    lastLoggedSecond = 255;
-
-    switch (currentState) {
-      case DIMMED:
-        LOG_INFO("Dimming started");
-        break;
-      case NORMAL:
-        LOG_INFO("Dimming ended");
-        break;
-      case FADING_DOWN:
-        LOG_DEBUG("Fade down started");
-        break;
-      case FADING_UP:
-        LOG_DEBUG("Fade up started");
-        break;
+  if (cfg.ledDimSolar) {
+    if (buildSolarProfile(cfg)) {
+      dimmingActive = true;
+      return;
     }
+    // Retried once the clock is set (the date key changes)
+    time_t now = time(nullptr);
+    struct tm local;
+    localtime_r(&now, &local);
+    solarDay = (local.tm_year + 1900) * 1000 + local.tm_yday;
+    LOG_WARN("Solar dimming needs the time and latitude/longitude - using dim window");
   }
 
-  switch (currentState) {
-    case NORMAL:
-      currentMainBrightness = cfg.ledBrightness;
-      break;
-
-    case DIMMED:
-      currentMainBrightness = cfg.ledDimBrightness;
-      break;
-
-    case FADING_DOWN: {
-      unsigned long fadeElapsed = millis() - fadeStartMillis;
-      unsigned long fadeDurationMs = (unsigned long)cfg.ledDimFadeDuration * 1000;
-      currentMainBrightness = interpolateBrightness(cfg.ledBrightness, cfg.ledDimBrightness, fadeElapsed, fadeDurationMs);
-      break;
+  if (cfg.ledDimProfile.length() > 0) {
+    if (compileBrightnessProfile(cfg.ledDimProfile.c_str(), profile)) {
+      LOG_INFOF("Brightness profile compiled: %d keyframes", profile.count);
+      dimmingActive = true;
+      return;
     }
+    LOG_ERROR("Invalid brightness profile - using dim window");
+  }
 
-    case FADING_UP: {
-      unsigned long fadeElapsed = millis() - fadeStartMillis;
-      unsigned long fadeDurationMs = (unsigned long)cfg.ledDimFadeDuration * 1000;
-      currentMainBrightness = interpolateBrightness(cfg.ledDimBrightness, cfg.ledBrightness, fadeElapsed, fadeDurationMs);
-      break;
-    }
+  int startHours, startMinutes, endHours, endMinutes;
+  bool validStart = parseTime(cfg.ledDimStartTime.c_str(), startHours, startMinutes);
+  bool validEnd = parseTime(cfg.ledDimEndTime.c_str(), endHours, endMinutes);
+  if (!validStart || !validEnd) {
+    LOG_ERROR("Invalid dim time format - dimming disabled");
+    return;
   }
 
+  compileDimWindow(profile, cfg.ledBrightness, cfg.ledDimBrightness,
+                   startHours * 3600 + startMinutes * 60, endHours * 3600 + endMinutes * 60,
+                   cfg.ledDimFadeDuration);
+  dimmingActive = true;
+}
+
+// Second indicator follows the digits, offset by clockSecIndicatorDiff
+static void updateColonBrightness(const Config& cfg) {
   if (currentMainBrightness >= cfg.clockSecIndicatorDiff) {
     currentColonBrightness = currentMainBrightness - cfg.clockSecIndicatorDiff;
     if (currentColonBrightness < 10) {
@@ -190,79 +194,127 @@ void calculateBrightness(int currentSeconds, int dimStartSeconds, int dimEndSeco
   } else {
     currentColonBrightness = currentMainBrightness;
   }
+}
+
+void initBrightnessControl() {
+  Config& cfg = configManager.getConfig();
+  buildProfile();
+
+  if (ambientActive) {
+    LOG_INFOF("Ambient light brightness enabled (GPIO %d, every %d ms)", AMBIENT_LIGHT_PIN, AMBIENT_SAMPLE_INTERVAL_MS);
+  }
 
-  if (currentState == FADING_DOWN || currentState == FADING_UP) {
-    unsigned long fadeElapsed = millis() - fadeStartMillis;
-    unsigned long fadeDurationMs = (unsigned long)cfg.ledDimFadeDuration * 1000;
-
-    if (fadeElapsed >= fadeDurationMs) {
-      if (!fadeCompleteLogged) {
-        if (currentState == FADING_DOWN) {
-          LOG_DEBUG("Fade down complete - brightness reached target");
-        } else {
-          LOG_DEBUG("Fade up complete - brightness reached target");
-        }
-        fadeCompleteLogged = true;
-      }
-    } else {
-      if (currentSecond != lastLoggedSecond) {
-        if (currentState == FADING_DOWN) {
-          LOG_DEBUGF("Fading down: %d/%d (main: %d, colon: %d)", (int)(fadeElapsed/1000), cfg.ledDimFadeDuration, currentMainBrightness, currentColonBrightness);
-        } else {
-          LOG_DEBUGF("Fading up: %d/%d (main: %d, colon: %d)", (int)(fadeElapsed/1000), cfg.ledDimFadeDuration, currentMainBrightness, currentColonBrightness);
-        }
-        lastLoggedSecond = currentSecond;
-      }
+  if (!dimmingActive) {
+    currentMainBrightness = cfg.ledBrightness;
+    currentColonBrightness = cfg.ledBrightness;
+    if (!cfg.ledDimEnabled) {
+      LOG_INFO("Brightness dimming disabled");
     }
+    return;
+  }
+
+  if (!cfg.ledDimSolar && cfg.ledDimProfile.length() == 0) {
+    LOG_INFOF("Brightness dimming enabled: %s-%s (fade %ds)", cfg.ledDimStartTime.c_str(), cfg.ledDimEndTime.c_str(), cfg.ledDimFadeDuration);
   }
 }
 
-void updateBrightness(ESP32Time& rtc) {
+void invalidateBrightnessCache() {
+  profileValid = false;
+}
+
+void notifyBrightnessClockStep() {
+  // Brightness depends on the time of week only, just drop the memoized frame
+  memoFrame = -1;
+}
+
+bool updateBrightness() {
   Config& cfg = configManager.getConfig();
 
-  if (!cfg.ledDimEnabled) {
+  if (!profileValid) {
+    buildProfile();
+  }
+
+  if (ambientActive && ambientFilter.isReady()) {
+    // Sensor mode, capped by the configured maximum brightness
+    currentMainBrightness = ambientBrightness < cfg.ledBrightness ? ambientBrightness : cfg.ledBrightness;
+    updateColonBrightness(cfg);
+  } else if (!dimmingActive) {
     currentMainBrightness = cfg.ledBrightness;
     currentColonBrightness = cfg.ledBrightness;
-    static uint8_t lastSetBrightness = 255;
-    if (cfg.ledBrightness != lastSetBrightness) {
-      FastLED.setBrightness(cfg.ledBrightness);
-      lastSetBrightness = cfg.ledBrightness;
+  } else {
+    struct timeval now;
+    struct tm local;
+    gettimeofday(&now, nullptr);
+    localtime_r(&now.tv_sec, &local);
+    uint32_t msOfWeek = (local.tm_wday * SECONDS_PER_DAY + local.tm_hour * 3600 + local.tm_min * 60 + local.tm_sec) * 1000UL +
+                        now.tv_usec / 1000;
+    int32_t frame = msOfWeek / BRIGHTNESS_FRAME_MS;
+    if (frame == memoFrame) {
+      return false;
     }
-    return;
-  }
+    memoFrame = frame;
 
-  // Use cached time values if available, otherwise parse and cache
-  if (!timeCacheValid) {
-    int startHours, startMinutes, endHours, endMinutes;
-    bool validStart = parseTime(cfg.ledDimStartTime.c_str(), startHours, startMinutes);
-    bool validEnd = parseTime(cfg.ledDimEndTime.c_str(), endHours, endMinutes);
-    if (!validStart || !validEnd) {
-      currentMainBrightness = cfg.ledBrightness;
-      currentColonBrightness = cfg.ledBrightness;
-      static uint8_t lastSetBrightness2 = 255;
-      if (cfg.ledBrightness != lastSetBrightness2) {
-        FastLED.setBrightness(cfg.ledBrightness);
-        lastSetBrightness2 = cfg.ledBrightness;
-      }
-      return;
+    // Sun times move every day, recompute after local midnight
+    if (cfg.ledDimSolar && (local.tm_year + 1900) * 1000 + local.tm_yday != solarDay) {
+      buildProfile();
+      memoFrame = frame;
     }
-    cachedDimStartSeconds = startHours * 3600 + startMinutes * 60;
-    cachedDimEndSeconds = endHours * 3600 + endMinutes * 60;
-    timeCacheValid = true;
-  }
 
-  int currentSeconds = rtc.getHour(true) * 3600 + rtc.getMinute() * 60 + rtc.getSecond();
-  uint8_t currentSecond = rtc.getSecond();
+    uint8_t keyframe;
+    currentMainBrightness = evaluateBrightnessMs(profile, msOfWeek, &keyframe);
+    if (keyframe != currentKeyframe) {
+      LOG_DEBUGF("Brightness keyframe %d passed (main: %d)", keyframe, currentMainBrightness);
+      currentKeyframe = keyframe;
+    }
+    updateColonBrightness(cfg);
+  }
 
-  calculateBrightness(currentSeconds, cachedDimStartSeconds, cachedDimEndSeconds, currentSecond);
+  static uint8_t lastSetBrightness = 255;
+  if (currentMainBrightness == lastSetBrightness) {
+    return false;
+  }
+  FastLED.setBrightness(currentMainBrightness);
+  lastSetBrightness = currentMainBrightness;
+  return true;
+}
 
-  static uint8_t lastSetBrightness3 = 255;
-  if (currentMainBrightness != lastSetBrightness3) {
-    FastLED.setBrightness(currentMainBrightness);
-    lastSetBrightness3 = currentMainBrightness;
+void sampleAmbientLight() {
+  if (!ambientActive) {
+    return;
+  }
+  uint16_t raw;
+  if (!ambientSource->read(raw)) {
+    return;
+  }
+  ambientRaw = raw;
+  ambientSamples++;
+  if (!ambientFilter.add(raw)) {
+    return;
+  }
+  uint8_t brightness = evaluateAmbientCurve(ambientCurve, ambientFilter.level());
+  if (brightness != ambientBrightness) {
+    LOG_DEBUGF("Ambient light level %d -> brightness %d", ambientFilter.level(), brightness);
+    ambientBrightness = brightness;
+    ambientChanges++;
   }
 }
 
+void setAmbientSampleSource(AmbientSampleSource* source) {
+  ambientSource = (source != nullptr) ? source : &adcSource;
+  ambientFilter.reset();
+}
+
+AmbientLightStats getAmbientLightStats() {
+  AmbientLightStats stats;
+  stats.enabled = ambientActive;
+  stats.raw = ambientRaw;
+  stats.level = ambientFilter.level();
+  stats.brightness = ambientBrightness;
+  stats.samples = ambientSamples;
+  stats.changes = ambientChanges;
+  return stats;
+}
+
 uint8_t getCurrentMainBrightness() {
   return currentMainBrightness;
 }
@@ -270,3 +322,9 @@ uint8_t getCurrentMainBrightness() {
 uint8_t getCurrentColonBrightness() {
   return currentColonBrightness;
 }
+
+void restoreBrightnessState(uint8_t mainBrightness, uint8_t colonBrightness) {
+  // Shown until the first update, which derives the level from the time of day
+  currentMainBrightness = mainBrightness;
+  currentColonBrightness = colonBrightness;
+}
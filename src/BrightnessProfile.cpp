@@ -0,0 +1,355 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BrightnessProfile.h"
+#include <string.h>
+
+// Easing curves sampled at 33 points (x = i/32), Q16 scaled to 0-65535
+static const uint16_t EASE_IN_LUT[33] = {
+  0, 64, 256, 576, 1024, 1600, 2304, 3136, 4096, 5184, 6400, 7744, 9216, 10816, 12544, 14400,
+  16384, 18496, 20736, 23104, 25600, 28224, 30976, 33855, 36863, 39999, 43263, 46655, 50175, 53823, 57599, 61503,
+  65535
+};
+static const uint16_t EASE_OUT_LUT[33] = {
+  0, 4032, 7936, 11712, 15360, 18880, 22272, 25536, 28672, 31680, 34559, 37311, 39935, 42431, 44799, 47039,
+  49151, 51135, 52991, 54719, 56319, 57791, 59135, 60351, 61439, 62399, 63231, 63935, 64511, 64959, 65279, 65471,
+  65535
+};
+static const uint16_t EASE_IN_OUT_LUT[33] = {
+  0, 188, 736, 1620, 2816, 4300, 6048, 8036, 10240, 12636, 15200, 17908, 20736, 23660, 26656, 29700,
+  32768, 35835, 38879, 41875, 44799, 47627, 50335, 52899, 55295, 57499, 59487, 61235, 62719, 63915, 64799, 65347,
+  65535
+};
+
+// CIE L* (x = lightness 0-100%) to relative luminance, Q16 scaled to 0-65535
+static const uint16_t CIE_LSTAR_LUT[33] = {
+  0, 227, 453, 686, 972, 1328, 1762, 2281, 2894, 3607, 4429, 5367, 6429, 7623, 8956, 10436,
+  12071, 13868, 15835, 17980, 20310, 22833, 25558, 28490, 31639, 35012, 38616, 42460, 46550, 50895, 55503, 60380,
+  65535
+};
+
+// Piecewise linear lookup, x in Q16 (0-65536)
+static uint32_t lutLookup(const uint16_t* lut, uint32_t xQ16) {
+  if (xQ16 >= 0x10000) {
+    return 0x10000;
+  }
+  uint32_t index = xQ16 >> 11;
+  uint32_t frac = xQ16 & 0x7FF;
+  return lut[index] + (((uint32_t)(lut[index + 1] - lut[index]) * frac + 0x400) >> 11);
+}
+
+// Inverse of lutLookup for a strictly increasing table
+static uint32_t lutInverse(const uint16_t* lut, uint32_t yQ16) {
+  if (yQ16 >= lut[32]) {
+    return 0x10000;
+  }
+  uint8_t low = 0;
+  uint8_t high = 32;
+  while (high - low > 1) {
+    uint8_t mid = (low + high) / 2;
+    if (lut[mid] <= yQ16) {
+      low = mid;
+    } else {
+      high = mid;
+    }
+  }
+  uint32_t span = lut[high] - lut[low];
+  return ((uint32_t)low << 11) + (((yQ16 - lut[low]) << 11) + span / 2) / span;
+}
+
+// Map linear progress (Q16, 0-65536) through an easing curve
+static uint32_t ease(BrightnessEasing easing, uint32_t progressQ16) {
+  const uint16_t* lut;
+  switch (easing) {
+    case BrightnessEasing::Step:
+      return 0;
+    case BrightnessEasing::EaseIn:
+      lut = EASE_IN_LUT;
+      break;
+    case BrightnessEasing::EaseOut:
+      lut = EASE_OUT_LUT;
+      break;
+    case BrightnessEasing::EaseInOut:
+      lut = EASE_IN_OUT_LUT;
+      break;
+    default:
+      return progressQ16;
+  }
+  return lutLookup(lut, progressQ16);
+}
+
+// Linear step between two levels, progress in Q16 (0x10000 = 1.0), rounded
+static uint8_t interpolate(uint8_t from, uint8_t to, uint32_t progressQ16) {
+  if (to >= from) {
+    return from + (uint8_t)(((uint32_t)(to - from) * progressQ16 + 0x8000) >> 16);
+  }
+  return from - (uint8_t)(((uint32_t)(from - to) * progressQ16 + 0x8000) >> 16);
+}
+
+// Same as interpolate(), but in the perceptual space of a luminance table
+static uint8_t interpolateCurve(const uint16_t* lut, uint8_t from, uint8_t to, uint32_t progressQ16) {
+  int32_t start = (int32_t)lutInverse(lut, from * 257U);
+  int32_t end = (int32_t)lutInverse(lut, to * 257U);
+  int32_t x = start + (int32_t)(((int64_t)(end - start) * progressQ16 + 0x8000) >> 16);
+  return (uint8_t)((lutLookup(lut, (uint32_t)x) + 128) / 257);
+}
+
+static void sortKeyframes(BrightnessProfile& profile) {
+  for (uint8_t i = 1; i < profile.count; i++) {
+    BrightnessKeyframe key = profile.keyframes[i];
+    int16_t j = i - 1;
+    while (j >= 0 && profile.keyframes[j].secondOfWeek > key.secondOfWeek) {
+      profile.keyframes[j + 1] = profile.keyframes[j];
+      j--;
+    }
+    profile.keyframes[j + 1] = key;
+  }
+}
+
+static void addKeyframe(BrightnessProfile& profile, uint8_t weekday, uint32_t secondOfDay, uint8_t level, BrightnessEasing easing) {
+  BrightnessKeyframe& keyframe = profile.keyframes[profile.count++];
+  keyframe.secondOfWeek = (weekday * SECONDS_PER_DAY + secondOfDay) % SECONDS_PER_WEEK;
+  keyframe.level = level;
+  keyframe.easing = easing;
+}
+
+void compileDailyProfile(BrightnessProfile& profile, const uint32_t* secondsOfDay, const uint8_t* levels, uint8_t count) {
+  profile.count = 0;
+  if (count > BRIGHTNESS_KEYFRAMES_PER_DAY) {
+    count = BRIGHTNESS_KEYFRAMES_PER_DAY;
+  }
+  for (uint8_t day = 0; day < 7; day++) {
+    for (uint8_t i = 0; i < count; i++) {
+      addKeyframe(profile, day, secondsOfDay[i], levels[i], BrightnessEasing::Linear);
+    }
+  }
+  sortKeyframes(profile);
+}
+
+void compileDimWindow(BrightnessProfile& profile, uint8_t normalBrightness, uint8_t dimBrightness,
+                      uint32_t dimStartSeconds, uint32_t dimEndSeconds, uint16_t fadeSeconds) {
+  uint32_t fadeDownStart = (dimStartSeconds + SECONDS_PER_DAY - fadeSeconds % SECONDS_PER_DAY) % SECONDS_PER_DAY;
+  const uint32_t times[4] = {fadeDownStart, dimStartSeconds, dimEndSeconds, dimEndSeconds + fadeSeconds};
+  const uint8_t levels[4] = {normalBrightness, dimBrightness, dimBrightness, normalBrightness};
+  compileDailyProfile(profile, times, levels, 4);
+}
+
+// Parser helpers, all skip leading blanks
+static void skipBlanks(const char*& p) {
+  while (*p == ' ' || *p == '\t') {
+    p++;
+  }
+}
+
+static bool parseNumber(const char*& p, uint32_t& value, uint8_t maxDigits) {
+  uint8_t digits = 0;
+  value = 0;
+  while (*p >= '0' && *p <= '9' && digits < maxDigits) {
+    value = value * 10 + (*p++ - '0');
+    digits++;
+  }
+  return digits > 0;
+}
+
+static bool parseWeekday(const char*& p, uint8_t& weekday) {
+  static const char* const names[7] = {"su", "mo", "tu", "we", "th", "fr", "sa"};
+  char first = *p | 0x20;
+  char second = p[0] ? (p[1] | 0x20) : 0;
+  for (uint8_t i = 0; i < 7; i++) {
+    if (names[i][0] == first && names[i][1] == second) {
+      weekday = i;
+      p += 2;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Day list before ':' as bit mask (bit 0 = Sunday)
+static bool parseDays(const char*& p, uint8_t& mask) {
+  mask = 0;
+  for (;;) {
+    skipBlanks(p);
+    if (*p == '*') {
+      p++;
+      mask = 0x7F;
+    } else {
+      uint8_t from, to;
+      if (!parseWeekday(p, from)) {
+        return false;
+      }
+      to = from;
+      if (*p == '-') {
+        p++;
+        if (!parseWeekday(p, to)) {
+          return false;
+        }
+      }
+      for (uint8_t day = from;; day = (day + 1) % 7) {
+        mask |= 1 << day;
+        if (day == to) {
+          break;
+        }
+      }
+    }
+    skipBlanks(p);
+    if (*p != ',') {
+      break;
+    }
+    p++;
+  }
+  return *p++ == ':';
+}
+
+static bool parseEasing(const char*& p, BrightnessEasing& easing) {
+  switch (*p | 0x20) {
+    case 'l': easing = BrightnessEasing::Linear; break;
+    case 'i': easing = BrightnessEasing::EaseIn; break;
+    case 'o': easing = BrightnessEasing::EaseOut; break;
+    case 'e': easing = BrightnessEasing::EaseInOut; break;
+    case 's': easing = BrightnessEasing::Step; break;
+    default:
+      easing = BrightnessEasing::Linear;
+      return true;
+  }
+  p++;
+  return true;
+}
+
+bool compileBrightnessProfile(const char* text, BrightnessProfile& profile) {
+  // Keyframes per weekday, later groups replace earlier ones
+  struct DayFrame {
+    uint32_t secondOfDay;
+    uint8_t level;
+    BrightnessEasing easing;
+  };
+  DayFrame groupFrames[BRIGHTNESS_KEYFRAMES_PER_DAY];
+  DayFrame days[7][BRIGHTNESS_KEYFRAMES_PER_DAY];
+  uint8_t dayCounts[7] = {0};
+
+  profile.count = 0;
+  const char* p = text;
+  skipBlanks(p);
+  while (*p != '\0') {
+    uint8_t mask;
+    if (!parseDays(p, mask)) {
+      return false;
+    }
+
+    uint8_t groupCount = 0;
+    skipBlanks(p);
+    while (*p != '\0' && *p != ';') {
+      uint32_t hours, minutes, level;
+      BrightnessEasing easing;
+      if (!parseNumber(p, hours, 2) || *p++ != ':' || !parseNumber(p, minutes, 2) || *p++ != '=' ||
+          !parseNumber(p, level, 3) || !parseEasing(p, easing)) {
+        return false;
+      }
+      if (hours > 23 || minutes > 59 || level > 255 || groupCount >= BRIGHTNESS_KEYFRAMES_PER_DAY) {
+        return false;
+      }
+      if (*p != ' ' && *p != '\t' && *p != ';' && *p != '\0') {
+        return false;
+      }
+      uint32_t secondOfDay = hours * 3600 + minutes * 60;
+      for (uint8_t i = 0; i < groupCount; i++) {
+        if (groupFrames[i].secondOfDay == secondOfDay) {
+          // Two levels at one time: the sort would pick either
+          return false;
+        }
+      }
+      groupFrames[groupCount].secondOfDay = secondOfDay;
+      groupFrames[groupCount].level = level;
+      groupFrames[groupCount].easing = easing;
+      groupCount++;
+      skipBlanks(p);
+    }
+    if (groupCount == 0) {
+      return false;
+    }
+    for (uint8_t day = 0; day < 7; day++) {
+      if (mask & (1 << day)) {
+        memcpy(days[day], groupFrames, groupCount * sizeof(DayFrame));
+        dayCounts[day] = groupCount;
+      }
+    }
+
+    if (*p == ';') {
+      p++;
+      skipBlanks(p);
+    }
+  }
+
+  for (uint8_t day = 0; day < 7; day++) {
+    for (uint8_t i = 0; i < dayCounts[day]; i++) {
+      addKeyframe(profile, day, days[day][i].secondOfDay, days[day][i].level, days[day][i].easing);
+    }
+  }
+  sortKeyframes(profile);
+  return profile.count > 0;
+}
+
+uint8_t evaluateBrightness(const BrightnessProfile& profile, uint32_t secondOfWeek, uint8_t* keyframe) {
+  return evaluateBrightnessMs(profile, (secondOfWeek % SECONDS_PER_WEEK) * 1000UL, keyframe);
+}
+
+uint8_t evaluateBrightnessMs(const BrightnessProfile& profile, uint32_t msOfWeek, uint8_t* keyframe) {
+  if (profile.count == 0) {
+    return 255;
+  }
+  msOfWeek %= SECONDS_PER_WEEK * 1000UL;
+  uint32_t now = msOfWeek / 1000;
+
+  // Last keyframe at or before now, wrapping to the last one of the week
+  uint8_t low = 0;
+  uint8_t high = profile.count;
+  while (low < high) {
+    uint8_t mid = (low + high) / 2;
+    if (profile.keyframes[mid].secondOfWeek <= now) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  uint8_t current = (low == 0) ? profile.count - 1 : low - 1;
+  uint8_t next = (current + 1) % profile.count;
+  if (keyframe != nullptr) {
+    *keyframe = current;
+  }
+
+  const BrightnessKeyframe& from = profile.keyframes[current];
+  const BrightnessKeyframe& to = profile.keyframes[next];
+  uint32_t span = (to.secondOfWeek + SECONDS_PER_WEEK - from.secondOfWeek) % SECONDS_PER_WEEK;
+  if (span == 0) {
+    return from.level;
+  }
+  uint32_t elapsedMs = ((now + SECONDS_PER_WEEK - from.secondOfWeek) % SECONDS_PER_WEEK) * 1000UL + msOfWeek % 1000;
+  uint32_t progressQ16 = (uint32_t)(((uint64_t)elapsedMs << 16) / (span * 1000ULL));
+  uint32_t eased = ease(to.easing, progressQ16);
+  switch (profile.curve) {
+    case BrightnessCurve::Quadratic:
+      // x^2 doubles as the gamma 2 luminance table
+      return interpolateCurve(EASE_IN_LUT, from.level, to.level, eased);
+    case BrightnessCurve::Perceptual:
+      return interpolateCurve(CIE_LSTAR_LUT, from.level, to.level, eased);
+    default:
+      return interpolate(from.level, to.level, eased);
+  }
+}
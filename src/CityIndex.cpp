@@ -0,0 +1,156 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CityIndex.h"
+#include "city_table.h"
+#include <string.h>
+
+// Table layout, see scripts/gen_city_table.py
+static const uint8_t HEADER_SIZE = 16;
+static const uint8_t CITY_RECORD_SIZE = 12;
+static const uint8_t COUNTRY_RECORD_SIZE = 6;
+static const uint8_t ZONE_RECORD_SIZE = 4;
+static const uint8_t MAX_PREFIX_LENGTH = 48;
+
+// Little endian fields, read byte by byte (records are not aligned)
+static uint16_t readU16(const uint8_t* p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t readU32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static char foldChar(char c) {
+  if (c >= 'A' && c <= 'Z') {
+    return (char)(c - 'A' + 'a');
+  }
+  return c == '_' ? ' ' : c;
+}
+
+CityIndex::CityIndex(const uint8_t* table)
+  : table(table), cityCount(0), countryCount(0), zoneCount(0),
+    cities(nullptr), countries(nullptr), zones(nullptr), pool(nullptr) {
+  if (table == nullptr || memcmp(table, "CTY1", 4) != 0) {
+    return;
+  }
+  cityCount = readU16(table + 4);
+  countryCount = readU16(table + 6);
+  zoneCount = readU16(table + 8);
+  cities = table + HEADER_SIZE;
+  countries = cities + (uint32_t)cityCount * CITY_RECORD_SIZE;
+  zones = countries + (uint32_t)countryCount * COUNTRY_RECORD_SIZE;
+  pool = (const char*)table + readU32(table + 12);
+}
+
+// Compares the start of a city name with a folded prefix (<0: name sorts before)
+int CityIndex::compareName(uint16_t index, const char* prefix, uint8_t prefixLength) const {
+  const char* name = pool + readU32(cities + (uint32_t)index * CITY_RECORD_SIZE);
+  for (uint8_t i = 0; i < prefixLength; i++) {
+    char c = foldChar(name[i]);
+    if (c != prefix[i]) {
+      return (uint8_t)c < (uint8_t)prefix[i] ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+uint8_t CityIndex::rankOf(uint16_t index) const {
+  return cities[(uint32_t)index * CITY_RECORD_SIZE + 9];
+}
+
+uint8_t CityIndex::search(const char* prefix, City* results, uint8_t maxResults) const {
+  if (cityCount == 0 || prefix == nullptr || maxResults == 0) {
+    return 0;
+  }
+
+  // Fold the prefix the same way names are compared, skip leading blanks
+  char folded[MAX_PREFIX_LENGTH];
+  uint8_t length = 0;
+  while (*prefix == ' ') {
+    prefix++;
+  }
+  while (*prefix != '\0' && length < MAX_PREFIX_LENGTH) {
+    folded[length++] = foldChar(*prefix++);
+  }
+  if (length == 0) {
+    return 0;
+  }
+
+  // First name not sorting before the prefix
+  uint16_t low = 0;
+  uint16_t high = cityCount;
+  while (low < high) {
+    uint16_t middle = low + (high - low) / 2;
+    if (compareName(middle, folded, length) < 0) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+
+  // Keep the largest matches; names are scanned in order, so ties stay alphabetical
+  uint16_t best[UINT8_MAX];
+  uint8_t found = 0;
+  for (uint16_t i = low; i < cityCount && compareName(i, folded, length) == 0; i++) {
+    uint8_t rank = rankOf(i);
+    if (found == maxResults && rank <= rankOf(best[found - 1])) {
+      continue;
+    }
+    uint8_t slot = found < maxResults ? found++ : found - 1;
+    while (slot > 0 && rankOf(best[slot - 1]) < rank) {
+      best[slot] = best[slot - 1];
+      slot--;
+    }
+    best[slot] = i;
+  }
+
+  for (uint8_t i = 0; i < found; i++) {
+    getCity(best[i], results[i]);
+  }
+  return found;
+}
+
+bool CityIndex::getCity(uint16_t index, City& city) const {
+  if (index >= cityCount) {
+    return false;
+  }
+  const uint8_t* record = cities + (uint32_t)index * CITY_RECORD_SIZE;
+  city.name = pool + readU32(record);
+  city.latitude = (int16_t)readU16(record + 4) / 100.0f;
+  city.longitude = (int16_t)readU16(record + 6) / 100.0f;
+  city.rank = record[9];
+
+  uint8_t countryIndex = record[8];
+  const uint8_t* country = countries + (uint32_t)countryIndex * COUNTRY_RECORD_SIZE;
+  city.country[0] = (char)country[0];
+  city.country[1] = (char)country[1];
+  city.country[2] = '\0';
+  city.countryName = pool + readU32(country + 2);
+
+  uint16_t zoneIndex = readU16(record + 10);
+  city.timezone = zoneIndex < zoneCount ? pool + readU32(zones + (uint32_t)zoneIndex * ZONE_RECORD_SIZE) : "";
+  return true;
+}
+
+const CityIndex& getCityIndex() {
+  static const CityIndex index(CITY_TABLE);
+  return index;
+}
@@ -0,0 +1,222 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ClockDiscipline.h"
+#include "config.h"
+#include "Logger.h"
+#include <esp_sntp.h>
+#include <esp_timer.h>
+#include <sys/time.h>
+
+// Global instance
+ClockDiscipline clockDiscipline;
+
+// Offsets below this are within NTP jitter and not worth a slew
+static const int64_t CLOCK_NOISE_US = 2000;
+
+// Protects the step hand-over between the SNTP task and loop()
+static portMUX_TYPE stepMux = portMUX_INITIALIZER_UNLOCKED;
+
+static inline int64_t toMicros(const struct timeval& tv) {
+  return (int64_t)tv.tv_sec * 1000000LL + tv.tv_usec;
+}
+
+static inline struct timeval fromMicros(int64_t us) {
+  struct timeval tv;
+  tv.tv_sec = us / 1000000LL;
+  tv.tv_usec = us % 1000000LL;
+  return tv;
+}
+
+ClockDiscipline::ClockDiscipline()
+    : driftPpm(0.0f),
+      lastOffsetUs(0),
+      lastSampleLocalUs(0),
+      samples(0),
+      driftSamples(0),
+      slews(0),
+      steps(0),
+      syncIntervalMs(NTP_SYNC_INTERVAL_MIN_MS),
+      appliedSyncIntervalMs(0),
+      lastCompensationUs(0),
+      compensationRemainderUs(0.0),
+      pendingStepUs(0),
+      stepPending(false),
+      stepCallback(nullptr) {
+}
+
+ClockDiscipline::Action ClockDiscipline::addSample(int64_t referenceUs, int64_t localUs) {
+  int64_t offsetUs = referenceUs - localUs;
+  int64_t absOffsetUs = offsetUs < 0 ? -offsetUs : offsetUs;
+  samples++;
+  lastOffsetUs = offsetUs;
+
+  // Large error (first sync, long outage): step and restart the learning interval
+  if (absOffsetUs >= CLOCK_SLEW_THRESHOLD_US) {
+    steps++;
+    lastSampleLocalUs = referenceUs;
+    syncIntervalMs = NTP_SYNC_INTERVAL_MIN_MS;
+    return Action::Step;
+  }
+
+  // The offset accumulated since the previous correction is the residual
+  // frequency error not yet covered by driftPpm
+  if (lastSampleLocalUs != 0) {
+    int64_t intervalUs = localUs - lastSampleLocalUs;
+    if (intervalUs >= (int64_t)CLOCK_MIN_SAMPLE_INTERVAL_MS * 1000LL) {
+      float residualPpm = (float)offsetUs * 1000000.0f / (float)intervalUs;
+      float gain = (driftSamples == 0) ? 1.0f : 0.3f;
+      driftPpm += gain * residualPpm;
+      if (driftPpm > CLOCK_MAX_DRIFT_PPM) {
+        driftPpm = CLOCK_MAX_DRIFT_PPM;
+      } else if (driftPpm < -CLOCK_MAX_DRIFT_PPM) {
+        driftPpm = -CLOCK_MAX_DRIFT_PPM;
+      }
+      driftSamples++;
+    }
+  }
+  lastSampleLocalUs = referenceUs;
+
+  // Stretch the poll interval while the estimate holds, fall back when it doesn't
+  if (absOffsetUs < CLOCK_STABLE_OFFSET_US && driftSamples >= 2) {
+    uint32_t next = syncIntervalMs * 2;
+    syncIntervalMs = next > NTP_SYNC_INTERVAL_MAX_MS ? NTP_SYNC_INTERVAL_MAX_MS : next;
+  } else if (absOffsetUs >= CLOCK_STABLE_OFFSET_US * 4) {
+    syncIntervalMs = NTP_SYNC_INTERVAL_MIN_MS;
+  }
+
+  if (absOffsetUs < CLOCK_NOISE_US) {
+    return Action::None;
+  }
+  slews++;
+  return Action::Slew;
+}
+
+int64_t ClockDiscipline::driftCorrectionUs(int64_t elapsedUs) const {
+  return (int64_t)((double)driftPpm * (double)elapsedUs / 1000000.0);
+}
+
+void ClockDiscipline::begin() {
+  sntp_set_sync_interval(syncIntervalMs);
+  appliedSyncIntervalMs = syncIntervalMs;
+  lastCompensationUs = esp_timer_get_time();
+}
+
+void ClockDiscipline::handleReference(int64_t referenceUs) {
+  struct timeval now;
+  struct timeval outstanding = {0, 0};
+  gettimeofday(&now, nullptr);
+  adjtime(nullptr, &outstanding);
+  int64_t nowUs = toMicros(now);
+
+  Action action = addSample(referenceUs, nowUs + toMicros(outstanding));
+
+  switch (action) {
+    case Action::Slew: {
+      // Replaces any pending adjustment with the full remaining offset
+      struct timeval delta = fromMicros(referenceUs - nowUs);
+      if (adjtime(&delta, nullptr) == 0) {
+        LOG_INFOF("NTP offset %lld us slewed (drift %.2f ppm)", (long long)lastOffsetUs, driftPpm);
+        break;
+      }
+      // adjtime() rejects very large deltas, step instead
+      slews--;
+      steps++;
+    }
+      // fall through
+    case Action::Step: {
+      struct timeval tv = fromMicros(referenceUs);
+      settimeofday(&tv, nullptr);
+      portENTER_CRITICAL(&stepMux);
+      pendingStepUs = referenceUs - nowUs;
+      stepPending = true;
+      portEXIT_CRITICAL(&stepMux);
+      LOG_WARNF("NTP offset %lld us too large - clock stepped", (long long)(referenceUs - nowUs));
+      break;
+    }
+    case Action::None:
+      LOG_DEBUGF("NTP offset %lld us within noise (drift %.2f ppm)", (long long)lastOffsetUs, driftPpm);
+      break;
+  }
+}
+
+void ClockDiscipline::loop() {
+  // Dispatch step events in loop context so consumers need no locking
+  if (stepPending) {
+    int64_t stepUs;
+    portENTER_CRITICAL(&stepMux);
+    stepUs = pendingStepUs;
+    stepPending = false;
+    portEXIT_CRITICAL(&stepMux);
+    if (stepCallback != nullptr) {
+      stepCallback(stepUs);
+    }
+  }
+
+  // Continuous frequency compensation, added on top of any pending slew
+  int64_t nowUs = esp_timer_get_time();
+  int64_t elapsedUs = nowUs - lastCompensationUs;
+  if (elapsedUs >= (int64_t)CLOCK_DRIFT_APPLY_INTERVAL_MS * 1000LL) {
+    lastCompensationUs = nowUs;
+    if (driftSamples > 0) {
+      double correction = (double)driftPpm * (double)elapsedUs / 1000000.0 + compensationRemainderUs;
+      int64_t wholeUs = (int64_t)correction;
+      compensationRemainderUs = correction - (double)wholeUs;
+      if (wholeUs != 0) {
+        struct timeval outstanding = {0, 0};
+        adjtime(nullptr, &outstanding);
+        struct timeval delta = fromMicros(toMicros(outstanding) + wholeUs);
+        adjtime(&delta, nullptr);
+      }
+    }
+  }
+
+  if (syncIntervalMs != appliedSyncIntervalMs) {
+    sntp_set_sync_interval(syncIntervalMs);
+    appliedSyncIntervalMs = syncIntervalMs;
+    LOG_INFOF("NTP sync interval set to %lu min", (unsigned long)(syncIntervalMs / 60000));
+  }
+}
+
+void ClockDiscipline::onStep(StepCallback callback) {
+  stepCallback = callback;
+}
+
+void ClockDiscipline::requestSync() {
+  sntp_restart();
+}
+
+ClockDiscipline::Stats ClockDiscipline::getStats() const {
+  Stats stats;
+  stats.driftPpm = driftPpm;
+  stats.lastOffsetUs = lastOffsetUs;
+  stats.samples = samples;
+  stats.slews = slews;
+  stats.steps = steps;
+  stats.syncIntervalMs = syncIntervalMs;
+  return stats;
+}
+
+// Replaces the weak ESP-IDF implementation, which always steps the clock
+// (SNTP_SYNC_MODE_IMMED) and would undo the drift compensation
+extern "C" void sntp_sync_time(struct timeval* tv) {
+  clockDiscipline.handleReference(toMicros(*tv));
+  sntp_set_sync_status(SNTP_SYNC_STATUS_COMPLETED);
+}
@@ -25,6 +25,7 @@
 #include "LED_Clock.h"
 #include "BrightnessControl.h"
 #include "CronHelper.h"
+#include "WeatherLocations.h"
 #include <LittleFS.h>
 #include <ArduinoJson.h>
 #include <esp_task_wdt.h>
@@ -42,6 +43,11 @@ bool ConfigManager::begin() {
 
   LOG_INFO("Initializing LittleFS...");
 
+  if (FORMAT_FILESYSTEM) {
+    LOG_WARN("Formatting filesystem...");
+    LittleFS.format();
+  }
+
   if (!LittleFS.begin(true)) {  // true = format on failure
     LOG_ERROR("Failed to mount LittleFS");
     return false;
@@ -78,13 +84,16 @@ void ConfigManager::loadDefaults() {
   // Weather
   config.locationLatitude = locationLatitude;
   config.locationLongitude = locationLongitude;
+  config.locationAutoTimezone = locationAutoTimezone;
   config.locationUnits = locationUnits;
   config.weatherTempEnabled = weatherTempEnabled;
   config.weatherTempDisplayTime = weatherTempDisplayTime;
   config.weatherTempMin = weatherTempMin;
   config.weatherTempMax = weatherTempMax;
   config.weatherTempSchedule = weatherTempSchedule;
+  config.weatherLocations = weatherLocations;
   config.weatherUpdateSchedule = weatherUpdateSchedule;
+  config.weatherUpdateSkew = weatherUpdateSkew;
 
   // FastLED
   config.ledBrightness = ledBrightness;
@@ -93,6 +102,11 @@ void ConfigManager::loadDefaults() {
   config.ledDimFadeDuration = ledDimFadeDuration;
   config.ledDimStartTime = ledDimStartTime;
   config.ledDimEndTime = ledDimEndTime;
+  config.ledDimProfile = ledDimProfile;
+  config.ledDimSolar = ledDimSolar;
+  config.ledFadeCurve = ledFadeCurve;
+  config.ledAmbientEnabled = ledAmbientEnabled;
+  config.ledAmbientCurve = ledAmbientCurve;
 
   // Clock Update
   config.clockUpdateSchedule = clockUpdateSchedule;
@@ -150,13 +164,16 @@ bool ConfigManager::loadConfig() {
   // Weather
   config.locationLatitude = doc["locationLatitude"] | "";
   config.locationLongitude = doc["locationLongitude"] | "";
+  config.locationAutoTimezone = doc["locationAutoTimezone"] | 0;
   config.locationUnits = doc["locationUnits"] | "metric";
   config.weatherTempEnabled = doc["weatherTempEnabled"] | 1;
   config.weatherTempDisplayTime = doc["weatherTempDisplayTime"] | 5;
   config.weatherTempMin = doc["weatherTempMin"] | -40;
   config.weatherTempMax = doc["weatherTempMax"] | 50;
   config.weatherTempSchedule = doc["weatherTempSchedule"] | "30 * * * * *";
+  config.weatherLocations = doc["weatherLocations"] | "";
   config.weatherUpdateSchedule = doc["weatherUpdateSchedule"] | "0 5 * * * *";
+  config.weatherUpdateSkew = doc["weatherUpdateSkew"] | 120;
 
   // FastLED
   config.ledBrightness = doc["ledBrightness"] | 128;
@@ -165,6 +182,11 @@ bool ConfigManager::loadConfig() {
   config.ledDimFadeDuration = doc["ledDimFadeDuration"] | 30;
   config.ledDimStartTime = doc["ledDimStartTime"] | "22:00";
   config.ledDimEndTime = doc["ledDimEndTime"] | "06:00";
+  config.ledDimProfile = doc["ledDimProfile"] | "";
+  config.ledDimSolar = doc["ledDimSolar"] | 0;
+  config.ledFadeCurve = doc["ledFadeCurve"] | 2;
+  config.ledAmbientEnabled = doc["ledAmbientEnabled"] | 0;
+  config.ledAmbientCurve = doc["ledAmbientCurve"] | "0=10 300=60 1500=160 3500=255";
 
   // Clock Update
   config.clockUpdateSchedule = doc["clockUpdateSchedule"] | "* * * * * *";
@@ -202,13 +224,16 @@ bool ConfigManager::saveConfig() {
   // Weather
   doc["locationLatitude"] = config.locationLatitude;
   doc["locationLongitude"] = config.locationLongitude;
+  doc["locationAutoTimezone"] = config.locationAutoTimezone;
   doc["locationUnits"] = config.locationUnits;
   doc["weatherTempEnabled"] = config.weatherTempEnabled;
   doc["weatherTempDisplayTime"] = config.weatherTempDisplayTime;
   doc["weatherTempMin"] = config.weatherTempMin;
   doc["weatherTempMax"] = config.weatherTempMax;
   doc["weatherTempSchedule"] = config.weatherTempSchedule;
+  doc["weatherLocations"] = config.weatherLocations;
   doc["weatherUpdateSchedule"] = config.weatherUpdateSchedule;
+  doc["weatherUpdateSkew"] = config.weatherUpdateSkew;
 
   // FastLED
   doc["ledBrightness"] = config.ledBrightness;
@@ -217,6 +242,11 @@ bool ConfigManager::saveConfig() {
   doc["ledDimFadeDuration"] = config.ledDimFadeDuration;
   doc["ledDimStartTime"] = config.ledDimStartTime;
   doc["ledDimEndTime"] = config.ledDimEndTime;
+  doc["ledDimProfile"] = config.ledDimProfile;
+  doc["ledDimSolar"] = config.ledDimSolar;
+  doc["ledFadeCurve"] = config.ledFadeCurve;
+  doc["ledAmbientEnabled"] = config.ledAmbientEnabled;
+  doc["ledAmbientCurve"] = config.ledAmbientCurve;
 
   // Clock Update
   doc["clockUpdateSchedule"] = config.clockUpdateSchedule;
@@ -288,6 +318,22 @@ bool ConfigManager::validateConfig() {
     config.ledDimEnabled = 1;
     valid = false;
   }
+  if (config.ledDimSolar > 1) {
+    config.ledDimSolar = 0;
+    valid = false;
+  }
+  if (config.locationAutoTimezone > 1) {
+    config.locationAutoTimezone = 0;
+    valid = false;
+  }
+  if (config.ledFadeCurve > 2) {
+    config.ledFadeCurve = 2;
+    valid = false;
+  }
+  if (config.ledAmbientEnabled > 1) {
+    config.ledAmbientEnabled = 0;
+    valid = false;
+  }
   if (config.weatherTempEnabled > 1) {
     config.weatherTempEnabled = 1;
     valid = false;
@@ -304,6 +350,12 @@ bool ConfigManager::validateConfig() {
     config.weatherTempMax = 50;
     valid = false;
   }
+  if (config.weatherLocations.length() > WEATHER_LOCATIONS_MAX_LEN) {
+    LOG_WARN("weatherLocations too long, clearing");
+    config.weatherLocations = "";
+    valid = false;
+  }
+
   if (config.weatherTempMin >= config.weatherTempMax) {
     LOG_WARN("weatherTempMin >= weatherTempMax, resetting to defaults");
     config.weatherTempMin = -40;
@@ -318,6 +370,13 @@ bool ConfigManager::validateConfig() {
     valid = false;
   }
 
+  // Validate update skew (0-600 seconds)
+  if (config.weatherUpdateSkew > 600) {
+    LOG_WARNF("Invalid weatherUpdateSkew: %d, resetting to 120", config.weatherUpdateSkew);
+    config.weatherUpdateSkew = 120;
+    valid = false;
+  }
+
   // Validate fade duration (1-60 seconds)
   if (config.ledDimFadeDuration < 1 || config.ledDimFadeDuration > 60) {
     LOG_WARNF("Invalid ledDimFadeDuration: %d, resetting to 10", config.ledDimFadeDuration);
@@ -337,6 +396,18 @@ bool ConfigManager::validateConfig() {
     valid = false;
   }
 
+  // Validate brightness profile (an invalid profile falls back to the dim window)
+  if (config.ledDimProfile.length() > BRIGHTNESS_PROFILE_MAX_LEN) {
+    LOG_WARN("ledDimProfile too long, clearing");
+    config.ledDimProfile = "";
+    valid = false;
+  }
+  if (config.ledAmbientCurve.length() == 0 || config.ledAmbientCurve.length() > AMBIENT_CURVE_MAX_LEN) {
+    LOG_WARN("Invalid ledAmbientCurve, resetting to default");
+    config.ledAmbientCurve = "0=10 300=60 1500=160 3500=255";
+    valid = false;
+  }
+
   // Validate units (metric/imperial)
   if (config.locationUnits != "metric" && config.locationUnits != "imperial") {
     LOG_WARNF("Invalid locationUnits: %s, resetting to metric", config.locationUnits.c_str());
@@ -357,8 +428,8 @@ Config& ConfigManager::getConfig() {
   return config;
 }
 
-String ConfigManager::getSchema() {
-  return String(FPSTR(SCHEMA_JSON));
+const char* ConfigManager::getSchema() {
+  return SCHEMA_JSON;
 }
 
 CRGBPalette16 ConfigManager::getPaletteByIndex(uint8_t index) {
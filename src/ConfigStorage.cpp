@@ -70,3 +70,131 @@ bool saveClockConfig(const ClockConfig& config) {
   LOG_DEBUG("Config saved successfully");
   return true;
 }
+
+bool loadWiFiFastConnect(WiFiFastConnect& fastConnect) {
+  File file = LittleFS.open(WIFI_FAST_CONNECT_FILE, "r");
+  if (!file) {
+    LOG_DEBUG("WiFi fast connect file not found");
+    return false;
+  }
+  memset(&fastConnect, 0, sizeof(WiFiFastConnect));
+  size_t bytesRead = file.readBytes((char*)&fastConnect, sizeof(WiFiFastConnect));
+  file.close();
+  if (bytesRead != sizeof(WiFiFastConnect)) {
+    LOG_WARN("WiFi fast connect file size mismatch");
+    return false;
+  }
+  uint16_t calculatedChecksum = calcChecksum((uint8_t*)&fastConnect, sizeof(WiFiFastConnect) - sizeof(fastConnect.checksum));
+  if (fastConnect.checksum != calculatedChecksum) {
+    LOG_ERROR("WiFi fast connect checksum mismatch");
+    return false;
+  }
+  return true;
+}
+
+bool saveWiFiFastConnect(const WiFiFastConnect& fastConnect) {
+  WiFiFastConnect temp = fastConnect;
+  temp.checksum = calcChecksum((uint8_t*)&temp, sizeof(WiFiFastConnect) - sizeof(temp.checksum));
+  File file = LittleFS.open(WIFI_FAST_CONNECT_FILE, "w");
+  if (!file) {
+    LOG_ERROR("Failed to open WiFi fast connect file for writing");
+    return false;
+  }
+  size_t bytesWritten = file.write((uint8_t*)&temp, sizeof(WiFiFastConnect));
+  file.close();
+  if (bytesWritten != sizeof(WiFiFastConnect)) {
+    LOG_ERROR("Failed to write WiFi fast connect data");
+    return false;
+  }
+  LOG_DEBUG("WiFi fast connect data saved");
+  return true;
+}
+
+bool loadWiFiCredentials(WiFiCredentialList& list) {
+  File file = LittleFS.open(WIFI_NETWORKS_FILE, "r");
+  if (!file) {
+    LOG_DEBUG("WiFi networks file not found");
+    return false;
+  }
+  memset(&list, 0, sizeof(WiFiCredentialList));
+  size_t bytesRead = file.readBytes((char*)&list, sizeof(WiFiCredentialList));
+  file.close();
+  if (bytesRead != sizeof(WiFiCredentialList)) {
+    LOG_WARN("WiFi networks file size mismatch");
+    return false;
+  }
+  uint16_t calculatedChecksum = calcChecksum((uint8_t*)&list, sizeof(WiFiCredentialList) - sizeof(list.checksum));
+  if (list.checksum != calculatedChecksum || list.count > NUM_WIFI_CREDENTIALS) {
+    LOG_ERROR("WiFi networks checksum mismatch");
+    return false;
+  }
+  return true;
+}
+
+bool saveWiFiCredentials(const WiFiCredentialList& list) {
+  WiFiCredentialList temp = list;
+  temp.checksum = calcChecksum((uint8_t*)&temp, sizeof(WiFiCredentialList) - sizeof(temp.checksum));
+  File file = LittleFS.open(WIFI_NETWORKS_FILE, "w");
+  if (!file) {
+    LOG_ERROR("Failed to open WiFi networks file for writing");
+    return false;
+  }
+  size_t bytesWritten = file.write((uint8_t*)&temp, sizeof(WiFiCredentialList));
+  file.close();
+  if (bytesWritten != sizeof(WiFiCredentialList)) {
+    LOG_ERROR("Failed to write WiFi networks");
+    return false;
+  }
+  LOG_DEBUG("WiFi networks saved");
+  return true;
+}
+
+bool loadForecastCache(ForecastCache* caches, uint8_t maxCount) {
+  File file = LittleFS.open(FORECAST_CACHE_FILE, "r");
+  if (!file) {
+    LOG_DEBUG("Forecast cache file not found");
+    return false;
+  }
+  StoredForecast stored;
+  memset(&stored, 0, sizeof(StoredForecast));
+  size_t bytesRead = file.readBytes((char*)&stored, sizeof(StoredForecast));
+  file.close();
+  if (bytesRead != sizeof(StoredForecast)) {
+    LOG_WARN("Forecast cache file size mismatch");
+    return false;
+  }
+  uint16_t calculatedChecksum = calcChecksum((uint8_t*)&stored, sizeof(StoredForecast) - sizeof(stored.checksum));
+  if (stored.checksum != calculatedChecksum || stored.count > WEATHER_MAX_LOCATIONS) {
+    LOG_ERROR("Forecast cache checksum mismatch");
+    return false;
+  }
+  for (uint8_t i = 0; i < stored.count && i < maxCount; i++) {
+    if (stored.caches[i].count <= FORECAST_MAX_POINTS && stored.caches[i].head < FORECAST_MAX_POINTS) {
+      caches[i] = stored.caches[i];
+    }
+  }
+  return true;
+}
+
+bool saveForecastCache(const ForecastCache* caches, uint8_t count) {
+  StoredForecast stored;
+  memset(&stored, 0, sizeof(StoredForecast));
+  stored.count = count > WEATHER_MAX_LOCATIONS ? WEATHER_MAX_LOCATIONS : count;
+  for (uint8_t i = 0; i < stored.count; i++) {
+    stored.caches[i] = caches[i];
+  }
+  stored.checksum = calcChecksum((uint8_t*)&stored, sizeof(StoredForecast) - sizeof(stored.checksum));
+  File file = LittleFS.open(FORECAST_CACHE_FILE, "w");
+  if (!file) {
+    LOG_ERROR("Failed to open forecast cache file for writing");
+    return false;
+  }
+  size_t bytesWritten = file.write((uint8_t*)&stored, sizeof(StoredForecast));
+  file.close();
+  if (bytesWritten != sizeof(StoredForecast)) {
+    LOG_ERROR("Failed to write forecast cache");
+    return false;
+  }
+  LOG_DEBUG("Forecast cache saved");
+  return true;
+}
@@ -0,0 +1,165 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DnsCache.h"
+#include <string.h>
+
+// Wrap-safe "a is before b" for millis() timestamps
+static inline bool before(uint32_t a, uint32_t b) {
+  return (int32_t)(a - b) < 0;
+}
+
+static inline bool cacheable(const char* name) {
+  return name != nullptr && strlen(name) < DNS_CACHE_NAME_LEN;
+}
+
+DnsCache::DnsCache(const Timing& timing)
+    : timing(timing),
+      entries(),
+      entryCount(0),
+      stats(),
+      latency() {
+}
+
+DnsCache::Entry* DnsCache::find(const char* name) {
+  if (!cacheable(name)) {
+    return nullptr;
+  }
+  for (uint8_t i = 0; i < entryCount; i++) {
+    if (strcmp(entries[i].name, name) == 0) {
+      return &entries[i];
+    }
+  }
+  return nullptr;
+}
+
+const DnsCache::Entry* DnsCache::find(const char* name) const {
+  return const_cast<DnsCache*>(this)->find(name);
+}
+
+DnsCache::Entry* DnsCache::findOrAdd(const char* name, uint32_t nowMs) {
+  if (!cacheable(name)) {
+    return nullptr;
+  }
+  Entry* entry = find(name);
+  if (entry == nullptr) {
+    if (entryCount < DNS_CACHE_SIZE) {
+      entry = &entries[entryCount++];
+    } else {
+      // Replace the name that was used least recently
+      entry = &entries[0];
+      for (uint8_t i = 1; i < entryCount; i++) {
+        if (before(entries[i].lastUsedMs, entry->lastUsedMs)) {
+          entry = &entries[i];
+        }
+      }
+    }
+    strcpy(entry->name, name);
+    entry->address = 0;
+    entry->resolvedMs = nowMs;
+    entry->storedMs = nowMs;
+    entry->negative = false;
+  }
+  entry->lastUsedMs = nowMs;
+  return entry;
+}
+
+uint32_t DnsCache::remainingMs(const Entry& entry, uint32_t nowMs) const {
+  uint32_t ttlMs = entry.negative ? timing.negativeTtlMs : timing.ttlMs;
+  uint32_t ageMs = nowMs - entry.storedMs;
+  return ageMs < ttlMs ? ttlMs - ageMs : 0;
+}
+
+DnsCache::Result DnsCache::lookup(const char* name, uint32_t nowMs, uint32_t& address) {
+  Entry* entry = find(name);
+  if (entry != nullptr && remainingMs(*entry, nowMs) > 0) {
+    entry->lastUsedMs = nowMs;
+    if (entry->negative) {
+      stats.negativeHits++;
+      return Result::NegativeHit;
+    }
+    address = entry->address;
+    stats.hits++;
+    return Result::Hit;
+  }
+  stats.misses++;
+  return Result::Miss;
+}
+
+bool DnsCache::lookupStale(const char* name, uint32_t nowMs, uint32_t& address) {
+  Entry* entry = find(name);
+  // Failed lookups leave the last known address in place, so negative
+  // entries can still answer here
+  if (entry == nullptr || entry->address == 0 ||
+      nowMs - entry->resolvedMs >= timing.ttlMs + timing.staleMs) {
+    return false;
+  }
+  address = entry->address;
+  stats.staleHits++;
+  return true;
+}
+
+bool DnsCache::peek(const char* name, uint32_t nowMs, uint32_t& address) const {
+  const Entry* entry = find(name);
+  if (entry == nullptr || entry->address == 0 ||
+      nowMs - entry->resolvedMs >= timing.ttlMs + timing.staleMs) {
+    return false;
+  }
+  address = entry->address;
+  return true;
+}
+
+void DnsCache::store(const char* name, uint32_t address, uint32_t nowMs, uint32_t lookupMs) {
+  latency.add(lookupMs);
+  Entry* entry = findOrAdd(name, nowMs);
+  if (entry == nullptr) {
+    return;
+  }
+  entry->address = address;
+  entry->resolvedMs = nowMs;
+  entry->storedMs = nowMs;
+  entry->negative = false;
+}
+
+void DnsCache::storeFailure(const char* name, uint32_t nowMs, uint32_t lookupMs) {
+  latency.add(lookupMs);
+  stats.failures++;
+  Entry* entry = findOrAdd(name, nowMs);
+  if (entry == nullptr) {
+    return;
+  }
+  entry->storedMs = nowMs;
+  entry->negative = true;
+}
+
+bool DnsCache::needsRefresh(const char* name, uint32_t nowMs, uint32_t aheadMs) const {
+  if (!cacheable(name)) {
+    return false;
+  }
+  const Entry* entry = find(name);
+  if (entry == nullptr) {
+    return true;
+  }
+  uint32_t remaining = remainingMs(*entry, nowMs);
+  if (entry->negative) {
+    return remaining == 0;
+  }
+  return remaining <= aheadMs;
+}
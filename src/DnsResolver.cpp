@@ -0,0 +1,183 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DnsResolver.h"
+#include "config.h"
+#include "Logger.h"
+#include <WiFi.h>
+#include <lwip/dns.h>
+#include <lwip/tcpip.h>
+
+#define DNS_PREFETCH_SLOTS 2  // Background lookups in flight at once
+
+static const DnsCache::Timing dnsTiming = {
+  DNS_CACHE_TTL_S * 1000UL,
+  DNS_NEGATIVE_TTL_S * 1000UL,
+  DNS_STALE_MAX_S * 1000UL
+};
+
+// Shared by the loop task, the async web server task and the lwIP task
+// (prefetch results)
+static DnsCache dnsCache(dnsTiming);
+static portMUX_TYPE dnsMux = portMUX_INITIALIZER_UNLOCKED;
+
+struct PrefetchSlot {
+  char name[DNS_CACHE_NAME_LEN];
+  uint32_t startMs;
+  bool busy;
+};
+
+static PrefetchSlot prefetchSlots[DNS_PREFETCH_SLOTS];
+
+static void storeResult(const char* host, uint32_t address, uint32_t startMs) {
+  uint32_t nowMs = millis();
+  portENTER_CRITICAL(&dnsMux);
+  if (address != 0) {
+    dnsCache.store(host, address, nowMs, nowMs - startMs);
+  } else {
+    dnsCache.storeFailure(host, nowMs, nowMs - startMs);
+  }
+  portEXIT_CRITICAL(&dnsMux);
+}
+
+bool dnsResolve(const char* host, IPAddress& address, uint32_t* lookupMs) {
+  if (lookupMs != nullptr) {
+    *lookupMs = 0;
+  }
+
+  uint32_t cached = 0;
+  portENTER_CRITICAL(&dnsMux);
+  DnsCache::Result result = dnsCache.lookup(host, millis(), cached);
+  portEXIT_CRITICAL(&dnsMux);
+  if (result == DnsCache::Result::Hit) {
+    address = cached;
+    return true;
+  }
+
+  if (result == DnsCache::Result::Miss) {
+    uint32_t startMs = millis();
+    IPAddress resolved;
+    bool ok = WiFi.hostByName(host, resolved) && (uint32_t)resolved != 0;
+    if (lookupMs != nullptr) {
+      *lookupMs = millis() - startMs;
+    }
+    storeResult(host, ok ? (uint32_t)resolved : 0, startMs);
+    if (ok) {
+      address = resolved;
+      return true;
+    }
+    LOG_WARNF("DNS lookup for %s failed", host);
+  }
+
+  // Failed now or recently: an address that worked an hour ago is more
+  // useful than no connection at all
+  portENTER_CRITICAL(&dnsMux);
+  bool stale = dnsCache.lookupStale(host, millis(), cached);
+  portEXIT_CRITICAL(&dnsMux);
+  if (stale) {
+    address = cached;
+  }
+  return stale;
+}
+
+bool dnsCachedAddress(const char* host, IPAddress& address) {
+  uint32_t cached = 0;
+  portENTER_CRITICAL(&dnsMux);
+  bool found = dnsCache.peek(host, millis(), cached);
+  portEXIT_CRITICAL(&dnsMux);
+  if (found) {
+    address = cached;
+  }
+  return found;
+}
+
+// Runs in the lwIP task, like every DNS callback
+static void prefetchFound(const char* name, const ip_addr_t* ipaddr, void* arg) {
+  PrefetchSlot* slot = static_cast<PrefetchSlot*>(arg);
+  uint32_t address = 0;
+  if (ipaddr != nullptr && IP_IS_V4(ipaddr)) {
+    address = ip_2_ip4(ipaddr)->addr;
+  }
+  storeResult(name, address, slot->startMs);
+  portENTER_CRITICAL(&dnsMux);
+  slot->busy = false;
+  portEXIT_CRITICAL(&dnsMux);
+}
+
+static void prefetchStart(void* arg) {
+  PrefetchSlot* slot = static_cast<PrefetchSlot*>(arg);
+  ip_addr_t ipaddr;
+  err_t err = dns_gethostbyname(slot->name, &ipaddr, prefetchFound, slot);
+  if (err == ERR_OK) {
+    // Answered from the lwIP table, no callback follows
+    prefetchFound(slot->name, &ipaddr, slot);
+  } else if (err != ERR_INPROGRESS) {
+    prefetchFound(slot->name, nullptr, slot);
+  }
+}
+
+void dnsPrefetch(const char* host) {
+  if (WiFi.status() != WL_CONNECTED) {
+    return;
+  }
+
+  PrefetchSlot* slot = nullptr;
+  uint32_t nowMs = millis();
+  portENTER_CRITICAL(&dnsMux);
+  if (dnsCache.needsRefresh(host, nowMs, DNS_PREFETCH_AHEAD_S * 1000UL)) {
+    bool pending = false;
+    for (uint8_t i = 0; i < DNS_PREFETCH_SLOTS; i++) {
+      if (prefetchSlots[i].busy && strcmp(prefetchSlots[i].name, host) == 0) {
+        pending = true;
+      } else if (!prefetchSlots[i].busy && slot == nullptr) {
+        slot = &prefetchSlots[i];
+      }
+    }
+    if (pending) {
+      slot = nullptr;
+    }
+    if (slot != nullptr) {
+      strcpy(slot->name, host);
+      slot->startMs = nowMs;
+      slot->busy = true;
+      dnsCache.countPrefetch();
+    }
+  }
+  portEXIT_CRITICAL(&dnsMux);
+
+  if (slot == nullptr) {
+    return;
+  }
+  // lwIP DNS is only safe to use from its own task
+  if (tcpip_callback(prefetchStart, slot) != ERR_OK) {
+    portENTER_CRITICAL(&dnsMux);
+    slot->busy = false;
+    portEXIT_CRITICAL(&dnsMux);
+    return;
+  }
+  LOG_DEBUGF("Prefetching DNS for %s", host);
+}
+
+DnsCache getDnsCache() {
+  portENTER_CRITICAL(&dnsMux);
+  DnsCache copy = dnsCache;
+  portEXIT_CRITICAL(&dnsMux);
+  return copy;
+}
@@ -0,0 +1,37 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FlashStream.h"
+#include <string.h>
+
+FlashStream::FlashStream(const uint8_t* content, size_t length)
+  : content(content), contentLength(length), offset(0) {
+}
+
+size_t FlashStream::read(uint8_t* buffer, size_t maxLength) {
+  size_t length = contentLength - offset;
+  if (length > maxLength) {
+    length = maxLength;
+  }
+  // Flash is memory mapped on the ESP32, memcpy_P() is a plain memcpy()
+  memcpy(buffer, content + offset, length);
+  offset += length;
+  return length;
+}
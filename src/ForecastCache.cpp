@@ -0,0 +1,95 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ForecastCache.h"
+#include <math.h>
+
+// Locations closer than this (about 100 m) count as the same
+static const float LOCATION_EPSILON = 0.001f;
+
+static const ForecastPoint& pointAt(const ForecastCache& cache, uint8_t index) {
+  return cache.points[(cache.head + index) % FORECAST_MAX_POINTS];
+}
+
+void resetForecast(ForecastCache& cache, uint32_t fetchedEpoch, float latitude, float longitude, bool fahrenheit) {
+  cache.fetchedEpoch = fetchedEpoch;
+  cache.latitude = latitude;
+  cache.longitude = longitude;
+  cache.fahrenheit = fahrenheit ? 1 : 0;
+  cache.head = 0;
+  cache.count = 0;
+}
+
+bool addForecastPoint(ForecastCache& cache, uint32_t epoch, float temperature) {
+  if (cache.count > 0 && epoch <= pointAt(cache, cache.count - 1).epoch) {
+    return false;
+  }
+  ForecastPoint point;
+  point.epoch = epoch;
+  point.tempDeci = (int16_t)lroundf(temperature * 10.0f);
+
+  if (cache.count < FORECAST_MAX_POINTS) {
+    cache.points[(cache.head + cache.count) % FORECAST_MAX_POINTS] = point;
+    cache.count++;
+  } else {
+    cache.points[cache.head] = point;
+    cache.head = (cache.head + 1) % FORECAST_MAX_POINTS;
+  }
+  return true;
+}
+
+bool forecastCovers(const ForecastCache& cache, uint32_t epoch, float latitude, float longitude) {
+  if (cache.fetchedEpoch == 0 || cache.count == 0 || cache.count > FORECAST_MAX_POINTS ||
+      cache.head >= FORECAST_MAX_POINTS) {
+    return false;
+  }
+  if (fabsf(cache.latitude - latitude) > LOCATION_EPSILON || fabsf(cache.longitude - longitude) > LOCATION_EPSILON) {
+    return false;
+  }
+  return epoch >= pointAt(cache, 0).epoch && epoch <= pointAt(cache, cache.count - 1).epoch;
+}
+
+bool forecastTemperatureAt(const ForecastCache& cache, uint32_t epoch, float& temperature) {
+  if (cache.count == 0 || epoch < pointAt(cache, 0).epoch || epoch > pointAt(cache, cache.count - 1).epoch) {
+    return false;
+  }
+
+  // Last point at or before epoch
+  uint8_t low = 0;
+  uint8_t high = cache.count;
+  while (high - low > 1) {
+    uint8_t mid = (low + high) / 2;
+    if (pointAt(cache, mid).epoch <= epoch) {
+      low = mid;
+    } else {
+      high = mid;
+    }
+  }
+
+  const ForecastPoint& from = pointAt(cache, low);
+  if (low + 1 >= cache.count || epoch == from.epoch) {
+    temperature = from.tempDeci / 10.0f;
+    return true;
+  }
+  const ForecastPoint& to = pointAt(cache, low + 1);
+  float fraction = (float)(epoch - from.epoch) / (float)(to.epoch - from.epoch);
+  temperature = (from.tempDeci + (to.tempDeci - from.tempDeci) * fraction) / 10.0f;
+  return true;
+}
@@ -0,0 +1,325 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Geolocation.h"
+#include "Logger.h"
+#include "WiFi_Manager.h"
+#include "SecureHTTPClient.h"
+#include <ArduinoJson.h>
+#include <WiFi.h>
+
+struct LocationResult {
+  char latitude[12];
+  char longitude[12];
+  char city[48];
+  char postalCode[16];
+  char region[48];
+  char country[48];
+};
+
+// Location per public IP, remembered together with the network it was seen
+// from: the public IP itself is only known after asking ipapi.co
+struct CachedLocation {
+  char ip[46];          // Public IP reported by ipapi.co ("" = free)
+  uint32_t networkKey;
+  uint32_t storedMs;
+  LocationResult location;
+};
+
+// Shared by the async web server task (requests, polls) and the worker (jobs)
+static CachedLocation cache[GEOLOCATION_CACHE_SIZE];
+static GeolocationJob job = {};
+static uint32_t jobDoneMs = 0;
+static uint32_t lastJobId = 0;
+static GeolocationStats stats = {};
+static portMUX_TYPE geoMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Runs the jobs, created with the first one
+static TaskHandle_t worker = nullptr;
+
+// Identifies the network the device is on (gateway and access point)
+static uint32_t currentNetworkKey() {
+  uint32_t key = (uint32_t)WiFi.gatewayIP();
+  const uint8_t* bssid = WiFi.BSSID();
+  if (bssid != nullptr) {
+    for (uint8_t i = 0; i < 6; i++) {
+      key = key * 31 + bssid[i];
+    }
+  }
+  return key;
+}
+
+// Keeps only the fields the answer needs
+static bool parseGeolocationBody(Stream& body, void* context) {
+  JsonDocument* doc = static_cast<JsonDocument*>(context);
+  StaticJsonDocument<160> filter;
+  filter["ip"] = true;
+  filter["latitude"] = true;
+  filter["longitude"] = true;
+  filter["city"] = true;
+  filter["postal"] = true;
+  filter["region"] = true;
+  filter["country_name"] = true;
+  DeserializationError error = deserializeJson(*doc, body, DeserializationOption::Filter(filter));
+  if (error) {
+    LOG_ERRORF("JSON parsing failed: %s", error.c_str());
+    return false;
+  }
+  return true;
+}
+
+static void copyField(char* target, size_t size, const char* value) {
+  strncpy(target, value != nullptr ? value : "", size - 1);
+  target[size - 1] = '\0';
+}
+
+static void formatLocation(const LocationResult& location, bool cached, char* out, size_t size) {
+  StaticJsonDocument<384> doc;
+  doc["success"] = true;
+  doc["latitude"] = location.latitude;
+  doc["longitude"] = location.longitude;
+  doc["city"] = location.city;
+  doc["postalCode"] = location.postalCode;
+  doc["region"] = location.region;
+  doc["country"] = location.country;
+  doc["cached"] = cached;
+  serializeJson(doc, out, size);
+}
+
+static void formatError(GeolocationJob& result, int httpStatus, const char* error) {
+  result.httpStatus = httpStatus;
+  snprintf(result.body, sizeof(result.body), "{\"success\":false,\"error\":\"%s\"}", error);
+}
+
+static void storeLocation(const char* ip, uint32_t networkKey, const LocationResult& location) {
+  uint32_t nowMs = millis();
+  portENTER_CRITICAL(&geoMux);
+  // Same public IP, else a free or the oldest entry
+  CachedLocation* entry = &cache[0];
+  for (uint8_t i = 0; i < GEOLOCATION_CACHE_SIZE; i++) {
+    if (strcmp(cache[i].ip, ip) == 0) {
+      entry = &cache[i];
+      break;
+    }
+    if (cache[i].ip[0] == '\0' || nowMs - cache[i].storedMs > nowMs - entry->storedMs) {
+      entry = &cache[i];
+    }
+  }
+  copyField(entry->ip, sizeof(entry->ip), ip);
+  entry->networkKey = networkKey;
+  entry->storedMs = nowMs;
+  entry->location = location;
+  portEXIT_CRITICAL(&geoMux);
+}
+
+// Blocking lookup, fills httpStatus and body of result
+static void lookupLocation(GeolocationJob& result) {
+  result.retryAfterS = 0;
+  if (!isWiFiConnected()) {
+    formatError(result, 503, "WiFi not connected");
+    return;
+  }
+  uint32_t networkKey = currentNetworkKey();
+
+  // Shares the per-host backoff and circuit breaker with all other requests.
+  // Parsed from the stream through a filter, the body is never buffered.
+  DynamicJsonDocument doc(512);
+  SecureHTTPClient::Options options;
+  options.followRedirects = true;
+  SecureHTTPClient::Response lookup = SecureHTTPClient::getStream("https://ipapi.co/json/", parseGeolocationBody, &doc, options);
+  if (lookup.deferred) {
+    LOG_WARNF("Geolocation lookup not sent: %s", lookup.error.c_str());
+    char error[64];
+    snprintf(error, sizeof(error), "Geolocation service unavailable, retry in %lu s",
+             (unsigned long)(lookup.retryInMs / 1000));
+    formatError(result, 503, error);
+    result.retryAfterS = (lookup.retryInMs + 999) / 1000;
+    return;
+  }
+  if (!lookup.success) {
+    LOG_ERRORF("Geolocation request failed: %s", lookup.error.c_str());
+    formatError(result, 500, "Geolocation lookup failed");
+    return;
+  }
+
+  #ifdef DEBUG
+  LOG_DEBUGF("Geolocation response: %u bytes in %lu ms", (unsigned)lookup.bodyLength,
+             (unsigned long)lookup.timings.totalMs);
+  #endif
+
+  // Extract and validate location data
+  if (!doc.containsKey("latitude") || !doc.containsKey("longitude")) {
+    LOG_ERROR("Missing location data in response");
+    formatError(result, 500, "Geolocation lookup failed");
+    return;
+  }
+
+  float lat = doc["latitude"].as<float>();
+  float lon = doc["longitude"].as<float>();
+
+  // Validate coordinate ranges
+  if (lat < -90.0f || lat > 90.0f || lon < -180.0f || lon > 180.0f) {
+    LOG_ERRORF("Invalid coordinates: lat=%.6f, lon=%.6f", lat, lon);
+    formatError(result, 500, "Geolocation lookup failed");
+    return;
+  }
+
+  LocationResult location;
+  snprintf(location.latitude, sizeof(location.latitude), "%.6f", lat);
+  snprintf(location.longitude, sizeof(location.longitude), "%.6f", lon);
+  copyField(location.city, sizeof(location.city), doc["city"]);
+  copyField(location.postalCode, sizeof(location.postalCode), doc["postal"]);
+  copyField(location.region, sizeof(location.region), doc["region"]);
+  copyField(location.country, sizeof(location.country), doc["country_name"]);
+  const char* ip = doc["ip"] | "";
+  if (ip[0] != '\0') {
+    storeLocation(ip, networkKey, location);
+  }
+
+  LOG_INFOF("Geolocation: %s, %s (%s, %s)", location.city, location.country, location.latitude, location.longitude);
+  result.httpStatus = 200;
+  formatLocation(location, false, result.body, sizeof(result.body));
+}
+
+static void finishJob(uint32_t id, const GeolocationJob& result) {
+  portENTER_CRITICAL(&geoMux);
+  if (job.id == id) {
+    job.httpStatus = result.httpStatus;
+    job.retryAfterS = result.retryAfterS;
+    memcpy(job.body, result.body, sizeof(job.body));
+    job.state = GeolocationJobState::Done;
+    jobDoneMs = millis();
+  }
+  if (result.httpStatus != 200) {
+    stats.failures++;
+  }
+  portEXIT_CRITICAL(&geoMux);
+}
+
+// Run the pending job, if any
+static void runGeolocationJob() {
+  portENTER_CRITICAL(&geoMux);
+  bool pending = job.state == GeolocationJobState::Pending;
+  uint32_t id = job.id;
+  if (pending) {
+    job.state = GeolocationJobState::Running;
+  }
+  portEXIT_CRITICAL(&geoMux);
+  if (!pending) {
+    return;
+  }
+
+  GeolocationJob result = {};
+  lookupLocation(result);
+  finishJob(id, result);
+}
+
+// Sleeps until requestGeolocation() starts a job
+static void geolocationTask(void*) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    runGeolocationJob();
+  }
+}
+
+// Hand a new job to the worker, creating it on first use
+static void wakeWorker(uint32_t id) {
+  if (worker == nullptr &&
+      xTaskCreate(geolocationTask, "geolocation", GEOLOCATION_TASK_STACK, nullptr,
+                  GEOLOCATION_TASK_PRIORITY, &worker) != pdPASS) {
+    worker = nullptr;
+    LOG_ERROR("Failed to start geolocation task");
+    GeolocationJob result = {};
+    formatError(result, 500, "Geolocation lookup failed");
+    finishJob(id, result);
+    return;
+  }
+  xTaskNotifyGive(worker);
+}
+
+void requestGeolocation(GeolocationJob& result) {
+  uint32_t networkKey = currentNetworkKey();
+  uint32_t nowMs = millis();
+  LocationResult location;
+  bool cached = false;
+  bool started = false;
+
+  portENTER_CRITICAL(&geoMux);
+  stats.requests++;
+  for (uint8_t i = 0; i < GEOLOCATION_CACHE_SIZE; i++) {
+    if (cache[i].ip[0] != '\0' && cache[i].networkKey == networkKey &&
+        nowMs - cache[i].storedMs < GEOLOCATION_CACHE_TTL_S * 1000UL) {
+      location = cache[i].location;
+      cached = true;
+      stats.cacheHits++;
+      break;
+    }
+  }
+  if (!cached) {
+    // Join a job in progress, else start one
+    if (job.state != GeolocationJobState::Pending && job.state != GeolocationJobState::Running) {
+      job.id = ++lastJobId;
+      job.state = GeolocationJobState::Pending;
+      job.httpStatus = 0;
+      job.retryAfterS = 0;
+      job.body[0] = '\0';
+      stats.jobs++;
+      started = true;
+    }
+    result = job;
+  }
+  portEXIT_CRITICAL(&geoMux);
+
+  if (started) {
+    wakeWorker(result.id);
+  }
+
+  if (cached) {
+    result.id = 0;
+    result.state = GeolocationJobState::Done;
+    result.httpStatus = 200;
+    result.retryAfterS = 0;
+    formatLocation(location, true, result.body, sizeof(result.body));
+  }
+}
+
+bool getGeolocationJob(uint32_t id, GeolocationJob& result) {
+  uint32_t nowMs = millis();
+  portENTER_CRITICAL(&geoMux);
+  bool found = id != 0 && job.id == id &&
+               (job.state != GeolocationJobState::Done || nowMs - jobDoneMs < GEOLOCATION_JOB_KEEP_MS);
+  if (found) {
+    result = job;
+  }
+  portEXIT_CRITICAL(&geoMux);
+
+  if (!found) {
+    result.id = id;
+    result.state = GeolocationJobState::None;
+  }
+  return found;
+}
+
+GeolocationStats getGeolocationStats() {
+  portENTER_CRITICAL(&geoMux);
+  GeolocationStats copy = stats;
+  portEXIT_CRITICAL(&geoMux);
+  return copy;
+}
@@ -0,0 +1,168 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "HostBackoff.h"
+#include <string.h>
+
+// Wrap-safe "a is before b" for millis() timestamps
+static inline bool before(uint32_t a, uint32_t b) {
+  return (int32_t)(a - b) < 0;
+}
+
+HostBackoff::HostBackoff(const Policy& policy)
+    : policy(policy),
+      hosts(),
+      hostCount(0),
+      stats() {
+}
+
+HostBackoff::Host* HostBackoff::find(const char* host) {
+  for (uint8_t i = 0; i < hostCount; i++) {
+    if (strncmp(hosts[i].name, host, HOST_BACKOFF_NAME_LEN - 1) == 0) {
+      return &hosts[i];
+    }
+  }
+  return nullptr;
+}
+
+const HostBackoff::Host* HostBackoff::find(const char* host) const {
+  return const_cast<HostBackoff*>(this)->find(host);
+}
+
+HostBackoff::Host* HostBackoff::findOrAdd(const char* host, uint32_t nowMs) {
+  Host* entry = find(host);
+  if (entry == nullptr) {
+    if (hostCount < HOST_BACKOFF_SLOTS) {
+      entry = &hosts[hostCount++];
+    } else {
+      // Replace the host that was used least recently
+      entry = &hosts[0];
+      for (uint8_t i = 1; i < hostCount; i++) {
+        if (before(hosts[i].lastUsedMs, entry->lastUsedMs)) {
+          entry = &hosts[i];
+        }
+      }
+    }
+    strncpy(entry->name, host, HOST_BACKOFF_NAME_LEN - 1);
+    entry->name[HOST_BACKOFF_NAME_LEN - 1] = '\0';
+    entry->state = State::Closed;
+    entry->failures = 0;
+    entry->untilMs = nowMs;
+  }
+  entry->lastUsedMs = nowMs;
+  return entry;
+}
+
+uint32_t HostBackoff::jitter(uint32_t delayMs, uint32_t random) const {
+  // "Equal jitter": keeps at least half the delay, spreads the rest so
+  // clients that failed together do not retry together
+  uint32_t half = delayMs / 2;
+  return half + random % (delayMs - half + 1);
+}
+
+HostBackoff::Decision HostBackoff::acquire(const char* host, uint32_t nowMs) {
+  Host* entry = findOrAdd(host, nowMs);
+
+  switch (entry->state) {
+    case State::Closed:
+      stats.allowed++;
+      return Decision::Allow;
+    case State::Backoff:
+      if (before(nowMs, entry->untilMs)) {
+        stats.deferred++;
+        return Decision::Deferred;
+      }
+      stats.allowed++;
+      return Decision::Allow;
+    case State::Open:
+    case State::HalfOpen:
+      // Half-open: one probe at a time, a probe that never reports back
+      // is replaced after another open period
+      if (before(nowMs, entry->untilMs)) {
+        stats.rejected++;
+        return Decision::Rejected;
+      }
+      entry->state = State::HalfOpen;
+      entry->untilMs = nowMs + policy.openMs;
+      stats.probes++;
+      return Decision::Allow;
+  }
+  return Decision::Allow;
+}
+
+void HostBackoff::recordSuccess(const char* host, uint32_t nowMs) {
+  Host* entry = findOrAdd(host, nowMs);
+  stats.successes++;
+  entry->state = State::Closed;
+  entry->failures = 0;
+  entry->untilMs = nowMs;
+}
+
+void HostBackoff::recordFailure(const char* host, uint32_t nowMs, uint32_t random) {
+  Host* entry = findOrAdd(host, nowMs);
+  stats.failures++;
+  if (entry->failures < 255) {
+    entry->failures++;
+  }
+
+  if (entry->state == State::HalfOpen || entry->failures >= policy.openAfterFailures) {
+    entry->state = State::Open;
+    entry->untilMs = nowMs + jitter(policy.openMs, random);
+    stats.opens++;
+    return;
+  }
+
+  uint32_t delayMs = policy.initialBackoffMs;
+  for (uint8_t i = 1; i < entry->failures && delayMs < policy.maxBackoffMs; i++) {
+    delayMs *= 2;
+  }
+  if (delayMs > policy.maxBackoffMs) {
+    delayMs = policy.maxBackoffMs;
+  }
+  entry->state = State::Backoff;
+  entry->untilMs = nowMs + jitter(delayMs, random);
+}
+
+HostBackoff::State HostBackoff::getState(const char* host) const {
+  const Host* entry = find(host);
+  return entry != nullptr ? entry->state : State::Closed;
+}
+
+uint32_t HostBackoff::retryInMs(const char* host, uint32_t nowMs) const {
+  const Host* entry = find(host);
+  if (entry == nullptr || entry->state == State::Closed || !before(nowMs, entry->untilMs)) {
+    return 0;
+  }
+  return entry->untilMs - nowMs;
+}
+
+const char* HostBackoff::getStateName(State state) {
+  switch (state) {
+    case State::Closed:
+      return "closed";
+    case State::Backoff:
+      return "backoff";
+    case State::Open:
+      return "open";
+    case State::HalfOpen:
+      return "halfOpen";
+  }
+  return "unknown";
+}
@@ -24,6 +24,7 @@
 #include "ConfigManager.h"
 #include "ColorCalculator.h"
 #include "Weather.h"
+#include "WarmRestart.h"
 #include <ESP32Time.h>
 
 // Global variables
@@ -40,7 +41,6 @@ uint8_t charBlendIndex;
 uint8_t darkBrightness = 0;
 bool secondIndicatorState = true;
 char displayWord[5];
-extern int8_t owmTemperature;
 extern uint32_t lastTempDisplayTime;
 
 // Cached configuration values to avoid repeated getConfig() calls
@@ -312,13 +312,27 @@ static uint8_t calculateTempColorIndex(int8_t temp) {
   }
 }
 
-static void buildTempString(int8_t temp, bool isMetric, char* output) {
+static void buildTempString(int8_t temp, bool isMetric, char label, char* output) {
   bool negative = temp < 0;
   int8_t absTemp = negative ? -temp : temp;
   int tempNibble10 = absTemp / 10;
   int tempNibble = absTemp % 10;
   char unit = isMetric ? 'C' : 'F';
 
+  // Extra locations show their label glyph in place of the unit
+  if (label != '\0') {
+    if (negative && tempNibble10 >= 1) {
+      sprintf(output, "%c-%d", label, absTemp);
+    } else if (negative) {
+      sprintf(output, "%c-%dz", label, tempNibble);
+    } else if (tempNibble10 < 1) {
+      sprintf(output, "%c %dz", label, tempNibble);
+    } else {
+      sprintf(output, "%c%d%dz", label, tempNibble10, tempNibble);
+    }
+    return;
+  }
+
   if (negative && tempNibble10 < 1) {
     sprintf(output, "%c%d%c%c", '-', tempNibble, 'z', unit);
   } else if (negative) {
@@ -333,11 +347,20 @@ static void buildTempString(int8_t temp, bool isMetric, char* output) {
 void displayTemperature() {
   Config& cfg = configManager.getConfig();
 
-  if (!formatTemperatureDisplay(owmTemperature, displayWord, sizeof(displayWord))) {
+  // One location per scheduled display, primary first
+  static uint8_t locationIndex = 0;
+  if (locationIndex >= getWeatherLocationCount()) {
+    locationIndex = 0;
+  }
+  int8_t temperature = getWeatherTemperature(locationIndex);
+  char label = getWeatherLocationLabel(locationIndex);
+  locationIndex++;
+
+  if (!formatTemperatureDisplay(temperature, displayWord, sizeof(displayWord))) {
     return;
   }
 
-  if (isWeatherError(owmTemperature)) {
+  if (isWeatherError(temperature)) {
     displayClockface(displayWord);
     FastLED.show();
     lastTempDisplayTime = millis();
@@ -345,9 +368,9 @@ void displayTemperature() {
   }
 
   secondIndicatorOff();
-  uint8_t customBlendIndex = calculateTempColorIndex(owmTemperature);
+  uint8_t customBlendIndex = calculateTempColorIndex(temperature);
   bool isMetric = (cfg.locationUnits == "metric");
-  buildTempString(owmTemperature, isMetric, displayWord);
+  buildTempString(temperature, isMetric, label, displayWord);
   displayClockface(displayWord, true, RainbowColors_p, customBlendIndex);
   FastLED.show();
   lastTempDisplayTime = millis();
@@ -375,6 +398,10 @@ void displayStatus(uint8_t messageId) {
       break;
   }
   LOG_INFO(serialMessage);
+  // Keep the restored time on screen instead of boot progress messages
+  if (isWarmBoot() && (messageId == 1 || messageId == 3)) {
+    return;
+  }
   displayClockface(displayMessage);
   FastLED.show();
 }
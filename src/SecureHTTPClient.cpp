@@ -19,44 +19,1038 @@
  */
 
 #include "SecureHTTPClient.h"
+#include "config.h"
 #include "Logger.h"
+#include "Metrics.h"
+#include "DnsResolver.h"
+#include "TrustStore.h"
 #include <HTTPClient.h>
 #include <WiFiClientSecure.h>
+#include <mbedtls/x509.h>
+#include <new>
 
-SecureHTTPClient::Response SecureHTTPClient::get(const char* url, unsigned long timeout, bool followRedirects) {
-  Response response;
+static const HostBackoff::Policy backoffPolicy = {
+  HTTP_BACKOFF_INITIAL_MS,
+  HTTP_BACKOFF_MAX_MS,
+  HTTP_BREAKER_FAILURES,
+  HTTP_BREAKER_OPEN_MS
+};
+
+// Shared by the loop task (weather) and the async web server task (geolocation)
+static HostBackoff hostBackoff(backoffPolicy);
+static portMUX_TYPE backoffMux = portMUX_INITIALIZER_UNLOCKED;
+
+// WiFiClientSecure validates against one process-wide certificate bundle
+extern "C" void arduino_esp_crt_bundle_set(const uint8_t* x509_bundle);
+
+// Connects to an address from the DNS cache and still sends the host name
+// for SNI. The address overload of connect() takes no timeout, it reads the
+// protected member instead. With a bundle the server's chain is validated
+// against it (the bundle must be active, see selectTrustBundle()).
+class ResolvedTlsClient : public WiFiClientSecure {
+public:
+  int connectResolved(IPAddress address, uint16_t port, const char* host, int32_t timeoutMs,
+                      const uint8_t* bundle) {
+    _timeout = timeoutMs;
+    _use_ca_bundle = bundle != nullptr;
+    _use_insecure = bundle == nullptr;
+    return connect(address, port, host, nullptr, _cert, _private_key);
+  }
+};
+
+// The bundle is global, so validated handshakes take turns: the one holding
+// the lock has its host's bundle active until the handshake is over
+static SemaphoreHandle_t trustLock() {
+  static SemaphoreHandle_t lock = xSemaphoreCreateMutex();
+  return lock;
+}
+
+static const uint8_t* activeTrustBundle = nullptr;
+
+static void selectTrustBundle(const uint8_t* bundle) {
+  xSemaphoreTake(trustLock(), portMAX_DELAY);
+  if (bundle != activeTrustBundle) {
+    arduino_esp_crt_bundle_set(bundle);
+    activeTrustBundle = bundle;
+  }
+}
+
+static void releaseTrustBundle() {
+  xSemaphoreGive(trustLock());
+}
+
+// Kept-alive connection per host. The HTTPClient is kept as well: its
+// destructor stops the client. Slots are leased under poolMux, a leased slot
+// belongs to the caller until it is released.
+struct PooledConnection {
+  char host[HOST_BACKOFF_NAME_LEN];
+  uint16_t port;
+  ResolvedTlsClient* client;
+  HTTPClient* http;
+  bool inUse;
+  bool open;  // Connection was kept alive at release (for statistics)
+  uint32_t lastUsedMs;
+};
+
+static PooledConnection pool[HTTP_POOL_SIZE];
+static SecureHTTPClient::PoolStats poolStats = {};
+static LatencySamples<16> handshakeSamples;
+static SecureHTTPClient::TrustStats trustStats = {};
+static LatencySamples<16> verifiedSamples;
+static LatencySamples<16> unverifiedSamples;
+static portMUX_TYPE poolMux = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t lastMaintainMs = 0;
+
+// Host and port of an https URL, without path or query
+static void hostFromUrl(const char* url, char* host, size_t size, uint16_t* port = nullptr) {
+  const char* start = strstr(url, "://");
+  start = start != nullptr ? start + 3 : url;
+  size_t length = strcspn(start, ":/?#");
+  if (port != nullptr) {
+    *port = start[length] == ':' ? (uint16_t)atoi(start + length + 1) : 443;
+  }
+  if (length >= size) {
+    length = size - 1;
+  }
+  memcpy(host, start, length);
+  host[length] = '\0';
+}
+
+static void initResponse(SecureHTTPClient::Response& response) {
   response.success = false;
   response.httpCode = 0;
-  response.payload = "";
   response.error = "";
+  response.deferred = false;
+  response.retryInMs = 0;
+  response.bodyLength = 0;
+  response.shared = false;
+  response.timings = {};
+}
+
+// Ask the backoff table before opening a connection
+static bool acquireHost(const char* host, SecureHTTPClient::Response& response) {
+  uint32_t nowMs = millis();
+  portENTER_CRITICAL(&backoffMux);
+  HostBackoff::Decision decision = hostBackoff.acquire(host, nowMs);
+  response.retryInMs = hostBackoff.retryInMs(host, nowMs);
+  portEXIT_CRITICAL(&backoffMux);
+
+  if (decision == HostBackoff::Decision::Allow) {
+    return true;
+  }
+  response.deferred = true;
+  response.error = String(decision == HostBackoff::Decision::Deferred ? "Backing off" : "Circuit open") +
+                   " (retry in " + String(response.retryInMs / 1000) + " s)";
+  LOG_DEBUGF("Request to %s not sent: %s", host, response.error.c_str());
+  return false;
+}
+
+// Connection, TLS and timeout errors, server errors and rate limiting count
+// against the host; other answers (including 4xx) show it is reachable
+static void recordResult(const char* host, SecureHTTPClient::Response& response) {
+  int code = response.httpCode;
+  bool failed = code <= 0 || code >= 500 || code == HTTP_CODE_TOO_MANY_REQUESTS;
+  uint32_t nowMs = millis();
+  uint32_t random = esp_random();
+  portENTER_CRITICAL(&backoffMux);
+  if (failed) {
+    hostBackoff.recordFailure(host, nowMs, random);
+    response.retryInMs = hostBackoff.retryInMs(host, nowMs);
+  } else {
+    hostBackoff.recordSuccess(host, nowMs);
+  }
+  HostBackoff::State state = hostBackoff.getState(host);
+  portEXIT_CRITICAL(&backoffMux);
+
+  if (failed) {
+    LOG_INFOF("%s %s, next request in %lu s", host, HostBackoff::getStateName(state),
+              (unsigned long)(response.retryInMs / 1000));
+  }
+}
+
+static void closeConnection(PooledConnection& conn) {
+  if (conn.http != nullptr) {
+    conn.http->end();
+  }
+  if (conn.client != nullptr) {
+    conn.client->stop();
+  }
+}
+
+/**
+ * Lease the slot holding host's connection, else a free or the least recently
+ * used idle slot (its connection is closed)
+ * @return nullptr if all slots are leased
+ */
+static PooledConnection* leaseConnection(const char* host, uint16_t port) {
+  PooledConnection* match = nullptr;
+  PooledConnection* spare = nullptr;
+  portENTER_CRITICAL(&poolMux);
+  for (uint8_t i = 0; i < HTTP_POOL_SIZE; i++) {
+    PooledConnection& conn = pool[i];
+    if (conn.inUse) {
+      continue;
+    }
+    if (conn.port == port && strcmp(conn.host, host) == 0) {
+      match = &conn;
+      break;
+    }
+    if (spare == nullptr || conn.client == nullptr ||
+        (spare->client != nullptr && (int32_t)(conn.lastUsedMs - spare->lastUsedMs) < 0)) {
+      spare = &conn;
+    }
+  }
+  PooledConnection* leased = match != nullptr ? match : spare;
+  if (leased != nullptr) {
+    leased->inUse = true;
+  }
+  portEXIT_CRITICAL(&poolMux);
+
+  if (leased == nullptr || leased == match) {
+    return leased;
+  }
+
+  // Take over a slot of another host
+  closeConnection(*leased);
+  strncpy(leased->host, host, sizeof(leased->host) - 1);
+  leased->host[sizeof(leased->host) - 1] = '\0';
+  leased->port = port;
+  if (leased->client == nullptr) {
+    leased->client = new (std::nothrow) ResolvedTlsClient();
+    leased->http = new (std::nothrow) HTTPClient();
+    if (leased->client == nullptr || leased->http == nullptr) {
+      delete leased->client;
+      delete leased->http;
+      leased->client = nullptr;
+      leased->http = nullptr;
+      leased->host[0] = '\0';
+      leased->inUse = false;
+      return nullptr;
+    }
+    leased->client->setInsecure();
+  }
+  return leased;
+}
+
+static void releaseConnection(PooledConnection* conn) {
+  // Don't keep a ~40 KB TLS session around when the heap is short
+  if (conn->client->connected() && ESP.getFreeHeap() < HTTP_POOL_MIN_FREE_HEAP) {
+    closeConnection(*conn);
+    portENTER_CRITICAL(&poolMux);
+    poolStats.closedLowHeap++;
+    portEXIT_CRITICAL(&poolMux);
+  }
+  bool open = conn->client->connected();
+  portENTER_CRITICAL(&poolMux);
+  conn->open = open;
+  conn->lastUsedMs = millis();
+  conn->inUse = false;
+  portEXIT_CRITICAL(&poolMux);
+}
 
-  WiFiClientSecure client;
-  client.setInsecure();
+SecureHTTPClient::Options::Options()
+    : connectTimeoutMs(HTTP_CONNECT_TIMEOUT_MS),
+      tlsTimeoutMs(HTTP_TLS_TIMEOUT_MS),
+      firstByteTimeoutMs(HTTP_FIRST_BYTE_TIMEOUT_MS),
+      totalTimeoutMs(HTTP_TOTAL_TIMEOUT_MS),
+      maxBodySize(HTTP_MAX_BODY_SIZE),
+      followRedirects(false) {
+}
+
+// Time left until deadlineMs (0 = passed)
+static uint32_t remainingMs(uint32_t deadlineMs) {
+  int32_t left = (int32_t)(deadlineMs - millis());
+  return left > 0 ? (uint32_t)left : 0;
+}
+
+// Phase timeout, shortened to what is left of the total
+static uint32_t phaseTimeoutMs(uint32_t timeoutMs, uint32_t deadlineMs) {
+  uint32_t left = remainingMs(deadlineMs);
+  return timeoutMs < left ? timeoutMs : left;
+}
+
+// Copy of a body for callers sharing the request (see coalesce())
+struct BodyCapture {
+  uint8_t* data;
+  size_t size;
+  size_t length;
+  bool overflow;  // Body did not fit, it cannot be shared
+
+  void add(const uint8_t* bytes, size_t count) {
+    if (data == nullptr || overflow) {
+      return;
+    }
+    if (count > size - length) {
+      overflow = true;
+      return;
+    }
+    memcpy(data + length, bytes, count);
+    length += count;
+  }
+};
+
+/**
+ * Body stream handed to BodyHandlers. Ends after limit bytes or at the
+ * deadline, so a parser can neither read past the body nor wait forever.
+ */
+class BoundedStream : public Stream {
+public:
+  BoundedStream(WiFiClient& inner, size_t limit, uint32_t deadlineMs, BodyCapture* capture)
+      : inner(inner), limit(limit), consumed(0), deadlineMs(deadlineMs), cutOff(false), capture(capture) {
+    setTimeout(remainingMs(deadlineMs));
+  }
+
+  int available() override {
+    if (!readable()) {
+      return 0;
+    }
+    int count = inner.available();
+    size_t left = limit - consumed;
+    return (size_t)count > left ? (int)left : count;
+  }
+
+  int read() override {
+    if (!readable()) {
+      return -1;
+    }
+    int c = inner.read();
+    if (c >= 0) {
+      consumed++;
+      keep((uint8_t)c);
+    }
+    return c;
+  }
+
+  int peek() override {
+    return readable() ? inner.peek() : -1;
+  }
+
+  size_t write(uint8_t) override {
+    return 0;
+  }
+
+  void flush() override {}
+
+  // Read the rest of the body so the connection can be kept alive
+  bool drain() {
+    while (consumed < limit && remainingMs(deadlineMs) > 0) {
+      if (inner.available() > 0) {
+        int c = inner.read();
+        consumed++;
+        keep((uint8_t)c);
+      } else if (!inner.connected()) {
+        return false;
+      } else {
+        delay(1);
+      }
+    }
+    return consumed == limit;
+  }
+
+  size_t getConsumed() const { return consumed; }
 
-  HTTPClient http;
-  http.setTimeout(timeout);
+  // Stopped at limit with more data pending (body larger than allowed)
+  bool wasCutOff() const { return cutOff; }
 
-  if (followRedirects) {
-    http.setFollowRedirects(HTTPC_FORCE_FOLLOW_REDIRECTS);
+private:
+  void keep(uint8_t c) {
+    if (capture != nullptr) {
+      capture->add(&c, 1);
+    }
   }
 
-  if (!http.begin(client, url)) {
-    response.error = "Failed to initialize HTTPS connection";
-    LOG_ERROR(response.error.c_str());
+  bool readable() {
+    if (consumed >= limit) {
+      if (inner.available() > 0) {
+        cutOff = true;
+      }
+      setTimeout(0);  // Stream::timedRead() would otherwise keep polling
+      return false;
+    }
+    if (remainingMs(deadlineMs) == 0) {
+      setTimeout(0);
+      return false;
+    }
+    return true;
+  }
+
+  WiFiClient& inner;
+  size_t limit;
+  size_t consumed;
+  uint32_t deadlineMs;
+  bool cutOff;
+  BodyCapture* capture;
+};
+
+struct BodyRequest {
+  int expected;          // Content-Length, -1 if the body ends when the server closes
+  size_t maxBodySize;
+  uint32_t deadlineMs;
+};
+
+/**
+ * Reads an HTTP 200 body, sets success, error and bodyLength of response
+ * @return true if the body was read to its end (connection reusable)
+ */
+typedef bool (*BodyReader)(WiFiClient& stream, const BodyRequest& body, SecureHTTPClient::Response& response,
+                           void* context);
+
+static SecureHTTPClient::Timings lastTimings = {};
+
+/**
+ * Send a GET on a kept-alive connection for the URL's host (or a one-off
+ * connection when all slots are busy) and hand an HTTP 200 body to reader.
+ * HTTP/1.0 rules out chunked transfer encoding, so bodies arrive raw.
+ */
+static SecureHTTPClient::Response perform(const char* url, const SecureHTTPClient::Options& options,
+                                          BodyReader reader, void* context) {
+  SecureHTTPClient::Response response;
+  initResponse(response);
+  uint32_t startMs = millis();
+  uint32_t deadlineMs = startMs + options.totalTimeoutMs;
+
+  char host[HOST_BACKOFF_NAME_LEN];
+  uint16_t port;
+  hostFromUrl(url, host, sizeof(host), &port);
+  if (!acquireHost(host, response)) {
     return response;
   }
 
-  response.httpCode = http.GET();
+  PooledConnection* pooled = leaseConnection(host, port);
+  ResolvedTlsClient oneOffClient;
+  HTTPClient oneOffHttp;
+  ResolvedTlsClient* client = pooled != nullptr ? pooled->client : &oneOffClient;
+  HTTPClient* http = pooled != nullptr ? pooled->http : &oneOffHttp;
+  if (pooled == nullptr) {
+    oneOffClient.setInsecure();
+  }
+
+  // A kept-alive connection may have been dropped by the server without us
+  // noticing; resend once on a fresh connection before blaming the host
+  SecureHTTPClient::Timings& timings = response.timings;
+  for (uint8_t attempt = 0; attempt < 2; attempt++) {
+    timings = {};
+    bool reused = client->connected();
+    timings.reused = reused;
+    if (!reused) {
+      IPAddress address;
+      if (!dnsResolve(host, address, &timings.dnsMs)) {
+        response.httpCode = HTTPC_ERROR_CONNECTION_REFUSED;
+        response.error = "DNS lookup failed";
+        break;
+      }
+
+      // Hosts without anchors (or all, with HTTP_TLS_VERIFY off) stay unvalidated
+      const uint8_t* bundle = HTTP_TLS_VERIFY ? findTrustBundle(host) : nullptr;
+      if (bundle != nullptr) {
+        selectTrustBundle(bundle);
+      }
+      uint32_t phaseMs = millis();
+      client->setHandshakeTimeout((phaseTimeoutMs(options.tlsTimeoutMs, deadlineMs) + 999) / 1000);
+      bool connected = client->connectResolved(address, port, host,
+                                               phaseTimeoutMs(options.connectTimeoutMs, deadlineMs), bundle);
+      timings.connectMs = millis() - phaseMs;
+      if (bundle != nullptr) {
+        releaseTrustBundle();
+      }
+      if (!connected) {
+        char reason[64];
+        reason[0] = '\0';
+        int tlsError = client->lastError(reason, sizeof(reason));
+        response.httpCode = HTTPC_ERROR_CONNECTION_REFUSED;
+        // The server's chain does not lead to one of the host's anchors
+        bool rejected = bundle != nullptr && tlsError == MBEDTLS_ERR_X509_CERT_VERIFY_FAILED;
+        if (rejected) {
+          response.error = String("Certificate validation failed for ") + host;
+          LOG_WARNF("Certificate of %s rejected: no trusted anchor in its chain", host);
+        } else {
+          response.error = "Request failed: " + HTTPClient::errorToString(response.httpCode);
+        }
+        if (reason[0] != '\0') {
+          response.error += String(" (") + reason + ")";
+        }
+        if (bundle != nullptr) {
+          portENTER_CRITICAL(&poolMux);
+          if (rejected) {
+            trustStats.rejected++;
+          } else {
+            trustStats.failures++;
+          }
+          portEXIT_CRITICAL(&poolMux);
+        }
+        break;
+      }
+      portENTER_CRITICAL(&poolMux);
+      poolStats.handshakes++;
+      poolStats.lastHandshakeMs = timings.connectMs;
+      handshakeSamples.add(timings.connectMs);
+      if (bundle != nullptr) {
+        trustStats.verified++;
+        verifiedSamples.add(timings.connectMs);
+      } else {
+        trustStats.unverified++;
+        unverifiedSamples.add(timings.connectMs);
+      }
+      portEXIT_CRITICAL(&poolMux);
+      LOG_DEBUGF("TLS connection to %s established in %lu ms (%s)", host, (unsigned long)timings.connectMs,
+                 bundle != nullptr ? "validated" : "not validated");
+    }
 
-  if (response.httpCode == HTTP_CODE_OK) {
-    response.payload = http.getString();
-    response.success = true;
-  } else if (response.httpCode > 0) {
-    response.error = "HTTP error code: " + String(response.httpCode);
+    uint32_t firstByteMs = phaseTimeoutMs(options.firstByteTimeoutMs, deadlineMs);
+    http->setTimeout(firstByteMs > 65535 ? 65535 : (uint16_t)firstByteMs);
+    http->setFollowRedirects(options.followRedirects ? HTTPC_FORCE_FOLLOW_REDIRECTS : HTTPC_DISABLE_FOLLOW_REDIRECTS);
+    http->useHTTP10(true);
+    // Ask for keep-alive anyway (useHTTP10() turns it off)
+    http->setReuse(true);
+
+    if (!http->begin(*client, url)) {
+      response.error = "Failed to initialize HTTPS connection";
+      LOG_ERROR(response.error.c_str());
+      break;
+    }
+
+    uint32_t phaseMs = millis();
+    response.httpCode = http->GET();
+    timings.firstByteMs = millis() - phaseMs;
+    portENTER_CRITICAL(&poolMux);
+    poolStats.requests++;
+    if (reused) {
+      poolStats.reuses++;
+    }
+    portEXIT_CRITICAL(&poolMux);
+
+    if (reused && response.httpCode < 0 && attempt == 0) {
+      http->end();
+      client->stop();
+      portENTER_CRITICAL(&poolMux);
+      poolStats.staleRetries++;
+      portEXIT_CRITICAL(&poolMux);
+      LOG_DEBUGF("Kept-alive connection to %s was closed, reconnecting", host);
+      continue;
+    }
+
+    bool complete = false;
+    if (response.httpCode == HTTP_CODE_OK) {
+      BodyRequest body = {http->getSize(), options.maxBodySize, deadlineMs};
+      if (body.expected > (int)options.maxBodySize) {
+        response.error = "Response body of " + String(body.expected) + " bytes exceeds " +
+                         String((unsigned long)options.maxBodySize);
+      } else {
+        phaseMs = millis();
+        complete = reader(http->getStream(), body, response, context) && body.expected >= 0;
+        timings.bodyMs = millis() - phaseMs;
+      }
+    } else if (response.httpCode > 0) {
+      response.error = "HTTP error code: " + String(response.httpCode);
+    } else {
+      response.error = "Request failed: " + HTTPClient::errorToString(response.httpCode);
+    }
+
+    // Keeps the connection open if the server agreed to keep-alive. Unread
+    // bodies would end up in front of the next response, and a redirect may
+    // have moved the connection to another host, so those are closed.
+    http->end();
+    if (!complete || options.followRedirects) {
+      client->stop();
+    }
+    break;
+  }
+  timings.totalMs = millis() - startMs;
+
+  if (pooled != nullptr) {
+    releaseConnection(pooled);
   } else {
-    response.error = "Request failed: " + http.errorToString(response.httpCode);
+    oneOffHttp.end();
+    oneOffClient.stop();
   }
 
-  http.end();
+  if (response.httpCode != 0) {
+    portENTER_CRITICAL(&poolMux);
+    lastTimings = timings;
+    portEXIT_CRITICAL(&poolMux);
+    recordResult(host, response);
+  }
   return response;
 }
+
+// Common part of the reader contexts
+struct BodyTarget {
+  BodyCapture* capture;  // Set by coalesce() for the request that shares its body
+};
+
+struct ChunkTarget : BodyTarget {
+  SecureHTTPClient::ChunkSink onChunk;
+  void* context;
+};
+
+static bool readChunks(WiFiClient& stream, const BodyRequest& body, SecureHTTPClient::Response& response,
+                       void* context) {
+  ChunkTarget* target = static_cast<ChunkTarget*>(context);
+  uint8_t chunk[HTTP_CHUNK_SIZE];
+  size_t total = 0;
+  while (body.expected < 0 || total < (size_t)body.expected) {
+    int available = stream.available();
+    if (available <= 0) {
+      if (!stream.connected()) {
+        break;
+      }
+      if (remainingMs(body.deadlineMs) == 0) {
+        response.error = "Timeout while reading response body";
+        return false;
+      }
+      delay(1);
+      continue;
+    }
+    size_t length = (size_t)available < sizeof(chunk) ? (size_t)available : sizeof(chunk);
+    if (body.expected >= 0 && (size_t)body.expected - total < length) {
+      length = (size_t)body.expected - total;
+    }
+    int count = stream.read(chunk, length);
+    if (count <= 0) {
+      continue;
+    }
+    total += count;
+    response.bodyLength = total;
+    if (target->capture != nullptr) {
+      target->capture->add(chunk, count);
+    }
+    if (total > body.maxBodySize) {
+      response.error = "Response body exceeds " + String((unsigned long)body.maxBodySize) + " bytes";
+      return false;
+    }
+    if (!target->onChunk(chunk, count, target->context)) {
+      response.error = "Failed to process response body";
+      return false;
+    }
+  }
+  if (body.expected >= 0 && total < (size_t)body.expected) {
+    response.error = "Connection closed before end of response body";
+    return false;
+  }
+  response.success = true;
+  return true;
+}
+
+struct StreamTarget : BodyTarget {
+  SecureHTTPClient::BodyHandler onBody;
+  void* context;
+};
+
+static bool readStream(WiFiClient& stream, const BodyRequest& body, SecureHTTPClient::Response& response,
+                       void* context) {
+  StreamTarget* target = static_cast<StreamTarget*>(context);
+  BoundedStream bounded(stream, body.expected >= 0 ? (size_t)body.expected : body.maxBodySize, body.deadlineMs,
+                        target->capture);
+  bool handled = target->onBody(bounded, target->context);
+  response.bodyLength = bounded.getConsumed();
+  if (bounded.wasCutOff()) {
+    response.error = "Response body exceeds " + String((unsigned long)body.maxBodySize) + " bytes";
+    return false;
+  }
+  if (!handled) {
+    response.error = "Failed to process response body";
+    return false;
+  }
+  response.success = true;
+  // Parsers stop at the end of the document, trailing bytes must still go
+  return body.expected >= 0 && bounded.drain();
+}
+
+struct BufferTarget {
+  char* buffer;
+  size_t used;
+};
+
+static bool copyToBuffer(const uint8_t* data, size_t length, void* context) {
+  BufferTarget* target = static_cast<BufferTarget*>(context);
+  memcpy(target->buffer + target->used, data, length);
+  target->used += length;
+  return true;
+}
+
+// Replays a shared body to a BodyHandler
+class MemoryStream : public Stream {
+public:
+  MemoryStream(const uint8_t* data, size_t length) : data(data), length(length), position(0) {
+    setTimeout(0);
+  }
+
+  int available() override { return (int)(length - position); }
+  int read() override { return position < length ? data[position++] : -1; }
+  int peek() override { return position < length ? data[position] : -1; }
+  size_t write(uint8_t) override { return 0; }
+  void flush() override {}
+
+private:
+  const uint8_t* data;
+  size_t length;
+  size_t position;
+};
+
+// Hands a shared body to the caller's sink or handler, sets success and error
+typedef bool (*BodyReplay)(const uint8_t* data, size_t length, SecureHTTPClient::Response& response,
+                           BodyTarget* target);
+
+static bool replayChunks(const uint8_t* data, size_t length, SecureHTTPClient::Response& response,
+                         BodyTarget* base) {
+  ChunkTarget* target = static_cast<ChunkTarget*>(base);
+  for (size_t offset = 0; offset < length; offset += HTTP_CHUNK_SIZE) {
+    size_t count = length - offset < HTTP_CHUNK_SIZE ? length - offset : HTTP_CHUNK_SIZE;
+    if (!target->onChunk(data + offset, count, target->context)) {
+      response.error = "Failed to process response body";
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool replayStream(const uint8_t* data, size_t length, SecureHTTPClient::Response& response,
+                         BodyTarget* base) {
+  StreamTarget* target = static_cast<StreamTarget*>(base);
+  MemoryStream body(data, length);
+  if (!target->onBody(body, target->context)) {
+    response.error = "Failed to process response body";
+    return false;
+  }
+  return true;
+}
+
+// One request per URL in flight; its result (and body, if small enough) is
+// kept for HTTP_COALESCE_TTL_MS so identical requests arriving meanwhile
+// share it. The flight table is guarded by flightMux, which must not be held
+// while allocating, so bodies are allocated and freed outside of it.
+struct Flight {
+  uint64_t key;          // FNV-1a of the URL, 0 = free
+  bool done;
+  bool shareable;        // Failure, or success with the whole body captured
+  uint8_t readers;       // Callers replaying body right now
+  uint32_t doneMs;
+  bool success;
+  bool deferred;
+  int httpCode;
+  uint32_t retryInMs;
+  size_t bodyLength;
+  SecureHTTPClient::Timings timings;
+  char error[80];
+  uint8_t* body;
+  size_t bodySize;       // Captured bytes
+};
+
+static Flight flights[HTTP_COALESCE_SLOTS];
+static SecureHTTPClient::CoalesceStats coalesceStats = {};
+static portMUX_TYPE flightMux = portMUX_INITIALIZER_UNLOCKED;
+
+static uint64_t urlKey(const char* url) {
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const char* p = url; *p != '\0'; p++) {
+    hash = (hash ^ (uint8_t)*p) * 0x100000001b3ULL;
+  }
+  return hash != 0 ? hash : 1;
+}
+
+// Call with flightMux held
+static Flight* findFlight(uint64_t key) {
+  for (uint8_t i = 0; i < HTTP_COALESCE_SLOTS; i++) {
+    if (flights[i].key == key) {
+      return &flights[i];
+    }
+  }
+  return nullptr;
+}
+
+// Call with flightMux held. Detaches the body, the caller frees it.
+static uint8_t* expireFlight(Flight& flight, uint32_t nowMs) {
+  if (flight.key == 0 || !flight.done || flight.readers > 0 ||
+      nowMs - flight.doneMs < HTTP_COALESCE_TTL_MS) {
+    return nullptr;
+  }
+  uint8_t* body = flight.body;
+  flight.key = 0;
+  flight.body = nullptr;
+  return body;
+}
+
+// Answer response from a finished flight, false if it cannot be shared
+static bool shareFlight(uint64_t key, const SecureHTTPClient::Options& options, BodyReplay replay,
+                        BodyTarget* target, SecureHTTPClient::Response& response) {
+  portENTER_CRITICAL(&flightMux);
+  Flight* flight = findFlight(key);
+  if (flight == nullptr || !flight->done || !flight->shareable ||
+      millis() - flight->doneMs >= HTTP_COALESCE_TTL_MS) {
+    portEXIT_CRITICAL(&flightMux);
+    return false;
+  }
+  flight->readers++;
+  Flight result = *flight;
+  portEXIT_CRITICAL(&flightMux);
+
+  response.success = result.success;
+  response.deferred = result.deferred;
+  response.httpCode = result.httpCode;
+  response.retryInMs = result.retryInMs;
+  response.bodyLength = result.bodyLength;
+  response.timings = result.timings;
+  response.error = result.error;
+  response.shared = true;
+  if (result.success && result.bodySize > options.maxBodySize) {
+    // Sinks rely on the limit (get() copies into the caller's buffer)
+    response.success = false;
+    response.error = "Response body exceeds " + String((unsigned long)options.maxBodySize) + " bytes";
+  } else if (result.success) {
+    response.success = replay(result.body, result.bodySize, response, target);
+  }
+
+  portENTER_CRITICAL(&flightMux);
+  flight->readers--;
+  coalesceStats.shared++;
+  portEXIT_CRITICAL(&flightMux);
+  return true;
+}
+
+/**
+ * perform() with single-flight coalescing: identical requests made while one
+ * is in flight wait for it instead of opening another TLS session, and share
+ * its result. Bodies too large to keep are refetched once the flight landed
+ * (usually on its kept-alive connection).
+ */
+static SecureHTTPClient::Response coalesce(const char* url, const SecureHTTPClient::Options& options,
+                                           BodyReader reader, BodyReplay replay, BodyTarget* target) {
+  SecureHTTPClient::Response response;
+  initResponse(response);
+  target->capture = nullptr;
+  uint64_t key = urlKey(url);
+  uint32_t startMs = millis();
+
+  // Join a flight in progress
+  bool waited = false;
+  for (;;) {
+    portENTER_CRITICAL(&flightMux);
+    Flight* flight = findFlight(key);
+    bool inFlight = flight != nullptr && !flight->done;
+    if (inFlight && !waited) {
+      coalesceStats.waited++;
+    }
+    portEXIT_CRITICAL(&flightMux);
+    if (!inFlight) {
+      break;
+    }
+    if (millis() - startMs >= options.totalTimeoutMs) {
+      response.httpCode = HTTPC_ERROR_READ_TIMEOUT;
+      response.error = "Timeout waiting for identical request";
+      return response;
+    }
+    waited = true;
+    delay(10);
+  }
+  if (shareFlight(key, options, replay, target, response)) {
+    return response;
+  }
+
+  // Lead a new flight. Expired flights are reclaimed here and in maintain().
+  uint8_t* expired[HTTP_COALESCE_SLOTS] = {};
+  Flight* flight = nullptr;
+  uint32_t nowMs = millis();
+  portENTER_CRITICAL(&flightMux);
+  for (uint8_t i = 0; i < HTTP_COALESCE_SLOTS; i++) {
+    expired[i] = expireFlight(flights[i], nowMs);
+  }
+  flight = findFlight(key);
+  if (flight != nullptr && flight->readers > 0) {
+    flight = nullptr;  // Unshareable result still being read, don't touch it
+  } else if (flight == nullptr) {
+    flight = findFlight(0);
+  }
+  uint8_t* stale = nullptr;
+  if (flight != nullptr) {
+    stale = flight->body;
+    flight->key = key;
+    flight->done = false;
+    flight->body = nullptr;
+    coalesceStats.leaders++;
+  }
+  portEXIT_CRITICAL(&flightMux);
+  for (uint8_t i = 0; i < HTTP_COALESCE_SLOTS; i++) {
+    free(expired[i]);
+  }
+  free(stale);
+
+  if (flight == nullptr) {
+    // All slots busy with other URLs
+    return perform(url, options, reader, target);
+  }
+
+  size_t captureSize = options.maxBodySize < HTTP_COALESCE_MAX_BODY ? options.maxBodySize : HTTP_COALESCE_MAX_BODY;
+  BodyCapture capture = {static_cast<uint8_t*>(malloc(captureSize)), captureSize, 0, false};
+  target->capture = &capture;
+  response = perform(url, options, reader, target);
+  target->capture = nullptr;
+
+  bool shareable = !response.success || (capture.data != nullptr && !capture.overflow);
+  if (!shareable) {
+    free(capture.data);
+    capture.data = nullptr;
+  }
+  portENTER_CRITICAL(&flightMux);
+  flight->success = response.success;
+  flight->deferred = response.deferred;
+  flight->httpCode = response.httpCode;
+  flight->retryInMs = response.retryInMs;
+  flight->bodyLength = response.bodyLength;
+  flight->timings = response.timings;
+  strncpy(flight->error, response.error.c_str(), sizeof(flight->error) - 1);
+  flight->error[sizeof(flight->error) - 1] = '\0';
+  flight->body = capture.data;
+  flight->bodySize = capture.length;
+  flight->shareable = shareable;
+  flight->readers = 0;
+  flight->doneMs = millis();
+  flight->done = true;
+  if (!shareable) {
+    coalesceStats.uncaptured++;
+  }
+  portEXIT_CRITICAL(&flightMux);
+  return response;
+}
+
+SecureHTTPClient::Response SecureHTTPClient::get(const char* url, char* buffer, size_t bufferSize,
+                                                 const Options& options) {
+  // Room for the terminator, the body limit keeps the copy inside the buffer
+  Options bounded = options;
+  if (bounded.maxBodySize > bufferSize - 1) {
+    bounded.maxBodySize = bufferSize - 1;
+  }
+  BufferTarget target = {buffer, 0};
+  buffer[0] = '\0';
+  Response response = getChunked(url, copyToBuffer, &target, bounded);
+  buffer[target.used] = '\0';
+  return response;
+}
+
+SecureHTTPClient::Response SecureHTTPClient::getChunked(const char* url, ChunkSink onChunk, void* context,
+                                                        const Options& options) {
+  ChunkTarget target;
+  target.onChunk = onChunk;
+  target.context = context;
+  return coalesce(url, options, readChunks, replayChunks, &target);
+}
+
+SecureHTTPClient::Response SecureHTTPClient::getStream(const char* url, BodyHandler onBody, void* context,
+                                                       const Options& options) {
+  StreamTarget target;
+  target.onBody = onBody;
+  target.context = context;
+  return coalesce(url, options, readStream, replayStream, &target);
+}
+
+SecureHTTPClient::Timings SecureHTTPClient::getLastTimings() {
+  portENTER_CRITICAL(&poolMux);
+  Timings timings = lastTimings;
+  portEXIT_CRITICAL(&poolMux);
+  return timings;
+}
+
+HostBackoff::State SecureHTTPClient::getHostState(const char* url) {
+  char host[HOST_BACKOFF_NAME_LEN];
+  hostFromUrl(url, host, sizeof(host));
+  portENTER_CRITICAL(&backoffMux);
+  HostBackoff::State state = hostBackoff.getState(host);
+  portEXIT_CRITICAL(&backoffMux);
+  return state;
+}
+
+HostBackoff SecureHTTPClient::getHostBackoff() {
+  portENTER_CRITICAL(&backoffMux);
+  HostBackoff copy = hostBackoff;
+  portEXIT_CRITICAL(&backoffMux);
+  return copy;
+}
+
+SecureHTTPClient::PoolStats SecureHTTPClient::getPoolStats() {
+  portENTER_CRITICAL(&poolMux);
+  PoolStats stats = poolStats;
+  LatencySamples<16> samples = handshakeSamples;
+  stats.open = 0;
+  for (uint8_t i = 0; i < HTTP_POOL_SIZE; i++) {
+    if (pool[i].open) {
+      stats.open++;
+    }
+  }
+  portEXIT_CRITICAL(&poolMux);
+
+  stats.handshakeP50Ms = samples.percentile(50);
+  stats.handshakeP90Ms = samples.percentile(90);
+  return stats;
+}
+
+SecureHTTPClient::CoalesceStats SecureHTTPClient::getCoalesceStats() {
+  portENTER_CRITICAL(&flightMux);
+  CoalesceStats stats = coalesceStats;
+  portEXIT_CRITICAL(&flightMux);
+  return stats;
+}
+
+SecureHTTPClient::TrustStats SecureHTTPClient::getTrustStats() {
+  portENTER_CRITICAL(&poolMux);
+  TrustStats stats = trustStats;
+  LatencySamples<16> verified = verifiedSamples;
+  LatencySamples<16> unverified = unverifiedSamples;
+  portEXIT_CRITICAL(&poolMux);
+
+  stats.verifiedP50Ms = verified.percentile(50);
+  stats.verifiedP90Ms = verified.percentile(90);
+  stats.unverifiedP50Ms = unverified.percentile(50);
+  stats.unverifiedP90Ms = unverified.percentile(90);
+  return stats;
+}
+
+void SecureHTTPClient::maintain() {
+  uint32_t nowMs = millis();
+  if (nowMs - lastMaintainMs < 1000) {
+    return;
+  }
+  lastMaintainMs = nowMs;
+
+  // Release bodies of flights whose result expired
+  uint8_t* expired[HTTP_COALESCE_SLOTS];
+  portENTER_CRITICAL(&flightMux);
+  for (uint8_t i = 0; i < HTTP_COALESCE_SLOTS; i++) {
+    expired[i] = expireFlight(flights[i], nowMs);
+  }
+  portEXIT_CRITICAL(&flightMux);
+  for (uint8_t i = 0; i < HTTP_COALESCE_SLOTS; i++) {
+    free(expired[i]);
+  }
+
+  bool lowHeap = ESP.getFreeHeap() < HTTP_POOL_MIN_FREE_HEAP;
+  for (uint8_t i = 0; i < HTTP_POOL_SIZE; i++) {
+    PooledConnection& conn = pool[i];
+    portENTER_CRITICAL(&poolMux);
+    bool idle = !conn.inUse && conn.client != nullptr;
+    if (idle) {
+      conn.inUse = true;
+    }
+    portEXIT_CRITICAL(&poolMux);
+    if (!idle) {
+      continue;
+    }
+
+    bool expired = nowMs - conn.lastUsedMs >= HTTP_POOL_IDLE_MS;
+    if ((expired || lowHeap) && conn.client->connected()) {
+      closeConnection(conn);
+      portENTER_CRITICAL(&poolMux);
+      if (lowHeap) {
+        poolStats.closedLowHeap++;
+      } else {
+        poolStats.closedIdle++;
+      }
+      portEXIT_CRITICAL(&poolMux);
+      LOG_DEBUGF("Closed idle connection to %s%s", conn.host, lowHeap ? " (low heap)" : "");
+    }
+
+    bool open = conn.client->connected();
+    portENTER_CRITICAL(&poolMux);
+    conn.open = open;
+    conn.inUse = false;
+    portEXIT_CRITICAL(&poolMux);
+  }
+}
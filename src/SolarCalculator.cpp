@@ -0,0 +1,107 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SolarCalculator.h"
+#include <math.h>
+
+static const double DEG_TO_RAD_FACTOR = M_PI / 180.0;
+static const double J2000 = 2451545.0;
+static const double UNIX_EPOCH_JD = 2440587.5;
+
+// Julian day number of a Gregorian calendar date (at noon)
+static int32_t julianDayNumber(int year, int month, int day) {
+  int32_t a = (14 - month) / 12;
+  int32_t y = year + 4800 - a;
+  int32_t m = month + 12 * a - 3;
+  return day + (153 * m + 2) / 5 + 365 * y + y / 4 - y / 100 + y / 400 - 32045;
+}
+
+static int64_t julianToUnix(double julian) {
+  return (int64_t)llround((julian - UNIX_EPOCH_JD) * 86400.0);
+}
+
+struct SunPosition {
+  double anomaly;            // Mean anomaly (radians)
+  double eclipticLongitude;  // Radians
+  double declination;        // Radians
+};
+
+// Position of the sun, days since J2000
+static SunPosition sunPosition(double days) {
+  SunPosition sun;
+  sun.anomaly = fmod(357.5291 + 0.98560028 * days, 360.0) * DEG_TO_RAD_FACTOR;
+  double center = 1.9148 * sin(sun.anomaly) + 0.0200 * sin(2.0 * sun.anomaly) + 0.0003 * sin(3.0 * sun.anomaly);
+  // Perihelion moves 1.7 degrees a century, ignoring it is off by a day by now
+  double perihelion = 102.9372 + 4.70935e-5 * days;
+  sun.eclipticLongitude = fmod(sun.anomaly / DEG_TO_RAD_FACTOR + center + 180.0 + perihelion, 360.0) * DEG_TO_RAD_FACTOR;
+  sun.declination = asin(sin(sun.eclipticLongitude) * sin(23.4397 * DEG_TO_RAD_FACTOR));
+  return sun;
+}
+
+/**
+ * Hour angle at which the sun crosses an altitude
+ * @return Hour angle in degrees, or a SolarEvent other than Normal
+ */
+static SolarEvent hourAngle(double altitude, double latitude, double declination, double& angle) {
+  double cosAngle = (sin(altitude * DEG_TO_RAD_FACTOR) - sin(latitude * DEG_TO_RAD_FACTOR) * sin(declination)) /
+                    (cos(latitude * DEG_TO_RAD_FACTOR) * cos(declination));
+  if (cosAngle > 1.0) {
+    return SolarEvent::AlwaysBelow;
+  }
+  if (cosAngle < -1.0) {
+    return SolarEvent::AlwaysAbove;
+  }
+  angle = acos(cosAngle) / DEG_TO_RAD_FACTOR;
+  return SolarEvent::Normal;
+}
+
+/**
+ * Rise and set across an altitude. The declination changes by up to 0.4
+ * degrees a day, so each time is refined once with the declination at the
+ * event itself (minutes at high latitudes around the equinoxes).
+ * @return Whether the sun crosses the altitude, judged at transit
+ */
+static SolarEvent crossings(double altitude, double latitude, double transit, double declination,
+                            int64_t& rise, int64_t& set) {
+  double angle = 0.0;
+  SolarEvent event = hourAngle(altitude, latitude, declination, angle);
+  double riseAngle = angle;
+  double setAngle = angle;
+  if (event == SolarEvent::Normal) {
+    // Keeps the transit estimate where the refined declination no longer crosses
+    hourAngle(altitude, latitude, sunPosition(transit - angle / 360.0 - J2000).declination, riseAngle);
+    hourAngle(altitude, latitude, sunPosition(transit + angle / 360.0 - J2000).declination, setAngle);
+  }
+  rise = julianToUnix(transit - riseAngle / 360.0);
+  set = julianToUnix(transit + setAngle / 360.0);
+  return event;
+}
+
+void computeSolarTimes(int year, int month, int day, double latitude, double longitude, SolarTimes& times) {
+  // Mean solar time of local noon, days since J2000
+  double meanNoon = (double)(julianDayNumber(year, month, day) - (int32_t)J2000) - longitude / 360.0;
+
+  SunPosition sun = sunPosition(meanNoon);
+  double transit = J2000 + meanNoon + 0.0053 * sin(sun.anomaly) - 0.0069 * sin(2.0 * sun.eclipticLongitude);
+  times.noon = julianToUnix(transit);
+
+  times.sun = crossings(-0.833, latitude, transit, sun.declination, times.sunrise, times.sunset);
+  times.civil = crossings(-6.0, latitude, transit, sun.declination, times.dawn, times.dusk);
+}
@@ -0,0 +1,93 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TimezoneGrid.h"
+#include "tz_grid.h"
+#include <string.h>
+
+// Table layout, see scripts/gen_tz_grid.py
+static const uint8_t HEADER_SIZE = 20;
+static const uint8_t ROW_START_SIZE = 4;
+static const uint8_t RUN_SIZE = 4;
+static const uint8_t ZONE_RECORD_SIZE = 4;
+
+// Little endian fields, read byte by byte
+static uint16_t readU16(const uint8_t* p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t readU32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+TimezoneGrid::TimezoneGrid(const uint8_t* table)
+  : table(table), columns(0), rows(0), zoneCount(0), cellsPerDegree(0),
+    rowStarts(nullptr), runs(nullptr), zones(nullptr), pool(nullptr) {
+  if (table == nullptr || memcmp(table, "TZG1", 4) != 0) {
+    return;
+  }
+  columns = readU16(table + 4);
+  rows = readU16(table + 6);
+  zoneCount = readU16(table + 8);
+  cellsPerDegree = table[10];
+  rowStarts = table + HEADER_SIZE;
+  runs = rowStarts + ((uint32_t)rows + 1) * ROW_START_SIZE;
+  zones = table + readU32(table + 12);
+  pool = (const char*)table + readU32(table + 16);
+}
+
+const char* TimezoneGrid::lookup(float latitude, float longitude) const {
+  if (rows == 0 || !(latitude >= -90.0f && latitude <= 90.0f) || !(longitude >= -180.0f && longitude <= 180.0f)) {
+    return nullptr;
+  }
+
+  // Poles and the antimeridian belong to the last row/column
+  uint16_t row = (uint16_t)((90.0f - latitude) * cellsPerDegree);
+  uint16_t column = (uint16_t)((longitude + 180.0f) * cellsPerDegree);
+  if (row >= rows) {
+    row = rows - 1;
+  }
+  if (column >= columns) {
+    column = columns - 1;
+  }
+
+  // First run of the row ending after the column
+  uint32_t low = readU32(rowStarts + (uint32_t)row * ROW_START_SIZE);
+  uint32_t high = readU32(rowStarts + ((uint32_t)row + 1) * ROW_START_SIZE);
+  while (low < high) {
+    uint32_t middle = low + (high - low) / 2;
+    if (readU16(runs + middle * RUN_SIZE + 2) <= column) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+
+  uint16_t zoneIndex = readU16(runs + low * RUN_SIZE);
+  if (zoneIndex >= zoneCount) {
+    return nullptr;
+  }
+  return pool + readU32(zones + (uint32_t)zoneIndex * ZONE_RECORD_SIZE);
+}
+
+const TimezoneGrid& getTimezoneGrid() {
+  static const TimezoneGrid grid(TZ_GRID);
+  return grid;
+}
@@ -0,0 +1,46 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TrustStore.h"
+#include "trust_anchors.h"
+#include <string.h>
+
+struct HostAnchors {
+  const char* host;
+  const uint8_t* bundle;
+};
+
+static const HostAnchors hostAnchors[] = {
+  {"api.open-meteo.com", TRUST_BUNDLE_OPEN_METEO},
+  {"ipapi.co", TRUST_BUNDLE_IPAPI}
+};
+
+const uint8_t* findTrustBundle(const char* host) {
+  for (size_t i = 0; i < sizeof(hostAnchors) / sizeof(hostAnchors[0]); i++) {
+    if (strcmp(hostAnchors[i].host, host) == 0) {
+      return hostAnchors[i].bundle;
+    }
+  }
+  return nullptr;
+}
+
+uint16_t getTrustBundleSize(const uint8_t* bundle) {
+  return bundle != nullptr ? (uint16_t)((bundle[0] << 8) | bundle[1]) : 0;
+}
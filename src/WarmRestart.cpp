@@ -0,0 +1,122 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WarmRestart.h"
+#include "WarmState.h"
+#include "LED_Clock.h"
+#include "BrightnessControl.h"
+#include "Weather.h"
+#include "WiFi_Manager.h"
+#include "Logger.h"
+#include <esp_attr.h>
+#include <esp_system.h>
+#include <esp_private/esp_clk.h>
+#include <sys/time.h>
+
+static_assert(NUM_LEDS * 3 == WARM_STATE_FRAME_BYTES, "Warm state frame size must match NUM_LEDS");
+static_assert(sizeof(CRGB) == 3, "CRGB must be packed RGB");
+
+// RTC slow memory is not cleared on soft resets (lost on power-on; CRC catches that)
+RTC_NOINIT_ATTR static uint8_t warmStateBuffer[WARM_STATE_MAX_BYTES];
+
+static bool warmBoot = false;
+
+// Anything before 2020-01-01 means the clock was never set
+static const time_t MIN_VALID_EPOCH = 1577836800;
+
+static bool isWarmResetReason(esp_reset_reason_t reason) {
+  switch (reason) {
+    case ESP_RST_SW:
+    case ESP_RST_PANIC:
+    case ESP_RST_INT_WDT:
+    case ESP_RST_TASK_WDT:
+    case ESP_RST_WDT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool restoreWarmState(ESP32Time& rtc) {
+  if (!isWarmResetReason(esp_reset_reason())) {
+    LOG_DEBUG("Cold boot - no warm state");
+    return false;
+  }
+
+  WarmStateData state;
+  if (!deserializeWarmState(warmStateBuffer, sizeof(warmStateBuffer), state)) {
+    LOG_WARN("Warm state invalid - starting cold");
+    return false;
+  }
+
+  // The system clock usually survives a soft reset; if not, estimate it from
+  // the saved epoch and the RTC slow clock which keeps running
+  uint64_t nowMonotonicUs = esp_clk_rtc_time();
+  if (rtc.getEpoch() < MIN_VALID_EPOCH && state.epochUs > 0 && nowMonotonicUs >= state.monotonicUs) {
+    int64_t estimateUs = state.epochUs + (int64_t)(nowMonotonicUs - state.monotonicUs);
+    struct timeval tv;
+    tv.tv_sec = estimateUs / 1000000LL;
+    tv.tv_usec = estimateUs % 1000000LL;
+    settimeofday(&tv, nullptr);
+  }
+
+  // Show the last frame immediately, then the estimated time
+  memcpy((uint8_t*)leds, state.frame, WARM_STATE_FRAME_BYTES);
+  restoreBrightnessState(state.mainBrightness, state.colonBrightness);
+  FastLED.setBrightness(state.mainBrightness);
+  FastLED.show();
+
+  if (state.temperatureEpoch != 0 && !isWeatherError(state.temperature)) {
+    restoreWeatherState(state.temperature, state.temperatureEpoch);
+  }
+
+  warmBoot = true;
+  if (rtc.getEpoch() >= MIN_VALID_EPOCH) {
+    applySavedTimezone();
+    displayTime(rtc);
+    LOG_INFOF("Warm boot - estimated time %02d:%02d:%02d", rtc.getHour(true), rtc.getMinute(), rtc.getSecond());
+  } else {
+    LOG_INFO("Warm boot - restored last frame");
+  }
+  return true;
+}
+
+void saveWarmState() {
+  struct timeval now;
+  gettimeofday(&now, nullptr);
+  if (now.tv_sec < MIN_VALID_EPOCH) {
+    return;
+  }
+
+  WarmStateData state;
+  state.epochUs = (int64_t)now.tv_sec * 1000000LL + now.tv_usec;
+  state.monotonicUs = esp_clk_rtc_time();
+  state.mainBrightness = getCurrentMainBrightness();
+  state.colonBrightness = getCurrentColonBrightness();
+  state.temperature = owmTemperature;
+  state.temperatureEpoch = owmTemperatureEpoch;
+  memcpy(state.frame, (const uint8_t*)leds, WARM_STATE_FRAME_BYTES);
+
+  serializeWarmState(state, warmStateBuffer, sizeof(warmStateBuffer));
+}
+
+bool isWarmBoot() {
+  return warmBoot;
+}
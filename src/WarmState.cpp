@@ -0,0 +1,115 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WarmState.h"
+#include <string.h>
+
+uint32_t warmStateCrc32(const uint8_t* data, size_t length) {
+  uint32_t crc = 0xFFFFFFFFUL;
+  for (size_t i = 0; i < length; i++) {
+    crc ^= data[i];
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320UL & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+// Little endian helpers so the layout does not depend on struct padding
+static uint8_t* putU32(uint8_t* p, uint32_t value) {
+  for (uint8_t i = 0; i < 4; i++) {
+    *p++ = (uint8_t)(value >> (8 * i));
+  }
+  return p;
+}
+
+static uint8_t* putU64(uint8_t* p, uint64_t value) {
+  for (uint8_t i = 0; i < 8; i++) {
+    *p++ = (uint8_t)(value >> (8 * i));
+  }
+  return p;
+}
+
+static uint32_t getU32(const uint8_t*& p) {
+  uint32_t value = 0;
+  for (uint8_t i = 0; i < 4; i++) {
+    value |= (uint32_t)(*p++) << (8 * i);
+  }
+  return value;
+}
+
+static uint64_t getU64(const uint8_t*& p) {
+  uint64_t value = 0;
+  for (uint8_t i = 0; i < 8; i++) {
+    value |= (uint64_t)(*p++) << (8 * i);
+  }
+  return value;
+}
+
+size_t serializeWarmState(const WarmStateData& state, uint8_t* buffer, size_t bufferSize) {
+  if (buffer == nullptr || bufferSize < WARM_STATE_MAX_BYTES) {
+    return 0;
+  }
+
+  uint8_t* p = buffer;
+  p = putU32(p, WARM_STATE_MAGIC);
+  *p++ = WARM_STATE_VERSION;
+  p = putU64(p, (uint64_t)state.epochUs);
+  p = putU64(p, state.monotonicUs);
+  *p++ = state.mainBrightness;
+  *p++ = state.colonBrightness;
+  *p++ = (uint8_t)state.temperature;
+  p = putU32(p, state.temperatureEpoch);
+  memcpy(p, state.frame, WARM_STATE_FRAME_BYTES);
+  p += WARM_STATE_FRAME_BYTES;
+
+  uint32_t crc = warmStateCrc32(buffer, p - buffer);
+  p = putU32(p, crc);
+  return p - buffer;
+}
+
+bool deserializeWarmState(const uint8_t* buffer, size_t bufferSize, WarmStateData& state) {
+  if (buffer == nullptr || bufferSize < WARM_STATE_MAX_BYTES) {
+    return false;
+  }
+
+  const uint8_t* p = buffer;
+  if (getU32(p) != WARM_STATE_MAGIC) {
+    return false;
+  }
+  if (*p++ != WARM_STATE_VERSION) {
+    return false;
+  }
+
+  const uint8_t* crcPos = buffer + WARM_STATE_MAX_BYTES - 4;
+  const uint8_t* crcRead = crcPos;
+  if (getU32(crcRead) != warmStateCrc32(buffer, crcPos - buffer)) {
+    return false;
+  }
+
+  state.epochUs = (int64_t)getU64(p);
+  state.monotonicUs = getU64(p);
+  state.mainBrightness = *p++;
+  state.colonBrightness = *p++;
+  state.temperature = (int8_t)*p++;
+  state.temperatureEpoch = getU32(p);
+  memcpy(state.frame, p, WARM_STATE_FRAME_BYTES);
+  return true;
+}
@@ -21,17 +21,177 @@
 #include "Weather.h"
 #include "Logger.h"
 #include "ConfigManager.h"
+#include "ConfigStorage.h"
+#include "ForecastCache.h"
 #include "WiFi_Manager.h"
 #include "SecureHTTPClient.h"
+#include "DnsResolver.h"
 #include <ArduinoJson.h>
 
 extern ConfigManager configManager;
 
 int8_t owmTemperature = static_cast<int8_t>(WeatherStatus::NotYetFetched);
+uint32_t owmTemperatureEpoch = 0;
 
-// Retry logic for transient failures
-static uint8_t weatherFetchRetries = 0;
-const uint8_t MAX_WEATHER_RETRIES = 3;
+// Delayed fetch (schedule skew, retry after a failure)
+static bool fetchPending = false;
+static uint32_t fetchRequestedMs = 0;
+static uint32_t fetchDelayMs = 0;
+static uint32_t fetchRuns = 0;
+
+static WeatherFetchStats fetchStats = {};
+
+// Configured locations (0 = primary, owmTemperature) and their hourly forecasts,
+// kept across fetches and reboots
+static WeatherLocation locations[WEATHER_MAX_LOCATIONS];
+static uint8_t locationCount = 0;
+static ForecastCache forecasts[WEATHER_MAX_LOCATIONS];
+static int8_t extraTemperatures[WEATHER_MAX_LOCATIONS];
+static bool forecastLoaded = false;
+
+// Clock is considered set after 2020-01-01
+static const uint32_t MIN_VALID_EPOCH = 1577836800;
+
+static const char* WEATHER_API_HOST = "api.open-meteo.com";
+
+// Parse state handed to the body handler
+struct WeatherParse {
+  WeatherStatus status;
+  DeserializationError error;
+  uint32_t heapAtBody;
+};
+
+static void setTemperature(uint8_t index, int8_t temperature) {
+  if (index == 0) {
+    owmTemperature = temperature;
+  } else {
+    extraTemperatures[index] = temperature;
+  }
+}
+
+// Primary location from the location settings, labelled extras from weatherLocations
+static void loadLocations(const Config& cfg) {
+  locations[0].label = '\0';
+  locations[0].latitude = cfg.locationLatitude.toFloat();
+  locations[0].longitude = cfg.locationLongitude.toFloat();
+  uint8_t extras = 0;
+  if (!parseWeatherLocations(cfg.weatherLocations.c_str(), &locations[1], WEATHER_MAX_LOCATIONS - 1, extras)) {
+    LOG_WARN("Invalid weatherLocations - showing the primary location only");
+    extras = 0;
+  }
+  locationCount = 1 + extras;
+}
+
+// One location object; the filter keeps only the hourly series, parsed straight into its ring
+static bool parseForecastObject(Stream& body, WeatherParse* parse, uint8_t index) {
+  StaticJsonDocument<96> filter;
+  filter["hourly"]["time"] = true;
+  filter["hourly"]["temperature_2m"] = true;
+  filter["hourly_units"]["temperature_2m"] = true;
+
+  StaticJsonDocument<WEATHER_JSON_DOC_SIZE> doc;
+  parse->error = deserializeJson(doc, body, DeserializationOption::Filter(filter));
+  if (parse->error) {
+    return false;
+  }
+
+  JsonArrayConst times = doc["hourly"]["time"];
+  JsonArrayConst temperatures = doc["hourly"]["temperature_2m"];
+  if (times.isNull() || temperatures.isNull() || times.size() == 0 || times.size() != temperatures.size()) {
+    LOG_ERROR("Hourly temperatures missing in API response");
+    return false;
+  }
+
+  const char* unit = doc["hourly_units"]["temperature_2m"] | "";
+  bool isFahrenheit = strchr(unit, 'F') != nullptr;
+  if (!isFahrenheit && strchr(unit, 'C') == nullptr) {
+    LOG_ERRORF("Unrecognized temperature unit: %s", unit);
+    parse->status = WeatherStatus::InvalidUnit;
+    return false;
+  }
+
+  ForecastCache& forecast = forecasts[index];
+  resetForecast(forecast, (uint32_t)time(nullptr), locations[index].latitude, locations[index].longitude, isFahrenheit);
+  for (size_t i = 0; i < times.size(); i++) {
+    if (!temperatures[i].isNull()) {
+      addForecastPoint(forecast, times[i].as<uint32_t>(), temperatures[i].as<float>());
+    }
+  }
+  return forecast.count > 0;
+}
+
+// A single location returns one object, several return an array in request order
+static bool parseForecastBody(Stream& body, void* context) {
+  WeatherParse* parse = static_cast<WeatherParse*>(context);
+  parse->heapAtBody = ESP.getFreeHeap();
+  parse->status = WeatherStatus::APIFailed;
+
+  if (locationCount > 1 && !body.find("[")) {
+    return false;
+  }
+  for (uint8_t i = 0; i < locationCount; i++) {
+    if (!parseForecastObject(body, parse, i)) {
+      return false;
+    }
+    if (i + 1 < locationCount && !body.findUntil(",", "]")) {
+      LOG_ERROR("Fewer locations in API response than requested");
+      return false;
+    }
+  }
+  parse->status = WeatherStatus::Valid;
+  return true;
+}
+
+// Current temperatures interpolated from the forecasts, in the configured unit
+static bool updateTemperaturesFromForecast(const Config& cfg, uint32_t now) {
+  bool needMetric = cfg.locationUnits == "metric";
+  for (uint8_t i = 0; i < locationCount; i++) {
+    const ForecastCache& forecast = forecasts[i];
+    float temperature;
+    if (!forecastCovers(forecast, now, locations[i].latitude, locations[i].longitude) ||
+        !forecastTemperatureAt(forecast, now, temperature)) {
+      return false;
+    }
+    if (needMetric && forecast.fahrenheit) {
+      temperature = (temperature - 32.0f) * 5.0f / 9.0f;
+    } else if (!needMetric && !forecast.fahrenheit) {
+      temperature = (temperature * 9.0f / 5.0f) + 32.0f;
+    }
+    setTemperature(i, (int8_t)lroundf(temperature));
+  }
+  owmTemperatureEpoch = forecasts[0].fetchedEpoch;
+  return true;
+}
+
+// Oldest fetch among the configured locations
+static uint32_t oldestForecastEpoch() {
+  uint32_t oldest = forecasts[0].fetchedEpoch;
+  for (uint8_t i = 1; i < locationCount; i++) {
+    if (forecasts[i].fetchedEpoch < oldest) {
+      oldest = forecasts[i].fetchedEpoch;
+    }
+  }
+  return oldest;
+}
+
+static void setAllTemperatures(WeatherStatus status) {
+  for (uint8_t i = 0; i < locationCount; i++) {
+    setTemperature(i, static_cast<int8_t>(status));
+  }
+}
+
+// Transient errors are retried once the API host's backoff expires; the error
+// is only shown when retrying cannot help (bad unit) or the circuit opened
+static void handleFetchFailure(const char* url, const SecureHTTPClient::Response& response, WeatherStatus status) {
+  if (status == WeatherStatus::InvalidUnit ||
+      SecureHTTPClient::getHostState(url) == HostBackoff::State::Open) {
+    setAllTemperatures(status);
+  }
+  if (response.retryInMs > 0) {
+    LOG_INFOF("Will retry weather fetch in %lu s", (unsigned long)(response.retryInMs / 1000));
+    scheduleWeatherFetch(response.retryInMs);
+  }
+}
 
 void fetchWeather() {
   Config& cfg = configManager.getConfig();
@@ -47,102 +207,154 @@ void fetchWeather() {
     return;
   }
 
+  if (!forecastLoaded) {
+    forecastLoaded = true;
+    for (uint8_t i = 0; i < WEATHER_MAX_LOCATIONS; i++) {
+      resetForecast(forecasts[i], 0, 0.0f, 0.0f, false);
+      extraTemperatures[i] = static_cast<int8_t>(WeatherStatus::NotYetFetched);
+    }
+    loadForecastCache(forecasts, WEATHER_MAX_LOCATIONS);
+  }
+  loadLocations(cfg);
+
+  // Serve from the forecasts while they are recent, refetch every few hours
+  uint32_t now = (uint32_t)time(nullptr);
+  bool cached = now >= MIN_VALID_EPOCH && updateTemperaturesFromForecast(cfg, now);
+  if (cached && now - oldestForecastEpoch() < WEATHER_FORECAST_REFRESH_S) {
+    fetchStats.cacheHits++;
+    LOG_DEBUGF("Temperature %d from cached forecast", owmTemperature);
+    return;
+  }
+
   // Check WiFi connection before attempting request
   if (!isWiFiConnected()) {
     LOG_WARN("Weather fetch skipped - WiFi not connected");
-    owmTemperature = static_cast<int8_t>(WeatherStatus::WiFiDisconnected);
+    if (!cached) {
+      setAllTemperatures(WeatherStatus::WiFiDisconnected);
+    }
     return;
   }
 
-  LOG_INFO("Fetching weather from Open-Meteo...");
+  LOG_INFOF("Fetching weather forecast for %d location(s) from Open-Meteo...", locationCount);
 
-  char url[256];
-  snprintf(url, sizeof(url),
-           "https://api.open-meteo.com/v1/forecast?current=temperature_2m&latitude=%s&longitude=%s",
-           cfg.locationLatitude.c_str(), cfg.locationLongitude.c_str());
+  // All locations in one request, comma separated
+  char latitudes[WEATHER_MAX_LOCATIONS * 12];
+  char longitudes[WEATHER_MAX_LOCATIONS * 12];
+  size_t latLen = 0;
+  size_t lonLen = 0;
+  for (uint8_t i = 0; i < locationCount; i++) {
+    latLen += snprintf(latitudes + latLen, sizeof(latitudes) - latLen, "%s%.4f", i ? "," : "", locations[i].latitude);
+    lonLen += snprintf(longitudes + lonLen, sizeof(longitudes) - lonLen, "%s%.4f", i ? "," : "", locations[i].longitude);
+  }
 
-  SecureHTTPClient::Response response = SecureHTTPClient::get(url);
+  bool needMetric = cfg.locationUnits == "metric";
+  char url[384];
+  snprintf(url, sizeof(url),
+           "https://%s/v1/forecast?latitude=%s&longitude=%s&hourly=temperature_2m"
+           "&past_hours=1&forecast_hours=%d&timeformat=unixtime&temperature_unit=%s",
+           WEATHER_API_HOST, latitudes, longitudes, FORECAST_MAX_POINTS - 1, needMetric ? "celsius" : "fahrenheit");
 
-  if (!response.success) {
-    LOG_ERRORF("Weather API request failed: %s", response.error.c_str());
+  // Parse straight from the TLS stream instead of buffering the body in a String
+  WeatherParse parse;
+  parse.status = WeatherStatus::APIFailed;
+  parse.heapAtBody = 0;
+  uint32_t startMs = millis();
+  uint32_t heapBefore = ESP.getFreeHeap();
+  SecureHTTPClient::Response response = SecureHTTPClient::getStream(url, parseForecastBody, &parse);
+  uint32_t heapAfter = ESP.getFreeHeap();
 
-    if (weatherFetchRetries < MAX_WEATHER_RETRIES) {
-      weatherFetchRetries++;
-      LOG_INFOF("Will retry weather fetch (attempt %d/%d on next schedule)",
-                weatherFetchRetries, MAX_WEATHER_RETRIES);
-    } else {
-      owmTemperature = static_cast<int8_t>(WeatherStatus::APIFailed);
-      weatherFetchRetries = 0;
+  if (response.deferred) {
+    fetchStats.deferred++;
+    LOG_INFOF("Weather fetch deferred: %s", response.error.c_str());
+    if (!cached) {
+      handleFetchFailure(url, response, WeatherStatus::APIFailed);
     }
     return;
   }
 
-  LOG_DEBUG("Weather API response received");
+  fetchStats.fetches++;
+  fetchStats.durationMs = millis() - startMs;
+  fetchStats.heapBefore = heapBefore;
+  fetchStats.heapAtBody = parse.heapAtBody;
+  fetchStats.heapAfter = heapAfter;
+  fetchStats.minFreeHeap = ESP.getMinFreeHeap();
+  LOG_DEBUGF("Weather fetch heap: %u before, %u at body, %u after (%u ms)",
+             heapBefore, parse.heapAtBody, heapAfter, fetchStats.durationMs);
 
-  DynamicJsonDocument jsonBuffer(2048);
-  DeserializationError error = deserializeJson(jsonBuffer, response.payload);
-  if (error) {
-    LOG_ERRORF("Weather JSON parsing failed: %s", error.c_str());
-
-    if (weatherFetchRetries < MAX_WEATHER_RETRIES) {
-      weatherFetchRetries++;
-      LOG_INFOF("Will retry weather fetch (attempt %d/%d on next schedule)",
-                weatherFetchRetries, MAX_WEATHER_RETRIES);
+  if (!response.success) {
+    if (parse.error) {
+      LOG_ERRORF("Weather JSON parsing failed: %s", parse.error.c_str());
     } else {
-      owmTemperature = static_cast<int8_t>(WeatherStatus::APIFailed);
-      weatherFetchRetries = 0;
+      LOG_ERRORF("Weather API request failed: %s", response.error.c_str());
+    }
+    fetchStats.failures++;
+    if (cached) {
+      // Outage stays invisible while the forecasts cover the current hour
+      LOG_INFO("Showing temperature from cached forecast");
+    } else {
+      handleFetchFailure(url, response,
+                         parse.status == WeatherStatus::InvalidUnit ? WeatherStatus::InvalidUnit : WeatherStatus::APIFailed);
     }
     return;
   }
 
-  // Success - reset retry counter
-  weatherFetchRetries = 0;
+  saveForecastCache(forecasts, locationCount);
 
-  // Parse temperature value
-  if (!jsonBuffer.containsKey("current") || !jsonBuffer["current"].containsKey("temperature_2m")) {
-    LOG_ERROR("Temperature field missing in API response");
-    owmTemperature = static_cast<int8_t>(WeatherStatus::APIFailed);
+  if (!updateTemperaturesFromForecast(cfg, now)) {
+    LOG_ERROR("Forecast does not cover the current time");
+    setAllTemperatures(WeatherStatus::APIFailed);
     return;
   }
+  LOG_INFOF("Temperature: %d%s (%d hourly points cached)", owmTemperature, needMetric ? "°C" : "°F", forecasts[0].count);
+}
 
-  float tempValue = jsonBuffer["current"]["temperature_2m"];
+void scheduleWeatherFetch(uint32_t delayMs) {
+  // Resolve the API host during the delay when the fetch will go to the network
+  uint32_t now = (uint32_t)time(nullptr);
+  if (!forecastLoaded || now - oldestForecastEpoch() >= WEATHER_FORECAST_REFRESH_S) {
+    dnsPrefetch(WEATHER_API_HOST);
+  }
+  fetchPending = true;
+  fetchRequestedMs = millis();
+  fetchDelayMs = delayMs;
+}
 
-  // Parse temperature unit
-  if (!jsonBuffer.containsKey("current_units") || !jsonBuffer["current_units"].containsKey("temperature_2m")) {
-    LOG_ERROR("Temperature unit missing in API response");
-    owmTemperature = static_cast<int8_t>(WeatherStatus::InvalidUnit);
-    return;
+void serviceWeatherFetch() {
+  if (fetchPending && millis() - fetchRequestedMs >= fetchDelayMs) {
+    fetchPending = false;
+    fetchWeather();
+    fetchRuns++;
   }
+}
 
-  String tempUnit = jsonBuffer["current_units"]["temperature_2m"].as<String>();
+uint32_t getWeatherFetchRuns() {
+  return fetchRuns;
+}
 
-  // Determine if conversion needed
-  bool isCelsius = tempUnit.indexOf("°C") >= 0 || tempUnit.indexOf("C") >= 0;
-  bool isFahrenheit = tempUnit.indexOf("°F") >= 0 || tempUnit.indexOf("F") >= 0;
+uint8_t getWeatherLocationCount() {
+  return locationCount > 0 ? locationCount : 1;
+}
 
-  if (!isCelsius && !isFahrenheit) {
-    LOG_ERRORF("Unrecognized temperature unit: %s", tempUnit.c_str());
-    owmTemperature = static_cast<int8_t>(WeatherStatus::InvalidUnit);
-    return;
+int8_t getWeatherTemperature(uint8_t index) {
+  if (index == 0 || index >= locationCount) {
+    return owmTemperature;
   }
+  return extraTemperatures[index];
+}
 
-  // Convert if needed
-  bool needMetric = cfg.locationUnits == "metric";
-  bool needImperial = cfg.locationUnits == "imperial";
+char getWeatherLocationLabel(uint8_t index) {
+  return index < locationCount ? locations[index].label : '\0';
+}
 
-  if ((needMetric && isFahrenheit) || (needImperial && isCelsius)) {
-    if (needMetric) {
-      // Convert F to C
-      tempValue = (tempValue - 32.0) * 5.0 / 9.0;
-      LOG_DEBUGF("Converted %s to °C", tempUnit.c_str());
-    } else {
-      // Convert C to F
-      tempValue = (tempValue * 9.0 / 5.0) + 32.0;
-      LOG_DEBUGF("Converted %s to °F", tempUnit.c_str());
-    }
-  }
+WeatherFetchStats getWeatherFetchStats() {
+  WeatherFetchStats stats = fetchStats;
+  stats.forecastPoints = forecasts[0].count;
+  stats.forecastEpoch = forecasts[0].fetchedEpoch;
+  return stats;
+}
 
-  // Round to integer
-  owmTemperature = (int8_t)round(tempValue);
-  LOG_INFOF("Temperature: %d%s", owmTemperature, needMetric ? "°C" : "°F");
+void restoreWeatherState(int8_t temperature, uint32_t fetchedEpoch) {
+  owmTemperature = temperature;
+  owmTemperatureEpoch = fetchedEpoch;
+  LOG_INFOF("Restored temperature %d from warm state", temperature);
 }
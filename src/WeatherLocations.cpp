@@ -0,0 +1,63 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WeatherLocations.h"
+#include <stdlib.h>
+#include <string.h>
+
+bool parseWeatherLocations(const char* text, WeatherLocation* out, uint8_t maxCount, uint8_t& count) {
+  count = 0;
+  if (strlen(text) > WEATHER_LOCATIONS_MAX_LEN) {
+    return false;
+  }
+  const char* p = text;
+  while (*p != '\0') {
+    while (*p == ' ' || *p == ';') {
+      p++;
+    }
+    if (*p == '\0') {
+      break;
+    }
+    if (count >= maxCount || strchr(WEATHER_LABEL_GLYPHS, *p) == nullptr || p[1] != '=') {
+      return false;
+    }
+    // Negated range checks also reject the nan strtof() accepts
+    char* end;
+    out[count].label = *p;
+    out[count].latitude = strtof(p + 2, &end);
+    if (end == p + 2 || *end != ',' || !(out[count].latitude >= -90.0f && out[count].latitude <= 90.0f)) {
+      return false;
+    }
+    p = end + 1;
+    out[count].longitude = strtof(p, &end);
+    if (end == p || !(out[count].longitude >= -180.0f && out[count].longitude <= 180.0f)) {
+      return false;
+    }
+    p = end;
+    while (*p == ' ') {
+      p++;
+    }
+    if (*p != ';' && *p != '\0') {
+      return false;
+    }
+    count++;
+  }
+  return true;
+}
@@ -23,15 +23,25 @@
 #include "ConfigManager.h"
 #include "Logger.h"
 #include "WiFi_Manager.h"
-#include "web_html.h"
+#include "web_assets.h"
 #include "version.h"
 #include "CronHelper.h"
 #include "BrightnessControl.h"
+#include "BrightnessProfile.h"
+#include "AmbientLight.h"
+#include "BootPipeline.h"
+#include "ClockDiscipline.h"
+#include "WiFiNetworks.h"
+#include "Weather.h"
+#include "SecureHTTPClient.h"
+#include "DnsResolver.h"
+#include "Geolocation.h"
+#include "CityIndex.h"
+#include "TimezoneGrid.h"
+#include "FlashStream.h"
 #include <ESPmDNS.h>
 #include <ArduinoJson.h>
 #include <Update.h>
-#include <WiFiClientSecure.h>
-#include <HTTPClient.h>
 
 static bool restartRequested = false;
 static unsigned long restartRequestTime = 0;
@@ -47,15 +57,86 @@ bool startMDNS(const char* hostname) {
   return true;
 }
 
+// Flash asset responses; only touched from the async_tcp task (handlers and acks)
+struct WebAssetStats {
+  uint32_t requests;
+  uint32_t notModified;   // Answered 304 from If-None-Match
+  uint32_t bytesSent;     // Asset bytes copied from flash into TCP buffers
+  uint32_t lastPeakHeap;  // Heap a response took at most while sending (bytes)
+  uint32_t maxPeakHeap;
+};
+static WebAssetStats webAssetStats = {};
+
+/**
+ * Streams a constant body from flash chunk by chunk as the connection
+ * acknowledges it. Holds no copy of the body: each chunk is copied straight
+ * into the send buffer the server allocates per ack (bounded by the TCP
+ * window), see FlashStream. Tracks the heap it takes from construction to
+ * the last chunk.
+ */
+class FlashResponse : public AsyncAbstractResponse {
+public:
+  FlashResponse(int code, const char* contentType, const uint8_t* content, size_t length)
+    : stream(content, length), heapAtStart(ESP.getFreeHeap()), minHeap(heapAtStart) {
+    _code = code;
+    _contentType = contentType;
+    _contentLength = length;
+  }
+
+  ~FlashResponse() {
+    uint32_t peak = heapAtStart > minHeap ? heapAtStart - minHeap : 0;
+    webAssetStats.lastPeakHeap = peak;
+    if (peak > webAssetStats.maxPeakHeap) {
+      webAssetStats.maxPeakHeap = peak;
+    }
+  }
+
+  bool _sourceValid() const override { return true; }
+
+  size_t _fillBuffer(uint8_t* buffer, size_t maxLength) override {
+    size_t length = stream.read(buffer, maxLength);
+    webAssetStats.bytesSent += length;
+
+    // Called with the chunk buffer allocated, the lowest point of this response
+    uint32_t freeHeap = ESP.getFreeHeap();
+    if (freeHeap < minHeap) {
+      minHeap = freeHeap;
+    }
+    return length;
+  }
+
+private:
+  FlashStream stream;
+  uint32_t heapAtStart;
+  uint32_t minHeap;
+};
+
+// Sends a gzipped asset straight from flash, or 304 if the client already has it
+static void sendGzipAsset(AsyncWebServerRequest* request, const char* contentType, const uint8_t* data,
+                          size_t length, const char* etag, const char* cacheControl) {
+  AsyncWebServerResponse* response;
+  webAssetStats.requests++;
+  if (request->hasHeader("If-None-Match") && request->header("If-None-Match").indexOf(etag) >= 0) {
+    webAssetStats.notModified++;
+    response = request->beginResponse(304);
+  } else {
+    response = new FlashResponse(200, contentType, data, length);
+    response->addHeader("Content-Encoding", "gzip");
+  }
+  response->addHeader("ETag", etag);
+  response->addHeader("Cache-Control", cacheControl);
+  request->send(response);
+}
+
 bool initWebConfig(AsyncWebServer* server) {
   if (!server) {
     LOG_ERROR("Web server is null");
     return false;
   }
 
-  // Test route
+  // Web UI, revalidated on every load (changes with the firmware)
   server->on("/", HTTP_GET, [](AsyncWebServerRequest *request) {
-    request->send(200, "text/html", INDEX_HTML);
+    sendGzipAsset(request, "text/html", INDEX_HTML_GZ, sizeof(INDEX_HTML_GZ), INDEX_HTML_GZ_ETAG, "no-cache");
   });
 
   // Get current configuration
@@ -73,19 +154,27 @@ bool initWebConfig(AsyncWebServer* server) {
     doc["clockSecIndicatorDiff"] = cfg.clockSecIndicatorDiff;
     doc["locationLatitude"] = cfg.locationLatitude;
     doc["locationLongitude"] = cfg.locationLongitude;
+    doc["locationAutoTimezone"] = cfg.locationAutoTimezone;
     doc["locationUnits"] = cfg.locationUnits;
     doc["weatherTempEnabled"] = cfg.weatherTempEnabled;
     doc["weatherTempDisplayTime"] = cfg.weatherTempDisplayTime;
     doc["weatherTempMin"] = cfg.weatherTempMin;
     doc["weatherTempMax"] = cfg.weatherTempMax;
     doc["weatherTempSchedule"] = cfg.weatherTempSchedule;
+    doc["weatherLocations"] = cfg.weatherLocations;
     doc["weatherUpdateSchedule"] = cfg.weatherUpdateSchedule;
+    doc["weatherUpdateSkew"] = cfg.weatherUpdateSkew;
     doc["ledBrightness"] = cfg.ledBrightness;
     doc["ledDimEnabled"] = cfg.ledDimEnabled;
     doc["ledDimBrightness"] = cfg.ledDimBrightness;
     doc["ledDimFadeDuration"] = cfg.ledDimFadeDuration;
     doc["ledDimStartTime"] = cfg.ledDimStartTime;
     doc["ledDimEndTime"] = cfg.ledDimEndTime;
+    doc["ledDimProfile"] = cfg.ledDimProfile;
+    doc["ledDimSolar"] = cfg.ledDimSolar;
+    doc["ledFadeCurve"] = cfg.ledFadeCurve;
+    doc["ledAmbientEnabled"] = cfg.ledAmbientEnabled;
+    doc["ledAmbientCurve"] = cfg.ledAmbientCurve;
     doc["clockUpdateSchedule"] = cfg.clockUpdateSchedule;
 
     String response;
@@ -93,10 +182,11 @@ bool initWebConfig(AsyncWebServer* server) {
     request->send(200, "application/json", response);
   });
 
-  // Get schema
+  // Get schema; the page asks for it by content hash (?v=), that URL never changes content
   server->on("/api/schema", HTTP_GET, [](AsyncWebServerRequest *request) {
-    String schema = configManager.getSchema();
-    request->send(200, "application/json", schema);
+    bool versioned = request->hasParam("v") && request->getParam("v")->value() == SCHEMA_JSON_GZ_VERSION;
+    sendGzipAsset(request, "application/json", SCHEMA_JSON_GZ, sizeof(SCHEMA_JSON_GZ), SCHEMA_JSON_GZ_ETAG,
+                  versioned ? "public, max-age=31536000, immutable" : "no-cache");
   });
 
   // Get version info
@@ -113,121 +203,368 @@ bool initWebConfig(AsyncWebServer* server) {
     request->send(200, "application/json", response);
   });
 
-  // Geolocation lookup
-  server->on("/api/geolocation", HTTP_GET, [](AsyncWebServerRequest *request) {
-    #ifdef DEBUG
-    LOG_DEBUG("Geolocation lookup requested");
-    #endif
-
-    // Check WiFi connection before attempting request
-    if (!isWiFiConnected()) {
-      LOG_WARN("Geolocation lookup skipped - WiFi not connected");
-      request->send(503, "application/json", "{\"success\":false,\"error\":\"WiFi not connected\"}");
-      return;
+  // Boot timeline
+  server->on("/api/boot", HTTP_GET, [](AsyncWebServerRequest *request) {
+    StaticJsonDocument<512> doc;
+    doc["complete"] = isBootComplete();
+    doc["uptimeMs"] = millis();
+    JsonObject stages = doc.createNestedObject("stages");
+    for (uint8_t i = 0; i < static_cast<uint8_t>(BootStage::Count); i++) {
+      BootStage stage = static_cast<BootStage>(i);
+      uint32_t doneMs = getBootStageMillis(stage);
+      if (doneMs > 0) {
+        stages[getBootStageName(stage)] = doneMs;
+      } else {
+        stages[getBootStageName(stage)] = nullptr;
+      }
     }
 
-    // Use do-while(false) pattern for guaranteed cleanup
-    WiFiClientSecure* client = nullptr;
-    HTTPClient* http = nullptr;
-    bool success = false;
-    String responseStr;
+    String response;
+    serializeJson(doc, response);
+    request->send(200, "application/json", response);
+  });
 
-    do {
-      client = new WiFiClientSecure();
-      if (!client) {
-        LOG_ERROR("Failed to allocate WiFiClientSecure");
-        break;
-      }
-      client->setInsecure();
+  // Runtime statistics
+  server->on("/api/stats", HTTP_GET, [](AsyncWebServerRequest *request) {
+    // Heap, not stack: the async_tcp task stack is small
+    DynamicJsonDocument doc(6144);
+
+    WiFiConnectStats wifiStats = getWiFiConnectStats();
+    JsonObject wifi = doc.createNestedObject("wifi");
+    wifi["ssid"] = WiFi.SSID();
+    wifi["bssid"] = WiFi.BSSIDstr();
+    wifi["rssi"] = WiFi.RSSI();
+    wifi["channel"] = WiFi.channel();
+    wifi["connects"] = wifiStats.connects;
+    wifi["directedConnects"] = wifiStats.directedConnects;
+    wifi["scanConnects"] = wifiStats.scanConnects;
+    wifi["directedFallbacks"] = wifiStats.directedFallbacks;
+    wifi["roams"] = wifiStats.roams;
+    JsonObject connectMs = wifi.createNestedObject("connectMs");
+    connectMs["p50"] = wifiStats.p50Ms;
+    connectMs["p90"] = wifiStats.p90Ms;
+    connectMs["p99"] = wifiStats.p99Ms;
+
+    WiFiApStats apStats[WIFI_AP_STATS_SIZE];
+    uint8_t apCount = getWiFiApStats(apStats, WIFI_AP_STATS_SIZE);
+    JsonArray aps = wifi.createNestedArray("aps");
+    for (uint8_t i = 0; i < apCount; i++) {
+      char bssid[18];
+      snprintf(bssid, sizeof(bssid), "%02X:%02X:%02X:%02X:%02X:%02X",
+               apStats[i].bssid[0], apStats[i].bssid[1], apStats[i].bssid[2],
+               apStats[i].bssid[3], apStats[i].bssid[4], apStats[i].bssid[5]);
+      JsonObject ap = aps.createNestedObject();
+      ap["bssid"] = bssid;
+      ap["channel"] = apStats[i].channel;
+      ap["attempts"] = apStats[i].attempts;
+      ap["successes"] = apStats[i].successes;
+      ap["avgConnectMs"] = apStats[i].avgConnectMs;
+    }
 
-      http = new HTTPClient();
-      if (!http) {
-        LOG_ERROR("Failed to allocate HTTPClient");
-        break;
-      }
-      http->setTimeout(5000);
-      http->setFollowRedirects(HTTPC_FORCE_FOLLOW_REDIRECTS);
+    WiFiRecoveryStats recoveryStats = getWiFiRecoveryStats();
+    JsonObject recovery = wifi.createNestedObject("recovery");
+    recovery["state"] = recoveryStats.state;
+    recovery["disconnects"] = recoveryStats.disconnects;
+    recovery["reconnectAttempts"] = recoveryStats.reconnectAttempts;
+    recovery["fullRestarts"] = recoveryStats.fullRestarts;
+    recovery["recoveries"] = recoveryStats.recoveries;
+    recovery["lastOutageMs"] = recoveryStats.lastOutageMs;
+    JsonArray bucketsMs = recovery.createNestedArray("bucketsMs");
+    JsonArray outage = recovery.createNestedArray("outage");
+    JsonArray recover = recovery.createNestedArray("recover");
+    for (uint8_t i = 0; i < DurationHistogram::BUCKETS; i++) {
+      uint32_t bound = DurationHistogram::upperBoundMs(i);
+      if (bound > 0) {
+        bucketsMs.add(bound);
+      }
+      outage.add(recoveryStats.outage->count(i));
+      recover.add(recoveryStats.recover->count(i));
+    }
 
-      if (!http->begin(*client, "https://ipapi.co/json/")) {
-        LOG_ERROR("Failed to initialize HTTPS connection");
-        break;
-      }
+    WeatherFetchStats weatherStats = getWeatherFetchStats();
+    JsonObject weather = doc.createNestedObject("weather");
+    weather["fetches"] = weatherStats.fetches;
+    weather["failures"] = weatherStats.failures;
+    weather["lastDurationMs"] = weatherStats.durationMs;
+    weather["cacheHits"] = weatherStats.cacheHits;
+    weather["deferred"] = weatherStats.deferred;
+    JsonObject forecastInfo = weather.createNestedObject("forecast");
+    forecastInfo["points"] = weatherStats.forecastPoints;
+    forecastInfo["fetchedEpoch"] = weatherStats.forecastEpoch;
+    JsonObject heap = weather.createNestedObject("heap");
+    heap["before"] = weatherStats.heapBefore;
+    heap["atBody"] = weatherStats.heapAtBody;
+    heap["after"] = weatherStats.heapAfter;
+    heap["minFree"] = weatherStats.minFreeHeap;
+
+    JsonObject web = doc.createNestedObject("web");
+    web["requests"] = webAssetStats.requests;
+    web["notModified"] = webAssetStats.notModified;
+    web["bytesSent"] = webAssetStats.bytesSent;
+    JsonObject peakHeap = web.createNestedObject("peakHeap");
+    peakHeap["last"] = webAssetStats.lastPeakHeap;
+    peakHeap["max"] = webAssetStats.maxPeakHeap;
+
+    GeolocationStats geoStats = getGeolocationStats();
+    JsonObject geolocation = doc.createNestedObject("geolocation");
+    geolocation["requests"] = geoStats.requests;
+    geolocation["cacheHits"] = geoStats.cacheHits;
+    geolocation["jobs"] = geoStats.jobs;
+    geolocation["failures"] = geoStats.failures;
+
+    HostBackoff backoff = SecureHTTPClient::getHostBackoff();
+    HostBackoff::Stats httpStats = backoff.getStats();
+    JsonObject http = doc.createNestedObject("http");
+    http["allowed"] = httpStats.allowed;
+    http["deferred"] = httpStats.deferred;
+    http["rejected"] = httpStats.rejected;
+    http["probes"] = httpStats.probes;
+    http["successes"] = httpStats.successes;
+    http["failures"] = httpStats.failures;
+    http["opens"] = httpStats.opens;
+    JsonArray hosts = http.createNestedArray("hosts");
+    uint32_t nowMs = millis();
+    for (uint8_t i = 0; i < backoff.getHostCount(); i++) {
+      const HostBackoff::Host& entry = backoff.getHost(i);
+      JsonObject host = hosts.createNestedObject();
+      host["host"] = entry.name;
+      host["state"] = HostBackoff::getStateName(entry.state);
+      host["failures"] = entry.failures;
+      host["retryInMs"] = backoff.retryInMs(entry.name, nowMs);
+    }
+    SecureHTTPClient::PoolStats poolStats = SecureHTTPClient::getPoolStats();
+    SecureHTTPClient::Timings lastTimings = SecureHTTPClient::getLastTimings();
+    JsonObject last = http.createNestedObject("lastMs");
+    last["dns"] = lastTimings.dnsMs;
+    last["connect"] = lastTimings.connectMs;
+    last["firstByte"] = lastTimings.firstByteMs;
+    last["body"] = lastTimings.bodyMs;
+    last["total"] = lastTimings.totalMs;
+    JsonObject pool = http.createNestedObject("pool");
+    pool["open"] = poolStats.open;
+    pool["requests"] = poolStats.requests;
+    pool["reuses"] = poolStats.reuses;
+    pool["handshakes"] = poolStats.handshakes;
+    pool["staleRetries"] = poolStats.staleRetries;
+    pool["closedIdle"] = poolStats.closedIdle;
+    pool["closedLowHeap"] = poolStats.closedLowHeap;
+    JsonObject handshakeMs = pool.createNestedObject("handshakeMs");
+    handshakeMs["last"] = poolStats.lastHandshakeMs;
+    handshakeMs["p50"] = poolStats.handshakeP50Ms;
+    handshakeMs["p90"] = poolStats.handshakeP90Ms;
+    SecureHTTPClient::TrustStats trustStats = SecureHTTPClient::getTrustStats();
+    JsonObject tls = http.createNestedObject("tls");
+    tls["verified"] = trustStats.verified;
+    tls["unverified"] = trustStats.unverified;
+    tls["rejected"] = trustStats.rejected;
+    tls["failures"] = trustStats.failures;
+    JsonObject verifiedMs = tls.createNestedObject("verifiedMs");
+    verifiedMs["p50"] = trustStats.verifiedP50Ms;
+    verifiedMs["p90"] = trustStats.verifiedP90Ms;
+    JsonObject unverifiedMs = tls.createNestedObject("unverifiedMs");
+    unverifiedMs["p50"] = trustStats.unverifiedP50Ms;
+    unverifiedMs["p90"] = trustStats.unverifiedP90Ms;
+    SecureHTTPClient::CoalesceStats coalesceStats = SecureHTTPClient::getCoalesceStats();
+    JsonObject coalesced = http.createNestedObject("coalesced");
+    coalesced["leaders"] = coalesceStats.leaders;
+    coalesced["waited"] = coalesceStats.waited;
+    coalesced["shared"] = coalesceStats.shared;
+    coalesced["uncaptured"] = coalesceStats.uncaptured;
+
+    DnsCache dns = getDnsCache();
+    DnsCache::Stats dnsStats = dns.getStats();
+    JsonObject dnsInfo = doc.createNestedObject("dns");
+    dnsInfo["hits"] = dnsStats.hits;
+    dnsInfo["negativeHits"] = dnsStats.negativeHits;
+    dnsInfo["misses"] = dnsStats.misses;
+    dnsInfo["staleHits"] = dnsStats.staleHits;
+    dnsInfo["failures"] = dnsStats.failures;
+    dnsInfo["prefetches"] = dnsStats.prefetches;
+    const LatencyHistogram& dnsLatency = dns.getLatencyHistogram();
+    JsonObject lookupMs = dnsInfo.createNestedObject("lookupMs");
+    lookupMs["max"] = dnsLatency.maxValue();
+    JsonArray lookupBuckets = lookupMs.createNestedArray("bucketsMs");
+    JsonArray lookupCounts = lookupMs.createNestedArray("counts");
+    for (uint8_t i = 0; i < LatencyHistogram::BUCKETS; i++) {
+      uint32_t bound = LatencyHistogram::upperBoundMs(i);
+      if (bound > 0) {
+        lookupBuckets.add(bound);
+      }
+      lookupCounts.add(dnsLatency.count(i));
+    }
+    JsonArray dnsEntries = dnsInfo.createNestedArray("entries");
+    for (uint8_t i = 0; i < dns.getEntryCount(); i++) {
+      const DnsCache::Entry& entry = dns.getEntry(i);
+      JsonObject item = dnsEntries.createNestedObject();
+      item["host"] = entry.name;
+      item["address"] = entry.address != 0 ? IPAddress(entry.address).toString() : String();
+      item["negative"] = entry.negative;
+      item["ttlS"] = dns.remainingMs(entry, nowMs) / 1000;
+    }
 
-      int httpCode = http->GET();
-      if (httpCode != HTTP_CODE_OK) {
-        LOG_ERRORF("Geolocation request failed with code %d", httpCode);
-        break;
-      }
+    AmbientLightStats ambientStats = getAmbientLightStats();
+    JsonObject ambient = doc.createNestedObject("ambient");
+    ambient["enabled"] = ambientStats.enabled;
+    ambient["raw"] = ambientStats.raw;
+    ambient["level"] = ambientStats.level;
+    ambient["brightness"] = ambientStats.brightness;
+    ambient["samples"] = ambientStats.samples;
+    ambient["changes"] = ambientStats.changes;
+
+    ClockDiscipline::Stats clockStats = clockDiscipline.getStats();
+    JsonObject clock = doc.createNestedObject("clock");
+    clock["driftPpm"] = clockStats.driftPpm;
+    clock["lastOffsetUs"] = clockStats.lastOffsetUs;
+    clock["samples"] = clockStats.samples;
+    clock["slews"] = clockStats.slews;
+    clock["steps"] = clockStats.steps;
+    clock["syncIntervalMin"] = clockStats.syncIntervalMs / 60000;
 
-      String payload = http->getString();
-      if (payload.length() == 0) {
-        LOG_ERROR("Empty response");
-        break;
-      }
+    String response;
+    serializeJson(doc, response);
+    request->send(200, "application/json", response);
+  });
 
-      #ifdef DEBUG
-      LOG_DEBUGF("Geolocation response: %.100s%s", payload.c_str(), payload.length() > 100 ? "..." : "");
-      #endif
+  // Known WiFi networks (passwords are never returned)
+  server->on("/api/wifi/networks", HTTP_GET, [](AsyncWebServerRequest *request) {
+    StaticJsonDocument<512> doc;
+    doc["max"] = NUM_WIFI_CREDENTIALS;
+    JsonArray list = doc.createNestedArray("networks");
+    char ssids[NUM_WIFI_CREDENTIALS][WIFI_SSID_MAX_LEN];
+    uint8_t count = getRequestedWiFiNetworks(ssids, NUM_WIFI_CREDENTIALS);
+    for (uint8_t i = 0; i < count; i++) {
+      list.add(ssids[i]);
+    }
 
-      // Parse JSON
-      DynamicJsonDocument doc(2048);
-      DeserializationError error = deserializeJson(doc, payload);
-      if (error) {
-        LOG_ERRORF("JSON parsing failed: %s", error.c_str());
-        break;
-      }
+    String response;
+    serializeJson(doc, response);
+    request->send(200, "application/json", response);
+  });
 
-      // Extract and validate location data
-      if (!doc.containsKey("latitude") || !doc.containsKey("longitude")) {
-        LOG_ERROR("Missing location data in response");
-        break;
+  server->on("/api/wifi/networks", HTTP_POST, [](AsyncWebServerRequest *request) {}, NULL,
+    [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+      StaticJsonDocument<256> doc;
+      if (total > 256 || deserializeJson(doc, data, len)) {
+        request->send(400, "application/json", "{\"error\":\"Invalid JSON\"}");
+        return;
       }
 
-      float lat = doc["latitude"].as<float>();
-      float lon = doc["longitude"].as<float>();
-
-      // Validate coordinate ranges
-      if (lat < -90.0f || lat > 90.0f || lon < -180.0f || lon > 180.0f) {
-        LOG_ERRORF("Invalid coordinates: lat=%.6f, lon=%.6f", lat, lon);
-        break;
+      const char* ssid = doc["ssid"] | "";
+      const char* password = doc["password"] | "";
+      size_t ssidLen = strlen(ssid);
+      size_t passLen = strlen(password);
+      if (ssidLen == 0 || ssidLen >= WIFI_SSID_MAX_LEN) {
+        request->send(400, "application/json", "{\"error\":\"ssid must be 1-32 characters\"}");
+        return;
+      }
+      if (passLen != 0 && (passLen < 8 || passLen >= WIFI_PASS_MAX_LEN)) {
+        request->send(400, "application/json", "{\"error\":\"password must be empty or 8-64 characters\"}");
+        return;
       }
+      if (!requestAddWiFiNetwork(ssid, password)) {
+        request->send(507, "application/json", "{\"error\":\"Network list full\"}");
+        return;
+      }
+
+      LOG_INFOF("WiFi network added: %s", ssid);
+      request->send(200, "application/json", "{\"success\":true}");
+    });
 
-      // Build response
-      StaticJsonDocument<512> response;
-      response["success"] = true;
-      response["latitude"] = String(lat, 6);
-      response["longitude"] = String(lon, 6);
-      response["city"] = doc["city"].as<String>();
-      response["postalCode"] = doc["postal"].as<String>();
-      response["region"] = doc["region"].as<String>();
-      response["country"] = doc["country_name"].as<String>();
+  server->on("/api/wifi/networks", HTTP_DELETE, [](AsyncWebServerRequest *request) {
+    if (!request->hasParam("ssid")) {
+      request->send(400, "application/json", "{\"error\":\"Missing ssid parameter\"}");
+      return;
+    }
+    String ssid = request->getParam("ssid")->value();
+    if (!requestRemoveWiFiNetwork(ssid.c_str())) {
+      request->send(404, "application/json", "{\"error\":\"Unknown network or portal network\"}");
+      return;
+    }
 
-      serializeJson(response, responseStr);
+    LOG_INFOF("WiFi network removed: %s", ssid.c_str());
+    request->send(200, "application/json", "{\"success\":true}");
+  });
 
+  // Geolocation lookup: answered from the cache, or started as a job the
+  // loop runs (?job=<id> polls it), so this task never waits for ipapi.co
+  server->on("/api/geolocation", HTTP_GET, [](AsyncWebServerRequest *request) {
+    GeolocationJob job;
+    if (request->hasParam("job")) {
+      uint32_t id = strtoul(request->getParam("job")->value().c_str(), nullptr, 10);
+      if (!getGeolocationJob(id, job)) {
+        request->send(404, "application/json", "{\"success\":false,\"error\":\"Unknown or expired job\"}");
+        return;
+      }
+    } else {
       #ifdef DEBUG
-      LOG_DEBUGF("Geolocation: %s, %s (%.6f, %.6f)",
-        response["city"].as<const char*>(),
-        response["country"].as<const char*>(),
-        lat, lon);
+      LOG_DEBUG("Geolocation lookup requested");
       #endif
 
-      success = true;
-    } while (false);
+      // Check WiFi connection before attempting request
+      if (!isWiFiConnected()) {
+        LOG_WARN("Geolocation lookup skipped - WiFi not connected");
+        request->send(503, "application/json", "{\"success\":false,\"error\":\"WiFi not connected\"}");
+        return;
+      }
+      requestGeolocation(job);
+    }
 
-    // Guaranteed cleanup
-    if (http) {
-      http->end();
-      delete http;
+    if (job.state != GeolocationJobState::Done) {
+      char body[64];
+      snprintf(body, sizeof(body), "{\"success\":true,\"jobId\":%lu,\"status\":\"pending\"}", (unsigned long)job.id);
+      AsyncWebServerResponse* pending = request->beginResponse(202, "application/json", body);
+      pending->addHeader("Location", "/api/geolocation?job=" + String(job.id));
+      request->send(pending);
+      return;
     }
-    if (client) {
-      delete client;
+    AsyncWebServerResponse* response = request->beginResponse(job.httpStatus, "application/json", job.body);
+    if (job.retryAfterS > 0) {
+      response->addHeader("Retry-After", String(job.retryAfterS));
     }
+    request->send(response);
+  });
 
-    if (success) {
-      request->send(200, "application/json", responseStr);
-    } else {
-      request->send(500, "application/json", "{\"success\":false,\"error\":\"Geolocation lookup failed\"}");
+  // Offline city search (prefix of the name), answered from the table in flash
+  server->on("/api/cities", HTTP_GET, [](AsyncWebServerRequest *request) {
+    if (!request->hasParam("q") || request->getParam("q")->value().length() == 0) {
+      request->send(400, "application/json", "{\"success\":false,\"error\":\"Missing q parameter\"}");
+      return;
     }
+    const String& query = request->getParam("q")->value();
+    uint8_t limit = CITY_SEARCH_DEFAULT_RESULTS;
+    if (request->hasParam("limit")) {
+      long requested = request->getParam("limit")->value().toInt();
+      limit = (uint8_t)constrain(requested, 1, CITY_SEARCH_MAX_RESULTS);
+    }
+
+    City cities[CITY_SEARCH_MAX_RESULTS];
+    uint32_t startUs = micros();
+    uint8_t count = getCityIndex().search(query.c_str(), cities, limit);
+    uint32_t searchUs = micros() - startUs;
+
+    // Names come straight from flash (stored as pointers), only coordinates are copied
+    DynamicJsonDocument doc(512 + CITY_SEARCH_MAX_RESULTS * 160);
+    doc["success"] = true;
+    doc["query"] = query;
+    doc["searchUs"] = searchUs;
+    JsonArray results = doc.createNestedArray("cities");
+    for (uint8_t i = 0; i < count; i++) {
+      char latitude[8];
+      char longitude[8];
+      snprintf(latitude, sizeof(latitude), "%.2f", cities[i].latitude);
+      snprintf(longitude, sizeof(longitude), "%.2f", cities[i].longitude);
+      JsonObject city = results.createNestedObject();
+      city["name"] = cities[i].name;
+      city["country"] = cities[i].country;
+      city["countryName"] = cities[i].countryName;
+      city["timezone"] = cities[i].timezone;
+      city["latitude"] = latitude;
+      city["longitude"] = longitude;
+    }
+
+    String response;
+    serializeJson(doc, response);
+    request->send(200, "application/json", response);
   });
 
   // Update configuration
@@ -315,6 +652,9 @@ bool initWebConfig(AsyncWebServer* server) {
       if (doc.containsKey("clockSecIndicatorDiff")) cfg.clockSecIndicatorDiff = doc["clockSecIndicatorDiff"];
 
       // Weather settings - validate coordinates
+      String previousLatitude = cfg.locationLatitude;
+      String previousLongitude = cfg.locationLongitude;
+      uint8_t previousAutoTimezone = cfg.locationAutoTimezone;
       if (doc.containsKey("locationLatitude")) {
         String lat = doc["locationLatitude"].as<String>();
         if (lat.length() > 20) {
@@ -335,6 +675,16 @@ bool initWebConfig(AsyncWebServer* server) {
         cfg.locationLongitude = lon;
       }
 
+      if (doc.containsKey("locationAutoTimezone")) {
+        uint8_t autoTimezone = doc["locationAutoTimezone"];
+        if (autoTimezone > 1) {
+          request->send(400, "application/json",
+            "{\"error\":\"locationAutoTimezone must be 0 or 1\"}");
+          return;
+        }
+        cfg.locationAutoTimezone = autoTimezone;
+      }
+
       if (doc.containsKey("locationUnits")) {
         String units = doc["locationUnits"].as<String>();
         if (units != "metric" && units != "imperial") {
@@ -385,6 +735,20 @@ bool initWebConfig(AsyncWebServer* server) {
         cfg.weatherTempMax = tempMax;
       }
 
+      // Validate extra locations by parsing them
+      if (doc.containsKey("weatherLocations")) {
+        String locationsStr = doc["weatherLocations"].as<String>();
+        locationsStr.trim();
+        WeatherLocation parsed[WEATHER_MAX_LOCATIONS - 1];
+        uint8_t parsedCount;
+        if (!parseWeatherLocations(locationsStr.c_str(), parsed, WEATHER_MAX_LOCATIONS - 1, parsedCount)) {
+          request->send(400, "application/json",
+            "{\"error\":\"Invalid weatherLocations (use up to 3 'label=lat,lon' separated by ';', label one of " WEATHER_LABEL_GLYPHS ")\"}");
+          return;
+        }
+        cfg.weatherLocations = locationsStr;
+      }
+
       // Validate cron expressions
       if (doc.containsKey("weatherTempSchedule")) {
         String cronStr = doc["weatherTempSchedule"].as<String>();
@@ -416,6 +780,16 @@ bool initWebConfig(AsyncWebServer* server) {
         cfg.weatherUpdateSchedule = cronStr;
       }
 
+      if (doc.containsKey("weatherUpdateSkew")) {
+        int skew = doc["weatherUpdateSkew"];
+        if (skew < 0 || skew > 600) {
+          request->send(400, "application/json",
+            "{\"error\":\"weatherUpdateSkew must be 0-600 seconds\"}");
+          return;
+        }
+        cfg.weatherUpdateSkew = skew;
+      }
+
       // LED settings - validate ranges
       if (doc.containsKey("ledBrightness")) cfg.ledBrightness = doc["ledBrightness"];
 
@@ -466,6 +840,67 @@ bool initWebConfig(AsyncWebServer* server) {
         cfg.ledDimEndTime = timeStr;
       }
 
+      // Validate brightness profile by compiling it
+      if (doc.containsKey("ledDimProfile")) {
+        String profileStr = doc["ledDimProfile"].as<String>();
+        profileStr.trim();
+        if (profileStr.length() > BRIGHTNESS_PROFILE_MAX_LEN) {
+          request->send(400, "application/json",
+            "{\"error\":\"ledDimProfile too long\"}");
+          return;
+        }
+        BrightnessProfile profile;
+        if (profileStr.length() > 0 && !compileBrightnessProfile(profileStr.c_str(), profile)) {
+          request->send(400, "application/json",
+            "{\"error\":\"Invalid ledDimProfile (use e.g. '*: 06:30=20 07:30=255e 22:00=255 23:00=40')\"}");
+          return;
+        }
+        cfg.ledDimProfile = profileStr;
+      }
+
+      if (doc.containsKey("ledDimSolar")) {
+        uint8_t solar = doc["ledDimSolar"];
+        if (solar > 1) {
+          request->send(400, "application/json",
+            "{\"error\":\"ledDimSolar must be 0 or 1\"}");
+          return;
+        }
+        cfg.ledDimSolar = solar;
+      }
+
+      if (doc.containsKey("ledFadeCurve")) {
+        uint8_t curve = doc["ledFadeCurve"];
+        if (curve > 2) {
+          request->send(400, "application/json",
+            "{\"error\":\"ledFadeCurve must be 0-2\"}");
+          return;
+        }
+        cfg.ledFadeCurve = curve;
+      }
+
+      if (doc.containsKey("ledAmbientEnabled")) {
+        uint8_t enabled = doc["ledAmbientEnabled"];
+        if (enabled > 1) {
+          request->send(400, "application/json",
+            "{\"error\":\"ledAmbientEnabled must be 0 or 1\"}");
+          return;
+        }
+        cfg.ledAmbientEnabled = enabled;
+      }
+
+      // Validate ambient curve by compiling it
+      if (doc.containsKey("ledAmbientCurve")) {
+        String curveStr = doc["ledAmbientCurve"].as<String>();
+        curveStr.trim();
+        AmbientCurve curve;
+        if (curveStr.length() > AMBIENT_CURVE_MAX_LEN || !compileAmbientCurve(curveStr.c_str(), curve)) {
+          request->send(400, "application/json",
+            "{\"error\":\"Invalid ledAmbientCurve (use ascending 'level=brightness' pairs, e.g. '0=10 300=60 1500=160 3500=255')\"}");
+          return;
+        }
+        cfg.ledAmbientCurve = curveStr;
+      }
+
       // Validate clock update schedule
       if (doc.containsKey("clockUpdateSchedule")) {
         String cronStr = doc["clockUpdateSchedule"].as<String>();
@@ -482,9 +917,24 @@ bool initWebConfig(AsyncWebServer* server) {
         cfg.clockUpdateSchedule = cronStr;
       }
 
+      // Time zone of a new location (or when switched on), applied by the loop
+      const char* timezone = nullptr;
+      if (cfg.locationAutoTimezone &&
+          (cfg.locationLatitude != previousLatitude || cfg.locationLongitude != previousLongitude || !previousAutoTimezone) &&
+          cfg.locationLatitude.length() > 0 && cfg.locationLongitude.length() > 0) {
+        timezone = getTimezoneGrid().lookup(cfg.locationLatitude.toFloat(), cfg.locationLongitude.toFloat());
+      }
+
       // Save to LittleFS
       if (configManager.saveConfig()) {
         LOG_INFO("Configuration saved successfully");
+        if (timezone != nullptr) {
+          requestTimezone(timezone);
+          char body[128];
+          snprintf(body, sizeof(body), "{\"success\":true,\"message\":\"Configuration saved\",\"timezone\":\"%s\"}", timezone);
+          request->send(200, "application/json", body);
+          return;
+        }
         request->send(200, "application/json", "{\"success\":true,\"message\":\"Configuration saved\"}");
       } else {
         LOG_ERROR("Failed to save configuration");
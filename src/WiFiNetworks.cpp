@@ -0,0 +1,307 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WiFiNetworks.h"
+#include "config.h"
+#include "Logger.h"
+#include <WiFi.h>
+
+static WiFiCredentialList networks;
+
+// Networks with the changes requested by the web server, taken over by the loop
+static WiFiCredentialList requested;
+static bool requestPending = false;
+static portMUX_TYPE requestMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Scan cache (known networks only)
+struct ScanEntry {
+  uint8_t credential;
+  uint8_t bssid[6];
+  uint8_t channel;
+  int8_t rssi;
+};
+static ScanEntry scanCache[WIFI_SCAN_CACHE_SIZE];
+static uint8_t scanCacheCount = 0;
+static unsigned long scanCacheTime = 0;
+static bool scanRunning = false;
+
+static WiFiApStats apStats[WIFI_AP_STATS_SIZE];
+static uint8_t apStatsCount = 0;
+
+// Failed attempts cost up to this much signal when ranking candidates
+static const int16_t WIFI_FAILURE_PENALTY_DB = 20;
+
+static void copyCredential(WiFiCredential& entry, const char* ssid, const char* pass) {
+  memset(&entry, 0, sizeof(WiFiCredential));
+  strncpy(entry.ssid, ssid, WIFI_SSID_MAX_LEN - 1);
+  strncpy(entry.pass, pass, WIFI_PASS_MAX_LEN - 1);
+}
+
+void initWiFiNetworks(const String& ssid, const String& pass) {
+  if (!loadWiFiCredentials(networks)) {
+    memset(&networks, 0, sizeof(WiFiCredentialList));
+  }
+  requested = networks;
+  if (ssid.length() == 0) {
+    return;
+  }
+
+  int8_t index = findWiFiNetwork(ssid.c_str());
+  if (index == 0 && pass == networks.entries[0].pass) {
+    LOG_DEBUGF("%d known WiFi network(s)", networks.count);
+    return;
+  }
+
+  // Portal network (new or changed) goes first, the others keep their order
+  if (index != 0) {
+    uint8_t last = (index > 0) ? index : networks.count;
+    if (last >= NUM_WIFI_CREDENTIALS) {
+      last = NUM_WIFI_CREDENTIALS - 1;  // List full, the last network is dropped
+    }
+    for (uint8_t i = last; i > 0; i--) {
+      networks.entries[i] = networks.entries[i - 1];
+    }
+    if (index < 0 && networks.count < NUM_WIFI_CREDENTIALS) {
+      networks.count++;
+    }
+  }
+  copyCredential(networks.entries[0], ssid.c_str(), pass.c_str());
+  requested = networks;
+  saveWiFiCredentials(networks);
+  LOG_INFOF("%d known WiFi network(s), portal network updated", networks.count);
+}
+
+uint8_t getWiFiNetworkCount() {
+  return networks.count;
+}
+
+const WiFiCredential* getWiFiNetwork(uint8_t index) {
+  if (index >= networks.count) {
+    return nullptr;
+  }
+  return &networks.entries[index];
+}
+
+static int8_t findInList(const WiFiCredentialList& list, const char* ssid) {
+  for (uint8_t i = 0; i < list.count; i++) {
+    if (strncmp(list.entries[i].ssid, ssid, WIFI_SSID_MAX_LEN) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+int8_t findWiFiNetwork(const char* ssid) {
+  return findInList(networks, ssid);
+}
+
+uint8_t getRequestedWiFiNetworks(char ssids[][WIFI_SSID_MAX_LEN], uint8_t maxCount) {
+  portENTER_CRITICAL(&requestMux);
+  uint8_t count = requested.count < maxCount ? requested.count : maxCount;
+  for (uint8_t i = 0; i < count; i++) {
+    memcpy(ssids[i], requested.entries[i].ssid, WIFI_SSID_MAX_LEN);
+  }
+  portEXIT_CRITICAL(&requestMux);
+  return count;
+}
+
+bool requestAddWiFiNetwork(const char* ssid, const char* pass) {
+  WiFiCredential entry;
+  copyCredential(entry, ssid, pass);
+
+  bool accepted = true;
+  portENTER_CRITICAL(&requestMux);
+  int8_t index = findInList(requested, ssid);
+  if (index < 0) {
+    if (requested.count >= NUM_WIFI_CREDENTIALS) {
+      accepted = false;
+    } else {
+      index = requested.count++;
+    }
+  }
+  if (accepted) {
+    requested.entries[index] = entry;
+    requestPending = true;
+  }
+  portEXIT_CRITICAL(&requestMux);
+  return accepted;
+}
+
+bool requestRemoveWiFiNetwork(const char* ssid) {
+  portENTER_CRITICAL(&requestMux);
+  int8_t index = findInList(requested, ssid);
+  if (index > 0) {
+    for (uint8_t i = index; i + 1 < requested.count; i++) {
+      requested.entries[i] = requested.entries[i + 1];
+    }
+    requested.count--;
+    memset(&requested.entries[requested.count], 0, sizeof(WiFiCredential));
+    requestPending = true;
+  }
+  portEXIT_CRITICAL(&requestMux);
+  return index > 0;
+}
+
+void applyWiFiNetworkChanges() {
+  if (!requestPending) {
+    return;
+  }
+  portENTER_CRITICAL(&requestMux);
+  networks = requested;
+  requestPending = false;
+  portEXIT_CRITICAL(&requestMux);
+
+  // Scan results refer to networks by index, rescan before the next pick
+  scanCacheCount = 0;
+  scanCacheTime = 0;
+  saveWiFiCredentials(networks);
+  LOG_INFOF("%d known WiFi network(s)", networks.count);
+}
+
+bool startWiFiScan() {
+  if (scanRunning) {
+    return true;
+  }
+  int16_t result = WiFi.scanNetworks(true);
+  if (result != WIFI_SCAN_RUNNING) {
+    LOG_WARNF("WiFi scan could not be started (%d)", result);
+    return false;
+  }
+  scanRunning = true;
+  return true;
+}
+
+bool pollWiFiScan() {
+  if (!scanRunning) {
+    return false;
+  }
+  int16_t found = WiFi.scanComplete();
+  if (found == WIFI_SCAN_RUNNING) {
+    return false;
+  }
+  scanRunning = false;
+  if (found < 0) {
+    LOG_WARN("WiFi scan failed");
+    return true;
+  }
+
+  scanCacheCount = 0;
+  for (int16_t i = 0; i < found && scanCacheCount < WIFI_SCAN_CACHE_SIZE; i++) {
+    int8_t credential = findWiFiNetwork(WiFi.SSID(i).c_str());
+    if (credential < 0) {
+      continue;
+    }
+    ScanEntry& entry = scanCache[scanCacheCount++];
+    entry.credential = credential;
+    memcpy(entry.bssid, WiFi.BSSID(i), sizeof(entry.bssid));
+    entry.channel = WiFi.channel(i);
+    entry.rssi = WiFi.RSSI(i);
+  }
+  WiFi.scanDelete();
+  scanCacheTime = millis();
+  LOG_DEBUGF("WiFi scan: %d networks, %d known APs", found, scanCacheCount);
+  return true;
+}
+
+bool isWiFiScanFresh() {
+  return scanCacheTime != 0 && millis() - scanCacheTime < WIFI_SCAN_CACHE_MAX_AGE_MS;
+}
+
+static WiFiApStats* findApStats(const uint8_t* bssid) {
+  for (uint8_t i = 0; i < apStatsCount; i++) {
+    if (memcmp(apStats[i].bssid, bssid, 6) == 0) {
+      return &apStats[i];
+    }
+  }
+  return nullptr;
+}
+
+static int16_t scoreCandidate(const ScanEntry& entry) {
+  int16_t score = entry.rssi;
+  const WiFiApStats* stats = findApStats(entry.bssid);
+  if (stats != nullptr && stats->attempts >= 2) {
+    score -= (int16_t)((uint32_t)(stats->attempts - stats->successes) * WIFI_FAILURE_PENALTY_DB / stats->attempts);
+  }
+  return score;
+}
+
+bool selectWiFiCandidate(WiFiCandidate& candidate, const uint8_t* excludeBssid) {
+  bool found = false;
+  for (uint8_t i = 0; i < scanCacheCount; i++) {
+    const ScanEntry& entry = scanCache[i];
+    if (entry.credential >= networks.count) {
+      continue;  // Network removed since the scan
+    }
+    if (excludeBssid != nullptr && memcmp(entry.bssid, excludeBssid, 6) == 0) {
+      continue;
+    }
+    int16_t score = scoreCandidate(entry);
+    if (!found || score > candidate.score) {
+      candidate.credential = entry.credential;
+      memcpy(candidate.bssid, entry.bssid, sizeof(candidate.bssid));
+      candidate.channel = entry.channel;
+      candidate.rssi = entry.rssi;
+      candidate.score = score;
+      found = true;
+    }
+  }
+  return found;
+}
+
+void recordWiFiApResult(const uint8_t* bssid, uint8_t channel, bool success, uint32_t connectMs) {
+  if (bssid == nullptr) {
+    return;
+  }
+  WiFiApStats* stats = findApStats(bssid);
+  if (stats == nullptr) {
+    if (apStatsCount < WIFI_AP_STATS_SIZE) {
+      stats = &apStats[apStatsCount++];
+    } else {
+      // Replace the AP not used for the longest time
+      stats = &apStats[0];
+      for (uint8_t i = 1; i < apStatsCount; i++) {
+        if ((int32_t)(apStats[i].lastUsed - stats->lastUsed) < 0) {
+          stats = &apStats[i];
+        }
+      }
+    }
+    memset(stats, 0, sizeof(WiFiApStats));
+    memcpy(stats->bssid, bssid, sizeof(stats->bssid));
+  }
+
+  stats->channel = channel;
+  stats->lastUsed = millis();
+  if (stats->attempts == UINT16_MAX) {
+    // Halve the history instead of overflowing, keeps the success rate
+    stats->attempts /= 2;
+    stats->successes /= 2;
+  }
+  stats->attempts++;
+  if (success) {
+    stats->successes++;
+    stats->avgConnectMs = (stats->successes == 1) ? connectMs : (stats->avgConnectMs * 3 + connectMs) / 4;
+  }
+}
+
+uint8_t getWiFiApStats(WiFiApStats* stats, uint8_t maxStats) {
+  uint8_t count = apStatsCount < maxStats ? apStatsCount : maxStats;
+  memcpy(stats, apStats, count * sizeof(WiFiApStats));
+  return count;
+}
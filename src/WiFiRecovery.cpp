@@ -0,0 +1,165 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WiFiRecovery.h"
+
+WiFiRecovery::WiFiRecovery(const Timing& timing)
+    : timing(timing),
+      state(State::Idle),
+      attempts(0),
+      backoffMs(timing.initialBackoffMs),
+      outageStartMs(0),
+      phaseStartMs(0),
+      attemptStartMs(0),
+      backoffStartMs(0),
+      stats() {
+}
+
+void WiFiRecovery::start(uint32_t nowMs) {
+  (void)nowMs;
+  state = State::Connected;
+}
+
+bool WiFiRecovery::beginSwitch(uint32_t nowMs) {
+  if (state != State::Connected) {
+    return false;
+  }
+  state = State::Switching;
+  attemptStartMs = nowMs;
+  return true;
+}
+
+WiFiRecovery::Action WiFiRecovery::handleEvent(Event event, uint32_t nowMs) {
+  if (state == State::Idle) {
+    return Action::None;
+  }
+
+  if (event == Event::Connected) {
+    if (state == State::Connected) {
+      return Action::None;
+    }
+    if (state == State::Switching) {
+      stats.switches++;
+      state = State::Connected;
+      return Action::Switched;
+    }
+    stats.recoveries++;
+    stats.lastOutageMs = nowMs - outageStartMs;
+    outageHistogram.add(stats.lastOutageMs);
+    recoverHistogram.add(nowMs - attemptStartMs);
+    state = State::Connected;
+    return Action::Recovered;
+  }
+
+  switch (state) {
+    case State::Connected:
+      stats.disconnects++;
+      outageStartMs = nowMs;
+      phaseStartMs = nowMs;
+      attempts = 0;
+      backoffMs = timing.initialBackoffMs;
+      nextAttempt(nowMs);
+      return Action::Lost;
+    case State::Reconnecting:
+      // Attempt failed before its timeout
+      enterBackoff(nowMs);
+      return Action::None;
+    default:
+      // Backoff: nothing in flight. FullRestart and Switching: the restart or
+      // switch disconnects itself.
+      return Action::None;
+  }
+}
+
+WiFiRecovery::Action WiFiRecovery::tick(uint32_t nowMs) {
+  switch (state) {
+    case State::Reconnecting:
+      if (nowMs - attemptStartMs >= timing.reconnectTimeoutMs) {
+        enterBackoff(nowMs);
+      }
+      return Action::None;
+    case State::Backoff:
+      if (nowMs - backoffStartMs >= backoffMs) {
+        uint32_t next = backoffMs * 2;
+        backoffMs = next > timing.maxBackoffMs ? timing.maxBackoffMs : next;
+        return nextAttempt(nowMs);
+      }
+      return Action::None;
+    case State::FullRestart:
+      if (nowMs - attemptStartMs >= timing.fullRestartTimeoutMs) {
+        // Start over with quick reconnects before the next full restart
+        phaseStartMs = nowMs;
+        attempts = 0;
+        backoffMs = timing.initialBackoffMs;
+        enterBackoff(nowMs);
+      }
+      return Action::None;
+    case State::Switching:
+      if (nowMs - attemptStartMs >= timing.reconnectTimeoutMs) {
+        // Switch failed: an outage since the planned disconnect
+        stats.disconnects++;
+        outageStartMs = attemptStartMs;
+        phaseStartMs = attemptStartMs;
+        attempts = 0;
+        backoffMs = timing.initialBackoffMs;
+        nextAttempt(nowMs);
+        return Action::Lost;
+      }
+      return Action::None;
+    default:
+      return Action::None;
+  }
+}
+
+WiFiRecovery::Action WiFiRecovery::nextAttempt(uint32_t nowMs) {
+  attemptStartMs = nowMs;
+  if (nowMs - phaseStartMs >= timing.fullRestartAfterMs || attempts >= timing.maxAttempts) {
+    state = State::FullRestart;
+    stats.fullRestarts++;
+    return Action::FullRestart;
+  }
+  attempts++;
+  stats.reconnectAttempts++;
+  state = State::Reconnecting;
+  return Action::Reconnect;
+}
+
+void WiFiRecovery::enterBackoff(uint32_t nowMs) {
+  state = State::Backoff;
+  backoffStartMs = nowMs;
+}
+
+const char* WiFiRecovery::getStateName(State state) {
+  switch (state) {
+    case State::Idle:
+      return "idle";
+    case State::Connected:
+      return "connected";
+    case State::Reconnecting:
+      return "reconnecting";
+    case State::Backoff:
+      return "backoff";
+    case State::FullRestart:
+      return "fullRestart";
+    case State::Switching:
+      return "switching";
+  }
+  return "unknown";
+}
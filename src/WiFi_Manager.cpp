@@ -23,6 +23,12 @@
 #include "WiFi_Manager.h"
 #include "LED_Clock.h"
 #include "ConfigStorage.h"
+#include "ClockDiscipline.h"
+#include "Metrics.h"
+#include "WiFiNetworks.h"
+#include "WiFiRecovery.h"
+#include "DnsResolver.h"
+#include "WarmRestart.h"
 #include <WiFi.h>
 #include <LittleFS.h>
 #include <ESP_DoubleResetDetector.h>
@@ -31,7 +37,9 @@
 #include <ESPAsyncDNSServer.h>
 #include <ESP32Time.h>
 #include <time.h>
+#include <esp_attr.h>
 #include <esp_task_wdt.h>
+#include <esp_sntp.h>
 
 // Double Reset Detector
 DoubleResetDetector* drd;
@@ -52,10 +60,16 @@ const char* ntpServer1 = "pool.ntp.org";
 const char* ntpServer2 = "time.nist.gov";
 const char* ntpServer3 = "time.google.com";
 
+// Addresses handed to SNTP in place of the names (0 = SNTP resolves the name)
+static uint32_t ntpServerAddresses[3] = {0, 0, 0};
+static uint32_t lastNtpServerCheckMs = 0;
+static const uint32_t NTP_SERVER_CHECK_MS = 10000;
+
 void configureNTP() {
   LOG_INFO("Configuring NTP...");
   LOG_DEBUGF("Timezone name: %s", timezoneNameString.length() > 0 ? timezoneNameString.c_str() : "EMPTY");
   LOG_DEBUGF("Timezone string: %s", timezoneString.length() > 0 ? timezoneString.c_str() : "EMPTY");
+  clockDiscipline.begin();
   if (timezoneString.length() > 0) {
     LOG_INFOF("Applying timezone: %s", timezoneString.c_str());
     configTzTime(timezoneString.c_str(), ntpServer1, ntpServer2, ntpServer3);
@@ -63,19 +77,45 @@ void configureNTP() {
     LOG_WARN("No timezone set, using UTC");
     configTime(0, 0, ntpServer1, ntpServer2, ntpServer3);
   }
+  // configTime() set the names again
+  for (uint8_t i = 0; i < 3; i++) {
+    ntpServerAddresses[i] = 0;
+  }
   LOG_INFO("NTP configured");
 }
 
-// Helper functions for WiFi initialization
-static bool initFileSystem() {
-  if (FORMAT_FILESYSTEM) {
-    LOG_WARN("Formatting filesystem...");
-    LittleFS.format();
+void maintainNtpServers() {
+  // SNTP looks its server names up before every poll. Give it addresses from
+  // the DNS cache instead, kept fresh by prefetching, and fall back to the
+  // names when the cache has none.
+  uint32_t nowMs = millis();
+  if (nowMs - lastNtpServerCheckMs < NTP_SERVER_CHECK_MS || !isWiFiConnected()) {
+    return;
   }
-  if (!LittleFS.begin(true)) {
-    LOG_ERROR("LittleFS mount failed");
-    return false;
+  lastNtpServerCheckMs = nowMs;
+
+  const char* servers[3] = {ntpServer1, ntpServer2, ntpServer3};
+  for (uint8_t i = 0; i < 3; i++) {
+    dnsPrefetch(servers[i]);
+    IPAddress address;
+    uint32_t cached = dnsCachedAddress(servers[i], address) ? (uint32_t)address : 0;
+    if (cached == ntpServerAddresses[i]) {
+      continue;
+    }
+    if (cached != 0) {
+      ip_addr_t ip = IPADDR4_INIT(cached);
+      sntp_setserver(i, &ip);
+      LOG_DEBUGF("NTP server %s at %s", servers[i], address.toString().c_str());
+    } else {
+      sntp_setservername(i, (char*)servers[i]);
+    }
+    ntpServerAddresses[i] = cached;
   }
+}
+
+// Helper functions for WiFi initialization
+static bool initDoubleResetDetector() {
+  // LittleFS is already mounted by ConfigManager::begin()
   drd = new DoubleResetDetector(DRD_TIMEOUT, DRD_ADDRESS);
   displayStatus(1);
   return true;
@@ -97,6 +137,63 @@ static void loadTimezoneConfig() {
   }
 }
 
+void applySavedTimezone() {
+  loadTimezoneConfig();
+  if (timezoneString.length() > 0) {
+    setenv("TZ", timezoneString.c_str(), 1);
+    tzset();
+  }
+}
+
+// Zone requested by the web server, applied from the loop (setenv/tzset are
+// not safe against the loop's localtime calls)
+static char requestedTimezone[TZNAME_MAX_LEN] = "";
+static portMUX_TYPE timezoneMux = portMUX_INITIALIZER_UNLOCKED;
+
+void requestTimezone(const char* name) {
+  portENTER_CRITICAL(&timezoneMux);
+  strncpy(requestedTimezone, name, sizeof(requestedTimezone) - 1);
+  requestedTimezone[sizeof(requestedTimezone) - 1] = '\0';
+  portEXIT_CRITICAL(&timezoneMux);
+}
+
+void applyRequestedTimezone() {
+  char name[TZNAME_MAX_LEN];
+  portENTER_CRITICAL(&timezoneMux);
+  memcpy(name, requestedTimezone, sizeof(name));
+  requestedTimezone[0] = '\0';
+  portEXIT_CRITICAL(&timezoneMux);
+  if (name[0] == '\0' || timezoneNameString == name) {
+    return;
+  }
+
+  // POSIX rules from the portal's zone table (the same one the portal uses)
+  const char* tzResult = wifiManager != nullptr ? wifiManager->getTZ(name) : nullptr;
+  if (tzResult == nullptr || strlen(tzResult) == 0) {
+    LOG_WARNF("No POSIX rules for timezone %s, keeping %s", name,
+              timezoneNameString.length() > 0 ? timezoneNameString.c_str() : "UTC");
+    return;
+  }
+
+  ClockConfig clockConfig;
+  memset(&clockConfig, 0, sizeof(ClockConfig));
+  strncpy(clockConfig.TZ_Name, name, TZNAME_MAX_LEN - 1);
+  strncpy(clockConfig.TZ, tzResult, TIMEZONE_MAX_LEN - 1);
+  if (!saveClockConfig(clockConfig)) {
+    return;
+  }
+  timezoneNameString = name;
+  timezoneString = tzResult;
+  setenv("TZ", tzResult, 1);
+  tzset();
+  LOG_INFOF("Timezone set from location: %s (%s)", name, tzResult);
+}
+
+// Set before the restart that opens the portal when saved WiFi was not reached
+// during boot (RTC slow memory survives soft resets, the magic catches power-on)
+static const uint32_t PORTAL_REQUEST_MAGIC = 0x4C435054UL;  // "TPCL"
+RTC_NOINIT_ATTR static uint32_t portalRequest;
+
 static void setupWiFiManagerPortal() {
   webServer = new AsyncWebServer(HTTP_PORT);
   dnsServer = new AsyncDNSServer();
@@ -113,6 +210,9 @@ static void setupWiFiManagerPortal() {
     initialConfig = true;
   }
 
+  bool portalRequested = portalRequest == PORTAL_REQUEST_MAGIC;
+  portalRequest = 0;
+
   if (drd->detectDoubleReset()) {
     LOG_INFO("Double Reset Detected - entering config portal");
     initialConfig = true;
@@ -122,6 +222,11 @@ static void setupWiFiManagerPortal() {
     if (storedSSID != "" && storedPass != "") {
       wifiManager->setConfigPortalTimeout(15);
     }
+    if (portalRequested) {
+      // Portal closes after its timeout, the next boot tries the saved WiFi again
+      LOG_INFO("Saved WiFi not reached on last boot - entering config portal");
+      initialConfig = true;
+    }
   }
 }
 
@@ -158,19 +263,219 @@ static bool handleConfigPortal() {
   return true;
 }
 
-static bool connectToWiFi() {
-  if (!initialConfig) {
-    displayStatus(3);
-    String apSSID = portalSsid;
-    String apPassword = portalPassword;
-    LOG_INFO("Connecting to saved WiFi...");
-    if (!wifiManager->autoConnect(apSSID.c_str(), apPassword.c_str())) {
-      LOG_ERROR("AutoConnect failed - restarting");
-      delay(3000);
-      ESP.restart();
+// Initial connection state (connection runs in the background during boot)
+static bool initialConnectPending = false;
+static unsigned long initialConnectStart = 0;
+
+// Fast reconnect: BSSID, channel and lease of the last good connection
+static WiFiFastConnect fastConnect;
+static bool fastConnectValid = false;
+static bool directedAttempt = false;
+
+// Connect time statistics (boot connects and reconnects)
+static LatencySamples<WIFI_CONNECT_SAMPLES> connectTimes;
+static uint32_t directedConnects = 0;
+static uint32_t scanConnects = 0;
+static uint32_t directedFallbacks = 0;
+static uint32_t roams = 0;
+
+// Attempt to a specific AP, tracked for the per-AP statistics
+static uint8_t attemptBssid[6];
+static uint8_t attemptChannel = 0;
+static bool attemptTracked = false;
+static unsigned long attemptStart = 0;
+
+// Scan started to pick an AP (connect) or to look for a better one (roam)
+static bool scanConnectPending = false;
+static bool roamScanPending = false;
+static unsigned long weakSignalSince = 0;
+static unsigned long lastRoamScan = 0;
+
+static void connectToAp(uint8_t credential, const uint8_t* bssid, uint8_t channel) {
+  const WiFiCredential* network = getWiFiNetwork(credential);
+  if (network == nullptr) {
+    return;
+  }
+  LOG_DEBUGF("Connecting to %s on channel %d", network->ssid, channel);
+  WiFi.begin(network->ssid, network->pass, channel, bssid);
+  memcpy(attemptBssid, bssid, sizeof(attemptBssid));
+  attemptChannel = channel;
+  attemptTracked = true;
+  attemptStart = millis();
+}
+
+// Let the driver scan for the portal network itself
+static void beginPrimaryWiFi() {
+  const WiFiCredential* network = getWiFiNetwork(0);
+  if (network != nullptr) {
+    WiFi.begin(network->ssid, network->pass);
+  } else {
+    WiFi.begin(wifiManager->WiFi_SSID().c_str(), wifiManager->WiFi_Pass().c_str());
+  }
+}
+
+// Start a connection to a known network, directed to the cached AP if possible
+static void beginWiFi(bool directed) {
+  int8_t cached = fastConnectValid ? findWiFiNetwork(fastConnect.ssid) : -1;
+
+  if (directed && cached >= 0) {
+    if (WIFI_FAST_CONNECT_STATIC_IP && fastConnect.ip != 0) {
+      WiFi.config(IPAddress(fastConnect.ip), IPAddress(fastConnect.gateway), IPAddress(fastConnect.subnet), IPAddress(fastConnect.dns));
+    }
+    connectToAp(cached, fastConnect.bssid, fastConnect.channel);
+    directedAttempt = true;
+    return;
+  }
+
+  WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+  directedAttempt = false;
+
+  // With a single network the driver's own scan is just as good
+  if (getWiFiNetworkCount() > 1) {
+    WiFiCandidate candidate;
+    if (isWiFiScanFresh() && selectWiFiCandidate(candidate)) {
+      connectToAp(candidate.credential, candidate.bssid, candidate.channel);
+      return;
+    }
+    if (startWiFiScan()) {
+      scanConnectPending = true;
+      return;
+    }
+  }
+  beginPrimaryWiFi();
+}
+
+// Connect or roam once a pending scan has finished
+static void serviceWiFiScan() {
+  if (!pollWiFiScan()) {
+    return;
+  }
+
+  WiFiCandidate candidate;
+  if (scanConnectPending) {
+    scanConnectPending = false;
+    if (selectWiFiCandidate(candidate)) {
+      LOG_INFOF("Best AP: %s (%d dBm)", getWiFiNetwork(candidate.credential)->ssid, candidate.rssi);
+      connectToAp(candidate.credential, candidate.bssid, candidate.channel);
+    } else {
+      LOG_WARN("No known network found in scan");
+      beginPrimaryWiFi();
+    }
+  } else if (roamScanPending) {
+    roamScanPending = false;
+    if (WiFi.status() != WL_CONNECTED) {
+      return;
+    }
+    int8_t rssi = WiFi.RSSI();
+    if (selectWiFiCandidate(candidate, WiFi.BSSID()) && candidate.rssi >= rssi + WIFI_ROAM_HYSTERESIS_DB) {
+      LOG_INFOF("Roaming to %s on channel %d (%d dBm -> %d dBm)",
+                getWiFiNetwork(candidate.credential)->ssid, candidate.channel, rssi, candidate.rssi);
+      roams++;
+      weakSignalSince = 0;
+      // Keeps our own disconnect out of the outage metrics
+      wifiRecovery.beginSwitch(millis());
+      WiFi.disconnect();
+      directedAttempt = true;
+      connectToAp(candidate.credential, candidate.bssid, candidate.channel);
+    } else {
+      LOG_DEBUGF("No better AP than current (%d dBm)", rssi);
+    }
+  }
+}
+
+// Look for a better AP while the signal stays weak
+static void checkWiFiRoaming() {
+  if (scanConnectPending || roamScanPending || attemptTracked) {
+    return;
+  }
+
+  unsigned long now = millis();
+  int8_t rssi = WiFi.RSSI();
+  if (rssi >= WIFI_ROAM_RSSI_THRESHOLD) {
+    weakSignalSince = 0;
+    return;
+  }
+  if (weakSignalSince == 0) {
+    weakSignalSince = now;
+    return;
+  }
+  if (now - weakSignalSince < WIFI_ROAM_HOLD_MS) {
+    return;
+  }
+  if (lastRoamScan != 0 && now - lastRoamScan < WIFI_ROAM_SCAN_INTERVAL_MS) {
+    return;
+  }
+
+  lastRoamScan = now;
+  LOG_INFOF("WiFi signal weak (%d dBm) - scanning for a better AP", rssi);
+  roamScanPending = startWiFiScan();
+}
+
+// Give up on a tracked attempt that did not connect in time
+static void checkConnectAttempt() {
+  if (attemptTracked && WiFi.status() != WL_CONNECTED && millis() - attemptStart >= WIFI_FAST_CONNECT_TIMEOUT_MS) {
+    recordWiFiApResult(attemptBssid, attemptChannel, false, 0);
+    attemptTracked = false;
+  }
+}
+
+// True while a connect attempt or the scan preceding it is running
+static bool isConnectInProgress() {
+  return scanConnectPending || (attemptTracked && millis() - attemptStart < WIFI_FAST_CONNECT_TIMEOUT_MS);
+}
+
+// Record the AP result and refresh the fast connect cache (loop context only)
+static void recordConnectedAp(unsigned long durationMs) {
+  uint32_t apConnectMs = attemptTracked ? millis() - attemptStart : durationMs;
+  recordWiFiApResult(WiFi.BSSID(), WiFi.channel(), true, apConnectMs);
+  attemptTracked = false;
+
+  WiFiFastConnect current;
+  memset(&current, 0, sizeof(WiFiFastConnect));
+  strncpy(current.ssid, WiFi.SSID().c_str(), WIFI_SSID_MAX_LEN - 1);
+  memcpy(current.bssid, WiFi.BSSID(), sizeof(current.bssid));
+  current.channel = WiFi.channel();
+  current.ip = (uint32_t)WiFi.localIP();
+  current.gateway = (uint32_t)WiFi.gatewayIP();
+  current.subnet = (uint32_t)WiFi.subnetMask();
+  current.dns = (uint32_t)WiFi.dnsIP();
+
+  if (!fastConnectValid || memcmp(&current, &fastConnect, sizeof(WiFiFastConnect) - sizeof(current.checksum)) != 0) {
+    if (saveWiFiFastConnect(current)) {
+      fastConnect = current;
+      fastConnectValid = true;
     }
   }
+}
+
+// Record connect time, AP result and fast connect cache (loop context only)
+static void recordConnection(unsigned long durationMs) {
+  connectTimes.add(durationMs);
+  if (directedAttempt) {
+    directedConnects++;
+  } else {
+    scanConnects++;
+  }
+  LOG_INFOF("WiFi connected in %lu ms (%s)", durationMs, directedAttempt ? "directed" : "scan");
+  recordConnectedAp(durationMs);
+}
+
+WiFiConnectStats getWiFiConnectStats() {
+  WiFiConnectStats stats;
+  stats.connects = connectTimes.totalCount();
+  stats.directedConnects = directedConnects;
+  stats.scanConnects = scanConnects;
+  stats.directedFallbacks = directedFallbacks;
+  stats.roams = roams;
+  stats.p50Ms = connectTimes.percentile(50);
+  stats.p90Ms = connectTimes.percentile(90);
+  stats.p99Ms = connectTimes.percentile(99);
+  return stats;
+}
+
+static void startWiFiRecovery();
 
+static bool finishWiFiConnection() {
   if (WiFi.status() == WL_CONNECTED) {
     LOG_INFOF("WiFi connected - SSID: %s, IP: %s", WiFi.SSID().c_str(), WiFi.localIP().toString().c_str());
 
@@ -181,14 +486,64 @@ static bool connectToWiFi() {
     WiFi.softAPdisconnect(true);
     LOG_INFO("AP disabled, WiFi mode set to STA");
 
+    startWiFiRecovery();
     configureNTP();
     return true;
   }
   return false;
 }
 
+static bool startWiFiConnection() {
+  if (initialConfig) {
+    // Config portal already connected us
+    return finishWiFiConnection();
+  }
+
+  displayStatus(3);
+  LOG_INFO("Connecting to saved WiFi...");
+  fastConnectValid = loadWiFiFastConnect(fastConnect);
+  WiFi.mode(WIFI_STA);
+  beginWiFi(true);
+  initialConnectPending = true;
+  initialConnectStart = millis();
+  return true;
+}
+
+bool pollWiFiConnection() {
+  if (!initialConnectPending) {
+    return WiFi.status() == WL_CONNECTED;
+  }
+
+  if (WiFi.status() == WL_CONNECTED) {
+    initialConnectPending = false;
+    recordConnection(millis() - initialConnectStart);
+    return finishWiFiConnection();
+  }
+
+  serviceWiFiScan();
+  checkConnectAttempt();
+
+  // Cached AP not reachable (moved channel, replaced AP): scan instead
+  if (directedAttempt && millis() - initialConnectStart >= WIFI_FAST_CONNECT_TIMEOUT_MS) {
+    LOG_WARN("Directed WiFi connect failed - falling back to full scan");
+    directedFallbacks++;
+    WiFi.disconnect();
+    beginWiFi(false);
+  }
+
+  if (millis() - initialConnectStart >= WIFI_BOOT_CONNECT_TIMEOUT_MS) {
+    // The portal blocks, so it is opened from setup() after a reboot, never from the loop
+    LOG_WARN("Saved WiFi not reachable - restarting into config portal");
+    portalRequest = PORTAL_REQUEST_MAGIC;
+    saveWarmState();
+    delay(100);
+    ESP.restart();
+  }
+  return false;
+}
+
 bool initWiFiManager() {
-  if (!initFileSystem()) {
+  if (!initDoubleResetDetector()) {
     return false;
   }
   loadTimezoneConfig();
@@ -196,38 +551,47 @@ bool initWiFiManager() {
   if (initialConfig && !handleConfigPortal()) {
     return false;
   }
-  return connectToWiFi();
+  initWiFiNetworks(wifiManager->WiFi_SSID(), wifiManager->WiFi_Pass());
+  return startWiFiConnection();
 }
 
-// WiFi reconnection state tracking
-static unsigned long lastReconnectAttempt = 0;
-static unsigned long reconnectInterval = WIFI_RECONNECT_INTERVAL_MS;
-static uint8_t reconnectAttempts = 0;
-static bool wasConnected = true;
-static unsigned long disconnectStartTime = 0;
+// WiFi recovery, driven by events from the WiFi task and timers in loop()
+static WiFiRecovery wifiRecovery({
+  WIFI_RECONNECT_TIMEOUT_MS,
+  WIFI_RECONNECT_INTERVAL_MS,
+  WIFI_MAX_BACKOFF_MS,
+  WIFI_MAX_RECONNECT_ATTEMPTS,
+  WIFI_FULL_RESTART_THRESHOLD,
+  WIFI_FULL_RESTART_TIMEOUT_MS
+});
+
+// Events are handed to loop() through a queue, the WiFi task touches no other state
+struct WiFiEventRecord {
+  WiFiRecovery::Event event;
+  uint32_t timeMs;
+};
+static QueueHandle_t wifiEventQueue = nullptr;
 static bool wifiEventHandlersRegistered = false;
 
-void setupWiFiEventHandlers() {
+static void queueWiFiEvent(WiFiRecovery::Event event) {
+  WiFiEventRecord record = {event, (uint32_t)millis()};
+  if (xQueueSend(wifiEventQueue, &record, 0) != pdTRUE) {
+    LOG_WARN("WiFi event queue full - event dropped");
+  }
+}
+
+static void setupWiFiEventHandlers() {
   if (wifiEventHandlersRegistered) return;
 
+  wifiEventQueue = xQueueCreate(WIFI_EVENT_QUEUE_LENGTH, sizeof(WiFiEventRecord));
   WiFi.onEvent([](WiFiEvent_t event, WiFiEventInfo_t info) {
     switch (event) {
       case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
-        LOG_WARN("WiFi disconnected event detected");
-        if (wasConnected) {
-          disconnectStartTime = millis();
-        }
-        wasConnected = false;
-        break;
-      case ARDUINO_EVENT_WIFI_STA_CONNECTED:
-        LOG_INFO("WiFi connected event detected");
+      case ARDUINO_EVENT_WIFI_STA_LOST_IP:
+        queueWiFiEvent(WiFiRecovery::Event::Disconnected);
         break;
       case ARDUINO_EVENT_WIFI_STA_GOT_IP:
-        LOG_INFOF("WiFi connected - IP: %s", WiFi.localIP().toString().c_str());
-        reconnectAttempts = 0;
-        reconnectInterval = WIFI_RECONNECT_INTERVAL_MS;
-        wasConnected = true;
-        disconnectStartTime = 0;
+        queueWiFiEvent(WiFiRecovery::Event::Connected);
         break;
       default:
         break;
@@ -238,118 +602,109 @@ void setupWiFiEventHandlers() {
   LOG_DEBUG("WiFi event handlers registered");
 }
 
-bool checkWiFiStatus() {
-  drd->loop();
+static void startWiFiRecovery() {
+  setupWiFiEventHandlers();
+  wifiRecovery.start(millis());
+}
 
-  // Feed watchdog during WiFi recovery to prevent timeout
-  esp_task_wdt_reset();
+// Carry out what the recovery state machine asks for, true when recovered
+static bool applyRecoveryAction(WiFiRecovery::Action action) {
+  switch (action) {
+    case WiFiRecovery::Action::Lost:
+      LOG_WARN("WiFi connection lost - starting recovery");
+      displayClockface("Er05");
+      WiFi.reconnect();
+      break;
 
-  // Setup event handlers on first call
-  if (!wifiEventHandlersRegistered) {
-    setupWiFiEventHandlers();
-  }
+    case WiFiRecovery::Action::Reconnect:
+      if (!isConnectInProgress()) {
+        LOG_DEBUGF("WiFi reconnect attempt %d/%d", wifiRecovery.getAttempt(), WIFI_MAX_RECONNECT_ATTEMPTS);
+        WiFi.reconnect();
+      }
+      break;
 
-  bool currentlyConnected = (WiFi.status() == WL_CONNECTED);
-  bool justRecovered = false;
+    case WiFiRecovery::Action::FullRestart:
+      LOG_WARNF("Performing full WiFi restart (after %d attempts)", wifiRecovery.getAttempt());
 
-  // Detect reconnection
-  if (currentlyConnected && !wasConnected) {
-    LOG_INFO("WiFi connection recovered");
-    wasConnected = true;
-    reconnectAttempts = 0;
-    reconnectInterval = WIFI_RECONNECT_INTERVAL_MS;
-    disconnectStartTime = 0;
-    justRecovered = true;
-  }
+      // Feed watchdog before potentially long operation
+      esp_task_wdt_reset();
 
-  // Handle disconnection
-  if (!currentlyConnected) {
-    unsigned long now = millis();
+      // WiFi.reconnect() retries the cached AP, a full restart scans all channels
+      WiFi.disconnect(true);
+      delay(100);
+      WiFi.mode(WIFI_STA);
+      beginWiFi(false);
 
-    // Track when disconnection started
-    if (wasConnected) {
-      disconnectStartTime = now;
-      wasConnected = false;
-      LOG_WARN("WiFi connection lost - starting recovery");
-      displayClockface("Er05");
-    }
+      // Feed watchdog after operation
+      esp_task_wdt_reset();
+      break;
 
-    // Check if it's time to attempt reconnection
-    if (now - lastReconnectAttempt >= reconnectInterval) {
-      lastReconnectAttempt = now;
-      reconnectAttempts++;
+    case WiFiRecovery::Action::Recovered:
+      LOG_INFO("WiFi connection recovered");
+      recordConnection(wifiRecovery.getStats().lastOutageMs);
+      return true;
 
-      unsigned long disconnectedDuration = now - disconnectStartTime;
+    case WiFiRecovery::Action::Switched:
+      // Same network, so mDNS and time sync carry on; only the AP changed
+      LOG_INFOF("Switched to AP on channel %d", WiFi.channel());
+      recordConnectedAp(millis() - attemptStart);
+      break;
 
-      // Full WiFi restart if disconnected too long or too many attempts
-      if (disconnectedDuration >= WIFI_FULL_RESTART_THRESHOLD || reconnectAttempts >= WIFI_MAX_RECONNECT_ATTEMPTS) {
-        LOG_WARNF("Performing full WiFi restart (attempt %d, disconnected for %lu ms)", reconnectAttempts, disconnectedDuration);
+    case WiFiRecovery::Action::None:
+      break;
+  }
+  return false;
+}
 
-        // Feed watchdog before potentially long operation
-        esp_task_wdt_reset();
+bool checkWiFiStatus() {
+  drd->loop();
 
-        WiFi.disconnect(true);
-        delay(100);
-        WiFi.mode(WIFI_STA);
-        WiFi.begin();
+  // Feed watchdog during WiFi recovery to prevent timeout
+  esp_task_wdt_reset();
 
-        // Feed watchdog after operation
-        esp_task_wdt_reset();
+  // Initial connection is still handled by pollWiFiConnection()
+  if (initialConnectPending || wifiEventQueue == nullptr) {
+    return false;
+  }
 
-        reconnectAttempts = 0;
-        reconnectInterval = WIFI_RECONNECT_INTERVAL_MS;
-      } else {
-        LOG_DEBUGF("WiFi reconnect attempt %d/%d", reconnectAttempts, WIFI_MAX_RECONNECT_ATTEMPTS);
-        WiFi.reconnect();
+  bool justRecovered = false;
+  WiFiEventRecord record;
+  while (xQueueReceive(wifiEventQueue, &record, 0) == pdTRUE) {
+    justRecovered |= applyRecoveryAction(wifiRecovery.handleEvent(record.event, record.timeMs));
+  }
+  justRecovered |= applyRecoveryAction(wifiRecovery.tick(millis()));
 
-        // Exponential backoff
-        reconnectInterval = min(reconnectInterval * 2, (unsigned long)WIFI_MAX_BACKOFF_MS);
-      }
-    }
+  serviceWiFiScan();
+  checkConnectAttempt();
+  if (wifiRecovery.getState() == WiFiRecovery::State::Connected) {
+    checkWiFiRoaming();
   }
 
   return justRecovered;
 }
 
+WiFiRecoveryStats getWiFiRecoveryStats() {
+  WiFiRecovery::Stats stats = wifiRecovery.getStats();
+  WiFiRecoveryStats result;
+  result.state = WiFiRecovery::getStateName(wifiRecovery.getState());
+  result.disconnects = stats.disconnects;
+  result.reconnectAttempts = stats.reconnectAttempts;
+  result.fullRestarts = stats.fullRestarts;
+  result.recoveries = stats.recoveries;
+  result.lastOutageMs = stats.lastOutageMs;
+  result.outage = &wifiRecovery.getOutageHistogram();
+  result.recover = &wifiRecovery.getRecoverHistogram();
+  return result;
+}
+
 bool isWiFiConnected() {
   return WiFi.status() == WL_CONNECTED;
 }
 
 void syncRTCWithNTP(ESP32Time& rtc) {
-  LOG_INFO("Syncing RTC with NTP...");
-  struct tm timeinfo;
-  const uint8_t maxRetries = 3;
-  bool synced = false;
-
-  for (uint8_t attempt = 1; attempt <= maxRetries && !synced; attempt++) {
-    if (getLocalTime(&timeinfo, 10000)) {
-      // Validate time is reasonable (after 2020-01-01)
-      if (timeinfo.tm_year + 1900 >= 2020) {
-        rtc.setTimeStruct(timeinfo);
-        LOG_INFOF("RTC synced on attempt %d: %04d-%02d-%02d %02d:%02d:%02d",
-                  attempt,
-                  timeinfo.tm_year + 1900,
-                  timeinfo.tm_mon + 1,
-                  timeinfo.tm_mday,
-                  timeinfo.tm_hour,
-                  timeinfo.tm_min,
-                  timeinfo.tm_sec);
-        synced = true;
-      } else {
-        LOG_WARNF("NTP time invalid (year %d) on attempt %d, retrying...",
-                  timeinfo.tm_year + 1900, attempt);
-        delay(1000);
-      }
-    } else {
-      LOG_WARNF("Failed to obtain time from NTP on attempt %d/%d",
-                attempt, maxRetries);
-      if (attempt < maxRetries) {
-        delay(2000);
-      }
-    }
-  }
-
-  if (!synced) {
-    LOG_ERROR("Failed to sync RTC with NTP after all retries");
-  }
+  // ESP32Time reads the system clock, which SNTP keeps disciplined through
+  // ClockDiscipline. A resync only requests a poll; before the first sync the
+  // boot pipeline waits for clockDiscipline.hasSynced() instead of blocking.
+  LOG_INFOF("Requesting NTP %s...", rtc.getEpoch() > 1577836800 ? "resync" : "sync");
+  clockDiscipline.requestSync();
 }
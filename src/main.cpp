@@ -29,9 +29,14 @@
 #include "BrightnessControl.h"
 #include "LED_Clock.h"
 #include "WiFi_Manager.h"
+#include "WiFiNetworks.h"
 #include "WebConfig.h"
 #include "Weather.h"
+#include "SecureHTTPClient.h"
 #include "CronHelper.h"
+#include "ClockDiscipline.h"
+#include "WarmRestart.h"
+#include "BootPipeline.h"
 
 // Task scheduler
 Scheduler taskScheduler;
@@ -55,7 +60,6 @@ static uint8_t taskStallCount = 0;
 void updateClockCallback() {
   Config& cfg = configManager.getConfig();
   uint8_t currentSecond = rtc.getSecond();
-  updateBrightness(rtc);
   if (currentSecond != lastSecond) {
     lastSecond = currentSecond;
     if (cfg.weatherTempEnabled && CronHelper::shouldExecute(cfg.weatherTempSchedule.c_str(), rtc)) {
@@ -65,19 +69,45 @@ void updateClockCallback() {
       }
     }
     if (cfg.weatherTempEnabled && CronHelper::shouldExecute(cfg.weatherUpdateSchedule.c_str(), rtc)) {
-      fetchWeather();
+      // Random skew keeps clocks sharing a schedule from hitting the API in the same second
+      uint32_t skewMs = cfg.weatherUpdateSkew > 0 ? esp_random() % (cfg.weatherUpdateSkew * 1000UL) : 0;
+      scheduleWeatherFetch(skewMs);
     }
+    saveWarmState();
   }
+  serviceWeatherFetch();
   if (tempDisplayActive && (millis() - lastTempDisplayTime >= (cfg.weatherTempDisplayTime * 1000))) {
     tempDisplayActive = false;
   }
-  if (!tempDisplayActive) {
+  // Keep the boot status on screen until a valid time is available
+  if (!tempDisplayActive && rtc.getEpoch() > 1577836800) {
     displayTime(rtc);
   }
 }
 
+// Brightness fades run at frame rate, independent of the 100 ms clock render
+void updateBrightnessCallback() {
+  if (updateBrightness()) {
+    FastLED.show();
+  }
+}
+
+// Light sensor runs on its own slow task so ADC reads never delay the render tick
+void sampleAmbientLightCallback() {
+  sampleAmbientLight();
+}
+
 // Task definitions
 Task taskUpdateClock(100, TASK_FOREVER, &updateClockCallback);
+Task taskUpdateBrightness(BRIGHTNESS_FRAME_MS, TASK_FOREVER, &updateBrightnessCallback);
+Task taskSampleAmbientLight(AMBIENT_SAMPLE_INTERVAL_MS, TASK_FOREVER, &sampleAmbientLightCallback);
+
+// Clock was stepped by NTP (large correction) - let time-based consumers re-anchor
+void handleClockStep(int64_t stepUs) {
+  LOG_WARNF("Clock stepped by %lld ms", (long long)(stepUs / 1000));
+  lastSecond = 255;
+  notifyBrightnessClockStep();
+}
 
 void setup() {
   initLogger();
@@ -91,51 +121,98 @@ void setup() {
     ESP.restart();
   }
 
-  Config& cfg = configManager.getConfig();
+  bootStageDone(BootStage::Config);
 
+  // Start rendering right away; network stages come up from loop()
   initLEDs();
+  restoreWarmState(rtc);
+  initBrightnessControl();
+  clockDiscipline.onStep(handleClockStep);
+  taskScheduler.addTask(taskUpdateClock);
+  taskUpdateClock.enable();
+  taskScheduler.addTask(taskUpdateBrightness);
+  taskUpdateBrightness.enable();
+  taskScheduler.addTask(taskSampleAmbientLight);
+  taskSampleAmbientLight.enable();
+  bootStageDone(BootStage::Display);
+
   if (!initWiFiManager()) {
     LOG_ERROR("WiFi initialization failed");
     displayError(1);
     delay(5000);
     ESP.restart();
   }
-  syncRTCWithNTP(rtc);
-  setLoggerRTC(&rtc);
 
-  // Initialize web configuration server
+  // Initialize web configuration server (listens before WiFi is up)
   LOG_INFO("Initializing web server...");
   if (initWebConfig(&configWebServer)) {
-    if (startMDNS("ledclock")) {
-      configWebServer.begin();
-      LOG_INFO("Web server started on port 80");
+    configWebServer.begin();
+    LOG_INFO("Web server started on port 80");
+  }
+  bootStageDone(BootStage::Web);
+  LOG_INFO("Setup complete - remaining boot stages run in background");
+}
+
+// Bring up the background boot stages without blocking the render task
+void advanceBootPipeline() {
+  if (!isBootStageDone(BootStage::WiFi)) {
+    if (!pollWiFiConnection()) {
+      return;
     }
+    bootStageDone(BootStage::WiFi);
   }
-  initBrightnessControl();
-  if (cfg.weatherTempEnabled) {
-    fetchWeather();
+
+  if (!isBootStageDone(BootStage::MDNS)) {
+    startMDNS("ledclock");
+    bootStageDone(BootStage::MDNS);
+  }
+
+  if (!isBootStageDone(BootStage::Time)) {
+    if (!clockDiscipline.hasSynced()) {
+      return;
+    }
+    setLoggerRTC(&rtc);
+    bootStageDone(BootStage::Time);
+  }
+
+  if (!isBootStageDone(BootStage::Weather)) {
+    // Runs through serviceWeatherFetch() like scheduled updates; the stage
+    // is done once that fetch has finished, whatever its outcome
+    static bool weatherScheduled = false;
+    Config& cfg = configManager.getConfig();
+    if (cfg.weatherTempEnabled) {
+      if (!weatherScheduled) {
+        scheduleWeatherFetch(0);
+        weatherScheduled = true;
+      }
+      if (getWeatherFetchRuns() == 0) {
+        return;
+      }
+    }
+    bootStageDone(BootStage::Weather);
   }
-  taskScheduler.addTask(taskUpdateClock);
-  taskUpdateClock.enable();
-  LOG_INFO("Setup complete");
 }
 
 void loop() {
-  static unsigned long lastRTCSync = 0;
-  const unsigned long RTC_SYNC_INTERVAL = 3600000;
-
   // Check for restart request
   if (isRestartRequested()) {
     LOG_WARN("Restarting device...");
+    saveWarmState();
     delay(100);
     ESP.restart();
   }
 
-  if (millis() - lastRTCSync >= RTC_SYNC_INTERVAL) {
-    if (isWiFiConnected()) {
-      syncRTCWithNTP(rtc);
-    }
-    lastRTCSync = millis();
+  // SNTP polls on its own (interval adapted to the learned drift)
+  clockDiscipline.loop();
+  maintainNtpServers();
+  applyRequestedTimezone();
+  applyWiFiNetworkChanges();
+
+  // Close kept-alive HTTPS connections that went idle or when heap runs low
+  SecureHTTPClient::maintain();
+
+  if (!isBootComplete()) {
+    advanceBootPipeline();
   }
 
   // Check WiFi and handle recovery
@@ -148,7 +225,6 @@ void loop() {
     }
     // Immediate time sync after recovery
     syncRTCWithNTP(rtc);
-    lastRTCSync = millis();
   }
 
   taskScheduler.execute();
@@ -813,6 +813,19 @@ const char PROGMEM INDEX_HTML[] = R"rawliteral(
             `;
             latField.insertAdjacentElement('beforebegin', buttonDiv);
 
+            // Offline alternative: search the city table built into the firmware
+            const searchDiv = document.createElement('div');
+            searchDiv.id = 'citySearch';
+            searchDiv.className = 'field';  // Use same class as other fields for showIf logic
+            searchDiv.style.marginBottom = '20px';
+            searchDiv.innerHTML = `
+                <label for="citySearchInput">Or search a city (works offline)</label>
+                <input type="text" id="citySearchInput" placeholder="e.g. Zurich" autocomplete="off"
+                       oninput="searchCities(this.value)">
+                <div id="citySearchResults" style="margin-top: 6px;"></div>
+            `;
+            latField.insertAdjacentElement('beforebegin', searchDiv);
+
             // Add location info display after button, before latitude field
             const infoDiv = document.createElement('div');
             infoDiv.id = 'locationInfo';
@@ -827,6 +840,57 @@ const char PROGMEM INDEX_HTML[] = R"rawliteral(
             latField.insertAdjacentElement('beforebegin', infoDiv);
         }
 
+        function escapeHtml(text) {
+            const div = document.createElement('div');
+            div.textContent = text;
+            return div.innerHTML;
+        }
+
+        let citySearchTimer = null;
+        let citySearchResults = [];
+
+        function searchCities(query) {
+            clearTimeout(citySearchTimer);
+            const resultsDiv = document.getElementById('citySearchResults');
+            if (query.trim().length < 2) {
+                resultsDiv.innerHTML = '';
+                return;
+            }
+            citySearchTimer = setTimeout(async () => {
+                try {
+                    const response = await fetch('/api/cities?q=' + encodeURIComponent(query.trim()));
+                    const result = await response.json();
+                    citySearchResults = result.cities || [];
+                    if (citySearchResults.length === 0) {
+                        resultsDiv.innerHTML = '<small>No matching city</small>';
+                        return;
+                    }
+                    resultsDiv.innerHTML = citySearchResults.map((city, i) =>
+                        '<button type="button" class="btn btn-secondary" style="margin: 2px;" onclick="selectCity(' + i + ')">' +
+                        escapeHtml(city.name + ', ' + city.countryName) + '</button>').join('');
+                } catch (e) {
+                    resultsDiv.innerHTML = '';
+                }
+            }, 200);
+        }
+
+        function selectCity(index) {
+            const city = citySearchResults[index];
+            if (!city) return;
+            const latInput = document.querySelector('[name="locationLatitude"]');
+            const lonInput = document.querySelector('[name="locationLongitude"]');
+            latInput.value = city.latitude;
+            lonInput.value = city.longitude;
+            latInput.dispatchEvent(new Event('change'));
+            lonInput.dispatchEvent(new Event('change'));
+
+            const infoDiv = document.getElementById('locationInfo');
+            infoDiv.innerHTML = '<strong>✓ City selected:</strong> ' + escapeHtml(city.name + ', ' + city.countryName) +
+                '<br><small>Coordinates: ' + city.latitude + ', ' + city.longitude + ' (' + escapeHtml(city.timezone) + ')</small>';
+            infoDiv.style.display = 'block';
+            document.getElementById('citySearchResults').innerHTML = '';
+        }
+
         async function detectLocation() {
             const btn = document.getElementById('detectLocationBtn');
             const infoDiv = document.getElementById('locationInfo');
@@ -838,8 +902,19 @@ const char PROGMEM INDEX_HTML[] = R"rawliteral(
             infoDiv.style.display = 'none';
 
             try {
-                const response = await fetch('/api/geolocation');
-                const result = await response.json();
+                let response = await fetch('/api/geolocation');
+                let result = await response.json();
+
+                // The lookup runs in the background, poll the job until it finished
+                const deadline = Date.now() + 30000;
+                while (response.status === 202 && Date.now() < deadline) {
+                    await new Promise(resolve => setTimeout(resolve, 500));
+                    response = await fetch('/api/geolocation?job=' + result.jobId);
+                    result = await response.json();
+                }
+                if (response.status === 202) {
+                    result = { success: false, error: 'Lookup timed out' };
+                }
 
                 if (result.success && result.latitude && result.longitude) {
                     latInput.value = result.latitude;
@@ -926,7 +1001,8 @@ const char PROGMEM INDEX_HTML[] = R"rawliteral(
                 });
                 const result = await response.json();
                 if (result.success) {
-                    showMessage('Configuration saved successfully', 'success');
+                    showMessage('Configuration saved successfully' +
+                        (result.timezone ? ' (timezone: ' + result.timezone + ')' : ''), 'success');
                     config = data;
                     originalConfig = JSON.parse(JSON.stringify(data));
 
@@ -0,0 +1,195 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Ambient light filter and curve fed from replayed traces (pio test -e native)
+
+#include <unity.h>
+#include "AmbientLight.h"
+
+// Device defaults (config.h): AMBIENT_EMA_ALPHA, AMBIENT_HYSTERESIS
+static const uint8_t EMA_ALPHA = 38;
+static const uint16_t HYSTERESIS = 24;
+
+// Dusk at 250 ms per sample: daylight with sensor noise and a headlight
+// spike, the light fading out, a last flicker, then dark
+static const uint16_t DUSK_TRACE[] = {
+  2995, 2984, 3000, 3016, 2978, 2979, 3009, 2981, 2998, 4095, 2978, 3007, 2988, 2977, 2980, 3002,
+  3001, 2979, 2990, 2980, 3010, 3002, 2978, 3011, 2846, 2706, 2559, 2434, 2289, 2166, 2034, 1916,
+  1802, 1692, 1572, 1464, 1367, 1264, 1166, 1078, 994, 902, 820, 743, 674, 614, 546, 482,
+  427, 373, 319, 271, 225, 184, 150, 113, 92, 75, 53, 31, 22, 8, 0, 0,
+  0, 0, 0, 0, 0, 0, 12, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+static const uint16_t DUSK_SAMPLES = sizeof(DUSK_TRACE) / sizeof(DUSK_TRACE[0]);
+static const uint16_t DAYLIGHT_SAMPLES = 24;
+
+static const char* const CURVE = "0=10 300=60 1500=160 3500=255";
+
+// Feeds a constant level, returns the output level afterwards
+static uint16_t feed(AmbientLightFilter& filter, uint16_t raw, uint16_t samples) {
+  for (uint16_t i = 0; i < samples; i++) {
+    filter.add(raw);
+  }
+  return filter.level();
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_replay_source_wraps() {
+  const uint16_t trace[] = {10, 20, 30};
+  ReplaySampleSource source(trace, 3);
+  uint16_t level = 0;
+  for (uint8_t i = 0; i < 7; i++) {
+    TEST_ASSERT_TRUE(source.read(level));
+    TEST_ASSERT_EQUAL_UINT16(trace[i % 3], level);
+  }
+
+  ReplaySampleSource empty(trace, 0);
+  TEST_ASSERT_FALSE(empty.read(level));
+  ReplaySampleSource missing(nullptr, 3);
+  TEST_ASSERT_FALSE(missing.read(level));
+}
+
+void test_step_settles_at_both_ends() {
+  AmbientLightFilter filter(EMA_ALPHA, HYSTERESIS);
+  TEST_ASSERT_FALSE(filter.isReady());
+  TEST_ASSERT_EQUAL_UINT16(1000, feed(filter, 1000, 1));
+  TEST_ASSERT_TRUE(filter.isReady());
+
+  // The hysteresis band used to hold the output at 25 here
+  TEST_ASSERT_EQUAL_UINT16(0, feed(filter, 0, 120));
+  TEST_ASSERT_EQUAL_UINT16(0, filter.smoothed());
+
+  TEST_ASSERT_EQUAL_UINT16(AMBIENT_MAX_LEVEL, feed(filter, AMBIENT_MAX_LEVEL, 120));
+  // Above full scale is clamped
+  TEST_ASSERT_EQUAL_UINT16(AMBIENT_MAX_LEVEL, feed(filter, 0xFFFF, 10));
+  TEST_ASSERT_EQUAL_UINT16(0, feed(filter, 0, 120));
+}
+
+void test_small_step_settles_after_hold() {
+  AmbientLightFilter filter(EMA_ALPHA, HYSTERESIS);
+  feed(filter, 1000, 1);
+
+  // 1030 is inside the band (24 + 1000 / 16): no move while it converges
+  bool changed = false;
+  for (uint8_t i = 0; i < 10; i++) {
+    changed |= filter.add(1030);
+  }
+  TEST_ASSERT_FALSE(changed);
+  TEST_ASSERT_EQUAL_UINT16(1000, filter.level());
+
+  // Once the smoothed level stops moving the output takes it, in one step
+  uint8_t changes = 0;
+  for (uint8_t i = 0; i < 100; i++) {
+    changes += filter.add(1030) ? 1 : 0;
+  }
+  TEST_ASSERT_EQUAL_UINT8(1, changes);
+  TEST_ASSERT_EQUAL_UINT16(1030, filter.level());
+}
+
+void test_spike_and_noise_held() {
+  AmbientLightFilter filter(EMA_ALPHA, HYSTERESIS);
+  feed(filter, 2000, 20);
+
+  // A single spike never reaches the median
+  TEST_ASSERT_FALSE(filter.add(AMBIENT_MAX_LEVEL));
+  TEST_ASSERT_EQUAL_UINT16(2000, feed(filter, 2000, 1));
+
+  // Noise around a steady level moves the output at most once
+  const int16_t noise[] = {-40, 25, 0, -15, 40, 10, -30, 35};
+  uint8_t changes = 0;
+  for (uint16_t i = 0; i < 400; i++) {
+    changes += filter.add(2000 + noise[i % 8]) ? 1 : 0;
+  }
+  TEST_ASSERT_LESS_OR_EQUAL_UINT8(1, changes);
+  uint16_t level = filter.level();
+  TEST_ASSERT_TRUE(level >= 1980 && level <= 2020);
+}
+
+void test_dusk_trace_through_curve() {
+  AmbientCurve curve;
+  TEST_ASSERT_TRUE(compileAmbientCurve(CURVE, curve));
+
+  ReplaySampleSource source(DUSK_TRACE, DUSK_SAMPLES);
+  AmbientLightFilter filter(EMA_ALPHA, HYSTERESIS);
+  uint8_t brightness = 0;
+  uint8_t changes = 0;
+  for (uint16_t i = 0; i < DUSK_SAMPLES; i++) {
+    uint16_t raw;
+    TEST_ASSERT_TRUE(source.read(raw));
+    if (filter.add(raw)) {
+      uint8_t next = evaluateAmbientCurve(curve, filter.level());
+      if (i >= DAYLIGHT_SAMPLES) {
+        // Dusk only ever dims
+        TEST_ASSERT_TRUE(next <= brightness);
+      }
+      changes += next != brightness ? 1 : 0;
+      brightness = next;
+    }
+    if (i == DAYLIGHT_SAMPLES - 1) {
+      // Daylight about 3000 (231), the headlight spike filtered out
+      TEST_ASSERT_TRUE(brightness >= 229 && brightness <= 233);
+    }
+  }
+
+  // Dark settles on the curve's first point, not a few steps above it
+  TEST_ASSERT_EQUAL_UINT16(0, filter.level());
+  TEST_ASSERT_EQUAL_UINT8(10, brightness);
+  // Hysteresis keeps the fade to a few dozen steps, not one per sample
+  TEST_ASSERT_LESS_THAN_UINT8(40, changes);
+
+  // The source wraps: daylight again brings the brightness back up
+  for (uint16_t i = 0; i < DAYLIGHT_SAMPLES; i++) {
+    uint16_t raw;
+    source.read(raw);
+    filter.add(raw);
+  }
+  TEST_ASSERT_TRUE(evaluateAmbientCurve(curve, filter.level()) >= 200);
+}
+
+void test_curve_syntax_and_clamping() {
+  AmbientCurve curve;
+  TEST_ASSERT_FALSE(compileAmbientCurve("", curve));
+  TEST_ASSERT_FALSE(compileAmbientCurve("300=60 0=10", curve));
+  TEST_ASSERT_FALSE(compileAmbientCurve("0=10 0=20", curve));
+  TEST_ASSERT_FALSE(compileAmbientCurve("4096=10", curve));
+  TEST_ASSERT_FALSE(compileAmbientCurve("0=256", curve));
+  TEST_ASSERT_FALSE(compileAmbientCurve("0=10 300", curve));
+
+  TEST_ASSERT_TRUE(compileAmbientCurve("100=20 1100=220", curve));
+  TEST_ASSERT_EQUAL_UINT8(20, evaluateAmbientCurve(curve, 0));
+  TEST_ASSERT_EQUAL_UINT8(20, evaluateAmbientCurve(curve, 100));
+  TEST_ASSERT_EQUAL_UINT8(120, evaluateAmbientCurve(curve, 600));
+  TEST_ASSERT_EQUAL_UINT8(220, evaluateAmbientCurve(curve, 1100));
+  TEST_ASSERT_EQUAL_UINT8(220, evaluateAmbientCurve(curve, AMBIENT_MAX_LEVEL));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_replay_source_wraps);
+  RUN_TEST(test_step_settles_at_both_ends);
+  RUN_TEST(test_small_step_settles_after_hold);
+  RUN_TEST(test_spike_and_noise_held);
+  RUN_TEST(test_dusk_trace_through_curve);
+  RUN_TEST(test_curve_syntax_and_clamping);
+  return UNITY_END();
+}
@@ -0,0 +1,190 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Brightness profile compiler and evaluator (pio test -e native)
+
+#include <unity.h>
+#include <stdio.h>
+#include "BrightnessProfile.h"
+
+// Local time of week, Sunday 00:00 = 0
+enum { SU, MO, TU, WE, TH, FR, SA };
+#define AT(day, h, m) ((day) * SECONDS_PER_DAY + (h) * 3600UL + (m) * 60UL)
+
+static BrightnessProfile profile;
+
+static void compile(const char* text) {
+  profile.curve = BrightnessCurve::Linear;
+  TEST_ASSERT_TRUE_MESSAGE(compileBrightnessProfile(text, profile), text);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_syntax_errors() {
+  const char* const invalid[] = {
+    "*: 24:00=10",
+    "*: 06:60=10",
+    "*: 06:00=256",
+    "*: 06:00=10 07:00",
+    "*:",
+    "*: 06:00=10; mo:",
+    "*: 06:00=10;; mo: 07:00=20",
+    "xx: 06:00=10",
+    "mo-: 06:00=10",
+    "*: 06:00=10x",
+    "*: 06:00=10 06:00=20",
+    "mo: 06:00=10 07:00=20 06:00=30s"
+  };
+  for (uint8_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++) {
+    profile.count = 1;
+    TEST_ASSERT_FALSE_MESSAGE(compileBrightnessProfile(invalid[i], profile), invalid[i]);
+    TEST_ASSERT_EQUAL_UINT8_MESSAGE(0, profile.count, invalid[i]);
+  }
+
+  compile("*: 00:00=0 23:59=255s");
+  TEST_ASSERT_EQUAL_UINT8(14, profile.count);
+  // The same time in different groups is an override, not a repeat
+  compile("*: 06:00=10; mo: 06:00=20");
+  TEST_ASSERT_EQUAL_UINT8(7, profile.count);
+}
+
+void test_later_group_overrides_star() {
+  compile("*: 06:00=10 18:00=200; sa,su: 09:00=50 20:00=100");
+  TEST_ASSERT_EQUAL_UINT8(14, profile.count);
+  for (uint8_t i = 1; i < profile.count; i++) {
+    TEST_ASSERT_TRUE(profile.keyframes[i - 1].secondOfWeek < profile.keyframes[i].secondOfWeek);
+  }
+
+  TEST_ASSERT_EQUAL_UINT8(10, evaluateBrightness(profile, AT(MO, 6, 0)));
+  TEST_ASSERT_EQUAL_UINT8(200, evaluateBrightness(profile, AT(FR, 18, 0)));
+  TEST_ASSERT_EQUAL_UINT8(50, evaluateBrightness(profile, AT(SA, 9, 0)));
+  TEST_ASSERT_EQUAL_UINT8(100, evaluateBrightness(profile, AT(SU, 20, 0)));
+
+  // No 06:00 keyframe left on the weekend: Friday 18:00 fades into Saturday 09:00
+  uint8_t keyframe;
+  evaluateBrightness(profile, AT(SA, 6, 0), &keyframe);
+  TEST_ASSERT_EQUAL_UINT32(AT(FR, 18, 0), profile.keyframes[keyframe].secondOfWeek);
+  TEST_ASSERT_EQUAL_UINT8(80, evaluateBrightness(profile, AT(SA, 6, 0)));
+}
+
+void test_day_range_wraps_at_end_of_week() {
+  compile("*: 12:00=100; fr-mo: 12:00=10");
+  const uint8_t expected[7] = {10, 10, 100, 100, 100, 10, 10};
+  for (uint8_t day = SU; day <= SA; day++) {
+    TEST_ASSERT_EQUAL_UINT8(expected[day], evaluateBrightness(profile, AT(day, 12, 0)));
+  }
+}
+
+void test_evaluation_wraps_at_end_of_week() {
+  // Saturday 12:00 fades into Sunday 12:00 across the week boundary
+  compile("sa: 12:00=200; su: 12:00=0");
+  TEST_ASSERT_EQUAL_UINT8(2, profile.count);
+
+  uint8_t keyframe;
+  TEST_ASSERT_EQUAL_UINT8(150, evaluateBrightness(profile, AT(SA, 18, 0)));
+  TEST_ASSERT_EQUAL_UINT8(100, evaluateBrightness(profile, AT(SU, 0, 0), &keyframe));
+  TEST_ASSERT_EQUAL_UINT8(1, keyframe);
+  TEST_ASSERT_EQUAL_UINT8(50, evaluateBrightness(profile, AT(SU, 6, 0)));
+  TEST_ASSERT_EQUAL_UINT8(100, evaluateBrightness(profile, SECONDS_PER_WEEK + AT(SU, 0, 0)));
+  TEST_ASSERT_EQUAL_UINT8(100, evaluateBrightnessMs(profile, SECONDS_PER_WEEK * 1000UL - 1));
+}
+
+void test_step_and_easing() {
+  compile("*: 06:00=0 08:00=200s 10:00=0i 12:00=200o 14:00=0e");
+
+  // Step holds the previous level until the keyframe
+  TEST_ASSERT_EQUAL_UINT8(0, evaluateBrightness(profile, AT(MO, 7, 59) + 59));
+  TEST_ASSERT_EQUAL_UINT8(0, evaluateBrightnessMs(profile, AT(MO, 8, 0) * 1000UL - 1));
+  TEST_ASSERT_EQUAL_UINT8(200, evaluateBrightness(profile, AT(MO, 8, 0)));
+
+  // Ease-in: x^2, a quarter of the way at half time
+  TEST_ASSERT_EQUAL_UINT8(150, evaluateBrightness(profile, AT(MO, 9, 0)));
+  // Ease-out: 1 - (1 - x)^2
+  TEST_ASSERT_EQUAL_UINT8(150, evaluateBrightness(profile, AT(MO, 11, 0)));
+  // Ease-in-out: symmetric around half time, slow start
+  TEST_ASSERT_EQUAL_UINT8(100, evaluateBrightness(profile, AT(MO, 13, 0)));
+  TEST_ASSERT_EQUAL_UINT8(169, evaluateBrightness(profile, AT(MO, 12, 30)));
+  TEST_ASSERT_EQUAL_UINT8(31, evaluateBrightness(profile, AT(MO, 13, 30)));
+  // Linear back up to the next day
+  TEST_ASSERT_EQUAL_UINT8(0, evaluateBrightness(profile, AT(MO, 14, 0)));
+}
+
+void test_dim_window_across_midnight() {
+  profile.curve = BrightnessCurve::Linear;
+  compileDimWindow(profile, 200, 20, 22 * 3600UL, 6 * 3600UL, 1800);
+  TEST_ASSERT_EQUAL_UINT8(28, profile.count);
+
+  TEST_ASSERT_EQUAL_UINT8(200, evaluateBrightness(profile, AT(WE, 21, 0)));
+  TEST_ASSERT_EQUAL_UINT8(110, evaluateBrightness(profile, AT(WE, 21, 45)));
+  TEST_ASSERT_EQUAL_UINT8(20, evaluateBrightness(profile, AT(WE, 23, 0)));
+  TEST_ASSERT_EQUAL_UINT8(20, evaluateBrightness(profile, AT(TH, 2, 0)));
+  TEST_ASSERT_EQUAL_UINT8(110, evaluateBrightness(profile, AT(TH, 6, 15)));
+  TEST_ASSERT_EQUAL_UINT8(200, evaluateBrightness(profile, AT(TH, 12, 0)));
+  // Saturday night into Sunday morning
+  TEST_ASSERT_EQUAL_UINT8(20, evaluateBrightness(profile, AT(SU, 0, 0)));
+
+  // The fade down itself crosses midnight
+  compileDimWindow(profile, 200, 20, 10 * 60UL, 7 * 3600UL, 1800);
+  TEST_ASSERT_EQUAL_UINT8(200, evaluateBrightness(profile, AT(TU, 23, 30)));
+  TEST_ASSERT_EQUAL_UINT8(110, evaluateBrightness(profile, AT(TU, 23, 55)));
+  TEST_ASSERT_EQUAL_UINT8(20, evaluateBrightness(profile, AT(WE, 0, 10)));
+  TEST_ASSERT_EQUAL_UINT8(20, evaluateBrightness(profile, AT(SU, 0, 30)));
+}
+
+void test_curves_round_trip_every_level() {
+  const BrightnessCurve curves[] = {BrightnessCurve::Linear, BrightnessCurve::Quadratic, BrightnessCurve::Perceptual};
+  char text[48];
+  for (uint8_t c = 0; c < sizeof(curves) / sizeof(curves[0]); c++) {
+    for (uint16_t level = 0; level <= 255; level++) {
+      snprintf(text, sizeof(text), "*: 00:00=%u 12:00=%u", (unsigned)level, (unsigned)(255 - level));
+      compile(text);
+      profile.curve = curves[c];
+      // Progress 0 at both keyframes: level -> curve space -> level
+      TEST_ASSERT_EQUAL_UINT8_MESSAGE(level, evaluateBrightness(profile, AT(TU, 0, 0)), text);
+      TEST_ASSERT_EQUAL_UINT8_MESSAGE(255 - level, evaluateBrightness(profile, AT(TU, 12, 0)), text);
+    }
+  }
+
+  // A full fade never steps backwards in any curve
+  for (uint8_t c = 0; c < sizeof(curves) / sizeof(curves[0]); c++) {
+    compile("*: 00:00=0 01:00=255");
+    profile.curve = curves[c];
+    uint8_t last = 0;
+    for (uint32_t ms = 0; ms <= 3600000UL; ms += 250) {
+      uint8_t level = evaluateBrightnessMs(profile, AT(TU, 0, 0) * 1000UL + ms);
+      TEST_ASSERT_TRUE(level >= last);
+      last = level;
+    }
+    TEST_ASSERT_EQUAL_UINT8(255, last);
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_syntax_errors);
+  RUN_TEST(test_later_group_overrides_star);
+  RUN_TEST(test_day_range_wraps_at_end_of_week);
+  RUN_TEST(test_evaluation_wraps_at_end_of_week);
+  RUN_TEST(test_step_and_easing);
+  RUN_TEST(test_dim_window_across_midnight);
+  RUN_TEST(test_curves_round_trip_every_level);
+  return UNITY_END();
+}
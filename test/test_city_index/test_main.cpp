@@ -0,0 +1,153 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// CityIndex over the generated city table (pio test -e native)
+
+#include <unity.h>
+#include <chrono>
+#include <string.h>
+#include "CityIndex.h"
+
+// Results of /api/cities without a limit (CITY_SEARCH_DEFAULT_RESULTS)
+static const uint8_t RESULTS = 8;
+
+static bool contains(const City* results, uint8_t count, const City& city) {
+  for (uint8_t i = 0; i < count; i++) {
+    if (results[i].name == city.name && strcmp(results[i].timezone, city.timezone) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_table_valid() {
+  const CityIndex& index = getCityIndex();
+  TEST_ASSERT_TRUE(index.isValid());
+  TEST_ASSERT_GREATER_THAN_UINT16(300, index.size());
+  TEST_ASSERT_FALSE(CityIndex(nullptr).isValid());
+}
+
+void test_names_sorted() {
+  const CityIndex& index = getCityIndex();
+  City previous;
+  City city;
+  TEST_ASSERT_TRUE(index.getCity(0, previous));
+  for (uint16_t i = 1; i < index.size(); i++) {
+    TEST_ASSERT_TRUE(index.getCity(i, city));
+    TEST_ASSERT_TRUE_MESSAGE(strcasecmp(previous.name, city.name) <= 0, city.name);
+    previous = city;
+  }
+  TEST_ASSERT_FALSE(index.getCity(index.size(), city));
+}
+
+void test_every_city_found_by_name() {
+  const CityIndex& index = getCityIndex();
+  City results[RESULTS];
+  for (uint16_t i = 0; i < index.size(); i++) {
+    City city;
+    index.getCity(i, city);
+    uint8_t count = index.search(city.name, results, RESULTS);
+    TEST_ASSERT_TRUE_MESSAGE(contains(results, count, city), city.name);
+  }
+}
+
+void test_case_and_underscore_folding() {
+  const CityIndex& index = getCityIndex();
+  City results[RESULTS];
+  uint8_t count = index.search("  new_YORK", results, RESULTS);
+  TEST_ASSERT_GREATER_THAN_UINT8(0, count);
+  TEST_ASSERT_EQUAL_STRING("New York", results[0].name);
+  TEST_ASSERT_EQUAL_STRING("America/New_York", results[0].timezone);
+  TEST_ASSERT_EQUAL_STRING("US", results[0].country);
+
+  TEST_ASSERT_EQUAL_UINT8(0, index.search("", results, RESULTS));
+  TEST_ASSERT_EQUAL_UINT8(0, index.search("   ", results, RESULTS));
+  TEST_ASSERT_EQUAL_UINT8(0, index.search("Zzzz", results, RESULTS));
+  TEST_ASSERT_EQUAL_UINT8(0, index.search("New", results, 0));
+}
+
+void test_results_by_rank() {
+  const CityIndex& index = getCityIndex();
+  City results[RESULTS];
+  const char* prefixes[] = {"a", "b", "s", "san", "new", "port"};
+  for (const char* prefix : prefixes) {
+    uint8_t count = index.search(prefix, results, RESULTS);
+    TEST_ASSERT_GREATER_THAN_UINT8(0, count);
+    for (uint8_t i = 0; i < count; i++) {
+      TEST_ASSERT_TRUE_MESSAGE(strncasecmp(results[i].name, prefix, strlen(prefix)) == 0, results[i].name);
+      if (i > 0) {
+        TEST_ASSERT_TRUE_MESSAGE(results[i - 1].rank >= results[i].rank, results[i].name);
+      }
+    }
+  }
+}
+
+void test_search_time() {
+  const CityIndex& index = getCityIndex();
+  City results[RESULTS];
+
+  // Every prefix of every name, the one letter ones scan the most names.
+  // A binary search plus a scan of the matches stays far below a
+  // millisecond per query, a linear scan of the table would not.
+  uint32_t searches = 0;
+  uint64_t slowestNs = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (uint16_t i = 0; i < index.size(); i++) {
+    City city;
+    index.getCity(i, city);
+    char prefix[48];
+    size_t length = strlen(city.name) < sizeof(prefix) ? strlen(city.name) : sizeof(prefix) - 1;
+    for (size_t n = 1; n <= length; n++) {
+      memcpy(prefix, city.name, n);
+      prefix[n] = '\0';
+      // Best of a few runs, so a preempted run does not count as slow
+      uint64_t fastestNs = UINT64_MAX;
+      for (uint8_t run = 0; run < 3; run++) {
+        auto searchStart = std::chrono::steady_clock::now();
+        index.search(prefix, results, RESULTS);
+        uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - searchStart).count();
+        fastestNs = ns < fastestNs ? ns : fastestNs;
+        searches++;
+      }
+      slowestNs = fastestNs > slowestNs ? fastestNs : slowestNs;
+    }
+  }
+  uint64_t totalUs = std::chrono::duration_cast<std::chrono::microseconds>(
+                       std::chrono::steady_clock::now() - start).count();
+
+  TEST_ASSERT_GREATER_THAN_UINT32(3000, searches);
+  TEST_ASSERT_LESS_THAN_UINT32_MESSAGE(20, (uint32_t)(totalUs / searches), "mean search time (us)");
+  TEST_ASSERT_LESS_THAN_UINT32_MESSAGE(1000, (uint32_t)(slowestNs / 1000), "slowest search (us)");
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_table_valid);
+  RUN_TEST(test_names_sorted);
+  RUN_TEST(test_every_city_found_by_name);
+  RUN_TEST(test_case_and_underscore_folding);
+  RUN_TEST(test_results_by_rank);
+  RUN_TEST(test_search_time);
+  return UNITY_END();
+}
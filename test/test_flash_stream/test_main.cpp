@@ -0,0 +1,146 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Flash assets streamed through FlashStream without allocations (pio test -e native)
+
+#include <unity.h>
+#include <new>
+#include <stdlib.h>
+#include <string.h>
+#include "FlashStream.h"
+#include "web_assets.h"
+
+// Counting allocator: every operator new of the test binary goes through here
+static size_t allocations = 0;
+
+void* operator new(size_t size) {
+  allocations++;
+  void* p = malloc(size > 0 ? size : 1);
+  if (p == nullptr) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+  free(p);
+}
+
+void operator delete[](void* p) noexcept {
+  free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+  free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+  free(p);
+}
+
+// Receives the streamed body, as the TCP send buffers would
+static uint8_t sent[32768];
+
+// Stream an asset the way AsyncAbstractResponse fills its per-ack buffers
+static size_t streamAsset(const uint8_t* asset, size_t length, size_t chunkSize, size_t* chunks) {
+  static uint8_t chunk[8192];
+  FlashStream stream(asset, length);
+  size_t total = 0;
+  *chunks = 0;
+  while (stream.remaining() > 0) {
+    size_t n = stream.read(chunk, chunkSize);
+    if (n == 0 || total + n > sizeof(sent)) {
+      break;
+    }
+    memcpy(sent + total, chunk, n);
+    total += n;
+    (*chunks)++;
+  }
+  return total;
+}
+
+// Chunk sizes from a tiny window to more than the whole asset
+static const size_t CHUNK_SIZES[] = {1, 7, 536, 1436, 2920, 5744, 8192};
+
+static void checkAsset(const uint8_t* asset, size_t length, const char* name) {
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(sizeof(sent), length, name);
+  // gzip member header
+  TEST_ASSERT_EQUAL_UINT8_MESSAGE(0x1f, asset[0], name);
+  TEST_ASSERT_EQUAL_UINT8_MESSAGE(0x8b, asset[1], name);
+
+  for (size_t chunkSize : CHUNK_SIZES) {
+    memset(sent, 0, sizeof(sent));
+    size_t chunks = 0;
+    allocations = 0;
+    size_t total = streamAsset(asset, length, chunkSize, &chunks);
+    size_t allocated = allocations;
+
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, allocated, name);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(length, total, name);
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(asset, sent, length, name);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE((length + chunkSize - 1) / chunkSize, chunks, name);
+  }
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_allocator_counts() {
+  // Makes sure a zero below means no allocation, not a missing hook
+  static int* volatile value;
+  allocations = 0;
+  value = new int(1);
+  delete value;
+  TEST_ASSERT_EQUAL_UINT32(1, allocations);
+}
+
+void test_index_html_streamed() {
+  checkAsset(INDEX_HTML_GZ, sizeof(INDEX_HTML_GZ), "INDEX_HTML_GZ");
+}
+
+void test_schema_streamed() {
+  checkAsset(SCHEMA_JSON_GZ, sizeof(SCHEMA_JSON_GZ), "SCHEMA_JSON_GZ");
+}
+
+void test_end_of_body() {
+  uint8_t buffer[16];
+  FlashStream stream(INDEX_HTML_GZ, 10);
+  TEST_ASSERT_EQUAL_UINT32(10, stream.length());
+  TEST_ASSERT_EQUAL_UINT32(0, stream.read(buffer, 0));
+  TEST_ASSERT_EQUAL_UINT32(10, stream.read(buffer, sizeof(buffer)));
+  TEST_ASSERT_EQUAL_UINT32(0, stream.remaining());
+  TEST_ASSERT_EQUAL_UINT32(0, stream.read(buffer, sizeof(buffer)));
+
+  FlashStream empty(INDEX_HTML_GZ, 0);
+  TEST_ASSERT_EQUAL_UINT32(0, empty.read(buffer, sizeof(buffer)));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_allocator_counts);
+  RUN_TEST(test_index_html_streamed);
+  RUN_TEST(test_schema_streamed);
+  RUN_TEST(test_end_of_body);
+  return UNITY_END();
+}
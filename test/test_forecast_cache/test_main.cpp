@@ -0,0 +1,162 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Hourly forecast ring and interpolation (pio test -e native)
+
+#include <unity.h>
+#include "ForecastCache.h"
+
+static const uint32_t HOUR = 3600;
+static const uint32_t START = 1767225600;  // 2026-01-01 00:00 UTC
+static const float LAT = 47.3769f;
+static const float LON = 8.5417f;
+
+// Tenths of a degree are stored, interpolation stays within float rounding
+static const float TOLERANCE = 0.001f;
+
+static ForecastCache cache;
+
+void setUp() {
+  resetForecast(cache, START, LAT, LON, false);
+}
+
+void tearDown() {}
+
+void test_interpolation_and_end_points() {
+  float temperature = 99.0f;
+  TEST_ASSERT_FALSE(forecastTemperatureAt(cache, START, temperature));
+
+  TEST_ASSERT_TRUE(addForecastPoint(cache, START, 10.0f));
+  TEST_ASSERT_TRUE(addForecastPoint(cache, START + HOUR, 12.34f));
+  TEST_ASSERT_TRUE(addForecastPoint(cache, START + 2 * HOUR, -1.5f));
+
+  // Exact points, stored in tenths
+  TEST_ASSERT_TRUE(forecastTemperatureAt(cache, START, temperature));
+  TEST_ASSERT_FLOAT_WITHIN(TOLERANCE, 10.0f, temperature);
+  TEST_ASSERT_TRUE(forecastTemperatureAt(cache, START + HOUR, temperature));
+  TEST_ASSERT_FLOAT_WITHIN(TOLERANCE, 12.3f, temperature);
+  TEST_ASSERT_TRUE(forecastTemperatureAt(cache, START + 2 * HOUR, temperature));
+  TEST_ASSERT_FLOAT_WITHIN(TOLERANCE, -1.5f, temperature);
+
+  // Linear in between, also across zero
+  TEST_ASSERT_TRUE(forecastTemperatureAt(cache, START + HOUR / 2, temperature));
+  TEST_ASSERT_FLOAT_WITHIN(TOLERANCE, 11.15f, temperature);
+  TEST_ASSERT_TRUE(forecastTemperatureAt(cache, START + HOUR + HOUR / 4, temperature));
+  TEST_ASSERT_FLOAT_WITHIN(TOLERANCE, 8.85f, temperature);
+  TEST_ASSERT_TRUE(forecastTemperatureAt(cache, START + 2 * HOUR - 1, temperature));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, -1.496f, temperature);
+
+  // Outside the range: no value, temperature left alone
+  temperature = 99.0f;
+  TEST_ASSERT_FALSE(forecastTemperatureAt(cache, START - 1, temperature));
+  TEST_ASSERT_FALSE(forecastTemperatureAt(cache, START + 2 * HOUR + 1, temperature));
+  TEST_ASSERT_FLOAT_WITHIN(TOLERANCE, 99.0f, temperature);
+
+  TEST_ASSERT_TRUE(forecastCovers(cache, START, LAT, LON));
+  TEST_ASSERT_TRUE(forecastCovers(cache, START + 2 * HOUR, LAT, LON));
+  TEST_ASSERT_FALSE(forecastCovers(cache, START + 2 * HOUR + 1, LAT, LON));
+}
+
+void test_ring_wraps_when_full() {
+  // Temperature = hour index, so every value tells where it came from
+  const uint8_t total = FORECAST_MAX_POINTS + 12;
+  for (uint8_t hour = 0; hour < total; hour++) {
+    TEST_ASSERT_TRUE(addForecastPoint(cache, START + hour * HOUR, hour));
+  }
+  TEST_ASSERT_EQUAL_UINT8(FORECAST_MAX_POINTS, cache.count);
+  TEST_ASSERT_EQUAL_UINT8(12, cache.head);
+
+  // Oldest points overwritten
+  float temperature;
+  TEST_ASSERT_FALSE(forecastCovers(cache, START + 11 * HOUR, LAT, LON));
+  TEST_ASSERT_FALSE(forecastTemperatureAt(cache, START + 11 * HOUR, temperature));
+  TEST_ASSERT_TRUE(forecastCovers(cache, START + 12 * HOUR, LAT, LON));
+  TEST_ASSERT_TRUE(forecastTemperatureAt(cache, START + 12 * HOUR, temperature));
+  TEST_ASSERT_FLOAT_WITHIN(TOLERANCE, 12.0f, temperature);
+
+  // Every hour found after the wrap, including across the end of the array
+  for (uint8_t hour = 12; hour < total; hour++) {
+    TEST_ASSERT_TRUE(forecastTemperatureAt(cache, START + hour * HOUR, temperature));
+    TEST_ASSERT_FLOAT_WITHIN(TOLERANCE, (float)hour, temperature);
+  }
+  const uint8_t lastSlotHour = FORECAST_MAX_POINTS - 1;
+  TEST_ASSERT_TRUE(forecastTemperatureAt(cache, START + lastSlotHour * HOUR + HOUR / 2, temperature));
+  TEST_ASSERT_FLOAT_WITHIN(TOLERANCE, lastSlotHour + 0.5f, temperature);
+
+  TEST_ASSERT_TRUE(forecastTemperatureAt(cache, START + (total - 1) * HOUR, temperature));
+  TEST_ASSERT_FLOAT_WITHIN(TOLERANCE, total - 1.0f, temperature);
+  TEST_ASSERT_FALSE(forecastCovers(cache, START + total * HOUR, LAT, LON));
+
+  // A reset empties the ring
+  resetForecast(cache, START, LAT, LON, false);
+  TEST_ASSERT_EQUAL_UINT8(0, cache.count);
+  TEST_ASSERT_FALSE(forecastCovers(cache, START + 20 * HOUR, LAT, LON));
+}
+
+void test_out_of_order_points_rejected() {
+  TEST_ASSERT_TRUE(addForecastPoint(cache, START + HOUR, 5.0f));
+  TEST_ASSERT_FALSE(addForecastPoint(cache, START + HOUR, 6.0f));
+  TEST_ASSERT_FALSE(addForecastPoint(cache, START, 7.0f));
+  TEST_ASSERT_EQUAL_UINT8(1, cache.count);
+
+  float temperature;
+  TEST_ASSERT_TRUE(forecastTemperatureAt(cache, START + HOUR, temperature));
+  TEST_ASSERT_FLOAT_WITHIN(TOLERANCE, 5.0f, temperature);
+
+  // Also once the ring has wrapped
+  for (uint8_t hour = 2; hour <= FORECAST_MAX_POINTS + 1; hour++) {
+    TEST_ASSERT_TRUE(addForecastPoint(cache, START + hour * HOUR, hour));
+  }
+  uint8_t head = cache.head;
+  TEST_ASSERT_FALSE(addForecastPoint(cache, START + 3 * HOUR, 0.0f));
+  TEST_ASSERT_EQUAL_UINT8(head, cache.head);
+  TEST_ASSERT_EQUAL_UINT8(FORECAST_MAX_POINTS, cache.count);
+}
+
+void test_location_mismatch() {
+  addForecastPoint(cache, START, 1.0f);
+  addForecastPoint(cache, START + HOUR, 2.0f);
+
+  // Within about 100 m counts as the same place
+  TEST_ASSERT_TRUE(forecastCovers(cache, START, LAT, LON));
+  TEST_ASSERT_TRUE(forecastCovers(cache, START, LAT + 0.0005f, LON - 0.0005f));
+  TEST_ASSERT_FALSE(forecastCovers(cache, START, LAT + 0.002f, LON));
+  TEST_ASSERT_FALSE(forecastCovers(cache, START, LAT - 0.002f, LON));
+  TEST_ASSERT_FALSE(forecastCovers(cache, START, LAT, LON + 0.002f));
+  TEST_ASSERT_FALSE(forecastCovers(cache, START, -LAT, LON));
+
+  // Never fetched, or a damaged persisted ring
+  resetForecast(cache, 0, LAT, LON, false);
+  addForecastPoint(cache, START, 1.0f);
+  TEST_ASSERT_FALSE(forecastCovers(cache, START, LAT, LON));
+  resetForecast(cache, START, LAT, LON, false);
+  addForecastPoint(cache, START, 1.0f);
+  cache.head = FORECAST_MAX_POINTS;
+  TEST_ASSERT_FALSE(forecastCovers(cache, START, LAT, LON));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_interpolation_and_end_points);
+  RUN_TEST(test_ring_wraps_when_full);
+  RUN_TEST(test_out_of_order_points_rejected);
+  RUN_TEST(test_location_mismatch);
+  return UNITY_END();
+}
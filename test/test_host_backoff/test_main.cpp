@@ -0,0 +1,257 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// HostBackoff schedule, circuit breaker and host table (pio test -e native)
+
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include "HostBackoff.h"
+
+typedef HostBackoff::Decision Decision;
+typedef HostBackoff::State State;
+
+// Backoff 1 s doubling up to 16 s, open after 4 failures for 60 s
+static const HostBackoff::Policy POLICY = {1000, 16000, 4, 60000};
+
+// Random values giving the shortest and the longest jittered delay
+static const uint32_t SHORTEST = 0;
+static uint32_t longest(uint32_t delayMs) {
+  return delayMs - delayMs / 2;
+}
+
+// Server that is down during [downFromMs, downUntilMs), counts what reaches it
+struct MockServer {
+  uint32_t downFromMs;
+  uint32_t downUntilMs;
+  uint32_t requests;
+
+  bool handle(uint32_t nowMs) {
+    requests++;
+    return nowMs - downFromMs >= downUntilMs - downFromMs;
+  }
+};
+
+// Client asking every 100 ms, as the loop does while a fetch is due
+static void runClient(HostBackoff& backoff, MockServer& server, uint32_t fromMs, uint32_t toMs, uint32_t random) {
+  for (uint32_t now = fromMs; now < toMs; now += 100) {
+    if (backoff.acquire("api.example.com", now) != Decision::Allow) {
+      continue;
+    }
+    if (server.handle(now)) {
+      backoff.recordSuccess("api.example.com", now);
+    } else {
+      backoff.recordFailure("api.example.com", now, random);
+    }
+  }
+}
+
+static bool hasHost(const HostBackoff& backoff, const char* name) {
+  for (uint8_t i = 0; i < backoff.getHostCount(); i++) {
+    if (strcmp(backoff.getHost(i).name, name) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_backoff_schedule() {
+  HostBackoff::Policy policy = POLICY;
+  policy.openAfterFailures = 10;
+  HostBackoff backoff(policy);
+
+  // Longest jitter: the full delay, doubling from 1 s up to the 16 s cap
+  const uint32_t expected[] = {1000, 2000, 4000, 8000, 16000, 16000, 16000};
+  uint32_t now = 5000;
+  for (uint8_t i = 0; i < sizeof(expected) / sizeof(expected[0]); i++) {
+    TEST_ASSERT_EQUAL(Decision::Allow, backoff.acquire("a", now));
+    backoff.recordFailure("a", now, longest(expected[i]));
+    TEST_ASSERT_EQUAL(State::Backoff, backoff.getState("a"));
+    TEST_ASSERT_EQUAL_UINT32(expected[i], backoff.retryInMs("a", now));
+    TEST_ASSERT_EQUAL(Decision::Deferred, backoff.acquire("a", now + expected[i] - 1));
+    now += expected[i];
+  }
+  TEST_ASSERT_EQUAL(Decision::Allow, backoff.acquire("a", now));
+  backoff.recordSuccess("a", now);
+  TEST_ASSERT_EQUAL(State::Closed, backoff.getState("a"));
+
+  // A success resets the schedule
+  backoff.recordFailure("a", now, longest(1000));
+  TEST_ASSERT_EQUAL_UINT32(1000, backoff.retryInMs("a", now));
+}
+
+void test_jitter_bounds() {
+  HostBackoff::Policy policy = POLICY;
+  policy.openAfterFailures = 10;
+
+  // Delay after the n-th failure stays within [delay / 2, delay]
+  const uint32_t delays[] = {1000, 2000, 4000, 8000, 16000};
+  for (uint8_t failures = 1; failures <= 5; failures++) {
+    uint32_t delay = delays[failures - 1];
+    uint32_t shortest = UINT32_MAX;
+    uint32_t longestSeen = 0;
+    for (uint32_t i = 0; i < 2000; i++) {
+      HostBackoff backoff(policy);
+      uint32_t random = i * 2654435761UL;
+      for (uint8_t f = 0; f < failures; f++) {
+        backoff.recordFailure("a", 0, random);
+      }
+      uint32_t wait = backoff.retryInMs("a", 0);
+      TEST_ASSERT_GREATER_OR_EQUAL_UINT32(delay / 2, wait);
+      TEST_ASSERT_LESS_OR_EQUAL_UINT32(delay, wait);
+      shortest = wait < shortest ? wait : shortest;
+      longestSeen = wait > longestSeen ? wait : longestSeen;
+    }
+    // The random values spread over most of the range
+    TEST_ASSERT_LESS_THAN_UINT32(delay / 2 + delay / 20, shortest);
+    TEST_ASSERT_GREATER_THAN_UINT32(delay - delay / 20, longestSeen);
+  }
+
+  // Edge values of the random number
+  HostBackoff backoff(policy);
+  backoff.recordFailure("a", 0, SHORTEST);
+  TEST_ASSERT_EQUAL_UINT32(500, backoff.retryInMs("a", 0));
+  backoff.recordFailure("b", 0, UINT32_MAX);
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT32(500, backoff.retryInMs("b", 0));
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(1000, backoff.retryInMs("b", 0));
+}
+
+void test_open_half_open_closed() {
+  HostBackoff backoff(POLICY);
+  uint32_t now = 1000;
+
+  // Four failures in a row open the circuit
+  for (uint8_t i = 0; i < 4; i++) {
+    now += 20000;
+    TEST_ASSERT_EQUAL(Decision::Allow, backoff.acquire("a", now));
+    backoff.recordFailure("a", now, longest(POLICY.openMs));
+  }
+  TEST_ASSERT_EQUAL(State::Open, backoff.getState("a"));
+  TEST_ASSERT_EQUAL_UINT32(60000, backoff.retryInMs("a", now));
+  TEST_ASSERT_EQUAL(Decision::Rejected, backoff.acquire("a", now + 59999));
+
+  // Open period over: one probe, further requests are rejected while it runs
+  now += 60000;
+  TEST_ASSERT_EQUAL(Decision::Allow, backoff.acquire("a", now));
+  TEST_ASSERT_EQUAL(State::HalfOpen, backoff.getState("a"));
+  TEST_ASSERT_EQUAL(Decision::Rejected, backoff.acquire("a", now + 100));
+
+  // Failed probe opens again right away
+  backoff.recordFailure("a", now + 200, longest(POLICY.openMs));
+  TEST_ASSERT_EQUAL(State::Open, backoff.getState("a"));
+  now += 200 + 60000;
+
+  // Successful probe closes
+  TEST_ASSERT_EQUAL(Decision::Allow, backoff.acquire("a", now));
+  backoff.recordSuccess("a", now + 300);
+  TEST_ASSERT_EQUAL(State::Closed, backoff.getState("a"));
+  TEST_ASSERT_EQUAL(Decision::Allow, backoff.acquire("a", now + 400));
+
+  HostBackoff::Stats stats = backoff.getStats();
+  TEST_ASSERT_EQUAL_UINT32(2, stats.probes);
+  TEST_ASSERT_EQUAL_UINT32(2, stats.opens);
+  TEST_ASSERT_EQUAL_UINT32(2, stats.rejected);
+  TEST_ASSERT_EQUAL_UINT32(5, stats.failures);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.successes);
+}
+
+void test_lost_probe_replaced() {
+  HostBackoff backoff(POLICY);
+  for (uint8_t i = 0; i < 4; i++) {
+    backoff.recordFailure("a", 0, longest(POLICY.openMs));
+  }
+  TEST_ASSERT_EQUAL(Decision::Allow, backoff.acquire("a", 60000));
+
+  // The probe never reports back: another one after a further open period
+  TEST_ASSERT_EQUAL(Decision::Rejected, backoff.acquire("a", 119999));
+  TEST_ASSERT_EQUAL(Decision::Allow, backoff.acquire("a", 120000));
+  TEST_ASSERT_EQUAL(State::HalfOpen, backoff.getState("a"));
+}
+
+void test_lru_replacement() {
+  HostBackoff backoff(POLICY);
+  char name[8];
+  for (uint8_t i = 0; i < HOST_BACKOFF_SLOTS; i++) {
+    snprintf(name, sizeof(name), "host%u", i);
+    backoff.recordFailure(name, 1000 + i, SHORTEST);
+  }
+  TEST_ASSERT_EQUAL_UINT8(HOST_BACKOFF_SLOTS, backoff.getHostCount());
+
+  // host0 is used again, host1 is now the least recently used
+  backoff.acquire("host0", 2000);
+  backoff.recordFailure("new", 3000, SHORTEST);
+  TEST_ASSERT_EQUAL_UINT8(HOST_BACKOFF_SLOTS, backoff.getHostCount());
+  TEST_ASSERT_FALSE(hasHost(backoff, "host1"));
+  TEST_ASSERT_EQUAL(State::Backoff, backoff.getState("host0"));
+  TEST_ASSERT_EQUAL(State::Backoff, backoff.getState("new"));
+
+  // The replaced slot starts fresh: one failure, 1 s delay at most
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(1000, backoff.retryInMs("new", 3000));
+
+  // Least recently used across the millis() wrap
+  HostBackoff wrapped(POLICY);
+  for (uint8_t i = 0; i < HOST_BACKOFF_SLOTS; i++) {
+    snprintf(name, sizeof(name), "host%u", i);
+    wrapped.acquire(name, 0xFFFFFF00UL + i * 100);  // host3 is past the wrap
+  }
+  wrapped.acquire("new", 0x00001000UL);
+  TEST_ASSERT_FALSE(hasHost(wrapped, "host0"));
+  TEST_ASSERT_TRUE(hasHost(wrapped, "host3"));
+  TEST_ASSERT_TRUE(hasHost(wrapped, "new"));
+}
+
+void test_mock_server_outage() {
+  HostBackoff backoff(POLICY);
+
+  // Down for 5 minutes: after the backoffs and the opening failures only
+  // a probe per open period reaches the server
+  MockServer server = {10000, 310000, 0};
+  runClient(backoff, server, 0, 10000, longest(1000));
+  uint32_t healthyRequests = server.requests;
+  TEST_ASSERT_EQUAL_UINT32(100, healthyRequests);
+
+  runClient(backoff, server, 10000, 310000, longest(POLICY.openMs));
+  uint32_t outageRequests = server.requests - healthyRequests;
+  // 4 failures until open (after 1 + 2 + 4 s), then a probe every 60 s
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(4 + 5, outageRequests);
+  TEST_ASSERT_EQUAL(State::Open, backoff.getState("api.example.com"));
+
+  // Back up: the next probe closes the circuit within an open period,
+  // then every request goes through again
+  runClient(backoff, server, 310000, 310000 + POLICY.openMs + 1000, longest(1000));
+  TEST_ASSERT_EQUAL(State::Closed, backoff.getState("api.example.com"));
+  uint32_t recoveredRequests = server.requests;
+  runClient(backoff, server, 400000, 410000, longest(1000));
+  TEST_ASSERT_EQUAL_UINT32(100, server.requests - recoveredRequests);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_backoff_schedule);
+  RUN_TEST(test_jitter_bounds);
+  RUN_TEST(test_open_half_open_closed);
+  RUN_TEST(test_lost_probe_replaced);
+  RUN_TEST(test_lru_replacement);
+  RUN_TEST(test_mock_server_outage);
+  return UNITY_END();
+}
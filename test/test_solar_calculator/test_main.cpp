@@ -0,0 +1,177 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// computeSolarTimes() against reference tables (pio test -e native)
+
+#include <unity.h>
+#include <stdio.h>
+#include "SolarCalculator.h"
+
+// Allowed difference to the reference, seconds
+static const int32_t TOLERANCE_S = 60;
+
+// Time of day in UTC, seconds
+#define HMS(h, m, s) ((h) * 3600L + (m) * 60L + (s))
+#define PREV_DAY(t) ((t) - 86400L)
+#define NONE INT32_MIN
+
+// Reference times from the NOAA Solar Calculator (Meeus), UTC
+struct ReferenceDay {
+  const char* place;
+  double latitude;
+  double longitude;
+  int month;
+  int day;
+  int32_t noon;
+  int32_t sunrise;  // NONE: sun does not cross -0.833 degrees
+  int32_t sunset;
+  int32_t dawn;     // NONE: sun does not cross -6 degrees
+  int32_t dusk;
+};
+
+static const ReferenceDay REFERENCE[] = {
+  // London 51.5074 N, 0.1278 W
+  {"London", 51.5074, -0.1278, 3, 20, HMS(12, 7, 52), HMS(6, 2, 50), HMS(18, 13, 56), HMS(5, 29, 34), HMS(18, 47, 18)},
+  {"London", 51.5074, -0.1278, 6, 21, HMS(12, 2, 23), HMS(3, 43, 8), HMS(20, 21, 38), HMS(2, 55, 21), HMS(21, 9, 24)},
+  {"London", 51.5074, -0.1278, 9, 22, HMS(11, 53, 10), HMS(5, 46, 52), HMS(17, 58, 28), HMS(5, 13, 30), HMS(18, 31, 44)},
+  {"London", 51.5074, -0.1278, 12, 21, HMS(11, 58, 43), HMS(8, 3, 53), HMS(15, 53, 32), HMS(7, 23, 32), HMS(16, 33, 53)},
+  // Sydney 33.8688 S, 151.2093 E (sunrise and dawn fall on the previous UTC day)
+  {"Sydney", -33.8688, 151.2093, 3, 20, HMS(2, 2, 39), PREV_DAY(HMS(19, 58, 8)), HMS(8, 6, 37), PREV_DAY(HMS(19, 33, 12)), HMS(8, 31, 31)},
+  {"Sydney", -33.8688, 151.2093, 6, 21, HMS(1, 56, 57), PREV_DAY(HMS(21, 0, 1)), HMS(6, 53, 53), PREV_DAY(HMS(20, 32, 17)), HMS(7, 21, 37)},
+  {"Sydney", -33.8688, 151.2093, 12, 21, HMS(1, 53, 9), PREV_DAY(HMS(18, 40, 46)), HMS(9, 5, 33), PREV_DAY(HMS(18, 11, 36)), HMS(9, 34, 43)},
+  // Quito 0.1807 S, 78.4678 W (day length barely changes on the equator)
+  {"Quito", -0.1807, -78.4678, 3, 20, HMS(17, 21, 10), HMS(11, 17, 55), HMS(23, 24, 25), HMS(10, 57, 15), HMS(23, 45, 5)},
+  {"Quito", -0.1807, -78.4678, 6, 21, HMS(17, 15, 48), HMS(11, 12, 25), HMS(23, 19, 10), HMS(10, 49, 53), HMS(23, 41, 42)},
+  {"Quito", -0.1807, -78.4678, 12, 21, HMS(17, 12, 11), HMS(11, 8, 6), HMS(23, 16, 15), HMS(10, 45, 34), HMS(23, 38, 48)},
+  // Tromso 69.6492 N, 18.9553 E: equinoxes, short days, polar night, midnight sun
+  {"Tromso", 69.6492, 18.9553, 3, 20, HMS(10, 51, 33), HMS(4, 42, 47), HMS(17, 2, 31), HMS(3, 42, 38), HMS(18, 3, 9)},
+  {"Tromso", 69.6492, 18.9553, 9, 22, HMS(10, 36, 51), HMS(4, 24, 55), HMS(16, 46, 38), HMS(3, 24, 14), HMS(17, 46, 50)},
+  {"Tromso", 69.6492, 18.9553, 11, 20, HMS(10, 29, 49), HMS(9, 0, 31), HMS(11, 58, 14), HMS(7, 11, 43), HMS(13, 46, 58)},
+  {"Tromso", 69.6492, 18.9553, 1, 20, HMS(10, 55, 15), HMS(9, 34, 13), HMS(12, 17, 10), HMS(7, 41, 31), HMS(14, 9, 55)},
+  {"Tromso", 69.6492, 18.9553, 12, 21, HMS(10, 42, 21), NONE, NONE, HMS(8, 31, 22), HMS(12, 53, 20)},
+  {"Tromso", 69.6492, 18.9553, 5, 15, HMS(10, 40, 33), PREV_DAY(HMS(23, 40, 34)), HMS(21, 51, 38), NONE, NONE},
+  {"Tromso", 69.6492, 18.9553, 6, 21, HMS(10, 46, 3), NONE, NONE, NONE, NONE},
+};
+
+// Unix time of 00:00 UTC of a date
+static int64_t dayStart(int year, int month, int day) {
+  int y = year - (month <= 2);
+  int era = y / 400;
+  int yearOfEra = y - era * 400;
+  int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return ((int64_t)era * 146097 + dayOfEra - 719468) * 86400;
+}
+
+static void assertTime(const char* what, const ReferenceDay& ref, int64_t start, int32_t expected, int64_t actual) {
+  char message[64];
+  snprintf(message, sizeof(message), "%s %s %d-%d", ref.place, what, ref.month, ref.day);
+  TEST_ASSERT_INT_WITHIN_MESSAGE(TOLERANCE_S, 0, (int32_t)(actual - (start + expected)), message);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_reference_days() {
+  for (size_t i = 0; i < sizeof(REFERENCE) / sizeof(REFERENCE[0]); i++) {
+    const ReferenceDay& ref = REFERENCE[i];
+    SolarTimes times;
+    computeSolarTimes(2025, ref.month, ref.day, ref.latitude, ref.longitude, times);
+    int64_t start = dayStart(2025, ref.month, ref.day);
+
+    assertTime("noon", ref, start, ref.noon, times.noon);
+    if (ref.sunrise == NONE) {
+      TEST_ASSERT_TRUE_MESSAGE(times.sun != SolarEvent::Normal, ref.place);
+    } else {
+      TEST_ASSERT_TRUE_MESSAGE(times.sun == SolarEvent::Normal, ref.place);
+      assertTime("sunrise", ref, start, ref.sunrise, times.sunrise);
+      assertTime("sunset", ref, start, ref.sunset, times.sunset);
+    }
+    if (ref.dawn == NONE) {
+      TEST_ASSERT_TRUE_MESSAGE(times.civil != SolarEvent::Normal, ref.place);
+    } else {
+      TEST_ASSERT_TRUE_MESSAGE(times.civil == SolarEvent::Normal, ref.place);
+      assertTime("dawn", ref, start, ref.dawn, times.dawn);
+      assertTime("dusk", ref, start, ref.dusk, times.dusk);
+    }
+  }
+}
+
+void test_polar_night_and_midnight_sun() {
+  SolarTimes times;
+
+  // Tromso: sun below the horizon all day, civil twilight around noon
+  computeSolarTimes(2025, 12, 21, 69.6492, 18.9553, times);
+  TEST_ASSERT_TRUE(times.sun == SolarEvent::AlwaysBelow);
+  TEST_ASSERT_TRUE(times.civil == SolarEvent::Normal);
+
+  // Tromso: midnight sun, no twilight either
+  computeSolarTimes(2025, 6, 21, 69.6492, 18.9553, times);
+  TEST_ASSERT_TRUE(times.sun == SolarEvent::AlwaysAbove);
+  TEST_ASSERT_TRUE(times.civil == SolarEvent::AlwaysAbove);
+
+  // Tromso in May: sun sets, but never reaches -6 degrees (white night)
+  computeSolarTimes(2025, 5, 15, 69.6492, 18.9553, times);
+  TEST_ASSERT_TRUE(times.sun == SolarEvent::Normal);
+  TEST_ASSERT_TRUE(times.civil == SolarEvent::AlwaysAbove);
+}
+
+void test_poles() {
+  SolarTimes times;
+
+  computeSolarTimes(2025, 6, 21, 90.0, 0.0, times);
+  TEST_ASSERT_TRUE(times.sun == SolarEvent::AlwaysAbove);
+  TEST_ASSERT_TRUE(times.civil == SolarEvent::AlwaysAbove);
+  computeSolarTimes(2025, 12, 21, 90.0, 0.0, times);
+  TEST_ASSERT_TRUE(times.sun == SolarEvent::AlwaysBelow);
+  TEST_ASSERT_TRUE(times.civil == SolarEvent::AlwaysBelow);
+
+  computeSolarTimes(2025, 6, 21, -90.0, 0.0, times);
+  TEST_ASSERT_TRUE(times.sun == SolarEvent::AlwaysBelow);
+  TEST_ASSERT_TRUE(times.civil == SolarEvent::AlwaysBelow);
+  computeSolarTimes(2025, 12, 21, -90.0, 0.0, times);
+  TEST_ASSERT_TRUE(times.sun == SolarEvent::AlwaysAbove);
+  TEST_ASSERT_TRUE(times.civil == SolarEvent::AlwaysAbove);
+
+  // Noon stays defined without rise and set (equation of time is at most 17 minutes)
+  TEST_ASSERT_INT_WITHIN(HMS(0, 17, 0), HMS(12, 0, 0), (int32_t)(times.noon - dayStart(2025, 12, 21)));
+}
+
+void test_events_in_order() {
+  // Every month at 60 degrees north: dawn < sunrise < noon < sunset < dusk
+  for (int month = 1; month <= 12; month++) {
+    SolarTimes times;
+    computeSolarTimes(2025, month, 15, 60.0, 10.0, times);
+    TEST_ASSERT_TRUE(times.sun == SolarEvent::Normal);
+    TEST_ASSERT_TRUE(times.sunrise < times.noon && times.noon < times.sunset);
+    if (times.civil == SolarEvent::Normal) {
+      TEST_ASSERT_TRUE(times.dawn < times.sunrise && times.sunset < times.dusk);
+    }
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_reference_days);
+  RUN_TEST(test_polar_night_and_midnight_sun);
+  RUN_TEST(test_poles);
+  RUN_TEST(test_events_in_order);
+  return UNITY_END();
+}
@@ -0,0 +1,268 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// TimezoneGrid accuracy against reference cities (pio test -e native)
+
+#include <unity.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "TimezoneGrid.h"
+
+// City, its zone and standard UTC offset (minutes, outside daylight saving
+// time), and what the built-in nearest-city raster answers for it
+struct ReferencePoint {
+  const char* city;
+  float latitude;
+  float longitude;
+  const char* zone;
+  int16_t offsetMin;
+  const char* gridZone;
+  int16_t gridOffsetMin;
+};
+
+// Raster gives the city's own zone
+#define EXACT(city, lat, lon, zone, offset) {city, lat, lon, zone, offset, zone, offset}
+// Raster gives a neighbouring zone with the same offset
+#define NEIGHBOUR(city, lat, lon, zone, gridZone, offset) {city, lat, lon, zone, offset, gridZone, offset}
+// Border miss: the nearest principal city lies across a border with another offset
+#define MISS(city, lat, lon, zone, offset, gridZone, gridOffset) {city, lat, lon, zone, offset, gridZone, gridOffset}
+
+static const ReferencePoint REFERENCE[] = {
+  // Europe
+  EXACT("Zurich", 47.37f, 8.54f, "Europe/Zurich", 60),
+  EXACT("London", 51.51f, -0.13f, "Europe/London", 0),
+  EXACT("Dublin", 53.35f, -6.26f, "Europe/Dublin", 0),
+  EXACT("Lisbon", 38.72f, -9.14f, "Europe/Lisbon", 0),
+  EXACT("Madrid", 40.42f, -3.70f, "Europe/Madrid", 60),
+  EXACT("Paris", 48.86f, 2.35f, "Europe/Paris", 60),
+  EXACT("Brussels", 50.85f, 4.35f, "Europe/Brussels", 60),
+  EXACT("Amsterdam", 52.37f, 4.90f, "Europe/Amsterdam", 60),
+  EXACT("Berlin", 52.52f, 13.40f, "Europe/Berlin", 60),
+  EXACT("Copenhagen", 55.68f, 12.57f, "Europe/Copenhagen", 60),
+  EXACT("Oslo", 59.91f, 10.75f, "Europe/Oslo", 60),
+  EXACT("Stockholm", 59.33f, 18.07f, "Europe/Stockholm", 60),
+  EXACT("Vienna", 48.21f, 16.37f, "Europe/Vienna", 60),
+  EXACT("Prague", 50.08f, 14.44f, "Europe/Prague", 60),
+  EXACT("Warsaw", 52.23f, 21.01f, "Europe/Warsaw", 60),
+  EXACT("Budapest", 47.50f, 19.04f, "Europe/Budapest", 60),
+  EXACT("Rome", 41.90f, 12.50f, "Europe/Rome", 60),
+  EXACT("Athens", 37.98f, 23.73f, "Europe/Athens", 120),
+  EXACT("Sofia", 42.70f, 23.32f, "Europe/Sofia", 120),
+  EXACT("Bucharest", 44.43f, 26.10f, "Europe/Bucharest", 120),
+  EXACT("Kyiv", 50.45f, 30.52f, "Europe/Kyiv", 120),
+  EXACT("Helsinki", 60.17f, 24.94f, "Europe/Helsinki", 120),
+  EXACT("Istanbul", 41.01f, 28.98f, "Europe/Istanbul", 180),
+  EXACT("Ankara", 39.90f, 32.86f, "Europe/Istanbul", 180),
+  EXACT("Moscow", 55.75f, 37.62f, "Europe/Moscow", 180),
+  EXACT("Reykjavik", 64.15f, -21.94f, "Atlantic/Reykjavik", 0),
+  NEIGHBOUR("Barcelona", 41.39f, 2.17f, "Europe/Madrid", "Europe/Andorra", 60),
+  MISS("Thessaloniki", 40.64f, 22.94f, "Europe/Athens", 120, "Europe/Skopje", 60),
+
+  // Asia
+  EXACT("Jerusalem", 31.77f, 35.22f, "Asia/Jerusalem", 120),
+  EXACT("Riyadh", 24.71f, 46.68f, "Asia/Riyadh", 180),
+  EXACT("Tbilisi", 41.72f, 44.79f, "Asia/Tbilisi", 240),
+  EXACT("Yerevan", 40.18f, 44.51f, "Asia/Yerevan", 240),
+  EXACT("Baku", 40.41f, 49.87f, "Asia/Baku", 240),
+  EXACT("Dubai", 25.20f, 55.27f, "Asia/Dubai", 240),
+  EXACT("Tehran", 35.69f, 51.39f, "Asia/Tehran", 210),
+  EXACT("Karachi", 24.86f, 67.01f, "Asia/Karachi", 300),
+  EXACT("Tashkent", 41.31f, 69.28f, "Asia/Tashkent", 300),
+  EXACT("Yekaterinburg", 56.84f, 60.61f, "Asia/Yekaterinburg", 300),
+  EXACT("Kolkata", 22.57f, 88.36f, "Asia/Kolkata", 330),
+  EXACT("Dhaka", 23.81f, 90.41f, "Asia/Dhaka", 360),
+  EXACT("Yangon", 16.87f, 96.20f, "Asia/Yangon", 390),
+  EXACT("Bangkok", 13.75f, 100.50f, "Asia/Bangkok", 420),
+  EXACT("Ho Chi Minh City", 10.82f, 106.63f, "Asia/Ho_Chi_Minh", 420),
+  EXACT("Jakarta", -6.21f, 106.85f, "Asia/Jakarta", 420),
+  EXACT("Novosibirsk", 55.01f, 82.93f, "Asia/Novosibirsk", 420),
+  EXACT("Singapore", 1.35f, 103.82f, "Asia/Singapore", 480),
+  EXACT("Hong Kong", 22.32f, 114.17f, "Asia/Hong_Kong", 480),
+  EXACT("Shanghai", 31.23f, 121.47f, "Asia/Shanghai", 480),
+  EXACT("Taipei", 25.03f, 121.57f, "Asia/Taipei", 480),
+  EXACT("Manila", 14.60f, 120.98f, "Asia/Manila", 480),
+  EXACT("Denpasar", -8.65f, 115.22f, "Asia/Makassar", 480),
+  EXACT("Seoul", 37.57f, 126.98f, "Asia/Seoul", 540),
+  EXACT("Tokyo", 35.68f, 139.69f, "Asia/Tokyo", 540),
+  EXACT("Yakutsk", 62.03f, 129.73f, "Asia/Yakutsk", 540),
+  EXACT("Vladivostok", 43.12f, 131.89f, "Asia/Vladivostok", 600),
+  EXACT("Petropavlovsk-Kamchatsky", 53.02f, 158.65f, "Asia/Kamchatka", 720),
+  NEIGHBOUR("Hanoi", 21.03f, 105.85f, "Asia/Ho_Chi_Minh", "Asia/Vientiane", 420),
+  MISS("Islamabad", 33.69f, 73.06f, "Asia/Karachi", 300, "Asia/Kabul", 270),
+  MISS("Mumbai", 19.08f, 72.88f, "Asia/Kolkata", 330, "Asia/Karachi", 300),
+  MISS("Delhi", 28.61f, 77.21f, "Asia/Kolkata", 330, "Asia/Kathmandu", 345),
+  MISS("Beijing", 39.90f, 116.40f, "Asia/Shanghai", 480, "Asia/Pyongyang", 540),
+
+  // Africa
+  EXACT("Algiers", 36.75f, 3.06f, "Africa/Algiers", 60),
+  EXACT("Tunis", 36.81f, 10.18f, "Africa/Tunis", 60),
+  EXACT("Tripoli", 32.89f, 13.19f, "Africa/Tripoli", 120),
+  EXACT("Cairo", 30.04f, 31.24f, "Africa/Cairo", 120),
+  EXACT("Khartoum", 15.50f, 32.56f, "Africa/Khartoum", 120),
+  EXACT("Addis Ababa", 9.03f, 38.74f, "Africa/Addis_Ababa", 180),
+  EXACT("Nairobi", -1.29f, 36.82f, "Africa/Nairobi", 180),
+  EXACT("Dakar", 14.69f, -17.44f, "Africa/Dakar", 0),
+  EXACT("Accra", 5.60f, -0.19f, "Africa/Accra", 0),
+  EXACT("Lagos", 6.52f, 3.38f, "Africa/Lagos", 60),
+  EXACT("Douala", 4.05f, 9.70f, "Africa/Douala", 60),
+  EXACT("Johannesburg", -26.20f, 28.05f, "Africa/Johannesburg", 120),
+  EXACT("Maputo", -25.97f, 32.57f, "Africa/Maputo", 120),
+  EXACT("Antananarivo", -18.91f, 47.54f, "Indian/Antananarivo", 180),
+  EXACT("Port Louis", -20.16f, 57.50f, "Indian/Mauritius", 240),
+  NEIGHBOUR("Kinshasa", -4.32f, 15.31f, "Africa/Kinshasa", "Africa/Brazzaville", 60),
+  NEIGHBOUR("Cape Town", -33.92f, 18.42f, "Africa/Johannesburg", "Africa/Maseru", 120),
+
+  // Americas
+  EXACT("New York", 40.71f, -74.01f, "America/New_York", -300),
+  EXACT("Toronto", 43.65f, -79.38f, "America/Toronto", -300),
+  EXACT("Montreal", 45.50f, -73.57f, "America/Toronto", -300),
+  EXACT("Chicago", 41.88f, -87.63f, "America/Chicago", -360),
+  EXACT("Denver", 39.74f, -104.99f, "America/Denver", -420),
+  EXACT("Phoenix", 33.45f, -112.07f, "America/Phoenix", -420),
+  EXACT("Calgary", 51.05f, -114.07f, "America/Edmonton", -420),
+  EXACT("Los Angeles", 34.05f, -118.24f, "America/Los_Angeles", -480),
+  EXACT("Vancouver", 49.28f, -123.12f, "America/Vancouver", -480),
+  EXACT("Anchorage", 61.22f, -149.90f, "America/Anchorage", -540),
+  EXACT("Honolulu", 21.31f, -157.86f, "Pacific/Honolulu", -600),
+  EXACT("Hilo", 19.90f, -155.08f, "Pacific/Honolulu", -600),
+  EXACT("Mexico City", 19.43f, -99.13f, "America/Mexico_City", -360),
+  EXACT("Guatemala City", 14.63f, -90.51f, "America/Guatemala", -360),
+  EXACT("San Jose", 9.93f, -84.08f, "America/Costa_Rica", -360),
+  EXACT("Panama City", 8.98f, -79.52f, "America/Panama", -300),
+  EXACT("Havana", 23.11f, -82.37f, "America/Havana", -300),
+  EXACT("Kingston", 18.00f, -76.79f, "America/Jamaica", -300),
+  EXACT("Santo Domingo", 18.47f, -69.89f, "America/Santo_Domingo", -240),
+  EXACT("Bogota", 4.71f, -74.07f, "America/Bogota", -300),
+  EXACT("Quito", -0.18f, -78.47f, "America/Guayaquil", -300),
+  EXACT("Lima", -12.05f, -77.04f, "America/Lima", -300),
+  EXACT("Caracas", 10.49f, -66.88f, "America/Caracas", -240),
+  EXACT("La Paz", -16.50f, -68.15f, "America/La_Paz", -240),
+  EXACT("Manaus", -3.12f, -60.02f, "America/Manaus", -240),
+  EXACT("Santiago", -33.45f, -70.67f, "America/Santiago", -240),
+  EXACT("Brasilia", -15.79f, -47.88f, "America/Sao_Paulo", -180),
+  EXACT("Sao Paulo", -23.55f, -46.63f, "America/Sao_Paulo", -180),
+  EXACT("Recife", -8.05f, -34.88f, "America/Recife", -180),
+  EXACT("Montevideo", -34.90f, -56.16f, "America/Montevideo", -180),
+  EXACT("Buenos Aires", -34.60f, -58.38f, "America/Argentina/Buenos_Aires", -180),
+  EXACT("Ushuaia", -54.80f, -68.30f, "America/Argentina/Ushuaia", -180),
+  EXACT("Stanley", -51.70f, -57.85f, "Atlantic/Stanley", -180),
+  NEIGHBOUR("Miami", 25.76f, -80.19f, "America/New_York", "America/Nassau", -300),
+  NEIGHBOUR("Houston", 29.76f, -95.37f, "America/Chicago", "America/Matamoros", -360),
+  NEIGHBOUR("Seattle", 47.61f, -122.33f, "America/Los_Angeles", "America/Vancouver", -480),
+  MISS("Cusco", -13.53f, -71.97f, "America/Lima", -300, "America/La_Paz", -240),
+
+  // Oceania
+  EXACT("Perth", -31.95f, 115.86f, "Australia/Perth", 480),
+  EXACT("Darwin", -12.46f, 130.84f, "Australia/Darwin", 570),
+  EXACT("Adelaide", -34.93f, 138.60f, "Australia/Adelaide", 570),
+  EXACT("Brisbane", -27.47f, 153.03f, "Australia/Brisbane", 600),
+  EXACT("Sydney", -33.87f, 151.21f, "Australia/Sydney", 600),
+  EXACT("Melbourne", -37.81f, 144.96f, "Australia/Melbourne", 600),
+  EXACT("Port Moresby", -9.44f, 147.18f, "Pacific/Port_Moresby", 600),
+  EXACT("Hagatna", 13.44f, 144.79f, "Pacific/Guam", 600),
+  EXACT("Suva", -17.71f, 178.07f, "Pacific/Fiji", 720),
+  EXACT("Wellington", -41.29f, 174.78f, "Pacific/Auckland", 720),
+  EXACT("Christchurch", -43.53f, 172.64f, "Pacific/Auckland", 720),
+};
+
+static const size_t REFERENCE_COUNT = sizeof(REFERENCE) / sizeof(REFERENCE[0]);
+
+void setUp() {}
+void tearDown() {}
+
+void test_reference_points() {
+  const TimezoneGrid& grid = getTimezoneGrid();
+  TEST_ASSERT_TRUE(grid.isValid());
+  for (size_t i = 0; i < REFERENCE_COUNT; i++) {
+    const ReferencePoint& point = REFERENCE[i];
+    const char* zone = grid.lookup(point.latitude, point.longitude);
+    TEST_ASSERT_NOT_NULL_MESSAGE(zone, point.city);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE(point.gridZone, zone, point.city);
+  }
+}
+
+void test_offset_accuracy() {
+  // Share of reference cities whose clock would show the wrong time, and
+  // by how much. A raster from real borders (--boundaries) lowers both.
+  size_t wrongOffset = 0;
+  size_t wrongZone = 0;
+  int16_t worstErrorMin = 0;
+  for (size_t i = 0; i < REFERENCE_COUNT; i++) {
+    const ReferencePoint& point = REFERENCE[i];
+    int16_t errorMin = (int16_t)abs(point.gridOffsetMin - point.offsetMin);
+    if (errorMin != 0) {
+      wrongOffset++;
+    }
+    if (strcmp(point.zone, point.gridZone) != 0) {
+      wrongZone++;
+    }
+    worstErrorMin = errorMin > worstErrorMin ? errorMin : worstErrorMin;
+  }
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT32(100, REFERENCE_COUNT);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(REFERENCE_COUNT * 6 / 100, wrongOffset);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(REFERENCE_COUNT * 12 / 100, wrongZone);
+  TEST_ASSERT_LESS_OR_EQUAL_INT(60, worstErrorMin);
+}
+
+void test_known_border_misses() {
+  const TimezoneGrid& grid = getTimezoneGrid();
+
+  // Closer to Skopje than to Athens, so North Macedonia's zone: an hour behind
+  TEST_ASSERT_EQUAL_STRING("Europe/Skopje", grid.lookup(40.64f, 22.94f));
+  // Closer to La Paz than to Lima, so Bolivia's zone: an hour ahead
+  TEST_ASSERT_EQUAL_STRING("America/La_Paz", grid.lookup(-13.53f, -71.97f));
+
+  // A cell further into the country is right again
+  TEST_ASSERT_EQUAL_STRING("Europe/Athens", grid.lookup(38.5f, 23.0f));
+  TEST_ASSERT_EQUAL_STRING("America/Lima", grid.lookup(-12.5f, -76.5f));
+}
+
+void test_edges() {
+  const TimezoneGrid& grid = getTimezoneGrid();
+  TEST_ASSERT_EQUAL_FLOAT(0.5f, grid.cellSizeDegrees());
+
+  // Poles and the antimeridian are inside the raster
+  TEST_ASSERT_NOT_NULL(grid.lookup(90.0f, 0.0f));
+  TEST_ASSERT_NOT_NULL(grid.lookup(-90.0f, 0.0f));
+  TEST_ASSERT_NOT_NULL(grid.lookup(0.0f, 180.0f));
+  TEST_ASSERT_NOT_NULL(grid.lookup(0.0f, -180.0f));
+  TEST_ASSERT_NOT_NULL(grid.lookup(-90.0f, 180.0f));
+
+  TEST_ASSERT_NULL(grid.lookup(90.01f, 0.0f));
+  TEST_ASSERT_NULL(grid.lookup(-95.0f, 0.0f));
+  TEST_ASSERT_NULL(grid.lookup(0.0f, 180.5f));
+  TEST_ASSERT_NULL(grid.lookup(NAN, 0.0f));
+  TEST_ASSERT_NULL(grid.lookup(0.0f, NAN));
+
+  TimezoneGrid invalid(nullptr);
+  TEST_ASSERT_FALSE(invalid.isValid());
+  TEST_ASSERT_NULL(invalid.lookup(47.37f, 8.54f));
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, invalid.cellSizeDegrees());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_reference_points);
+  RUN_TEST(test_offset_accuracy);
+  RUN_TEST(test_known_border_misses);
+  RUN_TEST(test_edges);
+  return UNITY_END();
+}
@@ -0,0 +1,171 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// WarmState serializer round trip and rejection of damaged buffers (pio test -e native)
+
+#include <unity.h>
+#include <string.h>
+#include "WarmState.h"
+
+static WarmStateData sampleState() {
+  WarmStateData state;
+  state.epochUs = 1767225600123456LL;
+  state.monotonicUs = 0x0123456789ABCDEFULL;
+  state.mainBrightness = 200;
+  state.colonBrightness = 17;
+  state.temperature = 23;
+  state.temperatureEpoch = 0xFEDCBA98UL;
+  for (uint16_t i = 0; i < WARM_STATE_FRAME_BYTES; i++) {
+    state.frame[i] = (uint8_t)(i * 7 + 3);
+  }
+  return state;
+}
+
+static void assertStateEqual(const WarmStateData& expected, const WarmStateData& actual) {
+  // Unity without 64 bit support: compare both halves
+  TEST_ASSERT_EQUAL_HEX32((uint32_t)((uint64_t)expected.epochUs >> 32), (uint32_t)((uint64_t)actual.epochUs >> 32));
+  TEST_ASSERT_EQUAL_HEX32((uint32_t)expected.epochUs, (uint32_t)actual.epochUs);
+  TEST_ASSERT_EQUAL_HEX32((uint32_t)(expected.monotonicUs >> 32), (uint32_t)(actual.monotonicUs >> 32));
+  TEST_ASSERT_EQUAL_HEX32((uint32_t)expected.monotonicUs, (uint32_t)actual.monotonicUs);
+  TEST_ASSERT_EQUAL_UINT8(expected.mainBrightness, actual.mainBrightness);
+  TEST_ASSERT_EQUAL_UINT8(expected.colonBrightness, actual.colonBrightness);
+  TEST_ASSERT_EQUAL_INT8(expected.temperature, actual.temperature);
+  TEST_ASSERT_EQUAL_UINT32(expected.temperatureEpoch, actual.temperatureEpoch);
+  TEST_ASSERT_EQUAL_MEMORY(expected.frame, actual.frame, WARM_STATE_FRAME_BYTES);
+}
+
+// Serialized sample with the CRC recomputed after a change at offset
+static void patchAndReseal(uint8_t* buffer, size_t offset, uint8_t value) {
+  buffer[offset] = value;
+  uint32_t crc = warmStateCrc32(buffer, WARM_STATE_MAX_BYTES - 4);
+  for (uint8_t i = 0; i < 4; i++) {
+    buffer[WARM_STATE_MAX_BYTES - 4 + i] = (uint8_t)(crc >> (8 * i));
+  }
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_crc32_reference() {
+  // Standard check value of CRC-32/ISO-HDLC
+  TEST_ASSERT_EQUAL_HEX32(0xCBF43926UL, warmStateCrc32((const uint8_t*)"123456789", 9));
+  TEST_ASSERT_EQUAL_HEX32(0x00000000UL, warmStateCrc32(nullptr, 0));
+}
+
+void test_round_trip() {
+  WarmStateData state = sampleState();
+  uint8_t buffer[WARM_STATE_MAX_BYTES];
+  TEST_ASSERT_EQUAL_UINT32(WARM_STATE_MAX_BYTES, serializeWarmState(state, buffer, sizeof(buffer)));
+
+  WarmStateData restored;
+  memset(&restored, 0, sizeof(restored));
+  TEST_ASSERT_TRUE(deserializeWarmState(buffer, sizeof(buffer), restored));
+  assertStateEqual(state, restored);
+}
+
+void test_round_trip_negative_values() {
+  WarmStateData state = sampleState();
+  state.epochUs = -1234567890123LL;  // Before 1970 (RTC not set)
+  state.temperature = -17;
+  state.monotonicUs = UINT64_MAX;
+  state.mainBrightness = 0;
+  state.colonBrightness = 255;
+  uint8_t buffer[WARM_STATE_MAX_BYTES];
+  TEST_ASSERT_EQUAL_UINT32(WARM_STATE_MAX_BYTES, serializeWarmState(state, buffer, sizeof(buffer)));
+
+  WarmStateData restored;
+  TEST_ASSERT_TRUE(deserializeWarmState(buffer, sizeof(buffer), restored));
+  assertStateEqual(state, restored);
+  TEST_ASSERT_TRUE(restored.epochUs < 0);
+  TEST_ASSERT_EQUAL_INT8(-17, restored.temperature);
+}
+
+void test_layout_is_little_endian() {
+  WarmStateData state = sampleState();
+  uint8_t buffer[WARM_STATE_MAX_BYTES];
+  serializeWarmState(state, buffer, sizeof(buffer));
+  const uint8_t magic[] = {0x4C, 0x57, 0x4D, 0x53};  // "LWMS"
+  TEST_ASSERT_EQUAL_MEMORY(magic, buffer, 4);
+  TEST_ASSERT_EQUAL_UINT8(WARM_STATE_VERSION, buffer[4]);
+}
+
+void test_rejects_wrong_magic() {
+  WarmStateData state = sampleState();
+  uint8_t buffer[WARM_STATE_MAX_BYTES];
+  serializeWarmState(state, buffer, sizeof(buffer));
+  patchAndReseal(buffer, 0, buffer[0] ^ 0x01);
+
+  WarmStateData restored = {};
+  TEST_ASSERT_FALSE(deserializeWarmState(buffer, sizeof(buffer), restored));
+  TEST_ASSERT_EQUAL_UINT8(0, restored.mainBrightness);
+}
+
+void test_rejects_wrong_version() {
+  WarmStateData state = sampleState();
+  uint8_t buffer[WARM_STATE_MAX_BYTES];
+  serializeWarmState(state, buffer, sizeof(buffer));
+  patchAndReseal(buffer, 4, WARM_STATE_VERSION + 1);
+
+  WarmStateData restored = {};
+  TEST_ASSERT_FALSE(deserializeWarmState(buffer, sizeof(buffer), restored));
+}
+
+void test_rejects_flipped_payload_byte() {
+  WarmStateData state = sampleState();
+  uint8_t buffer[WARM_STATE_MAX_BYTES];
+  serializeWarmState(state, buffer, sizeof(buffer));
+
+  // Every single bit flip after the header, including the CRC itself
+  WarmStateData restored;
+  for (size_t offset = 5; offset < WARM_STATE_MAX_BYTES; offset++) {
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      buffer[offset] ^= (uint8_t)(1 << bit);
+      TEST_ASSERT_FALSE(deserializeWarmState(buffer, sizeof(buffer), restored));
+      buffer[offset] ^= (uint8_t)(1 << bit);
+    }
+  }
+  TEST_ASSERT_TRUE(deserializeWarmState(buffer, sizeof(buffer), restored));
+}
+
+void test_rejects_short_buffer() {
+  WarmStateData state = sampleState();
+  uint8_t buffer[WARM_STATE_MAX_BYTES];
+  TEST_ASSERT_EQUAL_UINT32(0, serializeWarmState(state, buffer, WARM_STATE_MAX_BYTES - 1));
+  TEST_ASSERT_EQUAL_UINT32(0, serializeWarmState(state, nullptr, WARM_STATE_MAX_BYTES));
+
+  serializeWarmState(state, buffer, sizeof(buffer));
+  WarmStateData restored;
+  TEST_ASSERT_FALSE(deserializeWarmState(buffer, WARM_STATE_MAX_BYTES - 1, restored));
+  TEST_ASSERT_FALSE(deserializeWarmState(buffer, 0, restored));
+  TEST_ASSERT_FALSE(deserializeWarmState(nullptr, WARM_STATE_MAX_BYTES, restored));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_crc32_reference);
+  RUN_TEST(test_round_trip);
+  RUN_TEST(test_round_trip_negative_values);
+  RUN_TEST(test_layout_is_little_endian);
+  RUN_TEST(test_rejects_wrong_magic);
+  RUN_TEST(test_rejects_wrong_version);
+  RUN_TEST(test_rejects_flipped_payload_byte);
+  RUN_TEST(test_rejects_short_buffer);
+  return UNITY_END();
+}
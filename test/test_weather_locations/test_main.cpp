@@ -0,0 +1,143 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// weatherLocations parser shared by the runtime and POST /api/config (pio test -e native)
+
+#include <unity.h>
+#include <string.h>
+#include "WeatherLocations.h"
+
+// WEATHER_MAX_LOCATIONS - 1 (config.h): extras next to the primary location
+static const uint8_t MAX_EXTRAS = 3;
+
+static WeatherLocation parsed[MAX_EXTRAS];
+static uint8_t count;
+
+static bool parse(const char* text) {
+  memset(parsed, 0, sizeof(parsed));
+  return parseWeatherLocations(text, parsed, MAX_EXTRAS, count);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_valid_entries() {
+  TEST_ASSERT_TRUE(parse(""));
+  TEST_ASSERT_EQUAL_UINT8(0, count);
+
+  TEST_ASSERT_TRUE(parse("b=52.52,13.40; L=51.51,-0.13"));
+  TEST_ASSERT_EQUAL_UINT8(2, count);
+  TEST_ASSERT_EQUAL('b', parsed[0].label);
+  TEST_ASSERT_FLOAT_WITHIN(0.0001f, 52.52f, parsed[0].latitude);
+  TEST_ASSERT_FLOAT_WITHIN(0.0001f, 13.40f, parsed[0].longitude);
+  TEST_ASSERT_EQUAL('L', parsed[1].label);
+  TEST_ASSERT_FLOAT_WITHIN(0.0001f, -0.13f, parsed[1].longitude);
+
+  // Range ends are valid
+  TEST_ASSERT_TRUE(parse("A=-90,-180;u=90,180"));
+  TEST_ASSERT_EQUAL_UINT8(2, count);
+  TEST_ASSERT_FLOAT_WITHIN(0.0001f, 180.0f, parsed[1].longitude);
+}
+
+void test_whitespace_and_separators() {
+  TEST_ASSERT_TRUE(parse("  b=52.52,13.40 ;  L=51.51,-0.13  ;"));
+  TEST_ASSERT_EQUAL_UINT8(2, count);
+  TEST_ASSERT_TRUE(parse("b=52.52,13.40;"));
+  TEST_ASSERT_EQUAL_UINT8(1, count);
+  TEST_ASSERT_TRUE(parse(";; ;"));
+  TEST_ASSERT_EQUAL_UINT8(0, count);
+
+  TEST_ASSERT_FALSE(parse("b =52.52,13.40"));
+  TEST_ASSERT_FALSE(parse("b=52.52 ,13.40"));
+  TEST_ASSERT_FALSE(parse("b=52.52,13.40, L=51.51,-0.13"));
+  TEST_ASSERT_FALSE(parse("b=52.52,13.40 L=51.51,-0.13"));
+}
+
+void test_unknown_label() {
+  // Left out on purpose: they read as digits next to a temperature
+  const char* const unreadable[] = {"I=1,1", "i=1,1", "l=1,1", "O=1,1", "S=1,1"};
+  for (uint8_t i = 0; i < sizeof(unreadable) / sizeof(unreadable[0]); i++) {
+    TEST_ASSERT_FALSE_MESSAGE(parse(unreadable[i]), unreadable[i]);
+  }
+  TEST_ASSERT_FALSE(parse("x=1,1"));
+  TEST_ASSERT_FALSE(parse("1=1,1"));
+  TEST_ASSERT_FALSE(parse("=1,1"));
+  TEST_ASSERT_FALSE(parse("bb=1,1"));
+  TEST_ASSERT_FALSE(parse("b=52.52,13.40; x=1,1"));
+
+  // Every glyph is accepted
+  char text[8];
+  for (const char* glyph = WEATHER_LABEL_GLYPHS; *glyph != '\0'; glyph++) {
+    text[0] = *glyph;
+    strcpy(text + 1, "=1,2");
+    TEST_ASSERT_TRUE_MESSAGE(parse(text), text);
+    TEST_ASSERT_EQUAL(*glyph, parsed[0].label);
+  }
+}
+
+void test_out_of_range_coordinates() {
+  TEST_ASSERT_FALSE(parse("b=90.01,0"));
+  TEST_ASSERT_FALSE(parse("b=-90.01,0"));
+  TEST_ASSERT_FALSE(parse("b=0,180.01"));
+  TEST_ASSERT_FALSE(parse("b=0,-180.01"));
+  TEST_ASSERT_FALSE(parse("b=1e3,0"));
+  TEST_ASSERT_FALSE(parse("b=nan,0"));
+  TEST_ASSERT_FALSE(parse("b=0,nan"));
+  TEST_ASSERT_FALSE(parse("b=0,inf"));
+  TEST_ASSERT_FALSE(parse("b=,13.40"));
+  TEST_ASSERT_FALSE(parse("b=52.52,"));
+  TEST_ASSERT_FALSE(parse("b=52.52"));
+  TEST_ASSERT_FALSE(parse("b=52.52,13.40x"));
+}
+
+void test_too_many_entries() {
+  TEST_ASSERT_TRUE(parse("A=1,1; b=2,2; C=3,3"));
+  TEST_ASSERT_EQUAL_UINT8(MAX_EXTRAS, count);
+  TEST_ASSERT_FALSE(parse("A=1,1; b=2,2; C=3,3; d=4,4"));
+  // A trailing separator is not an entry
+  TEST_ASSERT_TRUE(parse("A=1,1; b=2,2; C=3,3;"));
+  TEST_ASSERT_EQUAL_UINT8(MAX_EXTRAS, count);
+}
+
+void test_over_long_text() {
+  // Padding up to the limit is fine, one more character is not
+  char text[WEATHER_LOCATIONS_MAX_LEN + 2];
+  const char* entry = "b=52.52,13.40";
+  strcpy(text, entry);
+  memset(text + strlen(entry), ' ', WEATHER_LOCATIONS_MAX_LEN - strlen(entry));
+  text[WEATHER_LOCATIONS_MAX_LEN] = '\0';
+  TEST_ASSERT_TRUE(parse(text));
+  TEST_ASSERT_EQUAL_UINT8(1, count);
+
+  text[WEATHER_LOCATIONS_MAX_LEN] = ';';
+  text[WEATHER_LOCATIONS_MAX_LEN + 1] = '\0';
+  TEST_ASSERT_FALSE(parse(text));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_valid_entries);
+  RUN_TEST(test_whitespace_and_separators);
+  RUN_TEST(test_unknown_label);
+  RUN_TEST(test_out_of_range_coordinates);
+  RUN_TEST(test_too_many_entries);
+  RUN_TEST(test_over_long_text);
+  return UNITY_END();
+}
@@ -0,0 +1,308 @@
+/*
+ * This file is part of the 7 Segment LED Clock Project
+ *   https://github.com/ursweiss/7-Segment-LED-Clock
+ *   https://www.printables.com/model/68013-7-segment-led-clock
+ *
+ * Copyright (c) 2021-2025 Urs Weiss
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 3.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// WiFiRecovery driven through event sequences (pio test -e native)
+
+#include <unity.h>
+#include "WiFiRecovery.h"
+
+typedef WiFiRecovery::Action Action;
+typedef WiFiRecovery::Event Event;
+typedef WiFiRecovery::State State;
+
+// Reconnect timeout 10 s, backoff 1 s doubling up to 8 s, 3 reconnects,
+// full restart after 60 s of outage, full restart timeout 20 s
+static const WiFiRecovery::Timing TIMING = {10000, 1000, 8000, 3, 60000, 20000};
+
+// Histogram bucket of a duration (upper bounds 1, 2, 5, 10, 30, 60, 120, 600 s, open)
+static uint8_t bucketOf(uint32_t ms) {
+  uint8_t bucket = 0;
+  while (bucket < DurationHistogram::BUCKETS - 1 && ms > DurationHistogram::upperBoundMs(bucket)) {
+    bucket++;
+  }
+  return bucket;
+}
+
+// Ticks every 100 ms from start (exclusive) to end (inclusive), returns the first action
+static Action tickUntil(WiFiRecovery& recovery, uint32_t startMs, uint32_t endMs, uint32_t* actionMs = nullptr) {
+  for (uint32_t now = startMs + 100; now - startMs <= endMs - startMs; now += 100) {
+    Action action = recovery.tick(now);
+    if (action != Action::None) {
+      if (actionMs != nullptr) {
+        *actionMs = now;
+      }
+      return action;
+    }
+  }
+  return Action::None;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_events_ignored_before_start() {
+  WiFiRecovery recovery(TIMING);
+  TEST_ASSERT_EQUAL(Action::None, recovery.handleEvent(Event::Disconnected, 1000));
+  TEST_ASSERT_EQUAL(Action::None, recovery.tick(50000));
+  TEST_ASSERT_EQUAL(State::Idle, recovery.getState());
+  TEST_ASSERT_EQUAL_UINT32(0, recovery.getStats().disconnects);
+}
+
+void test_quick_reconnect() {
+  WiFiRecovery recovery(TIMING);
+  recovery.start(0);
+  TEST_ASSERT_EQUAL(State::Connected, recovery.getState());
+
+  TEST_ASSERT_EQUAL(Action::Lost, recovery.handleEvent(Event::Disconnected, 5000));
+  TEST_ASSERT_EQUAL(State::Reconnecting, recovery.getState());
+  TEST_ASSERT_EQUAL_UINT8(1, recovery.getAttempt());
+  TEST_ASSERT_EQUAL(Action::Recovered, recovery.handleEvent(Event::Connected, 6500));
+  TEST_ASSERT_EQUAL(State::Connected, recovery.getState());
+
+  // A second Connected (e.g. GOT_IP after a lease renewal) is not a recovery
+  TEST_ASSERT_EQUAL(Action::None, recovery.handleEvent(Event::Connected, 7000));
+
+  WiFiRecovery::Stats stats = recovery.getStats();
+  TEST_ASSERT_EQUAL_UINT32(1, stats.disconnects);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.reconnectAttempts);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.fullRestarts);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.recoveries);
+  TEST_ASSERT_EQUAL_UINT32(1500, stats.lastOutageMs);
+  TEST_ASSERT_EQUAL_UINT32(1, recovery.getOutageHistogram().count(1));
+  TEST_ASSERT_EQUAL_UINT32(1, recovery.getRecoverHistogram().count(1));
+}
+
+void test_backoff_doubles_until_full_restart() {
+  WiFiRecovery recovery(TIMING);
+  recovery.start(0);
+  uint32_t now = 10000;
+  TEST_ASSERT_EQUAL(Action::Lost, recovery.handleEvent(Event::Disconnected, now));
+
+  // Attempt 1 fails at once, attempt 2 follows after the initial 1 s backoff
+  now += 500;
+  TEST_ASSERT_EQUAL(Action::None, recovery.handleEvent(Event::Disconnected, now));
+  TEST_ASSERT_EQUAL(State::Backoff, recovery.getState());
+  TEST_ASSERT_EQUAL(Action::None, recovery.tick(now + 999));
+  TEST_ASSERT_EQUAL(Action::Reconnect, recovery.tick(now + 1000));
+  now += 1000;
+  TEST_ASSERT_EQUAL_UINT8(2, recovery.getAttempt());
+
+  // Attempt 2 times out after 10 s, attempt 3 follows after 2 s
+  TEST_ASSERT_EQUAL(Action::None, recovery.tick(now + 9999));
+  TEST_ASSERT_EQUAL(State::Reconnecting, recovery.getState());
+  TEST_ASSERT_EQUAL(Action::None, recovery.tick(now + 10000));
+  TEST_ASSERT_EQUAL(State::Backoff, recovery.getState());
+  now += 10000;
+  TEST_ASSERT_EQUAL(Action::None, recovery.tick(now + 1999));
+  TEST_ASSERT_EQUAL(Action::Reconnect, recovery.tick(now + 2000));
+  now += 2000;
+  TEST_ASSERT_EQUAL_UINT8(3, recovery.getAttempt());
+
+  // Attempt 3 times out, after 4 s the attempts are used up: full restart
+  TEST_ASSERT_EQUAL(Action::None, recovery.tick(now + 10000));
+  now += 10000;
+  TEST_ASSERT_EQUAL(Action::None, recovery.tick(now + 3999));
+  TEST_ASSERT_EQUAL(Action::FullRestart, recovery.tick(now + 4000));
+  now += 4000;
+  TEST_ASSERT_EQUAL(State::FullRestart, recovery.getState());
+
+  // The restart's own disconnect is expected
+  TEST_ASSERT_EQUAL(Action::None, recovery.handleEvent(Event::Disconnected, now + 100));
+  TEST_ASSERT_EQUAL(State::FullRestart, recovery.getState());
+
+  TEST_ASSERT_EQUAL(Action::Recovered, recovery.handleEvent(Event::Connected, now + 7000));
+  WiFiRecovery::Stats stats = recovery.getStats();
+  TEST_ASSERT_EQUAL_UINT32(3, stats.reconnectAttempts);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.fullRestarts);
+  TEST_ASSERT_EQUAL_UINT32(34500, stats.lastOutageMs);
+
+  // Outage 34.5 s (60 s bucket), the full restart took 7 s (10 s bucket)
+  TEST_ASSERT_EQUAL_UINT32(1, recovery.getOutageHistogram().count(bucketOf(34500)));
+  TEST_ASSERT_EQUAL_UINT32(5, bucketOf(34500));
+  TEST_ASSERT_EQUAL_UINT32(1, recovery.getRecoverHistogram().count(3));
+  TEST_ASSERT_EQUAL_UINT32(7000, recovery.getRecoverHistogram().maxValue());
+}
+
+void test_backoff_capped() {
+  WiFiRecovery::Timing timing = TIMING;
+  timing.maxAttempts = 10;
+  timing.fullRestartAfterMs = 3600000;
+  WiFiRecovery recovery(timing);
+  recovery.start(0);
+  recovery.handleEvent(Event::Disconnected, 1000);
+
+  // Every attempt fails at once: waits of 1, 2, 4, 8, 8, 8 s
+  const uint32_t expectedWaits[] = {1000, 2000, 4000, 8000, 8000, 8000};
+  uint32_t now = 1000;
+  for (uint8_t i = 0; i < sizeof(expectedWaits) / sizeof(expectedWaits[0]); i++) {
+    TEST_ASSERT_EQUAL(Action::None, recovery.handleEvent(Event::Disconnected, now));
+    uint32_t attemptMs = 0;
+    TEST_ASSERT_EQUAL(Action::Reconnect, tickUntil(recovery, now, now + 20000, &attemptMs));
+    TEST_ASSERT_EQUAL_UINT32(expectedWaits[i], attemptMs - now);
+    now = attemptMs;
+  }
+  TEST_ASSERT_EQUAL_UINT8(7, recovery.getAttempt());
+  TEST_ASSERT_EQUAL_UINT32(0, recovery.getStats().fullRestarts);
+}
+
+void test_full_restart_after_long_outage() {
+  // Plenty of reconnects allowed, the outage duration forces the full restart
+  WiFiRecovery::Timing timing = TIMING;
+  timing.maxAttempts = 100;
+  WiFiRecovery recovery(timing);
+  recovery.start(0);
+  recovery.handleEvent(Event::Disconnected, 0);
+
+  uint32_t actionMs = 0;
+  Action action;
+  uint32_t now = 0;
+  while ((action = tickUntil(recovery, now, now + 30000, &actionMs)) == Action::Reconnect) {
+    now = actionMs;
+  }
+  TEST_ASSERT_EQUAL(Action::FullRestart, action);
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT32(60000, actionMs);
+  TEST_ASSERT_LESS_THAN_UINT32(60000 + 10000 + 8000, actionMs);
+
+  // Full restart times out: quick reconnects start over
+  TEST_ASSERT_EQUAL(Action::None, recovery.tick(actionMs + 20000));
+  TEST_ASSERT_EQUAL(State::Backoff, recovery.getState());
+  TEST_ASSERT_EQUAL(Action::Reconnect, recovery.tick(actionMs + 21000));
+  TEST_ASSERT_EQUAL_UINT8(1, recovery.getAttempt());
+  TEST_ASSERT_EQUAL_UINT32(1, recovery.getStats().fullRestarts);
+}
+
+void test_millis_wrap() {
+  WiFiRecovery recovery(TIMING);
+  uint32_t start = 0xFFFFF000UL;
+  recovery.start(start);
+
+  // Lost 1 s before the wrap, attempt 1 fails, attempt 2 starts after the wrap
+  uint32_t lost = 0xFFFFFC18UL;
+  TEST_ASSERT_EQUAL(Action::Lost, recovery.handleEvent(Event::Disconnected, lost));
+  TEST_ASSERT_EQUAL(Action::None, recovery.handleEvent(Event::Disconnected, lost + 200));
+  TEST_ASSERT_EQUAL(Action::None, recovery.tick(lost + 1199));
+  TEST_ASSERT_EQUAL(Action::Reconnect, recovery.tick(lost + 1200));
+  TEST_ASSERT_TRUE(lost + 1200 < lost);
+
+  // Timeouts keep working across the wrap
+  uint32_t attempt = lost + 1200;
+  TEST_ASSERT_EQUAL(Action::None, recovery.tick(attempt + 9999));
+  TEST_ASSERT_EQUAL(State::Reconnecting, recovery.getState());
+
+  TEST_ASSERT_EQUAL(Action::Recovered, recovery.handleEvent(Event::Connected, attempt + 3800));
+  WiFiRecovery::Stats stats = recovery.getStats();
+  TEST_ASSERT_EQUAL_UINT32(5000, stats.lastOutageMs);
+  TEST_ASSERT_EQUAL_UINT32(1, recovery.getOutageHistogram().count(2));
+  TEST_ASSERT_EQUAL_UINT32(1, recovery.getRecoverHistogram().count(2));
+  TEST_ASSERT_EQUAL_UINT32(3800, recovery.getRecoverHistogram().maxValue());
+}
+
+void test_outage_histograms() {
+  WiFiRecovery recovery(TIMING);
+  recovery.start(0);
+
+  // Outages of 0.5 s, 1.5 s, 4 s, 4 s and 15 min, each reconnecting on attempt 1
+  const uint32_t outages[] = {500, 1500, 4000, 4000, 900000};
+  uint32_t now = 1000;
+  for (uint8_t i = 0; i < sizeof(outages) / sizeof(outages[0]); i++) {
+    recovery.handleEvent(Event::Disconnected, now);
+    recovery.handleEvent(Event::Connected, now + outages[i]);
+    now += outages[i] + 60000;
+  }
+
+  const DurationHistogram& outage = recovery.getOutageHistogram();
+  const uint32_t expected[DurationHistogram::BUCKETS] = {1, 1, 2, 0, 0, 0, 0, 0, 1};
+  for (uint8_t i = 0; i < DurationHistogram::BUCKETS; i++) {
+    TEST_ASSERT_EQUAL_UINT32(expected[i], outage.count(i));
+  }
+  TEST_ASSERT_EQUAL_UINT32(5, outage.totalCount());
+  TEST_ASSERT_EQUAL_UINT32(900000, outage.maxValue());
+  TEST_ASSERT_EQUAL_UINT32(5, recovery.getStats().recoveries);
+  TEST_ASSERT_EQUAL_UINT32(5, recovery.getStats().disconnects);
+}
+
+void test_planned_switch_not_an_outage() {
+  WiFiRecovery recovery(TIMING);
+  recovery.start(0);
+
+  // Switch only starts from a connection
+  WiFiRecovery idle(TIMING);
+  TEST_ASSERT_FALSE(idle.beginSwitch(1000));
+
+  // Roam: our own disconnect, then the new AP connects
+  TEST_ASSERT_TRUE(recovery.beginSwitch(5000));
+  TEST_ASSERT_EQUAL(State::Switching, recovery.getState());
+  TEST_ASSERT_FALSE(recovery.beginSwitch(5000));
+  TEST_ASSERT_EQUAL(Action::None, recovery.handleEvent(Event::Disconnected, 5010));
+  TEST_ASSERT_EQUAL(Action::None, tickUntil(recovery, 5010, 7000));
+  TEST_ASSERT_EQUAL(Action::Switched, recovery.handleEvent(Event::Connected, 7000));
+  TEST_ASSERT_EQUAL(State::Connected, recovery.getState());
+
+  WiFiRecovery::Stats stats = recovery.getStats();
+  TEST_ASSERT_EQUAL_UINT32(1, stats.switches);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.disconnects);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.reconnectAttempts);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.recoveries);
+  TEST_ASSERT_EQUAL_UINT32(0, recovery.getOutageHistogram().totalCount());
+  TEST_ASSERT_EQUAL_UINT32(0, recovery.getRecoverHistogram().totalCount());
+
+  // A real loss after the switch is an outage again
+  TEST_ASSERT_EQUAL(Action::Lost, recovery.handleEvent(Event::Disconnected, 20000));
+  TEST_ASSERT_EQUAL(Action::Recovered, recovery.handleEvent(Event::Connected, 21000));
+  TEST_ASSERT_EQUAL_UINT32(1, recovery.getStats().disconnects);
+  TEST_ASSERT_EQUAL_UINT32(1000, recovery.getStats().lastOutageMs);
+}
+
+void test_failed_switch_becomes_outage() {
+  WiFiRecovery recovery(TIMING);
+  recovery.start(0);
+
+  TEST_ASSERT_TRUE(recovery.beginSwitch(5000));
+  TEST_ASSERT_EQUAL(Action::None, recovery.handleEvent(Event::Disconnected, 5010));
+  // New AP does not connect before the reconnect timeout
+  uint32_t lostMs = 0;
+  TEST_ASSERT_EQUAL(Action::Lost, tickUntil(recovery, 5000, 20000, &lostMs));
+  TEST_ASSERT_EQUAL_UINT32(15000, lostMs);
+  TEST_ASSERT_EQUAL(State::Reconnecting, recovery.getState());
+  TEST_ASSERT_EQUAL_UINT8(1, recovery.getAttempt());
+
+  // Outage counted from the planned disconnect
+  TEST_ASSERT_EQUAL(Action::Recovered, recovery.handleEvent(Event::Connected, 16000));
+  WiFiRecovery::Stats stats = recovery.getStats();
+  TEST_ASSERT_EQUAL_UINT32(0, stats.switches);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.disconnects);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.recoveries);
+  TEST_ASSERT_EQUAL_UINT32(11000, stats.lastOutageMs);
+  TEST_ASSERT_EQUAL_UINT32(1, recovery.getOutageHistogram().count(bucketOf(11000)));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_events_ignored_before_start);
+  RUN_TEST(test_quick_reconnect);
+  RUN_TEST(test_backoff_doubles_until_full_restart);
+  RUN_TEST(test_backoff_capped);
+  RUN_TEST(test_full_restart_after_long_outage);
+  RUN_TEST(test_millis_wrap);
+  RUN_TEST(test_outage_histograms);
+  RUN_TEST(test_planned_switch_not_an_outage);
+  RUN_TEST(test_failed_switch_becomes_outage);
+  return UNITY_END();
+}